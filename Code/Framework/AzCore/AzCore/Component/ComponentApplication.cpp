@@ -22,6 +22,7 @@
 
 #include <AzCore/Memory/OverrunDetectionAllocator.h>
 #include <AzCore/Memory/AllocatorManager.h>
+#include <AzCore/Memory/FrameArenaAllocator.h>
 #include <AzCore/Memory/MallocSchema.h>
 
 #include <AzCore/NativeUI/NativeUIRequests.h>
@@ -54,6 +55,7 @@
 #include <AzCore/Debug/ProfilerDriller.h>
 #include <AzCore/Debug/EventTraceDriller.h>
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/Debug/ProfileTracer.h>
 #include <AzCore/Script/ScriptSystemBus.h>
 
 #include <AzCore/Math/PolygonPrism.h>
@@ -440,6 +442,7 @@ namespace AZ
         // Initializes the OSAllocator and SystemAllocator as soon as possible
         CreateOSAllocator();
         CreateSystemAllocator();
+        CreateFrameArenaAllocator();
 
         // Now that the Allocators are initialized, the Command Line parameters can be parsed
         m_commandLine.Parse(m_argC, m_argV);
@@ -593,12 +596,13 @@ namespace AZ
         // to use supplied startupParameters and descriptor parameters this time
         CreateOSAllocator();
         CreateSystemAllocator();
+        CreateFrameArenaAllocator();
 
         // This can be moved to the ComponentApplication constructor if need be
         // This is reading the *.setreg files using SystemFile and merging the settings
         // to the settings registry.
 
-        MergeSettingsToRegistry(*m_settingsRegistry);
+        MergeSettingsToRegistryOrLoadSnapshot();
 
         m_systemEntity = AZStd::make_unique<AZ::Entity>(SystemEntityId, "SystemEntity");
         CreateCommon();
@@ -625,6 +629,8 @@ namespace AZ
             m_eventLogger->Start(outputPath.Native(), baseFileName);
         }
 
+        Debug::ProfileTracer::Create();
+
         CreateDrillers();
 
         Sfmt::Create();
@@ -735,6 +741,8 @@ namespace AZ
 
         NameDictionary::Destroy();
 
+        Debug::ProfileTracer::Destroy();
+
         m_systemEntity.reset();
 
         Sfmt::Destroy();
@@ -768,6 +776,13 @@ namespace AZ
 
     void ComponentApplication::DestroyAllocator()
     {
+        // the frame arena takes its chunks from the system allocator, so it goes first
+        if (m_isFrameArenaAllocatorOwner)
+        {
+            AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Destroy();
+            m_isFrameArenaAllocatorOwner = false;
+        }
+
         // kill the system allocator if we created it
         if (m_isSystemAllocatorOwner)
         {
@@ -899,6 +914,18 @@ namespace AZ
         allocatorManager.FinalizeConfiguration();
     }
 
+    //=========================================================================
+    // CreateFrameArenaAllocator
+    //=========================================================================
+    void ComponentApplication::CreateFrameArenaAllocator()
+    {
+        if (!AZ::AllocatorInstance<AZ::FrameArenaAllocator>::IsReady())
+        {
+            AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Create();
+            m_isFrameArenaAllocatorOwner = true;
+        }
+    }
+
     //=========================================================================
     // CreateDrillers
     // [2/20/2013]
@@ -977,6 +1004,40 @@ namespace AZ
         SettingsRegistryMergeUtils::MergeSettingsToRegistry_AddRuntimeFilePaths(registry);
     }
 
+    void ComponentApplication::MergeSettingsToRegistryOrLoadSnapshot()
+    {
+        bool useSnapshot = false;
+        m_settingsRegistry->Get(useSnapshot, SettingsRegistryMergeUtils::SettingsRegistrySnapshotKey);
+
+        AZ::IO::FixedMaxPath snapshotPath;
+        if (!useSnapshot || !m_settingsRegistry->Get(snapshotPath.Native(), SettingsRegistryMergeUtils::FilePathKey_DevWriteStorage))
+        {
+            MergeSettingsToRegistry(*m_settingsRegistry);
+            return;
+        }
+
+        // Each application merges a different set of files, so every executable gets its own snapshot.
+        char executablePath[AZ::IO::MaxPathLength];
+        AZ::Utils::GetExecutablePathReturnType executablePathResult = AZ::Utils::GetExecutablePath(executablePath, AZ_ARRAY_SIZE(executablePath));
+        AZ::IO::PathView executableName = executablePathResult.m_pathStored == AZ::Utils::ExecutablePathResult::Success &&
+            executablePathResult.m_pathIncludesFilename ? AZ::IO::PathView(executablePath).Stem() : AZ::IO::PathView("Application");
+        snapshotPath /= "SettingsRegistry";
+        snapshotPath /= executableName;
+        snapshotPath.ReplaceExtension(".setregsnapshot");
+
+        // The settings that are available before merging, such as the command line and the o3de user registry, determine which
+        // files will be merged, so they're used as the key for the snapshot.
+        auto& registryImpl = static_cast<SettingsRegistryImpl&>(*m_settingsRegistry);
+        const u64 snapshotKey = registryImpl.CalculateSettingsHash();
+        if (registryImpl.LoadSnapshot(snapshotPath.Native(), snapshotKey))
+        {
+            return;
+        }
+
+        MergeSettingsToRegistry(*m_settingsRegistry);
+        registryImpl.SaveSnapshot(snapshotPath.Native(), snapshotKey);
+    }
+
     void ComponentApplication::SetSettingsRegistrySpecializations(SettingsRegistryInterface::Specializations& specializations)
     {
 #if defined(AZ_DEBUG_BUILD)
@@ -1393,6 +1454,7 @@ namespace AZ
     //=========================================================================
     void ComponentApplication::Tick(float deltaOverride /*= -1.f*/)
     {
+        Debug::ProfileTracer::RecordFrameMarker();
         {
             AZ_PROFILE_SCOPE(System, "Component application simulation tick");
 
@@ -1400,6 +1462,12 @@ namespace AZ
 
             m_deltaTime = 0.0f;
 
+            // Memory allocated from the frame arena during the previous tick is reclaimed from here on
+            if (AllocatorInstance<FrameArenaAllocator>::IsReady())
+            {
+                static_cast<FrameArenaAllocator&>(AllocatorInstance<FrameArenaAllocator>::GetAllocator()).ResetFrame();
+            }
+
             if (now >= m_currentTime)
             {
                 AZStd::chrono::duration<float> delta = now - m_currentTime;
@@ -1410,6 +1478,11 @@ namespace AZ
                 AZ_PROFILE_SCOPE(AzCore, "ComponentApplication::Tick:ExecuteQueuedEvents");
                 TickBus::ExecuteQueuedEvents();
             }
+            if (m_console)
+            {
+                AZ_PROFILE_SCOPE(AzCore, "ComponentApplication::Tick:ExecuteQueuedConsoleCommands");
+                m_console->ExecuteQueuedConsoleCommands();
+            }
             m_currentTime = now;
             {
                 AZ_PROFILE_SCOPE(AzCore, "ComponentApplication::Tick:OnTick");
@@ -324,10 +324,16 @@ namespace AZ
         /// Create the system allocator using the data in the m_descriptor
         void        CreateSystemAllocator();
 
+        /// Create the per-frame arena allocator, which is reset at the start of every Tick
+        void        CreateFrameArenaAllocator();
+
         /// Create the drillers
         void        CreateDrillers();
 
         virtual void MergeSettingsToRegistry(SettingsRegistryInterface& registry);
+        //! Loads the settings from a snapshot if snapshots are enabled and the snapshot is up to date. Otherwise the settings are
+        //! merged through MergeSettingsToRegistry, after which the snapshot is updated if enabled.
+        void MergeSettingsToRegistryOrLoadSnapshot();
 
         //! Sets the specializations that will be used when loading the Settings Registry. Extend this in derived
         //! application classes to specialize settings for those applications.
@@ -388,6 +394,7 @@ namespace AZ
         bool                                        m_isStarted{ false };
         bool                                        m_isSystemAllocatorOwner{ false };
         bool                                        m_isOSAllocatorOwner{ false };
+        bool                                        m_isFrameArenaAllocatorOwner{ false };
         bool                                        m_ownsConsole{};
         void*                                       m_fixedMemoryBlock{ nullptr }; //!< Pointer to the memory block allocator, so we can free it OnDestroy.
         IAllocatorAllocate*                         m_osAllocator{ nullptr };
@@ -36,6 +36,19 @@ namespace AZ
         return count;
     }
 
+    //! Returns the key functors with the provided name are stored under in the command map.
+    static Crc32 GetCommandKey(AZStd::string_view command)
+    {
+        constexpr bool forceLowerCase = true;
+        return Crc32(command.data(), command.size(), forceLowerCase);
+    }
+
+    static bool IsSameCommand(AZStd::string_view lhs, AZStd::string_view rhs)
+    {
+        constexpr bool caseSensitive = false;
+        return StringFunc::Equal(lhs, rhs, caseSensitive);
+    }
+
     Console::Console()
         : m_head(nullptr)
     {
@@ -51,6 +64,14 @@ namespace AZ
     {
         // on console destruction relink the console functors back to the deferred head
         MoveFunctorsToDeferredHead(AZ::ConsoleFunctorBase::GetDeferredHead());
+
+        QueuedCommand* queuedCommand = m_queuedCommands.exchange(nullptr, AZStd::memory_order_acquire);
+        while (queuedCommand != nullptr)
+        {
+            QueuedCommand* next = queuedCommand->m_next;
+            delete queuedCommand;
+            queuedCommand = next;
+        }
     }
 
     bool Console::PerformCommand
@@ -190,6 +211,56 @@ namespace AZ
         m_deferredCommands = {};
     }
 
+    void Console::QueueCommand
+    (
+        AZStd::string_view command,
+        ConsoleSilentMode silentMode,
+        ConsoleInvokedFrom invokedFrom,
+        ConsoleFunctorFlags requiredSet,
+        ConsoleFunctorFlags requiredClear
+    )
+    {
+        QueuedCommand* queuedCommand = aznew QueuedCommand;
+        queuedCommand->m_command = command;
+        queuedCommand->m_silentMode = silentMode;
+        queuedCommand->m_invokedFrom = invokedFrom;
+        queuedCommand->m_requiredSet = requiredSet;
+        queuedCommand->m_requiredClear = requiredClear;
+
+        QueuedCommand* head = m_queuedCommands.load(AZStd::memory_order_relaxed);
+        do
+        {
+            queuedCommand->m_next = head;
+        } while (!m_queuedCommands.compare_exchange_weak(head, queuedCommand, AZStd::memory_order_release, AZStd::memory_order_relaxed));
+    }
+
+    size_t Console::ExecuteQueuedConsoleCommands()
+    {
+        // Take all queued commands at once. They're linked newest first, so reverse the list to execute them in the order they were queued.
+        QueuedCommand* queuedCommand = m_queuedCommands.exchange(nullptr, AZStd::memory_order_acquire);
+        QueuedCommand* ordered = nullptr;
+        while (queuedCommand != nullptr)
+        {
+            QueuedCommand* next = queuedCommand->m_next;
+            queuedCommand->m_next = ordered;
+            ordered = queuedCommand;
+            queuedCommand = next;
+        }
+
+        size_t executedCount = 0;
+        while (ordered != nullptr)
+        {
+            PerformCommand(ordered->m_command.c_str(), ordered->m_silentMode, ordered->m_invokedFrom,
+                ordered->m_requiredSet, ordered->m_requiredClear);
+            ++executedCount;
+
+            QueuedCommand* next = ordered->m_next;
+            delete ordered;
+            ordered = next;
+        }
+        return executedCount;
+    }
+
     bool Console::HasCommand(AZStd::string_view command)
     {
         return FindCommand(command) != nullptr;
@@ -197,14 +268,16 @@ namespace AZ
 
     ConsoleFunctorBase* Console::FindCommand(AZStd::string_view command)
     {
-        CVarFixedString lowerName(command);
-        AZStd::to_lower(lowerName.begin(), lowerName.end());
-
-        CommandMap::iterator iter = m_commands.find(lowerName);
+        CommandMap::iterator iter = m_commands.find(GetCommandKey(command));
         if (iter != m_commands.end())
         {
             for (ConsoleFunctorBase* curr : iter->second)
             {
+                if (!IsSameCommand(curr->GetName(), command))
+                {
+                    continue;
+                }
+
                 if ((curr->GetFlags() & ConsoleFunctorFlags::IsInvisible) == ConsoleFunctorFlags::IsInvisible)
                 {
                     // Filter functors marked as invisible
@@ -271,7 +344,16 @@ namespace AZ
     {
         for (auto& curr : m_commands)
         {
-            visitor(curr.second.front());
+            // Visit the first functor for every name stored under this key
+            const AZStd::vector<ConsoleFunctorBase*>& functors = curr.second;
+            for (auto iter = functors.begin(); iter != functors.end(); ++iter)
+            {
+                auto sameName = [iter](ConsoleFunctorBase* functor) { return IsSameCommand(functor->GetName(), (*iter)->GetName()); };
+                if (AZStd::find_if(functors.begin(), iter, sameName) == iter)
+                {
+                    visitor(*iter);
+                }
+            }
         }
     }
 
@@ -283,9 +365,8 @@ namespace AZ
             return;
         }
 
-        CVarFixedString lowerName = functor->GetName();
-        AZStd::to_lower(lowerName.begin(), lowerName.end());
-        CommandMap::iterator iter = m_commands.find(lowerName);
+        const Crc32 commandKey = GetCommandKey(functor->GetName());
+        CommandMap::iterator iter = m_commands.find(commandKey);
         if (iter != m_commands.end())
         {
             // Validate we haven't already added this cvar
@@ -297,9 +378,11 @@ namespace AZ
             }
 
             // If multiple cvars are registered with the same name, validate that the types and flags match
-            if (!iter->second.empty())
+            auto sameName = AZStd::find_if(iter->second.begin(), iter->second.end(),
+                [functor](ConsoleFunctorBase* registered) { return IsSameCommand(registered->GetName(), functor->GetName()); });
+            if (sameName != iter->second.end())
             {
-                ConsoleFunctorBase* front = iter->second.front();
+                ConsoleFunctorBase* front = *sameName;
                 if (front->GetFlags() != functor->GetFlags() || front->GetTypeId() != functor->GetTypeId())
                 {
                     AZ_Assert(false, "Mismatched console functor types registered under the same name");
@@ -313,7 +396,7 @@ namespace AZ
                 }
             }
         }
-        m_commands[lowerName].emplace_back(functor);
+        m_commands[commandKey].emplace_back(functor);
         functor->Link(m_head);
         functor->m_console = this;
     }
@@ -326,9 +409,7 @@ namespace AZ
             return;
         }
 
-        CVarFixedString lowerName = functor->GetName();
-        AZStd::to_lower(lowerName.begin(), lowerName.end());
-        CommandMap::iterator iter = m_commands.find(lowerName);
+        CommandMap::iterator iter = m_commands.find(GetCommandKey(functor->GetName()));
         if (iter != m_commands.end())
         {
             AZStd::vector<ConsoleFunctorBase*>::iterator iter2 = AZStd::find(iter->second.begin(), iter->second.end(), functor);
@@ -336,6 +417,10 @@ namespace AZ
             {
                 iter->second.erase(iter2);
             }
+            if (iter->second.empty())
+            {
+                m_commands.erase(iter);
+            }
         }
         functor->Unlink(m_head);
         functor->m_console = nullptr;
@@ -402,14 +487,16 @@ namespace AZ
         bool result = false;
         ConsoleFunctorFlags flags = ConsoleFunctorFlags::Null;
 
-        CVarFixedString lowerName(command);
-        AZStd::to_lower(lowerName.begin(), lowerName.end());
-
-        CommandMap::iterator iter = m_commands.find(lowerName);
+        CommandMap::iterator iter = m_commands.find(GetCommandKey(command));
         if (iter != m_commands.end())
         {
             for (ConsoleFunctorBase* curr : iter->second)
             {
+                if (!IsSameCommand(curr->GetName(), command))
+                {
+                    continue;
+                }
+
                 if ((curr->GetFlags() & requiredSet) != requiredSet)
                 {
                     AZLOG_WARN("%s failed required set flag check\n", curr->m_name);
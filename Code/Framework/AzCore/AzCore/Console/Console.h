@@ -9,10 +9,12 @@
 #pragma once
 
 #include <AzCore/Console/IConsole.h>
+#include <AzCore/Math/Crc.h>
 #include <AzCore/Memory/OSAllocator.h>
 #include <AzCore/Settings/SettingsRegistry.h>
 #include <AzCore/std/functional.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/atomic.h>
 
 namespace AZ
 {
@@ -63,6 +65,15 @@ namespace AZ
         bool ExecuteDeferredConsoleCommands() override;
 
         void ClearDeferredConsoleCommands() override;
+        void QueueCommand
+        (
+            AZStd::string_view command,
+            ConsoleSilentMode silentMode = ConsoleSilentMode::NotSilent,
+            ConsoleInvokedFrom invokedFrom = ConsoleInvokedFrom::AzConsole,
+            ConsoleFunctorFlags requiredSet = ConsoleFunctorFlags::Null,
+            ConsoleFunctorFlags requiredClear = ConsoleFunctorFlags::ReadOnly
+        ) override;
+        size_t ExecuteQueuedConsoleCommands() override;
 
         bool HasCommand(AZStd::string_view command) override;
         ConsoleFunctorBase* FindCommand(AZStd::string_view command) override;
@@ -99,7 +110,9 @@ namespace AZ
         AZ_DISABLE_COPY_MOVE(Console);
 
         ConsoleFunctorBase* m_head;
-        using CommandMap = AZStd::unordered_map<CVarFixedString, AZStd::vector<ConsoleFunctorBase*>>;
+        //! Functors are stored by the case-insensitive Crc32 of their name so lookups don't need to copy and lower-case the
+        //! command. Every list can contain functors with different names in case of a collision, so names are still compared.
+        using CommandMap = AZStd::unordered_map<Crc32, AZStd::vector<ConsoleFunctorBase*>>;
         CommandMap m_commands;
         AZ::SettingsRegistryInterface::NotifyEventHandler m_consoleCommandKeyHandler;
         struct DeferredCommand
@@ -115,6 +128,21 @@ namespace AZ
         using DeferredCommandQueue = AZStd::deque<DeferredCommand>;
         DeferredCommandQueue m_deferredCommands;
 
+        //! Command queued through QueueCommand. Queued commands form an intrusive list which producers push onto with a
+        //! compare-exchange, while the single consumer takes the entire list at once, so no node is ever popped individually.
+        struct QueuedCommand
+        {
+            AZ_CLASS_ALLOCATOR(QueuedCommand, AZ::OSAllocator, 0);
+
+            QueuedCommand* m_next{ nullptr };
+            AZStd::string m_command;
+            ConsoleSilentMode m_silentMode;
+            ConsoleInvokedFrom m_invokedFrom;
+            ConsoleFunctorFlags m_requiredSet;
+            ConsoleFunctorFlags m_requiredClear;
+        };
+        AZStd::atomic<QueuedCommand*> m_queuedCommands{ nullptr };
+
         friend struct ConsoleCommandKeyNotificationHandler;
         friend class ConsoleFunctorBase;
     };
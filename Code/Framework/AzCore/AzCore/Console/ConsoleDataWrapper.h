@@ -29,6 +29,16 @@ namespace AZ
     class ConsoleDataContainer<BASE_TYPE, ThreadSafety::RequiresLock>
     {
     protected:
+        BASE_TYPE LoadValue() const
+        {
+            return m_value;
+        }
+
+        void StoreValue(const BASE_TYPE& value)
+        {
+            m_value = value;
+        }
+
         ThreadSafeObject<BASE_TYPE> m_value;
     };
 
@@ -36,6 +46,18 @@ namespace AZ
     class ConsoleDataContainer<BASE_TYPE, ThreadSafety::UseStdAtomic>
     {
     protected:
+        // Cvars are read far more often than they're written and don't guard any other data, so acquire/release
+        // ordering is sufficient and avoids the full fence of a sequentially consistent store.
+        BASE_TYPE LoadValue() const
+        {
+            return m_value.load(std::memory_order_acquire);
+        }
+
+        void StoreValue(const BASE_TYPE& value)
+        {
+            m_value.store(value, std::memory_order_release);
+        }
+
         std::atomic<BASE_TYPE> m_value;
     };
 
@@ -26,75 +26,75 @@ namespace AZ
         : m_callback(callback)
         , m_functor(name, desc, flags, AzTypeInfo<BASE_TYPE>::Uuid(), *this, &ConsoleDataWrapper<BASE_TYPE, THREAD_SAFETY>::CvarFunctor)
     {
-        this->m_value = value;
+        this->StoreValue(value);
     }
 
     template <typename BASE_TYPE, ThreadSafety THREAD_SAFETY>
     inline void ConsoleDataWrapper<BASE_TYPE, THREAD_SAFETY>::operator =(const BASE_TYPE& rhs)
     {
-        this->m_value = rhs;
+        this->StoreValue(rhs);
     }
 
     template <typename BASE_TYPE, ThreadSafety THREAD_SAFETY>
     inline ConsoleDataWrapper<BASE_TYPE, THREAD_SAFETY>::operator BASE_TYPE() const
     {
-        const BASE_TYPE currentValue = this->m_value;
+        const BASE_TYPE currentValue = this->LoadValue();
         return currentValue;
     }
 
     template <typename BASE_TYPE, ThreadSafety THREAD_SAFETY>
     inline bool ConsoleDataWrapper<BASE_TYPE, THREAD_SAFETY>::operator ==(const BASE_TYPE& rhs) const
     {
-        const BASE_TYPE currentValue = this->m_value;
+        const BASE_TYPE currentValue = this->LoadValue();
         return currentValue == rhs;
     }
 
     template <typename BASE_TYPE, ThreadSafety THREAD_SAFETY>
     inline bool ConsoleDataWrapper<BASE_TYPE, THREAD_SAFETY>::operator !=(const BASE_TYPE& rhs) const
     {
-        const BASE_TYPE currentValue = this->m_value;
+        const BASE_TYPE currentValue = this->LoadValue();
         return currentValue != rhs;
     }
 
     template <typename BASE_TYPE, ThreadSafety THREAD_SAFETY>
     inline bool ConsoleDataWrapper<BASE_TYPE, THREAD_SAFETY>::operator <(const BASE_TYPE& rhs) const
     {
-        const BASE_TYPE currentValue = this->m_value;
+        const BASE_TYPE currentValue = this->LoadValue();
         return currentValue < rhs;
     }
 
     template <typename BASE_TYPE, ThreadSafety THREAD_SAFETY>
     inline bool ConsoleDataWrapper<BASE_TYPE, THREAD_SAFETY>::operator <=(const BASE_TYPE& rhs) const
     {
-        const BASE_TYPE currentValue = this->m_value;
+        const BASE_TYPE currentValue = this->LoadValue();
         return currentValue <= rhs;
     }
 
     template <typename BASE_TYPE, ThreadSafety THREAD_SAFETY>
     inline bool ConsoleDataWrapper<BASE_TYPE, THREAD_SAFETY>::operator >(const BASE_TYPE& rhs) const
     {
-        const BASE_TYPE currentValue = this->m_value;
+        const BASE_TYPE currentValue = this->LoadValue();
         return currentValue > rhs;
     }
 
     template <typename BASE_TYPE, ThreadSafety THREAD_SAFETY>
     inline bool ConsoleDataWrapper<BASE_TYPE, THREAD_SAFETY>::operator >=(const BASE_TYPE& rhs) const
     {
-        const BASE_TYPE currentValue = this->m_value;
+        const BASE_TYPE currentValue = this->LoadValue();
         return currentValue >= rhs;
     }
 
     template <typename BASE_TYPE, ThreadSafety THREAD_SAFETY>
     bool ConsoleDataWrapper<BASE_TYPE, THREAD_SAFETY>::StringToValue(const ConsoleCommandContainer& arguments)
     {
-        const BASE_TYPE currentValue = this->m_value;
+        const BASE_TYPE currentValue = this->LoadValue();
         BASE_TYPE newValue = currentValue;
 
         if (ConsoleTypeHelpers::StringSetToValue(newValue, arguments))
         {
             if (newValue != currentValue)
             {
-                this->m_value = newValue;
+                this->StoreValue(newValue);
                 InvokeCallback();
             }
 
@@ -107,7 +107,7 @@ namespace AZ
     template <typename BASE_TYPE, ThreadSafety THREAD_SAFETY>
     void ConsoleDataWrapper<BASE_TYPE, THREAD_SAFETY>::ValueToString(CVarFixedString& outString) const
     {
-        const BASE_TYPE currentValue = this->m_value;
+        const BASE_TYPE currentValue = this->LoadValue();
         outString = ConsoleTypeHelpers::ValueToString(currentValue);
     }
 
@@ -116,7 +116,7 @@ namespace AZ
     {
         if (m_callback)
         {
-            const BASE_TYPE currentValue = this->m_value;
+            const BASE_TYPE currentValue = this->LoadValue();
             m_callback(currentValue);
         }
     }
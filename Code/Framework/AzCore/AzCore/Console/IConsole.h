@@ -102,6 +102,28 @@ namespace AZ
         //! Clear out any deferred console commands queue
         virtual void ClearDeferredConsoleCommands() = 0;
 
+        //! Queues a console command to be executed by the next call to ExecuteQueuedConsoleCommands.
+        //! Unlike PerformCommand this is safe to call from any thread and doesn't block, which makes it suitable
+        //! for tools and remote connections that issue a large number of commands while the game is running.
+        //! @param command       the command string to parse and execute
+        //! @param silentMode    if true, logs will be suppressed during command execution
+        //! @param invokedFrom   the source point that initiated console invocation
+        //! @param requiredSet   a set of flags that must be set on the functor for it to execute
+        //! @param requiredClear a set of flags that must *NOT* be set on the functor for it to execute
+        virtual void QueueCommand
+        (
+            AZStd::string_view command,
+            ConsoleSilentMode silentMode = ConsoleSilentMode::NotSilent,
+            ConsoleInvokedFrom invokedFrom = ConsoleInvokedFrom::AzConsole,
+            ConsoleFunctorFlags requiredSet = ConsoleFunctorFlags::Null,
+            ConsoleFunctorFlags requiredClear = ConsoleFunctorFlags::ReadOnly
+        ) = 0;
+
+        //! Executes all commands queued with QueueCommand in the order they were queued.
+        //! This should only be called from a single thread, typically once per tick.
+        //! @return the number of commands that were executed
+        virtual size_t ExecuteQueuedConsoleCommands() = 0;
+
         //! HasCommand is used to determine if the console knows about a command.
         //! @param command the command we are checking for
         //! @return boolean true on if the command is registered, false otherwise
@@ -199,7 +221,7 @@ template <typename _TYPE, typename = void>
 static constexpr AZ::ThreadSafety ConsoleThreadSafety = AZ::ThreadSafety::RequiresLock;
 
 template <typename _TYPE>
-static constexpr AZ::ThreadSafety ConsoleThreadSafety<_TYPE, std::enable_if_t<std::is_arithmetic_v<_TYPE>>> = AZ::ThreadSafety::UseStdAtomic;
+static constexpr AZ::ThreadSafety ConsoleThreadSafety<_TYPE, std::enable_if_t<std::is_arithmetic_v<_TYPE> || std::is_enum_v<_TYPE>>> = AZ::ThreadSafety::UseStdAtomic;
 
 //! Standard cvar macro.
 //! @param _TYPE the data type of the cvar
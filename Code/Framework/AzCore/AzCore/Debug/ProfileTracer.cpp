@@ -0,0 +1,678 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Debug/ProfileTracer.h>
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/IO/GenericStreams.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Memory/OSAllocator.h>
+#include <AzCore/Module/Environment.h>
+#include <AzCore/Platform.h>
+#include <AzCore/Settings/SettingsRegistryMergeUtils.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/string/string.h>
+
+namespace AZ
+{
+    namespace Debug
+    {
+        static void OnProfileTraceEnableChanged(const bool& enabled)
+        {
+            if (ProfileTracer* tracer = ProfileTracer::Get())
+            {
+                tracer->SetEnabled(enabled);
+            }
+        }
+
+        static void OnProfileTraceEventsPerThreadChanged(const uint32_t& eventsPerThread)
+        {
+            if (ProfileTracer* tracer = ProfileTracer::Get())
+            {
+                tracer->SetEventsPerThread(eventsPerThread);
+            }
+        }
+
+        AZ_CVAR(bool, bg_profileTraceEnable, false, &OnProfileTraceEnableChanged, ConsoleFunctorFlags::Null,
+            "Records profile scopes, counters and frame markers into per-thread ring buffers that can be written out with ProfileTraceDump.");
+        AZ_CVAR(uint32_t, bg_profileTraceEventsPerThread, ProfileTracer::DefaultEventsPerThread, &OnProfileTraceEventsPerThreadChanged,
+            ConsoleFunctorFlags::Null, "The number of most recent events the profile tracer keeps for every thread. Each event takes 24 bytes.");
+
+        static void ProfileTraceDump(const ConsoleCommandContainer& arguments)
+        {
+            ProfileTracer* tracer = ProfileTracer::Get();
+            if (!tracer)
+            {
+                AZ_Warning("ProfileTracer", false, "The profile tracer hasn't been created.");
+                return;
+            }
+
+            IO::FixedMaxPath outputPath;
+            if (!arguments.empty())
+            {
+                outputPath = IO::PathView(arguments.front());
+            }
+            else
+            {
+                if (auto registry = SettingsRegistry::Get(); registry != nullptr)
+                {
+                    registry->Get(outputPath.Native(), SettingsRegistryMergeUtils::FilePathKey_DevWriteStorage);
+                }
+                outputPath /= "Traces";
+                outputPath /= IO::FixedMaxPathString::format("ProfileTrace_%llu.json", static_cast<unsigned long long>(AZStd::GetTimeUTCMilliSecond()));
+            }
+
+            if (tracer->WriteChromeTrace(outputPath.c_str()))
+            {
+                AZ_TracePrintf("ProfileTracer", "Profile trace written to '%s'.\n", outputPath.c_str());
+            }
+        }
+
+        static void ProfileTraceClear([[maybe_unused]] const ConsoleCommandContainer& arguments)
+        {
+            if (ProfileTracer* tracer = ProfileTracer::Get())
+            {
+                tracer->Clear();
+            }
+        }
+
+        AZ_CONSOLEFREEFUNC(ProfileTraceDump, ConsoleFunctorFlags::Null,
+            "Writes the events recorded by the profile tracer to a Chrome trace file. "
+            "Parameter: optional file path, defaults to <user>/Traces/ProfileTrace_<time>.json");
+        AZ_CONSOLEFREEFUNC(ProfileTraceClear, ConsoleFunctorFlags::Null, "Discards the events recorded by the profile tracer so far.");
+
+        struct ProfileTracer::ThreadBuffer
+        {
+            //! Small direct mapped cache from name addresses to ids, so names only need to be looked up in the shared table once.
+            static constexpr size_t NameCacheSize = 256;
+
+            struct CachedName
+            {
+                const char* m_name = nullptr;
+                u32 m_id = 0;
+            };
+
+            ThreadBuffer* m_next = nullptr;
+            Event* m_events = nullptr;
+            u32 m_eventMask = 0;
+            u32 m_index = 0; //!< Used as the thread id in the trace.
+            AZStd::atomic<u64> m_writeIndex{ 0 }; //!< Only written by the owning thread.
+            AZStd::atomic_bool m_inUse{ true }; //!< Cleared when the owning thread exits so the buffer can be adopted.
+            CachedName m_nameCache[NameCacheSize];
+        };
+
+        struct ProfileTracer::NameTable
+        {
+            AZStd::unordered_map<uintptr_t, u32, AZStd::hash<uintptr_t>, AZStd::equal_to<uintptr_t>, OSStdAllocator> m_ids;
+            AZStd::vector<size_t, OSStdAllocator> m_offsets;
+            AZStd::vector<char, OSStdAllocator> m_text;
+        };
+
+        namespace ProfileTracerInternal
+        {
+            static const char* ProfileTracerInstanceName = "ProfileTracerInstance";
+
+            // Id of the tracer created by this module. Threads use it on exit to check if the tracer that owns their
+            // buffer is still alive before handing the buffer back.
+            struct LiveInstance
+            {
+                AZStd::mutex m_mutex;
+                u64 m_id = 0;
+                u64 m_nextId = 1;
+
+                static LiveInstance& Get()
+                {
+                    static LiveInstance s_liveInstance;
+                    return s_liveInstance;
+                }
+            };
+
+            struct ThreadBufferCache
+            {
+                u64 m_instanceId = 0;
+                ProfileTracer::ThreadBuffer* m_buffer = nullptr;
+
+                ~ThreadBufferCache()
+                {
+                    if (m_buffer)
+                    {
+                        LiveInstance& liveInstance = LiveInstance::Get();
+                        AZStd::lock_guard<AZStd::mutex> lock(liveInstance.m_mutex);
+                        if (liveInstance.m_id == m_instanceId)
+                        {
+                            m_buffer->m_inUse.store(false, AZStd::memory_order_release);
+                        }
+                    }
+                }
+            };
+
+            static EnvironmentVariable<ProfileTracer*>& GetInstanceVariable()
+            {
+                static EnvironmentVariable<ProfileTracer*> s_instance = Environment::CreateVariable<ProfileTracer*>(ProfileTracerInstanceName);
+                return s_instance;
+            }
+
+            //! Collects the json text and writes it to the stream in large blocks.
+            class ChromeTraceWriter
+            {
+            public:
+                static constexpr size_t FlushSize = 64 * 1024;
+
+                explicit ChromeTraceWriter(IO::GenericStream& stream)
+                    : m_stream(stream)
+                {
+                    m_buffer.reserve(FlushSize + 1024);
+                }
+
+                void Append(const char* text)
+                {
+                    m_buffer.append(text);
+                    FlushIfFull();
+                }
+
+                void AppendFormat(const char* format, ...)
+                {
+                    char text[256];
+                    va_list args;
+                    va_start(args, format);
+                    const int length = azvsnprintf(text, AZ_ARRAY_SIZE(text), format, args);
+                    va_end(args);
+                    if (length > 0)
+                    {
+                        m_buffer.append(text, AZStd::min(static_cast<size_t>(length), AZ_ARRAY_SIZE(text) - 1));
+                    }
+                    FlushIfFull();
+                }
+
+                void AppendEscaped(const char* text)
+                {
+                    for (; *text; ++text)
+                    {
+                        const char c = *text;
+                        if (c == '"' || c == '\\')
+                        {
+                            m_buffer.push_back('\\');
+                            m_buffer.push_back(c);
+                        }
+                        else if (static_cast<unsigned char>(c) < 0x20)
+                        {
+                            AppendFormat("\\u%04x", static_cast<unsigned int>(c));
+                        }
+                        else
+                        {
+                            m_buffer.push_back(c);
+                        }
+                    }
+                    FlushIfFull();
+                }
+
+                bool Flush()
+                {
+                    if (!m_buffer.empty())
+                    {
+                        m_succeeded = m_succeeded && m_stream.Write(m_buffer.size(), m_buffer.data()) == m_buffer.size();
+                        m_buffer.clear();
+                    }
+                    return m_succeeded;
+                }
+
+            private:
+                void FlushIfFull()
+                {
+                    if (m_buffer.size() >= FlushSize)
+                    {
+                        Flush();
+                    }
+                }
+
+                IO::GenericStream& m_stream;
+                AZStd::string m_buffer;
+                bool m_succeeded = true;
+            };
+        } // namespace ProfileTracerInternal
+
+        //=========================================================================
+        // Create
+        //=========================================================================
+        bool ProfileTracer::Create()
+        {
+            EnvironmentVariable<ProfileTracer*>& instance = ProfileTracerInternal::GetInstanceVariable();
+            AZ_Assert(*instance == nullptr, "ProfileTracer is already created!");
+            if (*instance != nullptr)
+            {
+                return false;
+            }
+
+            ProfileTracer* tracer = azcreate(ProfileTracer, (), OSAllocator, "ProfileTracer", 0);
+            tracer->SetEventsPerThread(bg_profileTraceEventsPerThread);
+            tracer->SetEnabled(bg_profileTraceEnable);
+            *instance = tracer;
+            return true;
+        }
+
+        //=========================================================================
+        // Destroy
+        //=========================================================================
+        void ProfileTracer::Destroy()
+        {
+            EnvironmentVariable<ProfileTracer*>& instance = ProfileTracerInternal::GetInstanceVariable();
+            AZ_Assert(*instance != nullptr, "ProfileTracer not created!");
+            if (ProfileTracer* tracer = *instance)
+            {
+                // Threads still recording events while the tracer is destroyed are not supported, the same as with the allocators.
+                *instance = nullptr;
+                azdestroy(tracer, OSAllocator);
+            }
+        }
+
+        //=========================================================================
+        // Get
+        //=========================================================================
+        ProfileTracer* ProfileTracer::Get()
+        {
+            // Modules that haven't been attached to the environment yet can't have access to a tracer. Checking this first avoids
+            // creating an environment for the module as a side effect of recording an event.
+            if (!Environment::IsReady())
+            {
+                return nullptr;
+            }
+            return *ProfileTracerInternal::GetInstanceVariable();
+        }
+
+        //=========================================================================
+        // RecordBeginScope
+        //=========================================================================
+        void ProfileTracer::RecordBeginScope(const char* category, const char* name)
+        {
+            if (ProfileTracer* tracer = Get(); tracer && tracer->IsEnabled())
+            {
+                tracer->BeginScope(category, name);
+            }
+        }
+
+        //=========================================================================
+        // RecordEndScope
+        //=========================================================================
+        void ProfileTracer::RecordEndScope()
+        {
+            if (ProfileTracer* tracer = Get(); tracer && tracer->IsEnabled())
+            {
+                tracer->EndScope();
+            }
+        }
+
+        //=========================================================================
+        // RecordCounter
+        //=========================================================================
+        void ProfileTracer::RecordCounter(const char* name, s64 value)
+        {
+            if (ProfileTracer* tracer = Get(); tracer && tracer->IsEnabled())
+            {
+                tracer->Counter(name, value);
+            }
+        }
+
+        //=========================================================================
+        // RecordFrameMarker
+        //=========================================================================
+        void ProfileTracer::RecordFrameMarker()
+        {
+            if (ProfileTracer* tracer = Get(); tracer && tracer->IsEnabled())
+            {
+                tracer->FrameMarker();
+            }
+        }
+
+        //=========================================================================
+        // ProfileTracer
+        //=========================================================================
+        ProfileTracer::ProfileTracer()
+            : m_startTime(AZStd::GetTimeNowTicks())
+        {
+            m_names = azcreate(NameTable, (), OSAllocator, "ProfileTracer::NameTable", 0);
+            // Id 0 is reserved for missing names.
+            m_names->m_offsets.push_back(0);
+            m_names->m_text.push_back('\0');
+
+            ProfileTracerInternal::LiveInstance& liveInstance = ProfileTracerInternal::LiveInstance::Get();
+            AZStd::lock_guard<AZStd::mutex> lock(liveInstance.m_mutex);
+            m_instanceId = liveInstance.m_nextId++;
+            liveInstance.m_id = m_instanceId;
+        }
+
+        //=========================================================================
+        // ~ProfileTracer
+        //=========================================================================
+        ProfileTracer::~ProfileTracer()
+        {
+            {
+                ProfileTracerInternal::LiveInstance& liveInstance = ProfileTracerInternal::LiveInstance::Get();
+                AZStd::lock_guard<AZStd::mutex> lock(liveInstance.m_mutex);
+                if (liveInstance.m_id == m_instanceId)
+                {
+                    liveInstance.m_id = 0;
+                }
+            }
+
+            while (m_buffers)
+            {
+                ThreadBuffer* buffer = m_buffers;
+                m_buffers = buffer->m_next;
+                azfree(buffer->m_events, OSAllocator);
+                azdestroy(buffer, OSAllocator);
+            }
+            azdestroy(m_names, OSAllocator);
+        }
+
+        //=========================================================================
+        // SetEnabled
+        //=========================================================================
+        void ProfileTracer::SetEnabled(bool enabled)
+        {
+            m_enabled.store(enabled, AZStd::memory_order_relaxed);
+        }
+
+        //=========================================================================
+        // SetEventsPerThread
+        //=========================================================================
+        void ProfileTracer::SetEventsPerThread(u32 eventsPerThread)
+        {
+            u32 powerOfTwo = 1;
+            while (powerOfTwo < eventsPerThread && powerOfTwo < (1u << 31))
+            {
+                powerOfTwo <<= 1;
+            }
+            m_eventsPerThread.store(powerOfTwo, AZStd::memory_order_relaxed);
+        }
+
+        //=========================================================================
+        // BeginScope
+        //=========================================================================
+        void ProfileTracer::BeginScope(const char* category, const char* name)
+        {
+            if (ThreadBuffer* buffer = GetThreadBuffer())
+            {
+                const u32 categoryId = InternName(*buffer, category);
+                Record(*buffer, EventType::BeginScope, InternName(*buffer, name), categoryId);
+            }
+        }
+
+        //=========================================================================
+        // EndScope
+        //=========================================================================
+        void ProfileTracer::EndScope()
+        {
+            if (ThreadBuffer* buffer = GetThreadBuffer())
+            {
+                Record(*buffer, EventType::EndScope, 0, 0);
+            }
+        }
+
+        //=========================================================================
+        // Counter
+        //=========================================================================
+        void ProfileTracer::Counter(const char* name, s64 value)
+        {
+            if (ThreadBuffer* buffer = GetThreadBuffer())
+            {
+                Record(*buffer, EventType::Counter, InternName(*buffer, name), value);
+            }
+        }
+
+        //=========================================================================
+        // FrameMarker
+        //=========================================================================
+        void ProfileTracer::FrameMarker()
+        {
+            if (ThreadBuffer* buffer = GetThreadBuffer())
+            {
+                Record(*buffer, EventType::FrameMarker, 0, m_frameNumber.fetch_add(1, AZStd::memory_order_relaxed));
+            }
+        }
+
+        //=========================================================================
+        // Record
+        //=========================================================================
+        void ProfileTracer::Record(ThreadBuffer& buffer, EventType type, u32 nameId, s64 value)
+        {
+            const u64 writeIndex = buffer.m_writeIndex.load(AZStd::memory_order_relaxed);
+            Event& event = buffer.m_events[writeIndex & buffer.m_eventMask];
+            event.m_timestamp = AZStd::GetTimeNowTicks();
+            event.m_value = value;
+            event.m_nameId = nameId;
+            event.m_type = type;
+            buffer.m_writeIndex.store(writeIndex + 1, AZStd::memory_order_release);
+        }
+
+        //=========================================================================
+        // Clear
+        //=========================================================================
+        void ProfileTracer::Clear()
+        {
+            // The buffers are owned by their threads, so instead of resetting them the older events are skipped when writing.
+            m_clearTime.store(AZStd::GetTimeNowTicks(), AZStd::memory_order_relaxed);
+        }
+
+        //=========================================================================
+        // InternName
+        //=========================================================================
+        u32 ProfileTracer::InternName(const char* name)
+        {
+            if (!name)
+            {
+                return 0;
+            }
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_namesMutex);
+            auto [it, inserted] = m_names->m_ids.emplace(reinterpret_cast<uintptr_t>(name), aznumeric_cast<u32>(m_names->m_offsets.size()));
+            if (inserted)
+            {
+                m_names->m_offsets.push_back(m_names->m_text.size());
+                m_names->m_text.insert(m_names->m_text.end(), name, name + strlen(name) + 1);
+            }
+            return it->second;
+        }
+
+        u32 ProfileTracer::InternName(ThreadBuffer& buffer, const char* name)
+        {
+            ThreadBuffer::CachedName& cached = buffer.m_nameCache[(reinterpret_cast<uintptr_t>(name) >> 3) & (ThreadBuffer::NameCacheSize - 1)];
+            if (cached.m_name != name)
+            {
+                cached.m_id = InternName(name);
+                cached.m_name = name;
+            }
+            return cached.m_id;
+        }
+
+        //=========================================================================
+        // GetThreadCount
+        //=========================================================================
+        size_t ProfileTracer::GetThreadCount()
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_buffersMutex);
+            return m_bufferCount;
+        }
+
+        //=========================================================================
+        // GetThreadBuffer
+        //=========================================================================
+        ProfileTracer::ThreadBuffer* ProfileTracer::GetThreadBuffer()
+        {
+            static thread_local ProfileTracerInternal::ThreadBufferCache s_threadCache;
+            if (s_threadCache.m_instanceId != m_instanceId)
+            {
+                s_threadCache.m_buffer = AcquireThreadBuffer();
+                s_threadCache.m_instanceId = m_instanceId;
+            }
+            return s_threadCache.m_buffer;
+        }
+
+        //=========================================================================
+        // AcquireThreadBuffer
+        //=========================================================================
+        ProfileTracer::ThreadBuffer* ProfileTracer::AcquireThreadBuffer()
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_buffersMutex);
+
+            // Adopt the buffer of a thread that has exited. Its events are kept so they can still be written to a trace.
+            for (ThreadBuffer* buffer = m_buffers; buffer; buffer = buffer->m_next)
+            {
+                bool inUse = false;
+                if (buffer->m_inUse.compare_exchange_strong(inUse, true, AZStd::memory_order_acq_rel))
+                {
+                    return buffer;
+                }
+            }
+
+            const u32 eventCount = m_eventsPerThread.load(AZStd::memory_order_relaxed);
+            void* events = azmalloc(sizeof(Event) * eventCount, alignof(Event), OSAllocator, "ProfileTracer::Event");
+            if (!events)
+            {
+                return nullptr;
+            }
+
+            ThreadBuffer* buffer = azcreate(ThreadBuffer, (), OSAllocator, "ProfileTracer::ThreadBuffer", 0);
+            buffer->m_events = static_cast<Event*>(events);
+            buffer->m_eventMask = eventCount - 1;
+            buffer->m_index = m_bufferCount++;
+            buffer->m_next = m_buffers;
+            m_buffers = buffer;
+            return buffer;
+        }
+
+        //=========================================================================
+        // WriteChromeTrace
+        //=========================================================================
+        bool ProfileTracer::WriteChromeTrace(IO::GenericStream& stream)
+        {
+            // Take a copy of the names so threads that record new names aren't blocked while the trace is written.
+            AZStd::vector<size_t, OSStdAllocator> nameOffsets;
+            AZStd::vector<char, OSStdAllocator> nameText;
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_namesMutex);
+                nameOffsets = m_names->m_offsets;
+                nameText = m_names->m_text;
+            }
+            auto getName = [&nameOffsets, &nameText](s64 id) -> const char*
+            {
+                return id >= 0 && static_cast<size_t>(id) < nameOffsets.size() ? nameText.data() + nameOffsets[id] : "";
+            };
+
+            // Buffers are never removed while the tracer is alive, so the list can be walked after taking its head.
+            ThreadBuffer* buffers;
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_buffersMutex);
+                buffers = m_buffers;
+            }
+
+            const AZStd::sys_time_t clearTime = m_clearTime.load(AZStd::memory_order_relaxed);
+            const double ticksToMicroseconds = 1000000.0 / static_cast<double>(AZStd::GetTimeTicksPerSecond());
+            const unsigned int processId = AZ::Platform::GetCurrentProcessId();
+
+            ProfileTracerInternal::ChromeTraceWriter writer(stream);
+            writer.Append("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[");
+            bool firstEvent = true;
+            auto beginEvent = [&writer, &firstEvent]()
+            {
+                writer.Append(firstEvent ? "\n{" : ",\n{");
+                firstEvent = false;
+            };
+
+            AZStd::vector<Event, OSStdAllocator> events;
+            for (ThreadBuffer* buffer = buffers; buffer; buffer = buffer->m_next)
+            {
+                const u64 capacity = static_cast<u64>(buffer->m_eventMask) + 1;
+                const u64 end = buffer->m_writeIndex.load(AZStd::memory_order_acquire);
+                const u64 begin = end > capacity ? end - capacity : 0;
+                events.resize_no_construct(end - begin);
+                for (u64 i = begin; i < end; ++i)
+                {
+                    events[i - begin] = buffer->m_events[i & buffer->m_eventMask];
+                }
+
+                // The owning thread keeps recording while the events are copied, so drop the ones that may have been overwritten.
+                // The fence keeps the copies above from being reordered after the index is read again, and the slot at endAfterCopy
+                // may be mid write, so it is excluded along with everything older than it.
+                AZStd::atomic_thread_fence(AZStd::memory_order_acquire);
+                const u64 endAfterCopy = buffer->m_writeIndex.load(AZStd::memory_order_relaxed);
+                const u64 firstValid = endAfterCopy + 1 > capacity ? endAfterCopy + 1 - capacity : 0;
+                const size_t skipCount = firstValid > begin ? AZStd::min(static_cast<size_t>(firstValid - begin), events.size()) : 0;
+
+                beginEvent();
+                writer.AppendFormat("\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%u,\"tid\":%u,\"args\":{\"name\":\"Thread %u\"}}",
+                    processId, buffer->m_index, buffer->m_index);
+
+                // Scopes that started before the oldest event in the buffer have lost their begin event, so their end is dropped too.
+                size_t openScopes = 0;
+                for (size_t i = skipCount; i < events.size(); ++i)
+                {
+                    const Event& event = events[i];
+                    if (event.m_timestamp < clearTime)
+                    {
+                        continue;
+                    }
+
+                    const double timestamp = static_cast<double>(event.m_timestamp - m_startTime) * ticksToMicroseconds;
+                    switch (event.m_type)
+                    {
+                    case EventType::BeginScope:
+                        ++openScopes;
+                        beginEvent();
+                        writer.Append("\"name\":\"");
+                        writer.AppendEscaped(getName(event.m_nameId));
+                        writer.Append("\",\"cat\":\"");
+                        writer.AppendEscaped(getName(event.m_value));
+                        writer.AppendFormat("\",\"ph\":\"B\",\"ts\":%.3f,\"pid\":%u,\"tid\":%u}", timestamp, processId, buffer->m_index);
+                        break;
+                    case EventType::EndScope:
+                        if (openScopes > 0)
+                        {
+                            --openScopes;
+                            beginEvent();
+                            writer.AppendFormat("\"ph\":\"E\",\"ts\":%.3f,\"pid\":%u,\"tid\":%u}", timestamp, processId, buffer->m_index);
+                        }
+                        break;
+                    case EventType::Counter:
+                        beginEvent();
+                        writer.Append("\"name\":\"");
+                        writer.AppendEscaped(getName(event.m_nameId));
+                        writer.AppendFormat("\",\"ph\":\"C\",\"ts\":%.3f,\"pid\":%u,\"tid\":%u,\"args\":{\"value\":%lld}}",
+                            timestamp, processId, buffer->m_index, static_cast<long long>(event.m_value));
+                        break;
+                    case EventType::FrameMarker:
+                        beginEvent();
+                        writer.AppendFormat("\"name\":\"Frame\",\"ph\":\"i\",\"s\":\"g\",\"ts\":%.3f,\"pid\":%u,\"tid\":%u,\"args\":{\"frame\":%lld}}",
+                            timestamp, processId, buffer->m_index, static_cast<long long>(event.m_value));
+                        break;
+                    }
+                }
+            }
+
+            writer.Append("\n]}\n");
+            return writer.Flush();
+        }
+
+        bool ProfileTracer::WriteChromeTrace(const char* filePath)
+        {
+            IO::SystemFile file;
+            if (!file.Open(filePath, IO::SystemFile::SF_OPEN_WRITE_ONLY | IO::SystemFile::SF_OPEN_CREATE | IO::SystemFile::SF_OPEN_CREATE_PATH))
+            {
+                AZ_Error("ProfileTracer", false, "Unable to open '%s' to write the profile trace to.", filePath);
+                return false;
+            }
+
+            IO::SystemFileStream stream(&file, false);
+            const bool result = WriteChromeTrace(stream);
+            AZ_Error("ProfileTracer", result, "Failed to write the profile trace to '%s'.", filePath);
+            return result;
+        }
+    } // namespace Debug
+} // namespace AZ
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/time.h>
+
+namespace AZ
+{
+    namespace IO
+    {
+        class GenericStream;
+    }
+
+    namespace Debug
+    {
+        //! Headless event tracer that records profile scopes, frame markers and counters into fixed size per-thread ring buffers.
+        //! Recording an event only reads the clock and writes into memory owned by the recording thread, so the tracer can be left
+        //! running on dedicated servers. When a hitch needs to be investigated, the most recent events of every thread can be written
+        //! out in the Chrome trace event format, which can be opened with chrome://tracing or the Perfetto UI.
+        //!
+        //! The tracer is shared between all modules through the environment. AZ_PROFILE_SCOPE/AZ_PROFILE_BEGIN/AZ_PROFILE_END
+        //! forward to it when it has been created and is enabled.
+        //! Scope and counter names are interned by their address, so they have to be string literals, which is already the case for
+        //! the format strings used by AZ_PROFILE_SCOPE. Format arguments are not recorded.
+        class ProfileTracer
+        {
+        public:
+            static constexpr u32 DefaultEventsPerThread = 16 * 1024;
+
+            enum class EventType : u32
+            {
+                BeginScope,
+                EndScope,
+                Counter,
+                FrameMarker
+            };
+
+            struct Event
+            {
+                AZStd::sys_time_t m_timestamp; //!< Time in ticks as returned by AZStd::GetTimeNowTicks().
+                s64 m_value; //!< Interned category for scopes, the value for counters and the frame number for frame markers.
+                u32 m_nameId;
+                EventType m_type;
+            };
+
+            struct ThreadBuffer;
+
+            virtual ~ProfileTracer();
+
+            //! Creates the shared tracer. Its enabled state and buffer size are initialized from the bg_profileTrace cvars.
+            static bool Create();
+            static void Destroy();
+            //! Returns the shared tracer or null if it hasn't been created.
+            static ProfileTracer* Get();
+
+            //! Entry points for the profiler macros. These are cheap no-ops if no tracer has been created or if it's disabled.
+            static void RecordBeginScope(const char* category, const char* name);
+            static void RecordEndScope();
+            static void RecordCounter(const char* name, s64 value);
+            static void RecordFrameMarker();
+
+            void SetEnabled(bool enabled);
+            bool IsEnabled() const { return m_enabled.load(AZStd::memory_order_relaxed); }
+            //! Sets the number of events kept for each thread, rounded up to a power of two. Only applies to threads that
+            //! haven't recorded any events yet.
+            void SetEventsPerThread(u32 eventsPerThread);
+            u32 GetEventsPerThread() const { return m_eventsPerThread.load(AZStd::memory_order_relaxed); }
+
+            void BeginScope(const char* category, const char* name);
+            void EndScope();
+            void Counter(const char* name, s64 value);
+            void FrameMarker();
+
+            //! Discards all events recorded so far.
+            void Clear();
+
+            //! Writes the recorded events to the stream in the Chrome trace event format.
+            bool WriteChromeTrace(IO::GenericStream& stream);
+            //! Writes the recorded events to a file in the Chrome trace event format.
+            bool WriteChromeTrace(const char* filePath);
+
+            //! Returns the id for a name. Names with the same address share an id.
+            u32 InternName(const char* name);
+            //! Returns the number of threads that have recorded at least one event.
+            size_t GetThreadCount();
+
+        protected:
+            ProfileTracer();
+
+            //! Returns the buffer for the calling thread. This is virtual so the thread local storage of the module that created the
+            //! tracer is used, instead of a copy in every module that links AzCore.
+            virtual ThreadBuffer* GetThreadBuffer();
+
+        private:
+            ProfileTracer(const ProfileTracer&) = delete;
+            ProfileTracer& operator=(const ProfileTracer&) = delete;
+
+            struct NameTable;
+
+            void Record(ThreadBuffer& buffer, EventType type, u32 nameId, s64 value);
+            u32 InternName(ThreadBuffer& buffer, const char* name);
+            ThreadBuffer* AcquireThreadBuffer();
+
+            AZStd::atomic_bool m_enabled{ false };
+            AZStd::atomic<u64> m_frameNumber{ 0 };
+            AZStd::atomic<AZStd::sys_time_t> m_clearTime{ 0 }; //!< Events before this time are ignored when writing the trace.
+            AZStd::sys_time_t m_startTime;
+            AZStd::atomic<u32> m_eventsPerThread{ DefaultEventsPerThread };
+            u64 m_instanceId;
+
+            AZStd::mutex m_buffersMutex;
+            ThreadBuffer* m_buffers = nullptr; //!< Protected by m_buffersMutex.
+            u32 m_bufferCount = 0; //!< Protected by m_buffersMutex.
+
+            AZStd::mutex m_namesMutex;
+            NameTable* m_names; //!< Protected by m_namesMutex.
+        };
+    } // namespace Debug
+} // namespace AZ
@@ -7,6 +7,7 @@
  */
 #pragma once
 
+#include <AzCore/Debug/ProfileTracer.h>
 #include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/function/function_fwd.h>
 
@@ -20,6 +21,7 @@
 #   define AZ_PROFILE_FUNCTION(...)
 #   define AZ_PROFILE_BEGIN(...)
 #   define AZ_PROFILE_END(...)
+#   define AZ_PROFILE_COUNTER(...)
 #else
 /**
  * Macro to declare a profile section for the current scope { }.
@@ -31,6 +33,11 @@
 // Prefer using the scoped macros which automatically end the event (AZ_PROFILE_SCOPE/AZ_PROFILE_FUNCTION)
 #   define AZ_PROFILE_BEGIN(category, ...) ::AZ::ProfileScope::BeginRegion(#category, __VA_ARGS__)
 #   define AZ_PROFILE_END() ::AZ::ProfileScope::EndRegion()
+
+/**
+ * Records the value of a counter in the profile tracer. The name has to be a string literal.
+ */
+#   define AZ_PROFILE_COUNTER(name, value) ::AZ::Debug::ProfileTracer::RecordCounter(name, static_cast<AZ::s64>(value))
 #endif // AZ_PROFILER_MACRO_DISABLE
 
 #ifndef AZ_PROFILE_INTERVAL_START
@@ -64,6 +71,7 @@ namespace AZ
 #if defined(USE_PIX)
             PIXBeginEvent(PIX_COLOR_INDEX(GetSystemID(system) & 0xff), eventName, args...);
 #endif
+            Debug::ProfileTracer::RecordBeginScope(system, eventName);
             // TODO: injecting instrumentation for other profilers
             // NOTE: external profiler registration won't occur inline in a header necessarily in this manner, but the exact mechanism
             //       will be introduced in a future PR
@@ -74,6 +82,7 @@ namespace AZ
 #if defined(USE_PIX)
             PIXEndEvent();
 #endif
+            Debug::ProfileTracer::RecordEndScope();
         }
 
         template<typename... T>
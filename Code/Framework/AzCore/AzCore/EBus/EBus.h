@@ -142,6 +142,8 @@ namespace AZ
          * - For simple multithreaded cases, use AZStd::mutex.
          * - For multithreaded cases where an event handler sends a new event on the same bus
          *   or connects/disconnects while handling an event on the same bus, use AZStd::recursive_mutex.
+         * - For buses that are dispatched to from many threads but rarely connected to or disconnected from,
+         *   use AZ::EBusReadMostlyMutex. Dispatches don't block each other.
          */
         using MutexType = NullMutex;
 
@@ -415,6 +417,8 @@ namespace AZ
          * - For simple multithreaded cases, use AZStd::mutex.
          * - For multithreaded cases where an event handler sends a new event on the same bus
          *   or connects/disconnects while handling an event on the same bus, use AZStd::recursive_mutex.
+         * - For buses that are dispatched to from many threads but rarely connected to or disconnected from,
+         *   use AZ::EBusReadMostlyMutex. Dispatches don't block each other.
          */
         using MutexType = typename ImplTraits::MutexType;
 
@@ -624,10 +628,12 @@ namespace AZ
 
             /**
              * The scoped lock guard to use (either AZStd::scoped_lock<MutexType> or NullLockGuard<MutexType>
-             * during broadcast/event dispatch.
+             * during broadcast/event dispatch. Mutexes made for read-mostly buses, like AZ::EBusReadMostlyMutex,
+             * are locked in shared mode with AZStd::shared_lock<MutexType> instead.
              * @see EBusTraits::LocklessDispatch
              */
-            using DispatchLockGuard = AZStd::conditional_t<BusTraits::LocklessDispatch, AZ::Internal::NullLockGuard<ContextMutexType>, AZStd::scoped_lock<ContextMutexType>>;
+            using DispatchLockGuard = AZStd::conditional_t<BusTraits::LocklessDispatch, AZ::Internal::NullLockGuard<ContextMutexType>,
+                AZStd::conditional_t<AZ::Internal::IsSharedDispatchMutex<ContextMutexType>::value, AZStd::shared_lock<ContextMutexType>, AZStd::scoped_lock<ContextMutexType>>>;
 
             /**
             * The scoped lock guard to use during connection.  Some specialized policies execute handler methods which
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <AzCore/std/functional.h>
+#include <AzCore/std/parallel/scoped_lock.h>
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/smart_ptr/intrusive_ptr.h>
 
@@ -67,6 +68,32 @@ namespace AZ
             {
                 return MidDispatchDisconnectFixer<Bus, PreHandler, PostHandler>(context, busId, AZStd::forward<PreHandler>(remove), AZStd::forward<PostHandler>(post));
             }
+
+            // Removes an address from the container once the last reference to its handler holder is released.
+            // Buses that dispatch under a shared lock can drop the last reference from within a dispatch, while
+            // other threads are reading the container, so the removal has to take the context mutex exclusively.
+            template <typename Bus, typename ContainerType>
+            void EraseReleasedAddress(ContainerType& container, const typename Bus::BusIdType& id)
+            {
+                using ContextMutexType = typename Bus::Context::ContextMutexType;
+                if constexpr (IsSharedDispatchMutex<ContextMutexType>::value)
+                {
+                    typename Bus::Context* context = Bus::GetContext(false);
+                    if (context && !context->m_contextMutex.IsLockedExclusivelyByThisThread())
+                    {
+                        // The address can be reused or erased while we wait for the lock, so look it up again.
+                        const typename Bus::BusIdType busId = id;
+                        AZStd::scoped_lock<ContextMutexType> lock(context->m_contextMutex);
+                        auto addressIt = container.m_addresses.find(busId);
+                        if (addressIt != container.m_addresses.end() && addressIt->m_refCount.load() == 0)
+                        {
+                            container.m_addresses.erase(busId);
+                        }
+                        return;
+                    }
+                }
+                container.m_addresses.erase(id);
+            }
         }
 
 // Executes router handling in a generic way
@@ -721,7 +748,7 @@ namespace AZ
                     // Must check against 1 because fetch_sub returns the value before decrementing
                     if (m_refCount.fetch_sub(1) == 1)
                     {
-                        m_busContainer.m_addresses.erase(m_busId);
+                        EraseReleasedAddress<EBus<Interface, Traits>>(m_busContainer, m_busId);
                     }
                 }
             };
@@ -1261,7 +1288,7 @@ namespace AZ
                     // Must check against 1 because fetch_sub returns the value before decrementing
                     if (m_refCount.fetch_sub(1) == 1)
                     {
-                        m_busContainer.m_addresses.erase(m_busId);
+                        EraseReleasedAddress<EBus<Interface, Traits>>(m_busContainer, m_busId);
                     }
                 }
             };
@@ -19,6 +19,11 @@
 #include <AzCore/std/containers/queue.h>
 #include <AzCore/std/containers/intrusive_set.h>
 
+// Includes for the read-mostly mutex.
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/thread.h>
+
 #include <AzCore/Module/Environment.h>
 #include <AzCore/EBus/Environment.h>
 
@@ -447,5 +452,229 @@ namespace AZ
         }
     };
 
+    /**
+     * Locking primitive for read-mostly buses, use it as the AZ::EBusTraits::MutexType of buses that are
+     * dispatched to a lot, from several threads, but rarely connected to or disconnected from.
+     *
+     * Dispatch takes the mutex in shared mode. Each thread that dispatches gets a reader slot on its own cache line,
+     * so readers never write to memory shared with other readers and a dispatch is wait-free as long as no handler
+     * is connecting or disconnecting. Connect and disconnect take the mutex exclusively: they block new dispatches
+     * and wait for the ones in progress on other threads to finish before touching the bus, which keeps them as safe
+     * as with a regular mutex.
+     *
+     * Like with AZStd::recursive_mutex, handlers can dispatch on the bus again and connect or disconnect from within
+     * a dispatch on the same thread. Connecting or disconnecting from handlers that are dispatched concurrently on
+     * several threads will deadlock, since each thread waits for the dispatch on the other one to finish.
+     */
+    class EBusReadMostlyMutex
+    {
+    public:
+        /// Number of threads that can dispatch without taking a lock. Threads beyond that serialize on the writer mutex.
+        static constexpr size_t NumReaderSlots = 64;
+
+        EBusReadMostlyMutex() = default;
+        EBusReadMostlyMutex(const EBusReadMostlyMutex&) = delete;
+        EBusReadMostlyMutex& operator=(const EBusReadMostlyMutex&) = delete;
+
+        void lock()
+        {
+            m_writerMutex.lock();
+            if (m_writerDepth++ == 0)
+            {
+                const AZStd::native_thread_id_type threadId = AZStd::this_thread::get_id().m_id;
+                m_writerThread.store(threadId, AZStd::memory_order_relaxed);
+                m_writerActive.store(true, AZStd::memory_order_seq_cst);
+
+                // Wait for the dispatches in progress on other threads. Our own ones are suspended in the callstack.
+                for (ReaderSlot& slot : m_readerSlots)
+                {
+                    if (slot.m_owner.load(AZStd::memory_order_relaxed) == threadId)
+                    {
+                        continue;
+                    }
+                    while (slot.m_readers.load(AZStd::memory_order_seq_cst) != 0)
+                    {
+                        AZStd::this_thread::yield();
+                    }
+                }
+            }
+        }
+
+        bool try_lock()
+        {
+            if (!m_writerMutex.try_lock())
+            {
+                return false;
+            }
+            if (m_writerDepth == 0)
+            {
+                const AZStd::native_thread_id_type threadId = AZStd::this_thread::get_id().m_id;
+                m_writerActive.store(true, AZStd::memory_order_seq_cst);
+                for (ReaderSlot& slot : m_readerSlots)
+                {
+                    if (slot.m_owner.load(AZStd::memory_order_relaxed) != threadId && slot.m_readers.load(AZStd::memory_order_seq_cst) != 0)
+                    {
+                        m_writerActive.store(false, AZStd::memory_order_release);
+                        m_writerMutex.unlock();
+                        return false;
+                    }
+                }
+                m_writerThread.store(threadId, AZStd::memory_order_relaxed);
+            }
+            ++m_writerDepth;
+            return true;
+        }
+
+        void unlock()
+        {
+            if (--m_writerDepth == 0)
+            {
+                m_writerThread.store(AZStd::native_thread_invalid_id, AZStd::memory_order_relaxed);
+                m_writerActive.store(false, AZStd::memory_order_release);
+            }
+            m_writerMutex.unlock();
+        }
+
+        void lock_shared()
+        {
+            ReaderSlot* slot = FindReaderSlot(true);
+            if (!slot)
+            {
+                m_writerMutex.lock();
+                return;
+            }
+
+            // Nested dispatch, a writer waits for the outer one anyway so there is no need to check for it.
+            if (slot->m_readers.load(AZStd::memory_order_relaxed) != 0)
+            {
+                slot->m_readers.fetch_add(1, AZStd::memory_order_relaxed);
+                return;
+            }
+
+            for (;;)
+            {
+                slot->m_readers.fetch_add(1, AZStd::memory_order_seq_cst);
+                if (!m_writerActive.load(AZStd::memory_order_seq_cst) ||
+                    m_writerThread.load(AZStd::memory_order_relaxed) == slot->m_owner.load(AZStd::memory_order_relaxed))
+                {
+                    return;
+                }
+
+                // A connect or disconnect is in progress, back off and block until it's done.
+                slot->m_readers.fetch_sub(1, AZStd::memory_order_release);
+                m_writerMutex.lock();
+                m_writerMutex.unlock();
+            }
+        }
+
+        void unlock_shared()
+        {
+            ReaderSlot* slot = FindReaderSlot(false);
+            if (!slot)
+            {
+                m_writerMutex.unlock();
+                return;
+            }
+            slot->m_readers.fetch_sub(1, AZStd::memory_order_release);
+        }
+
+        /// Returns true if the calling thread holds the mutex exclusively.
+        bool IsLockedExclusivelyByThisThread() const
+        {
+            return m_writerActive.load(AZStd::memory_order_acquire) &&
+                m_writerThread.load(AZStd::memory_order_relaxed) == AZStd::this_thread::get_id().m_id;
+        }
+
+        /// Gives the calling thread's reader slot back so another thread can claim it. Slots otherwise stay with a
+        /// thread id for the lifetime of the mutex, so threads that stop dispatching on a long lived bus should call
+        /// this before they exit. Must not be called from within a dispatch.
+        void ReleaseReaderSlot()
+        {
+            if (ReaderSlot* slot = FindReaderSlot(false))
+            {
+                AZ_Assert(slot->m_readers.load(AZStd::memory_order_relaxed) == 0, "Reader slot released from within a dispatch");
+                slot->m_owner.store(AZStd::native_thread_invalid_id, AZStd::memory_order_release);
+            }
+        }
+
+        /// Returns the number of reader slots currently claimed by threads.
+        size_t GetClaimedReaderSlotCount() const
+        {
+            size_t count = 0;
+            for (const ReaderSlot& slot : m_readerSlots)
+            {
+                count += (slot.m_owner.load(AZStd::memory_order_acquire) != AZStd::native_thread_invalid_id) ? 1 : 0;
+            }
+            return count;
+        }
+
+    private:
+        struct alignas(64) ReaderSlot
+        {
+            AZStd::atomic<AZStd::native_thread_id_type> m_owner{ AZStd::native_thread_invalid_id };
+            AZStd::atomic<AZ::u32> m_readers{ 0 };
+        };
+
+        // Slots are claimed the first time a thread dispatches and stay with that thread id until it releases them.
+        // A released slot leaves a hole in the probe sequence of other threads, so an unclaimed slot doesn't prove the
+        // calling thread has no slot further along: the rest of the sequence is searched before claiming the first hole.
+        ReaderSlot* FindReaderSlot(bool claim)
+        {
+            const AZStd::native_thread_id_type threadId = AZStd::this_thread::get_id().m_id;
+            size_t index = AZStd::hash<AZStd::native_thread_id_type>()(threadId);
+            index ^= index >> 17;
+            index ^= index >> 7;
+            size_t firstUnclaimed = NumReaderSlots;
+            for (size_t probe = 0; probe < NumReaderSlots; ++probe)
+            {
+                ReaderSlot& slot = m_readerSlots[(index + probe) % NumReaderSlots];
+                const AZStd::native_thread_id_type owner = slot.m_owner.load(AZStd::memory_order_acquire);
+                if (owner == threadId)
+                {
+                    return &slot;
+                }
+                if (owner == AZStd::native_thread_invalid_id && firstUnclaimed == NumReaderSlots)
+                {
+                    firstUnclaimed = probe;
+                }
+            }
+
+            if (claim)
+            {
+                for (size_t probe = firstUnclaimed; probe < NumReaderSlots; ++probe)
+                {
+                    ReaderSlot& slot = m_readerSlots[(index + probe) % NumReaderSlots];
+                    AZStd::native_thread_id_type owner = AZStd::native_thread_invalid_id;
+                    if (slot.m_owner.compare_exchange_strong(owner, threadId, AZStd::memory_order_acq_rel))
+                    {
+                        return &slot;
+                    }
+                }
+            }
+            return nullptr;
+        }
+
+        ReaderSlot m_readerSlots[NumReaderSlots];
+        AZStd::recursive_mutex m_writerMutex;   ///< Held by writers for the whole connect/disconnect, and by readers without a slot.
+        AZStd::atomic<bool> m_writerActive{ false };
+        AZStd::atomic<AZStd::native_thread_id_type> m_writerThread{ AZStd::native_thread_invalid_id };
+        AZ::u32 m_writerDepth = 0;              ///< Recursion count of the writer, only accessed while holding m_writerMutex.
+    };
+
+    namespace Internal
+    {
+        /// True for mutex types the bus should lock in shared mode during dispatch.
+        template <class MutexType>
+        struct IsSharedDispatchMutex
+            : AZStd::false_type
+        {
+        };
+
+        template <>
+        struct IsSharedDispatchMutex<EBusReadMostlyMutex>
+            : AZStd::true_type
+        {
+        };
+    } // namespace Internal
 
 } // namespace AZ
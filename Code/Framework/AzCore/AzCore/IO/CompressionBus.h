@@ -9,8 +9,10 @@
 
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/IO/Streamer/RequestPath.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/functional.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/string/string_view.h>
 
@@ -31,6 +33,18 @@ namespace AZ
             UseArchiveOnly
         };
 
+        //! Start of an independently compressed chunk in a file that's compressed as a series of chunks.
+        struct CompressionSeekPoint
+        {
+            //! Offset of the chunk in the compressed data.
+            u64 m_compressedOffset{ 0 };
+            //! Offset of the chunk in the uncompressed data.
+            u64 m_uncompressedOffset{ 0 };
+        };
+        //! Seek table of a file that's compressed as a series of independently compressed chunks. There's a seek point for every
+        //! chunk in order, followed by a final seek point with the compressed and uncompressed size of the file.
+        using CompressionSeekTable = AZStd::vector<CompressionSeekPoint>;
+
         struct CompressionInfo;
         using DecompressionFunc = AZStd::function<bool(const CompressionInfo& info, const void* compressed, size_t compressedSize, void* uncompressed, size_t uncompressedBufferSize)>;
 
@@ -45,8 +59,11 @@ namespace AZ
 
             //! Relative path to the archive file.
             RequestPath m_archiveFilename;
-            //< The function to use to decompress the data.
+            //< The function to use to decompress the data. If the file has a seek table, this is called for individual chunks.
             DecompressionFunc m_decompressor;
+            //! Optional seek table if the file is compressed as a series of independently compressed chunks. Chunks can be
+            //! decompressed in parallel and reads of part of the file only need to decompress the chunks they overlap with.
+            AZStd::shared_ptr<const CompressionSeekTable> m_seekTable;
             //< Tag that uniquely identifies the compressor responsible for decompressing the referenced data.
             CompressionTag m_compressionTag{ 0 };
             //! Offset into the archive file for the found file.
@@ -0,0 +1,372 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/CompressionBus.h>
+#include <AzCore/IO/Streamer/ChunkedDecompressor.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/typetraits/decay.h>
+
+namespace AZ
+{
+    namespace IO
+    {
+        AZStd::shared_ptr<StreamStackEntry> ChunkedDecompressorConfig::AddStreamStackEntry(
+            const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent)
+        {
+            auto stackEntry = AZStd::make_shared<ChunkedDecompressor>(
+                m_maxNumReads, m_maxNumJobs, aznumeric_caster(hardware.m_maxPhysicalSectorSize));
+            stackEntry->SetNext(AZStd::move(parent));
+            return stackEntry;
+        }
+
+        void ChunkedDecompressorConfig::Reflect(AZ::ReflectContext* context)
+        {
+            if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context); serializeContext != nullptr)
+            {
+                serializeContext->Class<ChunkedDecompressorConfig, IStreamerStackConfig>()
+                    ->Version(1)
+                    ->Field("MaxNumReads", &ChunkedDecompressorConfig::m_maxNumReads)
+                    ->Field("MaxNumJobs", &ChunkedDecompressorConfig::m_maxNumJobs);
+            }
+        }
+
+        ChunkedDecompressor::ChunkedDecompressor(u32 maxNumReads, u32 maxNumJobs, u32 alignment)
+            : StreamStackEntry("Chunked decompressor")
+            , m_maxNumReads(maxNumReads)
+            , m_alignment(alignment)
+        {
+            JobManagerDesc jobDesc;
+            u32 numThreads = AZ::GetMax(AZ::GetMin(maxNumJobs, AZStd::thread::hardware_concurrency()), 1u);
+            for (u32 i = 0; i < numThreads; ++i)
+            {
+                jobDesc.m_workerThreads.push_back(JobManagerThreadDesc());
+            }
+            m_decompressionJobManager = AZStd::make_unique<JobManager>(jobDesc);
+            m_decompressionJobContext = AZStd::make_unique<JobContext>(*m_decompressionJobManager);
+
+            m_readSlots = AZStd::make_unique<ReadSlot[]>(maxNumReads);
+
+            // Add initial dummy values to the stats to avoid division by zero later on and avoid needing branches.
+            m_bytesDecompressed.PushEntry(1);
+            m_decompressionDurationMicroSec.PushEntry(1);
+        }
+
+        void ChunkedDecompressor::QueueRequest(FileRequest* request)
+        {
+            AZ_Assert(request, "QueueRequest was provided a null request.");
+
+            if (HasSeekTable(request))
+            {
+                m_pendingReads.push_back(request);
+            }
+            else
+            {
+                StreamStackEntry::QueueRequest(request);
+            }
+        }
+
+        bool ChunkedDecompressor::ExecuteRequests()
+        {
+            bool result = false;
+            while (!m_pendingReads.empty() && m_numInFlightReads < m_maxNumReads)
+            {
+                StartArchiveRead(m_pendingReads.front());
+                m_pendingReads.pop_front();
+                result = true;
+            }
+            return StreamStackEntry::ExecuteRequests() || result;
+        }
+
+        void ChunkedDecompressor::UpdateStatus(Status& status) const
+        {
+            StreamStackEntry::UpdateStatus(status);
+            s32 numAvailableSlots = aznumeric_cast<s32>(m_maxNumReads - m_numInFlightReads);
+            status.m_numAvailableSlots = AZStd::min(status.m_numAvailableSlots, numAvailableSlots);
+            status.m_isIdle = status.m_isIdle && IsIdle();
+        }
+
+        void ChunkedDecompressor::UpdateCompletionEstimates(AZStd::chrono::system_clock::time_point now,
+            AZStd::vector<FileRequest*>& internalPending, StreamerContext::PreparedQueue::iterator pendingBegin,
+            StreamerContext::PreparedQueue::iterator pendingEnd)
+        {
+            // Pending compressed reads are estimated by the FullFileDecompressor further down the stack. It assumes the file is
+            // decompressed as a whole, which overestimates these reads, but keeps the order in which requests complete correct.
+            AZStd::reverse_copy(m_pendingReads.begin(), m_pendingReads.end(), AZStd::back_inserter(internalPending));
+
+            StreamStackEntry::UpdateCompletionEstimates(now, internalPending, pendingBegin, pendingEnd);
+
+            double totalBytesDecompressed = aznumeric_caster(m_bytesDecompressed.GetTotal());
+            double totalDecompressionDuration = aznumeric_caster(m_decompressionDurationMicroSec.GetTotal());
+            for (u32 i = 0; i < m_maxNumReads; ++i)
+            {
+                const ReadSlot& slot = m_readSlots[i];
+                if (slot.m_status == ReadSlotStatus::Unused)
+                {
+                    continue;
+                }
+
+                auto decompressionDuration = AZStd::chrono::microseconds(
+                    aznumeric_cast<u64>((slot.m_compressedSize * totalDecompressionDuration) / totalBytesDecompressed));
+                if (slot.m_status == ReadSlotStatus::ReadInFlight)
+                {
+                    // Internal read requests can start and complete but pending finalization before they're ever scheduled in which case
+                    // the estimated time is not set.
+                    AZStd::chrono::system_clock::time_point baseTime = slot.m_request->GetEstimatedCompletion();
+                    if (baseTime == AZStd::chrono::system_clock::time_point())
+                    {
+                        baseTime = now;
+                    }
+                    slot.m_request->SetEstimatedCompletion(baseTime + decompressionDuration);
+                }
+                else
+                {
+                    auto timeInProcessing = AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(
+                        AZStd::chrono::high_resolution_clock::now() - slot.m_decompressionStartTime);
+                    auto timeLeft = decompressionDuration > timeInProcessing
+                        ? decompressionDuration - timeInProcessing : AZStd::chrono::microseconds(0);
+                    slot.m_request->SetEstimatedCompletion(now + timeLeft);
+                }
+            }
+        }
+
+        void ChunkedDecompressor::CollectStatistics(AZStd::vector<Statistic>& statistics) const
+        {
+            constexpr double bytesToMB = 1.0 / (1024.0 * 1024.0);
+            constexpr double usToSec = 1.0 / (1000.0 * 1000.0);
+
+            if (m_bytesDecompressed.GetNumRecorded() > 1) // There's always a default added.
+            {
+                statistics.push_back(Statistic::CreateInteger(m_name, "Available read slots", m_maxNumReads - m_numInFlightReads));
+                statistics.push_back(Statistic::CreateFloat(m_name, "Buffer memory (MB)", m_memoryUsage * bytesToMB));
+                statistics.push_back(Statistic::CreateFloat(m_name, "Chunks per read (avg.)", m_chunksPerRead.CalculateAverage()));
+
+                double totalBytesDecompressedMB = m_bytesDecompressed.GetTotal() * bytesToMB;
+                double totalDecompressionTimeSec = m_decompressionDurationMicroSec.GetTotal() * usToSec;
+                statistics.push_back(Statistic::CreateFloat(m_name, "Decompression Speed per read (avg. mbps)",
+                    totalBytesDecompressedMB / totalDecompressionTimeSec));
+            }
+
+            StreamStackEntry::CollectStatistics(statistics);
+        }
+
+        bool ChunkedDecompressor::HasSeekTable(const FileRequest* request)
+        {
+            auto data = AZStd::get_if<FileRequest::CompressedReadData>(&request->GetCommand());
+            return data && data->m_compressionInfo.m_seekTable && data->m_compressionInfo.m_seekTable->size() >= 2;
+        }
+
+        bool ChunkedDecompressor::IsIdle() const
+        {
+            return m_pendingReads.empty() && m_numInFlightReads == 0;
+        }
+
+        void ChunkedDecompressor::StartArchiveRead(FileRequest* compressedReadRequest)
+        {
+            if (!m_next)
+            {
+                compressedReadRequest->SetStatus(IStreamerTypes::RequestStatus::Failed);
+                m_context->MarkRequestAsCompleted(compressedReadRequest);
+                return;
+            }
+
+            auto data = AZStd::get_if<FileRequest::CompressedReadData>(&compressedReadRequest->GetCommand());
+            AZ_Assert(data, "Compressed request that's starting a read in ChunkedDecompressor didn't contain compression read data.");
+            const CompressionInfo& info = data->m_compressionInfo;
+            AZ_Assert(info.m_decompressor, "ChunkedDecompressor is planning to a queue a request for reading but couldn't find a decompressor.");
+            if (data->m_readOffset + data->m_readSize > info.m_seekTable->back().m_uncompressedOffset)
+            {
+                AZ_Error("ChunkedDecompressor", false, "Request to read %llu bytes at offset %llu goes past the end of '%s'.",
+                    data->m_readSize, data->m_readOffset, info.m_archiveFilename.GetRelativePath());
+                compressedReadRequest->SetStatus(IStreamerTypes::RequestStatus::Failed);
+                m_context->MarkRequestAsCompleted(compressedReadRequest);
+                return;
+            }
+            if (data->m_readSize == 0)
+            {
+                compressedReadRequest->SetStatus(IStreamerTypes::RequestStatus::Completed);
+                m_context->MarkRequestAsCompleted(compressedReadRequest);
+                return;
+            }
+
+            // Find the chunks that overlap with the requested range. The last seek point only marks the end of the data.
+            const CompressionSeekTable& seekTable = *info.m_seekTable;
+            auto compareOffset = [](u64 offset, const CompressionSeekPoint& point)
+            {
+                return offset < point.m_uncompressedOffset;
+            };
+            auto lastChunk = seekTable.end() - 1;
+            auto first = AZStd::upper_bound(seekTable.begin(), lastChunk, data->m_readOffset, compareOffset) - 1;
+            auto end = AZStd::upper_bound(first, lastChunk, data->m_readOffset + data->m_readSize - 1, compareOffset);
+
+            for (u32 i = 0; i < m_maxNumReads; ++i)
+            {
+                ReadSlot& slot = m_readSlots[i];
+                if (slot.m_status == ReadSlotStatus::Unused)
+                {
+                    slot.m_firstChunk = AZStd::distance(seekTable.begin(), first);
+                    slot.m_endChunk = AZStd::distance(seekTable.begin(), end);
+                    slot.m_compressedSize = end->m_compressedOffset - first->m_compressedOffset;
+                    slot.m_failed = false;
+
+                    // See FullFileDecompressor::StartArchiveRead for why the buffer is aligned down, but the offset isn't.
+                    size_t readOffset = info.m_offset + first->m_compressedOffset;
+                    size_t offsetAdjustment = readOffset - AZ_SIZE_ALIGN_DOWN(readOffset, aznumeric_cast<size_t>(m_alignment));
+                    slot.m_alignmentOffset = aznumeric_caster(offsetAdjustment);
+                    slot.m_bufferSize = AZ_SIZE_ALIGN_UP((slot.m_compressedSize + offsetAdjustment), aznumeric_cast<size_t>(m_alignment));
+                    slot.m_buffer = reinterpret_cast<u8*>(AZ::AllocatorInstance<AZ::SystemAllocator>::Get().Allocate(
+                        slot.m_bufferSize, m_alignment, 0, "AZ::IO::Streamer ChunkedDecompressor", __FILE__, __LINE__));
+                    m_memoryUsage += slot.m_bufferSize;
+
+                    FileRequest* archiveReadRequest = m_context->GetNewInternalRequest();
+                    archiveReadRequest->CreateRead(compressedReadRequest, slot.m_buffer + offsetAdjustment, slot.m_bufferSize,
+                        info.m_archiveFilename, readOffset, slot.m_compressedSize, info.m_isSharedPak);
+                    archiveReadRequest->SetCompletionCallback(
+                        [this, readSlot = i](FileRequest& request)
+                        {
+                            AZ_PROFILE_FUNCTION(AzCore);
+                            FinishArchiveRead(&request, readSlot);
+                        });
+                    m_next->QueueRequest(archiveReadRequest);
+
+                    slot.m_request = archiveReadRequest;
+                    slot.m_status = ReadSlotStatus::ReadInFlight;
+                    m_numInFlightReads++;
+                    return;
+                }
+            }
+            AZ_Assert(false, "%u of %u read slots are use in the ChunkedDecompressor, but no empty slot was found.", m_numInFlightReads, m_maxNumReads);
+        }
+
+        void ChunkedDecompressor::FinishArchiveRead(FileRequest* readRequest, u32 readSlot)
+        {
+            ReadSlot& slot = m_readSlots[readSlot];
+            AZ_Assert(slot.m_request == readRequest, "Request in the archive read slot isn't the same as request that's being completed.");
+
+            if (readRequest->GetStatus() != IStreamerTypes::RequestStatus::Completed)
+            {
+                ReleaseReadSlot(readSlot);
+                return;
+            }
+
+            FileRequest* compressedRequest = readRequest->GetParent();
+            AZ_Assert(compressedRequest, "Read requests started by ChunkedDecompressor is missing a parent request.");
+
+            // Add this wait so the compressed request isn't fully completed yet as only the read part is done. The last
+            // decompression job will finish this wait, which in turn will call FinishDecompression on the main streaming thread.
+            FileRequest* waitRequest = m_context->GetNewInternalRequest();
+            waitRequest->CreateWait(compressedRequest);
+            waitRequest->SetCompletionCallback([this, readSlot](FileRequest& request)
+                {
+                    AZ_PROFILE_FUNCTION(AzCore);
+                    FinishDecompression(&request, readSlot);
+                });
+
+            slot.m_request = waitRequest;
+            slot.m_status = ReadSlotStatus::Decompressing;
+            slot.m_decompressionStartTime = AZStd::chrono::high_resolution_clock::now();
+            slot.m_remainingChunks = slot.m_endChunk - slot.m_firstChunk;
+            for (size_t chunk = slot.m_firstChunk; chunk < slot.m_endChunk; ++chunk)
+            {
+                auto job = [context = m_context, &slot, chunk]()
+                {
+                    DecompressChunk(context, slot, chunk);
+                };
+                AZ::CreateJobFunction(job, true, m_decompressionJobContext.get())->Start();
+            }
+        }
+
+        void ChunkedDecompressor::FinishDecompression([[maybe_unused]] FileRequest* waitRequest, u32 readSlot)
+        {
+            ReadSlot& slot = m_readSlots[readSlot];
+            AZ_Assert(slot.m_request == waitRequest, "Read slot didn't contain the expected wait request.");
+
+            auto endTime = AZStd::chrono::high_resolution_clock::now();
+            m_decompressionDurationMicroSec.PushEntry(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(
+                endTime - slot.m_decompressionStartTime).count());
+            m_bytesDecompressed.PushEntry(slot.m_compressedSize);
+            m_chunksPerRead.PushEntry(slot.m_endChunk - slot.m_firstChunk);
+
+            ReleaseReadSlot(readSlot);
+        }
+
+        void ChunkedDecompressor::ReleaseReadSlot(u32 readSlot)
+        {
+            ReadSlot& slot = m_readSlots[readSlot];
+            AZ::AllocatorInstance<AZ::SystemAllocator>::Get().DeAllocate(slot.m_buffer, slot.m_bufferSize, m_alignment);
+            m_memoryUsage -= slot.m_bufferSize;
+            slot.m_buffer = nullptr;
+            slot.m_bufferSize = 0;
+            slot.m_request = nullptr;
+            slot.m_status = ReadSlotStatus::Unused;
+
+            AZ_Assert(m_numInFlightReads > 0, "Trying to release a read slot in ChunkedDecompressor, but no reads are supposed to be in flight.");
+            m_numInFlightReads--;
+        }
+
+        void ChunkedDecompressor::DecompressChunk(StreamerContext* context, ReadSlot& slot, size_t chunk)
+        {
+            AZ_PROFILE_SCOPE(AzCore, "ChunkedDecompressor::DecompressChunk");
+
+            FileRequest* compressedRequest = slot.m_request->GetParent();
+            AZ_Assert(compressedRequest, "A wait request attached to ChunkedDecompressor didn't have a parent compressed request.");
+            auto request = AZStd::get_if<FileRequest::CompressedReadData>(&compressedRequest->GetCommand());
+            AZ_Assert(request, "Compressed request in ChunkedDecompressor that's decompressing a chunk didn't contain compression read data.");
+            const CompressionInfo& compressionInfo = request->m_compressionInfo;
+            const CompressionSeekTable& seekTable = *compressionInfo.m_seekTable;
+
+            const CompressionSeekPoint& chunkStart = seekTable[chunk];
+            const CompressionSeekPoint& chunkEnd = seekTable[chunk + 1];
+            const u8* compressed = slot.m_buffer + slot.m_alignmentOffset +
+                (chunkStart.m_compressedOffset - seekTable[slot.m_firstChunk].m_compressedOffset);
+            size_t compressedSize = chunkEnd.m_compressedOffset - chunkStart.m_compressedOffset;
+            size_t uncompressedSize = chunkEnd.m_uncompressedOffset - chunkStart.m_uncompressedOffset;
+
+            u64 readEnd = request->m_readOffset + request->m_readSize;
+            u64 copyStart = AZStd::max(request->m_readOffset, chunkStart.m_uncompressedOffset);
+            u64 copyEnd = AZStd::min(readEnd, chunkEnd.m_uncompressedOffset);
+            u8* output = reinterpret_cast<u8*>(request->m_output) + (copyStart - request->m_readOffset);
+
+            bool success;
+            if (copyStart == chunkStart.m_uncompressedOffset && copyEnd == chunkEnd.m_uncompressedOffset)
+            {
+                success = compressionInfo.m_decompressor(compressionInfo, compressed, compressedSize, output, uncompressedSize);
+            }
+            else
+            {
+                AZStd::unique_ptr<u8[]> decompressionBuffer = AZStd::unique_ptr<u8[]>(new u8[uncompressedSize]);
+                success = compressionInfo.m_decompressor(compressionInfo, compressed, compressedSize, decompressionBuffer.get(), uncompressedSize);
+                if (success)
+                {
+                    memcpy(output, decompressionBuffer.get() + (copyStart - chunkStart.m_uncompressedOffset), copyEnd - copyStart);
+                }
+            }
+
+            if (!success)
+            {
+                slot.m_failed = true;
+            }
+            // The last chunk to finish completes the request. The atomic decrement makes the output and failure flags written by
+            // the other jobs visible to it.
+            if (slot.m_remainingChunks.fetch_sub(1, AZStd::memory_order_acq_rel) == 1)
+            {
+                slot.m_request->SetStatus(slot.m_failed ? IStreamerTypes::RequestStatus::Failed : IStreamerTypes::RequestStatus::Completed);
+                context->MarkRequestAsCompleted(slot.m_request);
+                context->WakeUpSchedulingThread();
+            }
+        }
+    } // namespace IO
+} // namespace AZ
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/Streamer/Statistics.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+#include <AzCore/IO/Streamer/StreamStackEntry.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/chrono/clocks.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace AZ
+{
+    namespace IO
+    {
+        struct ChunkedDecompressorConfig final :
+            public IStreamerStackConfig
+        {
+            AZ_RTTI(AZ::IO::ChunkedDecompressorConfig, "{9B302CAC-CD8A-42A2-AF30-CAD9B981CB46}", IStreamerStackConfig);
+            AZ_CLASS_ALLOCATOR(ChunkedDecompressorConfig, AZ::SystemAllocator, 0);
+
+            ~ChunkedDecompressorConfig() override = default;
+            AZStd::shared_ptr<StreamStackEntry> AddStreamStackEntry(
+                const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent) override;
+            static void Reflect(AZ::ReflectContext* context);
+
+            //! Maximum number of reads that are kept in flight.
+            u32 m_maxNumReads{ 2 };
+            //! Maximum number of chunks that can be decompressed simultaneously.
+            u32 m_maxNumJobs{ 4 };
+        };
+
+        //! Entry in the streaming stack that decompresses files from an archive that are stored as a series of
+        //! independently compressed chunks with a seek table.
+        //! Only the chunks that overlap with the requested range are read and every chunk is decompressed in a job of its own,
+        //! so large files are decompressed on multiple cores and partial reads don't need to inflate the entire file.
+        //! Chunks that are fully covered by the request are decompressed directly into the output buffer, only the first and
+        //! last chunk of a partial read need a temporary buffer.
+        //! This entry needs to be placed above a FullFileDecompressor, which resolves the files in the archive and creates
+        //! the compressed read requests. Compressed reads without a seek table are passed on to the FullFileDecompressor.
+        class ChunkedDecompressor
+            : public StreamStackEntry
+        {
+        public:
+            ChunkedDecompressor(u32 maxNumReads, u32 maxNumJobs, u32 alignment);
+            ~ChunkedDecompressor() override = default;
+
+            void QueueRequest(FileRequest* request) override;
+            bool ExecuteRequests() override;
+
+            void UpdateStatus(Status& status) const override;
+            void UpdateCompletionEstimates(AZStd::chrono::system_clock::time_point now, AZStd::vector<FileRequest*>& internalPending,
+                StreamerContext::PreparedQueue::iterator pendingBegin, StreamerContext::PreparedQueue::iterator pendingEnd) override;
+
+            void CollectStatistics(AZStd::vector<Statistic>& statistics) const override;
+
+        private:
+            enum class ReadSlotStatus : uint8_t
+            {
+                Unused,
+                ReadInFlight,
+                Decompressing
+            };
+
+            struct ReadSlot
+            {
+                AZStd::chrono::high_resolution_clock::time_point m_decompressionStartTime;
+                // The read request if reading the chunks and the wait request while the chunks are being decompressed.
+                FileRequest* m_request{ nullptr };
+                u8* m_buffer{ nullptr };
+                size_t m_bufferSize{ 0 };
+                size_t m_firstChunk{ 0 };
+                size_t m_endChunk{ 0 };
+                u64 m_compressedSize{ 0 };
+                AZStd::atomic<size_t> m_remainingChunks{ 0 };
+                AZStd::atomic_bool m_failed{ false };
+                u32 m_alignmentOffset{ 0 };
+                ReadSlotStatus m_status{ ReadSlotStatus::Unused };
+            };
+
+            static bool HasSeekTable(const FileRequest* request);
+            bool IsIdle() const;
+
+            void StartArchiveRead(FileRequest* compressedReadRequest);
+            void FinishArchiveRead(FileRequest* readRequest, u32 readSlot);
+            void FinishDecompression(FileRequest* waitRequest, u32 readSlot);
+            void ReleaseReadSlot(u32 readSlot);
+
+            static void DecompressChunk(StreamerContext* context, ReadSlot& slot, size_t chunk);
+
+            AZStd::deque<FileRequest*> m_pendingReads;
+
+            AverageWindow<size_t, double, s_statisticsWindowSize> m_decompressionDurationMicroSec;
+            AverageWindow<size_t, double, s_statisticsWindowSize> m_bytesDecompressed;
+            AverageWindow<size_t, double, s_statisticsWindowSize> m_chunksPerRead;
+
+            // Stored on the heap so the slots don't move while decompression jobs are referencing them.
+            AZStd::unique_ptr<ReadSlot[]> m_readSlots;
+            AZStd::unique_ptr<JobManager> m_decompressionJobManager;
+            AZStd::unique_ptr<JobContext> m_decompressionJobContext;
+
+            size_t m_memoryUsage{ 0 }; //!< Amount of memory used for buffers by the decompressor.
+            u32 m_maxNumReads{ 2 };
+            u32 m_numInFlightReads{ 0 };
+            u32 m_alignment{ 0 };
+        };
+    } // namespace IO
+} // namespace AZ
@@ -0,0 +1,413 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/ReadCoalescer.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+namespace AZ
+{
+    namespace IO
+    {
+        AZStd::shared_ptr<StreamStackEntry> ReadCoalescerConfig::AddStreamStackEntry(
+            [[maybe_unused]] const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent)
+        {
+            size_t maxReadSize = m_maxReadSizeKib * 1_kib;
+            size_t bufferSize = m_bufferSizeMib * 1_mib;
+            if (bufferSize != 0 && bufferSize < maxReadSize)
+            {
+                AZ_Warning("Streamer", false, "The buffer size for the Read Coalescer is smaller than the maximum read size. "
+                    "It will be increased to fit at least one merged read.");
+                bufferSize = maxReadSize;
+            }
+
+            auto stackEntry = AZStd::make_shared<ReadCoalescer>(
+                maxReadSize,
+                m_maxGapKib * 1_kib,
+                m_maxBatchSize,
+                aznumeric_caster(hardware.m_maxPhysicalSectorSize),
+                bufferSize);
+            stackEntry->SetNext(AZStd::move(parent));
+            return stackEntry;
+        }
+
+        void ReadCoalescerConfig::Reflect(AZ::ReflectContext* context)
+        {
+            if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context); serializeContext != nullptr)
+            {
+                serializeContext->Class<ReadCoalescerConfig, IStreamerStackConfig>()
+                    ->Version(1)
+                    ->Field("BufferSizeMib", &ReadCoalescerConfig::m_bufferSizeMib)
+                    ->Field("MaxReadSizeKib", &ReadCoalescerConfig::m_maxReadSizeKib)
+                    ->Field("MaxGapKib", &ReadCoalescerConfig::m_maxGapKib)
+                    ->Field("MaxBatchSize", &ReadCoalescerConfig::m_maxBatchSize);
+            }
+        }
+
+        static constexpr char AvgReadsPerMergeName[] = "Avg. reads per merged read";
+        static constexpr char MergedReadsName[] = "Merged reads";
+        static constexpr char ZeroCopyMergesName[] = "Zero-copy merges";
+        static constexpr char NumMergedReadsName[] = "Num merged reads";
+        static constexpr char NumReadsSavedName[] = "Num reads saved";
+        static constexpr char GapBytesReadName[] = "Gap bytes read";
+        static constexpr char NumAvailableBufferSlotsName[] = "Num available buffer slots";
+
+        ReadCoalescer::ReadCoalescer(u64 maxReadSize, u64 maxGap, u32 maxBatchSize, u32 memoryAlignment, size_t bufferSize)
+            : StreamStackEntry("Read coalescer")
+            , m_bufferSize(bufferSize)
+            , m_maxReadSize(maxReadSize)
+            , m_maxGap(maxGap)
+            , m_maxBatchSize(AZStd::max(maxBatchSize, 1u))
+            , m_memoryAlignment(memoryAlignment)
+        {
+            AZ_Assert(IStreamerTypes::IsPowerOf2(memoryAlignment), "Memory alignment needs to be a power of 2");
+
+            size_t numBufferSlots = maxReadSize > 0 ? bufferSize / maxReadSize : 0;
+            m_availableBufferSlots.reserve(numBufferSlots);
+            for (u32 i = aznumeric_caster(numBufferSlots); i > 0; --i)
+            {
+                m_availableBufferSlots.push_back(i - 1);
+            }
+            m_pendingReads.reserve(m_maxBatchSize);
+        }
+
+        ReadCoalescer::~ReadCoalescer()
+        {
+            AZ_Assert(m_inFlightReads.empty(), "The Read Coalescer was destroyed while merged reads were still in flight.");
+            if (m_buffer)
+            {
+                AZ::AllocatorInstance<AZ::SystemAllocator>::Get().DeAllocate(m_buffer, m_bufferSize, m_memoryAlignment);
+            }
+        }
+
+        void ReadCoalescer::QueueRequest(FileRequest* request)
+        {
+            AZ_Assert(request, "QueueRequest was provided a null request.");
+            if (!m_next)
+            {
+                request->SetStatus(IStreamerTypes::RequestStatus::Failed);
+                m_context->MarkRequestAsCompleted(request);
+                return;
+            }
+
+            if (auto data = AZStd::get_if<FileRequest::ReadData>(&request->GetCommand()); data != nullptr)
+            {
+                // Reads larger than what can be merged are passed on directly.
+                if (data->m_size >= m_maxReadSize)
+                {
+                    m_mergedReadsStat.PushSample(0.0);
+                    StreamStackEntry::QueueRequest(request);
+                    return;
+                }
+
+                PendingRead pending;
+                pending.m_request = request;
+                auto readRequest = request->GetCommandFromChain<FileRequest::ReadRequestData>();
+                pending.m_deadline = readRequest ? readRequest->m_deadline : FileRequest::s_noDeadlineTime;
+                pending.m_order = m_readCounter++;
+                m_pendingReads.push_back(pending);
+                if (m_pendingReads.size() >= m_maxBatchSize)
+                {
+                    IssuePendingReads();
+                }
+                return;
+            }
+
+            if (auto data = AZStd::get_if<FileRequest::CancelData>(&request->GetCommand()); data != nullptr)
+            {
+                CancelPendingReads(*data);
+            }
+            StreamStackEntry::QueueRequest(request);
+        }
+
+        bool ReadCoalescer::ExecuteRequests()
+        {
+            bool hasIssuedReads = !m_pendingReads.empty();
+            IssuePendingReads();
+            return StreamStackEntry::ExecuteRequests() || hasIssuedReads;
+        }
+
+        void ReadCoalescer::CancelPendingReads(FileRequest::CancelData& data)
+        {
+            auto it = m_pendingReads.begin();
+            while (it != m_pendingReads.end())
+            {
+                if (it->m_request->WorksOn(data.m_target))
+                {
+                    it->m_request->SetStatus(IStreamerTypes::RequestStatus::Canceled);
+                    m_context->MarkRequestAsCompleted(it->m_request);
+                    it = m_pendingReads.erase(it);
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+        }
+
+        void ReadCoalescer::IssuePendingReads()
+        {
+            if (m_pendingReads.empty())
+            {
+                return;
+            }
+
+            AZ_PROFILE_FUNCTION(AzCore);
+
+            // Sort by file and offset so reads that can be merged end up next to each other. The path hash is only used
+            // to group reads by file, the actual path is compared when building the merged reads.
+            AZStd::sort(m_pendingReads.begin(), m_pendingReads.end(), [](const PendingRead& lhs, const PendingRead& rhs)
+                {
+                    auto& lhsData = AZStd::get<FileRequest::ReadData>(lhs.m_request->GetCommand());
+                    auto& rhsData = AZStd::get<FileRequest::ReadData>(rhs.m_request->GetCommand());
+                    size_t lhsHash = lhsData.m_path.GetHash();
+                    size_t rhsHash = rhsData.m_path.GetHash();
+                    if (lhsHash != rhsHash)
+                    {
+                        return lhsHash < rhsHash;
+                    }
+                    if (lhsData.m_offset != rhsData.m_offset)
+                    {
+                        return lhsData.m_offset < rhsData.m_offset;
+                    }
+                    return lhs.m_order < rhs.m_order;
+                });
+
+            m_readGroups.clear();
+            PendingRead* pendingEnd = m_pendingReads.data() + m_pendingReads.size();
+            PendingRead* groupBegin = m_pendingReads.data();
+            while (groupBegin != pendingEnd)
+            {
+                auto& firstData = AZStd::get<FileRequest::ReadData>(groupBegin->m_request->GetCommand());
+                u64 groupEnd = firstData.m_offset + firstData.m_size;
+
+                ReadGroup group;
+                group.m_begin = groupBegin;
+                group.m_deadline = groupBegin->m_deadline;
+                group.m_order = groupBegin->m_order;
+
+                PendingRead* current = groupBegin + 1;
+                for (; current != pendingEnd; ++current)
+                {
+                    auto& data = AZStd::get<FileRequest::ReadData>(current->m_request->GetCommand());
+                    u64 end = AZStd::max(groupEnd, data.m_offset + data.m_size);
+                    if (data.m_offset > groupEnd + m_maxGap || end - firstData.m_offset > m_maxReadSize ||
+                        data.m_sharedRead != firstData.m_sharedRead || data.m_path != firstData.m_path)
+                    {
+                        break;
+                    }
+                    groupEnd = end;
+                    group.m_deadline = AZStd::min(group.m_deadline, current->m_deadline);
+                    group.m_order = AZStd::min(group.m_order, current->m_order);
+                }
+                group.m_end = current;
+                m_readGroups.push_back(group);
+                groupBegin = current;
+            }
+
+            // Issue the reads in order of the most urgent request they contain so merging doesn't push back reads that
+            // the scheduler has ordered to be read first.
+            AZStd::sort(m_readGroups.begin(), m_readGroups.end(), [](const ReadGroup& lhs, const ReadGroup& rhs)
+                {
+                    return lhs.m_deadline != rhs.m_deadline ? lhs.m_deadline < rhs.m_deadline : lhs.m_order < rhs.m_order;
+                });
+            for (ReadGroup& group : m_readGroups)
+            {
+                IssueMergedRead(group.m_begin, group.m_end);
+            }
+
+            m_readGroups.clear();
+            m_pendingReads.clear();
+        }
+
+        void ReadCoalescer::IssueMergedRead(PendingRead* begin, PendingRead* end)
+        {
+            if (end - begin == 1)
+            {
+                m_mergedReadsStat.PushSample(0.0);
+                m_next->QueueRequest(begin->m_request);
+                return;
+            }
+
+            auto& firstData = AZStd::get<FileRequest::ReadData>(begin->m_request->GetCommand());
+            u64 groupStart = firstData.m_offset;
+            u64 groupEnd = groupStart;
+            u64 requestedBytes = 0;
+            // The data can be read directly into the output buffers if the reads are back to back in both the file and in memory.
+            bool isZeroCopy = true;
+            for (PendingRead* current = begin; current != end; ++current)
+            {
+                auto& data = AZStd::get<FileRequest::ReadData>(current->m_request->GetCommand());
+                if (current != begin)
+                {
+                    auto& previous = AZStd::get<FileRequest::ReadData>((current - 1)->m_request->GetCommand());
+                    isZeroCopy = isZeroCopy &&
+                        data.m_offset == previous.m_offset + previous.m_size &&
+                        data.m_output == reinterpret_cast<u8*>(previous.m_output) + previous.m_size;
+                }
+                groupEnd = AZStd::max(groupEnd, data.m_offset + data.m_size);
+                requestedBytes += data.m_size;
+            }
+
+            if (!isZeroCopy && m_availableBufferSlots.empty())
+            {
+                // There's no room to read the merged data into, so issue the reads as they are.
+                for (PendingRead* current = begin; current != end; ++current)
+                {
+                    m_mergedReadsStat.PushSample(0.0);
+                    m_next->QueueRequest(current->m_request);
+                }
+                return;
+            }
+
+            InFlightRead inFlight;
+            inFlight.m_sections.reserve(end - begin);
+            u8* output;
+            u64 outputSize;
+            if (isZeroCopy)
+            {
+                auto& lastData = AZStd::get<FileRequest::ReadData>((end - 1)->m_request->GetCommand());
+                output = reinterpret_cast<u8*>(firstData.m_output);
+                outputSize = (reinterpret_cast<u8*>(lastData.m_output) + lastData.m_outputSize) - output;
+            }
+            else
+            {
+                InitializeBuffer();
+                inFlight.m_bufferSlot = m_availableBufferSlots.back();
+                m_availableBufferSlots.pop_back();
+                output = GetBufferSlot(inFlight.m_bufferSlot);
+                outputSize = m_maxReadSize;
+            }
+
+            for (PendingRead* current = begin; current != end; ++current)
+            {
+                auto& data = AZStd::get<FileRequest::ReadData>(current->m_request->GetCommand());
+                MergedSection section;
+                section.m_wait = m_context->GetNewInternalRequest();
+                section.m_wait->CreateWait(current->m_request);
+                section.m_target = reinterpret_cast<u8*>(data.m_output);
+                section.m_size = data.m_size;
+                section.m_bufferOffset = data.m_offset - groupStart;
+                inFlight.m_sections.push_back(section);
+                m_mergedReadsStat.PushSample(1.0);
+            }
+
+            // The path is owned by the first request, which stays alive until its wait request completes.
+            inFlight.m_read = m_context->GetNewInternalRequest();
+            inFlight.m_read->CreateRead(nullptr, output, outputSize, firstData.m_path, groupStart, groupEnd - groupStart,
+                firstData.m_sharedRead);
+            inFlight.m_read->SetCompletionCallback([this](FileRequest& request)
+                {
+                    AZ_PROFILE_FUNCTION(AzCore);
+                    CompleteMergedRead(request);
+                });
+
+            ++m_numMergedReads;
+            m_numReadsSaved += (end - begin) - 1;
+            m_numGapBytesRead += (groupEnd - groupStart) > requestedBytes ? (groupEnd - groupStart) - requestedBytes : 0;
+            m_readsPerMergeStat.PushSample(aznumeric_cast<double>(end - begin));
+            m_zeroCopyMergesStat.PushSample(isZeroCopy ? 1.0 : 0.0);
+
+            FileRequest* read = inFlight.m_read;
+            m_inFlightReads.push_back(AZStd::move(inFlight));
+            m_next->QueueRequest(read);
+        }
+
+        void ReadCoalescer::CompleteMergedRead(FileRequest& mergedRead)
+        {
+            auto it = AZStd::find_if(m_inFlightReads.begin(), m_inFlightReads.end(),
+                [&mergedRead](const InFlightRead& inFlight) { return inFlight.m_read == &mergedRead; });
+            AZ_Assert(it != m_inFlightReads.end(), "A merged read completed that the Read Coalescer has no record of.");
+
+            IStreamerTypes::RequestStatus status = mergedRead.GetStatus();
+            bool copyData = it->m_bufferSlot != s_noBufferSlot;
+            for (MergedSection& section : it->m_sections)
+            {
+                if (copyData && status == IStreamerTypes::RequestStatus::Completed)
+                {
+                    memcpy(section.m_target, GetBufferSlot(it->m_bufferSlot) + section.m_bufferOffset, section.m_size);
+                }
+                section.m_wait->SetStatus(status);
+                m_context->MarkRequestAsCompleted(section.m_wait);
+            }
+
+            if (copyData)
+            {
+                m_availableBufferSlots.push_back(it->m_bufferSlot);
+            }
+            if (it != m_inFlightReads.end() - 1)
+            {
+                *it = AZStd::move(m_inFlightReads.back());
+            }
+            m_inFlightReads.pop_back();
+        }
+
+        void ReadCoalescer::UpdateStatus(Status& status) const
+        {
+            StreamStackEntry::UpdateStatus(status);
+            // Reads that are held back will take up slots in the next entry once they're issued.
+            s64 numAvailableSlots = AZStd::min<s64>(status.m_numAvailableSlots, m_maxBatchSize) - aznumeric_cast<s64>(m_pendingReads.size());
+            status.m_numAvailableSlots = aznumeric_cast<s32>(AZStd::max<s64>(numAvailableSlots, std::numeric_limits<s32>::min()));
+            status.m_isIdle = status.m_isIdle && m_pendingReads.empty();
+        }
+
+        void ReadCoalescer::UpdateCompletionEstimates(AZStd::chrono::system_clock::time_point now,
+            AZStd::vector<FileRequest*>& internalPending, StreamerContext::PreparedQueue::iterator pendingBegin,
+            StreamerContext::PreparedQueue::iterator pendingEnd)
+        {
+            for (const PendingRead& pending : m_pendingReads)
+            {
+                internalPending.push_back(pending.m_request);
+            }
+
+            StreamStackEntry::UpdateCompletionEstimates(now, internalPending, pendingBegin, pendingEnd);
+
+            // The merged reads don't have a parent so copy their estimation to the original requests.
+            for (const InFlightRead& inFlight : m_inFlightReads)
+            {
+                for (const MergedSection& section : inFlight.m_sections)
+                {
+                    section.m_wait->SetEstimatedCompletion(inFlight.m_read->GetEstimatedCompletion());
+                }
+            }
+        }
+
+        void ReadCoalescer::CollectStatistics(AZStd::vector<Statistic>& statistics) const
+        {
+            statistics.push_back(Statistic::CreateFloat(m_name, AvgReadsPerMergeName, m_readsPerMergeStat.GetAverage()));
+            statistics.push_back(Statistic::CreatePercentage(m_name, MergedReadsName, m_mergedReadsStat.GetAverage()));
+            statistics.push_back(Statistic::CreatePercentage(m_name, ZeroCopyMergesName, m_zeroCopyMergesStat.GetAverage()));
+            statistics.push_back(Statistic::CreateInteger(m_name, NumMergedReadsName, aznumeric_caster(m_numMergedReads)));
+            statistics.push_back(Statistic::CreateInteger(m_name, NumReadsSavedName, aznumeric_caster(m_numReadsSaved)));
+            statistics.push_back(Statistic::CreateInteger(m_name, GapBytesReadName, aznumeric_caster(m_numGapBytesRead)));
+            statistics.push_back(Statistic::CreateInteger(m_name, NumAvailableBufferSlotsName, aznumeric_caster(m_availableBufferSlots.size())));
+            StreamStackEntry::CollectStatistics(statistics);
+        }
+
+        void ReadCoalescer::InitializeBuffer()
+        {
+            // Lazy initialization to avoid allocating memory if it's not needed.
+            if (m_bufferSize != 0 && m_buffer == nullptr)
+            {
+                m_buffer = reinterpret_cast<u8*>(AZ::AllocatorInstance<AZ::SystemAllocator>::Get().Allocate(
+                    m_bufferSize, m_memoryAlignment, 0, "AZ::IO::Streamer ReadCoalescer", __FILE__, __LINE__));
+            }
+        }
+
+        u8* ReadCoalescer::GetBufferSlot(size_t index)
+        {
+            AZ_Assert(m_buffer != nullptr, "A buffer slot was requested by the Read Coalescer before the buffer was initialized.");
+            return m_buffer + (index * m_maxReadSize);
+        }
+    } // namespace IO
+} // namespace AZ
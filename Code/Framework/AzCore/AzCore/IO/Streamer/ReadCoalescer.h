@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/Statistics.h>
+#include <AzCore/IO/Streamer/StreamStackEntry.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Statistics/RunningStatistic.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/limits.h>
+
+namespace AZ
+{
+    namespace IO
+    {
+        struct ReadCoalescerConfig final :
+            public IStreamerStackConfig
+        {
+            AZ_RTTI(AZ::IO::ReadCoalescerConfig, "{3A0C8E52-6B0D-4C1F-9A7E-5D2F4B8C61E3}", IStreamerStackConfig);
+            AZ_CLASS_ALLOCATOR(ReadCoalescerConfig, AZ::SystemAllocator, 0);
+
+            ~ReadCoalescerConfig() override = default;
+            AZStd::shared_ptr<StreamStackEntry> AddStreamStackEntry(
+                const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent) override;
+            static void Reflect(AZ::ReflectContext* context);
+
+            //! The size of the internal buffer that merged reads are read into before being copied to the original requests.
+            //! If set to zero only reads that are contiguous in both the file and memory are merged.
+            u32 m_bufferSizeMib{ 4 };
+            //! The maximum size of a merged read.
+            u32 m_maxReadSizeKib{ 512 };
+            //! The maximum number of bytes between two reads that will still be merged. The bytes in the gap are read but discarded.
+            u32 m_maxGapKib{ 16 };
+            //! The maximum number of reads that are held back for merging before they're passed on to the next entry in the stack.
+            u32 m_maxBatchSize{ 64 };
+        };
+
+        //! The ReadCoalescer holds on to the reads that are queued in a single scheduling pass and merges the ones that
+        //! are for the same file and are contiguous or separated by a small gap, such as small assets stored next to each
+        //! other in an archive. The merged read is issued once and the result is split back into the original requests.
+        //! If the output buffers of the merged requests are also contiguous in memory, the data is read directly into them,
+        //! otherwise it's read into an internal buffer and copied.
+        class ReadCoalescer
+            : public StreamStackEntry
+        {
+        public:
+            ReadCoalescer(u64 maxReadSize, u64 maxGap, u32 maxBatchSize, u32 memoryAlignment, size_t bufferSize);
+            ~ReadCoalescer() override;
+
+            void QueueRequest(FileRequest* request) override;
+            bool ExecuteRequests() override;
+
+            void UpdateStatus(Status& status) const override;
+            void UpdateCompletionEstimates(AZStd::chrono::system_clock::time_point now, AZStd::vector<FileRequest*>& internalPending,
+                StreamerContext::PreparedQueue::iterator pendingBegin, StreamerContext::PreparedQueue::iterator pendingEnd) override;
+
+            void CollectStatistics(AZStd::vector<Statistic>& statistics) const override;
+
+        private:
+            struct PendingRead
+            {
+                FileRequest* m_request{ nullptr };
+                AZStd::chrono::system_clock::time_point m_deadline;
+                size_t m_order{ 0 };
+            };
+
+            struct MergedSection
+            {
+                FileRequest* m_wait{ nullptr };
+                u8* m_target{ nullptr };
+                u64 m_size{ 0 };
+                u64 m_bufferOffset{ 0 };
+            };
+
+            struct ReadGroup
+            {
+                PendingRead* m_begin{ nullptr };
+                PendingRead* m_end{ nullptr };
+                AZStd::chrono::system_clock::time_point m_deadline;
+                size_t m_order{ 0 };
+            };
+
+            struct InFlightRead
+            {
+                FileRequest* m_read{ nullptr };
+                AZStd::vector<MergedSection> m_sections;
+                u32 m_bufferSlot{ s_noBufferSlot };
+            };
+
+            static constexpr u32 s_noBufferSlot = AZStd::numeric_limits<u32>::max();
+
+            void CancelPendingReads(FileRequest::CancelData& data);
+            void IssuePendingReads();
+            void IssueMergedRead(PendingRead* begin, PendingRead* end);
+            void CompleteMergedRead(FileRequest& mergedRead);
+
+            void InitializeBuffer();
+            u8* GetBufferSlot(size_t index);
+
+            AZ::Statistics::RunningStatistic m_readsPerMergeStat;
+            AZ::Statistics::RunningStatistic m_mergedReadsStat;
+            AZ::Statistics::RunningStatistic m_zeroCopyMergesStat;
+            AZStd::vector<PendingRead> m_pendingReads;
+            AZStd::vector<ReadGroup> m_readGroups;
+            AZStd::vector<InFlightRead> m_inFlightReads;
+            AZStd::vector<u32> m_availableBufferSlots;
+            u8* m_buffer{ nullptr };
+            size_t m_bufferSize;
+            u64 m_maxReadSize;
+            u64 m_maxGap;
+            u64 m_numMergedReads{ 0 };
+            u64 m_numReadsSaved{ 0 };
+            u64 m_numGapBytesRead{ 0 };
+            size_t m_readCounter{ 0 };
+            u32 m_maxBatchSize;
+            u32 m_memoryAlignment;
+        };
+    } // namespace IO
+} // namespace AZ
@@ -12,12 +12,14 @@
 #include <AzCore/Math/Crc.h>
 #include <AzCore/IO/IStreamer.h>
 #include <AzCore/IO/Streamer/BlockCache.h>
+#include <AzCore/IO/Streamer/ChunkedDecompressor.h>
 #include <AzCore/IO/Streamer/DedicatedCache.h>
 #include <AzCore/IO/Streamer/FullFileDecompressor.h>
 #include <AzCore/IO/Streamer/Scheduler.h>
 #include <AzCore/IO/Streamer/StreamerComponent.h>
 #include <AzCore/IO/Streamer/StreamerConfiguration.h>
 #include <AzCore/IO/Streamer/StorageDrive.h>
+#include <AzCore/IO/Streamer/ReadCoalescer.h>
 #include <AzCore/IO/Streamer/ReadSplitter.h>
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/Settings/SettingsRegistry.h>
@@ -191,9 +193,11 @@ namespace AZ
         }
 
         BlockCacheConfig::Reflect(context);
+        ChunkedDecompressorConfig::Reflect(context);
         DedicatedCacheConfig::Reflect(context);
         IStreamerStackConfig::Reflect(context);
         FullFileDecompressorConfig::Reflect(context);
+        ReadCoalescerConfig::Reflect(context);
         ReadSplitterConfig::Reflect(context);
         StorageDriveConfig::Reflect(context);
         StreamerConfig::Reflect(context);
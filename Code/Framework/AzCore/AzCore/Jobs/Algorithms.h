@@ -10,6 +10,8 @@
 
 #include <AzCore/Jobs/task_group.h>
 #include <AzCore/std/allocator_stack.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/std/containers/vector.h>
 
 #include <AzCore/std/parallel/spin_mutex.h>
 
@@ -512,7 +514,7 @@ namespace AZ
         explicit simple_partitioner(Internal::ParallelIndexType chunkSize)
             : m_chunkSize(chunkSize)
         {
-            AZ_Assert(m_chunkSize > 1, "Chunk size must be > 0");
+            AZ_Assert(m_chunkSize > 0, "Chunk size must be > 0");
         }
 
         inline Internal::ParallelIndexType GetNumChunks(Internal::ParallelIndexType numElementsToProcess, JobContext* jobContext) const
@@ -682,6 +684,404 @@ namespace AZ
         parallel_for_each_start(start, end, function, dependent, auto_partitioner(), jobContext, allocator);
     }
 
+    namespace Internal
+    {
+        /// Number of chunks we aim for per worker thread when the caller doesn't provide a grain size, so the
+        /// assisting jobs have some room for load balancing.
+        static const ParallelIndexType ParallelChunksPerWorker = 4;
+
+        /// Ranges smaller than this are sorted serially, the cost of the extra passes is higher than the gain.
+        static const ParallelIndexType ParallelSortSerialThreshold = 4096;
+        /// Minimum number of elements we want in a sample sort bucket.
+        static const ParallelIndexType ParallelSortMinBucketSize = 2048;
+        /// Number of samples taken for each bucket when picking the splitters.
+        static const ParallelIndexType ParallelSortOversampling = 32;
+
+        /**
+         * Returns the number of elements a chunk should process. A grain size of 0 (or less) means "pick one", in which
+         * case we create a few chunks per worker thread.
+         */
+        inline ParallelIndexType GetParallelChunkSize(ParallelIndexType numElements, ParallelIndexType grainSize, JobContext* jobContext)
+        {
+            if (grainSize <= 0)
+            {
+                // A job manager without worker threads still processes jobs, count it as one worker rather than dividing by zero
+                const ParallelIndexType numWorkers = AZStd::GetMax<ParallelIndexType>(static_cast<ParallelIndexType>(jobContext->GetJobManager().GetNumWorkerThreads()), 1);
+                const ParallelIndexType numChunks = ParallelChunksPerWorker * numWorkers;
+                grainSize = (numElements + numChunks - 1) / numChunks;
+            }
+            return AZStd::GetMax<ParallelIndexType>(grainSize, 1);
+        }
+
+        inline ParallelIndexType GetParallelChunkCount(ParallelIndexType numElements, ParallelIndexType chunkSize)
+        {
+            return (numElements + chunkSize - 1) / chunkSize;
+        }
+    }
+
+    /**
+     * Parallel for loop over a range, processed in chunks of at least grainSize iterations. Unlike \ref parallel_for the
+     * function is called once per chunk with the [chunkStart, chunkEnd) sub range, so it must have two parameters of
+     * IndexType and return void. This keeps the inner loop free of any job overhead, which is what you want for cheap
+     * iterations. A grainSize of 0 picks a chunk size based on the number of worker threads. This function will block
+     * until the loop is complete.
+     */
+    template<class IndexType, class Function>
+    void parallel_for_range(IndexType start, IndexType end, IndexType grainSize, const Function& function, JobContext* jobContext = nullptr)
+    {
+        if (!(start < end))
+        {
+            return;
+        }
+
+        JobContext* context = jobContext ? jobContext : JobContext::GetParentContext();
+
+        const Internal::ParallelIndexType numElements = static_cast<Internal::ParallelIndexType>(end - start);
+        const Internal::ParallelIndexType chunkSize = Internal::GetParallelChunkSize(numElements, static_cast<Internal::ParallelIndexType>(grainSize), context);
+        const Internal::ParallelIndexType numChunks = Internal::GetParallelChunkCount(numElements, chunkSize);
+        if (numChunks == 1)
+        {
+            function(start, end);
+            return;
+        }
+
+        parallel_for(static_cast<Internal::ParallelIndexType>(0), numChunks, [&](Internal::ParallelIndexType chunk)
+        {
+            const Internal::ParallelIndexType chunkStart = chunk * chunkSize;
+            const Internal::ParallelIndexType chunkEnd = AZStd::GetMin(chunkStart + chunkSize, numElements);
+            function(static_cast<IndexType>(start + chunkStart), static_cast<IndexType>(start + chunkEnd));
+        }, context);
+    }
+
+    template<class IndexType, class Function>
+    void parallel_for_range(IndexType start, IndexType end, const Function& function, JobContext* jobContext = nullptr)
+    {
+        parallel_for_range(start, end, static_cast<IndexType>(0), function, jobContext);
+    }
+
+    /**
+     * Parallel version of AZStd::transform. Applies op to every element in [first, last) and stores the result in the
+     * range starting at dest, which can be the same as first. Works with random access iterators only and blocks until
+     * complete. Returns the end of the destination range.
+     */
+    template<class RandomIterator, class OutputIterator, class UnaryOperation>
+    OutputIterator parallel_transform(RandomIterator first, RandomIterator last, OutputIterator dest, const UnaryOperation& op, Internal::ParallelIndexType grainSize, JobContext* jobContext = nullptr)
+    {
+        const Internal::ParallelIndexType numElements = static_cast<Internal::ParallelIndexType>(last - first);
+        parallel_for_range(static_cast<Internal::ParallelIndexType>(0), numElements, grainSize, [&](Internal::ParallelIndexType chunkStart, Internal::ParallelIndexType chunkEnd)
+        {
+            RandomIterator input = first + chunkStart;
+            OutputIterator output = dest + chunkStart;
+            for (Internal::ParallelIndexType i = chunkStart; i < chunkEnd; ++i, ++input, ++output)
+            {
+                *output = op(*input);
+            }
+        }, jobContext);
+        return dest + numElements;
+    }
+
+    template<class RandomIterator, class OutputIterator, class UnaryOperation>
+    OutputIterator parallel_transform(RandomIterator first, RandomIterator last, OutputIterator dest, const UnaryOperation& op, JobContext* jobContext = nullptr)
+    {
+        return parallel_transform(first, last, dest, op, 0, jobContext);
+    }
+
+    /**
+     * Parallel version of AZStd::reduce. The operation must be associative (the elements are combined in chunks and the
+     * chunk results combined afterwards), but doesn't need to be commutative, the chunks are combined in order.
+     * T must be constructible from the iterator value type. Works with random access iterators only and blocks until complete.
+     */
+    template<class RandomIterator, class T, class BinaryOperation>
+    T parallel_reduce(RandomIterator first, RandomIterator last, T init, const BinaryOperation& op, Internal::ParallelIndexType grainSize, JobContext* jobContext = nullptr)
+    {
+        if (first == last)
+        {
+            return init;
+        }
+
+        JobContext* context = jobContext ? jobContext : JobContext::GetParentContext();
+
+        const Internal::ParallelIndexType numElements = static_cast<Internal::ParallelIndexType>(last - first);
+        const Internal::ParallelIndexType chunkSize = Internal::GetParallelChunkSize(numElements, grainSize, context);
+        const Internal::ParallelIndexType numChunks = Internal::GetParallelChunkCount(numElements, chunkSize);
+
+        AZStd::vector<T> partials(numChunks, init);
+        parallel_for(static_cast<Internal::ParallelIndexType>(0), numChunks, [&](Internal::ParallelIndexType chunk)
+        {
+            RandomIterator chunkFirst = first + chunk * chunkSize;
+            RandomIterator chunkLast = first + AZStd::GetMin(chunk * chunkSize + chunkSize, numElements);
+            T partial(*chunkFirst);
+            for (++chunkFirst; chunkFirst != chunkLast; ++chunkFirst)
+            {
+                partial = op(partial, *chunkFirst);
+            }
+            partials[chunk] = AZStd::move(partial);
+        }, context);
+
+        T result = AZStd::move(init);
+        for (T& partial : partials)
+        {
+            result = op(result, partial);
+        }
+        return result;
+    }
+
+    template<class RandomIterator, class T, class BinaryOperation>
+    T parallel_reduce(RandomIterator first, RandomIterator last, T init, const BinaryOperation& op, JobContext* jobContext = nullptr)
+    {
+        return parallel_reduce(first, last, AZStd::move(init), op, 0, jobContext);
+    }
+
+    template<class RandomIterator, class T>
+    T parallel_reduce(RandomIterator first, RandomIterator last, T init, JobContext* jobContext = nullptr)
+    {
+        return parallel_reduce(first, last, AZStd::move(init), AZStd::plus<>(), 0, jobContext);
+    }
+
+    namespace Internal
+    {
+        /**
+         * Shared implementation for the inclusive and exclusive scans. The range is processed in two parallel passes:
+         * the first one reduces every chunk, then (after a short serial prefix over the chunk sums) the second one
+         * scans each chunk starting from the carry of the chunks before it.
+         */
+        template<bool IsInclusive, class RandomIterator, class OutputIterator, class T, class BinaryOperation>
+        OutputIterator ParallelScan(RandomIterator first, RandomIterator last, OutputIterator dest, const T* init, const BinaryOperation& op, ParallelIndexType grainSize, JobContext* jobContext)
+        {
+            typedef typename AZStd::iterator_traits<RandomIterator>::value_type value_type;
+
+            const ParallelIndexType numElements = static_cast<ParallelIndexType>(last - first);
+            if (numElements == 0)
+            {
+                return dest;
+            }
+
+            JobContext* context = jobContext ? jobContext : JobContext::GetParentContext();
+            const ParallelIndexType chunkSize = GetParallelChunkSize(numElements, grainSize, context);
+            const ParallelIndexType numChunks = GetParallelChunkCount(numElements, chunkSize);
+
+            // Pass 1: reduce every chunk but the last one, its sum is not needed by anybody.
+            AZStd::vector<value_type> chunkSums(numChunks, *first);
+            parallel_for(static_cast<ParallelIndexType>(0), numChunks - 1, [&](ParallelIndexType chunk)
+            {
+                RandomIterator chunkFirst = first + chunk * chunkSize;
+                RandomIterator chunkLast = chunkFirst + chunkSize;
+                value_type sum(*chunkFirst);
+                for (++chunkFirst; chunkFirst != chunkLast; ++chunkFirst)
+                {
+                    sum = op(sum, *chunkFirst);
+                }
+                chunkSums[chunk] = AZStd::move(sum);
+            }, context);
+
+            // Turn the sums into the carry each chunk starts with.
+            AZStd::vector<value_type> carries(numChunks, *first);
+            bool hasCarry = init != nullptr;
+            if (hasCarry)
+            {
+                carries[0] = *init;
+            }
+            for (ParallelIndexType chunk = 1; chunk < numChunks; ++chunk)
+            {
+                carries[chunk] = hasCarry ? op(carries[chunk - 1], chunkSums[chunk - 1]) : chunkSums[chunk - 1];
+                hasCarry = true;
+            }
+
+            // Pass 2: scan every chunk. Elements are read before the output is written so dest can be the same as first.
+            parallel_for(static_cast<ParallelIndexType>(0), numChunks, [&](ParallelIndexType chunk)
+            {
+                const ParallelIndexType chunkStart = chunk * chunkSize;
+                const ParallelIndexType chunkEnd = AZStd::GetMin(chunkStart + chunkSize, numElements);
+                RandomIterator input = first + chunkStart;
+                OutputIterator output = dest + chunkStart;
+                ParallelIndexType i = chunkStart;
+                value_type running(carries[chunk]);
+                if (chunk == 0 && init == nullptr)
+                {
+                    // Inclusive scan without an initial value, the first element starts the sequence.
+                    running = *input;
+                    *output = running;
+                    ++input;
+                    ++output;
+                    ++i;
+                }
+                for (; i < chunkEnd; ++i, ++input, ++output)
+                {
+                    if (IsInclusive)
+                    {
+                        running = op(running, *input);
+                        *output = running;
+                    }
+                    else
+                    {
+                        value_type value(*input);
+                        *output = running;
+                        running = op(running, value);
+                    }
+                }
+            }, context);
+
+            return dest + numElements;
+        }
+    }
+
+    /**
+     * Parallel version of AZStd::inclusive_scan. dest[i] is the sum of all elements in [first, first + i]. The operation
+     * must be associative. dest can be the same as first. Works with random access iterators only and blocks until complete.
+     */
+    template<class RandomIterator, class OutputIterator, class BinaryOperation>
+    OutputIterator parallel_inclusive_scan(RandomIterator first, RandomIterator last, OutputIterator dest, const BinaryOperation& op, Internal::ParallelIndexType grainSize, JobContext* jobContext = nullptr)
+    {
+        typedef typename AZStd::iterator_traits<RandomIterator>::value_type value_type;
+        return Internal::ParallelScan<true>(first, last, dest, static_cast<const value_type*>(nullptr), op, grainSize, jobContext);
+    }
+
+    template<class RandomIterator, class OutputIterator, class BinaryOperation>
+    OutputIterator parallel_inclusive_scan(RandomIterator first, RandomIterator last, OutputIterator dest, const BinaryOperation& op, JobContext* jobContext = nullptr)
+    {
+        return parallel_inclusive_scan(first, last, dest, op, 0, jobContext);
+    }
+
+    template<class RandomIterator, class OutputIterator>
+    OutputIterator parallel_inclusive_scan(RandomIterator first, RandomIterator last, OutputIterator dest, JobContext* jobContext = nullptr)
+    {
+        return parallel_inclusive_scan(first, last, dest, AZStd::plus<>(), 0, jobContext);
+    }
+
+    /**
+     * Parallel version of AZStd::exclusive_scan. dest[i] is init plus the sum of all elements in [first, first + i).
+     * The operation must be associative. dest can be the same as first. Works with random access iterators only and
+     * blocks until complete.
+     */
+    template<class RandomIterator, class OutputIterator, class T, class BinaryOperation>
+    OutputIterator parallel_exclusive_scan(RandomIterator first, RandomIterator last, OutputIterator dest, const T& init, const BinaryOperation& op, Internal::ParallelIndexType grainSize, JobContext* jobContext = nullptr)
+    {
+        typedef typename AZStd::iterator_traits<RandomIterator>::value_type value_type;
+        const value_type initValue(init);
+        return Internal::ParallelScan<false>(first, last, dest, &initValue, op, grainSize, jobContext);
+    }
+
+    template<class RandomIterator, class OutputIterator, class T, class BinaryOperation>
+    OutputIterator parallel_exclusive_scan(RandomIterator first, RandomIterator last, OutputIterator dest, const T& init, const BinaryOperation& op, JobContext* jobContext = nullptr)
+    {
+        return parallel_exclusive_scan(first, last, dest, init, op, 0, jobContext);
+    }
+
+    template<class RandomIterator, class OutputIterator, class T>
+    OutputIterator parallel_exclusive_scan(RandomIterator first, RandomIterator last, OutputIterator dest, const T& init, JobContext* jobContext = nullptr)
+    {
+        return parallel_exclusive_scan(first, last, dest, init, AZStd::plus<>(), 0, jobContext);
+    }
+
+    /**
+     * Parallel sort (not stable). Uses a sample sort: splitters are picked from a sorted sample of the input, the elements
+     * are scattered into one bucket per splitter range in parallel, and then every bucket is sorted in parallel.
+     * Small ranges are sorted serially. The value type must be default constructible and move assignable, the sort
+     * needs a temporary buffer as big as the range. Works with random access iterators only and blocks until complete.
+     */
+    template<class RandomIterator, class Compare>
+    void parallel_sort(RandomIterator first, RandomIterator last, const Compare& comp, JobContext* jobContext = nullptr)
+    {
+        typedef typename AZStd::iterator_traits<RandomIterator>::value_type value_type;
+        using Internal::ParallelIndexType;
+
+        const ParallelIndexType numElements = static_cast<ParallelIndexType>(last - first);
+        if (numElements < Internal::ParallelSortSerialThreshold)
+        {
+            AZStd::sort(first, last, comp);
+            return;
+        }
+
+        JobContext* context = jobContext ? jobContext : JobContext::GetParentContext();
+        const ParallelIndexType maxNumBuckets = Internal::ParallelChunksPerWorker * static_cast<ParallelIndexType>(context->GetJobManager().GetNumWorkerThreads());
+        const ParallelIndexType numBuckets = AZStd::GetMax<ParallelIndexType>(2, AZStd::GetMin(numElements / Internal::ParallelSortMinBucketSize, maxNumBuckets));
+
+        // Pick the splitters from a sorted, evenly spread sample. The offset in each stride is pseudo random so periodic
+        // input doesn't defeat the sampling.
+        AZStd::vector<value_type> splitters;
+        {
+            const ParallelIndexType numSamples = numBuckets * Internal::ParallelSortOversampling;
+            const ParallelIndexType stride = numElements / numSamples;
+            AZStd::vector<value_type> samples;
+            samples.reserve(numSamples);
+            AZ::u32 seed = 0x9E3779B9;
+            for (ParallelIndexType i = 0; i < numSamples; ++i)
+            {
+                seed ^= seed << 13;
+                seed ^= seed >> 17;
+                seed ^= seed << 5;
+                samples.push_back(first[i * stride + static_cast<ParallelIndexType>(seed % static_cast<AZ::u32>(stride))]);
+            }
+            AZStd::sort(samples.begin(), samples.end(), comp);
+
+            splitters.reserve(numBuckets - 1);
+            for (ParallelIndexType bucket = 1; bucket < numBuckets; ++bucket)
+            {
+                splitters.push_back(AZStd::move(samples[bucket * Internal::ParallelSortOversampling]));
+            }
+        }
+
+        auto findBucket = [&splitters, &comp](const value_type& value)
+        {
+            return static_cast<ParallelIndexType>(AZStd::upper_bound(splitters.begin(), splitters.end(), value, comp) - splitters.begin());
+        };
+
+        // Count how many elements each block of the input sends to each bucket.
+        const ParallelIndexType numBlocks = numBuckets;
+        const ParallelIndexType blockSize = Internal::GetParallelChunkCount(numElements, numBlocks);
+        AZStd::vector<ParallelIndexType> blockOffsets(numBlocks * numBuckets, 0);
+        parallel_for(static_cast<ParallelIndexType>(0), numBlocks, [&](ParallelIndexType block)
+        {
+            ParallelIndexType* counts = &blockOffsets[block * numBuckets];
+            const ParallelIndexType blockEnd = AZStd::GetMin(block * blockSize + blockSize, numElements);
+            for (ParallelIndexType i = block * blockSize; i < blockEnd; ++i)
+            {
+                ++counts[findBucket(first[i])];
+            }
+        }, context);
+
+        // Turn the counts into the offset every block writes each bucket to, buckets are laid out in order.
+        AZStd::vector<ParallelIndexType> bucketStarts(numBuckets + 1);
+        ParallelIndexType offset = 0;
+        for (ParallelIndexType bucket = 0; bucket < numBuckets; ++bucket)
+        {
+            bucketStarts[bucket] = offset;
+            for (ParallelIndexType block = 0; block < numBlocks; ++block)
+            {
+                const ParallelIndexType count = blockOffsets[block * numBuckets + bucket];
+                blockOffsets[block * numBuckets + bucket] = offset;
+                offset += count;
+            }
+        }
+        bucketStarts[numBuckets] = offset;
+
+        AZStd::vector<value_type> buffer(numElements);
+        parallel_for(static_cast<ParallelIndexType>(0), numBlocks, [&](ParallelIndexType block)
+        {
+            ParallelIndexType* offsets = &blockOffsets[block * numBuckets];
+            const ParallelIndexType blockEnd = AZStd::GetMin(block * blockSize + blockSize, numElements);
+            for (ParallelIndexType i = block * blockSize; i < blockEnd; ++i)
+            {
+                buffer[offsets[findBucket(first[i])]++] = AZStd::move(first[i]);
+            }
+        }, context);
+
+        // Sort each bucket and move it back in place. Every bucket maps to the same range in the input.
+        parallel_for(static_cast<ParallelIndexType>(0), numBuckets, [&](ParallelIndexType bucket)
+        {
+            const auto bucketFirst = buffer.begin() + bucketStarts[bucket];
+            const auto bucketLast = buffer.begin() + bucketStarts[bucket + 1];
+            AZStd::sort(bucketFirst, bucketLast, comp);
+            AZStd::move(bucketFirst, bucketLast, first + bucketStarts[bucket]);
+        }, context);
+    }
+
+    template<class RandomIterator>
+    void parallel_sort(RandomIterator first, RandomIterator last, JobContext* jobContext = nullptr)
+    {
+        parallel_sort(first, last, AZStd::less<typename AZStd::iterator_traits<RandomIterator>::value_type>(), jobContext);
+    }
+
     /**
      * Invokes the specified functions in parallel and waits until they are all complete. Overloads for up to 8
      * function parameters are provided.
@@ -0,0 +1,519 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Memory/FrameArenaAllocator.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace AZ
+{
+    struct FrameArenaAllocator::Chunk
+    {
+        Chunk* m_next;
+        size_t m_size; ///< Number of usable bytes following the header.
+
+        char* GetData() { return reinterpret_cast<char*>(this + 1); }
+        char* GetDataEnd() { return GetData() + m_size; }
+    };
+
+    struct FrameArenaAllocator::ThreadArena
+    {
+        ThreadArena* m_next = nullptr;                  ///< Next arena of the allocator, protected by m_arenasMutex.
+        AZStd::thread_id m_owner;                       ///< Thread using the arena, protected by m_arenasMutex.
+        bool m_threadExited = false;                    ///< Set when the owning thread exits, protected by m_arenasMutex.
+
+        // Everything below is only touched by the owning thread, except for the atomics which are read for stats.
+        AZStd::atomic<AZ::u64> m_frameIndex{ 0 };
+        AZStd::atomic<size_t> m_allocatedBytes{ 0 };
+        Chunk* m_firstChunk = nullptr;
+        Chunk* m_currentChunk = nullptr;
+        char* m_cursor = nullptr;
+        char* m_end = nullptr;
+        char* m_lastAllocation = nullptr;
+    };
+
+    namespace Internal
+    {
+        // Registry of live allocator instances. Threads use it on exit to check if the allocator that owns their
+        // cached arena is still alive before handing the arena back.
+        static constexpr size_t MaxFrameArenaInstances = FrameArenaAllocator::MaxInstances;
+
+        struct FrameArenaInstanceRegistry
+        {
+            AZStd::mutex m_mutex;
+            AZ::u32 m_liveIds[MaxFrameArenaInstances] = {};
+            AZ::u32 m_nextId = 1;
+
+            static FrameArenaInstanceRegistry& Get()
+            {
+                static FrameArenaInstanceRegistry s_registry;
+                return s_registry;
+            }
+
+            AZ::u32 Register()
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+                AZ::u32 id = m_nextId++;
+                for (AZ::u32& liveId : m_liveIds)
+                {
+                    if (liveId == 0)
+                    {
+                        liveId = id;
+                        return id;
+                    }
+                }
+                AZ_Assert(false, "More than %zu frame arena allocators are alive, exiting threads won't return their arenas", MaxFrameArenaInstances);
+                return id;
+            }
+
+            void Unregister(AZ::u32 id)
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+                for (AZ::u32& liveId : m_liveIds)
+                {
+                    if (liveId == id)
+                    {
+                        liveId = 0;
+                    }
+                }
+            }
+
+            // m_mutex must be locked.
+            bool IsLive(AZ::u32 id) const
+            {
+                for (AZ::u32 liveId : m_liveIds)
+                {
+                    if (liveId == id)
+                    {
+                        return true;
+                    }
+                }
+                return false;
+            }
+        };
+
+    }
+
+    // The arenas a thread uses, one per live allocator. Destroyed when the thread exits, which hands the arenas back.
+    struct FrameArenaAllocator::ThreadCache
+    {
+        struct Entry
+        {
+            AZ::u32 m_instanceId = 0;
+            FrameArenaAllocator* m_allocator = nullptr;
+            ThreadArena* m_arena = nullptr;
+        };
+        Entry m_entries[Internal::MaxFrameArenaInstances];
+
+        ~ThreadCache()
+        {
+            // The registry lock is held throughout so an allocator can't be destroyed while its arena is released.
+            Internal::FrameArenaInstanceRegistry& registry = Internal::FrameArenaInstanceRegistry::Get();
+            AZStd::lock_guard<AZStd::mutex> lock(registry.m_mutex);
+            for (Entry& entry : m_entries)
+            {
+                if (entry.m_arena && registry.IsLive(entry.m_instanceId))
+                {
+                    entry.m_allocator->ReleaseThreadArena(*entry.m_arena);
+                }
+            }
+        }
+    };
+
+    //=========================================================================
+    // FrameArenaAllocator
+    //=========================================================================
+    FrameArenaAllocator::FrameArenaAllocator()
+        : AllocatorBase(this, "FrameArenaAllocator", "Per-thread bump allocator for memory that only lives until the end of the frame")
+    {
+        DisableOverriding();
+    }
+
+    //=========================================================================
+    // ~FrameArenaAllocator
+    //=========================================================================
+    FrameArenaAllocator::~FrameArenaAllocator()
+    {
+    }
+
+    //=========================================================================
+    // Create
+    //=========================================================================
+    bool FrameArenaAllocator::Create(const Descriptor& desc)
+    {
+        AZ_Assert(desc.m_chunkSize > sizeof(Chunk), "Frame arena chunk size %zu is too small", desc.m_chunkSize);
+        m_subAllocator = desc.m_subAllocator ? desc.m_subAllocator : &AllocatorInstance<SystemAllocator>::Get();
+        m_chunkSize = desc.m_chunkSize;
+        m_poisonMemory = desc.m_poisonMemory;
+        m_frameIndex = 1;
+        m_capacity = 0;
+        m_arenas = nullptr;
+        m_instanceId = Internal::FrameArenaInstanceRegistry::Get().Register();
+        return true;
+    }
+
+    //=========================================================================
+    // Destroy
+    //=========================================================================
+    void FrameArenaAllocator::Destroy()
+    {
+        // Unregister first so exiting threads no longer touch the arenas.
+        Internal::FrameArenaInstanceRegistry::Get().Unregister(m_instanceId);
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_arenasMutex);
+        while (m_arenas)
+        {
+            ThreadArena* arena = m_arenas;
+            m_arenas = arena->m_next;
+            FreeArena(arena);
+        }
+        AZ_Assert(m_capacity == 0, "Frame arena chunks were leaked");
+    }
+
+    //=========================================================================
+    // GetDebugConfig
+    //=========================================================================
+    AllocatorDebugConfig FrameArenaAllocator::GetDebugConfig()
+    {
+        // Allocations are never individually freed, tracking them would report every frame allocation as a leak.
+        return AllocatorDebugConfig().ExcludeFromDebugging();
+    }
+
+    //=========================================================================
+    // ResetFrame
+    //=========================================================================
+    void FrameArenaAllocator::ResetFrame()
+    {
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_arenasMutex);
+            ThreadArena** link = &m_arenas;
+            while (ThreadArena* arena = *link)
+            {
+                if (arena->m_threadExited)
+                {
+                    // The memory of an exited thread stays valid until the end of the frame it was allocated in.
+                    *link = arena->m_next;
+                    FreeArena(arena);
+                    continue;
+                }
+                // Arenas of live threads are poisoned and rewound by their owners, which may still be allocating
+                link = &arena->m_next;
+            }
+        }
+        m_frameIndex.fetch_add(1, AZStd::memory_order_acq_rel);
+    }
+
+    //=========================================================================
+    // GetThreadArena
+    //=========================================================================
+    FrameArenaAllocator::ThreadArena* FrameArenaAllocator::GetThreadArena()
+    {
+        static thread_local ThreadCache s_threadCache;
+        for (const ThreadCache::Entry& entry : s_threadCache.m_entries)
+        {
+            if (entry.m_instanceId == m_instanceId)
+            {
+                return entry.m_arena;
+            }
+        }
+
+        const AZStd::thread_id threadId = AZStd::this_thread::get_id();
+        ThreadArena* result = nullptr;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_arenasMutex);
+            for (ThreadArena* arena = m_arenas; arena; arena = arena->m_next)
+            {
+                if (arena->m_owner == threadId && !arena->m_threadExited)
+                {
+                    result = arena;
+                    break;
+                }
+            }
+
+            if (!result)
+            {
+                void* memory = m_subAllocator->Allocate(sizeof(ThreadArena), alignof(ThreadArena), 0, "FrameArenaAllocator::ThreadArena", __FILE__, __LINE__);
+                result = new (memory) ThreadArena;
+                result->m_owner = threadId;
+                result->m_next = m_arenas;
+                m_arenas = result;
+            }
+        }
+
+        // Reuse an entry of an allocator that has been destroyed. Without a free entry the arena isn't cached, so it's
+        // looked up again on every allocation and only freed when the allocator is destroyed.
+        Internal::FrameArenaInstanceRegistry& registry = Internal::FrameArenaInstanceRegistry::Get();
+        AZStd::lock_guard<AZStd::mutex> lock(registry.m_mutex);
+        for (ThreadCache::Entry& entry : s_threadCache.m_entries)
+        {
+            if (!entry.m_arena || !registry.IsLive(entry.m_instanceId))
+            {
+                entry.m_instanceId = m_instanceId;
+                entry.m_allocator = this;
+                entry.m_arena = result;
+                break;
+            }
+        }
+        return result;
+    }
+
+    //=========================================================================
+    // RewindArena
+    //=========================================================================
+    void FrameArenaAllocator::RewindArena(ThreadArena& arena, AZ::u64 frameIndex)
+    {
+        if (arena.m_currentChunk)
+        {
+            if (m_poisonMemory)
+            {
+                PoisonArena(arena);
+            }
+
+            // Chunks that weren't needed during the last frame are returned, the rest is kept for the next frame.
+            Chunk* chunk = arena.m_currentChunk->m_next;
+            arena.m_currentChunk->m_next = nullptr;
+            while (chunk)
+            {
+                Chunk* next = chunk->m_next;
+                FreeChunk(chunk);
+                chunk = next;
+            }
+
+            arena.m_currentChunk = arena.m_firstChunk;
+            arena.m_cursor = arena.m_firstChunk->GetData();
+            arena.m_end = arena.m_firstChunk->GetDataEnd();
+        }
+        arena.m_lastAllocation = nullptr;
+        arena.m_allocatedBytes.store(0, AZStd::memory_order_relaxed);
+        arena.m_frameIndex.store(frameIndex, AZStd::memory_order_relaxed);
+    }
+
+    //=========================================================================
+    // PoisonArena
+    //=========================================================================
+    void FrameArenaAllocator::PoisonArena(ThreadArena& arena)
+    {
+        if (arena.m_currentChunk)
+        {
+            for (Chunk* chunk = arena.m_firstChunk; chunk != arena.m_currentChunk; chunk = chunk->m_next)
+            {
+                memset(chunk->GetData(), PoisonPattern, chunk->m_size);
+            }
+            memset(arena.m_currentChunk->GetData(), PoisonPattern, arena.m_cursor - arena.m_currentChunk->GetData());
+        }
+    }
+
+    //=========================================================================
+    // ReleaseThreadArena
+    //=========================================================================
+    void FrameArenaAllocator::ReleaseThreadArena(ThreadArena& arena)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_arenasMutex);
+        if (arena.m_frameIndex.load(AZStd::memory_order_relaxed) == m_frameIndex.load(AZStd::memory_order_acquire))
+        {
+            // Other threads may still use what the exiting thread allocated this frame, ResetFrame frees the arena.
+            arena.m_threadExited = true;
+            return;
+        }
+
+        for (ThreadArena** link = &m_arenas; *link; link = &(*link)->m_next)
+        {
+            if (*link == &arena)
+            {
+                *link = arena.m_next;
+                break;
+            }
+        }
+        FreeArena(&arena);
+    }
+
+    //=========================================================================
+    // FreeArena
+    //=========================================================================
+    void FrameArenaAllocator::FreeArena(ThreadArena* arena)
+    {
+        Chunk* chunk = arena->m_firstChunk;
+        while (chunk)
+        {
+            Chunk* next = chunk->m_next;
+            FreeChunk(chunk);
+            chunk = next;
+        }
+
+        arena->~ThreadArena();
+        m_subAllocator->DeAllocate(arena, sizeof(ThreadArena), alignof(ThreadArena));
+    }
+
+    //=========================================================================
+    // AllocateChunk
+    //=========================================================================
+    FrameArenaAllocator::Chunk* FrameArenaAllocator::AllocateChunk(size_t minSize)
+    {
+        const size_t byteSize = AZ::GetMax(m_chunkSize, minSize + sizeof(Chunk));
+        void* memory = m_subAllocator->Allocate(byteSize, alignof(Chunk), 0, "FrameArenaAllocator::Chunk", __FILE__, __LINE__);
+        if (!memory)
+        {
+            return nullptr;
+        }
+        m_capacity.fetch_add(byteSize, AZStd::memory_order_relaxed);
+
+        Chunk* chunk = reinterpret_cast<Chunk*>(memory);
+        chunk->m_next = nullptr;
+        chunk->m_size = byteSize - sizeof(Chunk);
+        return chunk;
+    }
+
+    //=========================================================================
+    // FreeChunk
+    //=========================================================================
+    void FrameArenaAllocator::FreeChunk(Chunk* chunk)
+    {
+        const size_t byteSize = chunk->m_size + sizeof(Chunk);
+        m_capacity.fetch_sub(byteSize, AZStd::memory_order_relaxed);
+        m_subAllocator->DeAllocate(chunk, byteSize, alignof(Chunk));
+    }
+
+    //=========================================================================
+    // Allocate
+    //=========================================================================
+    FrameArenaAllocator::pointer_type
+    FrameArenaAllocator::Allocate(size_type byteSize, size_type alignment, int flags, const char* name, const char* fileName, int lineNum, unsigned int suppressStackRecord)
+    {
+        (void)suppressStackRecord;
+        alignment = alignment > 0 ? alignment : 1;
+        AZ_Assert((alignment & (alignment - 1)) == 0, "Alignment must be a power of 2!");
+
+        ThreadArena* arena = GetThreadArena();
+        const AZ::u64 frameIndex = m_frameIndex.load(AZStd::memory_order_acquire);
+        if (arena->m_frameIndex.load(AZStd::memory_order_relaxed) != frameIndex)
+        {
+            RewindArena(*arena, frameIndex);
+        }
+
+        char* address = reinterpret_cast<char*>(AZ::PointerAlignUp(arena->m_cursor, alignment));
+        if (!arena->m_cursor || address + byteSize > arena->m_end)
+        {
+            // Move on to the next chunk, reusing the one kept from a previous frame if it's big enough.
+            Chunk* next = arena->m_currentChunk ? arena->m_currentChunk->m_next : nullptr;
+            if (!next || next->m_size < byteSize + alignment)
+            {
+                Chunk* chunk = AllocateChunk(byteSize + alignment);
+                if (!chunk)
+                {
+                    OnOutOfMemory(byteSize, alignment, flags, name, fileName, lineNum);
+                    return nullptr;
+                }
+                if (arena->m_currentChunk)
+                {
+                    chunk->m_next = arena->m_currentChunk->m_next;
+                    arena->m_currentChunk->m_next = chunk;
+                }
+                else
+                {
+                    arena->m_firstChunk = chunk;
+                }
+                next = chunk;
+            }
+            arena->m_currentChunk = next;
+            arena->m_end = next->GetDataEnd();
+            address = reinterpret_cast<char*>(AZ::PointerAlignUp(next->GetData(), alignment));
+        }
+
+        arena->m_cursor = address + byteSize;
+        arena->m_lastAllocation = address;
+        arena->m_allocatedBytes.store(arena->m_allocatedBytes.load(AZStd::memory_order_relaxed) + byteSize, AZStd::memory_order_relaxed);
+        return address;
+    }
+
+    //=========================================================================
+    // DeAllocate
+    //=========================================================================
+    void FrameArenaAllocator::DeAllocate(pointer_type ptr, size_type byteSize, size_type alignment)
+    {
+        (void)byteSize;
+        (void)alignment;
+        if (!ptr)
+        {
+            return;
+        }
+
+        // Memory is reclaimed when the frame is reset, except for the most recent allocation of this thread
+        // which can simply be popped off the arena.
+        ThreadArena* arena = GetThreadArena();
+        if (ptr == arena->m_lastAllocation && arena->m_frameIndex.load(AZStd::memory_order_relaxed) == m_frameIndex.load(AZStd::memory_order_acquire))
+        {
+            const size_t size = arena->m_cursor - arena->m_lastAllocation;
+            if (m_poisonMemory)
+            {
+                memset(ptr, PoisonPattern, size);
+            }
+            arena->m_cursor = arena->m_lastAllocation;
+            arena->m_lastAllocation = nullptr;
+            arena->m_allocatedBytes.store(arena->m_allocatedBytes.load(AZStd::memory_order_relaxed) - size, AZStd::memory_order_relaxed);
+        }
+    }
+
+    //=========================================================================
+    // Resize
+    //=========================================================================
+    FrameArenaAllocator::size_type FrameArenaAllocator::Resize(pointer_type ptr, size_type newSize)
+    {
+        // Only the most recent allocation of this thread can be resized, by moving the arena cursor.
+        ThreadArena* arena = GetThreadArena();
+        if (ptr && ptr == arena->m_lastAllocation && arena->m_frameIndex.load(AZStd::memory_order_relaxed) == m_frameIndex.load(AZStd::memory_order_acquire))
+        {
+            char* newCursor = arena->m_lastAllocation + newSize;
+            if (newCursor <= arena->m_end)
+            {
+                const size_t oldSize = arena->m_cursor - arena->m_lastAllocation;
+                arena->m_cursor = newCursor;
+                arena->m_allocatedBytes.store(arena->m_allocatedBytes.load(AZStd::memory_order_relaxed) - oldSize + newSize, AZStd::memory_order_relaxed);
+                return newSize;
+            }
+        }
+        return 0;
+    }
+
+    //=========================================================================
+    // ReAllocate
+    //=========================================================================
+    FrameArenaAllocator::pointer_type FrameArenaAllocator::ReAllocate(pointer_type ptr, size_type newSize, size_type newAlignment)
+    {
+        (void)ptr;
+        (void)newSize;
+        (void)newAlignment;
+        return nullptr;
+    }
+
+    //=========================================================================
+    // NumAllocatedBytes
+    //=========================================================================
+    FrameArenaAllocator::size_type FrameArenaAllocator::NumAllocatedBytes() const
+    {
+        const AZ::u64 frameIndex = m_frameIndex.load(AZStd::memory_order_acquire);
+        size_type numAllocatedBytes = 0;
+        AZStd::lock_guard<AZStd::mutex> lock(m_arenasMutex);
+        for (ThreadArena* arena = m_arenas; arena; arena = arena->m_next)
+        {
+            // Arenas that haven't allocated since the last reset hold no live memory.
+            if (arena->m_frameIndex.load(AZStd::memory_order_relaxed) == frameIndex)
+            {
+                numAllocatedBytes += arena->m_allocatedBytes.load(AZStd::memory_order_relaxed);
+            }
+        }
+        return numAllocatedBytes;
+    }
+
+    //=========================================================================
+    // GetMaxAllocationSize
+    //=========================================================================
+    FrameArenaAllocator::size_type FrameArenaAllocator::GetMaxAllocationSize() const
+    {
+        return m_subAllocator ? m_subAllocator->GetMaxAllocationSize() - sizeof(Chunk) : 0;
+    }
+}
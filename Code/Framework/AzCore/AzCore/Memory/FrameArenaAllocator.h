@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/std/allocator.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace AZ
+{
+    /**
+     * Frame arena allocator. Every thread bumps a pointer through its own list of chunks, so an allocation is a
+     * pointer increment without any locking. Deallocation is a no-op: all memory handed out during a frame is
+     * reclaimed at once when the frame is reset (ComponentApplication::Tick does this at the start of every tick).
+     * Memory from this allocator must not be kept alive past the frame it was allocated in.
+     *
+     * Threads rewind their arena lazily, on their first allocation after a reset. When poisoning is enabled that is also
+     * when a thread fills the memory of its previous frame with FrameArenaAllocator::PoisonPattern, so use-after-frame bugs
+     * are easy to spot. ResetFrame never touches the arena of a live thread, it only frees the arenas of threads that exited.
+     * At most FrameArenaAllocator::MaxInstances allocators may be alive at once.
+     */
+    class FrameArenaAllocator
+        : public AllocatorBase
+        , public IAllocatorAllocate
+    {
+    public:
+        AZ_TYPE_INFO(FrameArenaAllocator, "{6B0C3D5E-8A1F-4E27-9C4B-2F7D9E1A5B60}")
+
+        static constexpr unsigned char PoisonPattern = 0xFA;
+        static constexpr size_t MaxInstances = 16;
+
+        FrameArenaAllocator();
+        ~FrameArenaAllocator() override;
+
+        struct Descriptor
+        {
+            size_t              m_chunkSize = 64 * 1024;    ///< Size of a chunk of arena memory. Allocations larger than this get a chunk of their own.
+#if defined(AZ_DEBUG_BUILD)
+            bool                m_poisonMemory = true;      ///< Fill memory with PoisonPattern when a frame is reset.
+#else
+            bool                m_poisonMemory = false;     ///< Fill memory with PoisonPattern when a frame is reset.
+#endif
+            IAllocatorAllocate* m_subAllocator = nullptr;   ///< Allocator the chunks are taken from. If NULL the SystemAllocator is used.
+        };
+
+        bool Create(const Descriptor& desc);
+
+        void Destroy() override;
+
+        /// Ends the current frame. Every allocation made before this call becomes invalid.
+        /// Callers must make sure no thread is using this allocator or frame memory when this is called.
+        void ResetFrame();
+
+        /// Returns the number of the current frame, which is incremented by ResetFrame.
+        AZ::u64 GetFrameIndex() const { return m_frameIndex.load(AZStd::memory_order_relaxed); }
+
+        //////////////////////////////////////////////////////////////////////////
+        // IAllocator
+        AllocatorDebugConfig GetDebugConfig() override;
+
+        //////////////////////////////////////////////////////////////////////////
+        // IAllocatorAllocate
+        pointer_type    Allocate(size_type byteSize, size_type alignment, int flags = 0, const char* name = 0, const char* fileName = 0, int lineNum = 0, unsigned int suppressStackRecord = 0) override;
+        void            DeAllocate(pointer_type ptr, size_type byteSize = 0, size_type alignment = 0) override;
+        size_type       Resize(pointer_type ptr, size_type newSize) override;
+        pointer_type    ReAllocate(pointer_type ptr, size_type newSize, size_type newAlignment) override;
+        size_type       AllocationSize(pointer_type ptr) override { (void)ptr; return 0; }
+
+        size_type       NumAllocatedBytes() const override;
+        size_type       Capacity() const override                { return m_capacity.load(AZStd::memory_order_relaxed); }
+        size_type       GetMaxAllocationSize() const override;
+        IAllocatorAllocate*  GetSubAllocator() override          { return m_subAllocator; }
+
+    protected:
+        FrameArenaAllocator(const FrameArenaAllocator&);
+        FrameArenaAllocator& operator=(const FrameArenaAllocator&);
+
+        struct Chunk;
+        struct ThreadArena;
+        struct ThreadCache;
+
+        ThreadArena* GetThreadArena();
+        void RewindArena(ThreadArena& arena, AZ::u64 frameIndex);
+        void PoisonArena(ThreadArena& arena);
+        void ReleaseThreadArena(ThreadArena& arena);
+        void FreeArena(ThreadArena* arena);
+        Chunk* AllocateChunk(size_t minSize);
+        void FreeChunk(Chunk* chunk);
+
+        IAllocatorAllocate*         m_subAllocator = nullptr;
+        size_t                      m_chunkSize = 0;
+        bool                        m_poisonMemory = false;
+        AZ::u32                     m_instanceId = 0;
+        AZStd::atomic<AZ::u64>      m_frameIndex{ 0 };
+        AZStd::atomic<size_t>       m_capacity{ 0 };
+        mutable AZStd::mutex        m_arenasMutex;
+        ThreadArena*                m_arenas = nullptr;     ///< All thread arenas of this allocator, protected by m_arenasMutex.
+    };
+
+    typedef AZStdAlloc<FrameArenaAllocator> FrameArenaStdAllocator;
+}
@@ -11,6 +11,7 @@
 
 #include <AzCore/Math/Random.h>
 #include <AzCore/Memory/OSAllocator.h> // required by certain platforms
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/lock.h>
 #include <AzCore/std/containers/intrusive_set.h>
@@ -468,6 +469,48 @@ namespace AZ {
         size_t bucket_get_unused_memory(bool isPrint) const;
         void bucket_purge();
 
+#ifdef MULTITHREADED
+        // Per-thread cache of free small blocks. Each thread keeps a short free list per bucket ("magazine") so most
+        // small allocations and frees don't need to take the bucket lock. Magazines are refilled from and returned to
+        // the shared buckets in batches. Blocks in a cache are still accounted as allocated by the buckets.
+        struct thread_cache
+        {
+            AZStd::atomic<HpAllocator*> mOwner{ nullptr };
+            thread_cache* mPrevInOwner = nullptr;
+            thread_cache* mNextInOwner = nullptr;
+            AZStd::atomic<size_t> mCachedSize{ 0 };
+            free_link* mFreeList[NUM_BUCKETS] = {};
+            unsigned short mCount[NUM_BUCKETS] = {};
+        };
+        // A thread can cache blocks for this many allocators at the same time, other allocators use the buckets directly.
+        static const unsigned MAX_THREAD_CACHES = 4;
+        struct thread_cache_set
+        {
+            thread_cache mCaches[MAX_THREAD_CACHES];
+            ~thread_cache_set();
+        };
+        static thread_local thread_cache_set sThreadCaches;
+        // Set once the thread's caches have been destroyed, so allocations made by other thread_local destructors
+        // afterwards go straight to the buckets. This is trivially destructible so it stays valid until the thread ends.
+        static AZ_THREAD_LOCAL bool sThreadCachesDestroyed;
+
+        thread_cache* thread_cache_get();
+        void* thread_cache_alloc(thread_cache& cache, unsigned bi);
+        void thread_cache_free(thread_cache& cache, void* ptr, unsigned bi);
+        void thread_cache_refill(thread_cache& cache, unsigned bi);
+        void thread_cache_flush(thread_cache& cache, unsigned bi, unsigned count);
+        void thread_cache_release(thread_cache& cache); // requires the registry lock
+        void thread_cache_release_current();
+        void thread_cache_release_all();
+        size_t thread_cache_size() const;
+        // Guards the cache lists and cache ownership of all allocators. It's shared rather than per allocator because an
+        // exiting thread has to find out whether the owner of its cache still exists before it can lock anything in it.
+        static AZStd::mutex& thread_cache_registry_mutex();
+
+        unsigned mThreadCacheSize = 0;
+        thread_cache* mThreadCaches = nullptr; // all caches registered for this allocator, guarded by the registry lock
+#endif
+
         // locate the page information from a pointer
         inline page* ptr_get_page(void* ptr) const
         {
@@ -1047,6 +1090,10 @@ namespace AZ {
         // in all cases memory is never automatically returned to the OS
         void purge()
         {
+#ifdef MULTITHREADED
+            // Blocks cached by other threads keep their pages alive; only the calling thread's cache can be released safely.
+            thread_cache_release_current();
+#endif
             // Purge buckets first since they use tree pages
             bucket_purge();
             tree_purge();
@@ -1063,6 +1110,12 @@ namespace AZ {
         // return the total number of allocated memory
         inline  size_t allocated() const
         {
+#ifdef MULTITHREADED
+            if (mThreadCacheSize)
+            {
+                return mTotalAllocatedSizeBuckets + mTotalAllocatedSizeTree - thread_cache_size();
+            }
+#endif
             return mTotalAllocatedSizeBuckets + mTotalAllocatedSizeTree;
         }
 
@@ -1150,6 +1203,10 @@ namespace AZ {
         m_fixedBlock = desc.m_fixedMemoryBlock;
         m_fixedBlockSize = desc.m_fixedMemoryBlockByteSize;
         m_isPoolAllocations = desc.m_isPoolAllocations;
+#ifdef MULTITHREADED
+        // The cache count has to fit in the per bucket counters, keep room for the element that triggers a flush.
+        mThreadCacheSize = m_isPoolAllocations ? AZStd::GetMin(desc.m_threadCacheSize, static_cast<unsigned>(USHRT_MAX - 1)) : 0;
+#endif
         if (desc.m_fixedMemoryBlock)
         {
             block_header* bl = tree_add_block(m_fixedBlock, m_fixedBlockSize);
@@ -1180,7 +1237,10 @@ namespace AZ {
         report();
         check();
 #endif
-        
+
+#ifdef MULTITHREADED
+        thread_cache_release_all();
+#endif
         purge();
 
 #ifdef DEBUG_ALLOCATOR 
@@ -1343,35 +1403,20 @@ namespace AZ {
         HPPA_ASSERT(size <= MAX_SMALL_ALLOCATION);
         unsigned bi = bucket_spacing_function(size);
         HPPA_ASSERT(bi < NUM_BUCKETS);
-#ifdef MULTITHREADED
-    #if defined (USE_MUTEX_PER_BUCKET)
-        AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
-    #else
-        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
-    #endif
-#endif
-        // get the page info and check if there's any available elements
-        page* p = mBuckets[bi].get_free_page();
-        if (!p)
-        {
-            // get a page from the OS, initialize it and add it to the list
-            size_t bsize = bucket_spacing_function_inverse(bi);
-            p = bucket_grow(bsize, mBuckets[bi].marker());
-            if (!p)
-            {
-                return NULL;
-            }
-            mBuckets[bi].add_free_page(p);
-        }
-        HPPA_ASSERT(p->elem_size() >= size);
-        mTotalAllocatedSizeBuckets += p->elem_size();
-        return mBuckets[bi].alloc(p);
+        return bucket_alloc_direct(bi);
     }
 
     void* HpAllocator::bucket_alloc_direct(unsigned bi)
     {
         HPPA_ASSERT(bi < NUM_BUCKETS);
 #ifdef MULTITHREADED
+        if (mThreadCacheSize)
+        {
+            if (thread_cache* cache = thread_cache_get())
+            {
+                return thread_cache_alloc(*cache, bi);
+            }
+        }
     #if defined (USE_MUTEX_PER_BUCKET)
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
     #else
@@ -1439,6 +1484,14 @@ namespace AZ {
         unsigned bi = p->bucket_index();
         HPPA_ASSERT(bi < NUM_BUCKETS);
 #ifdef MULTITHREADED
+        if (mThreadCacheSize)
+        {
+            if (thread_cache* cache = thread_cache_get())
+            {
+                thread_cache_free(*cache, ptr, bi);
+                return;
+            }
+        }
     #if defined (USE_MUTEX_PER_BUCKET)
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
     #else
@@ -1457,6 +1510,14 @@ namespace AZ {
         // most likely a class needs a base virtual destructor
         HPPA_ASSERT(bi == p->bucket_index());
 #ifdef MULTITHREADED
+        if (mThreadCacheSize)
+        {
+            if (thread_cache* cache = thread_cache_get())
+            {
+                thread_cache_free(*cache, ptr, bi);
+                return;
+            }
+        }
     #if defined (USE_MUTEX_PER_BUCKET)
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
     #else
@@ -1538,6 +1599,231 @@ namespace AZ {
         return unusedMemory;
     }
 
+#ifdef MULTITHREADED
+    thread_local HpAllocator::thread_cache_set HpAllocator::sThreadCaches;
+    AZ_THREAD_LOCAL bool HpAllocator::sThreadCachesDestroyed = false;
+
+    AZStd::mutex& HpAllocator::thread_cache_registry_mutex()
+    {
+        // Never destroyed, threads can exit after static destruction has started.
+        alignas(AZStd::mutex) static unsigned char storage[sizeof(AZStd::mutex)];
+        static AZStd::mutex* mutex = new (storage) AZStd::mutex();
+        return *mutex;
+    }
+
+    HpAllocator::thread_cache_set::~thread_cache_set()
+    {
+        // Return the cached blocks of an exiting thread to their allocators. The owner is read under the registry lock so
+        // an allocator that's being destroyed either detaches the cache first or waits until it has been returned.
+        sThreadCachesDestroyed = true;
+        AZStd::lock_guard<AZStd::mutex> lock(thread_cache_registry_mutex());
+        for (thread_cache& cache : mCaches)
+        {
+            if (HpAllocator* owner = cache.mOwner.load(AZStd::memory_order_acquire))
+            {
+                owner->thread_cache_release(cache);
+            }
+        }
+    }
+
+    HpAllocator::thread_cache* HpAllocator::thread_cache_get()
+    {
+        if (sThreadCachesDestroyed)
+        {
+            return nullptr;
+        }
+
+        thread_cache* freeCache = nullptr;
+        for (thread_cache& cache : sThreadCaches.mCaches)
+        {
+            HpAllocator* owner = cache.mOwner.load(AZStd::memory_order_relaxed);
+            if (owner == this)
+            {
+                return &cache;
+            }
+            if (!owner && !freeCache)
+            {
+                freeCache = &cache;
+            }
+        }
+
+        if (freeCache)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(thread_cache_registry_mutex());
+            freeCache->mPrevInOwner = nullptr;
+            freeCache->mNextInOwner = mThreadCaches;
+            if (mThreadCaches)
+            {
+                mThreadCaches->mPrevInOwner = freeCache;
+            }
+            mThreadCaches = freeCache;
+            freeCache->mOwner.store(this, AZStd::memory_order_release);
+        }
+        return freeCache;
+    }
+
+    void* HpAllocator::thread_cache_alloc(thread_cache& cache, unsigned bi)
+    {
+        free_link* link = cache.mFreeList[bi];
+        if (!link)
+        {
+            thread_cache_refill(cache, bi);
+            link = cache.mFreeList[bi];
+            if (!link)
+            {
+                return nullptr;
+            }
+        }
+        cache.mFreeList[bi] = link->mNext;
+        cache.mCount[bi]--;
+        // Only the owning thread writes the cached size, other threads only read it for statistics.
+        cache.mCachedSize.store(cache.mCachedSize.load(AZStd::memory_order_relaxed) - bucket_spacing_function_inverse(bi), AZStd::memory_order_relaxed);
+        return link;
+    }
+
+    void HpAllocator::thread_cache_free(thread_cache& cache, void* ptr, unsigned bi)
+    {
+        free_link* link = static_cast<free_link*>(ptr);
+        link->mNext = cache.mFreeList[bi];
+        cache.mFreeList[bi] = link;
+        cache.mCount[bi]++;
+        cache.mCachedSize.store(cache.mCachedSize.load(AZStd::memory_order_relaxed) + bucket_spacing_function_inverse(bi), AZStd::memory_order_relaxed);
+        if (cache.mCount[bi] > mThreadCacheSize)
+        {
+            // Keep half of the cache so alternating allocs and frees don't hit the bucket lock every time.
+            thread_cache_flush(cache, bi, cache.mCount[bi] - mThreadCacheSize / 2);
+        }
+    }
+
+    void HpAllocator::thread_cache_refill(thread_cache& cache, unsigned bi)
+    {
+        const unsigned batchSize = AZStd::GetMax(mThreadCacheSize / 2, 1u);
+        const size_t elemSize = bucket_spacing_function_inverse(bi);
+        size_t cachedSize = 0;
+        {
+#if defined (USE_MUTEX_PER_BUCKET)
+            AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
+#else
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+#endif
+            for (unsigned i = 0; i < batchSize; ++i)
+            {
+                page* p = mBuckets[bi].get_free_page();
+                if (!p)
+                {
+                    p = bucket_grow(elemSize, mBuckets[bi].marker());
+                    if (!p)
+                    {
+                        break;
+                    }
+                    mBuckets[bi].add_free_page(p);
+                }
+                mTotalAllocatedSizeBuckets += p->elem_size();
+                free_link* link = static_cast<free_link*>(mBuckets[bi].alloc(p));
+                link->mNext = cache.mFreeList[bi];
+                cache.mFreeList[bi] = link;
+                cache.mCount[bi]++;
+                cachedSize += elemSize;
+            }
+        }
+        cache.mCachedSize.store(cache.mCachedSize.load(AZStd::memory_order_relaxed) + cachedSize, AZStd::memory_order_relaxed);
+    }
+
+    void HpAllocator::thread_cache_flush(thread_cache& cache, unsigned bi, unsigned count)
+    {
+        HPPA_ASSERT(count <= cache.mCount[bi]);
+        size_t flushedSize = 0;
+        {
+#if defined (USE_MUTEX_PER_BUCKET)
+            AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
+#else
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+#endif
+            for (unsigned i = 0; i < count; ++i)
+            {
+                free_link* link = cache.mFreeList[bi];
+                cache.mFreeList[bi] = link->mNext;
+                page* p = ptr_get_page(link);
+                HPPA_ASSERT(p->bucket_index() == bi);
+                mTotalAllocatedSizeBuckets -= p->elem_size();
+                flushedSize += p->elem_size();
+                mBuckets[bi].free(p, link);
+            }
+        }
+        cache.mCount[bi] -= static_cast<unsigned short>(count);
+        cache.mCachedSize.store(cache.mCachedSize.load(AZStd::memory_order_relaxed) - flushedSize, AZStd::memory_order_relaxed);
+    }
+
+    void HpAllocator::thread_cache_release(thread_cache& cache)
+    {
+        HPPA_ASSERT(cache.mOwner.load(AZStd::memory_order_relaxed) == this);
+        for (unsigned bi = 0; bi < NUM_BUCKETS; ++bi)
+        {
+            if (cache.mCount[bi])
+            {
+                thread_cache_flush(cache, bi, cache.mCount[bi]);
+            }
+        }
+
+        if (cache.mPrevInOwner)
+        {
+            cache.mPrevInOwner->mNextInOwner = cache.mNextInOwner;
+        }
+        else
+        {
+            mThreadCaches = cache.mNextInOwner;
+        }
+        if (cache.mNextInOwner)
+        {
+            cache.mNextInOwner->mPrevInOwner = cache.mPrevInOwner;
+        }
+        cache.mPrevInOwner = nullptr;
+        cache.mNextInOwner = nullptr;
+        cache.mOwner.store(nullptr, AZStd::memory_order_release);
+    }
+
+    void HpAllocator::thread_cache_release_current()
+    {
+        if (sThreadCachesDestroyed)
+        {
+            return;
+        }
+        AZStd::lock_guard<AZStd::mutex> lock(thread_cache_registry_mutex());
+        for (thread_cache& cache : sThreadCaches.mCaches)
+        {
+            if (cache.mOwner.load(AZStd::memory_order_relaxed) == this)
+            {
+                thread_cache_release(cache);
+                return;
+            }
+        }
+    }
+
+    void HpAllocator::thread_cache_release_all()
+    {
+        // Only called on destruction, at which point no other thread is allowed to use this allocator, so the caches
+        // of other threads can be returned as well. This also detaches them so a thread that exits later won't try to
+        // return its blocks to a destroyed allocator. The registry lock is held throughout so a thread that exits
+        // meanwhile can't free its caches while they're being returned.
+        AZStd::lock_guard<AZStd::mutex> lock(thread_cache_registry_mutex());
+        while (mThreadCaches)
+        {
+            thread_cache_release(*mThreadCaches);
+        }
+    }
+
+    size_t HpAllocator::thread_cache_size() const
+    {
+        size_t size = 0;
+        AZStd::lock_guard<AZStd::mutex> lock(thread_cache_registry_mutex());
+        for (const thread_cache* cache = mThreadCaches; cache; cache = cache->mNextInOwner)
+        {
+            size += cache->mCachedSize.load(AZStd::memory_order_relaxed);
+        }
+        return size;
+    }
+#endif // MULTITHREADED
+
     void HpAllocator::bucket_purge()
     {
         for (unsigned i = 0; i < NUM_BUCKETS; i++)
@@ -119,6 +119,7 @@ SystemAllocator::Create(const Descriptor& desc)
         heapDesc.m_isPoolAllocations = desc.m_heap.m_isPoolAllocations;
         // Fix SystemAllocator from growing in small chunks
         heapDesc.m_systemChunkSize = desc.m_heap.m_systemChunkSize;
+        heapDesc.m_threadCacheSize = desc.m_heap.m_threadCacheSize;
 #elif AZCORE_SYSTEM_ALLOCATOR == AZCORE_SYSTEM_ALLOCATOR_MALLOC
         MallocSchema::Descriptor heapDesc;
 #elif AZCORE_SYSTEM_ALLOCATOR == AZCORE_SYSTEM_ALLOCATOR_HEAP
@@ -62,8 +62,10 @@ namespace AZ
                     , m_numFixedMemoryBlocks(0)
                     , m_subAllocator(nullptr)
                     , m_systemChunkSize(0)
+                    , m_threadCacheSize(0)
                 {}
                 static const int        m_defaultPageSize = AZ_TRAIT_OS_DEFAULT_PAGE_SIZE;
+                static const int        m_defaultThreadCacheSize = 32;
                 static const int        m_defaultPoolPageSize = 4 * 1024;
                 static const int        m_memoryBlockAlignment = m_defaultPageSize;
                 static const int        m_maxNumFixedBlocks = 3;
@@ -75,6 +77,7 @@ namespace AZ
                 size_t                  m_fixedMemoryBlocksByteSize[m_maxNumFixedBlocks]; ///< Sizes of different memory blocks (MUST be multiple of m_pageSize), if m_memoryBlock is 0 the block will be allocated for you with the System Allocator.
                 IAllocatorAllocate*     m_subAllocator;                             ///< Allocator that m_memoryBlocks memory was allocated from or should be allocated (if NULL).
                 size_t                  m_systemChunkSize;                          ///< Size of chunk to request from the OS when more memory is needed (defaults to m_pageSize)
+                unsigned int            m_threadCacheSize;                          ///< Number of free small blocks (< 512 bytes) each thread keeps per size class to avoid locking the shared heap. 0 (default) disables the per-thread cache, m_defaultThreadCacheSize is a good starting point. Only used by the HPHA schema.
             }                           m_heap;
             bool                        m_allocationRecords;    ///< True if we want to track memory allocations, otherwise false.
             unsigned char               m_stackRecordLevels;    ///< If stack recording is enabled, how many stack levels to record.
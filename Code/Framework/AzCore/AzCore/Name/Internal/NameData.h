@@ -34,6 +34,16 @@ namespace AZ
             //! Returns the hash part of the name data.
             Hash GetHash() const;
 
+            //! Calculates the hash for the provided name string. This is constexpr so names known at compile time
+            //! can be hashed during compilation. Does not attempt to resolve hash collisions; that is handled
+            //! by the NameDictionary.
+            static constexpr Hash CalcHash(AZStd::string_view name)
+            {
+                // AZStd::hash<AZStd::string_view> returns 64 bits but we want 32 bit hashes for the sake
+                // of network synchronization. So just take the low 32 bits.
+                return static_cast<Hash>(AZStd::hash<AZStd::string_view>()(name) & 0xFFFFFFFF);
+            }
+
         private:
             NameData(AZStd::string&& name, Hash hash);
 
@@ -21,6 +21,35 @@ namespace AZ
     class ScriptDataContext;
     class ReflectContext;
 
+    //! Holds a string together with the hash the NameDictionary uses for it. When a NameLiteral is constructed
+    //! in a constexpr context the hash is calculated at compile time, so creating a Name from it skips hashing
+    //! the string and only has to look up the dictionary. Use AZ_NAME_LITERAL to guarantee compile time hashing.
+    //! The string is not copied, so it must outlive the NameLiteral; string literals are the intended use.
+    class NameLiteral
+    {
+    public:
+        using Hash = Internal::NameData::Hash;
+
+        constexpr explicit NameLiteral(AZStd::string_view name)
+            : m_name(name)
+            , m_hash(Internal::NameData::CalcHash(name))
+        {}
+
+        constexpr AZStd::string_view GetStringView() const
+        {
+            return m_name;
+        }
+
+        constexpr Hash GetHash() const
+        {
+            return m_hash;
+        }
+
+    private:
+        AZStd::string_view m_name;
+        Hash m_hash;
+    };
+
     //! The Name class provides very fast string equality comparison, so that names can be used as IDs without sacrificing performance.
     //! It is a smart pointer to a NameData held in a NameDictionary, where names are tracked, de-duplicated, and ref-counted.
     //!
@@ -54,6 +83,10 @@ namespace AZ
         //! internally held after the call.
         explicit Name(AZStd::string_view name);
 
+        //! Creates an instance of a name from a string with a precomputed hash.
+        //! This avoids hashing the string at runtime; see AZ_NAME_LITERAL.
+        explicit Name(const NameLiteral& name);
+
         //! Creates an instance of a name from a hash.
         //! The hash will be used to find an existing name in the dictionary. If there is no
         //! name with this hash, the resulting name will be empty.
@@ -124,6 +157,15 @@ namespace AZ
 
 } // namespace AZ
 
+//! Creates an AZ::Name from a string literal, with the hash of the string calculated at compile time.
+//! Example: const AZ::Name name = AZ_NAME_LITERAL("diffuseColor");
+#define AZ_NAME_LITERAL(str)                                  \
+    AZ::Name([]()                                             \
+        {                                                     \
+            constexpr AZ::NameLiteral nameLiteral{ str };     \
+            return nameLiteral;                               \
+        }())
+
 namespace AZStd
 {
     template <typename T>
@@ -83,22 +83,25 @@ namespace AZ
     {
         bool leaksDetected = false;
 
-        for (const auto& keyValue : m_dictionary)
+        for (Shard& shard : m_shards)
         {
-            Internal::NameData* nameData = keyValue.second;
-            const int useCount = keyValue.second->m_useCount;
-            const bool hadCollision = keyValue.second->m_hashCollision;
-
-            if (useCount == 0)
+            for (const auto& keyValue : shard.m_dictionary)
             {
-                // Entries that had resolved hash collisions are allowed to remain in the dictionary until shutdown.
-                AZ_Assert(hadCollision, "Only colliding names are allowed to remain in the dictionary");
-                delete nameData;
-            }
-            else
-            {
-                leaksDetected = true;
-                AZ_TracePrintf("NameDictionary", "\tLeaked Name [%3d reference(s)]: hash 0x%08X, '%.*s'\n", useCount, keyValue.first, AZ_STRING_ARG(keyValue.second->GetName()));
+                Internal::NameData* nameData = keyValue.second;
+                const int useCount = keyValue.second->m_useCount;
+                const bool hadCollision = keyValue.second->m_hashCollision;
+
+                if (useCount == 0)
+                {
+                    // Entries that had resolved hash collisions are allowed to remain in the dictionary until shutdown.
+                    AZ_Assert(hadCollision, "Only colliding names are allowed to remain in the dictionary");
+                    delete nameData;
+                }
+                else
+                {
+                    leaksDetected = true;
+                    AZ_TracePrintf("NameDictionary", "\tLeaked Name [%3d reference(s)]: hash 0x%08X, '%.*s'\n", useCount, keyValue.first, AZ_STRING_ARG(keyValue.second->GetName()));
+                }
             }
         }
 
@@ -107,9 +110,10 @@ namespace AZ
 
     Name NameDictionary::FindName(Name::Hash hash) const
     {
-        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
-        auto iter = m_dictionary.find(hash);
-        if (iter != m_dictionary.end())
+        const Shard& shard = GetShard(hash);
+        AZStd::shared_lock<AZStd::shared_mutex> lock(shard.m_sharedMutex);
+        auto iter = shard.m_dictionary.find(hash);
+        if (iter != shard.m_dictionary.end())
         {
             return Name(iter->second);
         }
@@ -118,50 +122,71 @@ namespace AZ
 
     Name NameDictionary::MakeName(AZStd::string_view nameString)
     {
+        return MakeName(nameString, CalcHash(nameString));
+    }
+
+    Name NameDictionary::MakeName(AZStd::string_view nameString, Name::Hash hash)
+    {
+        AZ_Assert(hash == CalcHash(nameString), "Provided hash doesn't match the hash of '%.*s'.", AZ_STRING_ARG(nameString));
+
         // Null strings should return empty.
         if (nameString.empty())
         {
             return Name();
         }
 
-        Name::Hash hash = CalcHash(nameString);
-
         // If we find the same name with the same hash, just return it. 
-        // This path is faster than the loop below because FindName() takes a shared_lock whereas the
+        // This path is faster than the loop below because it only takes a shared_lock on a single shard whereas the
         // loop requires a unique_lock to modify the dictionary.
-        Name name = FindName(hash);
-        if (name.GetStringView() == nameString)
         {
-            return AZStd::move(name);
+            const Shard& shard = GetShard(hash);
+            AZStd::shared_lock<AZStd::shared_mutex> lock(shard.m_sharedMutex);
+            auto iter = shard.m_dictionary.find(hash);
+            if (iter != shard.m_dictionary.end() && iter->second->GetName() == nameString)
+            {
+                return Name(iter->second);
+            }
         }
 
-        // The name doesn't exist in the dictionary, so we have to lock and add it
-        AZStd::unique_lock<AZStd::shared_mutex> lock(m_sharedMutex);
-
-        auto iter = m_dictionary.find(hash);
+        // The name doesn't exist in the dictionary, so we have to lock and add it.
+        // Collision resolution probes consecutive hashes. In the rare case the probe crosses into the next shard the lock
+        // on the current shard is released before the next one is taken. This is safe because the entries that were
+        // passed over are flagged as colliding and therefore never removed, so the probe sequence can't change.
         bool collisionDetected = false;
         while (true)
         {
-            // No existing entry, add a new one and we're done
-            if (iter == m_dictionary.end())
-            {
-                Internal::NameData* nameData = aznew Internal::NameData(nameString, hash);
-                nameData->m_hashCollision = collisionDetected;
-                m_dictionary.emplace(hash, nameData);
-                return Name(nameData);
-            }
-            // Found the desired entry, return it
-            else if (iter->second->GetName() == nameString)
-            {
-                return Name(iter->second);
-            }
-            // Hash collision, try a new hash
-            else
+            const size_t shardIndex = GetShardIndex(hash);
+            Shard& shard = m_shards[shardIndex];
+            AZStd::unique_lock<AZStd::shared_mutex> lock(shard.m_sharedMutex);
+
+            auto iter = shard.m_dictionary.find(hash);
+            while (true)
             {
-                collisionDetected = true;
-                iter->second->m_hashCollision = true; // Make sure the existing entry is flagged as colliding too
-                ++hash;
-                iter = m_dictionary.find(hash);
+                // No existing entry, add a new one and we're done
+                if (iter == shard.m_dictionary.end())
+                {
+                    Internal::NameData* nameData = aznew Internal::NameData(nameString, hash);
+                    nameData->m_hashCollision = collisionDetected;
+                    shard.m_dictionary.emplace(hash, nameData);
+                    return Name(nameData);
+                }
+                // Found the desired entry, return it
+                else if (iter->second->GetName() == nameString)
+                {
+                    return Name(iter->second);
+                }
+                // Hash collision, try a new hash
+                else
+                {
+                    collisionDetected = true;
+                    iter->second->m_hashCollision = true; // Make sure the existing entry is flagged as colliding too
+                    ++hash;
+                    if (GetShardIndex(hash) != shardIndex)
+                    {
+                        break;
+                    }
+                    iter = shard.m_dictionary.find(hash);
+                }
             }
         }
     }
@@ -179,42 +204,55 @@ namespace AZ
         //      the dictionary *again*, this time with hash value 1000. Name objects pointing to the original
         //      entry and Name objects pointing to the new entry will fail comparison operations.
 
+        {
+            Shard& shard = GetShard(hash);
+            AZStd::unique_lock<AZStd::shared_mutex> lock(shard.m_sharedMutex);
 
-        AZStd::unique_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+            auto dictIt = shard.m_dictionary.find(hash);
+            if (dictIt == shard.m_dictionary.end())
+            {
+                // This check is to safeguard around the following scenario
+                // T1, gets into TryReleaseName
+                // T2 gets into MakeName, acquires the lock, returns a new Name that increments the counter
+                // T2 deletes the Name decrements the counter, gets into TryReleaseName
+                // T1 gets the lock, goes to the compare_exchange if and has a counter of 0, deletes
+                // Then T2 continues, gets the lock and crashes because nameData was deleted
+                return;
+            }
 
-        auto dictIt = m_dictionary.find(hash);
-        if (dictIt == m_dictionary.end())
-        {
-            // This check is to safeguard around the following scenario
-            // T1, gets into TryReleaseName
-            // T2 gets into MakeName, acquires the lock, returns a new Name that increments the counter
-            // T2 deletes the Name decrements the counter, gets into TryReleaseName
-            // T1 gets the lock, goes to the compare_exchange if and has a counter of 0, deletes
-            // Then T2 continues, gets the lock and crashes because nameData was deleted
-            return;
-        }
+            Internal::NameData* nameData = dictIt->second;
 
-        Internal::NameData* nameData = dictIt->second;
+            // Check m_hashCollision inside the shard's lock because a new collision could have happened
+            // on another thread before taking the lock.
+            if (nameData->m_hashCollision)
+            {
+                return;
+            }
 
-        // Check m_hashCollision inside the m_sharedMutex because a new collision could have happened
-        // on another thread before taking the lock.
-        if (nameData->m_hashCollision)
-        {
-            return;
+            // We need to check the count again in here in case
+            // someone was trying to get the name on another thread.
+            // Set it to -1 so only this thread will attempt to clean up the
+            // dictionary and delete the name.
+            int32_t expectedRefCount = 0;
+            if (nameData->m_useCount.compare_exchange_strong(expectedRefCount, -1))
+            {
+                shard.m_dictionary.erase(dictIt);
+                delete nameData;
+            }
         }
 
-        // We need to check the count again in here in case
-        // someone was trying to get the name on another thread.
-        // Set it to -1 so only this thread will attempt to clean up the
-        // dictionary and delete the name.
-        int32_t expectedRefCount = 0;
-        if (nameData->m_useCount.compare_exchange_strong(expectedRefCount, -1))
+        ReportStats();
+    }
+
+    size_t NameDictionary::GetEntryCount() const
+    {
+        size_t count = 0;
+        for (const Shard& shard : m_shards)
         {
-            m_dictionary.erase(nameData->GetHash());
-            delete nameData;
+            AZStd::shared_lock<AZStd::shared_mutex> lock(shard.m_sharedMutex);
+            count += shard.m_dictionary.size();
         }
-
-        ReportStats();
+        return count;
     }
 
     void NameDictionary::ReportStats() const
@@ -232,34 +270,45 @@ namespace AZ
             Internal::NameData* longestName = nullptr;
             Internal::NameData* mostRepeatedName = nullptr;
 
-            for (auto& iter : m_dictionary)
+            // Hold all shards while gathering the stats so the entries can't be released while they're being referenced.
+            for (const Shard& shard : m_shards)
             {
-                const size_t nameLength = iter.second->m_name.size();
-                actualStringMemoryUsed += nameLength;
-                potentialStringMemoryUsed += (nameLength * iter.second->m_useCount);
+                shard.m_sharedMutex.lock_shared();
+            }
 
-                if (!longestName || longestName->m_name.size() < nameLength)
+            size_t entryCount = 0;
+            for (const Shard& shard : m_shards)
+            {
+                entryCount += shard.m_dictionary.size();
+                for (auto& iter : shard.m_dictionary)
                 {
-                    longestName = iter.second;
-                }
+                    const size_t nameLength = iter.second->m_name.size();
+                    actualStringMemoryUsed += nameLength;
+                    potentialStringMemoryUsed += (nameLength * iter.second->m_useCount);
 
-                if (!mostRepeatedName)
-                {
-                    mostRepeatedName = iter.second;
-                }
-                else
-                {
-                    const size_t mostIndividualSavings = mostRepeatedName->m_name.size() * (mostRepeatedName->m_useCount - 1);
-                    const size_t currentIndividualSavings = nameLength * (iter.second->m_useCount - 1);
-                    if (currentIndividualSavings > mostIndividualSavings)
+                    if (!longestName || longestName->m_name.size() < nameLength)
+                    {
+                        longestName = iter.second;
+                    }
+
+                    if (!mostRepeatedName)
                     {
                         mostRepeatedName = iter.second;
                     }
+                    else
+                    {
+                        const size_t mostIndividualSavings = mostRepeatedName->m_name.size() * (mostRepeatedName->m_useCount - 1);
+                        const size_t currentIndividualSavings = nameLength * (iter.second->m_useCount - 1);
+                        if (currentIndividualSavings > mostIndividualSavings)
+                        {
+                            mostRepeatedName = iter.second;
+                        }
+                    }
                 }
             }
 
             AZ_TracePrintf("NameDictionary", "NameDictionary Stats\n");
-            AZ_TracePrintf("NameDictionary", "Names:              %d\n", m_dictionary.size());
+            AZ_TracePrintf("NameDictionary", "Names:              %d\n", entryCount);
             AZ_TracePrintf("NameDictionary", "Total chars:        %d\n", actualStringMemoryUsed);
             AZ_TracePrintf("NameDictionary", "Logical chars:      %d\n", potentialStringMemoryUsed);
             AZ_TracePrintf("NameDictionary", "Memory saved:       %d\n", potentialStringMemoryUsed - actualStringMemoryUsed);
@@ -276,6 +325,11 @@ namespace AZ
                 AZ_TracePrintf("NameDictionary", "Most repeated name count:  %d\n", refCount);
             }
 
+            for (const Shard& shard : m_shards)
+            {
+                shard.m_sharedMutex.unlock_shared();
+            }
+
             reportUsage = false;
         }
 
@@ -284,9 +338,6 @@ namespace AZ
 
     Name::Hash NameDictionary::CalcHash(AZStd::string_view name)
     {
-        // AZStd::hash<AZStd::string_view> returns 64 bits but we want 32 bit hashes for the sake
-        // of network synchronization. So just take the low 32 bits.
-        const uint32_t hash = AZStd::hash<AZStd::string_view>()(name) & 0xFFFFFFFF;
-        return hash;
+        return Internal::NameData::CalcHash(name);
     }
 }
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/string/string_view.h>
@@ -43,6 +44,9 @@ namespace AZ
     //! Benchmarks have shown that creating a new Name object can be quite slow when the name doesn't 
     //! already exist in the NameDictionary, but is comparable to creating an AZStd::string for names 
     //! that already exist.
+    //!
+    //! The dictionary is split into shards selected by the upper bits of the hash, each with its own lock,
+    //! so threads creating and releasing different names rarely contend with each other.
     class NameDictionary final
     {
         AZ_CLASS_ALLOCATOR(NameDictionary, AZ::OSAllocator, 0);
@@ -87,11 +91,44 @@ namespace AZ
         
         //////////////////////////////////////////////////////////////////////////
 
+        // Makes a Name from a string for which the hash has already been calculated with CalcHash, for instance
+        // at compile time by NameLiteral.
+        Name MakeName(AZStd::string_view name, Name::Hash hash);
+
         // Calculates a hash for the provided name string.
         // Does not attempt to resolve hash collisions; that is handled elsewhere.
-        Name::Hash CalcHash(AZStd::string_view name);
-                
-        AZStd::unordered_map<Name::Hash, Internal::NameData*> m_dictionary;
-        mutable AZStd::shared_mutex m_sharedMutex;
+        static Name::Hash CalcHash(AZStd::string_view name);
+
+        // Returns the total number of entries across all shards.
+        size_t GetEntryCount() const;
+
+        // The number of shards must be a power of two. The shard is picked from the top bits of the hash so
+        // collision resolution, which increments the hash, stays within the same shard in almost all cases.
+        static constexpr size_t ShardCountBits = 5;
+        static constexpr size_t ShardCount = 1 << ShardCountBits;
+
+        // Aligned to keep the locks of neighboring shards on separate cache lines.
+        struct alignas(64) Shard
+        {
+            AZStd::unordered_map<Name::Hash, Internal::NameData*> m_dictionary;
+            mutable AZStd::shared_mutex m_sharedMutex;
+        };
+
+        static size_t GetShardIndex(Name::Hash hash)
+        {
+            return hash >> (sizeof(Name::Hash) * 8 - ShardCountBits);
+        }
+
+        Shard& GetShard(Name::Hash hash)
+        {
+            return m_shards[GetShardIndex(hash)];
+        }
+
+        const Shard& GetShard(Name::Hash hash) const
+        {
+            return m_shards[GetShardIndex(hash)];
+        }
+
+        AZStd::array<Shard, ShardCount> m_shards;
     };
 }
@@ -87,6 +87,8 @@ namespace AZ
     class JsonDeserializerContext final
         : public JsonBaseContext
     {
+        friend class JsonStreamingDeserializer;
+
     public:
         explicit JsonDeserializerContext(JsonDeserializerSettings& settings);
         ~JsonDeserializerContext() override = default;
@@ -13,6 +13,7 @@
 #include <AzCore/Serialization/Json/JsonMerger.h>
 #include <AzCore/Serialization/Json/JsonSerialization.h>
 #include <AzCore/Serialization/Json/JsonSerializer.h>
+#include <AzCore/Serialization/Json/JsonStreamingDeserializer.h>
 #include <AzCore/Serialization/Json/RegistrationContext.h>
 #include <AzCore/Serialization/Json/StackedString.h>
 #include <AzCore/std/sort.h>
@@ -250,6 +251,70 @@ namespace AZ
         return result;
     }
 
+    JsonSerializationResult::ResultCode JsonSerialization::LoadStreaming(
+        void* object, const Uuid& objectType, AZStd::string_view json, const JsonDeserializerSettings& settings)
+    {
+        // Explicitly make a copy to call the correct overloaded version and avoid infinite recursion on this function.
+        JsonDeserializerSettings settingsCopy{settings};
+        return LoadStreaming(object, objectType, json, settingsCopy);
+    }
+
+    JsonSerializationResult::ResultCode JsonSerialization::LoadStreaming(
+        void* object, const Uuid& objectType, AZStd::string_view json, JsonDeserializerSettings& settings)
+    {
+        using namespace JsonSerializationResult;
+
+        AZStd::string scratchBuffer;
+        auto issueReportingCallback = [&scratchBuffer](AZStd::string_view message, ResultCode result, AZStd::string_view target) -> ResultCode
+        {
+            return JsonSerialization::DefaultIssueReporter(scratchBuffer, message, result, target);
+        };
+        if (!settings.m_reporting)
+        {
+            settings.m_reporting = issueReportingCallback;
+        }
+
+        ResultCode result = JsonSerializationInternal::GetContexts(settings, settings.m_serializeContext, settings.m_registrationContext);
+        if (result.GetOutcome() == Outcomes::Success)
+        {
+            JsonDeserializerContext context(settings);
+            result = JsonStreamingDeserializer::Load(object, objectType, json, context);
+        }
+        return result;
+    }
+
+    JsonSerializationResult::ResultCode JsonSerialization::LoadStreaming(
+        void* object, const Uuid& objectType, IO::GenericStream& stream, const JsonDeserializerSettings& settings)
+    {
+        // Explicitly make a copy to call the correct overloaded version and avoid infinite recursion on this function.
+        JsonDeserializerSettings settingsCopy{settings};
+        return LoadStreaming(object, objectType, stream, settingsCopy);
+    }
+
+    JsonSerializationResult::ResultCode JsonSerialization::LoadStreaming(
+        void* object, const Uuid& objectType, IO::GenericStream& stream, JsonDeserializerSettings& settings)
+    {
+        using namespace JsonSerializationResult;
+
+        AZStd::string scratchBuffer;
+        auto issueReportingCallback = [&scratchBuffer](AZStd::string_view message, ResultCode result, AZStd::string_view target) -> ResultCode
+        {
+            return JsonSerialization::DefaultIssueReporter(scratchBuffer, message, result, target);
+        };
+        if (!settings.m_reporting)
+        {
+            settings.m_reporting = issueReportingCallback;
+        }
+
+        ResultCode result = JsonSerializationInternal::GetContexts(settings, settings.m_serializeContext, settings.m_registrationContext);
+        if (result.GetOutcome() == Outcomes::Success)
+        {
+            JsonDeserializerContext context(settings);
+            result = JsonStreamingDeserializer::Load(object, objectType, stream, context);
+        }
+        return result;
+    }
+
     JsonSerializationResult::ResultCode JsonSerialization::LoadTypeId(
         Uuid& typeId, const rapidjson::Value& input, const Uuid* baseClassTypeId, AZStd::string_view jsonPath,
         const JsonDeserializerSettings& settings)
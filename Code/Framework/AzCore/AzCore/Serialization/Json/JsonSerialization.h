@@ -17,6 +17,11 @@
 
 namespace AZ
 {
+    namespace IO
+    {
+        class GenericStream;
+    }
+
     class BaseJsonSerializer;
     
     enum class JsonMergeApproach
@@ -153,6 +158,60 @@ namespace AZ
         static JsonSerializationResult::ResultCode Load(
             void* object, const Uuid& objectType, const rapidjson::Value& root, JsonDeserializerSettings& settings);
 
+        //! Loads the data from the provided json text into the supplied object without first parsing the text into a document.
+        //! The text is read with a SAX reader and reflected classes, basic containers and maps are filled in as their values are read,
+        //! so only the values that are currently being processed are kept in memory instead of the full document. Values for types
+        //! that can't be loaded piece by piece, such as types with custom serializers or pointers, are briefly collected in a small
+        //! document before they're passed to the regular deserializer. Patches and merges still require the full document and aren't
+        //! supported by this function. Add a JsonStreamingLoadStatistics to the metadata in the settings to collect memory statistics.
+        //! @param object Object where the data will be loaded into.
+        //! @param json The json text to read from.
+        //! @param settings Optional additional settings to control the way document is deserialized.
+        template<typename T>
+        static JsonSerializationResult::ResultCode LoadStreaming(
+            T& object, AZStd::string_view json, const JsonDeserializerSettings& settings = JsonDeserializerSettings{});
+        //! Loads the data from the provided json text into the supplied object without first parsing the text into a document.
+        //! See LoadStreaming above for details.
+        //! @param object Object where the data will be loaded into.
+        //! @param json The json text to read from.
+        //! @param settings Additional settings to control the way document is deserialized.
+        template<typename T>
+        static JsonSerializationResult::ResultCode LoadStreaming(T& object, AZStd::string_view json, JsonDeserializerSettings& settings);
+        //! Loads the data from the provided json text into the supplied object without first parsing the text into a document.
+        //! See LoadStreaming above for details.
+        //! @param object Pointer to the object where the data will be loaded into.
+        //! @param objectType Type id of the object passed in.
+        //! @param json The json text to read from.
+        //! @param settings Optional additional settings to control the way document is deserialized.
+        static JsonSerializationResult::ResultCode LoadStreaming(
+            void* object, const Uuid& objectType, AZStd::string_view json,
+            const JsonDeserializerSettings& settings = JsonDeserializerSettings{});
+        //! Loads the data from the provided json text into the supplied object without first parsing the text into a document.
+        //! See LoadStreaming above for details.
+        //! @param object Pointer to the object where the data will be loaded into.
+        //! @param objectType Type id of the object passed in.
+        //! @param json The json text to read from.
+        //! @param settings Additional settings to control the way document is deserialized.
+        static JsonSerializationResult::ResultCode LoadStreaming(
+            void* object, const Uuid& objectType, AZStd::string_view json, JsonDeserializerSettings& settings);
+        //! Loads the data from the provided stream into the supplied object without first reading the stream into a document.
+        //! The stream is read in small blocks from its current position. See LoadStreaming above for details.
+        //! @param object Pointer to the object where the data will be loaded into.
+        //! @param objectType Type id of the object passed in.
+        //! @param stream The stream containing the json text.
+        //! @param settings Optional additional settings to control the way document is deserialized.
+        static JsonSerializationResult::ResultCode LoadStreaming(
+            void* object, const Uuid& objectType, IO::GenericStream& stream,
+            const JsonDeserializerSettings& settings = JsonDeserializerSettings{});
+        //! Loads the data from the provided stream into the supplied object without first reading the stream into a document.
+        //! The stream is read in small blocks from its current position. See LoadStreaming above for details.
+        //! @param object Pointer to the object where the data will be loaded into.
+        //! @param objectType Type id of the object passed in.
+        //! @param stream The stream containing the json text.
+        //! @param settings Additional settings to control the way document is deserialized.
+        static JsonSerializationResult::ResultCode LoadStreaming(
+            void* object, const Uuid& objectType, IO::GenericStream& stream, JsonDeserializerSettings& settings);
+
         //! Loads the type id from the provided input.
         //! Note: it's not recommended to use this function (frequently) as it requires users of the json file to have knowledge of the internal
         //!     type structure and is therefore harder to use.
@@ -312,6 +371,20 @@ namespace AZ
         return Load(&object, azrtti_typeid(object), root, settings);
     }
 
+    template<typename T>
+    JsonSerializationResult::ResultCode JsonSerialization::LoadStreaming(
+        T& object, AZStd::string_view json, const JsonDeserializerSettings& settings)
+    {
+        return LoadStreaming(&object, azrtti_typeid(object), json, settings);
+    }
+
+    template<typename T>
+    JsonSerializationResult::ResultCode JsonSerialization::LoadStreaming(
+        T& object, AZStd::string_view json, JsonDeserializerSettings& settings)
+    {
+        return LoadStreaming(&object, azrtti_typeid(object), json, settings);
+    }
+
     template<typename T>
     JsonSerializationResult::ResultCode JsonSerialization::Store(
         rapidjson::Value& output, rapidjson::Document::AllocatorType& allocator, const T& object, const JsonSerializerSettings& settings)
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <AzCore/RTTI/TypeInfoSimple.h>
 #include <AzCore/Serialization/Json/JsonSerializationMetadata.h>
 #include <AzCore/Serialization/Json/JsonSerializationResult.h>
 #include <AzCore/std/string/string.h>
@@ -38,6 +39,17 @@ namespace AZ
         bool m_clearContainers = false;
     };
 
+    //! Statistics collected by JsonSerialization::LoadStreaming if an instance is added to the metadata of the deserializer settings.
+    struct JsonStreamingLoadStatistics final
+    {
+        AZ_TYPE_INFO(JsonStreamingLoadStatistics, "{6C3E5C6B-0A7D-4E52-9B37-3F1C4A2D8E71}");
+
+        //! The largest amount of memory, in bytes, that was used to hold json values at any point during loading.
+        size_t m_peakValueMemory = 0;
+        //! The number of values that were collected in a document and passed to the regular deserializer.
+        size_t m_bufferedValueCount = 0;
+    };
+
     //! Optional settings used while storing an object to a json value.
     struct JsonSerializerSettings final
     {
@@ -0,0 +1,932 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <limits>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/GenericStreams.h>
+#include <AzCore/JSON/document.h>
+#include <AzCore/JSON/error/en.h>
+#include <AzCore/JSON/memorystream.h>
+#include <AzCore/JSON/reader.h>
+#include <AzCore/Serialization/Json/BasicContainerSerializer.h>
+#include <AzCore/Serialization/Json/JsonDeserializer.h>
+#include <AzCore/Serialization/Json/JsonStreamingDeserializer.h>
+#include <AzCore/Serialization/Json/MapSerializer.h>
+#include <AzCore/Serialization/Json/RegistrationContext.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/string.h>
+
+namespace AZ
+{
+    namespace JsonStreamingDeserializerInternal
+    {
+        //! Number of members that are collected for a map before they're passed to the map serializer.
+        static constexpr rapidjson::SizeType MapBatchSize = 64;
+        //! Size of the memory that's reserved up front for collected json values. Only values that don't fit need extra allocations.
+        static constexpr size_t ValueBufferSize = 64 * 1024;
+        //! Size of the blocks that are read from a GenericStream.
+        static constexpr size_t StreamBlockSize = 16 * 1024;
+
+        //! Read-only RapidJSON input stream that reads from a GenericStream in blocks.
+        class GenericStreamReader
+        {
+        public:
+            using Ch = char;
+
+            explicit GenericStreamReader(IO::GenericStream& stream)
+                : m_stream(stream)
+                , m_buffer(StreamBlockSize)
+            {
+                ReadBlock();
+            }
+
+            char Peek() const
+            {
+                return m_current < m_end ? *m_current : '\0';
+            }
+
+            char Take()
+            {
+                if (m_current == m_end)
+                {
+                    return '\0';
+                }
+                char result = *m_current++;
+                if (m_current == m_end)
+                {
+                    ReadBlock();
+                }
+                return result;
+            }
+
+            size_t Tell() const
+            {
+                return m_blockOffset + aznumeric_cast<size_t>(m_current - m_buffer.data());
+            }
+
+            // Not implemented
+            char* PutBegin()
+            {
+                AZ_Assert(false, "GenericStreamReader PutBegin not supported.");
+                return nullptr;
+            }
+            void Put(char)
+            {
+                AZ_Assert(false, "GenericStreamReader Put not supported.");
+            }
+            void Flush()
+            {
+                AZ_Assert(false, "GenericStreamReader Flush not supported.");
+            }
+            size_t PutEnd(char*)
+            {
+                AZ_Assert(false, "GenericStreamReader PutEnd not supported.");
+                return 0;
+            }
+
+        private:
+            void ReadBlock()
+            {
+                m_blockOffset += m_blockSize;
+                m_blockSize = aznumeric_cast<size_t>(m_stream.Read(m_buffer.size(), m_buffer.data()));
+                m_current = m_buffer.data();
+                m_end = m_current + m_blockSize;
+            }
+
+            IO::GenericStream& m_stream;
+            AZStd::vector<char> m_buffer;
+            const char* m_current{ nullptr };
+            const char* m_end{ nullptr };
+            size_t m_blockOffset{ 0 };
+            size_t m_blockSize{ 0 };
+        };
+
+        //! Used with rapidjson::Document::Populate to move the value that was build on the document's stack through its SAX handler
+        //! functions into the document.
+        struct PopulateFromStack
+        {
+            bool operator()(rapidjson::Document&) const
+            {
+                return true;
+            }
+        };
+    } // namespace JsonStreamingDeserializerInternal
+
+    class JsonStreamingDeserializer::Handler
+    {
+    public:
+        Handler(void* object, const Uuid& typeId, JsonDeserializerContext& context);
+
+        // RapidJSON SAX handler interface.
+        bool Null();
+        bool Bool(bool value);
+        bool Int(int value);
+        bool Uint(unsigned value);
+        bool Int64(int64_t value);
+        bool Uint64(uint64_t value);
+        bool Double(double value);
+        bool RawNumber(const char* value, rapidjson::SizeType length, bool copy);
+        bool String(const char* value, rapidjson::SizeType length, bool copy);
+        bool StartObject();
+        bool Key(const char* value, rapidjson::SizeType length, bool copy);
+        bool EndObject(rapidjson::SizeType memberCount);
+        bool StartArray();
+        bool EndArray(rapidjson::SizeType elementCount);
+
+        JsonSerializationResult::ResultCode GetResult() const;
+        size_t GetPeakValueMemory() const;
+        size_t GetBufferedValueCount() const;
+
+    private:
+        enum class FrameType : u8
+        {
+            Class,
+            BasicContainer,
+            Map
+        };
+
+        enum class ValueMode : u8
+        {
+            None, // Events are processed by the frame at the top of the stack.
+            Buffer, // Events are added to the document until the value is complete.
+            Skip // Events are ignored until the value is complete.
+        };
+
+        enum class ValueKind : u8
+        {
+            Scalar,
+            Object,
+            Array
+        };
+
+        struct Target
+        {
+            void* m_object{ nullptr };
+            Uuid m_typeId{ Uuid::CreateNull() };
+            const SerializeContext::ClassElement* m_classElement{ nullptr };
+        };
+
+        struct Frame
+        {
+            Target m_target;
+            JsonSerializationResult::ResultCode m_result{ JsonSerializationResult::Tasks::ReadField };
+            const SerializeContext::ClassData* m_classData{ nullptr };
+            SerializeContext::IDataContainer* m_container{ nullptr };
+            const SerializeContext::ClassElement* m_elementInfo{ nullptr };
+            size_t m_capacity{ 0 };
+            size_t m_initialSize{ 0 };
+            size_t m_count{ 0 }; //!< Number of loaded members for classes or number of read elements for basic containers.
+            FrameType m_type{ FrameType::Class };
+            bool m_pushedPath{ false };
+            bool m_isFull{ false };
+            bool m_loadedBatch{ false };
+        };
+
+        template<typename Function>
+        bool Scalar(Function&& addToDocument);
+
+        bool StartValue(ValueKind kind);
+        bool FinishValue();
+        bool CompleteValue(JsonSerializationResult::ResultCode result, bool pushedPath);
+        bool EndFrame(rapidjson::SizeType count);
+
+        void BeginBuffer(ValueKind kind, const Target& target, bool pushedPath);
+        void BeginSkip(ValueKind kind, bool pushedPath);
+        void BeginSkip(ValueKind kind, bool pushedPath, JsonSerializationResult::ResultCode result);
+        void BeginClass(const Target& target, const SerializeContext::ClassData& classData, bool pushedPath);
+        void BeginBasicContainer(const Target& target, const SerializeContext::ClassData& classData, bool pushedPath);
+        void BeginMap(const Target& target, bool pushedPath);
+        void AbortFrame(JsonSerializationResult::ResultCode result);
+
+        JsonSerializationResult::ResultCode LoadTarget(const Target& target, const rapidjson::Value& value);
+        JsonSerializationResult::ResultCode LoadContainerElement(Frame& frame, const rapidjson::Value& value);
+        JsonSerializationResult::ResultCode LoadMapBatch(Frame& frame);
+        void ReleaseValueMemory();
+
+        AZStd::vector<AZ::u64> m_valueBuffer;
+        rapidjson::Document::AllocatorType m_allocator;
+        rapidjson::Document m_document;
+        rapidjson::Value m_mapBatch{ rapidjson::kObjectType };
+
+        AZStd::vector<Frame> m_frames;
+        AZStd::string m_key;
+        JsonDeserializerContext& m_context;
+        Target m_root;
+        Target m_valueTarget;
+        JsonSerializationResult::ResultCode m_result{ JsonSerializationResult::Tasks::ReadField };
+        JsonSerializationResult::ResultCode m_skipResult{ JsonSerializationResult::Tasks::ReadField };
+        size_t m_depth{ 0 };
+        size_t m_peakValueMemory{ 0 };
+        size_t m_bufferedValueCount{ 0 };
+        ValueMode m_valueMode{ ValueMode::None };
+        bool m_valuePushedPath{ false };
+        bool m_hasSkipResult{ false };
+    };
+
+    JsonStreamingDeserializer::Handler::Handler(void* object, const Uuid& typeId, JsonDeserializerContext& context)
+        : m_valueBuffer(JsonStreamingDeserializerInternal::ValueBufferSize / sizeof(AZ::u64))
+        , m_allocator(m_valueBuffer.data(), JsonStreamingDeserializerInternal::ValueBufferSize)
+        , m_document(&m_allocator)
+        , m_context(context)
+    {
+        m_root.m_object = object;
+        m_root.m_typeId = typeId;
+    }
+
+    bool JsonStreamingDeserializer::Handler::Null()
+    {
+        return Scalar([this]() { return m_document.Null(); });
+    }
+
+    bool JsonStreamingDeserializer::Handler::Bool(bool value)
+    {
+        return Scalar([this, value]() { return m_document.Bool(value); });
+    }
+
+    bool JsonStreamingDeserializer::Handler::Int(int value)
+    {
+        return Scalar([this, value]() { return m_document.Int(value); });
+    }
+
+    bool JsonStreamingDeserializer::Handler::Uint(unsigned value)
+    {
+        return Scalar([this, value]() { return m_document.Uint(value); });
+    }
+
+    bool JsonStreamingDeserializer::Handler::Int64(int64_t value)
+    {
+        return Scalar([this, value]() { return m_document.Int64(value); });
+    }
+
+    bool JsonStreamingDeserializer::Handler::Uint64(uint64_t value)
+    {
+        return Scalar([this, value]() { return m_document.Uint64(value); });
+    }
+
+    bool JsonStreamingDeserializer::Handler::Double(double value)
+    {
+        return Scalar([this, value]() { return m_document.Double(value); });
+    }
+
+    bool JsonStreamingDeserializer::Handler::RawNumber(const char* value, rapidjson::SizeType length, bool copy)
+    {
+        return Scalar([this, value, length, copy]() { return m_document.RawNumber(value, length, copy); });
+    }
+
+    bool JsonStreamingDeserializer::Handler::String(const char* value, rapidjson::SizeType length, bool copy)
+    {
+        return Scalar([this, value, length, copy]() { return m_document.String(value, length, copy); });
+    }
+
+    bool JsonStreamingDeserializer::Handler::StartObject()
+    {
+        switch (m_valueMode)
+        {
+        case ValueMode::Buffer:
+            ++m_depth;
+            return m_document.StartObject();
+        case ValueMode::Skip:
+            ++m_depth;
+            return true;
+        default:
+            return StartValue(ValueKind::Object);
+        }
+    }
+
+    bool JsonStreamingDeserializer::Handler::Key(const char* value, rapidjson::SizeType length, bool copy)
+    {
+        switch (m_valueMode)
+        {
+        case ValueMode::Buffer:
+            return m_document.Key(value, length, copy);
+        case ValueMode::Skip:
+            return true;
+        default:
+            m_key.assign(value, length);
+            return true;
+        }
+    }
+
+    bool JsonStreamingDeserializer::Handler::EndObject(rapidjson::SizeType memberCount)
+    {
+        switch (m_valueMode)
+        {
+        case ValueMode::Buffer:
+            m_document.EndObject(memberCount);
+            return --m_depth == 0 ? FinishValue() : true;
+        case ValueMode::Skip:
+            return --m_depth == 0 ? FinishValue() : true;
+        default:
+            return EndFrame(memberCount);
+        }
+    }
+
+    bool JsonStreamingDeserializer::Handler::StartArray()
+    {
+        switch (m_valueMode)
+        {
+        case ValueMode::Buffer:
+            ++m_depth;
+            return m_document.StartArray();
+        case ValueMode::Skip:
+            ++m_depth;
+            return true;
+        default:
+            return StartValue(ValueKind::Array);
+        }
+    }
+
+    bool JsonStreamingDeserializer::Handler::EndArray(rapidjson::SizeType elementCount)
+    {
+        switch (m_valueMode)
+        {
+        case ValueMode::Buffer:
+            m_document.EndArray(elementCount);
+            return --m_depth == 0 ? FinishValue() : true;
+        case ValueMode::Skip:
+            return --m_depth == 0 ? FinishValue() : true;
+        default:
+            return EndFrame(elementCount);
+        }
+    }
+
+    JsonSerializationResult::ResultCode JsonStreamingDeserializer::Handler::GetResult() const
+    {
+        return m_result;
+    }
+
+    size_t JsonStreamingDeserializer::Handler::GetPeakValueMemory() const
+    {
+        return m_peakValueMemory;
+    }
+
+    size_t JsonStreamingDeserializer::Handler::GetBufferedValueCount() const
+    {
+        return m_bufferedValueCount;
+    }
+
+    template<typename Function>
+    bool JsonStreamingDeserializer::Handler::Scalar(Function&& addToDocument)
+    {
+        switch (m_valueMode)
+        {
+        case ValueMode::Buffer:
+            return addToDocument();
+        case ValueMode::Skip:
+            return true;
+        default:
+            if (!StartValue(ValueKind::Scalar))
+            {
+                return false;
+            }
+            if (m_valueMode == ValueMode::Buffer && !addToDocument())
+            {
+                return false;
+            }
+            return FinishValue();
+        }
+    }
+
+    bool JsonStreamingDeserializer::Handler::StartValue(ValueKind kind)
+    {
+        using namespace JsonSerializationResult;
+
+        Target target = m_root;
+        bool pushedPath = false;
+        if (!m_frames.empty())
+        {
+            Frame& frame = m_frames.back();
+            switch (frame.m_type)
+            {
+            case FrameType::Class:
+            {
+                if (m_key == JsonSerialization::TypeIdFieldIdentifier)
+                {
+                    BeginSkip(kind, false);
+                    return true;
+                }
+
+                m_context.PushPath(m_key);
+                pushedPath = true;
+                JsonDeserializer::ElementDataResult foundElementData = JsonDeserializer::FindElementByNameCrc(
+                    *m_context.GetSerializeContext(), frame.m_target.m_object, *frame.m_classData, Crc32(AZStd::string_view(m_key)));
+                if (!foundElementData.m_found)
+                {
+                    frame.m_result.Combine(m_context.Report(Tasks::ReadField, Outcomes::Skipped,
+                        "Skipping field as there's no matching variable in the target."));
+                    BeginSkip(kind, pushedPath);
+                    return true;
+                }
+                target.m_object = foundElementData.m_data;
+                target.m_typeId = foundElementData.m_info->m_typeId;
+                target.m_classElement = foundElementData.m_info;
+                break;
+            }
+            case FrameType::BasicContainer:
+            {
+                if (frame.m_isFull)
+                {
+                    BeginSkip(kind, false);
+                    return true;
+                }
+
+                m_context.PushPath(frame.m_count);
+                pushedPath = true;
+                if (frame.m_container->Size(frame.m_target.m_object) + 1 > frame.m_capacity)
+                {
+                    frame.m_isFull = true;
+                    frame.m_result.Combine(m_context.Report(Tasks::ReadField, Outcomes::Skipped,
+                        "Unable to load more entries in basic container because it's full."));
+                    BeginSkip(kind, pushedPath);
+                    return true;
+                }
+                // Elements are always loaded as a whole because they're created as new instances.
+                target.m_object = nullptr;
+                target.m_typeId = frame.m_elementInfo->m_typeId;
+                target.m_classElement = frame.m_elementInfo;
+                BeginBuffer(kind, target, pushedPath);
+                return true;
+            }
+            case FrameType::Map:
+                // The map serializer adds the key to the path when the collected members are loaded.
+                BeginBuffer(kind, frame.m_target, false);
+                return true;
+            default:
+                AZ_Assert(false, "Unsupported frame type in the streaming json deserializer.");
+                return false;
+            }
+        }
+
+        const bool isPointer = target.m_classElement &&
+            (target.m_classElement->m_flags & SerializeContext::ClassElement::Flags::FLG_POINTER) != 0;
+        if (kind == ValueKind::Scalar || isPointer)
+        {
+            BeginBuffer(kind, target, pushedPath);
+            return true;
+        }
+
+        // Follow the same lookup as JsonDeserializer::Load to determine if the value can be opened and its members or elements
+        // loaded as they come in, or if the registered serializer needs to see the entire value.
+        const SerializeContext::ClassData* classData = m_context.GetSerializeContext()->FindClassData(target.m_typeId);
+        BaseJsonSerializer* serializer = m_context.GetRegistrationContext()->GetSerializerForType(target.m_typeId);
+        if (!serializer && classData && classData->m_azRtti && classData->m_azRtti->GetGenericTypeId() != target.m_typeId)
+        {
+            serializer = m_context.GetRegistrationContext()->GetSerializerForType(classData->m_azRtti->GetGenericTypeId());
+            if (!serializer)
+            {
+                // Values such as enums that weren't reflected with an EnumBuilder take the same route in JsonDeserializer::Load.
+                BeginBuffer(kind, target, pushedPath);
+                return true;
+            }
+        }
+
+        if (!classData)
+        {
+            BeginBuffer(kind, target, pushedPath);
+        }
+        else if (serializer)
+        {
+            if (kind == ValueKind::Array && classData->m_container && azrtti_cast<JsonBasicContainerSerializer*>(serializer))
+            {
+                BeginBasicContainer(target, *classData, pushedPath);
+            }
+            else if (kind == ValueKind::Object && classData->m_container && azrtti_cast<JsonMapSerializer*>(serializer))
+            {
+                BeginMap(target, pushedPath);
+            }
+            else
+            {
+                BeginBuffer(kind, target, pushedPath);
+            }
+        }
+        else if (kind == ValueKind::Object && !classData->m_container &&
+            !(classData->m_azRtti && (classData->m_azRtti->GetTypeTraits() & AZ::TypeTraits::is_enum) == AZ::TypeTraits::is_enum))
+        {
+            BeginClass(target, *classData, pushedPath);
+        }
+        else
+        {
+            BeginBuffer(kind, target, pushedPath);
+        }
+        return true;
+    }
+
+    bool JsonStreamingDeserializer::Handler::FinishValue()
+    {
+        using namespace JsonSerializationResult;
+
+        const ValueMode mode = m_valueMode;
+        m_valueMode = ValueMode::None;
+        const bool pushedPath = m_valuePushedPath;
+        m_valuePushedPath = false;
+
+        if (mode == ValueMode::Skip)
+        {
+            if (m_hasSkipResult)
+            {
+                m_hasSkipResult = false;
+                return CompleteValue(m_skipResult, pushedPath);
+            }
+            if (pushedPath)
+            {
+                m_context.PopPath();
+            }
+            return true;
+        }
+
+        JsonStreamingDeserializerInternal::PopulateFromStack populateFromStack;
+        m_document.Populate(populateFromStack);
+        m_bufferedValueCount++;
+
+        if (!m_frames.empty() && m_frames.back().m_type == FrameType::Map)
+        {
+            Frame& frame = m_frames.back();
+            rapidjson::Value key(m_key.c_str(), aznumeric_cast<rapidjson::SizeType>(m_key.size()), m_allocator);
+            m_mapBatch.AddMember(AZStd::move(key), AZStd::move(static_cast<rapidjson::Value&>(m_document)), m_allocator);
+            if (m_mapBatch.MemberCount() >= JsonStreamingDeserializerInternal::MapBatchSize)
+            {
+                ResultCode result = LoadMapBatch(frame);
+                if (result.GetProcessing() == Processing::Halted)
+                {
+                    AbortFrame(result);
+                }
+            }
+            return true;
+        }
+
+        m_peakValueMemory = AZStd::max(m_peakValueMemory, m_allocator.Capacity());
+        ResultCode result = (!m_frames.empty() && m_frames.back().m_type == FrameType::BasicContainer)
+            ? LoadContainerElement(m_frames.back(), m_document)
+            : LoadTarget(m_valueTarget, m_document);
+        ReleaseValueMemory();
+        return CompleteValue(result, pushedPath);
+    }
+
+    bool JsonStreamingDeserializer::Handler::CompleteValue(JsonSerializationResult::ResultCode result, bool pushedPath)
+    {
+        using namespace JsonSerializationResult;
+
+        if (m_frames.empty())
+        {
+            m_result = result;
+        }
+        else
+        {
+            Frame& frame = m_frames.back();
+            switch (frame.m_type)
+            {
+            case FrameType::Class:
+                frame.m_result.Combine(result);
+                if (result.GetProcessing() == Processing::Halted)
+                {
+                    ResultCode report = m_context.Report(result, "Loading of element has failed.");
+                    if (pushedPath)
+                    {
+                        m_context.PopPath();
+                    }
+                    AbortFrame(report);
+                    return true;
+                }
+                else if (result.GetProcessing() != Processing::Altered)
+                {
+                    frame.m_count++;
+                }
+                break;
+            case FrameType::BasicContainer:
+                frame.m_count++;
+                if (result.GetProcessing() == Processing::Halted)
+                {
+                    if (pushedPath)
+                    {
+                        m_context.PopPath();
+                    }
+                    AbortFrame(m_context.Report(frame.m_result, "Failed to read element for basic container."));
+                    return true;
+                }
+                break;
+            default:
+                break;
+            }
+        }
+
+        if (pushedPath)
+        {
+            m_context.PopPath();
+        }
+        return true;
+    }
+
+    bool JsonStreamingDeserializer::Handler::EndFrame(rapidjson::SizeType count)
+    {
+        using namespace JsonSerializationResult;
+
+        Frame& frame = m_frames.back();
+        ResultCode result(Tasks::ReadField);
+        switch (frame.m_type)
+        {
+        case FrameType::Class:
+            if (count == 0)
+            {
+                result = m_context.Report(Tasks::ReadField, Outcomes::DefaultsUsed, "Value has an explicit default.");
+            }
+            else
+            {
+                result = frame.m_result;
+                size_t elementCount = JsonDeserializer::CountElements(*m_context.GetSerializeContext(), *frame.m_classData);
+                if (elementCount > frame.m_count)
+                {
+                    result.Combine(ResultCode(Tasks::ReadField, frame.m_count == 0 ? Outcomes::DefaultsUsed : Outcomes::PartialDefaults));
+                }
+            }
+            break;
+        case FrameType::BasicContainer:
+        {
+            if (!frame.m_result.HasDoneWork() && count == 0)
+            {
+                result = m_context.Report(Tasks::ReadField, Outcomes::Success, "No values provided for basic container.");
+                break;
+            }
+
+            size_t addedCount = frame.m_container->Size(frame.m_target.m_object) - frame.m_initialSize;
+            if (addedCount > 0)
+            {
+                // Values were added which means the container is no longer in its default state of being empty.
+                frame.m_result.Combine(ResultCode(Tasks::ReadField, Outcomes::Success));
+            }
+            AZStd::string_view message =
+                addedCount >= count ? "Successfully read basic container." :
+                addedCount == 0 ? "Unable to read data for basic container." :
+                "Partially read data for basic container.";
+            result = m_context.Report(frame.m_result, message);
+            break;
+        }
+        case FrameType::Map:
+            // An empty object is still passed on to the map serializer so it can handle it as an explicit default.
+            if (m_mapBatch.MemberCount() > 0 || !frame.m_loadedBatch)
+            {
+                LoadMapBatch(frame);
+            }
+            result = frame.m_result;
+            break;
+        default:
+            AZ_Assert(false, "Unsupported frame type in the streaming json deserializer.");
+            return false;
+        }
+
+        const bool pushedPath = frame.m_pushedPath;
+        m_frames.pop_back();
+        return CompleteValue(result, pushedPath);
+    }
+
+    void JsonStreamingDeserializer::Handler::BeginBuffer(ValueKind kind, const Target& target, bool pushedPath)
+    {
+        m_valueMode = ValueMode::Buffer;
+        m_valueTarget = target;
+        m_valuePushedPath = pushedPath;
+        m_depth = 0;
+        if (kind == ValueKind::Object)
+        {
+            m_depth = 1;
+            m_document.StartObject();
+        }
+        else if (kind == ValueKind::Array)
+        {
+            m_depth = 1;
+            m_document.StartArray();
+        }
+    }
+
+    void JsonStreamingDeserializer::Handler::BeginSkip(ValueKind kind, bool pushedPath)
+    {
+        m_valueMode = ValueMode::Skip;
+        m_valuePushedPath = pushedPath;
+        m_hasSkipResult = false;
+        m_depth = kind == ValueKind::Scalar ? 0 : 1;
+    }
+
+    void JsonStreamingDeserializer::Handler::BeginSkip(ValueKind kind, bool pushedPath, JsonSerializationResult::ResultCode result)
+    {
+        BeginSkip(kind, pushedPath);
+        m_hasSkipResult = true;
+        m_skipResult = result;
+    }
+
+    void JsonStreamingDeserializer::Handler::BeginClass(
+        const Target& target, const SerializeContext::ClassData& classData, bool pushedPath)
+    {
+        Frame& frame = m_frames.emplace_back();
+        frame.m_type = FrameType::Class;
+        frame.m_target = target;
+        frame.m_classData = &classData;
+        frame.m_pushedPath = pushedPath;
+    }
+
+    void JsonStreamingDeserializer::Handler::BeginBasicContainer(
+        const Target& target, const SerializeContext::ClassData& classData, bool pushedPath)
+    {
+        namespace JSR = JsonSerializationResult; // Used to remove name conflicts in AzCore in uber builds.
+
+        SerializeContext::IDataContainer* container = classData.m_container;
+        const SerializeContext::ClassElement* classElement = nullptr;
+        auto typeEnumCallback = [&classElement](const Uuid&, const SerializeContext::ClassElement* genericClassElement)
+        {
+            AZ_Assert(!classElement, "There are multiple class elements registered for a basic container where only one was expected.");
+            classElement = genericClassElement;
+            return true;
+        };
+        container->EnumTypes(typeEnumCallback);
+        AZ_Assert(classElement, "No class element found for the type in the basic container.");
+
+        Frame frame;
+        frame.m_type = FrameType::BasicContainer;
+        frame.m_target = target;
+        frame.m_classData = &classData;
+        frame.m_container = container;
+        frame.m_elementInfo = classElement;
+        frame.m_capacity = container->IsFixedCapacity() ? container->Capacity(target.m_object) : std::numeric_limits<size_t>::max();
+        frame.m_pushedPath = pushedPath;
+
+        size_t containerSize = container->Size(target.m_object);
+        if (containerSize > 0 && m_context.ShouldClearContainers())
+        {
+            JSR::Result result = m_context.Report(JSR::Tasks::Clear, JSR::Outcomes::Success, "Clearing basic container.");
+            if (result.GetResultCode().GetOutcome() == JSR::Outcomes::Success)
+            {
+                container->ClearElements(target.m_object, m_context.GetSerializeContext());
+                containerSize = container->Size(target.m_object);
+                result = m_context.Report(JSR::Tasks::Clear, containerSize == 0 ? JSR::Outcomes::Success : JSR::Outcomes::Unsupported,
+                    containerSize == 0 ? "Cleared basic container." : "Failed to clear basic container.");
+            }
+            if (result.GetResultCode().GetProcessing() != JSR::Processing::Completed)
+            {
+                BeginSkip(ValueKind::Array, pushedPath, result.GetResultCode());
+                return;
+            }
+            frame.m_result.Combine(result);
+        }
+        frame.m_initialSize = containerSize;
+        m_frames.push_back(AZStd::move(frame));
+    }
+
+    void JsonStreamingDeserializer::Handler::BeginMap(const Target& target, bool pushedPath)
+    {
+        Frame& frame = m_frames.emplace_back();
+        frame.m_type = FrameType::Map;
+        frame.m_target = target;
+        frame.m_pushedPath = pushedPath;
+    }
+
+    void JsonStreamingDeserializer::Handler::AbortFrame(JsonSerializationResult::ResultCode result)
+    {
+        // The rest of the object or array that belongs to the frame is skipped and the parent receives the result as if the
+        // frame was loaded in one go and returned early.
+        const bool pushedPath = m_frames.back().m_pushedPath;
+        m_frames.pop_back();
+        m_mapBatch.SetObject();
+        ReleaseValueMemory();
+        BeginSkip(ValueKind::Object, pushedPath, result);
+    }
+
+    JsonSerializationResult::ResultCode JsonStreamingDeserializer::Handler::LoadTarget(
+        const Target& target, const rapidjson::Value& value)
+    {
+        return target.m_classElement
+            ? JsonDeserializer::LoadWithClassElement(target.m_object, value, *target.m_classElement, m_context)
+            : JsonDeserializer::Load(target.m_object, target.m_typeId, value, false, m_context);
+    }
+
+    JsonSerializationResult::ResultCode JsonStreamingDeserializer::Handler::LoadContainerElement(
+        Frame& frame, const rapidjson::Value& value)
+    {
+        namespace JSR = JsonSerializationResult; // Used to remove name conflicts in AzCore in uber builds.
+
+        void* containerObject = frame.m_target.m_object;
+        SerializeContext::IDataContainer* container = frame.m_container;
+        const SerializeContext::ClassElement* classElement = frame.m_elementInfo;
+        const bool isPointer = (classElement->m_flags & SerializeContext::ClassElement::Flags::FLG_POINTER) != 0;
+
+        size_t expectedSize = container->Size(containerObject) + 1;
+        void* elementAddress = container->ReserveElement(containerObject, classElement);
+        if (!elementAddress)
+        {
+            return m_context.Report(JSR::Tasks::ReadField, JSR::Outcomes::Catastrophic,
+                "Failed to allocate an item in the basic container.");
+        }
+        if (isPointer)
+        {
+            *reinterpret_cast<void**>(elementAddress) = nullptr;
+        }
+
+        JSR::ResultCode result = isPointer
+            ? JsonDeserializer::LoadToPointer(elementAddress, classElement->m_typeId, value, m_context)
+            : JsonDeserializer::Load(elementAddress, classElement->m_typeId, value, true, m_context);
+        if (result.GetProcessing() == JSR::Processing::Halted)
+        {
+            container->FreeReservedElement(containerObject, elementAddress, m_context.GetSerializeContext());
+        }
+        else if (result.GetProcessing() == JSR::Processing::Altered)
+        {
+            container->FreeReservedElement(containerObject, elementAddress, m_context.GetSerializeContext());
+            frame.m_result.Combine(result);
+        }
+        else
+        {
+            container->StoreElement(containerObject, elementAddress);
+            if (container->Size(containerObject) != expectedSize)
+            {
+                frame.m_result.Combine(m_context.Report(JSR::Tasks::ReadField, JSR::Outcomes::Unavailable,
+                    "Unable to store element to basic container."));
+            }
+            else
+            {
+                frame.m_result.Combine(result);
+            }
+        }
+        return result;
+    }
+
+    JsonSerializationResult::ResultCode JsonStreamingDeserializer::Handler::LoadMapBatch(Frame& frame)
+    {
+        m_peakValueMemory = AZStd::max(m_peakValueMemory, m_allocator.Capacity());
+
+        // Only the first batch is allowed to clear the map, otherwise every batch would remove the entries of the previous one.
+        const bool clearContainers = m_context.m_clearContainers;
+        m_context.m_clearContainers = clearContainers && !frame.m_loadedBatch;
+        JsonSerializationResult::ResultCode result = LoadTarget(frame.m_target, m_mapBatch);
+        m_context.m_clearContainers = clearContainers;
+
+        frame.m_loadedBatch = true;
+        frame.m_result.Combine(result);
+        m_mapBatch.SetObject();
+        ReleaseValueMemory();
+        return result;
+    }
+
+    void JsonStreamingDeserializer::Handler::ReleaseValueMemory()
+    {
+        // Values only hold memory from the pool allocator, so there's no need to destroy them before clearing the allocator.
+        m_document.SetNull();
+        if (m_mapBatch.MemberCount() == 0)
+        {
+            m_allocator.Clear();
+        }
+    }
+
+
+
+    //
+    // JsonStreamingDeserializer
+    //
+
+    JsonSerializationResult::ResultCode JsonStreamingDeserializer::Load(
+        void* object, const Uuid& typeId, AZStd::string_view json, JsonDeserializerContext& context)
+    {
+        rapidjson::MemoryStream stream(json.data(), json.size());
+        return Parse(object, typeId, stream, context);
+    }
+
+    JsonSerializationResult::ResultCode JsonStreamingDeserializer::Load(
+        void* object, const Uuid& typeId, IO::GenericStream& stream, JsonDeserializerContext& context)
+    {
+        JsonStreamingDeserializerInternal::GenericStreamReader reader(stream);
+        return Parse(object, typeId, reader, context);
+    }
+
+    template<typename InputStream>
+    JsonSerializationResult::ResultCode JsonStreamingDeserializer::Parse(
+        void* object, const Uuid& typeId, InputStream& stream, JsonDeserializerContext& context)
+    {
+        using namespace JsonSerializationResult;
+
+        if (!object)
+        {
+            return context.Report(Tasks::ReadField, Outcomes::Catastrophic,
+                "Target object for Json Serialization is pointing to nothing during loading.");
+        }
+
+        // The handler holds the reusable value memory, so keep it off the stack.
+        auto handler = AZStd::make_unique<Handler>(object, typeId, context);
+        rapidjson::Reader reader;
+        rapidjson::ParseResult parseResult = reader.Parse<rapidjson::kParseDefaultFlags>(stream, *handler);
+
+        if (JsonStreamingLoadStatistics* statistics = context.GetMetadata().Find<JsonStreamingLoadStatistics>())
+        {
+            statistics->m_peakValueMemory = handler->GetPeakValueMemory();
+            statistics->m_bufferedValueCount = handler->GetBufferedValueCount();
+        }
+
+        if (parseResult.IsError())
+        {
+            return context.Report(Tasks::ReadField, Outcomes::Catastrophic,
+                AZStd::string::format("Failed to parse json at offset %zu: %s",
+                    parseResult.Offset(), rapidjson::GetParseError_En(parseResult.Code())));
+        }
+        return handler->GetResult();
+    }
+} // namespace AZ
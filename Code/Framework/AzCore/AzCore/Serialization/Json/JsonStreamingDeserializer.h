@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Serialization/Json/JsonSerializationResult.h>
+#include <AzCore/std/string/string_view.h>
+
+namespace AZ
+{
+    struct Uuid;
+    class JsonDeserializerContext;
+
+    namespace IO
+    {
+        class GenericStream;
+    }
+
+    //! Loads json text into an object while it's being read by a SAX reader, instead of parsing the full text into a document first.
+    //! Reflected classes, basic containers and maps are opened as they're encountered and their members and elements are loaded
+    //! one by one. Any other value is collected in a small document and passed to the JsonDeserializer, which in turn uses the
+    //! registered serializers, after which the memory for the value is reused for the next value.
+    class JsonStreamingDeserializer final
+    {
+        friend class JsonSerialization;
+
+    private:
+        class Handler;
+
+        JsonStreamingDeserializer() = delete;
+        ~JsonStreamingDeserializer() = delete;
+        JsonStreamingDeserializer& operator=(const JsonStreamingDeserializer& rhs) = delete;
+        JsonStreamingDeserializer& operator=(JsonStreamingDeserializer&& rhs) = delete;
+        JsonStreamingDeserializer(const JsonStreamingDeserializer& rhs) = delete;
+        JsonStreamingDeserializer(JsonStreamingDeserializer&& rhs) = delete;
+
+        static JsonSerializationResult::ResultCode Load(
+            void* object, const Uuid& typeId, AZStd::string_view json, JsonDeserializerContext& context);
+        static JsonSerializationResult::ResultCode Load(
+            void* object, const Uuid& typeId, IO::GenericStream& stream, JsonDeserializerContext& context);
+
+        template<typename InputStream>
+        static JsonSerializationResult::ResultCode Parse(
+            void* object, const Uuid& typeId, InputStream& stream, JsonDeserializerContext& context);
+    };
+} // namespace AZ
@@ -597,7 +597,15 @@ namespace AZ
                     }
                     else
                     {
-                        for (size_t i = 0; i < parentClassInfo->m_elements.size(); ++i)
+                        // Classes with a compiled layout have a sorted lookup of their elements.
+                        const SerializeContext::CompiledLayout* parentLayout = m_sc->GetCompiledLayout(parentClassInfo);
+                        const SerializeContext::CompiledLayout::Element* compiledElement = parentLayout ? parentLayout->FindElement(element.m_nameCrc) : nullptr;
+                        if (compiledElement && compiledElement->m_classElement->m_typeId == element.m_id)
+                        {
+                            classElement = compiledElement->m_classElement;
+                        }
+
+                        for (size_t i = 0; classElement == nullptr && i < parentClassInfo->m_elements.size(); ++i)
                         {
                             const SerializeContext::ClassElement* childElement = &parentClassInfo->m_elements[i];
                             if (childElement->m_nameCrc == element.m_nameCrc)
@@ -1340,15 +1348,24 @@ namespace AZ
 
                 element.m_dataType = SerializeContext::DataElement::DT_BINARY_BE;
 
-
-                // find the registered class data
-                cd = sc.FindClassData(element.m_id, parent, element.m_nameCrc);
-                if (cd)
+                // Elements of a class with a compiled layout had their class data resolved when the layout was compiled.
+                const SerializeContext::CompiledLayout* parentLayout = sc.GetCompiledLayout(parent);
+                const SerializeContext::CompiledLayout::Element* compiledElement = parentLayout ? parentLayout->FindElement(element.m_nameCrc) : nullptr;
+                if (compiledElement && compiledElement->m_classElement->m_typeId == element.m_id)
                 {
-                    // Lookup the SpecializedTypeId from the class if it has GenericClassInfo registered with it
-                    if (GenericClassInfo* genericClassInfo = sc.FindGenericClassInfo(cd->m_typeId))
+                    cd = compiledElement->m_classData;
+                }
+                else
+                {
+                    // find the registered class data
+                    cd = sc.FindClassData(element.m_id, parent, element.m_nameCrc);
+                    if (cd)
                     {
-                        element.m_id = genericClassInfo->GetSpecializedTypeId();
+                        // Lookup the SpecializedTypeId from the class if it has GenericClassInfo registered with it
+                        if (GenericClassInfo* genericClassInfo = sc.FindGenericClassInfo(cd->m_typeId))
+                        {
+                            element.m_id = genericClassInfo->GetSpecializedTypeId();
+                        }
                     }
                 }
 
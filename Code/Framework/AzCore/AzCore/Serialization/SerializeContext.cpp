@@ -21,6 +21,7 @@
 #include <AzCore/std/bind/bind.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/containers/stack.h>
+#include <AzCore/std/sort.h>
 
 #include <AzCore/Math/MathReflection.h>
 #include <AzCore/Math/MathUtils.h>
@@ -564,6 +565,8 @@ namespace AZ
     //=========================================================================
     void SerializeContext::ClassDeprecate(const char* name, const AZ::Uuid& typeUuid, VersionConverter converter)
     {
+        InvalidateCompiledLayouts();
+
         if (IsRemovingReflection())
         {
             m_uuidMap.erase(typeUuid);
@@ -731,6 +734,7 @@ namespace AZ
 
             if (scGenericInfoFoundIt == scGenericClassInfoRange.second)
             {
+                InvalidateCompiledLayouts();
                 m_uuidGenericMap.emplace(classId, genericClassInfo);
                 m_uuidAnyCreationMap.emplace(classId, createAnyFunc);
                 m_classNameToUuid.emplace(genericClassInfo->GetClassData()->m_name, classId);
@@ -1648,6 +1652,9 @@ namespace AZ
             }
         }
 #endif // AZ_ENABLE_TRACING
+
+        // The class or one of its elements may have changed, so all layouts referencing it need to be rebuilt.
+        m_context->InvalidateCompiledLayouts();
     }
 
     //=========================================================================
@@ -1781,6 +1788,19 @@ namespace AZ
         return this;
     }
 
+    //=========================================================================
+    // ClassBuilder::UseCompiledLayout
+    //=========================================================================
+    SerializeContext::ClassBuilder* SerializeContext::ClassBuilder::UseCompiledLayout()
+    {
+        if (m_context->IsRemovingReflection())
+        {
+            return this; // we have already removed the class data.
+        }
+        m_classData->second.m_useCompiledLayout = true;
+        return this;
+    }
+
     //=========================================================================
     // EnumerateInstanceConst
     // [10/31/2012]
@@ -1910,13 +1930,15 @@ namespace AZ
             }
             else
             {
+                const CompiledLayout* compiledLayout = GetCompiledLayout(dataClassInfo);
                 for (size_t i = 0, n = dataClassInfo->m_elements.size(); i < n; ++i)
                 {
                     const SerializeContext::ClassElement& ed = dataClassInfo->m_elements[i];
                     void* dataAddress = (char*)(objectPtr) + ed.m_offset;
                     if (dataAddress)
                     {
-                        const SerializeContext::ClassData* elemClassInfo = ed.m_genericClassInfo ? ed.m_genericClassInfo->GetClassData() : FindClassData(ed.m_typeId, dataClassInfo, ed.m_nameCrc);
+                        const SerializeContext::ClassData* elemClassInfo = compiledLayout ? compiledLayout->m_elementClassData[i] :
+                            ed.m_genericClassInfo ? ed.m_genericClassInfo->GetClassData() : FindClassData(ed.m_typeId, dataClassInfo, ed.m_nameCrc);
 
                         keepEnumeratingSiblings = EnumerateInstance(callContext, dataAddress, ed.m_typeId, elemClassInfo, &ed);
                         if (!keepEnumeratingSiblings)
@@ -2112,6 +2134,216 @@ namespace AZ
         }
     }
 
+    //=========================================================================
+    // GetCompiledLayout
+    //=========================================================================
+    const SerializeContext::CompiledLayout* SerializeContext::GetCompiledLayout(const ClassData* classData) const
+    {
+        if (!classData || !classData->m_useCompiledLayout)
+        {
+            return nullptr;
+        }
+
+        if (m_compiledLayoutsDirty.load(AZStd::memory_order_acquire))
+        {
+            CompileLayouts();
+        }
+        return classData->m_compiledLayout;
+    }
+
+    //=========================================================================
+    // InvalidateCompiledLayouts
+    //=========================================================================
+    void SerializeContext::InvalidateCompiledLayouts()
+    {
+        // Reflection isn't thread safe with respect to serialization, so the layouts can't be in use at this point.
+        for (const AZStd::unique_ptr<CompiledLayout>& layout : m_compiledLayouts)
+        {
+            layout->m_classData->m_compiledLayout = nullptr;
+        }
+        m_compiledLayouts.clear();
+        m_compiledLayoutsDirty.store(true, AZStd::memory_order_release);
+    }
+
+    //=========================================================================
+    // CompileLayouts
+    //=========================================================================
+    void SerializeContext::CompileLayouts() const
+    {
+        AZStd::scoped_lock lock(m_compiledLayoutsMutex);
+        if (!m_compiledLayoutsDirty.load(AZStd::memory_order_acquire))
+        {
+            return; // another thread compiled the layouts while we were waiting for the lock.
+        }
+
+        for (const auto& [typeId, classData] : m_uuidMap)
+        {
+            if (!classData.m_useCompiledLayout || classData.m_compiledLayout)
+            {
+                continue;
+            }
+
+            bool isCompilable = !classData.IsDeprecated() && !classData.m_serializer && !classData.m_container && !classData.m_eventHandler &&
+                typeId != SerializeTypeInfo<DynamicSerializableField>::GetUuid();
+
+            auto layout = AZStd::make_unique<CompiledLayout>();
+            layout->m_classData = &classData;
+            layout->m_elementClassData.reserve(classData.m_elements.size());
+            for (const ClassElement& element : classData.m_elements)
+            {
+                const ClassData* elementClassData = element.m_genericClassInfo ? element.m_genericClassInfo->GetClassData()
+                    : FindClassData(element.m_typeId, &classData, element.m_nameCrc);
+                isCompilable = isCompilable && elementClassData;
+                layout->m_elementClassData.push_back(elementClassData);
+
+                // ObjectStream resolves the type of a loaded element by its type id. Only elements for which that lookup gives the
+                // same result without looking at the parent class can skip it.
+                const ClassData* loadClassData = FindClassData(element.m_typeId, &classData, element.m_nameCrc);
+                const GenericClassInfo* genericClassInfo = loadClassData ? FindGenericClassInfo(loadClassData->m_typeId) : nullptr;
+                if (loadClassData && (!genericClassInfo || genericClassInfo->GetSpecializedTypeId() == element.m_typeId))
+                {
+                    layout->m_elements.push_back({ element.m_nameCrc, &element, loadClassData });
+                }
+            }
+
+            if (!isCompilable || !CompileLayoutOps(*layout, classData, 0))
+            {
+                AZ_Warning("Serialization", false, "Class '%s' requested a compiled layout but it uses features that require the generic "
+                    "serialization path, like a custom serializer, an event handler or pointer elements.", classData.m_name);
+                continue;
+            }
+
+            AZStd::stable_sort(layout->m_elements.begin(), layout->m_elements.end(),
+                [](const CompiledLayout::Element& lhs, const CompiledLayout::Element& rhs) { return lhs.m_nameCrc < rhs.m_nameCrc; });
+
+            classData.m_compiledLayout = layout.get();
+            m_compiledLayouts.push_back(AZStd::move(layout));
+        }
+
+        m_compiledLayoutsDirty.store(false, AZStd::memory_order_release);
+    }
+
+    //=========================================================================
+    // CompileLayoutOps
+    //=========================================================================
+    bool SerializeContext::CompileLayoutOps(CompiledLayout& layout, const ClassData& classData, size_t offset) const
+    {
+        for (const ClassElement& element : classData.m_elements)
+        {
+            if (element.m_flags & (ClassElement::FLG_POINTER | ClassElement::FLG_DYNAMIC_FIELD))
+            {
+                return false;
+            }
+
+            const ClassData* elementClassData = element.m_genericClassInfo ? element.m_genericClassInfo->GetClassData()
+                : FindClassData(element.m_typeId, &classData, element.m_nameCrc);
+            if (!elementClassData || elementClassData->IsDeprecated())
+            {
+                return false;
+            }
+
+            const size_t elementOffset = offset + element.m_offset;
+            if (elementClassData->m_eventHandler || elementClassData->m_container ||
+                elementClassData->m_typeId == SerializeTypeInfo<DynamicSerializableField>::GetUuid())
+            {
+                layout.m_ops.push_back({ elementOffset, 0, elementClassData, &element, CompiledLayout::OpType::CloneGeneric });
+            }
+            else if (elementClassData->m_serializer)
+            {
+                if (elementClassData->m_typeId == GetAssetClassId())
+                {
+                    layout.m_ops.push_back({ elementOffset, 0, elementClassData, &element, CompiledLayout::OpType::CloneAsset });
+                }
+                else if (elementClassData->m_isTriviallyCopyable)
+                {
+                    CompiledLayout::Op* lastOp = layout.m_ops.empty() ? nullptr : &layout.m_ops.back();
+                    if (lastOp && lastOp->m_type == CompiledLayout::OpType::CopyBytes && lastOp->m_offset + lastOp->m_size == elementOffset)
+                    {
+                        lastOp->m_size += element.m_dataSize;
+                    }
+                    else
+                    {
+                        layout.m_ops.push_back({ elementOffset, element.m_dataSize, nullptr, nullptr, CompiledLayout::OpType::CopyBytes });
+                    }
+                }
+                else
+                {
+                    layout.m_ops.push_back({ elementOffset, 0, elementClassData, &element, CompiledLayout::OpType::CloneSerialized });
+                }
+            }
+            else
+            {
+                // Inline the elements of base classes and nested value classes. If that isn't possible the nested class
+                // is cloned through the generic path, which can handle anything it contains.
+                const size_t numOps = layout.m_ops.size();
+                if (!CompileLayoutOps(layout, *elementClassData, elementOffset))
+                {
+                    layout.m_ops.resize(numOps);
+                    layout.m_ops.push_back({ elementOffset, 0, elementClassData, &element, CompiledLayout::OpType::CloneGeneric });
+                }
+            }
+        }
+        return true;
+    }
+
+    //=========================================================================
+    // CloneCompiledLayout
+    //=========================================================================
+    void SerializeContext::CloneCompiledLayout(const CompiledLayout& layout, void* dest, const void* src, ErrorHandler* errorHandler, AZStd::vector<char>* scratchBuffer)
+    {
+        for (const CompiledLayout::Op& op : layout.m_ops)
+        {
+            char* destData = reinterpret_cast<char*>(dest) + op.m_offset;
+            const char* srcData = reinterpret_cast<const char*>(src) + op.m_offset;
+            switch (op.m_type)
+            {
+            case CompiledLayout::OpType::CopyBytes:
+                memcpy(destData, srcData, op.m_size);
+                break;
+            case CompiledLayout::OpType::CloneSerialized:
+            {
+                scratchBuffer->clear();
+                IO::ByteContainerStream<AZStd::vector<char>> stream(scratchBuffer);
+
+                op.m_classData->m_serializer->Save(srcData, stream);
+                stream.Seek(0, IO::GenericStream::ST_SEEK_BEGIN);
+
+                op.m_classData->m_serializer->Load(destData, stream, op.m_classData->m_version);
+                op.m_classData->m_serializer->PostClone(destData);
+                break;
+            }
+            case CompiledLayout::OpType::CloneAsset:
+                static_cast<AssetSerializer*>(op.m_classData->m_serializer.get())->Clone(srcData, destData);
+                op.m_classData->m_serializer->PostClone(destData);
+                break;
+            case CompiledLayout::OpType::CloneGeneric:
+            {
+                ObjectCloneData cloneData;
+                cloneData.m_ptr = destData;
+                EnumerateInstanceCallContext callContext(
+                    AZStd::bind(&SerializeContext::BeginCloneElementInplace, this, destData, AZStd::placeholders::_1, AZStd::placeholders::_2, AZStd::placeholders::_3, &cloneData, errorHandler, scratchBuffer),
+                    AZStd::bind(&SerializeContext::EndCloneElement, this, &cloneData),
+                    this,
+                    SerializeContext::ENUM_ACCESS_FOR_READ,
+                    errorHandler);
+
+                EnumerateInstance(&callContext, const_cast<char*>(srcData), op.m_classElement->m_typeId, op.m_classData, op.m_classElement);
+                break;
+            }
+            }
+        }
+    }
+
+    //=========================================================================
+    // CompiledLayout::FindElement
+    //=========================================================================
+    const SerializeContext::CompiledLayout::Element* SerializeContext::CompiledLayout::FindElement(u32 nameCrc) const
+    {
+        auto it = AZStd::lower_bound(m_elements.begin(), m_elements.end(), nameCrc,
+            [](const Element& element, u32 crc) { return element.m_nameCrc < crc; });
+        return it != m_elements.end() && it->m_nameCrc == nameCrc ? &*it : nullptr;
+    }
+
     AZ::SerializeContext::DataPatchUpgrade::DataPatchUpgrade(AZStd::string_view fieldName, unsigned int fromVersion, unsigned int toVersion)
         : m_targetFieldName(fieldName)
         , m_targetFieldCRC(m_targetFieldName.data(), m_targetFieldName.size(), true)
@@ -2384,6 +2616,20 @@ namespace AZ
             }
         }
 
+        if (const CompiledLayout* compiledLayout = GetCompiledLayout(classData))
+        {
+            // Compiled classes have no event handler, serializer or container, so cloning the elements is all there is to do.
+            CloneCompiledLayout(*compiledLayout, destPtr, srcPtr, errorHandler, scratchBuffer);
+
+            cloneData->m_parentStack.push_back();
+            ObjectCloneData::ParentInfo& parentInfo = cloneData->m_parentStack.back();
+            parentInfo.m_ptr = destPtr;
+            parentInfo.m_reservePtr = reservePtr;
+            parentInfo.m_classData = classData;
+            parentInfo.m_containerIndexCounter = 0;
+            return false; // the elements have already been cloned, don't enumerate them.
+        }
+
         if (classData->m_eventHandler)
         {
             classData->m_eventHandler->OnWriteBegin(destPtr);
@@ -2795,6 +3041,7 @@ namespace AZ
     //=========================================================================
     void SerializeContext::RemoveClassData(ClassData* classData)
     {
+        InvalidateCompiledLayouts();
         if (m_editContext)
         {
             m_editContext->RemoveClassData(classData);
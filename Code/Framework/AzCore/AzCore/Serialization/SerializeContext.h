@@ -27,8 +27,10 @@
 #include <AzCore/std/typetraits/negation.h>
 #include <AzCore/std/typetraits/remove_pointer.h>
 #include <AzCore/std/typetraits/is_base_of.h>
+#include <AzCore/std/typetraits/is_trivially_copyable.h>
 #include <AzCore/std/any.h>
 #include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
 
 #include <AzCore/std/functional.h>
 
@@ -108,6 +110,7 @@ namespace AZ
         class EnumBuilder;
 
         class ClassData;
+        class CompiledLayout;
         struct EnumerateInstanceCallContext;
         struct ClassElement;
         struct DataElement;
@@ -315,6 +318,10 @@ namespace AZ
         void CloneObjectInplace(T& dest, const T* obj);
         void CloneObjectInplace(void* dest, const void* ptr, const Uuid& classId);
 
+        /// Returns the compiled layout of a class that opted in with \ref ClassBuilder::UseCompiledLayout, or null if the class
+        /// doesn't use one or can't be compiled. Layouts are (re)built on first use after the reflected classes changed.
+        const CompiledLayout* GetCompiledLayout(const ClassData* classData) const;
+
         // Types listed earlier here will have higher priority
         enum DataPatchUpgradeType
         {
@@ -625,6 +632,10 @@ namespace AZ
             Edit::ClassData*    m_editData;         ///< Edit data for the class display.
             ClassElementArray   m_elements;         ///< Sub elements. If this is not empty m_serializer should be NULL (there is no point to have sub-elements, if we can serialize the entire class).
 
+            bool                m_isTriviallyCopyable{};    ///< Set if the reflected C++ type is trivially copyable.
+            bool                m_useCompiledLayout{};      ///< Set by ClassBuilder::UseCompiledLayout.
+            mutable const CompiledLayout* m_compiledLayout{}; ///< Compiled layout owned by the SerializeContext, use SerializeContext::GetCompiledLayout to access it.
+
             // A collection of single-node upgrades to apply during serialization
             // The map is keyed by the version the upgrades are converting from
             // Upgrades are then sorted in the order of the version they upgrade to
@@ -642,6 +653,52 @@ namespace AZ
             }
         };
 
+        /**
+         * Flattened description of a class that opted in with ClassBuilder::UseCompiledLayout.
+         * The elements of base classes and nested value classes are inlined into a single list of ops with their offsets
+         * relative to the start of the object, and contiguous trivially copyable leaf elements are merged into a single copy.
+         * The class data of all elements is resolved once, so cloning, enumerating and loading an instance doesn't need
+         * a class lookup per element.
+         */
+        class CompiledLayout
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(CompiledLayout, SystemAllocator, 0);
+
+            enum class OpType : u8
+            {
+                CopyBytes,          ///< Copy m_size bytes of one or more trivially copyable leaf elements.
+                CloneSerialized,    ///< Clone a leaf element through its serializer.
+                CloneAsset,         ///< Clone an asset reference.
+                CloneGeneric,       ///< Clone an element through the generic path, used for containers and classes that can't be inlined.
+            };
+
+            struct Op
+            {
+                size_t m_offset;                    ///< Offset of the element from the start of the object.
+                size_t m_size;                      ///< Number of bytes to copy for CopyBytes.
+                const ClassData* m_classData;       ///< Class data of the element. Not set for CopyBytes.
+                const ClassElement* m_classElement; ///< Class element the op was created from. Not set for CopyBytes.
+                OpType m_type;
+            };
+
+            struct Element
+            {
+                u32 m_nameCrc;
+                const ClassElement* m_classElement;
+                const ClassData* m_classData;       ///< Class data the element type resolves to when it's loaded.
+            };
+
+            /// Finds the element with the name crc in the class itself, not in its base classes or nested classes.
+            /// Only elements whose type can be loaded without further lookups are included.
+            const Element* FindElement(u32 nameCrc) const;
+
+            const ClassData* m_classData{};
+            AZStd::vector<Op> m_ops;
+            AZStd::vector<const ClassData*> m_elementClassData;   ///< Class data of each entry in ClassData::m_elements.
+            AZStd::vector<Element> m_elements;                     ///< Loadable elements sorted by name crc.
+        };
+
         /**
          * Interface for creating and destroying object from the serializer.
          */
@@ -1110,6 +1167,15 @@ namespace AZ
         template<class T, class...TBaseClasses>
         void AddClassData(ClassData* classData);
 
+        /// Clears all compiled layouts, they will be rebuilt the next time one is requested.
+        void InvalidateCompiledLayouts();
+        /// Builds the compiled layouts for all classes that requested one.
+        void CompileLayouts() const;
+        /// Appends the ops to clone the elements of a class at the offset to the layout. Returns false if a class element can't be represented.
+        bool CompileLayoutOps(CompiledLayout& layout, const ClassData& classData, size_t offset) const;
+        /// Clones all elements of an instance using its compiled layout.
+        void CloneCompiledLayout(const CompiledLayout& layout, void* dest, const void* src, ErrorHandler* errorHandler, AZStd::vector<char>* scratchBuffer);
+
         /// Object cloning callbacks.
         bool BeginCloneElement(void* ptr, const ClassData* classData, const ClassElement* elementData, void* stackData, ErrorHandler* errorHandler, AZStd::vector<char>* scratchBuffer);
         bool BeginCloneElementInplace(void* rootDestPtr, void* ptr, const ClassData* classData, const ClassElement* elementData, void* stackData, ErrorHandler* errorHandler, AZStd::vector<char>* scratchBuffer);
@@ -1229,6 +1295,15 @@ namespace AZ
              */
             ClassBuilder* SerializerDoSave(ClassDoSave isSave);
 
+            /**
+             * Opt in to a compiled layout for the class. The class elements are flattened into a list of copy and clone ops
+             * with all element types resolved up front, which speeds up CloneObject, enumeration and ObjectStream loading
+             * for types that are serialized in large numbers. Trivially copyable leaf elements are cloned with a memcpy
+             * instead of a round trip through their serializer.
+             * Classes with a custom serializer, data container, event handler or pointer elements fall back to the generic path.
+             */
+            ClassBuilder* UseCompiledLayout();
+
             /**
              * All T (attribute value) MUST be copy or move constructible as they are stored in internal
              * AttributeContainer<T>, which can be accessed by azrtti and AttributeData.
@@ -1337,6 +1412,10 @@ namespace AZ
         AZStd::unordered_map<TypeId, TypeId> m_enumTypeIdToUnderlyingTypeIdMap; ///< Uuid to keep track of the correspond underlying type id for an enum type that is reflected as a Field within the SerializeContext
         AZStd::vector<AZStd::unique_ptr<IDataContainer>> m_dataContainers; ///< Takes care of all related IDataContainer's lifetimes
 
+        mutable AZStd::vector<AZStd::unique_ptr<CompiledLayout>> m_compiledLayouts; ///< Owns the layouts referenced by ClassData::m_compiledLayout
+        mutable AZStd::mutex m_compiledLayoutsMutex;
+        mutable AZStd::atomic_bool m_compiledLayoutsDirty{ true };
+
         class PerModuleGenericClassInfo;
         AZStd::unordered_set<PerModuleGenericClassInfo*>  m_perModuleSet; ///< Stores the static PerModuleGenericClass structures keeps track of reflected GenericClassInfo per module
 
@@ -2435,6 +2514,7 @@ namespace AZ
         cd.m_container = container;
         cd.m_azRtti = GetRttiHelper<T>();
         cd.m_editData = nullptr;
+        cd.m_isTriviallyCopyable = AZStd::is_trivially_copyable_v<T>;
         return cd;
     }
 
@@ -184,6 +184,8 @@ namespace AZ
                 // Store the underlying type as an attribute within the ClassData
                 enumClassData.m_attributes.emplace_back(Serialize::Attributes::EnumUnderlyingType, aznew AZ::AttributeContainerType<AZ::TypeId>(underlyingTypeId));
                 enumTypeIter = enumTypeInsertIter.first;
+                // Enum fields of compiled classes have resolved to the underlying type until now
+                InvalidateCompiledLayouts();
                 return EnumBuilder(this, enumTypeIter);
             }
         }
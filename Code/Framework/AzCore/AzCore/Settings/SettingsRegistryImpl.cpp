@@ -14,6 +14,7 @@
 #include <AzCore/Serialization/Json/JsonSerialization.h>
 #include <AzCore/Serialization/Json/StackedString.h>
 #include <AzCore/Settings/SettingsRegistryImpl.h>
+#include <AzCore/std/hash.h>
 #include <AzCore/std/sort.h>
 #include <AzCore/std/parallel/scoped_lock.h>
 
@@ -740,9 +741,14 @@ namespace AZ
             AZStd::string_view name = specializations.GetSpecialization(i);
             specialzationArray.PushBack(Value(name.data(), aznumeric_caster(name.length()), m_settings.GetAllocator()), m_settings.GetAllocator());
         }
-        pointer.Create(m_settings, m_settings.GetAllocator()).SetObject()
+        Value& folderHistory = pointer.Create(m_settings, m_settings.GetAllocator()).SetObject()
             .AddMember(StringRef("Folder"), Value(folderPath.c_str(), aznumeric_caster(folderPath.size()), m_settings.GetAllocator()), m_settings.GetAllocator())
             .AddMember(StringRef("Specializations"), AZStd::move(specialzationArray), m_settings.GetAllocator());
+        if (!platform.empty())
+        {
+            folderHistory.AddMember(StringRef("Platform"),
+                Value(platform.data(), aznumeric_caster(platform.length()), m_settings.GetAllocator()), m_settings.GetAllocator());
+        }
 
         auto callback = [this, &fileList, &specializations, &pointer, &folderPath](const char* filename, bool isFile) -> bool
         {
@@ -1268,4 +1274,490 @@ namespace AZ
     {
         applyPatchSettings = m_applyPatchSettings;
     }
+
+    namespace SettingsRegistrySnapshotInternal
+    {
+        static constexpr u32 Signature = 0x50534753; // "SGSP" when read from disk.
+        static constexpr u32 Version = 1;
+
+        enum class ValueTag : u8
+        {
+            Null,
+            False,
+            True,
+            UnsignedInteger,
+            NegativeInteger,
+            FloatingPoint,
+            String,
+            Array,
+            Object
+        };
+
+        struct Input
+        {
+            AZ::IO::FixedMaxPathString m_path;
+            u64 m_modificationTime{ 0 };
+            u64 m_length{ 0 };
+        };
+
+        template<typename T>
+        static void WriteRaw(AZStd::vector<char>& buffer, const T& value)
+        {
+            const char* bytes = reinterpret_cast<const char*>(&value);
+            buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+        }
+
+        static void WriteVarUInt(AZStd::vector<char>& buffer, u64 value)
+        {
+            while (value >= 0x80)
+            {
+                buffer.push_back(static_cast<char>((value & 0x7f) | 0x80));
+                value >>= 7;
+            }
+            buffer.push_back(static_cast<char>(value));
+        }
+
+        static void WriteString(AZStd::vector<char>& buffer, const char* string, size_t length)
+        {
+            WriteVarUInt(buffer, length);
+            buffer.insert(buffer.end(), string, string + length);
+        }
+
+        static void WriteValue(AZStd::vector<char>& buffer, const rapidjson::Value& value)
+        {
+            switch (value.GetType())
+            {
+            case rapidjson::kNullType:
+                buffer.push_back(static_cast<char>(ValueTag::Null));
+                break;
+            case rapidjson::kFalseType:
+                buffer.push_back(static_cast<char>(ValueTag::False));
+                break;
+            case rapidjson::kTrueType:
+                buffer.push_back(static_cast<char>(ValueTag::True));
+                break;
+            case rapidjson::kNumberType:
+                if (value.IsUint64())
+                {
+                    buffer.push_back(static_cast<char>(ValueTag::UnsignedInteger));
+                    WriteVarUInt(buffer, value.GetUint64());
+                }
+                else if (value.IsInt64())
+                {
+                    // Negative values are stored as their one's complement so small values stay small.
+                    buffer.push_back(static_cast<char>(ValueTag::NegativeInteger));
+                    WriteVarUInt(buffer, ~static_cast<u64>(value.GetInt64()));
+                }
+                else
+                {
+                    buffer.push_back(static_cast<char>(ValueTag::FloatingPoint));
+                    WriteRaw(buffer, value.GetDouble());
+                }
+                break;
+            case rapidjson::kStringType:
+                buffer.push_back(static_cast<char>(ValueTag::String));
+                WriteString(buffer, value.GetString(), value.GetStringLength());
+                break;
+            case rapidjson::kArrayType:
+                buffer.push_back(static_cast<char>(ValueTag::Array));
+                WriteVarUInt(buffer, value.Size());
+                for (const rapidjson::Value& element : value.GetArray())
+                {
+                    WriteValue(buffer, element);
+                }
+                break;
+            case rapidjson::kObjectType:
+                buffer.push_back(static_cast<char>(ValueTag::Object));
+                WriteVarUInt(buffer, value.MemberCount());
+                for (auto& member : value.GetObject())
+                {
+                    WriteString(buffer, member.name.GetString(), member.name.GetStringLength());
+                    WriteValue(buffer, member.value);
+                }
+                break;
+            default:
+                AZ_Assert(false, "Unsupported json type %i found while writing settings registry snapshot.", static_cast<int>(value.GetType()));
+                buffer.push_back(static_cast<char>(ValueTag::Null));
+                break;
+            }
+        }
+
+        class Reader
+        {
+        public:
+            Reader(const char* data, size_t size)
+                : m_current(data)
+                , m_end(data + size)
+            {
+            }
+
+            bool IsAtEnd() const
+            {
+                return m_current == m_end;
+            }
+
+            bool ReadU32(u32& value)
+            {
+                return ReadBytes(&value, sizeof(value));
+            }
+
+            bool ReadU64(u64& value)
+            {
+                return ReadBytes(&value, sizeof(value));
+            }
+
+            bool ReadVarUInt(u64& value)
+            {
+                value = 0;
+                for (u32 shift = 0; shift < 64 && m_current < m_end; shift += 7)
+                {
+                    u8 byte = static_cast<u8>(*m_current++);
+                    value |= static_cast<u64>(byte & 0x7f) << shift;
+                    if ((byte & 0x80) == 0)
+                    {
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            bool ReadString(AZStd::string_view& string)
+            {
+                u64 length;
+                if (!ReadVarUInt(length) || length > static_cast<u64>(m_end - m_current))
+                {
+                    return false;
+                }
+                string = AZStd::string_view(m_current, length);
+                m_current += length;
+                return true;
+            }
+
+            bool ReadValue(rapidjson::Value& value, rapidjson::Document::AllocatorType& allocator)
+            {
+                if (m_current == m_end)
+                {
+                    return false;
+                }
+
+                switch (static_cast<ValueTag>(*m_current++))
+                {
+                case ValueTag::Null:
+                    value.SetNull();
+                    return true;
+                case ValueTag::False:
+                    value.SetBool(false);
+                    return true;
+                case ValueTag::True:
+                    value.SetBool(true);
+                    return true;
+                case ValueTag::UnsignedInteger:
+                {
+                    u64 number;
+                    if (!ReadVarUInt(number))
+                    {
+                        return false;
+                    }
+                    value.SetUint64(number);
+                    return true;
+                }
+                case ValueTag::NegativeInteger:
+                {
+                    u64 number;
+                    if (!ReadVarUInt(number))
+                    {
+                        return false;
+                    }
+                    value.SetInt64(static_cast<s64>(~number));
+                    return true;
+                }
+                case ValueTag::FloatingPoint:
+                {
+                    double number;
+                    if (!ReadBytes(&number, sizeof(number)))
+                    {
+                        return false;
+                    }
+                    value.SetDouble(number);
+                    return true;
+                }
+                case ValueTag::String:
+                {
+                    AZStd::string_view string;
+                    if (!ReadString(string))
+                    {
+                        return false;
+                    }
+                    value.SetString(string.data(), aznumeric_caster(string.length()), allocator);
+                    return true;
+                }
+                case ValueTag::Array:
+                {
+                    u64 count;
+                    // Every element takes at least one byte, so a larger count can only come from a corrupted snapshot.
+                    if (!ReadVarUInt(count) || count > static_cast<u64>(m_end - m_current))
+                    {
+                        return false;
+                    }
+                    value.SetArray();
+                    value.Reserve(aznumeric_caster(count), allocator);
+                    for (u64 i = 0; i < count; ++i)
+                    {
+                        rapidjson::Value element;
+                        if (!ReadValue(element, allocator))
+                        {
+                            return false;
+                        }
+                        value.PushBack(AZStd::move(element), allocator);
+                    }
+                    return true;
+                }
+                case ValueTag::Object:
+                {
+                    u64 count;
+                    if (!ReadVarUInt(count) || count > static_cast<u64>(m_end - m_current))
+                    {
+                        return false;
+                    }
+                    value.SetObject();
+                    for (u64 i = 0; i < count; ++i)
+                    {
+                        AZStd::string_view name;
+                        rapidjson::Value member;
+                        if (!ReadString(name) || !ReadValue(member, allocator))
+                        {
+                            return false;
+                        }
+                        value.AddMember(rapidjson::Value(name.data(), aznumeric_caster(name.length()), allocator),
+                            AZStd::move(member), allocator);
+                    }
+                    return true;
+                }
+                default:
+                    return false;
+                }
+            }
+
+        private:
+            bool ReadBytes(void* output, size_t size)
+            {
+                if (size > static_cast<size_t>(m_end - m_current))
+                {
+                    return false;
+                }
+                memcpy(output, m_current, size);
+                m_current += size;
+                return true;
+            }
+
+            const char* m_current;
+            const char* m_end;
+        };
+
+        static void AddInput(AZStd::vector<Input>& inputs, AZStd::string_view path)
+        {
+            // Folders are recorded with a trailing wildcard, which is removed so the modification time of the folder itself is used.
+            // A folder's modification time changes when files are added, removed or renamed in it.
+            constexpr AZStd::string_view trailingCharacters{ "*" AZ_CORRECT_AND_WRONG_DATABASE_SEPARATOR };
+            size_t end = path.find_last_not_of(trailingCharacters);
+            if (end == AZStd::string_view::npos || end + 1 > AZ::IO::MaxPathLength)
+            {
+                return;
+            }
+
+            Input& input = inputs.emplace_back();
+            input.m_path.assign(path.data(), end + 1);
+            input.m_modificationTime = AZ::IO::SystemFile::ModificationTime(input.m_path.c_str());
+            input.m_length = AZ::IO::SystemFile::Length(input.m_path.c_str());
+        }
+
+        //! Collects all files and folders that contributed to the settings from the file history.
+        static AZStd::vector<Input> CollectInputs(const rapidjson::Document& settings)
+        {
+            AZStd::vector<Input> inputs;
+
+            const rapidjson::Value* history = rapidjson::Pointer(AZ_SETTINGS_REGISTRY_HISTORY_KEY).Get(settings);
+            if (!history || !history->IsArray())
+            {
+                return inputs;
+            }
+
+            for (const rapidjson::Value& entry : history->GetArray())
+            {
+                if (entry.IsString())
+                {
+                    AddInput(inputs, AZStd::string_view(entry.GetString(), entry.GetStringLength()));
+                }
+                else if (entry.IsObject())
+                {
+                    if (auto folder = entry.FindMember("Folder"); folder != entry.MemberEnd() && folder->value.IsString())
+                    {
+                        AZStd::string_view folderPath(folder->value.GetString(), folder->value.GetStringLength());
+                        AddInput(inputs, folderPath);
+
+                        if (auto platform = entry.FindMember("Platform"); platform != entry.MemberEnd() && platform->value.IsString())
+                        {
+                            AZ::IO::FixedMaxPath platformPath(folderPath.substr(0, folderPath.find_last_not_of('*') + 1));
+                            platformPath /= SettingsRegistryInterface::PlatformFolder;
+                            platformPath /= AZStd::string_view(platform->value.GetString(), platform->value.GetStringLength());
+                            AddInput(inputs, platformPath.Native());
+                        }
+                    }
+                    // Files that failed to load are recorded as well, as they may be available the next time.
+                    else if (auto path = entry.FindMember("Path"); path != entry.MemberEnd() && path->value.IsString())
+                    {
+                        AddInput(inputs, AZStd::string_view(path->value.GetString(), path->value.GetStringLength()));
+                    }
+                }
+            }
+            return inputs;
+        }
+    } // namespace SettingsRegistrySnapshotInternal
+
+    bool SettingsRegistryImpl::SaveSnapshot(AZStd::string_view snapshotPath, u64 key) const
+    {
+        using namespace AZ::IO;
+        using namespace SettingsRegistrySnapshotInternal;
+
+        // Leave room for the extension of the temporary file.
+        constexpr AZStd::string_view tempExtension = ".tmp";
+        if (snapshotPath.empty() || snapshotPath.length() + tempExtension.length() > MaxPathLength)
+        {
+            AZ_Error("Settings Registry", false, R"(Invalid path "%.*s" provided for the settings registry snapshot.)",
+                aznumeric_cast<int>(snapshotPath.length()), snapshotPath.data());
+            return false;
+        }
+
+        AZStd::vector<char> buffer;
+        {
+            AZStd::scoped_lock lock(m_settingMutex);
+
+            AZStd::vector<Input> inputs = CollectInputs(m_settings);
+            WriteRaw(buffer, Signature);
+            WriteRaw(buffer, Version);
+            WriteRaw(buffer, key);
+
+            WriteVarUInt(buffer, inputs.size());
+            for (const Input& input : inputs)
+            {
+                WriteString(buffer, input.m_path.c_str(), input.m_path.size());
+                WriteVarUInt(buffer, input.m_modificationTime);
+                WriteVarUInt(buffer, input.m_length);
+            }
+
+            WriteValue(buffer, m_settings);
+        }
+
+        // Write to a temporary file first so an interrupted write doesn't leave a partial snapshot behind.
+        FixedMaxPathString targetPath(snapshotPath);
+        FixedMaxPathString tempPath(targetPath);
+        tempPath += tempExtension;
+
+        SystemFile file;
+        if (!file.Open(tempPath.c_str(), SystemFile::SF_OPEN_CREATE | SystemFile::SF_OPEN_CREATE_PATH | SystemFile::SF_OPEN_WRITE_ONLY))
+        {
+            AZ_Warning("Settings Registry", false, R"(Unable to open settings registry snapshot "%s" for writing.)", tempPath.c_str());
+            return false;
+        }
+        bool written = file.Write(buffer.data(), buffer.size()) == buffer.size();
+        file.Close();
+
+        if (!written || !SystemFile::Rename(tempPath.c_str(), targetPath.c_str(), true))
+        {
+            AZ_Warning("Settings Registry", false, R"(Unable to write settings registry snapshot "%s".)", targetPath.c_str());
+            SystemFile::Delete(tempPath.c_str());
+            return false;
+        }
+        return true;
+    }
+
+    bool SettingsRegistryImpl::LoadSnapshot(AZStd::string_view snapshotPath, u64 key, AZStd::vector<char>* scratchBuffer)
+    {
+        using namespace AZ::IO;
+        using namespace SettingsRegistrySnapshotInternal;
+
+        if (snapshotPath.empty() || snapshotPath.length() > MaxPathLength)
+        {
+            return false;
+        }
+
+        AZStd::vector<char> buffer;
+        if (!scratchBuffer)
+        {
+            scratchBuffer = &buffer;
+        }
+
+        FixedMaxPathString path(snapshotPath);
+        SystemFile file;
+        if (!file.Open(path.c_str(), SystemFile::SF_OPEN_READ_ONLY))
+        {
+            return false;
+        }
+        u64 fileSize = file.Length();
+        scratchBuffer->clear();
+        scratchBuffer->resize_no_construct(fileSize);
+        if (file.Read(fileSize, scratchBuffer->data()) != fileSize)
+        {
+            AZ_Warning("Settings Registry", false, R"(Unable to read settings registry snapshot "%s".)", path.c_str());
+            return false;
+        }
+        file.Close();
+
+        Reader reader(scratchBuffer->data(), scratchBuffer->size());
+        u32 signature;
+        u32 version;
+        u64 snapshotKey;
+        u64 inputCount;
+        if (!reader.ReadU32(signature) || signature != Signature || !reader.ReadU32(version) || version != Version ||
+            !reader.ReadU64(snapshotKey) || snapshotKey != key || !reader.ReadVarUInt(inputCount))
+        {
+            return false;
+        }
+
+        for (u64 i = 0; i < inputCount; ++i)
+        {
+            AZStd::string_view inputPath;
+            u64 modificationTime;
+            u64 length;
+            if (!reader.ReadString(inputPath) || inputPath.length() > MaxPathLength ||
+                !reader.ReadVarUInt(modificationTime) || !reader.ReadVarUInt(length))
+            {
+                return false;
+            }
+
+            path = inputPath;
+            if (SystemFile::ModificationTime(path.c_str()) != modificationTime || SystemFile::Length(path.c_str()) != length)
+            {
+                return false;
+            }
+        }
+
+        rapidjson::Document settings;
+        if (!reader.ReadValue(settings, settings.GetAllocator()) || !reader.IsAtEnd())
+        {
+            AZ_Warning("Settings Registry", false, R"(Settings registry snapshot "%.*s" is corrupted.)",
+                aznumeric_cast<int>(snapshotPath.length()), snapshotPath.data());
+            return false;
+        }
+        scratchBuffer->clear();
+
+        {
+            AZStd::scoped_lock lock(m_settingMutex);
+            m_settings.Swap(settings);
+        }
+
+        SignalNotifier("", Type::Object);
+
+        return true;
+    }
+
+    u64 SettingsRegistryImpl::CalculateSettingsHash() const
+    {
+        AZStd::vector<char> buffer;
+        {
+            AZStd::scoped_lock lock(m_settingMutex);
+            SettingsRegistrySnapshotInternal::WriteValue(buffer, m_settings);
+        }
+        return AZStd::hash_range(buffer.begin(), buffer.end());
+    }
 } // namespace AZ
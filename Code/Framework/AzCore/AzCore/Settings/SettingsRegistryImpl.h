@@ -83,6 +83,18 @@ namespace AZ
         void SetApplyPatchSettings(const AZ::JsonApplyPatchSettings& applyPatchSettings) override;
         void GetApplyPatchSettings(AZ::JsonApplyPatchSettings& applyPatchSettings) override;
 
+        //! Writes all settings to a compact binary snapshot at the provided path. Besides the settings the snapshot stores the
+        //! provided key and the size and modification time of every file and folder listed in the file history, which allows
+        //! LoadSnapshot to detect if merging the same files again would no longer produce the same settings.
+        bool SaveSnapshot(AZStd::string_view snapshotPath, u64 key) const;
+        //! Replaces all settings with the ones stored in the snapshot at the provided path. This only happens if the snapshot was
+        //! created with the same key and none of the files and folders it was created from have been changed, added or removed.
+        //! If the snapshot is missing or out of date false is returned and the settings are left untouched.
+        bool LoadSnapshot(AZStd::string_view snapshotPath, u64 key, AZStd::vector<char>* scratchBuffer = nullptr);
+        //! Calculates a hash of all settings currently in the registry. This can be used as a key for a snapshot to invalidate
+        //! it when the settings that are available before merging, such as the command line, change.
+        u64 CalculateSettingsHash() const;
+
     private:
         using TagList = AZStd::fixed_vector<size_t, Specializations::MaxCount + 1>;
         struct RegistryFile
@@ -63,6 +63,12 @@ namespace AZ::SettingsRegistryMergeUtils
     //! Stores error text regarding engine boot sequence when engine and project roots cannot be determined
     inline static constexpr char FilePathKey_ErrorText[] = "/Amazon/AzCore/Runtime/FilePaths/ErrorText";
 
+    //! When set to true the ComponentApplication stores the fully merged settings in a binary snapshot in the
+    //! "{FilePathKey_DevWriteStorage}/SettingsRegistry" folder. On the next start the snapshot is loaded instead of merging the
+    //! settings registry files, unless any of the merged files or folders has changed. As this is checked before the settings
+    //! registry files are merged, it needs to be set on the command line or in the o3de user registry.
+    inline static constexpr char SettingsRegistrySnapshotKey[] = "/Amazon/AzCore/Settings/RegistrySnapshot";
+
     //! Root key for where command line are stored at within the settings registry
     inline static constexpr char CommandLineRootKey[] = "/Amazon/AzCore/Runtime/CommandLine";
     //! Key set to trigger a notification that the CommandLine has been stored within the settings registry
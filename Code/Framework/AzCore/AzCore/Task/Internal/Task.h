@@ -145,6 +145,8 @@ namespace AZ::Internal
 
         uint8_t GetPriorityNumber() const noexcept;
 
+        uint64_t GetCpuMask() const noexcept;
+
     private:
         friend class CompiledTaskGraph;
         friend class TaskWorker;
@@ -43,7 +43,7 @@ namespace AZ
         TaskPriority priority = TaskPriority::MEDIUM;
 
         // EXPERTS ONLY. A bitmask that restricts tasks of this kind to run only on cores
-        // corresponding to a set bit. 0 is synonymous with all bits set
-        uint32_t cpuMask = 0;
+        // corresponding to a set bit. 0 is synonymous with all bits set. Only the first 64 workers can be selected
+        uint64_t cpuMask = 0;
     };
 }
@@ -9,6 +9,7 @@
 #include <AzCore/Task/TaskExecutor.h>
 #include <AzCore/Task/TaskGraph.h>
 
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/containers/queue.h>
 #include <AzCore/std/parallel/binary_semaphore.h>
 #include <AzCore/std/parallel/exponential_backoff.h>
@@ -31,6 +32,8 @@ namespace AZ
             size_t linkCount,
             TaskGraph* parent)
             : m_parent{ parent }
+            // A retained graph holds a reference on behalf of its parent TaskGraph
+            , m_remaining{ parent ? 1u : 0u }
         {
             m_tasks = AZStd::move(tasks);
             m_successors.resize(linkCount);
@@ -50,6 +53,14 @@ namespace AZ
                 {
                     m_successors[static_cast<size_t>(task.m_successorOffset) + j] = &m_tasks[links[i][j]];
                 }
+
+                // Dependency counters are primed once here, and rearmed by the worker that releases a task
+                // so that resubmitting the graph doesn't need to touch every task
+                task.Init();
+                if (task.IsRoot())
+                {
+                    m_roots.push_back(&task);
+                }
             }
 
             // TODO: Check for dependency cycles
@@ -63,8 +74,15 @@ namespace AZ
             {
                 if (remaining == 1)
                 {
-                    // Allow the parent graph to be submitted again
-                    m_parent->m_submitted = false;
+                    // Signal before settling, a settled graph may be resubmitted right away which replaces m_waitEvent
+                    if (m_waitEvent)
+                    {
+                        m_waitEvent->Signal();
+                    }
+
+                    // Allow the parent graph to be submitted again. This is the last access of the parent, which
+                    // may be resubmitted, reset or destroyed as soon as it observes the store
+                    m_parent->m_submitted.store(false, AZStd::memory_order_release);
                 }
             }
             else if (remaining == 0)
@@ -75,12 +93,6 @@ namespace AZ
                 }
 
                 azdestroy(this);
-                return remaining;
-            }
-
-            if (m_waitEvent && remaining == (m_parent ? 1u : 0u))
-            {
-                m_waitEvent->Signal();
             }
 
             return remaining;
@@ -102,6 +114,8 @@ namespace AZ
         class TaskQueue final
         {
         public:
+            AZ_CLASS_ALLOCATOR(TaskQueue, SystemAllocator, 0)
+
             // Preallocating upfront allows us to reserve slots to insert tasks without locks.
             // Each thread allocated by the task manager consumes ~2 MB.
             constexpr static uint16_t MaxQueueSize = 0xffff;
@@ -113,6 +127,7 @@ namespace AZ
 
             void Enqueue(Task* task);
             Task* TryDequeue();
+            Task* TryDequeue(uint8_t priority);
 
         private:
             QueueStatus m_status[PriorityLevelCount] = {};
@@ -161,38 +176,192 @@ namespace AZ
 
         Task* TaskQueue::TryDequeue()
         {
-            for (size_t priority = 0; priority != PriorityLevelCount; ++priority)
+            for (uint8_t priority = 0; priority != PriorityLevelCount; ++priority)
             {
-                QueueStatus& status = m_status[priority];
-                while (true)
+                if (Task* task = TryDequeue(priority))
                 {
-                    uint16_t head = status.head.load();
-                    uint16_t tail = status.tail.load();
-                    if (head == tail)
+                    return task;
+                }
+            }
+
+            return nullptr;
+        }
+
+        Task* TaskQueue::TryDequeue(uint8_t priority)
+        {
+            QueueStatus& status = m_status[priority];
+            while (true)
+            {
+                uint16_t head = status.head.load();
+                uint16_t tail = status.tail.load();
+                if (head == tail)
+                {
+                    // Queue empty
+                    return nullptr;
+                }
+                else
+                {
+                    Task* task = m_queues[priority][head];
+                    if (status.head.compare_exchange_weak(head, head + 1))
                     {
-                        // Queue empty
-                        break;
+                        return task;
                     }
-                    else
+                }
+            }
+        }
+
+        // Chase-Lev work-stealing deque ("Dynamic Circular Work-Stealing Deque", Chase and Lev 2005, using the
+        // C11 memory orderings from "Correct and Efficient Work-Stealing for Weak Memory Models", Le et al. 2013).
+        // Only the owning worker pushes and pops at the bottom, any other worker may steal from the top. The ring
+        // grows when full; retired rings are kept alive until the deque is destroyed since a thief may still be
+        // reading from them.
+        class TaskDeque final
+        {
+        public:
+            constexpr static int64_t InitialCapacity = 256;
+
+            TaskDeque()
+            {
+                m_ring.store(AllocateRing(InitialCapacity, nullptr), AZStd::memory_order_relaxed);
+            }
+
+            ~TaskDeque()
+            {
+                Ring* ring = m_ring.load(AZStd::memory_order_relaxed);
+                while (ring)
+                {
+                    Ring* retired = ring->m_retired;
+                    azfree(ring);
+                    ring = retired;
+                }
+            }
+
+            TaskDeque(const TaskDeque&) = delete;
+            TaskDeque& operator=(const TaskDeque&) = delete;
+
+            // Owner only
+            void Push(Task* task)
+            {
+                int64_t bottom = m_bottom.load(AZStd::memory_order_relaxed);
+                int64_t top = m_top.load(AZStd::memory_order_acquire);
+                Ring* ring = m_ring.load(AZStd::memory_order_relaxed);
+                if (bottom - top > ring->m_mask)
+                {
+                    ring = Grow(ring, top, bottom);
+                }
+                ring->Slot(bottom).store(task, AZStd::memory_order_relaxed);
+                AZStd::atomic_thread_fence(AZStd::memory_order_release);
+                m_bottom.store(bottom + 1, AZStd::memory_order_relaxed);
+            }
+
+            // Owner only, pops the most recently pushed task
+            Task* Pop()
+            {
+                int64_t bottom = m_bottom.load(AZStd::memory_order_relaxed) - 1;
+                Ring* ring = m_ring.load(AZStd::memory_order_relaxed);
+                m_bottom.store(bottom, AZStd::memory_order_relaxed);
+                AZStd::atomic_thread_fence(AZStd::memory_order_seq_cst);
+                int64_t top = m_top.load(AZStd::memory_order_relaxed);
+
+                Task* task = nullptr;
+                if (top <= bottom)
+                {
+                    task = ring->Slot(bottom).load(AZStd::memory_order_relaxed);
+                    if (top == bottom)
                     {
-                        Task* task = m_queues[priority][status.head];
-                        if (status.head.compare_exchange_weak(head, head + 1))
+                        // Last task in the deque, race against thieves for it
+                        if (!m_top.compare_exchange_strong(top, top + 1, AZStd::memory_order_seq_cst, AZStd::memory_order_relaxed))
                         {
-                            return task;
+                            task = nullptr;
                         }
+                        m_bottom.store(bottom + 1, AZStd::memory_order_relaxed);
                     }
                 }
+                else
+                {
+                    m_bottom.store(bottom + 1, AZStd::memory_order_relaxed);
+                }
+                return task;
             }
 
-            return nullptr;
-        }
+            // Any thread, takes the oldest task. Returns nullptr if the deque was empty or another thread won the race.
+            Task* Steal()
+            {
+                int64_t top = m_top.load(AZStd::memory_order_acquire);
+                AZStd::atomic_thread_fence(AZStd::memory_order_seq_cst);
+                int64_t bottom = m_bottom.load(AZStd::memory_order_acquire);
+                if (top < bottom)
+                {
+                    Ring* ring = m_ring.load(AZStd::memory_order_acquire);
+                    Task* task = ring->Slot(top).load(AZStd::memory_order_relaxed);
+                    if (m_top.compare_exchange_strong(top, top + 1, AZStd::memory_order_seq_cst, AZStd::memory_order_relaxed))
+                    {
+                        return task;
+                    }
+                }
+                return nullptr;
+            }
+
+            bool IsEmpty() const
+            {
+                return m_bottom.load(AZStd::memory_order_relaxed) <= m_top.load(AZStd::memory_order_relaxed);
+            }
+
+        private:
+            struct Ring
+            {
+                int64_t m_mask;
+                Ring* m_retired;
+
+                AZStd::atomic<Task*>& Slot(int64_t index)
+                {
+                    return reinterpret_cast<AZStd::atomic<Task*>*>(this + 1)[index & m_mask];
+                }
+            };
+
+            static Ring* AllocateRing(int64_t capacity, Ring* retired)
+            {
+                Ring* ring = reinterpret_cast<Ring*>(azmalloc(sizeof(Ring) + sizeof(AZStd::atomic<Task*>) * capacity, alignof(Ring)));
+                ring->m_mask = capacity - 1;
+                ring->m_retired = retired;
+                for (int64_t i = 0; i != capacity; ++i)
+                {
+                    new (&ring->Slot(i)) AZStd::atomic<Task*>{ nullptr };
+                }
+                return ring;
+            }
+
+            Ring* Grow(Ring* ring, int64_t top, int64_t bottom)
+            {
+                Ring* grown = AllocateRing((ring->m_mask + 1) * 2, ring);
+                for (int64_t i = top; i != bottom; ++i)
+                {
+                    grown->Slot(i).store(ring->Slot(i).load(AZStd::memory_order_relaxed), AZStd::memory_order_relaxed);
+                }
+                m_ring.store(grown, AZStd::memory_order_release);
+                return grown;
+            }
+
+            // Top and bottom are on separate cache lines since thieves hammer the former and the owner the latter
+            alignas(64) AZStd::atomic<int64_t> m_top{ 0 };
+            alignas(64) AZStd::atomic<int64_t> m_bottom{ 0 };
+            AZStd::atomic<Ring*> m_ring{ nullptr };
+        };
+
+        // Set on worker threads so that tasks submitted from within a task go to the local deque
+        static AZ_THREAD_LOCAL TaskWorker* s_currentWorker = nullptr;
 
         class TaskWorker
         {
         public:
+            // Number of failed attempts at finding work before a worker goes to sleep
+            constexpr static uint32_t SpinCount = 32;
+
             void Spawn(::AZ::TaskExecutor& executor, size_t id, AZStd::semaphore& initSemaphore, bool affinitize)
             {
                 m_executor = &executor;
+                m_id = static_cast<uint32_t>(id);
+                m_randomState = static_cast<uint32_t>(id) * 0x9E3779B9u + 1;
 
                 AZStd::string threadName = AZStd::string::format("TaskWorker %zu", id);
                 AZStd::thread_desc desc = {};
@@ -205,6 +374,7 @@ namespace AZ
 
                 m_thread = AZStd::thread{ [this, &initSemaphore]
                                           {
+                                              s_currentWorker = this;
                                               initSemaphore.release();
                                               Run();
                                           },
@@ -214,67 +384,193 @@ namespace AZ
             void Join()
             {
                 m_active.store(false, AZStd::memory_order_release);
+                m_sleeping.store(false);
                 m_semaphore.release();
                 m_thread.join();
             }
 
+            // Tasks enqueued here only run on this worker (used for tasks with an affinity restriction)
             void Enqueue(Task* task)
             {
                 m_queue.Enqueue(task);
+                Wake();
+            }
 
-                if (!m_busy.exchange(true))
+            // Must be invoked from this worker's thread
+            void PushLocal(Task* task)
+            {
+                m_deques[task->GetPriorityNumber()].Push(task);
+            }
+
+            // Returns true if this worker was asleep and has been woken up
+            bool Wake()
+            {
+                if (m_sleeping.load() && m_sleeping.exchange(false))
                 {
-                    // The worker was idle prior to enqueueing the task, release the semaphore
+                    --m_executor->m_sleepingWorkers;
                     m_semaphore.release();
+                    return true;
                 }
+                return false;
+            }
+
+            ::AZ::TaskExecutor* GetExecutor() const
+            {
+                return m_executor;
+            }
+
+            uint32_t GetId() const
+            {
+                return m_id;
             }
 
         private:
             void Run()
             {
+                uint32_t failedAttempts = 0;
                 while (m_active)
                 {
-                    m_busy = false;
-                    m_semaphore.acquire();
+                    Task* task = FindTask();
+                    if (task)
+                    {
+                        failedAttempts = 0;
+                        Execute(task);
+                        continue;
+                    }
 
-                    if (!m_active)
+                    if (++failedAttempts < SpinCount)
                     {
-                        return;
+                        AZStd::this_thread::pause(failedAttempts);
+                        continue;
                     }
 
-                    m_busy = true;
+                    // Advertise that we are going to sleep, then check for work one more time. Submitters publish
+                    // their task before checking the sleeping flag so one of the two sides always sees the other.
+                    ++m_executor->m_sleepingWorkers;
+                    m_sleeping.store(true);
 
-                    Task* task = m_queue.TryDequeue();
-                    while (task)
+                    task = FindTask();
+                    if (task)
                     {
-                        task->Invoke();
-                        // Decrement counts for all task successors
-                        for (size_t j = 0; j != task->m_outboundLinkCount; ++j)
+                        if (m_sleeping.exchange(false))
                         {
-                            Task* successor = task->m_graph->m_successors[task->m_successorOffset + j];
-                            if (--successor->m_dependencyCount == 0)
-                            {
-                                m_executor->Submit(*successor);
-                            }
+                            --m_executor->m_sleepingWorkers;
                         }
+                        // Otherwise a submitter already woke us up and the semaphore will just return immediately
+                        // next time we sleep
+                        failedAttempts = 0;
+                        Execute(task);
+                        continue;
+                    }
+
+                    if (!m_active)
+                    {
+                        return;
+                    }
+
+                    m_semaphore.acquire();
+                    failedAttempts = 0;
+                }
+            }
+
+            void Execute(Task* task)
+            {
+                task->Invoke();
+                // Decrement counts for all task successors
+                for (size_t j = 0; j != task->m_outboundLinkCount; ++j)
+                {
+                    Task* successor = task->m_graph->m_successors[task->m_successorOffset + j];
+                    if (--successor->m_dependencyCount == 0)
+                    {
+                        // All predecessors are done, rearm the counter for the next submission of the graph
+                        successor->Init();
+                        m_executor->Submit(*successor);
+                    }
+                }
+
+                bool isRetained = task->m_graph->m_parent != nullptr;
+                if (task->m_graph->Release() == (isRetained ? 1u : 0u))
+                {
+                    m_executor->ReleaseGraph();
+                }
+            }
+
+            // Looks for work in priority order. Within a priority level, the local deque is checked first (most
+            // recently pushed tasks are the most likely to be cache-hot), then this worker's own queue, the
+            // executor's shared queue, and finally the other workers' deques.
+            Task* FindTask()
+            {
+                for (uint8_t priority = 0; priority != TaskQueue::PriorityLevelCount; ++priority)
+                {
+                    if (Task* task = m_deques[priority].Pop())
+                    {
+                        return task;
+                    }
+
+                    if (Task* task = m_queue.TryDequeue(priority))
+                    {
+                        return task;
+                    }
+
+                    if (Task* task = m_executor->m_sharedQueue->TryDequeue(priority))
+                    {
+                        return task;
+                    }
+
+                    if (Task* task = Steal(priority))
+                    {
+                        return task;
+                    }
+                }
+
+                return nullptr;
+            }
 
-                        bool isRetained = task->m_graph->m_parent != nullptr;
-                        if (task->m_graph->Release() == (isRetained ? 1u : 0u))
+            Task* Steal(uint8_t priority)
+            {
+                const uint32_t threadCount = m_executor->m_threadCount;
+                if (threadCount < 2)
+                {
+                    return nullptr;
+                }
+
+                // Start at a random victim to spread thieves over the workers
+                m_randomState ^= m_randomState << 13;
+                m_randomState ^= m_randomState >> 17;
+                m_randomState ^= m_randomState << 5;
+                const uint32_t start = m_randomState % threadCount;
+
+                for (uint32_t i = 0; i != threadCount; ++i)
+                {
+                    TaskWorker& victim = m_executor->m_workers[(start + i) % threadCount];
+                    if (&victim == this)
+                    {
+                        continue;
+                    }
+
+                    if (Task* task = victim.m_deques[priority].Steal())
+                    {
+                        if (!victim.m_deques[priority].IsEmpty())
                         {
-                            m_executor->ReleaseGraph();
+                            // There is more work to steal, get another worker going
+                            m_executor->WakeOne();
                         }
-
-                        task = m_queue.TryDequeue();
+                        return task;
                     }
                 }
+
+                return nullptr;
             }
 
             AZStd::thread m_thread;
             AZStd::atomic<bool> m_active;
-            AZStd::atomic<bool> m_busy;
+            AZStd::atomic<bool> m_sleeping{ false };
             AZStd::binary_semaphore m_semaphore;
 
             ::AZ::TaskExecutor* m_executor;
+            uint32_t m_id = 0;
+            uint32_t m_randomState = 1;
+            TaskDeque m_deques[TaskQueue::PriorityLevelCount];
             TaskQueue m_queue;
         };
     } // namespace Internal
@@ -305,15 +601,21 @@ namespace AZ
         // TODO: Configure thread count + affinity based on configuration
         m_threadCount = threadCount == 0 ? AZStd::thread::hardware_concurrency() : threadCount;
 
+        m_sharedQueue = aznew Internal::TaskQueue;
         m_workers = reinterpret_cast<Internal::TaskWorker*>(azmalloc(m_threadCount * sizeof(Internal::TaskWorker)));
 
         bool affinitize = m_threadCount == AZStd::thread::hardware_concurrency();
 
         AZStd::semaphore initSemaphore;
 
+        // Construct all workers before spawning any threads, since workers steal from each other
         for (size_t i = 0; i != m_threadCount; ++i)
         {
             new (m_workers + i) Internal::TaskWorker{};
+        }
+
+        for (size_t i = 0; i != m_threadCount; ++i)
+        {
             m_workers[i].Spawn(*this, i, initSemaphore, affinitize);
         }
 
@@ -328,31 +630,88 @@ namespace AZ
         for (size_t i = 0; i != m_threadCount; ++i)
         {
             m_workers[i].Join();
+        }
+
+        for (size_t i = 0; i != m_threadCount; ++i)
+        {
             m_workers[i].~TaskWorker();
         }
 
         azfree(m_workers);
+        delete m_sharedQueue;
     }
 
     void TaskExecutor::Submit(Internal::CompiledTaskGraph& graph)
     {
         ++m_graphsRemaining;
         // Submit all tasks that have no inbound edges
-        for (Internal::Task& task : graph.Tasks())
+        for (Internal::Task* task : graph.Roots())
         {
-            if (task.IsRoot())
+            Submit(*task);
+        }
+    }
+
+    void TaskExecutor::Submit(Internal::Task& task)
+    {
+        Internal::TaskWorker* currentWorker = Internal::s_currentWorker;
+        if (currentWorker && currentWorker->GetExecutor() != this)
+        {
+            currentWorker = nullptr;
+        }
+
+        // The cpuMask selects workers by index, workers past the width of the mask only run unaffinitized tasks.
+        // Masks that don't select any of our workers are ignored.
+        const uint32_t maskableWorkers = AZStd::min(m_threadCount, MaxMaskableWorkers);
+        const uint64_t allWorkersMask = maskableWorkers == MaxMaskableWorkers ? ~0ull : (1ull << maskableWorkers) - 1;
+        const uint64_t cpuMask = task.GetCpuMask() & allWorkersMask;
+        if (cpuMask == 0 || (cpuMask == allWorkersMask && maskableWorkers == m_threadCount))
+        {
+            if (currentWorker)
             {
-                Submit(task);
+                // Tasks spawned from a worker stay on its deque where they are cache-hot, idle workers steal them
+                currentWorker->PushLocal(&task);
             }
+            else
+            {
+                m_sharedQueue->Enqueue(&task);
+            }
+            WakeOne();
+            return;
+        }
+
+        // Affinitized tasks can't be stolen, hand them to one of the allowed workers directly
+        if (currentWorker && currentWorker->GetId() < maskableWorkers && (cpuMask & (1ull << currentWorker->GetId())))
+        {
+            currentWorker->Enqueue(&task);
+            return;
         }
+
+        // cpuMask has at least one bit below maskableWorkers set, so this terminates
+        uint32_t index = ++m_lastSubmission % maskableWorkers;
+        while (!(cpuMask & (1ull << index)))
+        {
+            index = (index + 1) % maskableWorkers;
+        }
+        m_workers[index].Enqueue(&task);
     }
 
-    void TaskExecutor::Submit(Internal::Task& task)
+    void TaskExecutor::WakeOne()
     {
-        // TODO: Something more sophisticated is likely needed here.
-        // First, we are completely ignoring affinity.
-        // Second, some heuristics on core availability will help distribute work more effectively
-        m_workers[++m_lastSubmission % m_threadCount].Enqueue(&task);
+        // Orders the publication of the task before the check for sleeping workers
+        AZStd::atomic_thread_fence(AZStd::memory_order_seq_cst);
+        if (m_sleepingWorkers.load() == 0)
+        {
+            return;
+        }
+
+        const uint32_t start = ++m_lastWake;
+        for (uint32_t i = 0; i != m_threadCount; ++i)
+        {
+            if (m_workers[(start + i) % m_threadCount].Wake())
+            {
+                return;
+            }
+        }
     }
 
     void TaskExecutor::ReleaseGraph()
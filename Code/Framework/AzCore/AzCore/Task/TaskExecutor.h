@@ -39,6 +39,12 @@ namespace AZ
                 return m_tasks;
             }
 
+            // Tasks without inbound edges, which are dispatched when the graph is submitted
+            AZStd::vector<Task*>& Roots() noexcept
+            {
+                return m_roots;
+            }
+
             // Indicate that a constituent task has finished and decrement a counter to determine if the
             // graph should be freed (returns the value after atomic decrement)
             uint32_t Release();
@@ -48,6 +54,7 @@ namespace AZ
             friend class TaskWorker;
 
             AZStd::vector<Task> m_tasks;
+            AZStd::vector<Task*> m_roots;
             AZStd::vector<Task*> m_successors;
             TaskGraphEvent* m_waitEvent = nullptr;
             // The pointer to the parent graph is set only if it is retained
@@ -56,6 +63,7 @@ namespace AZ
         };
 
         class TaskWorker;
+        class TaskQueue;
     } // namespace Internal
 
     class TaskExecutor final
@@ -68,6 +76,9 @@ namespace AZ
         // Invoked by a system component on program launch
         static void SetInstance(TaskExecutor* executor);
 
+        // Number of workers that TaskDescriptor::cpuMask can address
+        static constexpr uint32_t MaxMaskableWorkers = 64;
+
         // Passing 0 for the threadCount requests for the thread count to match the hardware concurrency
         explicit TaskExecutor(uint32_t threadCount = 0);
         ~TaskExecutor();
@@ -76,14 +87,27 @@ namespace AZ
 
         void Submit(Internal::Task& task);
 
+        uint32_t GetThreadCount() const
+        {
+            return m_threadCount;
+        }
+
     private:
         friend class Internal::TaskWorker;
 
         void ReleaseGraph();
 
+        // Wake a single sleeping worker (if any) so it can pick up or steal newly available work
+        void WakeOne();
+
         Internal::TaskWorker* m_workers;
+        // Tasks submitted from outside the executor's workers without an affinity restriction land
+        // here and are picked up by whichever worker gets to them first
+        Internal::TaskQueue* m_sharedQueue = nullptr;
         uint32_t m_threadCount = 0;
         AZStd::atomic<uint32_t> m_lastSubmission;
+        AZStd::atomic<uint32_t> m_lastWake{ 0 };
+        AZStd::atomic<uint32_t> m_sleepingWorkers{ 0 };
         AZStd::atomic<uint64_t> m_graphsRemaining;
     };
 } // namespace AZ
@@ -9,6 +9,7 @@
 #include <AzCore/Task/TaskGraph.h>
 
 #include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/std/parallel/exponential_backoff.h>
 
 namespace AZ
 {
@@ -17,6 +18,7 @@ namespace AZ
     void TaskToken::PrecedesInternal(TaskToken& comesAfter)
     {
         AZ_Assert(!m_parent.m_submitted, "Cannot mutate a TaskGraph that was previously submitted.");
+        AZ_Assert(!m_parent.m_compiledTaskGraph, "Cannot mutate a TaskGraph that was compiled, Reset it first.");
 
         // Increment inbound/outbound edge counts
         m_parent.m_tasks[m_index].Link(m_parent.m_tasks[comesAfter.m_index]);
@@ -30,6 +32,8 @@ namespace AZ
     {
         if (m_retained && m_compiledTaskGraph)
         {
+            WaitForRelease();
+
             // This job graph has already finished and we are potentially responsible for its destruction
             if (m_compiledTaskGraph->Release() == 0)
             {
@@ -40,6 +44,7 @@ namespace AZ
 
     void TaskGraph::Reset()
     {
+        WaitForRelease();
         AZ_Assert(!m_submitted, "Cannot reset a job graph while it is in flight");
         if (m_compiledTaskGraph)
         {
@@ -51,36 +56,80 @@ namespace AZ
         m_linkCount = 0;
     }
 
+    bool TaskGraph::IsSettled() const
+    {
+        WaitForRelease();
+        return !m_submitted.load(AZStd::memory_order_acquire);
+    }
+
+    void TaskGraph::WaitForRelease() const
+    {
+        // Once only the graph's own reference is left, all tasks have finished and the flag is about to clear
+        if (m_submitted.load(AZStd::memory_order_acquire) && m_compiledTaskGraph->m_remaining == 1)
+        {
+            AZStd::exponential_backoff backoff;
+            while (m_submitted.load(AZStd::memory_order_acquire))
+            {
+                backoff.wait();
+            }
+        }
+    }
+
     void TaskGraph::Submit(TaskGraphEvent* waitEvent)
     {
         SubmitOnExecutor(TaskExecutor::Instance(), waitEvent);
     }
 
-    void TaskGraph::SubmitOnExecutor(TaskExecutor& executor, TaskGraphEvent* waitEvent)
+    void TaskGraph::Compile()
     {
+        AZ_Assert(IsSettled(), "Cannot compile a TaskGraph while it is in flight");
         if (!m_compiledTaskGraph)
         {
             m_compiledTaskGraph = aznew CompiledTaskGraph(AZStd::move(m_tasks), m_links, m_linkCount, m_retained ? this : nullptr);
+
+            // The topology now lives in the compiled graph
+            m_tasks = {};
+            m_links = {};
         }
+    }
+
+    void TaskGraph::SubmitOnExecutor(TaskExecutor& executor, TaskGraphEvent* waitEvent)
+    {
+        WaitForRelease();
+        AZ_Assert(!m_submitted, "Cannot submit a retained TaskGraph while a previous submission is in flight");
+        Compile();
 
-        m_compiledTaskGraph->m_waitEvent = waitEvent;
         uint32_t taskCount = aznumeric_cast<uint32_t>(m_compiledTaskGraph->m_tasks.size());
-        m_compiledTaskGraph->m_remaining = taskCount + (m_retained ? 1 : 0);
-        for (uint32_t i = 0; i != taskCount; ++i)
+        if (taskCount == 0)
         {
-            m_compiledTaskGraph->m_tasks[i].Init();
+            // Nothing will ever release the graph, so complete the submission right away
+            if (waitEvent)
+            {
+                waitEvent->Signal();
+            }
+            if (!m_retained)
+            {
+                Reset();
+            }
+            return;
         }
 
-        executor.Submit(*m_compiledTaskGraph);
+        m_compiledTaskGraph->m_waitEvent = waitEvent;
+        m_compiledTaskGraph->m_remaining = taskCount + (m_retained ? 1 : 0);
 
         if (m_retained)
         {
+            // Flag the submission before any task runs, the last task to finish clears it again
             m_submitted = true;
+            executor.Submit(*m_compiledTaskGraph);
         }
         else
         {
+            // The compiled graph frees itself once all tasks are done and may not be touched after submission
+            CompiledTaskGraph* compiledTaskGraph = m_compiledTaskGraph;
             m_compiledTaskGraph = nullptr;
             Reset();
+            executor.Submit(*compiledTaskGraph);
         }
     }
 }
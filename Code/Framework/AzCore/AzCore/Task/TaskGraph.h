@@ -116,11 +116,24 @@ namespace AZ
         // NOTE: This operation is invalid if the graph is in-flight
         void Detach();
 
-        // Invoke the task graph, asserting if there are dependency violations. Note that
-        // submitting the same graph multiple times to process simultaneously is VALID
-        // behavior. This is, for example, a mechanism that allows a task graph to loop
-        // in perpetuity (in fact, the entire frame could be modeled as a single task graph,
-        // where the final task resubmits the task graph again).
+        // Compile the recorded tasks and edges ahead of the first submission. A retained graph is compiled
+        // once, after which it may be submitted any number of times without allocating: dependency counters
+        // are rearmed in place as tasks are released. Submitting an uncompiled graph compiles it implicitly.
+        // After compilation, no tasks or edges may be added until the graph is Reset.
+        // NOTE: This operation is invalid if the graph is in-flight
+        void Compile();
+
+        // Indicates if the graph has been compiled and can be resubmitted as is
+        bool IsCompiled() const;
+
+        // Indicates if the graph has finished executing (or was never submitted), meaning it may be
+        // resubmitted, reset or destroyed
+        bool IsSettled() const;
+
+        // Invoke the task graph, asserting if there are dependency violations. A retained graph
+        // may be submitted again once the previous submission has settled (see IsSettled), for
+        // example once per frame. Since the dependency counters live in the compiled graph, the
+        // same graph cannot be in flight more than once at a time.
         //
         // This API is not designed to protect against memory safety violations (nothing
         // can prevent a user from incorrectly aliasing memory unsafely even without repeated
@@ -135,6 +148,10 @@ namespace AZ
         friend class TaskToken;
         friend class Internal::CompiledTaskGraph;
 
+        // The last task of a submission signals the wait event before it settles the graph. Waits out
+        // that window so callers woken by the event may resubmit, reset or destroy the graph right away
+        void WaitForRelease() const;
+
         Internal::CompiledTaskGraph* m_compiledTaskGraph = nullptr;
 
         AZStd::vector<Internal::Task> m_tasks;
@@ -47,6 +47,7 @@ namespace AZ
     TaskToken TaskGraph::AddTask(TaskDescriptor const& desc, Lambda&& lambda)
     {
         AZ_Assert(!m_submitted, "Cannot mutate a TaskGraph that was previously submitted or in flight.");
+        AZ_Assert(!m_compiledTaskGraph, "Cannot mutate a TaskGraph that was compiled, Reset it first.");
 
         m_tasks.emplace_back(desc, AZStd::forward<Lambda>(lambda));
 
@@ -61,6 +62,12 @@ namespace AZ
 
     inline void TaskGraph::Detach()
     {
+        AZ_Assert(!m_compiledTaskGraph, "A compiled TaskGraph must remain retained.");
         m_retained = false;
     }
+
+    inline bool TaskGraph::IsCompiled() const
+    {
+        return m_compiledTaskGraph != nullptr;
+    }
 } // namespace AZ
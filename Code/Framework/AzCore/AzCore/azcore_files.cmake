@@ -104,6 +104,8 @@ set(FILES
     Debug/Profiler.cpp
     Debug/Profiler.h
     Debug/ProfilerBus.h
+    Debug/ProfileTracer.cpp
+    Debug/ProfileTracer.h
     Debug/ProfilerDriller.cpp
     Debug/ProfilerDriller.h
     Debug/ProfilerDrillerBus.h
@@ -184,6 +186,8 @@ set(FILES
     IO/TextStreamWriters.h
     IO/Streamer/BlockCache.h
     IO/Streamer/BlockCache.cpp
+    IO/Streamer/ChunkedDecompressor.h
+    IO/Streamer/ChunkedDecompressor.cpp
     IO/Streamer/DedicatedCache.h
     IO/Streamer/DedicatedCache.cpp
     IO/Streamer/FileRange.h
@@ -193,6 +197,8 @@ set(FILES
     IO/Streamer/FileRequest.cpp
     IO/Streamer/FullFileDecompressor.h
     IO/Streamer/FullFileDecompressor.cpp
+    IO/Streamer/ReadCoalescer.h
+    IO/Streamer/ReadCoalescer.cpp
     IO/Streamer/ReadSplitter.h
     IO/Streamer/ReadSplitter.cpp
     IO/Streamer/RequestPath.h
@@ -374,6 +380,8 @@ set(FILES
     Memory/BestFitExternalMapSchema.h
     Memory/Config.h
     Memory/dlmalloc.inl
+    Memory/FrameArenaAllocator.cpp
+    Memory/FrameArenaAllocator.h
     Memory/HeapSchema.h
     Memory/HphaSchema.cpp
     Memory/HphaSchema.h
@@ -528,6 +536,8 @@ set(FILES
     Serialization/Json/JsonSerializationSettings.h
     Serialization/Json/JsonSerializer.h
     Serialization/Json/JsonSerializer.cpp
+    Serialization/Json/JsonStreamingDeserializer.h
+    Serialization/Json/JsonStreamingDeserializer.cpp
     Serialization/Json/JsonStringConversionUtils.h
     Serialization/Json/JsonSystemComponent.h
     Serialization/Json/JsonSystemComponent.cpp
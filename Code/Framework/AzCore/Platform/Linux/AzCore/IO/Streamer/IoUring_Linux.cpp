@@ -0,0 +1,317 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Debug/Trace.h>
+#include <AzCore/IO/Streamer/IoUring_Linux.h>
+#include <AzCore/std/algorithm.h>
+
+#if __has_include(<linux/io_uring.h>)
+#   include <linux/io_uring.h>
+#endif
+
+// IORING_OP_READ and IORING_FEAT_RW_CUR_POS were both introduced in Linux 5.6. Older kernel headers only support vectored
+// reads, in which case the drive will fall back to the thread pool.
+#if defined(IORING_FEAT_RW_CUR_POS) && defined(__NR_io_uring_setup)
+#   define AZ_STREAMER_HAS_IO_URING 1
+#else
+#   define AZ_STREAMER_HAS_IO_URING 0
+#endif
+
+namespace AZ::IO
+{
+#if AZ_STREAMER_HAS_IO_URING
+    namespace IoUringInternal
+    {
+        static int Setup(u32 entries, io_uring_params* params)
+        {
+            return aznumeric_cast<int>(::syscall(__NR_io_uring_setup, entries, params));
+        }
+
+        static int Enter(int ringDescriptor, u32 toSubmit, u32 minComplete, u32 flags)
+        {
+            return aznumeric_cast<int>(::syscall(__NR_io_uring_enter, ringDescriptor, toSubmit, minComplete, flags, nullptr, 0));
+        }
+
+        static int Register(int ringDescriptor, u32 opcode, const void* arg, u32 argCount)
+        {
+            return aznumeric_cast<int>(::syscall(__NR_io_uring_register, ringDescriptor, opcode, arg, argCount));
+        }
+
+        template<typename T>
+        T* Offset(void* base, u32 offset)
+        {
+            return reinterpret_cast<T*>(reinterpret_cast<u8*>(base) + offset);
+        }
+    } // namespace IoUringInternal
+
+    IoUringQueue::~IoUringQueue()
+    {
+        Shutdown();
+    }
+
+    bool IoUringQueue::Initialize(u32 queueDepth, int completionEvent)
+    {
+        using namespace IoUringInternal;
+
+        AZ_Assert(!IsInitialized(), "IoUringQueue has already been initialized.");
+
+        io_uring_params params;
+        ::memset(&params, 0, sizeof(params));
+        m_ringDescriptor = Setup(queueDepth, &params);
+        if (m_ringDescriptor < 0)
+        {
+            m_ringDescriptor = -1;
+            return false;
+        }
+        if ((params.features & IORING_FEAT_RW_CUR_POS) == 0)
+        {
+            // The kernel predates IORING_OP_READ.
+            Shutdown();
+            return false;
+        }
+
+        m_submission.m_mappingSize = params.sq_off.array + params.sq_entries * sizeof(u32);
+        m_completion.m_mappingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        const bool singleMapping = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (singleMapping)
+        {
+            m_submission.m_mappingSize = AZStd::max(m_submission.m_mappingSize, m_completion.m_mappingSize);
+        }
+
+        m_submission.m_mapping = ::mmap(nullptr, m_submission.m_mappingSize, PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_POPULATE, m_ringDescriptor, IORING_OFF_SQ_RING);
+        if (m_submission.m_mapping == MAP_FAILED)
+        {
+            m_submission.m_mapping = nullptr;
+            Shutdown();
+            return false;
+        }
+
+        if (singleMapping)
+        {
+            m_completion.m_mapping = m_submission.m_mapping;
+        }
+        else
+        {
+            m_completion.m_mapping = ::mmap(nullptr, m_completion.m_mappingSize, PROT_READ | PROT_WRITE,
+                MAP_SHARED | MAP_POPULATE, m_ringDescriptor, IORING_OFF_CQ_RING);
+            if (m_completion.m_mapping == MAP_FAILED)
+            {
+                m_completion.m_mapping = nullptr;
+                Shutdown();
+                return false;
+            }
+        }
+
+        m_submission.m_entriesSize = params.sq_entries * sizeof(io_uring_sqe);
+        void* entries = ::mmap(nullptr, m_submission.m_entriesSize, PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_POPULATE, m_ringDescriptor, IORING_OFF_SQES);
+        if (entries == MAP_FAILED)
+        {
+            Shutdown();
+            return false;
+        }
+        m_submission.m_entries = reinterpret_cast<io_uring_sqe*>(entries);
+
+        m_submission.m_head = Offset<u32>(m_submission.m_mapping, params.sq_off.head);
+        m_submission.m_tail = Offset<u32>(m_submission.m_mapping, params.sq_off.tail);
+        m_submission.m_ringMask = Offset<u32>(m_submission.m_mapping, params.sq_off.ring_mask);
+        m_submission.m_array = Offset<u32>(m_submission.m_mapping, params.sq_off.array);
+        m_submission.m_entryCount = params.sq_entries;
+
+        m_completion.m_head = Offset<u32>(m_completion.m_mapping, params.cq_off.head);
+        m_completion.m_tail = Offset<u32>(m_completion.m_mapping, params.cq_off.tail);
+        m_completion.m_ringMask = Offset<u32>(m_completion.m_mapping, params.cq_off.ring_mask);
+        m_completion.m_entries = Offset<io_uring_cqe>(m_completion.m_mapping, params.cq_off.cqes);
+
+        m_localTail = *m_submission.m_tail;
+        m_numQueued = 0;
+
+        if (completionEvent >= 0)
+        {
+            if (Register(m_ringDescriptor, IORING_REGISTER_EVENTFD, &completionEvent, 1) != 0)
+            {
+                AZ_Warning("IoUringQueue", false, "Failed to register completion eventfd with io_uring (Error: %i).\n", errno);
+                Shutdown();
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void IoUringQueue::Shutdown()
+    {
+        if (m_submission.m_entries)
+        {
+            ::munmap(m_submission.m_entries, m_submission.m_entriesSize);
+        }
+        if (m_completion.m_mapping && m_completion.m_mapping != m_submission.m_mapping)
+        {
+            ::munmap(m_completion.m_mapping, m_completion.m_mappingSize);
+        }
+        if (m_submission.m_mapping)
+        {
+            ::munmap(m_submission.m_mapping, m_submission.m_mappingSize);
+        }
+        if (m_ringDescriptor >= 0)
+        {
+            ::close(m_ringDescriptor);
+        }
+
+        m_submission = SubmissionRing{};
+        m_completion = CompletionRing{};
+        m_ringDescriptor = -1;
+        m_localTail = 0;
+        m_numQueued = 0;
+    }
+
+    bool IoUringQueue::IsInitialized() const
+    {
+        return m_ringDescriptor >= 0;
+    }
+
+    u32 IoUringQueue::GetCapacity() const
+    {
+        return m_submission.m_entryCount;
+    }
+
+    bool IoUringQueue::QueueRead(int fileDescriptor, void* output, u32 size, u64 offset, u64 userData)
+    {
+        AZ_Assert(IsInitialized(), "Queuing a read on an IoUringQueue that hasn't been initialized.");
+
+        const u32 head = __atomic_load_n(m_submission.m_head, __ATOMIC_ACQUIRE);
+        if (m_localTail - head >= m_submission.m_entryCount)
+        {
+            return false;
+        }
+
+        const u32 index = m_localTail & *m_submission.m_ringMask;
+        io_uring_sqe& entry = m_submission.m_entries[index];
+        ::memset(&entry, 0, sizeof(entry));
+        entry.opcode = IORING_OP_READ;
+        entry.fd = fileDescriptor;
+        entry.addr = reinterpret_cast<u64>(output);
+        entry.len = size;
+        entry.off = offset;
+        entry.user_data = userData;
+
+        m_submission.m_array[index] = index;
+        m_localTail++;
+        m_numQueued++;
+        return true;
+    }
+
+    s32 IoUringQueue::Submit()
+    {
+        if (m_numQueued == 0)
+        {
+            return 0;
+        }
+
+        // Publish the new entries to the kernel before asking it to process them.
+        __atomic_store_n(m_submission.m_tail, m_localTail, __ATOMIC_RELEASE);
+
+        int result;
+        do
+        {
+            result = IoUringInternal::Enter(m_ringDescriptor, m_numQueued, 0, 0);
+        } while (result < 0 && errno == EINTR);
+
+        if (result < 0)
+        {
+            return -errno;
+        }
+        m_numQueued -= AZStd::min(m_numQueued, aznumeric_cast<u32>(result));
+        return result;
+    }
+
+    bool IoUringQueue::PopQueued(u64& userData)
+    {
+        if (m_numQueued == 0)
+        {
+            return false;
+        }
+
+        // The kernel only consumes submission entries during io_uring_enter, so entries it hasn't accepted can be taken
+        // back by moving the tail.
+        m_localTail--;
+        m_numQueued--;
+        userData = m_submission.m_entries[m_localTail & *m_submission.m_ringMask].user_data;
+        __atomic_store_n(m_submission.m_tail, m_localTail, __ATOMIC_RELEASE);
+        return true;
+    }
+
+    bool IoUringQueue::PopCompletion(u64& userData, s32& result)
+    {
+        const u32 head = *m_completion.m_head;
+        const u32 tail = __atomic_load_n(m_completion.m_tail, __ATOMIC_ACQUIRE);
+        if (head == tail)
+        {
+            return false;
+        }
+
+        const io_uring_cqe& entry = m_completion.m_entries[head & *m_completion.m_ringMask];
+        userData = entry.user_data;
+        result = entry.res;
+        // Release the entry back to the kernel.
+        __atomic_store_n(m_completion.m_head, head + 1, __ATOMIC_RELEASE);
+        return true;
+    }
+
+#else // AZ_STREAMER_HAS_IO_URING
+
+    IoUringQueue::~IoUringQueue() = default;
+
+    bool IoUringQueue::Initialize([[maybe_unused]] u32 queueDepth, [[maybe_unused]] int completionEvent)
+    {
+        return false;
+    }
+
+    void IoUringQueue::Shutdown()
+    {
+    }
+
+    bool IoUringQueue::IsInitialized() const
+    {
+        return false;
+    }
+
+    u32 IoUringQueue::GetCapacity() const
+    {
+        return 0;
+    }
+
+    bool IoUringQueue::QueueRead([[maybe_unused]] int fileDescriptor, [[maybe_unused]] void* output, [[maybe_unused]] u32 size,
+        [[maybe_unused]] u64 offset, [[maybe_unused]] u64 userData)
+    {
+        return false;
+    }
+
+    s32 IoUringQueue::Submit()
+    {
+        return -ENOSYS;
+    }
+
+    bool IoUringQueue::PopQueued([[maybe_unused]] u64& userData)
+    {
+        return false;
+    }
+
+    bool IoUringQueue::PopCompletion([[maybe_unused]] u64& userData, [[maybe_unused]] s32& result)
+    {
+        return false;
+    }
+#endif // AZ_STREAMER_HAS_IO_URING
+} // namespace AZ::IO
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+
+namespace AZ::IO
+{
+    //! Minimal wrapper around a Linux io_uring instance that's only used for reading files. This talks to the kernel
+    //! directly through the io_uring system calls so there's no dependency on liburing. The queue is not thread safe and
+    //! is expected to be used from the Streamer thread only.
+    class IoUringQueue
+    {
+    public:
+        IoUringQueue() = default;
+        ~IoUringQueue();
+
+        IoUringQueue(const IoUringQueue&) = delete;
+        IoUringQueue& operator=(const IoUringQueue&) = delete;
+
+        //! Creates the submission and completion rings.
+        //! @param queueDepth The number of submission entries. The kernel will round this up to the next power of 2.
+        //! @param completionEvent Optional eventfd that will be signaled by the kernel every time a read completes.
+        //!     Use -1 to not register an event.
+        //! @return True if io_uring is available and the queue has been created, otherwise false. False is also returned
+        //!     when running on kernels without io_uring support or when io_uring has been blocked, for instance by seccomp.
+        bool Initialize(u32 queueDepth, int completionEvent);
+        void Shutdown();
+        bool IsInitialized() const;
+
+        //! Returns the number of submission entries that are available.
+        u32 GetCapacity() const;
+
+        //! Adds a read to the submission queue. The read won't be send to the kernel until Submit is called.
+        //! @return False if the submission queue is full.
+        bool QueueRead(int fileDescriptor, void* output, u32 size, u64 offset, u64 userData);
+        //! Sends all queued reads to the kernel.
+        //! @return The number of reads that were accepted by the kernel or a negative errno value on failure.
+        s32 Submit();
+        //! Takes back the most recently queued read that the kernel hasn't accepted yet. Used to fail reads that can't be
+        //! submitted after Submit returned an error.
+        //! @param userData The user data that was provided when the read was queued.
+        //! @return True if a queued read was taken back, otherwise false.
+        bool PopQueued(u64& userData);
+        //! Retrieves the next completed read, if any.
+        //! @param userData The user data that was provided when the read was queued.
+        //! @param result The number of bytes read or a negative errno value if the read failed.
+        //! @return True if a completion was retrieved, otherwise false.
+        bool PopCompletion(u64& userData, s32& result);
+
+    private:
+        struct SubmissionRing
+        {
+            u32* m_head{ nullptr };
+            u32* m_tail{ nullptr };
+            u32* m_ringMask{ nullptr };
+            u32* m_array{ nullptr };
+            io_uring_sqe* m_entries{ nullptr };
+            void* m_mapping{ nullptr };
+            size_t m_mappingSize{ 0 };
+            size_t m_entriesSize{ 0 };
+            u32 m_entryCount{ 0 };
+        };
+
+        struct CompletionRing
+        {
+            u32* m_head{ nullptr };
+            u32* m_tail{ nullptr };
+            u32* m_ringMask{ nullptr };
+            io_uring_cqe* m_entries{ nullptr };
+            void* m_mapping{ nullptr };
+            size_t m_mappingSize{ 0 };
+        };
+
+        SubmissionRing m_submission;
+        CompletionRing m_completion;
+        int m_ringDescriptor{ -1 };
+        u32 m_localTail{ 0 };
+        u32 m_numQueued{ 0 };
+    };
+} // namespace AZ::IO
@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/Streamer/MemoryMappedDriveConfig_Linux.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+namespace AZ::IO
+{
+    AZStd::shared_ptr<StreamStackEntry> LinuxMemoryMappedDriveConfig::AddStreamStackEntry(
+        [[maybe_unused]] const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent)
+    {
+        auto stackEntry = AZStd::make_shared<MemoryMappedDriveLinux>(
+            m_archiveExtensions, m_maxMappedFiles, m_evictionPolicy, m_prefetch);
+        stackEntry->SetNext(AZStd::move(parent));
+        return stackEntry;
+    }
+
+    void LinuxMemoryMappedDriveConfig::Reflect(ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<SerializeContext*>(context); serializeContext != nullptr)
+        {
+            serializeContext->Enum<MemoryMappedDriveLinux::EvictionPolicy>()
+                ->Version(1)
+                ->Value("None", MemoryMappedDriveLinux::EvictionPolicy::None)
+                ->Value("Cold", MemoryMappedDriveLinux::EvictionPolicy::Cold)
+                ->Value("PageOut", MemoryMappedDriveLinux::EvictionPolicy::PageOut)
+                ->Value("DontNeed", MemoryMappedDriveLinux::EvictionPolicy::DontNeed);
+
+            serializeContext->Class<LinuxMemoryMappedDriveConfig, IStreamerStackConfig>()
+                ->Version(1)
+                ->Field("ArchiveExtensions", &LinuxMemoryMappedDriveConfig::m_archiveExtensions)
+                ->Field("MaxMappedFiles", &LinuxMemoryMappedDriveConfig::m_maxMappedFiles)
+                ->Field("EvictionPolicy", &LinuxMemoryMappedDriveConfig::m_evictionPolicy)
+                ->Field("Prefetch", &LinuxMemoryMappedDriveConfig::m_prefetch);
+        }
+    }
+} // namespace AZ::IO
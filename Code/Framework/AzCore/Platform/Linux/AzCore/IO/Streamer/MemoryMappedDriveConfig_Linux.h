@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/Streamer/MemoryMappedDrive_Linux.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+
+namespace AZ::IO
+{
+    class LinuxMemoryMappedDriveConfig final :
+        public IStreamerStackConfig
+    {
+    public:
+        AZ_RTTI(AZ::IO::LinuxMemoryMappedDriveConfig, "{4F1B7C3D-2E8A-4B65-A9D0-7C3E5F1A2B86}", IStreamerStackConfig);
+        AZ_CLASS_ALLOCATOR(LinuxMemoryMappedDriveConfig, SystemAllocator, 0);
+
+        ~LinuxMemoryMappedDriveConfig() override = default;
+        AZStd::shared_ptr<StreamStackEntry> AddStreamStackEntry(
+            const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent) override;
+        static void Reflect(ReflectContext* context);
+
+    private:
+        AZStd::vector<AZStd::string> m_archiveExtensions{ ".pak" };
+        AZ::u32 m_maxMappedFiles{ 16 };
+        MemoryMappedDriveLinux::EvictionPolicy m_evictionPolicy{ MemoryMappedDriveLinux::EvictionPolicy::None };
+        bool m_prefetch{ true };
+    };
+} // namespace AZ::IO
@@ -0,0 +1,426 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <fcntl.h>
+#include <strings.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/Streamer/MemoryMappedDrive_Linux.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/typetraits/decay.h>
+
+namespace AZ::IO
+{
+    static constexpr char MappedFilesName[] = "Mapped files";
+    static constexpr char MappingsCreatedName[] = "Mappings created";
+    static constexpr char MappedReadsName[] = "Reads from mapping";
+    static constexpr char ForwardedReadsName[] = "Reads forwarded";
+    static constexpr char ReadSpeedName[] = "Read speed (avg. mbps)";
+    static constexpr char MapTimeName[] = "Map file (avg. us)";
+
+    static int EvictionPolicyToAdvice(MemoryMappedDriveLinux::EvictionPolicy policy)
+    {
+        switch (policy)
+        {
+        case MemoryMappedDriveLinux::EvictionPolicy::Cold:
+#if defined(MADV_COLD)
+            return MADV_COLD;
+#else
+            AZ_Warning("MemoryMappedDriveLinux", false, "MADV_COLD isn't supported on this platform. No pages will be evicted.\n");
+            return MADV_NORMAL;
+#endif
+        case MemoryMappedDriveLinux::EvictionPolicy::PageOut:
+#if defined(MADV_PAGEOUT)
+            return MADV_PAGEOUT;
+#else
+            AZ_Warning("MemoryMappedDriveLinux", false, "MADV_PAGEOUT isn't supported on this platform. No pages will be evicted.\n");
+            return MADV_NORMAL;
+#endif
+        case MemoryMappedDriveLinux::EvictionPolicy::DontNeed:
+            return MADV_DONTNEED;
+        case MemoryMappedDriveLinux::EvictionPolicy::None:
+            // Fall through
+        default:
+            return MADV_NORMAL;
+        }
+    }
+
+    MemoryMappedDriveLinux::MemoryMappedDriveLinux(AZStd::vector<AZStd::string> archiveExtensions, u32 maxMappedFiles,
+        EvictionPolicy evictionPolicy, bool prefetch)
+        : StreamStackEntry("Memory mapped drive")
+        , m_archiveExtensions(AZStd::move(archiveExtensions))
+        , m_pageSize(aznumeric_caster(::sysconf(_SC_PAGESIZE)))
+        , m_maxMappedFiles(AZStd::max(maxMappedFiles, 1u))
+        , m_evictionAdvice(EvictionPolicyToAdvice(evictionPolicy))
+        , m_prefetch(prefetch)
+    {
+        m_mappedFiles.reserve(m_maxMappedFiles);
+
+        // Add initial dummy values to the stats to avoid division by zero later on and avoid needing branches.
+        m_readSizeAverage.PushEntry(1);
+        m_readTimeAverage.PushEntry(AZStd::chrono::microseconds(1));
+    }
+
+    MemoryMappedDriveLinux::~MemoryMappedDriveLinux()
+    {
+        AZ_Assert(m_pendingReads.empty(), "MemoryMappedDriveLinux is being destroyed while there are still %zu reads pending.",
+            m_pendingReads.size());
+        FlushAllMappings();
+    }
+
+    void MemoryMappedDriveLinux::QueueRequest(FileRequest* request)
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+        AZ_Assert(request, "QueueRequest was provided a null request.");
+
+        AZStd::visit([this, request](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, FileRequest::ReadData>)
+            {
+                if (IsArchive(args.m_path))
+                {
+                    size_t index = FindOrMapFile(args.m_path);
+                    if (index != InvalidMappingIndex)
+                    {
+                        if (m_prefetch)
+                        {
+                            // Let the kernel start loading the pages in the background while the read waits in the queue.
+                            Advise(m_mappedFiles[index], args.m_offset, args.m_size, MADV_WILLNEED, true);
+                        }
+                        m_pendingReads.push_back(request);
+                        return;
+                    }
+                    m_numForwardedReads++;
+                }
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::FileExistsCheckData> ||
+                AZStd::is_same_v<Command, FileRequest::FileMetaDataRetrievalData>)
+            {
+                if (FileMetaDataFromMapping(request))
+                {
+                    return;
+                }
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::CancelData>)
+            {
+                CancelPendingReads(args);
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::FlushData>)
+            {
+                FlushMapping(args.m_path);
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::FlushAllData>)
+            {
+                FlushAllMappings();
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::ReportData>)
+            {
+                Report(args);
+            }
+            StreamStackEntry::QueueRequest(request);
+        }, request->GetCommand());
+    }
+
+    bool MemoryMappedDriveLinux::ExecuteRequests()
+    {
+        bool hasWorked = false;
+        // Only process the reads that are currently queued so other entries in the stack get a chance to run
+        // in case a large number of reads is being queued.
+        size_t numReads = m_pendingReads.size();
+        for (size_t i = 0; i < numReads; ++i)
+        {
+            FileRequest* request = m_pendingReads.front();
+            m_pendingReads.pop_front();
+            ReadFromMapping(request);
+            hasWorked = true;
+        }
+        return StreamStackEntry::ExecuteRequests() || hasWorked;
+    }
+
+    void MemoryMappedDriveLinux::UpdateStatus(Status& status) const
+    {
+        StreamStackEntry::UpdateStatus(status);
+        status.m_isIdle = status.m_isIdle && m_pendingReads.empty();
+    }
+
+    void MemoryMappedDriveLinux::UpdateCompletionEstimates(AZStd::chrono::system_clock::time_point now,
+        AZStd::vector<FileRequest*>& internalPending, StreamerContext::PreparedQueue::iterator pendingBegin,
+        StreamerContext::PreparedQueue::iterator pendingEnd)
+    {
+        // Pending reads are served from the mapping and never reach the next entry, so they're estimated here based
+        // on how fast data is copied out of the mappings instead of being added to the internal pending list.
+        const u64 totalBytesRead = m_readSizeAverage.GetTotal();
+        const double totalReadTimeUSec = aznumeric_caster(m_readTimeAverage.GetTotal().count());
+        AZStd::chrono::system_clock::time_point completionTime = now;
+        for (FileRequest* request : m_pendingReads)
+        {
+            auto& data = AZStd::get<FileRequest::ReadData>(request->GetCommand());
+            completionTime += AZStd::chrono::microseconds(aznumeric_cast<u64>((data.m_size * totalReadTimeUSec) / totalBytesRead));
+            request->SetEstimatedCompletion(completionTime);
+        }
+
+        StreamStackEntry::UpdateCompletionEstimates(now, internalPending, pendingBegin, pendingEnd);
+    }
+
+    void MemoryMappedDriveLinux::CollectStatistics(AZStd::vector<Statistic>& statistics) const
+    {
+        constexpr double bytesToMB = aznumeric_cast<double>(1_mib);
+        using DoubleSeconds = AZStd::chrono::duration<double>;
+
+        double totalBytesReadMB = m_readSizeAverage.GetTotal() / bytesToMB;
+        double totalReadTimeSec = AZStd::chrono::duration_cast<DoubleSeconds>(m_readTimeAverage.GetTotal()).count();
+        statistics.push_back(Statistic::CreateInteger(m_name, MappedFilesName, aznumeric_caster(m_mappedFiles.size())));
+        statistics.push_back(Statistic::CreateInteger(m_name, MappingsCreatedName, aznumeric_caster(m_numMappingsCreated)));
+        statistics.push_back(Statistic::CreateInteger(m_name, MappedReadsName, aznumeric_caster(m_numMappedReads)));
+        statistics.push_back(Statistic::CreateInteger(m_name, ForwardedReadsName, aznumeric_caster(m_numForwardedReads)));
+        statistics.push_back(Statistic::CreateFloat(m_name, ReadSpeedName, totalBytesReadMB / totalReadTimeSec));
+        statistics.push_back(Statistic::CreateInteger(m_name, MapTimeName, m_mapTimeAverage.CalculateAverage().count()));
+        StreamStackEntry::CollectStatistics(statistics);
+    }
+
+    size_t MemoryMappedDriveLinux::GetNumMappedFiles() const
+    {
+        return m_mappedFiles.size();
+    }
+
+    bool MemoryMappedDriveLinux::IsArchive(const RequestPath& filePath) const
+    {
+        const char* path = filePath.GetAbsolutePath();
+        const size_t pathLength = strlen(path);
+        for (const AZStd::string& extension : m_archiveExtensions)
+        {
+            if (pathLength >= extension.length() &&
+                strncasecmp(path + pathLength - extension.length(), extension.c_str(), extension.length()) == 0)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    size_t MemoryMappedDriveLinux::FindMapping(const RequestPath& filePath) const
+    {
+        for (size_t i = 0; i < m_mappedFiles.size(); ++i)
+        {
+            if (m_mappedFiles[i].m_path == filePath)
+            {
+                return i;
+            }
+        }
+        return InvalidMappingIndex;
+    }
+
+    size_t MemoryMappedDriveLinux::FindOrMapFile(const RequestPath& filePath)
+    {
+        size_t index = FindMapping(filePath);
+        if (index != InvalidMappingIndex)
+        {
+            return index;
+        }
+
+        AZ_PROFILE_SCOPE(AzCore, "MemoryMappedDriveLinux::FindOrMapFile %s", filePath.GetRelativePath());
+        TIMED_AVERAGE_WINDOW_SCOPE(m_mapTimeAverage);
+
+        int fileDescriptor = ::open(filePath.GetAbsolutePath(), O_RDONLY | O_CLOEXEC);
+        if (fileDescriptor < 0)
+        {
+            return InvalidMappingIndex;
+        }
+
+        struct stat fileInfo;
+        void* address = MAP_FAILED;
+        // Empty files can't be mapped, so those are left to the next entry in the stack.
+        if (::fstat(fileDescriptor, &fileInfo) == 0 && S_ISREG(fileInfo.st_mode) && fileInfo.st_size > 0)
+        {
+            address = ::mmap(nullptr, aznumeric_cast<size_t>(fileInfo.st_size), PROT_READ, MAP_SHARED, fileDescriptor, 0);
+        }
+        // The mapping keeps its own reference to the file so the file descriptor is no longer needed.
+        ::close(fileDescriptor);
+        if (address == MAP_FAILED)
+        {
+            return InvalidMappingIndex;
+        }
+
+        if (m_prefetch)
+        {
+            // Reads into archives rarely touch neighboring files, so skip the kernel's read-ahead on page faults
+            // and rely on the explicit prefetches instead.
+            ::madvise(address, aznumeric_cast<size_t>(fileInfo.st_size), MADV_RANDOM);
+        }
+
+        if (m_mappedFiles.size() >= m_maxMappedFiles)
+        {
+            size_t oldest = 0;
+            for (size_t i = 1; i < m_mappedFiles.size(); ++i)
+            {
+                if (m_mappedFiles[i].m_lastTimeUsed < m_mappedFiles[oldest].m_lastTimeUsed)
+                {
+                    oldest = i;
+                }
+            }
+            UnmapFile(oldest);
+        }
+
+        MappedFile& mappedFile = m_mappedFiles.emplace_back();
+        mappedFile.m_path = filePath;
+        mappedFile.m_lastTimeUsed = AZStd::chrono::system_clock::now();
+        mappedFile.m_address = reinterpret_cast<u8*>(address);
+        mappedFile.m_size = aznumeric_cast<u64>(fileInfo.st_size);
+        m_numMappingsCreated++;
+        return m_mappedFiles.size() - 1;
+    }
+
+    void MemoryMappedDriveLinux::UnmapFile(size_t index)
+    {
+        MappedFile& mappedFile = m_mappedFiles[index];
+        ::munmap(mappedFile.m_address, aznumeric_cast<size_t>(mappedFile.m_size));
+        m_mappedFiles.erase(m_mappedFiles.begin() + index);
+    }
+
+    void MemoryMappedDriveLinux::ReadFromMapping(FileRequest* request)
+    {
+        auto& data = AZStd::get<FileRequest::ReadData>(request->GetCommand());
+
+        AZ_PROFILE_SCOPE(AzCore, "MemoryMappedDriveLinux::ReadFromMapping %s", data.m_path.GetRelativePath());
+
+        // The mapping may have been released by a flush or to make room for other archives since the read was queued.
+        size_t index = FindOrMapFile(data.m_path);
+        if (index == InvalidMappingIndex)
+        {
+            m_numForwardedReads++;
+            StreamStackEntry::QueueRequest(request);
+            return;
+        }
+
+        MappedFile& mappedFile = m_mappedFiles[index];
+        mappedFile.m_lastTimeUsed = AZStd::chrono::system_clock::now();
+        if (data.m_offset > mappedFile.m_size || data.m_size > mappedFile.m_size - data.m_offset)
+        {
+            AZ_Warning("MemoryMappedDriveLinux", false, "Read of %llu bytes at offset %llu goes past the end of '%s' (%llu bytes).\n",
+                data.m_size, data.m_offset, data.m_path.GetRelativePath(), mappedFile.m_size);
+            request->SetStatus(IStreamerTypes::RequestStatus::Failed);
+            m_context->MarkRequestAsCompleted(request);
+            return;
+        }
+        AZ_Assert(data.m_outputSize >= data.m_size, "Output buffer for '%s' is smaller than the requested read size.",
+            data.m_path.GetRelativePath());
+
+        {
+            TIMED_AVERAGE_WINDOW_SCOPE(m_readTimeAverage);
+            memcpy(data.m_output, mappedFile.m_address + data.m_offset, data.m_size);
+        }
+        m_readSizeAverage.PushEntry(data.m_size);
+        m_numMappedReads++;
+
+        if (m_evictionAdvice != MADV_NORMAL)
+        {
+            Advise(mappedFile, data.m_offset, data.m_size, m_evictionAdvice, false);
+        }
+
+        request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+        m_context->MarkRequestAsCompleted(request);
+    }
+
+    bool MemoryMappedDriveLinux::FileMetaDataFromMapping(FileRequest* request)
+    {
+        return AZStd::visit([this, request](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, FileRequest::FileExistsCheckData> ||
+                AZStd::is_same_v<Command, FileRequest::FileMetaDataRetrievalData>)
+            {
+                size_t index = FindMapping(args.m_path);
+                if (index != InvalidMappingIndex)
+                {
+                    if constexpr (AZStd::is_same_v<Command, FileRequest::FileMetaDataRetrievalData>)
+                    {
+                        args.m_fileSize = m_mappedFiles[index].m_size;
+                    }
+                    args.m_found = true;
+                    request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+                    m_context->MarkRequestAsCompleted(request);
+                    return true;
+                }
+            }
+            return false;
+        }, request->GetCommand());
+    }
+
+    void MemoryMappedDriveLinux::Advise(const MappedFile& file, u64 offset, u64 size, int advice, bool includePartialPages) const
+    {
+        const u64 pageMask = m_pageSize - 1;
+        u64 begin = includePartialPages ? (offset & ~pageMask) : ((offset + pageMask) & ~pageMask);
+        u64 end = includePartialPages ? (offset + size) : ((offset + size) & ~pageMask);
+        // The last page of the file is considered fully covered if the read ends at the end of the file.
+        if (!includePartialPages && offset + size == file.m_size)
+        {
+            end = offset + size;
+        }
+        if (begin < end)
+        {
+            ::madvise(file.m_address + begin, aznumeric_cast<size_t>(end - begin), advice);
+        }
+    }
+
+    void MemoryMappedDriveLinux::CancelPendingReads(FileRequest::CancelData& data)
+    {
+        auto it = m_pendingReads.begin();
+        while (it != m_pendingReads.end())
+        {
+            if ((*it)->WorksOn(data.m_target))
+            {
+                (*it)->SetStatus(IStreamerTypes::RequestStatus::Canceled);
+                m_context->MarkRequestAsCompleted(*it);
+                it = m_pendingReads.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+
+    void MemoryMappedDriveLinux::FlushMapping(const RequestPath& filePath)
+    {
+        size_t index = FindMapping(filePath);
+        if (index != InvalidMappingIndex)
+        {
+            UnmapFile(index);
+        }
+    }
+
+    void MemoryMappedDriveLinux::FlushAllMappings()
+    {
+        for (MappedFile& mappedFile : m_mappedFiles)
+        {
+            ::munmap(mappedFile.m_address, aznumeric_cast<size_t>(mappedFile.m_size));
+        }
+        m_mappedFiles.clear();
+    }
+
+    void MemoryMappedDriveLinux::Report(const FileRequest::ReportData& data) const
+    {
+        switch (data.m_reportType)
+        {
+        case FileRequest::ReportData::ReportType::FileLocks:
+            for (const MappedFile& mappedFile : m_mappedFiles)
+            {
+                AZ_Printf("Streamer", "File lock in %s : '%s'.\n", m_name.c_str(), mappedFile.m_path.GetRelativePath());
+            }
+            break;
+        default:
+            break;
+        }
+    }
+} // namespace AZ::IO
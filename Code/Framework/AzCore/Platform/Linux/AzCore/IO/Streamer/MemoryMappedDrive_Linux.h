@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/Statistics.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+#include <AzCore/IO/Streamer/StreamStackEntry.h>
+#include <AzCore/RTTI/TypeInfo.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/chrono/clocks.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/string/string.h>
+
+namespace AZ::IO
+{
+    //! Stream stack entry that serves reads from read-only archives, such as .pak files, directly from a memory mapping of
+    //! the archive. Archives are mapped once and stay mapped until they're flushed or until more archives are mapped than
+    //! allowed, in which case the least recently used mapping is released. Reads are copied straight from the mapping into
+    //! the output buffer of the request, so unlike reading through the storage drive and the caches, no intermediate copies
+    //! or read system calls are needed. When prefetching is enabled the kernel is asked to start loading the pages of a read
+    //! as soon as it's queued, so by the time the read is executed the data is usually resident.
+    //! Requests for files that don't match one of the archive extensions, or that can't be mapped, are passed on to the
+    //! next entry in the stack. Archives must not be modified or truncated while they're mapped.
+    class MemoryMappedDriveLinux
+        : public StreamStackEntry
+    {
+    public:
+        //! Determines what happens to the pages of a mapped archive after a read has copied data out of them. Only pages
+        //! that are fully covered by the read are affected, so data that's shared with neighboring reads stays resident.
+        enum class EvictionPolicy : u8
+        {
+            //! Leave the pages to the regular page cache management of the kernel.
+            None,
+            //! Mark the pages as cold so they're the first to be reclaimed under memory pressure (MADV_COLD).
+            Cold,
+            //! Reclaim the pages immediately (MADV_PAGEOUT). This is useful for archives whose data is only read once.
+            PageOut,
+            //! Remove the pages from the address space of the process (MADV_DONTNEED). This reduces the resident memory of
+            //! the process, but the pages stay in the page cache of the kernel.
+            DontNeed
+        };
+
+        //! Creates an instance of a stack entry that reads archives through memory mappings.
+        //! @param archiveExtensions The extensions, including the dot, of the files that will be memory mapped.
+        //! @param maxMappedFiles The maximum number of archives that are mapped at the same time.
+        //! @param evictionPolicy What to do with the pages of the archive after a read has completed.
+        //! @param prefetch If true, the kernel is asked to start loading the data of a read when the read is queued.
+        MemoryMappedDriveLinux(AZStd::vector<AZStd::string> archiveExtensions, u32 maxMappedFiles, EvictionPolicy evictionPolicy,
+            bool prefetch);
+        ~MemoryMappedDriveLinux() override;
+
+        void QueueRequest(FileRequest* request) override;
+        bool ExecuteRequests() override;
+
+        void UpdateStatus(Status& status) const override;
+        void UpdateCompletionEstimates(AZStd::chrono::system_clock::time_point now, AZStd::vector<FileRequest*>& internalPending,
+            StreamerContext::PreparedQueue::iterator pendingBegin, StreamerContext::PreparedQueue::iterator pendingEnd) override;
+
+        void CollectStatistics(AZStd::vector<Statistic>& statistics) const override;
+
+        //! Returns the number of archives that are currently mapped.
+        size_t GetNumMappedFiles() const;
+
+    private:
+        inline static constexpr size_t InvalidMappingIndex = std::numeric_limits<size_t>::max();
+
+        struct MappedFile
+        {
+            RequestPath m_path;
+            AZStd::chrono::system_clock::time_point m_lastTimeUsed;
+            u8* m_address{ nullptr };
+            u64 m_size{ 0 };
+        };
+
+        bool IsArchive(const RequestPath& filePath) const;
+        size_t FindMapping(const RequestPath& filePath) const;
+        size_t FindOrMapFile(const RequestPath& filePath);
+        void UnmapFile(size_t index);
+
+        void ReadFromMapping(FileRequest* request);
+        bool FileMetaDataFromMapping(FileRequest* request);
+        void Advise(const MappedFile& file, u64 offset, u64 size, int advice, bool includePartialPages) const;
+
+        void CancelPendingReads(FileRequest::CancelData& data);
+        void FlushMapping(const RequestPath& filePath);
+        void FlushAllMappings();
+
+        void Report(const FileRequest::ReportData& data) const;
+
+        TimedAverageWindow<s_statisticsWindowSize> m_mapTimeAverage;
+        TimedAverageWindow<s_statisticsWindowSize> m_readTimeAverage;
+        AverageWindow<u64, float, s_statisticsWindowSize> m_readSizeAverage;
+
+        AZStd::deque<FileRequest*> m_pendingReads;
+        AZStd::vector<MappedFile> m_mappedFiles;
+        AZStd::vector<AZStd::string> m_archiveExtensions;
+
+        u64 m_numMappedReads{ 0 };
+        u64 m_numForwardedReads{ 0 };
+        u64 m_numMappingsCreated{ 0 };
+        size_t m_pageSize;
+        u32 m_maxMappedFiles;
+        int m_evictionAdvice;
+        bool m_prefetch;
+    };
+} // namespace AZ::IO
+
+namespace AZ
+{
+    AZ_TYPE_INFO_SPECIALIZE(AZ::IO::MemoryMappedDriveLinux::EvictionPolicy, "{9E5A0B27-41C6-4D83-8F2E-6B7C1D3A5E94}");
+} // namespace AZ
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/Streamer/StorageDrive_Linux.h>
+#include <AzCore/IO/Streamer/StorageDriveConfig_Linux.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+namespace AZ::IO
+{
+    AZStd::shared_ptr<StreamStackEntry> LinuxStorageDriveConfig::AddStreamStackEntry(
+        [[maybe_unused]] const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent)
+    {
+        StorageDriveLinux::ConstructionOptions options;
+        options.m_enableIoUring = m_enableIoUring;
+        options.m_hasSeekPenalty = m_hasSeekPenalty;
+        options.m_minimalReporting = m_minimalReporting;
+
+        // All absolute paths on Linux share the same root, so a single drive is created that services all of them.
+        auto stackEntry = AZStd::make_shared<StorageDriveLinux>(
+            AZStd::vector<AZStd::string_view>{ "/" }, m_maxFileHandles, m_maxMetaDataCache, m_queueDepth,
+            aznumeric_cast<s32>(m_overcommit), m_threadPoolSize, options);
+        stackEntry->SetNext(AZStd::move(parent));
+        return stackEntry;
+    }
+
+    void LinuxStorageDriveConfig::Reflect(ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<SerializeContext*>(context); serializeContext != nullptr)
+        {
+            serializeContext->Class<LinuxStorageDriveConfig, IStreamerStackConfig>()
+                ->Version(1)
+                ->Field("MaxFileHandles", &LinuxStorageDriveConfig::m_maxFileHandles)
+                ->Field("MaxMetaDataCache", &LinuxStorageDriveConfig::m_maxMetaDataCache)
+                ->Field("QueueDepth", &LinuxStorageDriveConfig::m_queueDepth)
+                ->Field("Overcommit", &LinuxStorageDriveConfig::m_overcommit)
+                ->Field("ThreadPoolSize", &LinuxStorageDriveConfig::m_threadPoolSize)
+                ->Field("EnableIoUring", &LinuxStorageDriveConfig::m_enableIoUring)
+                ->Field("HasSeekPenalty", &LinuxStorageDriveConfig::m_hasSeekPenalty)
+                ->Field("MinimalReporting", &LinuxStorageDriveConfig::m_minimalReporting);
+        }
+    }
+} // namespace AZ::IO
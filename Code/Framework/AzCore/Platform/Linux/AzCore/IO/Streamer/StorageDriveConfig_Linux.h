@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+
+namespace AZ::IO
+{
+    class LinuxStorageDriveConfig final :
+        public IStreamerStackConfig
+    {
+    public:
+        AZ_RTTI(AZ::IO::LinuxStorageDriveConfig, "{0B8D3E2A-5C1F-4C59-9B7E-3A8E61F4D2C7}", IStreamerStackConfig);
+        AZ_CLASS_ALLOCATOR(LinuxStorageDriveConfig, SystemAllocator, 0);
+
+        ~LinuxStorageDriveConfig() override = default;
+        AZStd::shared_ptr<StreamStackEntry> AddStreamStackEntry(
+            const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent) override;
+        static void Reflect(ReflectContext* context);
+
+    private:
+        AZ::u32 m_maxFileHandles{ 32 };
+        AZ::u32 m_maxMetaDataCache{ 32 };
+        AZ::u32 m_queueDepth{ 32 };
+        AZ::u32 m_overcommit{ 8 };
+        AZ::u32 m_threadPoolSize{ 4 };
+        bool m_enableIoUring{ true };
+        bool m_hasSeekPenalty{ false };
+        bool m_minimalReporting{ false };
+    };
+} // namespace AZ::IO
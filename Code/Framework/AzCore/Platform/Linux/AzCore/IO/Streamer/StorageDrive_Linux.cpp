@@ -0,0 +1,1143 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/IO/Streamer/StorageDrive_Linux.h>
+#include <AzCore/std/typetraits/decay.h>
+
+namespace AZ::IO
+{
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+    static constexpr char FileSwitchesName[] = "File switches";
+    static constexpr char SeeksName[] = "Seeks";
+#endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+
+    const AZStd::chrono::microseconds StorageDriveLinux::s_averageSeekTime =
+        AZStd::chrono::milliseconds(9) + // Common average seek time for desktop hdd drives.
+        AZStd::chrono::milliseconds(3); // Rotational latency for a 7200RPM disk
+
+    //
+    // ConstructionOptions
+    //
+
+    StorageDriveLinux::ConstructionOptions::ConstructionOptions()
+        : m_hasSeekPenalty(true)
+        , m_enableIoUring(true)
+        , m_minimalReporting(false)
+    {}
+
+    //
+    // FileReadInformation
+    //
+
+    void StorageDriveLinux::FileReadInformation::Clear()
+    {
+        *this = FileReadInformation{};
+    }
+
+    //
+    // StorageDriveLinux
+    //
+
+    StorageDriveLinux::StorageDriveLinux(const AZStd::vector<AZStd::string_view>& drivePaths, u32 maxFileHandles,
+        u32 maxMetaDataCacheEntries, u32 queueDepth, s32 overCommit, u32 threadPoolSize, ConstructionOptions options)
+        : m_maxFileHandles(maxFileHandles)
+        , m_queueDepth(queueDepth)
+        , m_threadPoolSize(threadPoolSize)
+        , m_overCommit(overCommit)
+        , m_constructionOptions(options)
+    {
+        AZ_Assert(!drivePaths.empty(), "StorageDriveLinux requires at least one drive path to work.");
+
+        m_drivePaths.reserve(drivePaths.size());
+        for (AZStd::string_view drivePath : drivePaths)
+        {
+            AZStd::string path(drivePath);
+            // Erase the trailing slash, unless it's the root, as it's one less character to compare.
+            if (path.length() > 1 && path.back() == AZ_TRAIT_OS_PATH_SEPARATOR)
+            {
+                path.pop_back();
+            }
+            m_drivePaths.push_back(AZStd::move(path));
+        }
+
+        // Create name for statistics. The name will include all mount points serviced by this device,
+        // for instance "Storage drive (/,/mnt/data)".
+        m_name = "Storage drive (";
+        m_name += m_drivePaths[0];
+        for (size_t i = 1; i < m_drivePaths.size(); ++i)
+        {
+            m_name += ',';
+            m_name += m_drivePaths[i];
+        }
+        m_name += ')';
+        if (!m_constructionOptions.m_minimalReporting)
+        {
+            AZ_Printf("Streamer", "%s created.\n", m_name.c_str());
+        }
+
+        if (m_queueDepth == 0)
+        {
+            m_queueDepth = 1;
+            AZ_Warning("StorageDriveLinux", false,
+                "Received queue depth of 0 for %s. Picking a queue depth of %u instead.\n", m_name.c_str(), m_queueDepth);
+        }
+        if (m_threadPoolSize == 0)
+        {
+            m_threadPoolSize = 1;
+            AZ_Warning("StorageDriveLinux", false,
+                "Received thread pool size of 0 for %s. Picking a size of %u instead.\n", m_name.c_str(), m_threadPoolSize);
+        }
+        // Make sure that the overCommit isn't so small that no slots are ever reported.
+        if (aznumeric_cast<s32>(m_queueDepth) + m_overCommit <= 0)
+        {
+            AZ_Error("StorageDriveLinux", false,
+                "Received overcommit (%i) for %s that subtracts more than the queue depth (%u). Setting combined count to 1.\n",
+                m_overCommit, m_name.c_str(), m_queueDepth);
+            m_overCommit = 1 - aznumeric_cast<s32>(m_queueDepth);
+        }
+
+        // Add initial dummy values to the stats to avoid division by zero later on and avoid needing branches.
+        m_readSizeAverage.PushEntry(1);
+        m_readTimeAverage.PushEntry(AZStd::chrono::microseconds(1));
+
+        AZ_Assert(IStreamerTypes::IsPowerOf2(maxMetaDataCacheEntries),
+            "StorageDriveLinux requires a power-of-2 for maxMetaDataCacheEntries. Received %u", maxMetaDataCacheEntries);
+        m_metaDataCache_paths.resize(maxMetaDataCacheEntries);
+        m_metaDataCache_fileSize.resize(maxMetaDataCacheEntries);
+    }
+
+    StorageDriveLinux::~StorageDriveLinux()
+    {
+        ShutdownThreadPool();
+        m_ioUring.Shutdown();
+
+        for (int file : m_fileCache_handles)
+        {
+            if (file >= 0)
+            {
+                ::close(file);
+            }
+        }
+        if (!m_constructionOptions.m_minimalReporting)
+        {
+            AZ_Printf("Streamer", "%s destroyed.\n", m_name.c_str());
+        }
+    }
+
+    void StorageDriveLinux::PrepareRequest(FileRequest* request)
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+        AZ_Assert(request, "PrepareRequest was provided a null request.");
+
+        if (AZStd::holds_alternative<FileRequest::ReadRequestData>(request->GetCommand()))
+        {
+            auto& readRequest = AZStd::get<FileRequest::ReadRequestData>(request->GetCommand());
+            if (IsServicedByThisDrive(readRequest.m_path.GetAbsolutePath()))
+            {
+                FileRequest* read = m_context->GetNewInternalRequest();
+                read->CreateRead(request, readRequest.m_output, readRequest.m_outputSize, readRequest.m_path,
+                    readRequest.m_offset, readRequest.m_size);
+                m_context->PushPreparedRequest(read);
+                return;
+            }
+        }
+        StreamStackEntry::PrepareRequest(request);
+    }
+
+    void StorageDriveLinux::QueueRequest(FileRequest* request)
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+        AZ_Assert(request, "QueueRequest was provided a null request.");
+
+        AZStd::visit([this, request](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, FileRequest::ReadData>)
+            {
+                if (IsServicedByThisDrive(args.m_path.GetAbsolutePath()))
+                {
+                    m_pendingReadRequests.push_back(request);
+                    return;
+                }
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::FileExistsCheckData> ||
+                AZStd::is_same_v<Command, FileRequest::FileMetaDataRetrievalData>)
+            {
+                if (IsServicedByThisDrive(args.m_path.GetAbsolutePath()))
+                {
+                    m_pendingRequests.push_back(request);
+                    return;
+                }
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::CancelData>)
+            {
+                if (CancelRequest(request, args.m_target))
+                {
+                    // Only forward if this isn't part of the request chain, otherwise the storage device should
+                    // be the last step as it doesn't forward any (sub)requests.
+                    return;
+                }
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::FlushData>)
+            {
+                FlushCache(args.m_path);
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::FlushAllData>)
+            {
+                FlushEntireCache();
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::ReportData>)
+            {
+                Report(args);
+            }
+            StreamStackEntry::QueueRequest(request);
+        }, request->GetCommand());
+    }
+
+    bool StorageDriveLinux::ExecuteRequests()
+    {
+        bool hasFinalizedReads = FinalizeReads();
+        bool hasWorked = false;
+
+        if (!m_pendingReadRequests.empty())
+        {
+            // Fill up as many read slots as possible before handing the reads to the kernel so multiple reads can be
+            // submitted with a single system call.
+            while (!m_pendingReadRequests.empty())
+            {
+                FileRequest* request = m_pendingReadRequests.front();
+                if (!ReadRequest(request))
+                {
+                    break;
+                }
+                m_pendingReadRequests.pop_front();
+                hasWorked = true;
+            }
+
+            if (m_readBackend == ReadBackend::IoUring)
+            {
+                SubmitQueuedReads();
+            }
+        }
+        else if (!m_pendingRequests.empty())
+        {
+            FileRequest* request = m_pendingRequests.front();
+            hasWorked = AZStd::visit([this, request](auto&& args)
+            {
+                using Command = AZStd::decay_t<decltype(args)>;
+                if constexpr (AZStd::is_same_v<Command, FileRequest::FileExistsCheckData>)
+                {
+                    FileExistsRequest(request);
+                    m_pendingRequests.pop_front();
+                    return true;
+                }
+                else if constexpr (AZStd::is_same_v<Command, FileRequest::FileMetaDataRetrievalData>)
+                {
+                    FileMetaDataRetrievalRequest(request);
+                    m_pendingRequests.pop_front();
+                    return true;
+                }
+                else
+                {
+                    AZ_Assert(false, "A request was added to StorageDriveLinux's pending queue that isn't supported.");
+                    return false;
+                }
+            }, request->GetCommand());
+        }
+
+        return StreamStackEntry::ExecuteRequests() || hasFinalizedReads || hasWorked;
+    }
+
+    void StorageDriveLinux::UpdateStatus(Status& status) const
+    {
+        StreamStackEntry::UpdateStatus(status);
+        status.m_numAvailableSlots = AZStd::min(status.m_numAvailableSlots, CalculateNumAvailableSlots());
+        status.m_isIdle = status.m_isIdle && m_pendingReadRequests.empty() && m_pendingRequests.empty() && (m_activeReads_Count == 0);
+    }
+
+    void StorageDriveLinux::UpdateCompletionEstimates(AZStd::chrono::system_clock::time_point now,
+        AZStd::vector<FileRequest*>& internalPending, StreamerContext::PreparedQueue::iterator pendingBegin,
+        StreamerContext::PreparedQueue::iterator pendingEnd)
+    {
+        StreamStackEntry::UpdateCompletionEstimates(now, internalPending, pendingBegin, pendingEnd);
+
+        const RequestPath* activeFile = nullptr;
+        if (m_activeCacheSlot != InvalidFileCacheIndex)
+        {
+            activeFile = &m_fileCache_paths[m_activeCacheSlot];
+        }
+        u64 activeOffset = m_activeOffset;
+
+        // Determine the time of the first available slot. Because reads are running in parallel the remaining time for
+        // each read only depends on the amount of data that's still outstanding for that read.
+        const u64 totalBytesRead = m_readSizeAverage.GetTotal();
+        const double totalReadTimeUSec = aznumeric_caster(m_readTimeAverage.GetTotal().count());
+        AZStd::chrono::system_clock::time_point earliestSlot = AZStd::chrono::system_clock::time_point::max();
+        for (size_t i = 0; i < m_readSlots_readInfo.size(); ++i)
+        {
+            if (m_readSlots_active[i])
+            {
+                const FileReadInformation& read = m_readSlots_readInfo[i];
+                auto readCommand = AZStd::get_if<FileRequest::ReadData>(&read.m_request->GetCommand());
+                AZ_Assert(readCommand, "Request currently reading doesn't contain a read command.");
+                auto endTime = read.m_startTime +
+                    AZStd::chrono::microseconds(aznumeric_cast<u64>((readCommand->m_size * totalReadTimeUSec) / totalBytesRead));
+                earliestSlot = AZStd::min(earliestSlot, endTime);
+                read.m_request->SetEstimatedCompletion(endTime);
+            }
+        }
+        if (earliestSlot != AZStd::chrono::system_clock::time_point::max())
+        {
+            now = earliestSlot;
+        }
+
+        // Estimate requests in this stack entry.
+        for (FileRequest* request : m_pendingReadRequests)
+        {
+            EstimateCompletionTimeForRequest(request, now, activeFile, activeOffset);
+        }
+        for (FileRequest* request : m_pendingRequests)
+        {
+            EstimateCompletionTimeForRequest(request, now, activeFile, activeOffset);
+        }
+
+        // Estimate internally pending requests. Because this call will go from the top of the stack to the bottom,
+        // but estimation is calculated from the bottom to the top, this list should be processed in reverse order.
+        for (auto requestIt = internalPending.rbegin(); requestIt != internalPending.rend(); ++requestIt)
+        {
+            EstimateCompletionTimeForRequestChecked(*requestIt, now, activeFile, activeOffset);
+        }
+
+        // Estimate pending requests that have not been queued yet.
+        for (auto requestIt = pendingBegin; requestIt != pendingEnd; ++requestIt)
+        {
+            EstimateCompletionTimeForRequestChecked(*requestIt, now, activeFile, activeOffset);
+        }
+    }
+
+    void StorageDriveLinux::EstimateCompletionTimeForRequest(FileRequest* request, AZStd::chrono::system_clock::time_point& startTime,
+        const RequestPath*& activeFile, u64& activeOffset) const
+    {
+        u64 readSize = 0;
+        u64 offset = 0;
+        const RequestPath* targetFile = nullptr;
+
+        AZStd::visit([&](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, FileRequest::ReadData>)
+            {
+                targetFile = &args.m_path;
+                readSize = args.m_size;
+                offset = args.m_offset;
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::CompressedReadData>)
+            {
+                targetFile = &args.m_compressionInfo.m_archiveFilename;
+                readSize = args.m_compressionInfo.m_compressedSize;
+                offset = args.m_compressionInfo.m_offset;
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::FileExistsCheckData>)
+            {
+                readSize = 0;
+                startTime += m_getFileExistsTimeAverage.CalculateAverage();
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::FileMetaDataRetrievalData>)
+            {
+                readSize = 0;
+                startTime += m_getFileMetaDataRetrievalTimeAverage.CalculateAverage();
+            }
+        }, request->GetCommand());
+
+        if (readSize > 0)
+        {
+            if (activeFile && activeFile != targetFile)
+            {
+                if (FindInFileHandleCache(*targetFile) == InvalidFileCacheIndex)
+                {
+                    startTime += m_fileOpenCloseTimeAverage.CalculateAverage();
+                }
+                activeOffset = std::numeric_limits<u64>::max();
+            }
+
+            if (activeOffset != offset && m_constructionOptions.m_hasSeekPenalty)
+            {
+                startTime += s_averageSeekTime;
+            }
+
+            // Reads are executed in parallel, so the cost of a read is spread over the number of reads that are
+            // typically in flight at the same time.
+            u64 totalBytesRead = m_readSizeAverage.GetTotal();
+            double totalReadTimeUSec = aznumeric_caster(m_readTimeAverage.GetTotal().count());
+            double parallelReads = AZStd::max(1.0, aznumeric_cast<double>(m_readsInFlightAverage.CalculateAverage()));
+            startTime += AZStd::chrono::microseconds(
+                aznumeric_cast<u64>((readSize * totalReadTimeUSec) / (totalBytesRead * parallelReads)));
+            activeOffset = offset + readSize;
+        }
+        request->SetEstimatedCompletion(startTime);
+    }
+
+    void StorageDriveLinux::EstimateCompletionTimeForRequestChecked(FileRequest* request,
+        AZStd::chrono::system_clock::time_point startTime, const RequestPath*& activeFile, u64& activeOffset) const
+    {
+        AZStd::visit([&, this](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, FileRequest::ReadData> ||
+                          AZStd::is_same_v<Command, FileRequest::FileExistsCheckData>)
+            {
+                if (IsServicedByThisDrive(args.m_path.GetAbsolutePath()))
+                {
+                    EstimateCompletionTimeForRequest(request, startTime, activeFile, activeOffset);
+                }
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::CompressedReadData>)
+            {
+                if (IsServicedByThisDrive(args.m_compressionInfo.m_archiveFilename.GetAbsolutePath()))
+                {
+                    EstimateCompletionTimeForRequest(request, startTime, activeFile, activeOffset);
+                }
+            }
+        }, request->GetCommand());
+    }
+
+    s32 StorageDriveLinux::CalculateNumAvailableSlots() const
+    {
+        return (m_overCommit + aznumeric_cast<s32>(m_queueDepth)) - aznumeric_cast<s32>(m_pendingReadRequests.size()) -
+            aznumeric_cast<s32>(m_pendingRequests.size()) - m_activeReads_Count;
+    }
+
+    bool StorageDriveLinux::IsUsingIoUring() const
+    {
+        return m_readBackend == ReadBackend::IoUring;
+    }
+
+    void StorageDriveLinux::InitializeCaches()
+    {
+        m_fileCache_lastTimeUsed.resize(m_maxFileHandles, AZStd::chrono::system_clock::time_point::min());
+        m_fileCache_paths.resize(m_maxFileHandles);
+        m_fileCache_handles.resize(m_maxFileHandles, -1);
+        m_fileCache_activeReads.resize(m_maxFileHandles, 0);
+
+        m_readSlots_readInfo.resize(m_queueDepth);
+        m_readSlots_active.resize(m_queueDepth);
+
+        m_cachesInitialized = true;
+    }
+
+    void StorageDriveLinux::InitializeReadBackend()
+    {
+        AZ_Assert(m_context, "StorageDriveLinux requires a context before reads can be issued.");
+
+        if (m_constructionOptions.m_enableIoUring)
+        {
+            const int completionEvent = m_context->GetStreamerThreadSynchronizer().GetWakeUpEventDescriptor();
+            if (m_ioUring.Initialize(m_queueDepth, completionEvent))
+            {
+                // The kernel can round up the number of entries, but never down.
+                AZ_Assert(m_ioUring.GetCapacity() >= m_queueDepth, "io_uring was created with fewer entries than requested.");
+                m_readBackend = ReadBackend::IoUring;
+                if (!m_constructionOptions.m_minimalReporting)
+                {
+                    AZ_Printf("Streamer", "%s is using io_uring with a queue depth of %u.\n", m_name.c_str(), m_queueDepth);
+                }
+                return;
+            }
+            AZ_Warning("StorageDriveLinux", m_constructionOptions.m_minimalReporting,
+                "io_uring is not available for %s, falling back to a thread pool with %u threads.\n", m_name.c_str(), m_threadPoolSize);
+        }
+
+        m_threadPoolShutdown = false;
+        m_threadPool.reserve(m_threadPoolSize);
+        AZStd::thread_desc threadDesc;
+        threadDesc.m_name = "IO StorageDriveLinux";
+        for (u32 i = 0; i < m_threadPoolSize; ++i)
+        {
+            m_threadPool.emplace_back([this]()
+            {
+                ThreadPool_Main();
+            }, &threadDesc);
+        }
+        m_readBackend = ReadBackend::ThreadPool;
+    }
+
+    void StorageDriveLinux::ShutdownThreadPool()
+    {
+        if (!m_threadPool.empty())
+        {
+            {
+                AZStd::scoped_lock lock(m_threadPoolReadsLock);
+                m_threadPoolShutdown = true;
+            }
+            m_threadPoolReadsSignal.notify_all();
+            for (AZStd::thread& thread : m_threadPool)
+            {
+                thread.join();
+            }
+            m_threadPool.clear();
+        }
+    }
+
+    void StorageDriveLinux::ThreadPool_Main()
+    {
+        while (true)
+        {
+            ThreadPoolRead read;
+            {
+                AZStd::unique_lock lock(m_threadPoolReadsLock);
+                m_threadPoolReadsSignal.wait(lock, [this]()
+                {
+                    return m_threadPoolShutdown || !m_threadPoolReads.empty();
+                });
+                if (m_threadPoolShutdown)
+                {
+                    return;
+                }
+                read = m_threadPoolReads.front();
+                m_threadPoolReads.pop_front();
+            }
+
+            ReadCompletion completion;
+            completion.m_readSlot = read.m_readSlot;
+            {
+                AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinux::ThreadPool_Main pread");
+                ssize_t result;
+                do
+                {
+                    result = ::pread(read.m_fileDescriptor, read.m_output, read.m_size, read.m_offset);
+                } while (result < 0 && errno == EINTR);
+                completion.m_result = result < 0 ? -errno : aznumeric_cast<s64>(result);
+            }
+
+            {
+                AZStd::scoped_lock lock(m_threadPoolCompletionsLock);
+                m_threadPoolCompletions.push_back(completion);
+            }
+            m_context->WakeUpSchedulingThread();
+        }
+    }
+
+    auto StorageDriveLinux::OpenFile(int& fileDescriptor, size_t& cacheSlot, FileRequest* request, const FileRequest::ReadData& data)
+        -> OpenFileResult
+    {
+        int file = -1;
+
+        // If the file is already opened for use, use that file handle and update it's last touched time.
+        size_t cacheIndex = FindInFileHandleCache(data.m_path);
+        if (cacheIndex != InvalidFileCacheIndex)
+        {
+            file = m_fileCache_handles[cacheIndex];
+            AZ_Assert(file >= 0, "Found the file '%s' in cache, but file handle is invalid.\n", data.m_path.GetRelativePath());
+        }
+        else
+        {
+            // If the file is not already found in the cache, attempt to claim an available cache entry.
+            cacheIndex = FindAvailableFileHandleCacheIndex();
+            if (cacheIndex == InvalidFileCacheIndex)
+            {
+                // No files ready to be evicted.
+                return OpenFileResult::CacheFull;
+            }
+
+            // Adding explicit scope here for profiling file Open & Close
+            {
+                AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinux::ReadRequest OpenFile %s", m_name.c_str());
+                TIMED_AVERAGE_WINDOW_SCOPE(m_fileOpenCloseTimeAverage);
+
+                do
+                {
+                    file = ::open(data.m_path.GetAbsolutePath(), O_RDONLY | O_CLOEXEC);
+                } while (file < 0 && errno == EINTR);
+
+                if (file < 0)
+                {
+                    // Failed to open the file, so let the next entry in the stack try.
+                    StreamStackEntry::QueueRequest(request);
+                    return OpenFileResult::RequestForwarded;
+                }
+
+                // Streamer mostly reads archives and files front to back, so let the kernel read ahead more aggressively.
+                ::posix_fadvise(file, 0, 0, POSIX_FADV_SEQUENTIAL);
+
+                if (m_fileCache_handles[cacheIndex] >= 0)
+                {
+                    ::close(m_fileCache_handles[cacheIndex]);
+                }
+            }
+
+            // Fill the cache entry with data about the new file.
+            m_fileCache_handles[cacheIndex] = file;
+            m_fileCache_activeReads[cacheIndex] = 0;
+            m_fileCache_paths[cacheIndex] = data.m_path;
+        }
+
+        // Set the current request and update timestamp, regardless of cache hit or miss.
+        m_fileCache_lastTimeUsed[cacheIndex] = AZStd::chrono::system_clock::now();
+        fileDescriptor = file;
+        cacheSlot = cacheIndex;
+        return OpenFileResult::FileOpened;
+    }
+
+    bool StorageDriveLinux::ReadRequest(FileRequest* request)
+    {
+        AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinux::ReadRequest %s", m_name.c_str());
+
+        if (!m_cachesInitialized)
+        {
+            InitializeCaches();
+        }
+        if (m_readBackend == ReadBackend::Uninitialized)
+        {
+            InitializeReadBackend();
+        }
+
+        if (m_activeReads_Count >= m_queueDepth)
+        {
+            return false;
+        }
+
+        size_t readSlot = FindAvailableReadSlot();
+        AZ_Assert(readSlot != InvalidReadSlotIndex, "Active read slot count indicates there's a read slot available, but no read slot was found.");
+
+        auto data = AZStd::get_if<FileRequest::ReadData>(&request->GetCommand());
+        AZ_Assert(data, "Read request in StorageDriveLinux doesn't contain read data.");
+
+        int file = -1;
+        size_t fileCacheSlot = InvalidFileCacheIndex;
+        switch (OpenFile(file, fileCacheSlot, request, *data))
+        {
+        case OpenFileResult::FileOpened:
+            break;
+        case OpenFileResult::RequestForwarded:
+            return true;
+        case OpenFileResult::CacheFull:
+            return false;
+        default:
+            AZ_Assert(false, "Unsupported OpenFileRequest returned.");
+        }
+
+        FileReadInformation& readInfo = m_readSlots_readInfo[readSlot];
+        readInfo.m_request = request;
+        readInfo.m_fileHandleIndex = fileCacheSlot;
+        readInfo.m_bytesRead = 0;
+        readInfo.m_isCanceled = false;
+
+        if (!SubmitRead(readSlot))
+        {
+            // The submission queue is full. This can only happen if io_uring still has entries that the kernel hasn't
+            // consumed yet, so try again after the next submit.
+            readInfo.Clear();
+            return false;
+        }
+
+        auto now = AZStd::chrono::system_clock::now();
+        if (m_activeReads_Count++ == 0)
+        {
+            m_activeReads_startTime = now;
+        }
+        m_readsInFlightAverage.PushEntry(m_activeReads_Count);
+        readInfo.m_startTime = now;
+        m_readSlots_active[readSlot] = true;
+
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+        if (m_activeCacheSlot == fileCacheSlot)
+        {
+            m_fileSwitchPercentageStat.PushSample(0.0);
+            m_seekPercentageStat.PushSample(m_activeOffset == data->m_offset ? 0.0 : 1.0);
+        }
+        else
+        {
+            m_fileSwitchPercentageStat.PushSample(1.0);
+            m_seekPercentageStat.PushSample(0.0);
+        }
+
+        Statistic::PlotImmediate(m_name, FileSwitchesName, m_fileSwitchPercentageStat.GetMostRecentSample());
+        Statistic::PlotImmediate(m_name, SeeksName, m_seekPercentageStat.GetMostRecentSample());
+#endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+
+        m_fileCache_activeReads[fileCacheSlot]++;
+        m_activeCacheSlot = fileCacheSlot;
+        m_activeOffset = data->m_offset + data->m_size;
+
+        return true;
+    }
+
+    bool StorageDriveLinux::SubmitRead(size_t readSlot)
+    {
+        FileReadInformation& readInfo = m_readSlots_readInfo[readSlot];
+        auto data = AZStd::get_if<FileRequest::ReadData>(&readInfo.m_request->GetCommand());
+        AZ_Assert(data, "Read request in StorageDriveLinux doesn't contain read data.");
+
+        // Continue where the previous part of the read stopped in case the read was split up or the kernel returned
+        // fewer bytes than requested.
+        const int file = m_fileCache_handles[readInfo.m_fileHandleIndex];
+        void* output = reinterpret_cast<u8*>(data->m_output) + readInfo.m_bytesRead;
+        const u64 size = AZStd::min(data->m_size - readInfo.m_bytesRead, s_maxReadSize);
+        const u64 offset = data->m_offset + readInfo.m_bytesRead;
+
+        if (m_readBackend == ReadBackend::IoUring)
+        {
+            return m_ioUring.QueueRead(file, output, aznumeric_cast<u32>(size), offset, readSlot);
+        }
+        else
+        {
+            ThreadPoolRead read;
+            read.m_output = output;
+            read.m_size = size;
+            read.m_offset = offset;
+            read.m_readSlot = readSlot;
+            read.m_fileDescriptor = file;
+            {
+                AZStd::scoped_lock lock(m_threadPoolReadsLock);
+                m_threadPoolReads.push_back(read);
+            }
+            m_threadPoolReadsSignal.notify_one();
+            return true;
+        }
+    }
+
+    void StorageDriveLinux::SubmitQueuedReads()
+    {
+        AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinux::SubmitQueuedReads io_uring_enter");
+
+        const s32 result = m_ioUring.Submit();
+        if (result >= 0 || result == -EAGAIN || result == -EBUSY)
+        {
+            // Reads the kernel didn't accept yet stay queued and are submitted again on the next call.
+            return;
+        }
+
+        // Any other error means the kernel won't accept these reads, so fail them instead of leaving them in their read
+        // slots waiting for a completion that never arrives.
+        AZ_Error("StorageDriveLinux", false, "Failed to submit reads to io_uring for %s (Error: %i).\n", m_name.c_str(), -result);
+        u64 userData;
+        while (m_ioUring.PopQueued(userData))
+        {
+            FinalizeSingleRequest(aznumeric_caster(userData), true);
+        }
+    }
+
+    bool StorageDriveLinux::CancelRequest(FileRequest* cancelRequest, FileRequestPtr& target)
+    {
+        bool ownsRequestChain = false;
+        for (auto it = m_pendingReadRequests.begin(); it != m_pendingReadRequests.end();)
+        {
+            if ((*it)->WorksOn(target))
+            {
+                (*it)->SetStatus(IStreamerTypes::RequestStatus::Canceled);
+                m_context->MarkRequestAsCompleted(*it);
+                it = m_pendingReadRequests.erase(it);
+                ownsRequestChain = true;
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        // Reads that have already been handed to the kernel or the thread pool can't be stopped as reads from regular files
+        // aren't interruptible, so mark them as canceled and report them as such once they complete.
+        for (size_t readSlot = 0; readSlot < m_readSlots_active.size(); ++readSlot)
+        {
+            if (m_readSlots_active[readSlot] && m_readSlots_readInfo[readSlot].m_request->WorksOn(target))
+            {
+                m_readSlots_readInfo[readSlot].m_isCanceled = true;
+                ownsRequestChain = true;
+            }
+        }
+
+        if (ownsRequestChain)
+        {
+            cancelRequest->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(cancelRequest);
+        }
+
+        return ownsRequestChain;
+    }
+
+    void StorageDriveLinux::FileExistsRequest(FileRequest* request)
+    {
+        auto& fileExists = AZStd::get<FileRequest::FileExistsCheckData>(request->GetCommand());
+
+        AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinux::FileExistsRequest %s : %s",
+            m_name.c_str(), fileExists.m_path.GetRelativePath());
+        TIMED_AVERAGE_WINDOW_SCOPE(m_getFileExistsTimeAverage);
+
+        AZ_Assert(IsServicedByThisDrive(fileExists.m_path.GetAbsolutePath()),
+            "FileExistsRequest was queued on a StorageDriveLinux that doesn't service files on the given path '%s'.",
+            fileExists.m_path.GetRelativePath());
+
+        if (FindInFileHandleCache(fileExists.m_path) != InvalidFileCacheIndex ||
+            FindInMetaDataCache(fileExists.m_path) != InvalidMetaDataCacheIndex)
+        {
+            fileExists.m_found = true;
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+            return;
+        }
+
+        struct stat fileInfo;
+        if (::stat(fileExists.m_path.GetAbsolutePath(), &fileInfo) == 0)
+        {
+            if (S_ISREG(fileInfo.st_mode))
+            {
+                size_t cacheIndex = GetNextMetaDataCacheSlot();
+                m_metaDataCache_paths[cacheIndex] = fileExists.m_path;
+                m_metaDataCache_fileSize[cacheIndex] = aznumeric_caster(fileInfo.st_size);
+                fileExists.m_found = true;
+            }
+            else
+            {
+                // The path exists but is a directory, device or similar which this drive can't read from.
+                fileExists.m_found = false;
+            }
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+            return;
+        }
+
+        StreamStackEntry::QueueRequest(request);
+    }
+
+    void StorageDriveLinux::FileMetaDataRetrievalRequest(FileRequest* request)
+    {
+        auto& command = AZStd::get<FileRequest::FileMetaDataRetrievalData>(request->GetCommand());
+
+        AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinux::FileMetaDataRetrievalRequest %s : %s",
+            m_name.c_str(), command.m_path.GetRelativePath());
+        TIMED_AVERAGE_WINDOW_SCOPE(m_getFileMetaDataRetrievalTimeAverage);
+
+        size_t cacheIndex = FindInMetaDataCache(command.m_path);
+        if (cacheIndex != InvalidMetaDataCacheIndex)
+        {
+            command.m_fileSize = m_metaDataCache_fileSize[cacheIndex];
+            command.m_found = true;
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+            return;
+        }
+
+        struct stat fileInfo;
+        cacheIndex = FindInFileHandleCache(command.m_path);
+        const int result = (cacheIndex != InvalidFileCacheIndex)
+            ? ::fstat(m_fileCache_handles[cacheIndex], &fileInfo)
+            : ::stat(command.m_path.GetAbsolutePath(), &fileInfo);
+        if (result != 0 || !S_ISREG(fileInfo.st_mode))
+        {
+            StreamStackEntry::QueueRequest(request);
+            return;
+        }
+
+        command.m_fileSize = aznumeric_caster(fileInfo.st_size);
+        command.m_found = true;
+
+        cacheIndex = GetNextMetaDataCacheSlot();
+        m_metaDataCache_paths[cacheIndex] = command.m_path;
+        m_metaDataCache_fileSize[cacheIndex] = command.m_fileSize;
+
+        request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+        m_context->MarkRequestAsCompleted(request);
+    }
+
+    void StorageDriveLinux::FlushCache(const RequestPath& filePath)
+    {
+        if (m_cachesInitialized)
+        {
+            size_t cacheIndex = FindInFileHandleCache(filePath);
+            if (cacheIndex != InvalidFileCacheIndex)
+            {
+                if (m_fileCache_handles[cacheIndex] >= 0)
+                {
+                    AZ_Assert(m_fileCache_activeReads[cacheIndex] == 0, "Flushing '%s' but it has %u active reads\n",
+                        filePath.GetRelativePath(), m_fileCache_activeReads[cacheIndex]);
+                    ::close(m_fileCache_handles[cacheIndex]);
+                    m_fileCache_handles[cacheIndex] = -1;
+                }
+                m_fileCache_activeReads[cacheIndex] = 0;
+                m_fileCache_lastTimeUsed[cacheIndex] = AZStd::chrono::system_clock::time_point();
+                m_fileCache_paths[cacheIndex].Clear();
+            }
+
+            cacheIndex = FindInMetaDataCache(filePath);
+            if (cacheIndex != InvalidMetaDataCacheIndex)
+            {
+                m_metaDataCache_paths[cacheIndex].Clear();
+                m_metaDataCache_fileSize[cacheIndex] = 0;
+            }
+        }
+    }
+
+    void StorageDriveLinux::FlushEntireCache()
+    {
+        if (m_cachesInitialized)
+        {
+            // Clear file handle cache
+            for (size_t cacheIndex = 0; cacheIndex < m_maxFileHandles; ++cacheIndex)
+            {
+                if (m_fileCache_handles[cacheIndex] >= 0)
+                {
+                    AZ_Assert(m_fileCache_activeReads[cacheIndex] == 0, "Flushing '%s' but it has %u active reads\n",
+                        m_fileCache_paths[cacheIndex].GetRelativePath(), m_fileCache_activeReads[cacheIndex]);
+                    ::close(m_fileCache_handles[cacheIndex]);
+                    m_fileCache_handles[cacheIndex] = -1;
+                }
+                m_fileCache_activeReads[cacheIndex] = 0;
+                m_fileCache_lastTimeUsed[cacheIndex] = AZStd::chrono::system_clock::time_point();
+                m_fileCache_paths[cacheIndex].Clear();
+            }
+
+            // Clear meta data cache
+            auto metaDataCacheSize = m_metaDataCache_paths.size();
+            m_metaDataCache_paths.clear();
+            m_metaDataCache_fileSize.clear();
+            m_metaDataCache_front = 0;
+            m_metaDataCache_paths.resize(metaDataCacheSize);
+            m_metaDataCache_fileSize.resize(metaDataCacheSize);
+        }
+    }
+
+    bool StorageDriveLinux::FinalizeReads()
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+
+        bool hasWorked = false;
+        if (m_readBackend == ReadBackend::IoUring)
+        {
+            ReadCompletion completion;
+            u64 userData;
+            s32 result;
+            while (m_ioUring.PopCompletion(userData, result))
+            {
+                completion.m_readSlot = aznumeric_caster(userData);
+                completion.m_result = result;
+                ProcessCompletion(completion);
+                hasWorked = true;
+            }
+            // Completions could have resulted in reads being resubmitted.
+            SubmitQueuedReads();
+        }
+        else if (m_readBackend == ReadBackend::ThreadPool)
+        {
+            {
+                AZStd::scoped_lock lock(m_threadPoolCompletionsLock);
+                AZStd::swap(m_threadPoolCompletions, m_threadPoolCompletionsProcessing);
+            }
+            for (const ReadCompletion& completion : m_threadPoolCompletionsProcessing)
+            {
+                ProcessCompletion(completion);
+            }
+            hasWorked = !m_threadPoolCompletionsProcessing.empty();
+            m_threadPoolCompletionsProcessing.clear();
+        }
+        return hasWorked;
+    }
+
+    void StorageDriveLinux::ProcessCompletion(const ReadCompletion& completion)
+    {
+        AZ_Assert(completion.m_readSlot < m_readSlots_active.size() && m_readSlots_active[completion.m_readSlot],
+            "StorageDriveLinux received a completion for a read slot that isn't active.");
+
+        FileReadInformation& readInfo = m_readSlots_readInfo[completion.m_readSlot];
+        if (completion.m_result < 0)
+        {
+            AZ_Error("StorageDriveLinux", readInfo.m_isCanceled || completion.m_result == -ECANCELED,
+                "Async file read operation completed with error code %lli\n", -completion.m_result);
+            FinalizeSingleRequest(completion.m_readSlot, true);
+            return;
+        }
+
+        readInfo.m_bytesRead += aznumeric_cast<u64>(completion.m_result);
+        m_activeReads_ByteCount += aznumeric_cast<size_t>(completion.m_result);
+
+        auto data = AZStd::get_if<FileRequest::ReadData>(&readInfo.m_request->GetCommand());
+        AZ_Assert(data, "Request stored with the read slot did not contain a read request.");
+        if (readInfo.m_bytesRead >= data->m_size || readInfo.m_isCanceled)
+        {
+            FinalizeSingleRequest(completion.m_readSlot, false);
+        }
+        else if (completion.m_result == 0)
+        {
+            // Reached the end of the file before all requested data was read.
+            FinalizeSingleRequest(completion.m_readSlot, true);
+        }
+        else if (!SubmitRead(completion.m_readSlot))
+        {
+            AZ_Error("StorageDriveLinux", false, "Unable to submit the remainder of a partial read for '%s'.\n",
+                data->m_path.GetRelativePath());
+            FinalizeSingleRequest(completion.m_readSlot, true);
+        }
+    }
+
+    void StorageDriveLinux::FinalizeSingleRequest(size_t readSlot, bool encounteredError)
+    {
+        if (--m_activeReads_Count == 0)
+        {
+            // Update read stats now that the operation is done.
+            m_readSizeAverage.PushEntry(m_activeReads_ByteCount);
+            m_readTimeAverage.PushEntry(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(
+                AZStd::chrono::system_clock::now() - m_activeReads_startTime));
+
+            m_activeReads_ByteCount = 0;
+        }
+
+        FileReadInformation& fileReadInfo = m_readSlots_readInfo[readSlot];
+
+        auto readCommand = AZStd::get_if<FileRequest::ReadData>(&fileReadInfo.m_request->GetCommand());
+        AZ_Assert(readCommand != nullptr, "Request stored with the read slot did not contain a read request.");
+
+        bool isSuccess = !encounteredError && (readCommand->m_size <= fileReadInfo.m_bytesRead);
+        fileReadInfo.m_request->SetStatus(
+            fileReadInfo.m_isCanceled
+                ? IStreamerTypes::RequestStatus::Canceled
+                : isSuccess
+                    ? IStreamerTypes::RequestStatus::Completed
+                    : IStreamerTypes::RequestStatus::Failed
+        );
+        m_context->MarkRequestAsCompleted(fileReadInfo.m_request);
+
+        m_fileCache_activeReads[fileReadInfo.m_fileHandleIndex]--;
+        m_readSlots_active[readSlot] = false;
+        fileReadInfo.Clear();
+    }
+
+    size_t StorageDriveLinux::FindInFileHandleCache(const RequestPath& filePath) const
+    {
+        size_t numFiles = m_fileCache_paths.size();
+        for (size_t i = 0; i < numFiles; ++i)
+        {
+            if (m_fileCache_paths[i] == filePath)
+            {
+                return i;
+            }
+        }
+        return InvalidFileCacheIndex;
+    }
+
+    size_t StorageDriveLinux::FindAvailableFileHandleCacheIndex() const
+    {
+        AZ_Assert(m_cachesInitialized, "Using file cache before it has been (lazily) initialized\n");
+
+        // This needs to look for files with no active reads, and the oldest file among those.
+        size_t cacheIndex = InvalidFileCacheIndex;
+        AZStd::chrono::system_clock::time_point oldest = AZStd::chrono::system_clock::time_point::max();
+        for (size_t index = 0; index < m_maxFileHandles; ++index)
+        {
+            if (m_fileCache_activeReads[index] == 0 && m_fileCache_lastTimeUsed[index] < oldest)
+            {
+                oldest = m_fileCache_lastTimeUsed[index];
+                cacheIndex = index;
+            }
+        }
+
+        return cacheIndex;
+    }
+
+    size_t StorageDriveLinux::FindAvailableReadSlot() const
+    {
+        for (size_t i = 0; i < m_readSlots_active.size(); ++i)
+        {
+            if (!m_readSlots_active[i])
+            {
+                return i;
+            }
+        }
+        return InvalidReadSlotIndex;
+    }
+
+    size_t StorageDriveLinux::FindInMetaDataCache(const RequestPath& filePath) const
+    {
+        size_t numFiles = m_metaDataCache_paths.size();
+        for (size_t i = 0; i < numFiles; ++i)
+        {
+            if (m_metaDataCache_paths[i] == filePath)
+            {
+                return i;
+            }
+        }
+        return InvalidMetaDataCacheIndex;
+    }
+
+    size_t StorageDriveLinux::GetNextMetaDataCacheSlot()
+    {
+        m_metaDataCache_front = (m_metaDataCache_front + 1) & (m_metaDataCache_paths.size() - 1);
+        return m_metaDataCache_front;
+    }
+
+    bool StorageDriveLinux::IsServicedByThisDrive(const char* filePath) const
+    {
+        // Mount points are compared as path prefixes. Resolving the actual device through the mount table would be more
+        // accurate, but is too expensive to do for every request.
+        for (const AZStd::string& drivePath : m_drivePaths)
+        {
+            if (strncmp(filePath, drivePath.c_str(), drivePath.length()) == 0)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void StorageDriveLinux::CollectStatistics(AZStd::vector<Statistic>& statistics) const
+    {
+        if (m_cachesInitialized)
+        {
+            constexpr double bytesToMB = aznumeric_cast<double>(1_mib);
+            using DoubleSeconds = AZStd::chrono::duration<double>;
+
+            double totalBytesReadMB = m_readSizeAverage.GetTotal() / bytesToMB;
+            double totalReadTimeSec = AZStd::chrono::duration_cast<DoubleSeconds>(m_readTimeAverage.GetTotal()).count();
+            statistics.push_back(Statistic::CreateFloat(m_name, "Read Speed (avg. mbps)", totalBytesReadMB / totalReadTimeSec));
+            statistics.push_back(Statistic::CreateInteger(m_name, "File Open & Close (avg. us)", m_fileOpenCloseTimeAverage.CalculateAverage().count()));
+            statistics.push_back(Statistic::CreateInteger(m_name, "Get file exists (avg. us)", m_getFileExistsTimeAverage.CalculateAverage().count()));
+            statistics.push_back(Statistic::CreateInteger(m_name, "Get file meta data (avg. us)", m_getFileMetaDataRetrievalTimeAverage.CalculateAverage().count()));
+            statistics.push_back(Statistic::CreateFloat(m_name, "Reads in flight (avg.)", m_readsInFlightAverage.CalculateAverage()));
+            statistics.push_back(Statistic::CreateInteger(m_name, "Available slots", CalculateNumAvailableSlots()));
+            statistics.push_back(Statistic::CreateInteger(m_name, "Uses io_uring", IsUsingIoUring() ? 1 : 0));
+
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+            statistics.push_back(Statistic::CreatePercentage(m_name, FileSwitchesName, m_fileSwitchPercentageStat.GetAverage()));
+            statistics.push_back(Statistic::CreatePercentage(m_name, SeeksName, m_seekPercentageStat.GetAverage()));
+#endif
+        }
+        StreamStackEntry::CollectStatistics(statistics);
+    }
+
+    void StorageDriveLinux::Report(const FileRequest::ReportData& data) const
+    {
+        switch (data.m_reportType)
+        {
+        case FileRequest::ReportData::ReportType::FileLocks:
+            if (m_cachesInitialized)
+            {
+                for (u32 i = 0; i < m_maxFileHandles; ++i)
+                {
+                    if (m_fileCache_handles[i] >= 0)
+                    {
+                        AZ_Printf("Streamer", "File lock in %s : '%s'.\n", m_name.c_str(), m_fileCache_paths[i].GetRelativePath());
+                    }
+                }
+            }
+            else
+            {
+                AZ_Printf("Streamer", "File lock in %s : No files have been streamed.\n", m_name.c_str());
+            }
+            break;
+        default:
+            break;
+        }
+    }
+} // namespace AZ::IO
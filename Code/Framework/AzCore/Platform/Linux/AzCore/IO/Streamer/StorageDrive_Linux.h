@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/Streamer/IoUring_Linux.h>
+#include <AzCore/IO/Streamer/Statistics.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+#include <AzCore/IO/Streamer/StreamStackEntry.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/chrono/clocks.h>
+#include <AzCore/std/parallel/condition_variable.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/std/string/string_view.h>
+#include <AzCore/Statistics/RunningStatistic.h>
+
+namespace AZ::IO
+{
+    //! Storage drive optimized for Linux. Unlike the generic StorageDrive, which reads one request at a time on the
+    //! Streamer thread, this drive keeps a configurable number of reads in flight. Reads are submitted to the kernel
+    //! through io_uring when available. If io_uring isn't supported by the kernel or has been disabled, reads are
+    //! executed with pread on a small pool of worker threads instead. In both cases completed reads wake up the
+    //! Streamer thread so requests can be finalized.
+    class StorageDriveLinux
+        : public StreamStackEntry
+    {
+    public:
+        struct ConstructionOptions
+        {
+            ConstructionOptions();
+
+            //! Whether or not the device has a cost for seeking, such as happens on platter disks. This
+            //! will be accounted for when predicting file reads.
+            u8 m_hasSeekPenalty : 1;
+            //! Use io_uring to submit reads. If io_uring is not available this will automatically fall back to
+            //! reading on the thread pool.
+            u8 m_enableIoUring : 1;
+            //! If true, only information that's explicitly requested or issues are reported. If false, status information
+            //! such as when drives are created and destroyed is reported as well.
+            u8 m_minimalReporting : 1;
+        };
+
+        //! Creates an instance of a storage device that's optimized for use on Linux.
+        //! @param drivePaths The paths to the mount points that are serviced by this device.
+        //! @param maxFileHandles The maximum number of file handles that are cached. Only a small number are needed when
+        //!     running from archives, but it's recommended that a larger number are kept open when reading from loose files.
+        //! @param maxMetaDataCacheEntries The maximum number of files to keep meta data, such as the file size, to cache. This
+        //!     needs to be a power of 2.
+        //! @param queueDepth The maximum number of reads that are in flight at the same time.
+        //! @param overCommit The number of additional slots that will be reported as available. This makes sure that there are
+        //!     always a few requests pending to avoid starvation. An over-commit that is too large can negatively impact the
+        //!     scheduler's ability to re-order requests for optimal read order.
+        //! @param threadPoolSize The number of threads that will be used to read if io_uring is not available.
+        //! @param options Additional configuration options. See ConstructionOptions for more details.
+        StorageDriveLinux(const AZStd::vector<AZStd::string_view>& drivePaths, u32 maxFileHandles, u32 maxMetaDataCacheEntries,
+            u32 queueDepth, s32 overCommit, u32 threadPoolSize, ConstructionOptions options);
+        ~StorageDriveLinux() override;
+
+        void PrepareRequest(FileRequest* request) override;
+        void QueueRequest(FileRequest* request) override;
+        bool ExecuteRequests() override;
+
+        void UpdateStatus(Status& status) const override;
+        void UpdateCompletionEstimates(AZStd::chrono::system_clock::time_point now, AZStd::vector<FileRequest*>& internalPending,
+            StreamerContext::PreparedQueue::iterator pendingBegin, StreamerContext::PreparedQueue::iterator pendingEnd) override;
+
+        void CollectStatistics(AZStd::vector<Statistic>& statistics) const override;
+
+        //! Returns true if reads are submitted through io_uring. This is only known after the first read has been issued.
+        bool IsUsingIoUring() const;
+
+    protected:
+        static const AZStd::chrono::microseconds s_averageSeekTime;
+        //! The largest amount of data that's read with a single call. Larger reads are split up and resubmitted.
+        static constexpr u64 s_maxReadSize = 1_gib;
+
+        inline static constexpr size_t InvalidFileCacheIndex = std::numeric_limits<size_t>::max();
+        inline static constexpr size_t InvalidReadSlotIndex = std::numeric_limits<size_t>::max();
+        inline static constexpr size_t InvalidMetaDataCacheIndex = std::numeric_limits<size_t>::max();
+
+        enum class ReadBackend : u8
+        {
+            Uninitialized,
+            IoUring,
+            ThreadPool
+        };
+
+        struct FileReadInformation
+        {
+            AZStd::chrono::system_clock::time_point m_startTime;
+            FileRequest* m_request{ nullptr };
+            size_t m_fileHandleIndex{ InvalidFileCacheIndex };
+            u64 m_bytesRead{ 0 };
+            bool m_isCanceled{ false };
+
+            void Clear();
+        };
+
+        //! A read that's waiting to be picked up by one of the threads in the thread pool.
+        struct ThreadPoolRead
+        {
+            void* m_output{ nullptr };
+            u64 m_size{ 0 };
+            u64 m_offset{ 0 };
+            size_t m_readSlot{ InvalidReadSlotIndex };
+            int m_fileDescriptor{ -1 };
+        };
+
+        //! The result of a read. The result is either the number of bytes read or a negative errno value.
+        struct ReadCompletion
+        {
+            size_t m_readSlot{ InvalidReadSlotIndex };
+            s64 m_result{ 0 };
+        };
+
+        enum class OpenFileResult
+        {
+            FileOpened,
+            RequestForwarded,
+            CacheFull
+        };
+
+        void InitializeCaches();
+        void InitializeReadBackend();
+        void ShutdownThreadPool();
+        void ThreadPool_Main();
+
+        OpenFileResult OpenFile(int& fileDescriptor, size_t& cacheSlot, FileRequest* request, const FileRequest::ReadData& data);
+        bool ReadRequest(FileRequest* request);
+        bool SubmitRead(size_t readSlot);
+        //! Hands all queued reads to io_uring and fails the ones the kernel rejected.
+        void SubmitQueuedReads();
+        bool CancelRequest(FileRequest* cancelRequest, FileRequestPtr& target);
+        void FileExistsRequest(FileRequest* request);
+        void FileMetaDataRetrievalRequest(FileRequest* request);
+        size_t FindInFileHandleCache(const RequestPath& filePath) const;
+        size_t FindAvailableFileHandleCacheIndex() const;
+        size_t FindAvailableReadSlot() const;
+        size_t FindInMetaDataCache(const RequestPath& filePath) const;
+        size_t GetNextMetaDataCacheSlot();
+        bool IsServicedByThisDrive(const char* filePath) const;
+
+        void EstimateCompletionTimeForRequest(FileRequest* request, AZStd::chrono::system_clock::time_point& startTime,
+            const RequestPath*& activeFile, u64& activeOffset) const;
+        void EstimateCompletionTimeForRequestChecked(FileRequest* request,
+            AZStd::chrono::system_clock::time_point startTime, const RequestPath*& activeFile, u64& activeOffset) const;
+        s32 CalculateNumAvailableSlots() const;
+
+        void FlushCache(const RequestPath& filePath);
+        void FlushEntireCache();
+
+        bool FinalizeReads();
+        void ProcessCompletion(const ReadCompletion& completion);
+        void FinalizeSingleRequest(size_t readSlot, bool encounteredError);
+
+        void Report(const FileRequest::ReportData& data) const;
+
+        TimedAverageWindow<s_statisticsWindowSize> m_fileOpenCloseTimeAverage;
+        TimedAverageWindow<s_statisticsWindowSize> m_getFileExistsTimeAverage;
+        TimedAverageWindow<s_statisticsWindowSize> m_getFileMetaDataRetrievalTimeAverage;
+        TimedAverageWindow<s_statisticsWindowSize> m_readTimeAverage;
+        AverageWindow<u64, float, s_statisticsWindowSize> m_readSizeAverage;
+        AverageWindow<u64, float, s_statisticsWindowSize> m_readsInFlightAverage;
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+        AZ::Statistics::RunningStatistic m_fileSwitchPercentageStat;
+        AZ::Statistics::RunningStatistic m_seekPercentageStat;
+#endif
+        AZStd::chrono::system_clock::time_point m_activeReads_startTime;
+
+        AZStd::deque<FileRequest*> m_pendingReadRequests;
+        AZStd::deque<FileRequest*> m_pendingRequests;
+
+        AZStd::vector<FileReadInformation> m_readSlots_readInfo;
+        AZStd::vector<bool> m_readSlots_active;
+
+        AZStd::vector<AZStd::chrono::system_clock::time_point> m_fileCache_lastTimeUsed;
+        AZStd::vector<RequestPath> m_fileCache_paths;
+        AZStd::vector<int> m_fileCache_handles;
+        AZStd::vector<u16> m_fileCache_activeReads;
+
+        AZStd::vector<RequestPath> m_metaDataCache_paths;
+        AZStd::vector<u64> m_metaDataCache_fileSize;
+
+        AZStd::vector<AZStd::string> m_drivePaths;
+
+        IoUringQueue m_ioUring;
+
+        AZStd::vector<AZStd::thread> m_threadPool;
+        AZStd::mutex m_threadPoolReadsLock;
+        AZStd::condition_variable m_threadPoolReadsSignal;
+        AZStd::deque<ThreadPoolRead> m_threadPoolReads;
+        AZStd::mutex m_threadPoolCompletionsLock;
+        AZStd::vector<ReadCompletion> m_threadPoolCompletions;
+        AZStd::vector<ReadCompletion> m_threadPoolCompletionsProcessing;
+        bool m_threadPoolShutdown{ false };
+
+        size_t m_activeReads_ByteCount{ 0 };
+        size_t m_activeCacheSlot{ InvalidFileCacheIndex };
+        size_t m_metaDataCache_front{ 0 };
+        u64 m_activeOffset{ 0 };
+        u32 m_maxFileHandles{ 1 };
+        u32 m_queueDepth{ 1 };
+        u32 m_threadPoolSize{ 1 };
+        s32 m_overCommit{ 0 };
+
+        u16 m_activeReads_Count{ 0 };
+
+        ConstructionOptions m_constructionOptions;
+        ReadBackend m_readBackend{ ReadBackend::Uninitialized };
+        bool m_cachesInitialized{ false };
+    };
+} // namespace AZ::IO
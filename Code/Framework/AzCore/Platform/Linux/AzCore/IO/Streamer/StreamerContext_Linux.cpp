@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <errno.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include <AzCore/IO/Streamer/StreamerContext_Linux.h>
+#include <AzCore/Debug/Trace.h>
+
+namespace AZ::Platform
+{
+    StreamerContextThreadSync::StreamerContextThreadSync()
+    {
+        m_wakeUpEvent = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        AZ_Assert(m_wakeUpEvent >= 0, "Failed to create the eventfd for the IO Scheduler (Error: %i).", errno);
+    }
+
+    StreamerContextThreadSync::~StreamerContextThreadSync()
+    {
+        if (m_wakeUpEvent >= 0)
+        {
+            ::close(m_wakeUpEvent);
+        }
+    }
+
+    void StreamerContextThreadSync::Suspend()
+    {
+        AZ_Assert(m_wakeUpEvent >= 0, "There is no eventfd created for the main streamer thread to use to suspend.");
+
+        // Reading the eventfd consumes all wake up calls that have been queued so far. If there are none, wait until the
+        // next wake up call is made, either by Resume or by an IO source signaling the descriptor.
+        eventfd_t value;
+        while (::eventfd_read(m_wakeUpEvent, &value) != 0)
+        {
+            if (errno == EAGAIN)
+            {
+                pollfd descriptor{};
+                descriptor.fd = m_wakeUpEvent;
+                descriptor.events = POLLIN;
+                ::poll(&descriptor, 1, -1);
+            }
+            else if (errno != EINTR)
+            {
+                AZ_Assert(false, "Unexpected error while waiting on the IO Scheduler eventfd (Error: %i).", errno);
+                return;
+            }
+        }
+    }
+
+    void StreamerContextThreadSync::Resume()
+    {
+        AZ_Assert(m_wakeUpEvent >= 0, "There is no eventfd created for the main streamer thread to use to resume.");
+        ::eventfd_write(m_wakeUpEvent, 1);
+    }
+
+    int StreamerContextThreadSync::GetWakeUpEventDescriptor() const
+    {
+        return m_wakeUpEvent;
+    }
+} // namespace AZ::Platform
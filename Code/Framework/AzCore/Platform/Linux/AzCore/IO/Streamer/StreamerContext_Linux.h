@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+
+namespace AZ::Platform
+{
+    //! Synchronization primitive for the Streamer thread on Linux. Sleeping and waking up is done through an eventfd so
+    //! the same descriptor can be handed to asynchronous IO sources, such as io_uring, which will then wake up the
+    //! scheduler thread when a read completes without needing an additional thread to forward completions.
+    class StreamerContextThreadSync
+    {
+    public:
+        StreamerContextThreadSync();
+        ~StreamerContextThreadSync();
+
+        void Suspend();
+        void Resume();
+
+        //! Returns the eventfd that's used to wake up the scheduler thread. Writing to this descriptor, or registering it
+        //! with a kernel object that signals it, has the same effect as calling Resume. Returns -1 if the eventfd could
+        //! not be created.
+        int GetWakeUpEventDescriptor() const;
+
+    private:
+        int m_wakeUpEvent{ -1 };
+    };
+} // namespace AZ::Platform
@@ -31,9 +31,20 @@ set(FILES
     ../Common/UnixLike/AzCore/Debug/StackTracer_UnixLike.cpp
     ../Common/UnixLike/AzCore/Debug/Trace_UnixLike.cpp
     AzCore/Debug/Trace_Linux.cpp
-    ../Common/Default/AzCore/IO/Streamer/StreamerConfiguration_Default.cpp
-    ../Common/Default/AzCore/IO/Streamer/StreamerContext_Default.cpp
-    ../Common/Default/AzCore/IO/Streamer/StreamerContext_Default.h
+    AzCore/IO/Streamer/IoUring_Linux.h
+    AzCore/IO/Streamer/IoUring_Linux.cpp
+    AzCore/IO/Streamer/MemoryMappedDrive_Linux.h
+    AzCore/IO/Streamer/MemoryMappedDrive_Linux.cpp
+    AzCore/IO/Streamer/MemoryMappedDriveConfig_Linux.h
+    AzCore/IO/Streamer/MemoryMappedDriveConfig_Linux.cpp
+    AzCore/IO/Streamer/StorageDrive_Linux.h
+    AzCore/IO/Streamer/StorageDrive_Linux.cpp
+    AzCore/IO/Streamer/StorageDriveConfig_Linux.h
+    AzCore/IO/Streamer/StorageDriveConfig_Linux.cpp
+    AzCore/IO/Streamer/StreamerConfiguration_Linux.cpp
+    AzCore/IO/Streamer/StreamerContext_Linux.cpp
+    AzCore/IO/Streamer/StreamerContext_Linux.h
+    AzCore/IO/Streamer/StreamerContext_Platform.h
     ../Common/UnixLike/AzCore/IO/SystemFile_UnixLike.cpp
     ../Common/UnixLike/AzCore/IO/SystemFile_UnixLike.h
     ../Common/UnixLike/AzCore/IO/Internal/SystemFileUtils_UnixLike.h
@@ -10,7 +10,13 @@
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/Console/Console.h>
 #include <AzCore/Settings/SettingsRegistryImpl.h>
+#include <AzCore/Time/ITime.h>
 #include <AzCore/Utils/Utils.h>
+#include <AzCore/std/parallel/thread.h>
+
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+#endif
 
 namespace AZ
 {
@@ -105,6 +111,14 @@ namespace AZ
 
     AZ_CONSOLEFREEFUNC(TestFreeFunc, AZ::ConsoleFunctorFlags::Null, "");
 
+    static AZStd::atomic<size_t> s_queuedFreeFuncCalls{ 0 };
+    void TestQueuedFreeFunc(const AZ::ConsoleCommandContainer&)
+    {
+        ++s_queuedFreeFuncCalls;
+    }
+
+    AZ_CONSOLEFREEFUNC(TestQueuedFreeFunc, AZ::ConsoleFunctorFlags::Null, "");
+
     TEST_F(ConsoleTests, CVar_GetSetTest_Bool)
     {
         testBool = false; // Reset testBool to false for scenarios where gtest_repeat is invoked
@@ -346,6 +360,73 @@ namespace AZ
             EXPECT_EQ(2, instance.m_classFuncArgs);
         }
     }
+
+    TEST_F(ConsoleTests, FindCommand_DifferentCase_FindsCommand)
+    {
+        ConsoleFunctorBase* foundCommand = m_console->FindCommand("TESTBOOL");
+        ASSERT_NE(nullptr, foundCommand);
+        EXPECT_STREQ("testBool", foundCommand->GetName());
+        EXPECT_EQ(nullptr, m_console->FindCommand("testBoo"));
+    }
+
+    TEST_F(ConsoleTests, CVar_ArithmeticAndEnumTypes_UseAtomics)
+    {
+        static_assert(ConsoleThreadSafety<int32_t> == AZ::ThreadSafety::UseStdAtomic);
+        static_assert(ConsoleThreadSafety<AZ::TimeMs> == AZ::ThreadSafety::UseStdAtomic);
+        static_assert(ConsoleThreadSafety<AZ::CVarFixedString> == AZ::ThreadSafety::RequiresLock);
+    }
+
+    TEST_F(ConsoleTests, QueueCommand_CommandsExecutedInOrderWhenQueueIsDrained)
+    {
+        testInt32 = 0;
+        m_console->QueueCommand("testInt32 1");
+        m_console->QueueCommand("testInt32 2");
+        EXPECT_EQ(0, int32_t(testInt32));
+
+        EXPECT_EQ(2, m_console->ExecuteQueuedConsoleCommands());
+        EXPECT_EQ(2, int32_t(testInt32));
+        EXPECT_EQ(0, m_console->ExecuteQueuedConsoleCommands());
+    }
+
+    TEST_F(ConsoleTests, QueueCommand_FromMultipleThreads_AllCommandsExecuted)
+    {
+        constexpr size_t threadCount = 4;
+        constexpr size_t commandsPerThread = 250;
+        s_queuedFreeFuncCalls = 0;
+
+        AZStd::thread threads[threadCount];
+        for (AZStd::thread& thread : threads)
+        {
+            thread = AZStd::thread([this]()
+            {
+                for (size_t i = 0; i < commandsPerThread; ++i)
+                {
+                    m_console->QueueCommand("TestQueuedFreeFunc");
+                }
+            });
+        }
+
+        // Drain while the producers are still running
+        size_t executedCount = 0;
+        while (executedCount < threadCount * commandsPerThread)
+        {
+            executedCount += m_console->ExecuteQueuedConsoleCommands();
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        EXPECT_EQ(threadCount * commandsPerThread, executedCount);
+        EXPECT_EQ(threadCount * commandsPerThread, s_queuedFreeFuncCalls);
+    }
+
+    TEST_F(ConsoleTests, QueueCommand_ConsoleDestroyedWithQueuedCommands_DoesNotLeak)
+    {
+        m_console->QueueCommand("testInt32 1");
+        m_console->QueueCommand("testInt32 2");
+        // The queued commands are released by the console destructor in TearDown
+    }
 }
 
 
@@ -653,3 +734,101 @@ namespace ConsoleSettingsRegistryTests
         )
     );
 }
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    AZ_CVAR(int32_t, bm_consoleInt32, 0, nullptr, AZ::ConsoleFunctorFlags::Null, "");
+
+    void GeneratedConsoleFunc(const AZ::ConsoleCommandContainer&)
+    {
+    }
+
+    class ConsoleBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        using UnitTest::AllocatorsBenchmarkFixture::SetUp;
+        using UnitTest::AllocatorsBenchmarkFixture::TearDown;
+
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            m_console = AZStd::make_unique<AZ::Console>();
+            m_console->LinkDeferredFunctors(AZ::ConsoleFunctorBase::GetDeferredHead());
+
+            // Register additional functors to resemble the number of console functors in a full application
+            const int64_t functorCount = state.range(0);
+            m_names.reserve(functorCount);
+            m_functors.reserve(functorCount);
+            for (int64_t i = 0; i < functorCount; ++i)
+            {
+                m_names.emplace_back(AZStd::string::format("bm_generatedFunc%lld", static_cast<long long>(i)));
+            }
+            for (const AZStd::string& name : m_names)
+            {
+                m_functors.emplace_back(AZStd::make_unique<AZ::ConsoleFunctor<void, false>>(
+                    *m_console, name.c_str(), "", AZ::ConsoleFunctorFlags::Null, AZ::TypeId::CreateNull(), &GeneratedConsoleFunc));
+            }
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            m_functors = {};
+            m_names = {};
+            m_console.reset();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        AZStd::unique_ptr<AZ::Console> m_console;
+        AZStd::vector<AZStd::string> m_names;
+        AZStd::vector<AZStd::unique_ptr<AZ::ConsoleFunctor<void, false>>> m_functors;
+    };
+
+    BENCHMARK_DEFINE_F(ConsoleBenchmarkFixture, FindCommand)(benchmark::State& state)
+    {
+        size_t index = 0;
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(m_console->FindCommand(m_names[index]));
+            index = (index + 1) % m_names.size();
+        }
+    }
+
+    BENCHMARK_DEFINE_F(ConsoleBenchmarkFixture, PerformCommand)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            m_console->PerformCommand("bm_consoleInt32 7", AZ::ConsoleSilentMode::Silent);
+        }
+    }
+
+    BENCHMARK_DEFINE_F(ConsoleBenchmarkFixture, QueueAndExecuteCommands)(benchmark::State& state)
+    {
+        constexpr size_t batchSize = 64;
+        for (auto _ : state)
+        {
+            for (size_t i = 0; i < batchSize; ++i)
+            {
+                m_console->QueueCommand("bm_consoleInt32 7", AZ::ConsoleSilentMode::Silent);
+            }
+            m_console->ExecuteQueuedConsoleCommands();
+        }
+        state.SetItemsProcessed(state.iterations() * batchSize);
+    }
+
+    BENCHMARK_DEFINE_F(ConsoleBenchmarkFixture, ReadCVar)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(int32_t(bm_consoleInt32));
+        }
+    }
+
+    BENCHMARK_REGISTER_F(ConsoleBenchmarkFixture, FindCommand)->Arg(100)->Arg(1000);
+    BENCHMARK_REGISTER_F(ConsoleBenchmarkFixture, PerformCommand)->Arg(100)->Arg(1000);
+    BENCHMARK_REGISTER_F(ConsoleBenchmarkFixture, QueueAndExecuteCommands)->Arg(100)->Arg(1000);
+    BENCHMARK_REGISTER_F(ConsoleBenchmarkFixture, ReadCVar)->Arg(100);
+} // namespace Benchmark
+#endif // HAVE_BENCHMARK
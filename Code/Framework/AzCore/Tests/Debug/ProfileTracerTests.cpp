@@ -0,0 +1,305 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Debug/ProfileTracer.h>
+#include <AzCore/IO/ByteContainerStream.h>
+#include <AzCore/JSON/document.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+#endif
+
+namespace AZ::Debug
+{
+    class ProfileTracerTest
+        : public UnitTest::AllocatorsFixture
+    {
+    public:
+        void SetUp() override
+        {
+            UnitTest::AllocatorsFixture::SetUp();
+            ProfileTracer::Create();
+            m_tracer = ProfileTracer::Get();
+            ASSERT_NE(nullptr, m_tracer);
+            m_tracer->SetEnabled(true);
+        }
+
+        void TearDown() override
+        {
+            m_tracer = nullptr;
+            ProfileTracer::Destroy();
+            UnitTest::AllocatorsFixture::TearDown();
+        }
+
+        AZStd::string WriteTrace()
+        {
+            AZStd::string trace;
+            IO::ByteContainerStream<AZStd::string> stream(&trace);
+            EXPECT_TRUE(m_tracer->WriteChromeTrace(stream));
+            return trace;
+        }
+
+        static size_t CountOccurrences(const AZStd::string& text, const char* pattern)
+        {
+            size_t count = 0;
+            for (size_t pos = text.find(pattern); pos != AZStd::string::npos; pos = text.find(pattern, pos + 1))
+            {
+                ++count;
+            }
+            return count;
+        }
+
+    protected:
+        ProfileTracer* m_tracer = nullptr;
+    };
+
+    TEST_F(ProfileTracerTest, ProfileScope_Enabled_WritesBeginAndEndEvents)
+    {
+        {
+            AZ_PROFILE_SCOPE(UnitTest, "ProfileTracerTest Outer");
+            AZ_PROFILE_SCOPE(UnitTest, "ProfileTracerTest Inner");
+        }
+
+        AZStd::string trace = WriteTrace();
+        EXPECT_NE(AZStd::string::npos, trace.find("\"name\":\"ProfileTracerTest Outer\",\"cat\":\"UnitTest\",\"ph\":\"B\""));
+        EXPECT_NE(AZStd::string::npos, trace.find("\"name\":\"ProfileTracerTest Inner\",\"cat\":\"UnitTest\",\"ph\":\"B\""));
+        EXPECT_EQ(2, CountOccurrences(trace, "\"ph\":\"B\""));
+        EXPECT_EQ(2, CountOccurrences(trace, "\"ph\":\"E\""));
+    }
+
+    TEST_F(ProfileTracerTest, ProfileScope_Disabled_RecordsNothing)
+    {
+        m_tracer->SetEnabled(false);
+        {
+            AZ_PROFILE_SCOPE(UnitTest, "ProfileTracerTest Disabled");
+            AZ_PROFILE_COUNTER("ProfileTracerTest Counter", 1);
+        }
+
+        AZStd::string trace = WriteTrace();
+        EXPECT_EQ(AZStd::string::npos, trace.find("ProfileTracerTest"));
+        EXPECT_EQ(0, m_tracer->GetThreadCount());
+    }
+
+    TEST_F(ProfileTracerTest, WriteChromeTrace_CountersAndFrameMarkers_ProducesValidJson)
+    {
+        ProfileTracer::RecordFrameMarker();
+        AZ_PROFILE_COUNTER("ProfileTracerTest Counter", 42);
+        ProfileTracer::RecordFrameMarker();
+        {
+            AZ_PROFILE_SCOPE(UnitTest, "ProfileTracerTest \"Quoted\" \\ Scope");
+        }
+
+        AZStd::string trace = WriteTrace();
+        rapidjson::Document document;
+        document.Parse(trace.c_str());
+        ASSERT_FALSE(document.HasParseError());
+        ASSERT_TRUE(document.HasMember("traceEvents"));
+        ASSERT_TRUE(document["traceEvents"].IsArray());
+
+        size_t counters = 0;
+        size_t frames = 0;
+        bool foundQuotedScope = false;
+        for (const rapidjson::Value& event : document["traceEvents"].GetArray())
+        {
+            const char* phase = event["ph"].GetString();
+            if (strcmp(phase, "C") == 0)
+            {
+                ++counters;
+                EXPECT_STREQ("ProfileTracerTest Counter", event["name"].GetString());
+                EXPECT_EQ(42, event["args"]["value"].GetInt64());
+            }
+            else if (strcmp(phase, "i") == 0)
+            {
+                EXPECT_EQ(frames, event["args"]["frame"].GetUint64());
+                ++frames;
+            }
+            else if (strcmp(phase, "B") == 0)
+            {
+                foundQuotedScope = foundQuotedScope || strcmp(event["name"].GetString(), "ProfileTracerTest \"Quoted\" \\ Scope") == 0;
+            }
+        }
+        EXPECT_EQ(1, counters);
+        EXPECT_EQ(2, frames);
+        EXPECT_TRUE(foundQuotedScope);
+    }
+
+    TEST_F(ProfileTracerTest, RingBuffer_MoreEventsThanCapacity_KeepsMostRecentEvents)
+    {
+        m_tracer->SetEventsPerThread(16);
+        for (int i = 0; i < 100; ++i)
+        {
+            AZ_PROFILE_COUNTER("ProfileTracerTest Counter", i);
+        }
+
+        // Once the buffer has wrapped, the slot the owning thread writes next may be mid write, so it is never exported
+        AZStd::string trace = WriteTrace();
+        EXPECT_EQ(15, CountOccurrences(trace, "\"ph\":\"C\""));
+        EXPECT_NE(AZStd::string::npos, trace.find("\"value\":85}"));
+        EXPECT_NE(AZStd::string::npos, trace.find("\"value\":99}"));
+        EXPECT_EQ(AZStd::string::npos, trace.find("\"value\":84}"));
+    }
+
+    TEST_F(ProfileTracerTest, RingBuffer_BeginOverwritten_EndIsDropped)
+    {
+        m_tracer->SetEventsPerThread(16);
+        {
+            AZ_PROFILE_SCOPE(UnitTest, "ProfileTracerTest Overwritten");
+            for (int i = 0; i < 32; ++i)
+            {
+                AZ_PROFILE_COUNTER("ProfileTracerTest Counter", i);
+            }
+        }
+
+        AZStd::string trace = WriteTrace();
+        EXPECT_EQ(AZStd::string::npos, trace.find("ProfileTracerTest Overwritten"));
+        EXPECT_EQ(0, CountOccurrences(trace, "\"ph\":\"E\""));
+    }
+
+    TEST_F(ProfileTracerTest, SetEventsPerThread_NotPowerOfTwo_RoundsUp)
+    {
+        m_tracer->SetEventsPerThread(1000);
+        EXPECT_EQ(1024, m_tracer->GetEventsPerThread());
+    }
+
+    TEST_F(ProfileTracerTest, Clear_DiscardsPreviousEvents)
+    {
+        {
+            AZ_PROFILE_SCOPE(UnitTest, "ProfileTracerTest BeforeClear");
+        }
+        m_tracer->Clear();
+        AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(1));
+        {
+            AZ_PROFILE_SCOPE(UnitTest, "ProfileTracerTest AfterClear");
+        }
+
+        AZStd::string trace = WriteTrace();
+        EXPECT_EQ(AZStd::string::npos, trace.find("ProfileTracerTest BeforeClear"));
+        EXPECT_NE(AZStd::string::npos, trace.find("ProfileTracerTest AfterClear"));
+    }
+
+    TEST_F(ProfileTracerTest, InternName_SameAddress_ReturnsSameId)
+    {
+        const char* name = "ProfileTracerTest Name";
+        const u32 id = m_tracer->InternName(name);
+        EXPECT_NE(0, id);
+        EXPECT_EQ(id, m_tracer->InternName(name));
+        EXPECT_NE(id, m_tracer->InternName("ProfileTracerTest OtherName"));
+        EXPECT_EQ(0, m_tracer->InternName(nullptr));
+    }
+
+    TEST_F(ProfileTracerTest, MultipleThreads_EachThreadGetsBuffer_BuffersOfExitedThreadsAreReused)
+    {
+        constexpr size_t threadCount = 4;
+        AZStd::atomic<size_t> recorded{ 0 };
+        AZStd::vector<AZStd::thread> threads;
+        for (size_t i = 0; i < threadCount; ++i)
+        {
+            threads.emplace_back([&recorded]()
+            {
+                {
+                    AZ_PROFILE_SCOPE(UnitTest, "ProfileTracerTest Thread");
+                }
+                // Keep all threads alive until every one of them has recorded an event, so none of them adopt another's buffer.
+                recorded.fetch_add(1);
+                while (recorded.load() < threadCount)
+                {
+                    AZStd::this_thread::yield();
+                }
+            });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+        EXPECT_EQ(threadCount, m_tracer->GetThreadCount());
+
+        AZStd::thread lateThread([]()
+        {
+            AZ_PROFILE_SCOPE(UnitTest, "ProfileTracerTest LateThread");
+        });
+        lateThread.join();
+        EXPECT_EQ(threadCount, m_tracer->GetThreadCount());
+
+        AZStd::string trace = WriteTrace();
+        EXPECT_EQ(threadCount, CountOccurrences(trace, "\"name\":\"ProfileTracerTest Thread\""));
+        EXPECT_EQ(1, CountOccurrences(trace, "\"name\":\"ProfileTracerTest LateThread\""));
+        EXPECT_EQ(threadCount, CountOccurrences(trace, "\"name\":\"thread_name\""));
+    }
+} // namespace AZ::Debug
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    class ProfileTracerBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        using UnitTest::AllocatorsBenchmarkFixture::SetUp;
+        using UnitTest::AllocatorsBenchmarkFixture::TearDown;
+
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            AZ::Debug::ProfileTracer::Create();
+            AZ::Debug::ProfileTracer::Get()->SetEnabled(state.range(0) != 0);
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            AZ::Debug::ProfileTracer::Destroy();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+    };
+
+    // Arg 0 measures the cost of an instrumented scope while the tracer is disabled, arg 1 while it's recording.
+    BENCHMARK_DEFINE_F(ProfileTracerBenchmarkFixture, ProfileScope)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            AZ_PROFILE_SCOPE(UnitTest, "ProfileTracerBenchmark Scope");
+        }
+    }
+    BENCHMARK_REGISTER_F(ProfileTracerBenchmarkFixture, ProfileScope)->Arg(0)->Arg(1);
+
+    BENCHMARK_DEFINE_F(ProfileTracerBenchmarkFixture, Counter)(benchmark::State& state)
+    {
+        int64_t value = 0;
+        for (auto _ : state)
+        {
+            AZ_PROFILE_COUNTER("ProfileTracerBenchmark Counter", ++value);
+        }
+    }
+    BENCHMARK_REGISTER_F(ProfileTracerBenchmarkFixture, Counter)->Arg(0)->Arg(1);
+
+    BENCHMARK_DEFINE_F(ProfileTracerBenchmarkFixture, WriteChromeTrace)(benchmark::State& state)
+    {
+        AZ::Debug::ProfileTracer* tracer = AZ::Debug::ProfileTracer::Get();
+        tracer->SetEnabled(true);
+        for (size_t i = 0; i < tracer->GetEventsPerThread(); ++i)
+        {
+            AZ_PROFILE_SCOPE(UnitTest, "ProfileTracerBenchmark Scope");
+        }
+
+        AZStd::string trace;
+        for (auto _ : state)
+        {
+            trace.clear();
+            AZ::IO::ByteContainerStream<AZStd::string> stream(&trace);
+            tracer->WriteChromeTrace(stream);
+            benchmark::DoNotOptimize(trace.data());
+        }
+    }
+    BENCHMARK_REGISTER_F(ProfileTracerBenchmarkFixture, WriteChromeTrace)->Arg(1);
+} // namespace Benchmark
+#endif
@@ -45,7 +45,7 @@ namespace BusImplementation
     };
 
     // Traits for the benchmark bus
-    template <AZ::EBusAddressPolicy addressPolicy, AZ::EBusHandlerPolicy handlerPolicy, bool locklessDispatch = false>
+    template <AZ::EBusAddressPolicy addressPolicy, AZ::EBusHandlerPolicy handlerPolicy, bool locklessDispatch = false, class mutexType = AZStd::recursive_mutex>
     class Traits
         : public AZ::EBusTraits
     {
@@ -58,7 +58,7 @@ namespace BusImplementation
         static const bool EnableEventQueue = true;
 
         // Force locking
-        using MutexType = AZStd::recursive_mutex;
+        using MutexType = mutexType;
 
         // Only specialize BusIdType if not single address
         using BusIdType = AZStd::conditional_t<AddressPolicy == AZ::EBusAddressPolicy::Single, AZ::NullBusId, int>;
@@ -193,8 +193,8 @@ private:
 };
 
 // Definition of the benchmark bus, depending on supplied policies
-template <AZ::EBusAddressPolicy addressPolicy, AZ::EBusHandlerPolicy handlerPolicy, bool locklessDispatch = false>
-using TestBus = AZ::EBus<BusImplementation::Interface, BusImplementation::Traits<addressPolicy, handlerPolicy, locklessDispatch>>;
+template <AZ::EBusAddressPolicy addressPolicy, AZ::EBusHandlerPolicy handlerPolicy, bool locklessDispatch = false, class mutexType = AZStd::recursive_mutex>
+using TestBus = AZ::EBus<BusImplementation::Interface, BusImplementation::Traits<addressPolicy, handlerPolicy, locklessDispatch, mutexType>>;
 
 #define EBUS_TEST_ALIAS(BusType, AddressPolicy, HandlerPolicy)                                              \
     using BusType = TestBus<AZ::EBusAddressPolicy::AddressPolicy, AZ::EBusHandlerPolicy::HandlerPolicy>;    \
@@ -2745,6 +2745,149 @@ namespace UnitTest
         AZ_TEST_STOP_TRACE_SUPPRESSION(1);
     }
 
+    struct ReadMostlyEvents
+        : public AZ::EBusTraits
+    {
+        using MutexType = AZ::EBusReadMostlyMutex;
+        static const EBusAddressPolicy AddressPolicy = EBusAddressPolicy::ById;
+        typedef uint32_t BusIdType;
+
+        virtual ~ReadMostlyEvents() = default;
+        virtual void Calculate(int x, int y, int z) = 0;
+        virtual void RemoveMe() = 0;
+        virtual void Redispatch(uint32_t id) = 0;
+    };
+
+    using ReadMostlyBus = AZ::EBus<ReadMostlyEvents>;
+
+    struct ReadMostlyImpl
+        : public ReadMostlyBus::Handler
+    {
+        AZStd::atomic<uint32_t> m_calls{ 0 };
+        AZStd::atomic<int> m_val{ 0 };
+
+        ~ReadMostlyImpl() override
+        {
+            BusDisconnect();
+        }
+
+        void Calculate(int x, int y, int z) override
+        {
+            m_val = x + (y * z);
+            ++m_calls;
+        }
+        void RemoveMe() override
+        {
+            BusDisconnect();
+        }
+        void Redispatch(uint32_t id) override
+        {
+            ReadMostlyBus::Event(id, &ReadMostlyBus::Events::Calculate, 1, 2, 3);
+        }
+    };
+
+    TEST_F(EBus, ReadMostlyDispatch_ConcurrentBroadcastsAndConnects_AllHandlersCalled)
+    {
+        const size_t threadCount = 8;
+        enum : int { cycleCount = 1000 };
+        AZStd::thread threads[threadCount];
+
+        ReadMostlyImpl handler;
+        handler.BusConnect(0);
+
+        AZ::EBusReadMostlyMutex& busMutex = ReadMostlyBus::GetOrCreateContext().m_contextMutex;
+        const size_t claimedSlotsBefore = busMutex.GetClaimedReaderSlotCount();
+
+        AZStd::atomic_bool done{ false };
+        AZStd::thread connectThread([&done]()
+        {
+            // Keep connecting and disconnecting handlers while the other threads dispatch.
+            while (!done)
+            {
+                ReadMostlyImpl transientHandler;
+                transientHandler.BusConnect(1);
+                transientHandler.BusDisconnect();
+                transientHandler.BusConnect(0);
+                transientHandler.BusDisconnect();
+            }
+        });
+
+        auto work = [&busMutex]()
+        {
+            for (int i = 1; i < cycleCount; ++i)
+            {
+                ReadMostlyBus::Broadcast(&ReadMostlyBus::Events::Calculate, i, i * 2, i << 4);
+                ReadMostlyBus::Event(0, &ReadMostlyBus::Events::Calculate, i, 1, 1);
+            }
+            // The bus outlives this test, don't leave it with slots owned by ids of threads that have exited
+            busMutex.ReleaseReaderSlot();
+        };
+
+        for (AZStd::thread& thread : threads)
+        {
+            thread = AZStd::thread(work);
+        }
+
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+        done = true;
+        connectThread.join();
+
+        EXPECT_EQ(threadCount * (cycleCount - 1) * 2, handler.m_calls);
+        EXPECT_EQ(claimedSlotsBefore, busMutex.GetClaimedReaderSlotCount());
+    }
+
+    TEST_F(EBus, ReadMostlyDispatch_ReleasedReaderSlot_IsReclaimedOnNextDispatch)
+    {
+        AZ::EBusReadMostlyMutex& busMutex = ReadMostlyBus::GetOrCreateContext().m_contextMutex;
+        busMutex.ReleaseReaderSlot();
+        const size_t claimedSlotsBefore = busMutex.GetClaimedReaderSlotCount();
+
+        ReadMostlyImpl handler;
+        handler.BusConnect(5);
+        ReadMostlyBus::Event(5, &ReadMostlyBus::Events::Calculate, 1, 2, 3);
+        EXPECT_EQ(claimedSlotsBefore + 1, busMutex.GetClaimedReaderSlotCount());
+
+        busMutex.ReleaseReaderSlot();
+        EXPECT_EQ(claimedSlotsBefore, busMutex.GetClaimedReaderSlotCount());
+
+        // Dispatching again claims a slot again and still reaches the handler
+        ReadMostlyBus::Event(5, &ReadMostlyBus::Events::Calculate, 1, 2, 3);
+        EXPECT_EQ(2u, handler.m_calls);
+        busMutex.ReleaseReaderSlot();
+    }
+
+    TEST_F(EBus, ReadMostlyDispatch_DisconnectLastHandlerInDispatch_RemovesAddress)
+    {
+        ReadMostlyImpl handler;
+        handler.BusConnect(4);
+        EXPECT_TRUE(ReadMostlyBus::HasHandlers(4));
+
+        ReadMostlyBus::Event(4, &ReadMostlyBus::Events::RemoveMe);
+        EXPECT_FALSE(handler.BusIsConnected());
+        EXPECT_FALSE(ReadMostlyBus::HasHandlers(4));
+
+        // Connecting again recreates the address.
+        handler.BusConnect(4);
+        ReadMostlyBus::Event(4, &ReadMostlyBus::Events::Calculate, 1, 2, 3);
+        EXPECT_EQ(1, handler.m_calls);
+    }
+
+    TEST_F(EBus, ReadMostlyDispatch_NestedDispatch_Succeeds)
+    {
+        ReadMostlyImpl first;
+        ReadMostlyImpl second;
+        first.BusConnect(1);
+        second.BusConnect(2);
+
+        ReadMostlyBus::Event(1, &ReadMostlyBus::Events::Redispatch, 2u);
+        EXPECT_EQ(0, first.m_calls);
+        EXPECT_EQ(1, second.m_calls);
+        EXPECT_EQ(7, second.m_val);
+    }
+
     namespace LocklessTest
     {
         struct LocklessConnectorEvents
@@ -4501,6 +4644,61 @@ namespace Benchmark
         }
     }
     BENCHMARK(BM_EBus_Multithreaded_Lockless)->Apply(&BenchmarkSettings::OneToMany)->Apply(&BenchmarkSettings::Multithreaded);
+
+    static void BM_EBus_Multithreaded_ReadMostly(::benchmark::State& state)
+    {
+        using Bus = TestBus<AZ::EBusAddressPolicy::Single, AZ::EBusHandlerPolicy::Multiple, false, AZ::EBusReadMostlyMutex>;
+
+        AZStd::unique_ptr<BM_EBusEnvironment<Bus>> ebusBenchmarkEnv;
+        if (state.thread_index == 0)
+        {
+            ebusBenchmarkEnv = AZStd::make_unique<BM_EBusEnvironment<Bus>>();
+            ebusBenchmarkEnv->SetUpBenchmark();
+            ebusBenchmarkEnv->Connect(state);
+        }
+
+        while (state.KeepRunning())
+        {
+            Bus::Broadcast(&Bus::Events::OnWait);
+        };
+
+        if (state.thread_index == 0)
+        {
+            ebusBenchmarkEnv->Disconnect(state);
+            ebusBenchmarkEnv->TearDownBenchmark();
+        }
+    }
+    BENCHMARK(BM_EBus_Multithreaded_ReadMostly)->Apply(&BenchmarkSettings::OneToMany)->Apply(&BenchmarkSettings::Multithreaded);
+
+    // Cheap handlers make the cost of the bus lock itself dominate, which is the case for hot buses like the TickBus.
+    template <typename Bus>
+    static void BM_EBus_Multithreaded_CheapEvent(::benchmark::State& state)
+    {
+        AZStd::unique_ptr<BM_EBusEnvironment<Bus>> ebusBenchmarkEnv;
+        if (state.thread_index == 0)
+        {
+            ebusBenchmarkEnv = AZStd::make_unique<BM_EBusEnvironment<Bus>>();
+            ebusBenchmarkEnv->SetUpBenchmark();
+            ebusBenchmarkEnv->Connect(state);
+        }
+
+        while (state.KeepRunning())
+        {
+            Bus::Broadcast(&Bus::Events::OnEvent);
+        };
+
+        if (state.thread_index == 0)
+        {
+            ebusBenchmarkEnv->Disconnect(state);
+            ebusBenchmarkEnv->TearDownBenchmark();
+        }
+    }
+    using MultithreadedLockedBus = TestBus<AZ::EBusAddressPolicy::Single, AZ::EBusHandlerPolicy::Multiple, false>;
+    using MultithreadedLocklessBus = TestBus<AZ::EBusAddressPolicy::Single, AZ::EBusHandlerPolicy::Multiple, true>;
+    using MultithreadedReadMostlyBus = TestBus<AZ::EBusAddressPolicy::Single, AZ::EBusHandlerPolicy::Multiple, false, AZ::EBusReadMostlyMutex>;
+    BENCHMARK_TEMPLATE(BM_EBus_Multithreaded_CheapEvent, MultithreadedLockedBus)->Apply(&BenchmarkSettings::OneToMany)->Apply(&BenchmarkSettings::Multithreaded);
+    BENCHMARK_TEMPLATE(BM_EBus_Multithreaded_CheapEvent, MultithreadedLocklessBus)->Apply(&BenchmarkSettings::OneToMany)->Apply(&BenchmarkSettings::Multithreaded);
+    BENCHMARK_TEMPLATE(BM_EBus_Multithreaded_CheapEvent, MultithreadedReadMostlyBus)->Apply(&BenchmarkSettings::OneToMany)->Apply(&BenchmarkSettings::Multithreaded);
 }
 
 #endif // HAVE_BENCHMARK
@@ -23,6 +23,8 @@
 #include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/fixed_list.h>
 #include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/numeric.h>
+#include <AzCore/std/string/string.h>
 #include <AzCore/std/parallel/containers/concurrent_vector.h>
 
 #include <AzCore/Memory/SystemAllocator.h>
@@ -32,6 +34,7 @@
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/UnitTest/TestTypes.h>
 
+#include <numeric>
 #include <random>
 
 #if AZ_TRAIT_SUPPORTS_MICROSOFT_PPL
@@ -1136,6 +1139,172 @@ namespace UnitTest
         run();
     }
 
+    class JobParallelAlgorithmsTest
+        : public DefaultJobManagerSetupFixture
+    {
+    public:
+        void SetUp() override
+        {
+            DefaultJobManagerSetupFixture::SetUp();
+
+            std::mt19937 randomGenerator(1); // Always use the same seed
+            std::uniform_int_distribution<int> randomDistribution(-1000, 1000);
+            m_values.resize(NumValues);
+            for (int& value : m_values)
+            {
+                value = randomDistribution(randomGenerator);
+            }
+        }
+
+        void TearDown() override
+        {
+            m_values = {};
+
+            DefaultJobManagerSetupFixture::TearDown();
+        }
+
+    protected:
+        static const int NumValues = 100000;
+        AZStd::vector<int> m_values;
+    };
+
+    TEST_F(JobParallelAlgorithmsTest, ParallelForRange_VisitsEveryIndexOnce)
+    {
+        AZStd::vector<int> visits(NumValues, 0);
+        for (int grainSize : { 0, 1, 7, 1000, NumValues * 2 })
+        {
+            parallel_for_range(0, NumValues, grainSize, [&visits, grainSize](int chunkStart, int chunkEnd)
+            {
+                EXPECT_LT(chunkStart, chunkEnd);
+                if (grainSize > 0)
+                {
+                    EXPECT_LE(chunkEnd - chunkStart, grainSize);
+                }
+                for (int i = chunkStart; i < chunkEnd; ++i)
+                {
+                    ++visits[i];
+                }
+            });
+        }
+
+        for (int visitCount : visits)
+        {
+            EXPECT_EQ(5, visitCount);
+        }
+    }
+
+    TEST_F(JobParallelAlgorithmsTest, ParallelTransform_MatchesSerial)
+    {
+        AZStd::vector<int> results(NumValues);
+        auto end = parallel_transform(m_values.begin(), m_values.end(), results.begin(), [](int value) { return value * 3; });
+        EXPECT_EQ(results.end(), end);
+        for (int i = 0; i < NumValues; ++i)
+        {
+            EXPECT_EQ(m_values[i] * 3, results[i]);
+        }
+    }
+
+    TEST_F(JobParallelAlgorithmsTest, ParallelReduce_MatchesSerial)
+    {
+        const AZ::s64 serialSum = AZStd::accumulate(m_values.begin(), m_values.end(), AZ::s64(0));
+        EXPECT_EQ(serialSum, parallel_reduce(m_values.begin(), m_values.end(), AZ::s64(0)));
+        EXPECT_EQ(serialSum + 10, parallel_reduce(m_values.begin(), m_values.end(), AZ::s64(10), AZStd::plus<>(), 13));
+
+        const int serialMax = *AZStd::minmax_element(m_values.begin(), m_values.end()).second;
+        EXPECT_EQ(serialMax, parallel_reduce(m_values.begin(), m_values.end(), m_values[0], [](int lhs, int rhs) { return AZStd::GetMax(lhs, rhs); }));
+
+        AZStd::vector<int> empty;
+        EXPECT_EQ(42, parallel_reduce(empty.begin(), empty.end(), 42));
+    }
+
+    TEST_F(JobParallelAlgorithmsTest, ParallelReduce_NonCommutativeOperation_KeepsOrder)
+    {
+        AZStd::vector<AZStd::string> letters;
+        AZStd::string expected;
+        for (int i = 0; i < 1000; ++i)
+        {
+            letters.push_back(AZStd::string(1, static_cast<char>('a' + i % 26)));
+            expected += letters.back();
+        }
+        EXPECT_EQ(expected, parallel_reduce(letters.begin(), letters.end(), AZStd::string(), AZStd::plus<>(), 10));
+    }
+
+    TEST_F(JobParallelAlgorithmsTest, ParallelScan_MatchesSerial)
+    {
+        AZStd::vector<int> inclusive(NumValues);
+        AZStd::vector<int> exclusive(NumValues);
+        int sum = 0;
+        for (int i = 0; i < NumValues; ++i)
+        {
+            exclusive[i] = sum + 5;
+            sum += m_values[i];
+            inclusive[i] = sum;
+        }
+
+        AZStd::vector<int> results(NumValues);
+        parallel_inclusive_scan(m_values.begin(), m_values.end(), results.begin());
+        EXPECT_EQ(inclusive, results);
+
+        parallel_exclusive_scan(m_values.begin(), m_values.end(), results.begin(), 5, AZStd::plus<>(), 17);
+        EXPECT_EQ(exclusive, results);
+
+        // In place
+        results = m_values;
+        parallel_inclusive_scan(results.begin(), results.end(), results.begin(), AZStd::plus<>(), 3);
+        EXPECT_EQ(inclusive, results);
+
+        results = m_values;
+        parallel_exclusive_scan(results.begin(), results.end(), results.begin(), 5);
+        EXPECT_EQ(exclusive, results);
+    }
+
+    TEST_F(JobParallelAlgorithmsTest, ParallelSort_MatchesSerial)
+    {
+        for (int numValues : { 0, 1, 100, 4096, 5000, NumValues })
+        {
+            AZStd::vector<int> expected(m_values.begin(), m_values.begin() + numValues);
+            AZStd::vector<int> results = expected;
+            AZStd::sort(expected.begin(), expected.end());
+            parallel_sort(results.begin(), results.end());
+            EXPECT_EQ(expected, results);
+
+            results.assign(m_values.begin(), m_values.begin() + numValues);
+            AZStd::sort(expected.begin(), expected.end(), AZStd::greater<int>());
+            parallel_sort(results.begin(), results.end(), AZStd::greater<int>());
+            EXPECT_EQ(expected, results);
+        }
+    }
+
+    TEST_F(JobParallelAlgorithmsTest, ParallelSort_SortedAndDuplicateInput_Succeeds)
+    {
+        AZStd::vector<int> sorted(NumValues);
+        for (int i = 0; i < NumValues; ++i)
+        {
+            sorted[i] = i;
+        }
+        AZStd::vector<int> results = sorted;
+        parallel_sort(results.begin(), results.end());
+        EXPECT_EQ(sorted, results);
+
+        AZStd::vector<int> duplicates(NumValues, 7);
+        results = duplicates;
+        parallel_sort(results.begin(), results.end());
+        EXPECT_EQ(duplicates, results);
+    }
+
+    TEST_F(JobParallelAlgorithmsTest, ParallelSort_Strings_MatchesSerial)
+    {
+        AZStd::vector<AZStd::string> expected;
+        for (int value : m_values)
+        {
+            expected.push_back(AZStd::string::format("%d", value));
+        }
+        AZStd::vector<AZStd::string> results = expected;
+        AZStd::sort(expected.begin(), expected.end());
+        parallel_sort(results.begin(), results.end());
+        EXPECT_EQ(expected, results);
+    }
+
     class PERF_JobParallelForOverheadTest
         : public DefaultJobManagerSetupFixture
     {
@@ -2012,6 +2181,148 @@ namespace Benchmark
             RunMultipleCalculatePiJobsWithRandomDepthAndRandomPriority(LARGE_NUMBER_OF_JOBS);
         }
     }
+    class ParallelAlgorithmsBenchmarkFixture : public ::benchmark::Fixture
+    {
+    public:
+        void SetUp(::benchmark::State& state) override
+        {
+            AllocatorInstance<PoolAllocator>::Create();
+            AllocatorInstance<ThreadPoolAllocator>::Create();
+
+            JobManagerDesc desc;
+            JobManagerThreadDesc threadDesc;
+            const AZ::u32 numWorkerThreads = AZStd::thread::hardware_concurrency();
+            for (AZ::u32 i = 0; i < numWorkerThreads; ++i)
+            {
+                desc.m_workerThreads.push_back(threadDesc);
+            }
+
+            m_jobManager = aznew JobManager(desc);
+            m_jobContext = aznew JobContext(*m_jobManager);
+
+            JobContext::SetGlobalContext(m_jobContext);
+
+            std::mt19937 randomGenerator(1); // Always use the same seed
+            m_values.resize(state.range(0));
+            for (AZ::u32& value : m_values)
+            {
+                value = static_cast<AZ::u32>(randomGenerator());
+            }
+            m_results.resize(m_values.size());
+        }
+
+        void TearDown([[maybe_unused]] ::benchmark::State& state) override
+        {
+            JobContext::SetGlobalContext(nullptr);
+
+            m_values = {};
+            m_results = {};
+            delete m_jobContext;
+            delete m_jobManager;
+
+            AllocatorInstance<ThreadPoolAllocator>::Destroy();
+            AllocatorInstance<PoolAllocator>::Destroy();
+        }
+
+    protected:
+        static AZ::u32 Transform(AZ::u32 value)
+        {
+            return (value * 2654435761u) ^ (value >> 7);
+        }
+
+        JobManager* m_jobManager = nullptr;
+        JobContext* m_jobContext = nullptr;
+        AZStd::vector<AZ::u32> m_values;
+        AZStd::vector<AZ::u32> m_results;
+    };
+
+    BENCHMARK_DEFINE_F(ParallelAlgorithmsBenchmarkFixture, Sort_Serial)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            m_results = m_values;
+            AZStd::sort(m_results.begin(), m_results.end());
+            benchmark::DoNotOptimize(m_results.data());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(ParallelAlgorithmsBenchmarkFixture, Sort_Serial)->RangeMultiplier(16)->Range(1 << 12, 1 << 20)->UseRealTime();
+
+    BENCHMARK_DEFINE_F(ParallelAlgorithmsBenchmarkFixture, Sort_Parallel)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            m_results = m_values;
+            parallel_sort(m_results.begin(), m_results.end());
+            benchmark::DoNotOptimize(m_results.data());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(ParallelAlgorithmsBenchmarkFixture, Sort_Parallel)->RangeMultiplier(16)->Range(1 << 12, 1 << 20)->UseRealTime();
+
+    BENCHMARK_DEFINE_F(ParallelAlgorithmsBenchmarkFixture, Reduce_Serial)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(AZStd::accumulate(m_values.begin(), m_values.end(), AZ::u64(0)));
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(ParallelAlgorithmsBenchmarkFixture, Reduce_Serial)->RangeMultiplier(16)->Range(1 << 12, 1 << 20)->UseRealTime();
+
+    BENCHMARK_DEFINE_F(ParallelAlgorithmsBenchmarkFixture, Reduce_Parallel)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(parallel_reduce(m_values.begin(), m_values.end(), AZ::u64(0)));
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(ParallelAlgorithmsBenchmarkFixture, Reduce_Parallel)->RangeMultiplier(16)->Range(1 << 12, 1 << 20)->UseRealTime();
+
+    BENCHMARK_DEFINE_F(ParallelAlgorithmsBenchmarkFixture, Transform_Serial)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            AZStd::transform(m_values.begin(), m_values.end(), m_results.begin(), &Transform);
+            benchmark::DoNotOptimize(m_results.data());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(ParallelAlgorithmsBenchmarkFixture, Transform_Serial)->RangeMultiplier(16)->Range(1 << 12, 1 << 20)->UseRealTime();
+
+    BENCHMARK_DEFINE_F(ParallelAlgorithmsBenchmarkFixture, Transform_Parallel)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            parallel_transform(m_values.begin(), m_values.end(), m_results.begin(), &Transform);
+            benchmark::DoNotOptimize(m_results.data());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(ParallelAlgorithmsBenchmarkFixture, Transform_Parallel)->RangeMultiplier(16)->Range(1 << 12, 1 << 20)->UseRealTime();
+
+    BENCHMARK_DEFINE_F(ParallelAlgorithmsBenchmarkFixture, InclusiveScan_Serial)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            std::partial_sum(m_values.begin(), m_values.end(), m_results.begin());
+            benchmark::DoNotOptimize(m_results.data());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(ParallelAlgorithmsBenchmarkFixture, InclusiveScan_Serial)->RangeMultiplier(16)->Range(1 << 12, 1 << 20)->UseRealTime();
+
+    BENCHMARK_DEFINE_F(ParallelAlgorithmsBenchmarkFixture, InclusiveScan_Parallel)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            parallel_inclusive_scan(m_values.begin(), m_values.end(), m_results.begin());
+            benchmark::DoNotOptimize(m_results.data());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(ParallelAlgorithmsBenchmarkFixture, InclusiveScan_Parallel)->RangeMultiplier(16)->Range(1 << 12, 1 << 20)->UseRealTime();
 } // Benchmark
 
 #endif // HAVE_BENCHMARK
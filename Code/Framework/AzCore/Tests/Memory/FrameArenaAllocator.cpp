@@ -0,0 +1,344 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Memory/AllocatorManager.h>
+#include <AzCore/Memory/FrameArenaAllocator.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/thread.h>
+
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+#endif // HAVE_BENCHMARK
+
+namespace UnitTest
+{
+    class FrameArenaAllocatorTestFixture
+        : public AllocatorsTestFixture
+    {
+    public:
+        static constexpr size_t ChunkSize = 4 * 1024;
+
+        void SetUp() override
+        {
+            AllocatorsTestFixture::SetUp();
+
+            AZ::FrameArenaAllocator::Descriptor desc;
+            desc.m_chunkSize = ChunkSize;
+            desc.m_poisonMemory = true;
+            AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Create(desc);
+        }
+
+        void TearDown() override
+        {
+            AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Destroy();
+
+            AllocatorsTestFixture::TearDown();
+        }
+
+        AZ::FrameArenaAllocator& GetFrameAllocator()
+        {
+            return static_cast<AZ::FrameArenaAllocator&>(AZ::AllocatorInstance<AZ::FrameArenaAllocator>::GetAllocator());
+        }
+    };
+
+    TEST_F(FrameArenaAllocatorTestFixture, Allocate_RespectsAlignment)
+    {
+        AZ::FrameArenaAllocator& allocator = GetFrameAllocator();
+        for (size_t alignment = 1; alignment <= 256; alignment *= 2)
+        {
+            void* address = allocator.Allocate(3, alignment);
+            ASSERT_NE(nullptr, address);
+            EXPECT_EQ(0, reinterpret_cast<size_t>(address) & (alignment - 1));
+        }
+    }
+
+    TEST_F(FrameArenaAllocatorTestFixture, Allocate_LargerThanChunk_Succeeds)
+    {
+        AZ::FrameArenaAllocator& allocator = GetFrameAllocator();
+        const size_t byteSize = ChunkSize * 3;
+        char* address = reinterpret_cast<char*>(allocator.Allocate(byteSize, 16));
+        ASSERT_NE(nullptr, address);
+        memset(address, 1, byteSize);
+        EXPECT_EQ(byteSize, allocator.NumAllocatedBytes());
+        EXPECT_GE(allocator.Capacity(), byteSize);
+    }
+
+    TEST_F(FrameArenaAllocatorTestFixture, ResetFrame_ReclaimsAndPoisonsMemory)
+    {
+        AZ::FrameArenaAllocator& allocator = GetFrameAllocator();
+        char* first = reinterpret_cast<char*>(allocator.Allocate(64, 8));
+        memset(first, 0, 64);
+        allocator.Allocate(64, 8);
+        EXPECT_EQ(128, allocator.NumAllocatedBytes());
+
+        const AZ::u64 frameIndex = allocator.GetFrameIndex();
+        allocator.ResetFrame();
+        EXPECT_EQ(frameIndex + 1, allocator.GetFrameIndex());
+        EXPECT_EQ(0, allocator.NumAllocatedBytes());
+
+        // The arena is poisoned and rewound on the first allocation of the new frame.
+        char* second = reinterpret_cast<char*>(allocator.Allocate(8, 8));
+        EXPECT_EQ(first, second);
+        EXPECT_EQ(AZ::FrameArenaAllocator::PoisonPattern, static_cast<unsigned char>(first[0]));
+        EXPECT_EQ(AZ::FrameArenaAllocator::PoisonPattern, static_cast<unsigned char>(first[32]));
+        EXPECT_EQ(AZ::FrameArenaAllocator::PoisonPattern, static_cast<unsigned char>(first[127]));
+        EXPECT_EQ(8, allocator.NumAllocatedBytes());
+    }
+
+    TEST_F(FrameArenaAllocatorTestFixture, ResetFrame_OtherThreadsPoisonTheirOwnArenas)
+    {
+        AZ::FrameArenaAllocator& allocator = GetFrameAllocator();
+        unsigned char* address = nullptr;
+        AZStd::atomic_bool allocated{ false };
+        AZStd::atomic_bool reset{ false };
+        AZStd::atomic_bool rewound{ false };
+        AZStd::thread thread([&allocator, &address, &allocated, &reset, &rewound]()
+        {
+            address = reinterpret_cast<unsigned char*>(allocator.Allocate(32, 8));
+            memset(address, 0, 32);
+            allocated = true;
+            while (!reset)
+            {
+                AZStd::this_thread::yield();
+            }
+            // The first allocation after the reset poisons and rewinds this thread's arena.
+            allocator.Allocate(8, 8);
+            rewound = true;
+        });
+        while (!allocated)
+        {
+            AZStd::this_thread::yield();
+        }
+
+        // The resetting thread doesn't touch the arena of a thread that is still alive.
+        allocator.ResetFrame();
+        EXPECT_EQ(0, address[0]);
+        EXPECT_EQ(0, address[31]);
+
+        reset = true;
+        while (!rewound)
+        {
+            AZStd::this_thread::yield();
+        }
+        EXPECT_EQ(AZ::FrameArenaAllocator::PoisonPattern, address[8]);
+        EXPECT_EQ(AZ::FrameArenaAllocator::PoisonPattern, address[31]);
+        thread.join();
+    }
+
+    TEST_F(FrameArenaAllocatorTestFixture, ThreadExit_ReleasesArenasOfEveryAllocator)
+    {
+        AZ::FrameArenaAllocator& allocator = GetFrameAllocator();
+        AZ::FrameArenaAllocator::Descriptor desc;
+        desc.m_chunkSize = ChunkSize;
+        AZ::FrameArenaAllocator secondAllocator;
+        secondAllocator.Create(desc);
+
+        AZStd::thread thread([&allocator, &secondAllocator]()
+        {
+            memset(allocator.Allocate(64, 8), 1, 64);
+            memset(secondAllocator.Allocate(64, 8), 2, 64);
+        });
+        thread.join();
+
+        // Memory of an exited thread stays valid until the end of the frame.
+        EXPECT_EQ(64, allocator.NumAllocatedBytes());
+        EXPECT_EQ(64, secondAllocator.NumAllocatedBytes());
+
+        allocator.ResetFrame();
+        secondAllocator.ResetFrame();
+        EXPECT_EQ(0, allocator.Capacity());
+        EXPECT_EQ(0, secondAllocator.Capacity());
+
+        // A thread without memory in the current frame frees its arena right away.
+        AZStd::thread exitingThread([&allocator]()
+        {
+            allocator.Allocate(64, 8);
+            allocator.ResetFrame();
+        });
+        exitingThread.join();
+        EXPECT_EQ(0, allocator.Capacity());
+
+        secondAllocator.Destroy();
+    }
+
+    TEST_F(FrameArenaAllocatorTestFixture, ResetFrame_ReleasesChunksUnusedInLastFrame)
+    {
+        AZ::FrameArenaAllocator& allocator = GetFrameAllocator();
+        for (int i = 0; i < 8; ++i)
+        {
+            allocator.Allocate(ChunkSize / 2, 8);
+        }
+        const size_t peakCapacity = allocator.Capacity();
+
+        // Keeps the chunks around for a frame that needs as much memory.
+        allocator.ResetFrame();
+        for (int i = 0; i < 8; ++i)
+        {
+            allocator.Allocate(ChunkSize / 2, 8);
+        }
+        EXPECT_EQ(peakCapacity, allocator.Capacity());
+
+        // Frees chunks that were not used by a small frame.
+        allocator.ResetFrame();
+        allocator.Allocate(16, 8);
+        allocator.ResetFrame();
+        allocator.Allocate(16, 8);
+        EXPECT_EQ(ChunkSize, allocator.Capacity());
+    }
+
+    TEST_F(FrameArenaAllocatorTestFixture, DeAllocateAndResize_LastAllocation_ReusesMemory)
+    {
+        AZ::FrameArenaAllocator& allocator = GetFrameAllocator();
+        void* first = allocator.Allocate(32, 8);
+        void* second = allocator.Allocate(32, 8);
+
+        EXPECT_EQ(0, allocator.Resize(first, 64));
+        EXPECT_EQ(64, allocator.Resize(second, 64));
+        EXPECT_EQ(96, allocator.NumAllocatedBytes());
+
+        allocator.DeAllocate(second);
+        EXPECT_EQ(32, allocator.NumAllocatedBytes());
+        EXPECT_EQ(second, allocator.Allocate(32, 8));
+
+        // Anything but the last allocation is only reclaimed by ResetFrame.
+        allocator.DeAllocate(first);
+        EXPECT_EQ(64, allocator.NumAllocatedBytes());
+    }
+
+    TEST_F(FrameArenaAllocatorTestFixture, StdAllocator_WorksWithContainers)
+    {
+        AZStd::vector<int, AZ::FrameArenaStdAllocator> values;
+        AZStd::unordered_map<int, int, AZStd::hash<int>, AZStd::equal_to<int>, AZ::FrameArenaStdAllocator> map;
+        for (int i = 0; i < 1000; ++i)
+        {
+            values.push_back(i);
+            map[i] = i * 2;
+        }
+        for (int i = 0; i < 1000; ++i)
+        {
+            EXPECT_EQ(i, values[i]);
+            EXPECT_EQ(i * 2, map[i]);
+        }
+        EXPECT_GT(GetFrameAllocator().NumAllocatedBytes(), 1000 * sizeof(int));
+    }
+
+    TEST_F(FrameArenaAllocatorTestFixture, MultipleThreads_AllocateFromOwnArenas)
+    {
+        constexpr size_t numThreads = 8;
+        constexpr size_t numAllocations = 1000;
+        constexpr size_t allocationSize = 48;
+
+        AZ::FrameArenaAllocator& allocator = GetFrameAllocator();
+        AZStd::vector<AZStd::thread> threads;
+        for (size_t threadIndex = 0; threadIndex < numThreads; ++threadIndex)
+        {
+            threads.emplace_back([&allocator, threadIndex]()
+            {
+                AZStd::vector<unsigned char*> allocations;
+                for (size_t i = 0; i < numAllocations; ++i)
+                {
+                    unsigned char* address = reinterpret_cast<unsigned char*>(allocator.Allocate(allocationSize, 16));
+                    memset(address, static_cast<int>(threadIndex), allocationSize);
+                    allocations.push_back(address);
+                }
+                for (unsigned char* address : allocations)
+                {
+                    EXPECT_EQ(threadIndex, address[0]);
+                    EXPECT_EQ(threadIndex, address[allocationSize - 1]);
+                }
+            });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        EXPECT_EQ(numThreads * numAllocations * allocationSize, allocator.NumAllocatedBytes());
+        allocator.ResetFrame();
+        EXPECT_EQ(0, allocator.NumAllocatedBytes());
+    }
+
+    TEST_F(FrameArenaAllocatorTestFixture, AllocatorManager_ReportsFrameArenaStats)
+    {
+        GetFrameAllocator().Allocate(100, 4);
+
+        size_t usedBytes = 0;
+        size_t reservedBytes = 0;
+        AZStd::vector<AZ::AllocatorManager::AllocatorStats> stats;
+        AZ::AllocatorManager::Instance().GetAllocatorStats(usedBytes, reservedBytes, &stats);
+
+        auto frameArenaStats = AZStd::find_if(stats.begin(), stats.end(), [](const AZ::AllocatorManager::AllocatorStats& allocatorStats)
+        {
+            return allocatorStats.m_name == "FrameArenaAllocator";
+        });
+        ASSERT_NE(stats.end(), frameArenaStats);
+        EXPECT_EQ(100, frameArenaStats->m_allocatedBytes);
+        EXPECT_EQ(ChunkSize, frameArenaStats->m_capacityBytes);
+    }
+}
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    class FrameArenaAllocatorBenchmarkFixture
+        : public ::benchmark::Fixture
+    {
+    public:
+        void SetUp(const ::benchmark::State& state) override
+        {
+            AZ_UNUSED(state);
+            AZ::FrameArenaAllocator::Descriptor desc;
+            desc.m_poisonMemory = false;
+            AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Create(desc);
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            AZ_UNUSED(state);
+            AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Destroy();
+        }
+
+        // Simulates a frame that builds a few transient containers, the frame allocator is reset every iteration.
+        template<class Allocator>
+        static void BM_TransientContainers(benchmark::State& state)
+        {
+            const size_t numElements = static_cast<size_t>(state.range(0));
+            for (auto _ : state)
+            {
+                for (size_t container = 0; container < 16; ++container)
+                {
+                    AZStd::vector<AZ::u64, Allocator> values;
+                    for (size_t i = 0; i < numElements; ++i)
+                    {
+                        values.push_back(i);
+                    }
+                    benchmark::DoNotOptimize(values.data());
+                }
+
+                static_cast<AZ::FrameArenaAllocator&>(AZ::AllocatorInstance<AZ::FrameArenaAllocator>::GetAllocator()).ResetFrame();
+            }
+            state.SetItemsProcessed(state.iterations() * 16 * numElements);
+        }
+    };
+
+    BENCHMARK_DEFINE_F(FrameArenaAllocatorBenchmarkFixture, TransientContainers_SystemAllocator)(benchmark::State& state)
+    {
+        BM_TransientContainers<AZStd::allocator>(state);
+    }
+    BENCHMARK_REGISTER_F(FrameArenaAllocatorBenchmarkFixture, TransientContainers_SystemAllocator)->Range(8, 4096);
+
+    BENCHMARK_DEFINE_F(FrameArenaAllocatorBenchmarkFixture, TransientContainers_FrameArenaAllocator)(benchmark::State& state)
+    {
+        BM_TransientContainers<AZ::FrameArenaStdAllocator>(state);
+    }
+    BENCHMARK_REGISTER_F(FrameArenaAllocatorBenchmarkFixture, TransientContainers_FrameArenaAllocator)->Range(8, 4096);
+}
+#endif // HAVE_BENCHMARK
@@ -8,7 +8,9 @@
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/PlatformIncl.h>
 #include <AzCore/Memory/HphaSchema.h>
+#include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/thread.h>
 
 #if defined(HAVE_BENCHMARK)
 #include <benchmark/benchmark.h>
@@ -28,6 +30,27 @@ public:
     {}
 };
 
+class HphaSchema_ThreadCacheTestAllocator
+    : public AZ::SimpleSchemaAllocator<AZ::HphaSchema>
+{
+public:
+    AZ_TYPE_INFO(HphaSchema_ThreadCacheTestAllocator, "{5C6A0E1D-7B0C-4F5E-9C8B-2E7E5A1C3D94}");
+
+    using Base = AZ::SimpleSchemaAllocator<AZ::HphaSchema>;
+    using Descriptor = Base::Descriptor;
+
+    HphaSchema_ThreadCacheTestAllocator()
+        : Base("HphaSchema_ThreadCacheTestAllocator", "Allocator with per-thread caches for Test")
+    {}
+
+    static Descriptor CreateDescriptor()
+    {
+        Descriptor desc;
+        desc.m_threadCacheSize = AZ::SystemAllocator::Descriptor::Heap::m_defaultThreadCacheSize;
+        return desc;
+    }
+};
+
 static const size_t s_kiloByte = 1024;
 static const size_t s_megaByte = s_kiloByte * s_kiloByte;
 using AllocationSizeArray = AZStd::array<size_t, 10>;
@@ -111,6 +134,126 @@ namespace UnitTest
     INSTANTIATE_TEST_CASE_P(Mixed,
         HphaSchemaTestFixture,
         ::testing::ValuesIn(s_mixedInstancesParameters));
+
+    class HphaSchemaThreadCacheTestFixture
+        : public AllocatorsTestFixture
+    {
+    public:
+        void SetUp() override
+        {
+            AZ::AllocatorInstance<HphaSchema_ThreadCacheTestAllocator>::Create(HphaSchema_ThreadCacheTestAllocator::CreateDescriptor());
+        }
+
+        void TearDown() override
+        {
+            AZ::AllocatorInstance<HphaSchema_ThreadCacheTestAllocator>::Destroy();
+        }
+    };
+
+    TEST_F(HphaSchemaThreadCacheTestFixture, AllocateAndFreeOnManyThreads_AllMemoryIsReturned)
+    {
+        constexpr size_t numThreads = 8;
+        constexpr size_t numIterations = 100;
+        auto& allocator = AZ::AllocatorInstance<HphaSchema_ThreadCacheTestAllocator>::Get();
+
+        AZStd::vector<AZStd::thread, AZ::AZStdAlloc<AZ::OSAllocator>> threads;
+        for (size_t threadIndex = 0; threadIndex < numThreads; ++threadIndex)
+        {
+            threads.emplace_back([&allocator, threadIndex]()
+            {
+                AZStd::vector<void*, AZ::AZStdAlloc<AZ::OSAllocator>> allocations;
+                allocations.reserve(s_smallAllocationSizes.size() * 10);
+                for (size_t iteration = 0; iteration < numIterations; ++iteration)
+                {
+                    for (size_t i = 0; i < allocations.capacity(); ++i)
+                    {
+                        const size_t allocationSize = s_smallAllocationSizes[i % s_smallAllocationSizes.size()];
+                        void* allocation = allocator.Allocate(allocationSize, 0);
+                        EXPECT_NE(nullptr, allocation);
+                        memset(allocation, static_cast<int>(threadIndex), allocationSize);
+                        allocations.push_back(allocation);
+                    }
+                    for (size_t i = 0; i < allocations.size(); ++i)
+                    {
+                        const size_t allocationSize = s_smallAllocationSizes[i % s_smallAllocationSizes.size()];
+                        EXPECT_EQ(static_cast<char>(threadIndex), *reinterpret_cast<char*>(allocations[i]));
+                        // Mix frees with and without size information, both need to go through the cache.
+                        allocator.DeAllocate(allocations[i], (i & 1) ? allocationSize : 0);
+                    }
+                    allocations.clear();
+                }
+            });
+        }
+
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        // Exiting threads return their cached blocks, so nothing should be reported as allocated anymore.
+        EXPECT_EQ(0, allocator.NumAllocatedBytes());
+    }
+
+    TEST_F(HphaSchemaThreadCacheTestFixture, FreeOnDifferentThread_MemoryIsReturned)
+    {
+        auto& allocator = AZ::AllocatorInstance<HphaSchema_ThreadCacheTestAllocator>::Get();
+
+        void* allocation = allocator.Allocate(64, 0);
+        ASSERT_NE(nullptr, allocation);
+        EXPECT_EQ(64, allocator.NumAllocatedBytes());
+
+        AZStd::thread freeThread([&allocator, allocation]()
+        {
+            allocator.DeAllocate(allocation, 64);
+        });
+        freeThread.join();
+
+        // The block was cached by the freeing thread, which returned it to the shared bucket when it exited.
+        EXPECT_EQ(0, allocator.NumAllocatedBytes());
+
+        void* newAllocation = allocator.Allocate(64, 0);
+        EXPECT_NE(nullptr, newAllocation);
+        allocator.DeAllocate(newAllocation, 64);
+    }
+
+    TEST_F(HphaSchemaThreadCacheTestFixture, DestroyWhileThreadsWithCachesExit_DoesNotCrash)
+    {
+        constexpr size_t numThreads = 8;
+        auto& allocator = AZ::AllocatorInstance<HphaSchema_ThreadCacheTestAllocator>::Get();
+
+        AZStd::atomic<size_t> numCachesFilled{ 0 };
+        AZStd::atomic_bool exitThreads{ false };
+        AZStd::vector<AZStd::thread, AZ::AZStdAlloc<AZ::OSAllocator>> threads;
+        for (size_t threadIndex = 0; threadIndex < numThreads; ++threadIndex)
+        {
+            threads.emplace_back([&allocator, &numCachesFilled, &exitThreads]()
+            {
+                // Leave blocks in this thread's cache, then exit at the same time the allocator is destroyed.
+                for (size_t allocationSize : s_smallAllocationSizes)
+                {
+                    allocator.DeAllocate(allocator.Allocate(allocationSize, 0), allocationSize);
+                }
+                ++numCachesFilled;
+                while (!exitThreads)
+                {
+                    AZStd::this_thread::yield();
+                }
+            });
+        }
+
+        while (numCachesFilled < numThreads)
+        {
+            AZStd::this_thread::yield();
+        }
+        exitThreads = true;
+        AZ::AllocatorInstance<HphaSchema_ThreadCacheTestAllocator>::Destroy();
+
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+        AZ::AllocatorInstance<HphaSchema_ThreadCacheTestAllocator>::Create(HphaSchema_ThreadCacheTestAllocator::CreateDescriptor());
+    }
 }
 
 
@@ -178,6 +321,51 @@ namespace Benchmark
         BM_Allocations(state, s_mixedAllocationSizes);
     }
 
+    // Measures allocation throughput when several threads allocate and free small blocks at the same time, with and
+    // without per-thread caches. The allocator is created by the first thread; all threads are synchronized before
+    // and after the timed loop so the other threads only use it inside the loop.
+    template<class TestAllocator>
+    static void BM_MultithreadedSmallAllocations(benchmark::State& state, const typename TestAllocator::Descriptor& desc)
+    {
+        if (state.thread_index == 0)
+        {
+            AZ::AllocatorInstance<TestAllocator>::Create(desc);
+        }
+
+        constexpr size_t batchSize = 64;
+        void* allocations[batchSize];
+        for ([[maybe_unused]] auto _ : state)
+        {
+            auto& allocator = AZ::AllocatorInstance<TestAllocator>::Get();
+            for (size_t i = 0; i < batchSize; ++i)
+            {
+                allocations[i] = allocator.Allocate(s_smallAllocationSizes[i % s_smallAllocationSizes.size()], 0);
+            }
+            for (size_t i = 0; i < batchSize; ++i)
+            {
+                allocator.DeAllocate(allocations[i], s_smallAllocationSizes[i % s_smallAllocationSizes.size()]);
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * batchSize);
+
+        if (state.thread_index == 0)
+        {
+            AZ::AllocatorInstance<TestAllocator>::Destroy();
+        }
+    }
+
+    static void BM_HphaSchema_MultithreadedSmallAllocations(benchmark::State& state)
+    {
+        BM_MultithreadedSmallAllocations<HphaSchema_TestAllocator>(state, HphaSchema_TestAllocator::Descriptor());
+    }
+    BENCHMARK(BM_HphaSchema_MultithreadedSmallAllocations)->ThreadRange(1, 32)->UseRealTime();
+
+    static void BM_HphaSchema_MultithreadedSmallAllocationsThreadCache(benchmark::State& state)
+    {
+        BM_MultithreadedSmallAllocations<HphaSchema_ThreadCacheTestAllocator>(state, HphaSchema_ThreadCacheTestAllocator::CreateDescriptor());
+    }
+    BENCHMARK(BM_HphaSchema_MultithreadedSmallAllocationsThreadCache)->ThreadRange(1, 32)->UseRealTime();
+
 
 } // Benchmark
 #endif // HAVE_BENCHMARK
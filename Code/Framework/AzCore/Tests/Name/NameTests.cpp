@@ -48,14 +48,25 @@ namespace UnitTest
             AZ::NameDictionary::Destroy();
         }
 
-        static const AZStd::unordered_map<AZ::Name::Hash, AZ::Internal::NameData*>& GetDictionary()
+        //! Returns a copy of the entries from all the dictionary shards.
+        static AZStd::unordered_map<AZ::Name::Hash, AZ::Internal::NameData*> GetDictionary()
         {
-            return AZ::NameDictionary::Instance().m_dictionary;
+            AZStd::unordered_map<AZ::Name::Hash, AZ::Internal::NameData*> dictionary;
+            for (const auto& shard : AZ::NameDictionary::Instance().m_shards)
+            {
+                dictionary.insert(shard.m_dictionary.begin(), shard.m_dictionary.end());
+            }
+            return dictionary;
         }
         
         static size_t GetEntryCount()
         {
-            return GetDictionary().size();
+            return AZ::NameDictionary::Instance().GetEntryCount();
+        }
+
+        static size_t GetShardIndex(AZ::Name::Hash hash)
+        {
+            return AZ::NameDictionary::GetShardIndex(hash);
         }
 
         //! Directly calculate the hash value for a string without collision resolution
@@ -278,9 +289,9 @@ namespace UnitTest
         EXPECT_EQ(NameDictionaryTester::GetEntryCount(), localDictionary.size());
 
         // Make sure all entries in the localDictionary got copied into the globalDictionary
+        const auto globalDictionary = NameDictionaryTester::GetDictionary();
         for (const AZStd::string& nameString : localDictionary)
         {
-            auto& globalDictionary = NameDictionaryTester::GetDictionary();
             auto it = AZStd::find_if(globalDictionary.begin(), globalDictionary.end(), [&nameString](AZStd::pair<AZ::Name::Hash, AZ::Internal::NameData*> entry) {
                 return entry.second->GetName() == nameString;
             });
@@ -448,6 +459,61 @@ namespace UnitTest
         EXPECT_TRUE(b != AZ::Name{});
     }
 
+    TEST_F(NameTest, NameLiteral_HashIsCalculatedAtCompileTime)
+    {
+        static constexpr AZ::NameLiteral literal{ "CompileTimeName" };
+        static_assert(literal.GetHash() == AZ::Internal::NameData::CalcHash("CompileTimeName"));
+
+        EXPECT_EQ(NameDictionaryTester::CalcDirectHashValue("CompileTimeName"), literal.GetHash());
+    }
+
+    TEST_F(NameTest, NameLiteral_ConstructName_MatchesNameFromString)
+    {
+        AZ::Name fromString{ "literal" };
+        AZ::Name fromLiteral = AZ_NAME_LITERAL("literal");
+        EXPECT_EQ(fromString, fromLiteral);
+        EXPECT_EQ(fromString.GetStringView(), fromLiteral.GetStringView());
+        EXPECT_EQ(NameDictionaryTester::GetEntryCount(), 1);
+
+        AZ::Name emptyLiteral = AZ_NAME_LITERAL("");
+        EXPECT_TRUE(emptyLiteral.IsEmpty());
+        EXPECT_EQ(NameDictionaryTester::GetEntryCount(), 1);
+    }
+
+    TEST_F(NameTest, NameLiteral_ManyNames_ResolveToSameNameAsString)
+    {
+        AZStd::vector<AZ::Name> names;
+        for (int i = 0; i < 1000; ++i)
+        {
+            names.emplace_back(AZStd::string::format("name%d", i));
+        }
+        for (const AZ::Name& name : names)
+        {
+            AZ::NameLiteral literal{ name.GetStringView() };
+            AZ::Name fromLiteral{ literal };
+            EXPECT_EQ(name, fromLiteral);
+        }
+    }
+
+    TEST_F(NameTest, Shards_ManyNames_AreDistributedAcrossShards)
+    {
+        constexpr size_t NameCount = 1000;
+        AZStd::vector<AZ::Name> names;
+        names.reserve(NameCount);
+        AZStd::unordered_set<size_t> usedShards;
+        for (size_t i = 0; i < NameCount; ++i)
+        {
+            names.emplace_back(AZStd::string::format("ShardedName%zu", i));
+            usedShards.insert(NameDictionaryTester::GetShardIndex(names.back().GetHash()));
+        }
+
+        EXPECT_EQ(NameDictionaryTester::GetEntryCount(), NameCount);
+        EXPECT_GT(usedShards.size(), 1);
+
+        names.clear();
+        EXPECT_EQ(NameDictionaryTester::GetEntryCount(), 0);
+    }
+
     TEST_F(NameTest, CollisionResolutionsArePersistent)
     {
         // When hash calculations collide, the resolved hash value is order-dependent and therefore is not guaranteed
@@ -850,3 +916,157 @@ namespace UnitTest
     }
 }
 
+
+#if defined(HAVE_BENCHMARK)
+//-------------------------------------------------------------------------
+// PERF TESTS
+//-------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    //! Sets up the allocator and NameDictionary for the multi-threaded name benchmarks. This is owned by the first
+    //! benchmark thread; google benchmark synchronizes all threads before and after the timed loop, so the other
+    //! threads may only access it from inside the loop.
+    class NameDictionaryBenchmarkEnvironment
+    {
+    public:
+        static constexpr size_t MaxThreads = 64;
+        static constexpr size_t NamesPerThread = 64;
+
+        NameDictionaryBenchmarkEnvironment()
+        {
+            if (!AZ::AllocatorInstance<AZ::SystemAllocator>::IsReady())
+            {
+                AZ::AllocatorInstance<AZ::SystemAllocator>::Create();
+                m_ownsAllocator = true;
+            }
+            AZ::NameDictionary::Create();
+
+            m_nameStrings.reserve(MaxThreads * NamesPerThread);
+            for (size_t i = 0; i < MaxThreads * NamesPerThread; ++i)
+            {
+                m_nameStrings.push_back(AZStd::string::format("BenchmarkName_%zu", i));
+            }
+        }
+
+        ~NameDictionaryBenchmarkEnvironment()
+        {
+            m_existingNames = {};
+            m_nameStrings = {};
+            AZ::NameDictionary::Destroy();
+            if (m_ownsAllocator)
+            {
+                AZ::AllocatorInstance<AZ::SystemAllocator>::Destroy();
+            }
+        }
+
+        //! Adds all names to the dictionary so the benchmarks only exercise the lookup path.
+        void PopulateDictionary()
+        {
+            m_existingNames.reserve(m_nameStrings.size());
+            for (const AZStd::string& nameString : m_nameStrings)
+            {
+                m_existingNames.emplace_back(nameString);
+            }
+            m_existingNames.push_back(AZ_NAME_LITERAL("BenchmarkName_Literal"));
+        }
+
+        AZStd::string_view GetNameString(size_t threadIndex, size_t nameIndex) const
+        {
+            return m_nameStrings[(threadIndex % MaxThreads) * NamesPerThread + (nameIndex % NamesPerThread)];
+        }
+
+    private:
+        AZStd::vector<AZStd::string> m_nameStrings;
+        AZStd::vector<AZ::Name> m_existingNames;
+        bool m_ownsAllocator = false;
+    };
+
+    static AZStd::unique_ptr<NameDictionaryBenchmarkEnvironment> s_nameBenchmarkEnvironment;
+
+    static void SetUpNameBenchmark(const ::benchmark::State& state, bool populate)
+    {
+        if (state.thread_index == 0)
+        {
+            s_nameBenchmarkEnvironment = AZStd::make_unique<NameDictionaryBenchmarkEnvironment>();
+            if (populate)
+            {
+                s_nameBenchmarkEnvironment->PopulateDictionary();
+            }
+        }
+    }
+
+    static void TearDownNameBenchmark(const ::benchmark::State& state)
+    {
+        if (state.thread_index == 0)
+        {
+            s_nameBenchmarkEnvironment.reset();
+        }
+    }
+
+    // Every thread looks up names that already exist in the dictionary, spread over all shards.
+    static void BM_Name_CreateExisting(::benchmark::State& state)
+    {
+        SetUpNameBenchmark(state, true);
+
+        size_t nameIndex = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::Name name(s_nameBenchmarkEnvironment->GetNameString(state.thread_index, nameIndex++));
+            benchmark::DoNotOptimize(name.GetHash());
+        }
+
+        TearDownNameBenchmark(state);
+    }
+    BENCHMARK(BM_Name_CreateExisting)->ThreadRange(1, 16)->UseRealTime();
+
+    // Every thread looks up the same existing name, which is the worst case for contention as all threads use the same shard.
+    static void BM_Name_CreateExistingSameName(::benchmark::State& state)
+    {
+        SetUpNameBenchmark(state, true);
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::Name name(s_nameBenchmarkEnvironment->GetNameString(0, 0));
+            benchmark::DoNotOptimize(name.GetHash());
+        }
+
+        TearDownNameBenchmark(state);
+    }
+    BENCHMARK(BM_Name_CreateExistingSameName)->ThreadRange(1, 16)->UseRealTime();
+
+    // Same as BM_Name_CreateExistingSameName, but the hash is calculated at compile time.
+    static void BM_Name_CreateExistingLiteral(::benchmark::State& state)
+    {
+        SetUpNameBenchmark(state, true);
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::Name name = AZ_NAME_LITERAL("BenchmarkName_Literal");
+            benchmark::DoNotOptimize(name.GetHash());
+        }
+
+        TearDownNameBenchmark(state);
+    }
+    BENCHMARK(BM_Name_CreateExistingLiteral)->ThreadRange(1, 16)->UseRealTime();
+
+    // Every thread adds names to the dictionary and immediately releases them again, exercising the insert and erase path.
+    static void BM_Name_CreateAndRelease(::benchmark::State& state)
+    {
+        SetUpNameBenchmark(state, false);
+
+        size_t nameIndex = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::Name name(s_nameBenchmarkEnvironment->GetNameString(state.thread_index, nameIndex++));
+            benchmark::DoNotOptimize(name.GetHash());
+        }
+
+        TearDownNameBenchmark(state);
+    }
+    BENCHMARK(BM_Name_CreateAndRelease)->ThreadRange(1, 16)->UseRealTime();
+} // namespace Benchmark
+
+#endif // HAVE_BENCHMARK
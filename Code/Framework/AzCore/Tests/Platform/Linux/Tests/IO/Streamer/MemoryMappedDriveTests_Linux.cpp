@@ -0,0 +1,508 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/Streamer/MemoryMappedDrive_Linux.h>
+#include <AzCore/IO/Streamer/Scheduler.h>
+#include <AzCore/IO/Streamer/StorageDrive_Linux.h>
+#include <AzCore/IO/Streamer/Streamer.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/parallel/binary_semaphore.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/StringFunc/StringFunc.h>
+#include <AzCore/Utils/Utils.h>
+
+#include <Tests/FileIOBaseTestTypes.h>
+#include <Tests/Streamer/StreamStackEntryConformityTests.h>
+
+namespace AZ::IO
+{
+    constexpr AZ::u32 TestMaxMappedFiles = 2;
+
+    //
+    // StreamStackEntry API Conformity
+    //
+    class MemoryMappedDriveLinuxTestDescription :
+        public StreamStackEntryConformityTestsDescriptor<MemoryMappedDriveLinux>
+    {
+    public:
+        MemoryMappedDriveLinux CreateInstance() override
+        {
+            return MemoryMappedDriveLinux({ ".pak" }, TestMaxMappedFiles, MemoryMappedDriveLinux::EvictionPolicy::None, true);
+        }
+    };
+
+    INSTANTIATE_TYPED_TEST_CASE_P(
+        Streamer_MemoryMappedDriveLinuxConformityTests, StreamStackEntryConformityTests, MemoryMappedDriveLinuxTestDescription);
+
+    //
+    // MemoryMappedDriveLinux Tests
+    //
+
+    class Streamer_MemoryMappedDriveLinuxTestFixture
+        : public UnitTest::ScopedAllocatorSetupFixture
+        , public UnitTest::SetRestoreFileIOBaseRAII
+    {
+    public:
+        static constexpr char s_fileCharacter = 'F';
+        static constexpr char s_beginCharacter = 'B';
+        static constexpr char s_endCharacter = 'E';
+        static constexpr char s_chunkCharacter = 'C';
+
+        UnitTest::TestFileIOBase m_fileIO{};
+        AZStd::string m_testFolder;
+        AZStd::shared_ptr<MemoryMappedDriveLinux> m_drive{};
+        AZStd::shared_ptr<::testing::NiceMock<StreamStackEntryMock>> m_mock;
+        AZStd::unique_ptr<AZ::IO::StreamerContext> m_context;
+        AZStd::vector<AZStd::string> m_dummyFiles;
+
+        Streamer_MemoryMappedDriveLinuxTestFixture()
+            : UnitTest::SetRestoreFileIOBaseRAII(m_fileIO)
+        {
+            char exePath[AZ_MAX_PATH_LEN] = { 0 };
+            auto result = AZ::Utils::GetExecutablePath(exePath, AZ_MAX_PATH_LEN);
+            if (result.m_pathStored == AZ::Utils::ExecutablePathResult::Success)
+            {
+                AZStd::string filePath(exePath);
+                if (result.m_pathIncludesFilename)
+                {
+                    AZ::StringFunc::Path::StripFullName(filePath);
+                }
+                AZ::StringFunc::Path::Join(filePath.c_str(), "TestFiles", filePath);
+                if (AZ::IO::SystemFile::Exists(filePath.c_str()) || AZ::IO::SystemFile::CreateDir(filePath.c_str()))
+                {
+                    m_testFolder = AZStd::move(filePath);
+                }
+            }
+        }
+
+        void SetUp() override
+        {
+            ASSERT_FALSE(m_testFolder.empty());
+
+            m_context = AZStd::make_unique<AZ::IO::StreamerContext>();
+            CreateDrive(MemoryMappedDriveLinux::EvictionPolicy::None);
+        }
+
+        void TearDown() override
+        {
+            m_drive.reset();
+            m_mock.reset();
+            m_context.reset();
+
+            for (auto& dummyFile : m_dummyFiles)
+            {
+                AZ::IO::SystemFile::Delete(dummyFile.c_str());
+            }
+            m_dummyFiles.clear();
+            m_dummyFiles.shrink_to_fit();
+        }
+
+        void CreateDrive(MemoryMappedDriveLinux::EvictionPolicy evictionPolicy)
+        {
+            m_drive = AZStd::make_shared<MemoryMappedDriveLinux>(
+                AZStd::vector<AZStd::string>{ ".pak" }, TestMaxMappedFiles, evictionPolicy, true);
+            m_drive->SetContext(*m_context);
+
+            // Anything that's not served from a mapping ends up in the mock, which completes it as failed.
+            m_mock = AZStd::make_shared<::testing::NiceMock<StreamStackEntryMock>>();
+            ON_CALL(*m_mock, QueueRequest(::testing::_)).WillByDefault([this](FileRequest* request)
+                {
+                    request->SetStatus(IStreamerTypes::RequestStatus::Failed);
+                    m_context->MarkRequestAsCompleted(request);
+                });
+            m_drive->SetNext(m_mock);
+        }
+
+        // Create a file filled with a single character. If chunkOffset is non-zero, a marker is written every chunkOffset bytes.
+        // The first and last byte of the file are set to the begin and end markers.
+        RequestPath CreateDummyFile(const char* filename, size_t fileSize, size_t chunkOffset = 0)
+        {
+            AZStd::string path;
+            AZ::StringFunc::Path::Join(m_testFolder.c_str(), filename, path);
+
+            SystemFile file;
+            EXPECT_TRUE(file.Open(path.c_str(), SystemFile::OpenMode::SF_OPEN_CREATE | SystemFile::OpenMode::SF_OPEN_READ_WRITE));
+            m_dummyFiles.push_back(path);
+
+            AZStd::unique_ptr<char[]> buffer(new char[fileSize]);
+            ::memset(buffer.get(), s_fileCharacter, fileSize);
+            if (chunkOffset != 0)
+            {
+                for (size_t offset = 0; offset < fileSize; offset += chunkOffset)
+                {
+                    buffer[offset] = s_chunkCharacter;
+                }
+            }
+            buffer[0] = s_beginCharacter;
+            buffer[fileSize - 1] = s_endCharacter;
+
+            auto bytesWritten = file.Write(buffer.get(), fileSize);
+            file.Close();
+            EXPECT_EQ(bytesWritten, fileSize);
+
+            RequestPath requestPath;
+            requestPath.InitFromAbsolutePath(AZStd::move(path));
+            return requestPath;
+        }
+
+        FileRequest* QueueRead(const RequestPath& path, void* output, u64 offset, u64 size)
+        {
+            FileRequest* request = m_context->GetNewInternalRequest();
+            request->CreateRead(nullptr, output, size, path, offset, size);
+            m_drive->QueueRequest(request);
+            return request;
+        }
+
+        void WaitTillCompleted()
+        {
+            StreamStackEntry::Status status;
+            auto startTime = AZStd::chrono::system_clock::now();
+            do
+            {
+                m_drive->ExecuteRequests();
+                m_context->FinalizeCompletedRequests();
+
+                status.m_isIdle = true;
+                m_drive->UpdateStatus(status);
+
+                if (AZStd::chrono::system_clock::now() - startTime > AZStd::chrono::seconds(5))
+                {
+                    FAIL();
+                }
+            } while (!status.m_isIdle);
+        }
+    };
+
+    TEST_F(Streamer_MemoryMappedDriveLinuxTestFixture, ReadDataRequest_ChunkedReadsFromArchive_DataIsCorrectAndFileIsMappedOnce)
+    {
+        constexpr size_t chunkSize = 4_kib;
+        constexpr size_t numChunks = 17;
+        constexpr size_t fileSize = numChunks * chunkSize;
+        AZStd::array<AZStd::unique_ptr<u8[]>, numChunks> buffers;
+        RequestPath path = CreateDummyFile("Dummy.pak", fileSize, chunkSize);
+
+        EXPECT_CALL(*m_mock, QueueRequest(::testing::_)).Times(0);
+
+        size_t numCompleted = 0;
+        for (size_t i = 0; i < numChunks; ++i)
+        {
+            buffers[i].reset(new u8[chunkSize]);
+            FileRequest* request = QueueRead(path, buffers[i].get(), i * chunkSize, chunkSize);
+            request->SetCompletionCallback([&numCompleted](const FileRequest& request)
+                {
+                    EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, request.GetStatus());
+                    numCompleted++;
+                });
+        }
+
+        WaitTillCompleted();
+        EXPECT_EQ(numChunks, numCompleted);
+        EXPECT_EQ(1, m_drive->GetNumMappedFiles());
+
+        EXPECT_EQ(buffers[0][0], s_beginCharacter);
+        EXPECT_EQ(buffers[numChunks - 1][chunkSize - 1], s_endCharacter);
+        for (size_t i = 1; i < numChunks; ++i)
+        {
+            EXPECT_EQ(buffers[i][0], s_chunkCharacter);
+            EXPECT_EQ(buffers[i][1], s_fileCharacter);
+        }
+    }
+
+    TEST_F(Streamer_MemoryMappedDriveLinuxTestFixture, ReadDataRequest_AllEvictionPolicies_DataIsCorrect)
+    {
+        constexpr size_t fileSize = 64_kib;
+        // Use an unaligned offset and size so the reads cover partial pages on both ends.
+        constexpr size_t readOffset = 1_kib + 3;
+        constexpr size_t readSize = 32_kib;
+        RequestPath path = CreateDummyFile("Dummy.pak", fileSize, 1_kib);
+
+        for (auto policy : { MemoryMappedDriveLinux::EvictionPolicy::None, MemoryMappedDriveLinux::EvictionPolicy::Cold,
+            MemoryMappedDriveLinux::EvictionPolicy::PageOut, MemoryMappedDriveLinux::EvictionPolicy::DontNeed })
+        {
+            CreateDrive(policy);
+
+            // Read the same range twice so the second read has to reload any pages that were evicted by the first.
+            for (int i = 0; i < 2; ++i)
+            {
+                AZStd::unique_ptr<u8[]> buffer(new u8[readSize]);
+                FileRequest* request = QueueRead(path, buffer.get(), readOffset, readSize);
+                request->SetCompletionCallback([](const FileRequest& request)
+                    {
+                        EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, request.GetStatus());
+                    });
+                WaitTillCompleted();
+
+                EXPECT_EQ(buffer[0], s_fileCharacter);
+                EXPECT_EQ(buffer[1_kib - 3], s_chunkCharacter);
+                EXPECT_EQ(buffer[readSize - 3], s_chunkCharacter);
+            }
+        }
+    }
+
+    TEST_F(Streamer_MemoryMappedDriveLinuxTestFixture, ReadDataRequest_ReadPastEndOfFile_ReportsFailure)
+    {
+        constexpr size_t fileSize = 4_kib;
+        RequestPath path = CreateDummyFile("Dummy.pak", fileSize);
+
+        EXPECT_CALL(*m_mock, QueueRequest(::testing::_)).Times(0);
+
+        AZStd::unique_ptr<char[]> buffer(new char[fileSize * 2]);
+        FileRequest* request = QueueRead(path, buffer.get(), 0, fileSize * 2);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                EXPECT_EQ(IStreamerTypes::RequestStatus::Failed, request.GetStatus());
+            });
+
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        WaitTillCompleted();
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+    }
+
+    TEST_F(Streamer_MemoryMappedDriveLinuxTestFixture, ReadDataRequest_FileIsNotAnArchive_RequestIsForwarded)
+    {
+        constexpr size_t fileSize = 4_kib;
+        RequestPath path = CreateDummyFile("Dummy.bin", fileSize);
+
+        char buffer[64];
+        FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateRead(nullptr, buffer, sizeof(buffer), path, 0, sizeof(buffer));
+        EXPECT_CALL(*m_mock, QueueRequest(request)).Times(1);
+
+        m_drive->QueueRequest(request);
+        WaitTillCompleted();
+        EXPECT_EQ(0, m_drive->GetNumMappedFiles());
+    }
+
+    TEST_F(Streamer_MemoryMappedDriveLinuxTestFixture, ReadDataRequest_ArchiveDoesNotExist_RequestIsForwarded)
+    {
+        RequestPath path;
+        path.InitFromAbsolutePath(m_testFolder + "/Missing.pak");
+
+        char buffer[64];
+        FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateRead(nullptr, buffer, sizeof(buffer), path, 0, sizeof(buffer));
+        EXPECT_CALL(*m_mock, QueueRequest(request)).Times(1);
+
+        m_drive->QueueRequest(request);
+        WaitTillCompleted();
+        EXPECT_EQ(0, m_drive->GetNumMappedFiles());
+    }
+
+    TEST_F(Streamer_MemoryMappedDriveLinuxTestFixture, ReadDataRequest_MoreArchivesThanMaxMappedFiles_OldestMappingIsReleased)
+    {
+        constexpr size_t fileSize = 4_kib;
+        const char* names[] = { "Dummy0.pak", "Dummy1.pak", "Dummy2.pak" };
+        static_assert(AZ_ARRAY_SIZE(names) > TestMaxMappedFiles, "Test requires more archives than can be mapped at once.");
+
+        char buffer[64];
+        for (const char* name : names)
+        {
+            RequestPath path = CreateDummyFile(name, fileSize);
+            QueueRead(path, buffer, 0, sizeof(buffer));
+            WaitTillCompleted();
+            EXPECT_EQ(s_beginCharacter, buffer[0]);
+        }
+        EXPECT_EQ(TestMaxMappedFiles, m_drive->GetNumMappedFiles());
+
+        // The first archive is mapped again when it's read again.
+        RequestPath firstPath;
+        firstPath.InitFromAbsolutePath(m_dummyFiles[0]);
+        QueueRead(firstPath, buffer, fileSize - sizeof(buffer), sizeof(buffer));
+        WaitTillCompleted();
+        EXPECT_EQ(s_endCharacter, buffer[sizeof(buffer) - 1]);
+        EXPECT_EQ(TestMaxMappedFiles, m_drive->GetNumMappedFiles());
+
+        AZStd::vector<Statistic> statistics;
+        m_drive->CollectStatistics(statistics);
+        auto mappingsCreated = AZStd::find_if(statistics.begin(), statistics.end(),
+            [](const Statistic& statistic) { return statistic.GetName() == "Mappings created"; });
+        ASSERT_NE(statistics.end(), mappingsCreated);
+        EXPECT_EQ(AZ_ARRAY_SIZE(names) + 1, mappingsCreated->GetIntegerValue());
+    }
+
+    TEST_F(Streamer_MemoryMappedDriveLinuxTestFixture, FlushAll_ArchivesMapped_AllMappingsAreReleased)
+    {
+        RequestPath path = CreateDummyFile("Dummy.pak", 4_kib);
+        char buffer[64];
+        QueueRead(path, buffer, 0, sizeof(buffer));
+        WaitTillCompleted();
+        EXPECT_EQ(1, m_drive->GetNumMappedFiles());
+
+        FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateFlushAll();
+        m_drive->QueueRequest(request);
+        WaitTillCompleted();
+        EXPECT_EQ(0, m_drive->GetNumMappedFiles());
+    }
+
+    TEST_F(Streamer_MemoryMappedDriveLinuxTestFixture, FileMetaDataRetrievalRequest_ArchiveIsMapped_FileSizeReportedWithoutForwarding)
+    {
+        RequestPath path = CreateDummyFile("Dummy.pak", 12_kib);
+        char buffer[64];
+        QueueRead(path, buffer, 0, sizeof(buffer));
+        WaitTillCompleted();
+
+        EXPECT_CALL(*m_mock, QueueRequest(::testing::_)).Times(0);
+
+        FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateFileMetaDataRetrieval(path);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                auto& fileMetaData = AZStd::get<FileRequest::FileMetaDataRetrievalData>(request.GetCommand());
+                EXPECT_TRUE(fileMetaData.m_found);
+                EXPECT_EQ(12_kib, fileMetaData.m_fileSize);
+            });
+        m_drive->QueueRequest(request);
+        WaitTillCompleted();
+    }
+} // namespace AZ::IO
+
+#if defined(HAVE_BENCHMARK)
+
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    //! Compares reading an archive in chunks through StorageDriveLinux with reading it through a MemoryMappedDriveLinux that's
+    //! placed on top of the same drive.
+    class MemoryMappedDriveLinuxFixture : public benchmark::Fixture
+    {
+    public:
+        constexpr static const char* TestFileName = "StreamerBenchmark.pak";
+        constexpr static size_t FileSize = 64_mib;
+
+        void SetupStreamer(bool useMemoryMapping)
+        {
+            using namespace AZ::IO;
+
+            m_fileIO = new UnitTest::TestFileIOBase();
+            m_previousFileIO = AZ::IO::FileIOBase::GetInstance();
+            AZ::IO::FileIOBase::SetInstance(nullptr);
+            AZ::IO::FileIOBase::SetInstance(m_fileIO);
+
+            SystemFile file;
+            file.Open(TestFileName, SystemFile::OpenMode::SF_OPEN_CREATE | SystemFile::OpenMode::SF_OPEN_READ_WRITE);
+            AZStd::unique_ptr<char[]> buffer(new char[FileSize]);
+            ::memset(buffer.get(), 'c', FileSize);
+            file.Write(buffer.get(), FileSize);
+            file.Close();
+
+            AZStd::optional<AZ::IO::FixedMaxPathString> absolutePath = AZ::Utils::ConvertToAbsolutePath(TestFileName);
+            if (absolutePath.has_value())
+            {
+                m_absolutePath = *absolutePath;
+
+                StorageDriveLinux::ConstructionOptions options;
+                options.m_hasSeekPenalty = false;
+                options.m_minimalReporting = true;
+                AZStd::shared_ptr<StreamStackEntry> stackEntry = AZStd::make_shared<StorageDriveLinux>(
+                    AZStd::vector<AZStd::string_view>{ "/" }, 32, 32, 32, 8, 4, options);
+                if (useMemoryMapping)
+                {
+                    auto mappedDrive = AZStd::make_shared<MemoryMappedDriveLinux>(
+                        AZStd::vector<AZStd::string>{ ".pak" }, 16, MemoryMappedDriveLinux::EvictionPolicy::None, true);
+                    mappedDrive->SetNext(AZStd::move(stackEntry));
+                    stackEntry = AZStd::move(mappedDrive);
+                }
+
+                AZStd::unique_ptr<Scheduler> stack = AZStd::make_unique<Scheduler>(AZStd::move(stackEntry));
+                m_streamer = aznew Streamer(AZStd::thread_desc{}, AZStd::move(stack));
+            }
+        }
+
+        void TearDown([[maybe_unused]] const ::benchmark::State& state) override
+        {
+            using namespace AZ::IO;
+
+            AZStd::string temp;
+            m_absolutePath.swap(temp);
+
+            delete m_streamer;
+
+            SystemFile::Delete(TestFileName);
+
+            AZ::IO::FileIOBase::SetInstance(nullptr);
+            AZ::IO::FileIOBase::SetInstance(m_previousFileIO);
+            delete m_fileIO;
+        }
+
+        void ReadFileInChunks(benchmark::State& state)
+        {
+            using namespace AZ::IO;
+            using namespace AZStd::chrono;
+
+            const size_t chunkSize = aznumeric_cast<size_t>(state.range(0));
+            const size_t numChunks = FileSize / chunkSize;
+            AZStd::unique_ptr<char[]> buffer(new char[FileSize]);
+
+            for (auto _ : state)
+            {
+                AZStd::binary_semaphore waitForReads;
+                AZStd::atomic_size_t remaining{ numChunks };
+                AZStd::atomic<system_clock::time_point> end;
+                auto callback = [&end, &remaining, &waitForReads]([[maybe_unused]] FileRequestHandle request)
+                {
+                    if (--remaining == 0)
+                    {
+                        benchmark::DoNotOptimize(end = high_resolution_clock::now());
+                        waitForReads.release();
+                    }
+                };
+
+                AZStd::vector<FileRequestPtr> requests;
+                requests.reserve(numChunks);
+                for (size_t i = 0; i < numChunks; ++i)
+                {
+                    FileRequestPtr request = m_streamer->Read(m_absolutePath, buffer.get() + i * chunkSize, chunkSize, chunkSize,
+                        IStreamerTypes::s_noDeadline, IStreamerTypes::s_priorityMedium, i * chunkSize);
+                    m_streamer->SetRequestCompleteCallback(request, callback);
+                    requests.push_back(AZStd::move(request));
+                }
+
+                system_clock::time_point start;
+                benchmark::DoNotOptimize(start = high_resolution_clock::now());
+                m_streamer->QueueRequestBatch(AZStd::move(requests));
+
+                waitForReads.try_acquire_for(AZStd::chrono::seconds(30));
+                auto durationInSeconds = duration_cast<duration<double>>(end.load() - start);
+                state.SetIterationTime(durationInSeconds.count());
+            }
+            state.SetBytesProcessed(aznumeric_cast<int64_t>(state.iterations() * FileSize));
+        }
+
+        AZStd::string m_absolutePath;
+        AZ::IO::Streamer* m_streamer{};
+        AZ::IO::FileIOBase* m_previousFileIO{};
+        UnitTest::TestFileIOBase* m_fileIO{};
+    };
+
+    BENCHMARK_DEFINE_F(MemoryMappedDriveLinuxFixture, ChunkedReads_LinuxStorageDrive)(benchmark::State& state)
+    {
+        SetupStreamer(false);
+        ReadFileInChunks(state);
+    }
+
+    BENCHMARK_DEFINE_F(MemoryMappedDriveLinuxFixture, ChunkedReads_MemoryMappedDrive)(benchmark::State& state)
+    {
+        SetupStreamer(true);
+        ReadFileInChunks(state);
+    }
+
+    BENCHMARK_REGISTER_F(MemoryMappedDriveLinuxFixture, ChunkedReads_LinuxStorageDrive)
+        ->RangeMultiplier(8)
+        ->Range(4_kib, 2_mib)
+        ->UseManualTime()
+        ->Unit(benchmark::kMillisecond);
+
+    BENCHMARK_REGISTER_F(MemoryMappedDriveLinuxFixture, ChunkedReads_MemoryMappedDrive)
+        ->RangeMultiplier(8)
+        ->Range(4_kib, 2_mib)
+        ->UseManualTime()
+        ->Unit(benchmark::kMillisecond);
+} // namespace Benchmark
+#endif // HAVE_BENCHMARK
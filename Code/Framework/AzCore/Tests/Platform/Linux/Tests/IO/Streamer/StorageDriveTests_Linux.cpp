@@ -0,0 +1,478 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/Streamer/Scheduler.h>
+#include <AzCore/IO/Streamer/StorageDrive.h>
+#include <AzCore/IO/Streamer/StorageDrive_Linux.h>
+#include <AzCore/IO/Streamer/Streamer.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/parallel/binary_semaphore.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/StringFunc/StringFunc.h>
+#include <AzCore/Utils/Utils.h>
+
+#include <Tests/FileIOBaseTestTypes.h>
+#include <Tests/Streamer/StreamStackEntryConformityTests.h>
+
+namespace AZ::IO
+{
+    constexpr AZ::u32 TestMaxFileHandles = 1;
+    constexpr AZ::u32 TestMaxMetaDataEntries = 16;
+    constexpr AZ::u32 TestQueueDepth = 8;
+    constexpr AZ::s32 TestOverCommit = 0;
+    constexpr AZ::u32 TestThreadPoolSize = 2;
+
+    //
+    // StreamStackEntry API Conformity
+    //
+    class StorageDriveLinuxTestDescription :
+        public StreamStackEntryConformityTestsDescriptor<StorageDriveLinux>
+    {
+    public:
+        StorageDriveLinux CreateInstance() override
+        {
+            StorageDriveLinux::ConstructionOptions options;
+            options.m_hasSeekPenalty = false;
+            options.m_minimalReporting = true;
+
+            return StorageDriveLinux({ "/" }, TestMaxFileHandles, TestMaxMetaDataEntries, TestQueueDepth,
+                TestOverCommit, TestThreadPoolSize, options);
+        }
+    };
+
+    INSTANTIATE_TYPED_TEST_CASE_P(
+        Streamer_StorageDriveLinuxConformityTests, StreamStackEntryConformityTests, StorageDriveLinuxTestDescription);
+
+    //
+    // StorageDriveLinux Tests
+    //
+
+    // The tests are run for both io_uring and the thread pool. If io_uring isn't available on the machine running the tests
+    // both variants will use the thread pool.
+    class Streamer_StorageDriveLinuxTestFixture
+        : public UnitTest::ScopedAllocatorSetupFixture
+        , public UnitTest::SetRestoreFileIOBaseRAII
+        , public ::testing::WithParamInterface<bool>
+    {
+    public:
+        static constexpr char s_dummyFilename[] = "Dummy.bin";
+        static constexpr char s_fileCharacter = 'F';
+        static constexpr char s_beginCharacter = 'B';
+        static constexpr char s_endCharacter = 'E';
+        static constexpr char s_chunkCharacter = 'C';
+
+        UnitTest::TestFileIOBase m_fileIO{};
+        AZStd::string m_dummyFilepath;
+        AZ::IO::RequestPath m_dummyRequestPath;
+        AZStd::shared_ptr<StorageDriveLinux> m_storageDrive{};
+        AZStd::unique_ptr<AZ::IO::StreamerContext> m_context;
+        AZStd::vector<AZStd::string> m_dummyFiles;
+
+        Streamer_StorageDriveLinuxTestFixture()
+            : UnitTest::SetRestoreFileIOBaseRAII(m_fileIO)
+        {
+            char exePath[AZ_MAX_PATH_LEN] = { 0 };
+            auto result = AZ::Utils::GetExecutablePath(exePath, AZ_MAX_PATH_LEN);
+            if (result.m_pathStored == AZ::Utils::ExecutablePathResult::Success)
+            {
+                AZStd::string filePath(exePath);
+                if (result.m_pathIncludesFilename)
+                {
+                    AZ::StringFunc::Path::StripFullName(filePath);
+                }
+                AZ::StringFunc::Path::Join(filePath.c_str(), "TestFiles", filePath);
+                if (AZ::IO::SystemFile::Exists(filePath.c_str()) || AZ::IO::SystemFile::CreateDir(filePath.c_str()))
+                {
+                    AZ::StringFunc::Path::Join(filePath.c_str(), s_dummyFilename, m_dummyFilepath);
+                }
+            }
+        }
+
+        void SetUp() override
+        {
+            ASSERT_FALSE(m_dummyFilepath.empty());
+            m_dummyRequestPath.InitFromAbsolutePath(m_dummyFilepath);
+
+            m_context = AZStd::make_unique<AZ::IO::StreamerContext>();
+            StorageDriveLinux::ConstructionOptions options;
+            options.m_hasSeekPenalty = false;
+            options.m_enableIoUring = GetParam();
+            options.m_minimalReporting = true;
+            m_storageDrive = AZStd::make_shared<StorageDriveLinux>(AZStd::vector<AZStd::string_view>{ "/" },
+                TestMaxFileHandles, TestMaxMetaDataEntries, TestQueueDepth, TestOverCommit, TestThreadPoolSize, options);
+            m_storageDrive->SetContext(*m_context);
+        }
+
+        void TearDown() override
+        {
+            m_storageDrive.reset();
+            m_context.reset();
+
+            for (auto& dummyFile : m_dummyFiles)
+            {
+                AZ::IO::SystemFile::Delete(dummyFile.c_str());
+            }
+            m_dummyFiles.clear();
+            m_dummyFiles.shrink_to_fit();
+        }
+
+        // Create a file filled with a single character. If chunkOffset is non-zero, a marker is written every chunkOffset bytes.
+        // The first and last byte of the file are set to the begin and end markers.
+        void CreateDummyFile(const AZStd::string& path, size_t fileSize, size_t chunkOffset = 0)
+        {
+            SystemFile file;
+            ASSERT_TRUE(file.Open(path.c_str(), SystemFile::OpenMode::SF_OPEN_CREATE | SystemFile::OpenMode::SF_OPEN_READ_WRITE));
+            m_dummyFiles.push_back(path);
+
+            AZStd::unique_ptr<char[]> buffer(new char[fileSize]);
+            ::memset(buffer.get(), s_fileCharacter, fileSize);
+            if (chunkOffset != 0)
+            {
+                for (size_t offset = 0; offset < fileSize; offset += chunkOffset)
+                {
+                    buffer[offset] = s_chunkCharacter;
+                }
+            }
+            buffer[0] = s_beginCharacter;
+            buffer[fileSize - 1] = s_endCharacter;
+
+            auto bytesWritten = file.Write(buffer.get(), fileSize);
+            file.Close();
+            ASSERT_EQ(bytesWritten, fileSize);
+        }
+
+        void WaitTillCompleted()
+        {
+            StreamStackEntry::Status status;
+            auto startTime = AZStd::chrono::system_clock::now();
+            do
+            {
+                m_storageDrive->ExecuteRequests();
+                m_context->FinalizeCompletedRequests();
+
+                status.m_isIdle = true;
+                m_storageDrive->UpdateStatus(status);
+
+                if (AZStd::chrono::system_clock::now() - startTime > AZStd::chrono::seconds(5))
+                {
+                    FAIL();
+                }
+            } while (!status.m_isIdle);
+        }
+    };
+
+    TEST_P(Streamer_StorageDriveLinuxTestFixture, Constructor_InvalidQueueDepth_WarningIsReportedAndSizeAdjusted)
+    {
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        m_storageDrive = AZStd::make_shared<StorageDriveLinux>(AZStd::vector<AZStd::string_view>{ "/" },
+            TestMaxFileHandles, TestMaxMetaDataEntries, 0, TestOverCommit, TestThreadPoolSize, StorageDriveLinux::ConstructionOptions{});
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+
+        StreamStackEntry::Status status{};
+        m_storageDrive->UpdateStatus(status);
+        EXPECT_EQ(1, status.m_numAvailableSlots);
+    }
+
+    TEST_P(Streamer_StorageDriveLinuxTestFixture, FileMetaDataRetrievalRequest_FileExists_ReportsAccurateFileSize)
+    {
+        CreateDummyFile(m_dummyFilepath, 4_kib);
+
+        FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateFileMetaDataRetrieval(m_dummyRequestPath);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                auto& fileMetaData = AZStd::get<FileRequest::FileMetaDataRetrievalData>(request.GetCommand());
+                EXPECT_TRUE(fileMetaData.m_found);
+                EXPECT_EQ(4_kib, fileMetaData.m_fileSize);
+            });
+
+        m_storageDrive->QueueRequest(request);
+        WaitTillCompleted();
+    }
+
+    TEST_P(Streamer_StorageDriveLinuxTestFixture, FileExistsRequest_FileDoesNotExist_ReturnsCompletedWithFileNotFound)
+    {
+        RequestPath path;
+        path.InitFromAbsolutePath(m_dummyFilepath + ".disappear");
+
+        FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateFileExistsCheck(path);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                auto& fileExistsCheck = AZStd::get<FileRequest::FileExistsCheckData>(request.GetCommand());
+                EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, request.GetStatus());
+                EXPECT_FALSE(fileExistsCheck.m_found);
+            });
+        m_storageDrive->QueueRequest(request);
+        WaitTillCompleted();
+    }
+
+    TEST_P(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_ParallelReads_DataIsCorrect)
+    {
+        // Use more chunks than the queue depth so reads need to be issued in multiple batches.
+        constexpr size_t chunkSize = 4_kib;
+        constexpr size_t numChunks = TestQueueDepth * 2 + 1;
+        constexpr size_t fileSize = numChunks * chunkSize;
+        AZStd::array<AZStd::unique_ptr<u8[]>, numChunks> buffers;
+
+        CreateDummyFile(m_dummyFilepath, fileSize, chunkSize);
+
+        size_t numCompleted = 0;
+        for (size_t i = 0; i < numChunks; ++i)
+        {
+            buffers[i].reset(new u8[chunkSize]);
+            FileRequest* request = m_context->GetNewInternalRequest();
+            request->CreateRead(nullptr, buffers[i].get(), chunkSize, m_dummyRequestPath, i * chunkSize, chunkSize);
+            request->SetCompletionCallback([i, &numCompleted](const FileRequest& request)
+                {
+                    EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, request.GetStatus());
+                    auto& readRequest = AZStd::get<FileRequest::ReadData>(request.GetCommand());
+                    EXPECT_EQ(readRequest.m_offset, i * chunkSize);
+                    numCompleted++;
+                });
+            m_storageDrive->QueueRequest(request);
+        }
+
+        WaitTillCompleted();
+        EXPECT_EQ(numChunks, numCompleted);
+
+        EXPECT_EQ(buffers[0][0], s_beginCharacter);
+        EXPECT_EQ(buffers[numChunks - 1][chunkSize - 1], s_endCharacter);
+        for (size_t i = 1; i < numChunks; ++i)
+        {
+            EXPECT_EQ(buffers[i][0], s_chunkCharacter);
+            EXPECT_EQ(buffers[i][1], s_fileCharacter);
+        }
+    }
+
+    TEST_P(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_ReadPastEndOfFile_ReportsFailure)
+    {
+        constexpr size_t fileSize = 4_kib;
+        CreateDummyFile(m_dummyFilepath, fileSize);
+
+        AZStd::unique_ptr<char[]> buffer(new char[fileSize * 2]);
+        FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateRead(nullptr, buffer.get(), fileSize * 2, m_dummyRequestPath, 0, fileSize * 2);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                EXPECT_EQ(IStreamerTypes::RequestStatus::Failed, request.GetStatus());
+            });
+        m_storageDrive->QueueRequest(request);
+        WaitTillCompleted();
+    }
+
+    TEST_P(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_InvalidFilePath_RequestIsForwarded)
+    {
+        char buffer[64];
+
+        auto mock = AZStd::make_shared<::testing::NiceMock<StreamStackEntryMock>>();
+        m_storageDrive->SetNext(mock);
+
+        RequestPath path;
+        path.InitFromAbsolutePath(m_dummyFilepath + "/Broken/Path.txt");
+        FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateRead(nullptr, buffer, sizeof(buffer), path, 0, sizeof(buffer));
+        EXPECT_CALL(*mock, QueueRequest(request)).
+            WillOnce([this](FileRequest* request)
+                {
+                    m_context->MarkRequestAsCompleted(request);
+                });
+
+        m_storageDrive->QueueRequest(request);
+        WaitTillCompleted();
+    }
+
+    TEST_P(Streamer_StorageDriveLinuxTestFixture, CollectStatistics_ReadDone_MoreThanZeroStatisticsReturned)
+    {
+        constexpr size_t fileSize = 16_kib;
+        CreateDummyFile(m_dummyFilepath, fileSize);
+        AZStd::unique_ptr<char[]> buffer(new char[fileSize]);
+
+        FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateRead(nullptr, buffer.get(), fileSize, m_dummyRequestPath, 0, fileSize);
+        m_storageDrive->QueueRequest(request);
+        WaitTillCompleted();
+
+        AZStd::vector<Statistic> statistics;
+        m_storageDrive->CollectStatistics(statistics);
+        EXPECT_FALSE(statistics.empty());
+    }
+
+    INSTANTIATE_TEST_CASE_P(
+        Streamer_StorageDriveLinux, Streamer_StorageDriveLinuxTestFixture, ::testing::Values(true, false),
+        [](const ::testing::TestParamInfo<bool>& info)
+        {
+            return info.param ? "IoUring" : "ThreadPool";
+        });
+} // namespace AZ::IO
+
+#if defined(HAVE_BENCHMARK)
+
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    //! Compares the generic StorageDrive, which reads one request at a time, with StorageDriveLinux using io_uring and using
+    //! the thread pool. The file is read as a batch of chunks to simulate loading many assets from an archive at once.
+    class StorageDriveLinuxFixture : public benchmark::Fixture
+    {
+    public:
+        constexpr static const char* TestFileName = "StreamerBenchmark.bin";
+        constexpr static size_t FileSize = 64_mib;
+
+        enum class DriveType
+        {
+            Generic,
+            LinuxIoUring,
+            LinuxThreadPool
+        };
+
+        void SetupStreamer(DriveType driveType)
+        {
+            using namespace AZ::IO;
+
+            m_fileIO = new UnitTest::TestFileIOBase();
+            m_previousFileIO = AZ::IO::FileIOBase::GetInstance();
+            AZ::IO::FileIOBase::SetInstance(nullptr);
+            AZ::IO::FileIOBase::SetInstance(m_fileIO);
+
+            SystemFile file;
+            file.Open(TestFileName, SystemFile::OpenMode::SF_OPEN_CREATE | SystemFile::OpenMode::SF_OPEN_READ_WRITE);
+            AZStd::unique_ptr<char[]> buffer(new char[FileSize]);
+            ::memset(buffer.get(), 'c', FileSize);
+            file.Write(buffer.get(), FileSize);
+            file.Close();
+
+            AZStd::optional<AZ::IO::FixedMaxPathString> absolutePath = AZ::Utils::ConvertToAbsolutePath(TestFileName);
+            if (absolutePath.has_value())
+            {
+                m_absolutePath = *absolutePath;
+
+                AZStd::shared_ptr<StreamStackEntry> storageDrive;
+                if (driveType == DriveType::Generic)
+                {
+                    storageDrive = AZStd::make_shared<StorageDrive>(32);
+                }
+                else
+                {
+                    StorageDriveLinux::ConstructionOptions options;
+                    options.m_hasSeekPenalty = false;
+                    options.m_enableIoUring = driveType == DriveType::LinuxIoUring;
+                    options.m_minimalReporting = true;
+                    storageDrive = AZStd::make_shared<StorageDriveLinux>(
+                        AZStd::vector<AZStd::string_view>{ "/" }, 32, 32, 32, 8, 4, options);
+                }
+
+                AZStd::unique_ptr<Scheduler> stack = AZStd::make_unique<Scheduler>(AZStd::move(storageDrive));
+                m_streamer = aznew Streamer(AZStd::thread_desc{}, AZStd::move(stack));
+            }
+        }
+
+        void TearDown([[maybe_unused]] const ::benchmark::State& state) override
+        {
+            using namespace AZ::IO;
+
+            AZStd::string temp;
+            m_absolutePath.swap(temp);
+
+            delete m_streamer;
+
+            SystemFile::Delete(TestFileName);
+
+            AZ::IO::FileIOBase::SetInstance(nullptr);
+            AZ::IO::FileIOBase::SetInstance(m_previousFileIO);
+            delete m_fileIO;
+        }
+
+        void ReadFileInChunks(benchmark::State& state)
+        {
+            using namespace AZ::IO;
+            using namespace AZStd::chrono;
+
+            const size_t chunkSize = aznumeric_cast<size_t>(state.range(0));
+            const size_t numChunks = FileSize / chunkSize;
+            AZStd::unique_ptr<char[]> buffer(new char[FileSize]);
+
+            for (auto _ : state)
+            {
+                AZStd::binary_semaphore waitForReads;
+                AZStd::atomic_size_t remaining{ numChunks };
+                AZStd::atomic<system_clock::time_point> end;
+                auto callback = [&end, &remaining, &waitForReads]([[maybe_unused]] FileRequestHandle request)
+                {
+                    if (--remaining == 0)
+                    {
+                        benchmark::DoNotOptimize(end = high_resolution_clock::now());
+                        waitForReads.release();
+                    }
+                };
+
+                AZStd::vector<FileRequestPtr> requests;
+                requests.reserve(numChunks);
+                for (size_t i = 0; i < numChunks; ++i)
+                {
+                    FileRequestPtr request = m_streamer->Read(m_absolutePath, buffer.get() + i * chunkSize, chunkSize, chunkSize,
+                        IStreamerTypes::s_noDeadline, IStreamerTypes::s_priorityMedium, i * chunkSize);
+                    m_streamer->SetRequestCompleteCallback(request, callback);
+                    requests.push_back(AZStd::move(request));
+                }
+
+                system_clock::time_point start;
+                benchmark::DoNotOptimize(start = high_resolution_clock::now());
+                m_streamer->QueueRequestBatch(AZStd::move(requests));
+
+                waitForReads.try_acquire_for(AZStd::chrono::seconds(30));
+                auto durationInSeconds = duration_cast<duration<double>>(end.load() - start);
+                state.SetIterationTime(durationInSeconds.count());
+            }
+            state.SetBytesProcessed(aznumeric_cast<int64_t>(state.iterations() * FileSize));
+        }
+
+        AZStd::string m_absolutePath;
+        AZ::IO::Streamer* m_streamer{};
+        AZ::IO::FileIOBase* m_previousFileIO{};
+        UnitTest::TestFileIOBase* m_fileIO{};
+    };
+
+    BENCHMARK_DEFINE_F(StorageDriveLinuxFixture, ChunkedReads_GenericStorageDrive)(benchmark::State& state)
+    {
+        SetupStreamer(DriveType::Generic);
+        ReadFileInChunks(state);
+    }
+
+    BENCHMARK_DEFINE_F(StorageDriveLinuxFixture, ChunkedReads_LinuxStorageDriveIoUring)(benchmark::State& state)
+    {
+        SetupStreamer(DriveType::LinuxIoUring);
+        ReadFileInChunks(state);
+    }
+
+    BENCHMARK_DEFINE_F(StorageDriveLinuxFixture, ChunkedReads_LinuxStorageDriveThreadPool)(benchmark::State& state)
+    {
+        SetupStreamer(DriveType::LinuxThreadPool);
+        ReadFileInChunks(state);
+    }
+
+    BENCHMARK_REGISTER_F(StorageDriveLinuxFixture, ChunkedReads_GenericStorageDrive)
+        ->RangeMultiplier(8)
+        ->Range(4_kib, 2_mib)
+        ->UseManualTime()
+        ->Unit(benchmark::kMillisecond);
+
+    BENCHMARK_REGISTER_F(StorageDriveLinuxFixture, ChunkedReads_LinuxStorageDriveIoUring)
+        ->RangeMultiplier(8)
+        ->Range(4_kib, 2_mib)
+        ->UseManualTime()
+        ->Unit(benchmark::kMillisecond);
+
+    BENCHMARK_REGISTER_F(StorageDriveLinuxFixture, ChunkedReads_LinuxStorageDriveThreadPool)
+        ->RangeMultiplier(8)
+        ->Range(4_kib, 2_mib)
+        ->UseManualTime()
+        ->Unit(benchmark::kMillisecond);
+} // namespace Benchmark
+#endif // HAVE_BENCHMARK
@@ -65,6 +65,10 @@
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AZTestShared/Utils/Utils.h>
 
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+#endif
+
 namespace SerializeTestClasses {
     class MyClassBase1
     {
@@ -8152,5 +8156,345 @@ namespace UnitTest
         m_serializeContext->Class<TestClassWithEnumFieldThatSpecializesTypeInfo>();
         m_serializeContext->DisableRemoveReflection();
     }
+
+    namespace CompiledLayoutTypes
+    {
+        struct Transform
+        {
+            AZ_TYPE_INFO(Transform, "{3B45E1A5-985E-4605-A176-DB5DD943465C}");
+
+            bool operator==(const Transform& rhs) const
+            {
+                return m_x == rhs.m_x && m_y == rhs.m_y && m_z == rhs.m_z && m_scale == rhs.m_scale;
+            }
+
+            float m_x = 0.0f;
+            float m_y = 0.0f;
+            float m_z = 0.0f;
+            float m_scale = 1.0f;
+        };
+
+        struct RecordBase
+        {
+            AZ_RTTI(RecordBase, "{1C3B6477-5218-4F9C-B0AC-B67D1B5A1607}");
+            virtual ~RecordBase() = default;
+
+            AZ::u32 m_id = 0;
+        };
+
+        struct Record
+            : public RecordBase
+        {
+            AZ_RTTI(Record, "{9A0C9211-0645-4F9C-97BA-5817F11B4CE5}", RecordBase);
+            AZ_CLASS_ALLOCATOR(Record, AZ::SystemAllocator, 0);
+
+            bool operator==(const Record& rhs) const
+            {
+                return m_id == rhs.m_id && m_transform == rhs.m_transform && m_name == rhs.m_name && m_values == rhs.m_values &&
+                    m_enabled == rhs.m_enabled;
+            }
+
+            Transform m_transform;
+            AZStd::string m_name;
+            AZStd::vector<AZ::s32> m_values;
+            bool m_enabled = false;
+        };
+
+        struct RecordList
+        {
+            AZ_TYPE_INFO(RecordList, "{B28A0801-8848-48CA-A8BD-545D310E8C62}");
+            AZ_CLASS_ALLOCATOR(RecordList, AZ::SystemAllocator, 0);
+
+            AZStd::vector<Record> m_records;
+        };
+
+        struct RecordWithPointer
+        {
+            AZ_TYPE_INFO(RecordWithPointer, "{C05E045B-EF81-4F77-B104-9BDBEA97A681}");
+            AZ_CLASS_ALLOCATOR(RecordWithPointer, AZ::SystemAllocator, 0);
+
+            ~RecordWithPointer()
+            {
+                delete m_record;
+            }
+
+            Record* m_record = nullptr;
+            AZ::u32 m_id = 0;
+        };
+
+        void Reflect(SerializeContext& context, bool useCompiledLayout)
+        {
+            auto transformBuilder = context.Class<Transform>()
+                ->Field("X", &Transform::m_x)
+                ->Field("Y", &Transform::m_y)
+                ->Field("Z", &Transform::m_z)
+                ->Field("Scale", &Transform::m_scale);
+            auto recordBaseBuilder = context.Class<RecordBase>()
+                ->Field("Id", &RecordBase::m_id);
+            auto recordBuilder = context.Class<Record, RecordBase>()
+                ->Field("Transform", &Record::m_transform)
+                ->Field("Name", &Record::m_name)
+                ->Field("Values", &Record::m_values)
+                ->Field("Enabled", &Record::m_enabled);
+            auto recordListBuilder = context.Class<RecordList>()
+                ->Field("Records", &RecordList::m_records);
+            auto recordWithPointerBuilder = context.Class<RecordWithPointer>()
+                ->Field("Record", &RecordWithPointer::m_record)
+                ->Field("Id", &RecordWithPointer::m_id);
+
+            if (useCompiledLayout)
+            {
+                transformBuilder->UseCompiledLayout();
+                recordBaseBuilder->UseCompiledLayout();
+                recordBuilder->UseCompiledLayout();
+                recordListBuilder->UseCompiledLayout();
+                recordWithPointerBuilder->UseCompiledLayout();
+            }
+        }
+
+        void FillRecords(RecordList& list, size_t count)
+        {
+            list.m_records.resize(count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                Record& record = list.m_records[i];
+                record.m_id = static_cast<AZ::u32>(i);
+                record.m_transform.m_x = static_cast<float>(i);
+                record.m_transform.m_y = static_cast<float>(i) * 2.0f;
+                record.m_transform.m_z = static_cast<float>(i) * 3.0f;
+                record.m_transform.m_scale = 0.5f;
+                record.m_name = AZStd::string::format("Record%zu", i);
+                record.m_values = { static_cast<AZ::s32>(i), -static_cast<AZ::s32>(i) };
+                record.m_enabled = (i % 2) == 0;
+            }
+        }
+    } // namespace CompiledLayoutTypes
+
+    using SerializeCompiledLayoutTest = Serialization;
+
+    TEST_F(SerializeCompiledLayoutTest, GetCompiledLayout_ClassWithNestedAndBaseClasses_FlattensElements)
+    {
+        using namespace CompiledLayoutTypes;
+        Reflect(*m_serializeContext, true);
+
+        const SerializeContext::ClassData* recordClassData = m_serializeContext->FindClassData(azrtti_typeid<Record>());
+        ASSERT_NE(nullptr, recordClassData);
+        const SerializeContext::CompiledLayout* layout = m_serializeContext->GetCompiledLayout(recordClassData);
+        ASSERT_NE(nullptr, layout);
+
+        // The id of the base class and the four floats of the nested transform are copied at once, followed by the
+        // string, the vector and the bool.
+        ASSERT_EQ(4, layout->m_ops.size());
+        EXPECT_EQ(SerializeContext::CompiledLayout::OpType::CopyBytes, layout->m_ops[0].m_type);
+        EXPECT_EQ(sizeof(AZ::u32) + 4 * sizeof(float), layout->m_ops[0].m_size);
+        EXPECT_EQ(SerializeContext::CompiledLayout::OpType::CloneSerialized, layout->m_ops[1].m_type);
+        EXPECT_EQ(SerializeContext::CompiledLayout::OpType::CloneGeneric, layout->m_ops[2].m_type);
+        EXPECT_EQ(SerializeContext::CompiledLayout::OpType::CopyBytes, layout->m_ops[3].m_type);
+
+        const SerializeContext::CompiledLayout::Element* nameElement = layout->FindElement(AZ_CRC_CE("Name"));
+        ASSERT_NE(nullptr, nameElement);
+        EXPECT_EQ(azrtti_typeid<AZStd::string>(), nameElement->m_classData->m_typeId);
+        EXPECT_EQ(nullptr, layout->FindElement(AZ_CRC_CE("Id"))); // elements of the base class are found through the base class
+    }
+
+    TEST_F(SerializeCompiledLayoutTest, GetCompiledLayout_ClassWithoutOptIn_ReturnsNull)
+    {
+        using namespace CompiledLayoutTypes;
+        Reflect(*m_serializeContext, false);
+
+        EXPECT_EQ(nullptr, m_serializeContext->GetCompiledLayout(m_serializeContext->FindClassData(azrtti_typeid<Record>())));
+    }
+
+    TEST_F(SerializeCompiledLayoutTest, GetCompiledLayout_ClassWithPointerElement_FallsBackToGenericPath)
+    {
+        using namespace CompiledLayoutTypes;
+        Reflect(*m_serializeContext, true);
+
+        EXPECT_EQ(nullptr, m_serializeContext->GetCompiledLayout(m_serializeContext->FindClassData(azrtti_typeid<RecordWithPointer>())));
+
+        RecordWithPointer source;
+        source.m_id = 7;
+        source.m_record = aznew Record();
+        source.m_record->m_name = "Pointer";
+        RecordWithPointer clone;
+        m_serializeContext->CloneObjectInplace(clone, &source);
+        EXPECT_EQ(7, clone.m_id);
+        ASSERT_NE(nullptr, clone.m_record);
+        EXPECT_NE(source.m_record, clone.m_record);
+        EXPECT_EQ(*source.m_record, *clone.m_record);
+    }
+
+    TEST_F(SerializeCompiledLayoutTest, GetCompiledLayout_NestedClassUnreflected_LayoutIsRebuilt)
+    {
+        using namespace CompiledLayoutTypes;
+        Reflect(*m_serializeContext, true);
+
+        const SerializeContext::ClassData* recordClassData = m_serializeContext->FindClassData(azrtti_typeid<Record>());
+        EXPECT_NE(nullptr, m_serializeContext->GetCompiledLayout(recordClassData));
+
+        m_serializeContext->EnableRemoveReflection();
+        m_serializeContext->Class<Transform>();
+        m_serializeContext->DisableRemoveReflection();
+
+        // The transform can no longer be resolved, so the record can't be compiled anymore.
+        EXPECT_EQ(nullptr, m_serializeContext->GetCompiledLayout(recordClassData));
+    }
+
+    TEST_F(SerializeCompiledLayoutTest, CloneObject_CompiledLayout_MatchesSource)
+    {
+        using namespace CompiledLayoutTypes;
+        Reflect(*m_serializeContext, true);
+
+        RecordList source;
+        FillRecords(source, 16);
+
+        AZStd::unique_ptr<RecordList> clone(m_serializeContext->CloneObject(&source));
+        ASSERT_NE(nullptr, clone);
+        EXPECT_EQ(source.m_records, clone->m_records);
+
+        RecordList cloneInplace;
+        FillRecords(cloneInplace, 3);
+        m_serializeContext->CloneObjectInplace(cloneInplace, &source);
+        EXPECT_EQ(source.m_records, cloneInplace.m_records);
+    }
+
+    TEST_F(SerializeCompiledLayoutTest, ObjectStream_CompiledLayout_WritesSameDataAndLoadsIt)
+    {
+        using namespace CompiledLayoutTypes;
+        Reflect(*m_serializeContext, true);
+        SerializeContext genericContext;
+        Reflect(genericContext, false);
+
+        RecordList source;
+        FillRecords(source, 16);
+
+        AZStd::vector<char> compiledBuffer;
+        IO::ByteContainerStream<AZStd::vector<char>> compiledStream(&compiledBuffer);
+        ASSERT_TRUE(AZ::Utils::SaveObjectToStream(compiledStream, ObjectStream::ST_BINARY, &source, m_serializeContext.get()));
+        AZStd::vector<char> genericBuffer;
+        IO::ByteContainerStream<AZStd::vector<char>> genericStream(&genericBuffer);
+        ASSERT_TRUE(AZ::Utils::SaveObjectToStream(genericStream, ObjectStream::ST_BINARY, &source, &genericContext));
+        EXPECT_EQ(genericBuffer, compiledBuffer);
+
+        RecordList loaded;
+        compiledStream.Seek(0, IO::GenericStream::ST_SEEK_BEGIN);
+        ASSERT_TRUE(AZ::Utils::LoadObjectFromStreamInPlace(compiledStream, loaded, m_serializeContext.get()));
+        EXPECT_EQ(source.m_records, loaded.m_records);
+
+        genericContext.EnableRemoveReflection();
+        Reflect(genericContext, false);
+        genericContext.DisableRemoveReflection();
+    }
 }
 
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    class SerializeCompiledLayoutBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        using UnitTest::AllocatorsBenchmarkFixture::SetUp;
+        using UnitTest::AllocatorsBenchmarkFixture::TearDown;
+
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            m_serializeContext = AZStd::make_unique<AZ::SerializeContext>();
+            m_records = AZStd::make_unique<UnitTest::CompiledLayoutTypes::RecordList>();
+            UnitTest::CompiledLayoutTypes::FillRecords(*m_records, aznumeric_cast<size_t>(state.range(0)));
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            m_records.reset();
+            m_serializeContext->EnableRemoveReflection();
+            UnitTest::CompiledLayoutTypes::Reflect(*m_serializeContext, false);
+            m_serializeContext->DisableRemoveReflection();
+            m_serializeContext.reset();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        void Clone(::benchmark::State& state, bool useCompiledLayout)
+        {
+            UnitTest::CompiledLayoutTypes::Reflect(*m_serializeContext, useCompiledLayout);
+            for ([[maybe_unused]] auto _ : state)
+            {
+                UnitTest::CompiledLayoutTypes::RecordList clone;
+                m_serializeContext->CloneObjectInplace(clone, m_records.get());
+                benchmark::DoNotOptimize(clone.m_records.data());
+            }
+            state.SetItemsProcessed(state.iterations() * state.range(0));
+        }
+
+        void SaveBinary(::benchmark::State& state, bool useCompiledLayout)
+        {
+            UnitTest::CompiledLayoutTypes::Reflect(*m_serializeContext, useCompiledLayout);
+            AZStd::vector<char> buffer;
+            for ([[maybe_unused]] auto _ : state)
+            {
+                buffer.clear();
+                AZ::IO::ByteContainerStream<AZStd::vector<char>> stream(&buffer);
+                AZ::Utils::SaveObjectToStream(stream, AZ::ObjectStream::ST_BINARY, m_records.get(), m_serializeContext.get());
+            }
+            state.SetItemsProcessed(state.iterations() * state.range(0));
+        }
+
+        void LoadBinary(::benchmark::State& state, bool useCompiledLayout)
+        {
+            UnitTest::CompiledLayoutTypes::Reflect(*m_serializeContext, useCompiledLayout);
+            AZStd::vector<char> buffer;
+            AZ::IO::ByteContainerStream<AZStd::vector<char>> stream(&buffer);
+            AZ::Utils::SaveObjectToStream(stream, AZ::ObjectStream::ST_BINARY, m_records.get(), m_serializeContext.get());
+            for ([[maybe_unused]] auto _ : state)
+            {
+                stream.Seek(0, AZ::IO::GenericStream::ST_SEEK_BEGIN);
+                UnitTest::CompiledLayoutTypes::RecordList loaded;
+                AZ::Utils::LoadObjectFromStreamInPlace(stream, loaded, m_serializeContext.get());
+                benchmark::DoNotOptimize(loaded.m_records.data());
+            }
+            state.SetItemsProcessed(state.iterations() * state.range(0));
+        }
+
+    protected:
+        AZStd::unique_ptr<AZ::SerializeContext> m_serializeContext;
+        AZStd::unique_ptr<UnitTest::CompiledLayoutTypes::RecordList> m_records;
+    };
+
+    BENCHMARK_DEFINE_F(SerializeCompiledLayoutBenchmarkFixture, CloneObject_Generic)(benchmark::State& state)
+    {
+        Clone(state, false);
+    }
+    BENCHMARK_REGISTER_F(SerializeCompiledLayoutBenchmarkFixture, CloneObject_Generic)->Arg(1000)->Arg(10000);
+
+    BENCHMARK_DEFINE_F(SerializeCompiledLayoutBenchmarkFixture, CloneObject_CompiledLayout)(benchmark::State& state)
+    {
+        Clone(state, true);
+    }
+    BENCHMARK_REGISTER_F(SerializeCompiledLayoutBenchmarkFixture, CloneObject_CompiledLayout)->Arg(1000)->Arg(10000);
+
+    BENCHMARK_DEFINE_F(SerializeCompiledLayoutBenchmarkFixture, ObjectStreamSaveBinary_Generic)(benchmark::State& state)
+    {
+        SaveBinary(state, false);
+    }
+    BENCHMARK_REGISTER_F(SerializeCompiledLayoutBenchmarkFixture, ObjectStreamSaveBinary_Generic)->Arg(1000)->Arg(10000);
+
+    BENCHMARK_DEFINE_F(SerializeCompiledLayoutBenchmarkFixture, ObjectStreamSaveBinary_CompiledLayout)(benchmark::State& state)
+    {
+        SaveBinary(state, true);
+    }
+    BENCHMARK_REGISTER_F(SerializeCompiledLayoutBenchmarkFixture, ObjectStreamSaveBinary_CompiledLayout)->Arg(1000)->Arg(10000);
+
+    BENCHMARK_DEFINE_F(SerializeCompiledLayoutBenchmarkFixture, ObjectStreamLoadBinary_Generic)(benchmark::State& state)
+    {
+        LoadBinary(state, false);
+    }
+    BENCHMARK_REGISTER_F(SerializeCompiledLayoutBenchmarkFixture, ObjectStreamLoadBinary_Generic)->Arg(1000)->Arg(10000);
+
+    BENCHMARK_DEFINE_F(SerializeCompiledLayoutBenchmarkFixture, ObjectStreamLoadBinary_CompiledLayout)(benchmark::State& state)
+    {
+        LoadBinary(state, true);
+    }
+    BENCHMARK_REGISTER_F(SerializeCompiledLayoutBenchmarkFixture, ObjectStreamLoadBinary_CompiledLayout)->Arg(1000)->Arg(10000);
+} // namespace Benchmark
+#endif // HAVE_BENCHMARK
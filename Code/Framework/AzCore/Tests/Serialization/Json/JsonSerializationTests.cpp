@@ -8,7 +8,11 @@
 
 #include <AzCore/PlatformDef.h>
 
+#include <AzCore/IO/GenericStreams.h>
 #include <AzCore/JSON/pointer.h>
+#include <AzCore/JSON/stringbuffer.h>
+#include <AzCore/JSON/writer.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
 
@@ -16,6 +20,10 @@
 #include <Tests/Serialization/Json/JsonSerializationTests.h>
 #include <Tests/Serialization/Json/JsonSerializerMock.h>
 #include <Tests/Serialization/Json/TestCases.h>
+
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+#endif
     
 namespace JsonSerializationTests
 {
@@ -205,6 +213,58 @@ namespace JsonSerializationTests
         EXPECT_TRUE(loadInstance.Equals(*description.m_instance, this->m_fullyReflected));
     }
 
+    TYPED_TEST(TypedJsonSerializationTests, LoadStreaming_JsonWithoutDefaults_SucceedsAndObjectMatches)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        this->Reflect(true);
+        auto description = TypeParam::GetInstanceWithoutDefaults();
+
+        TypeParam loadInstance;
+        ResultCode loadResult = AZ::JsonSerialization::LoadStreaming(loadInstance, description.m_json, *this->m_deserializationSettings);
+        ASSERT_EQ(Outcomes::Success, loadResult.GetOutcome());
+        EXPECT_TRUE(loadInstance.Equals(*description.m_instance, this->m_fullyReflected));
+    }
+
+    TYPED_TEST(TypedJsonSerializationTests, LoadStreaming_JsonWithSomeDefaults_SucceedsAndObjectMatches)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        this->Reflect(true);
+        auto description = TypeParam::GetInstanceWithSomeDefaults();
+        this->m_jsonDocument->Parse(description.m_jsonWithStrippedDefaults);
+
+        TypeParam documentInstance;
+        ResultCode documentResult =
+            AZ::JsonSerialization::Load(documentInstance, *this->m_jsonDocument, *this->m_deserializationSettings);
+
+        TypeParam loadInstance;
+        ResultCode loadResult = AZ::JsonSerialization::LoadStreaming(
+            loadInstance, description.m_jsonWithStrippedDefaults, *this->m_deserializationSettings);
+        EXPECT_EQ(documentResult.GetOutcome(), loadResult.GetOutcome());
+        EXPECT_TRUE(loadInstance.Equals(*description.m_instance, this->m_fullyReflected));
+    }
+
+    TYPED_TEST(TypedJsonSerializationTests, LoadStreaming_InjectedFields_SkipsUnknownFieldsAndObjectMatches)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        this->Reflect(true);
+        auto description = TypeParam::GetInstanceWithoutDefaults();
+        this->m_jsonDocument->Parse(description.m_json);
+        this->InjectAdditionalFields(*this->m_jsonDocument, rapidjson::kStringType, this->m_jsonDocument->GetAllocator());
+
+        rapidjson::StringBuffer buffer;
+        rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+        this->m_jsonDocument->Accept(writer);
+
+        TypeParam loadInstance;
+        ResultCode loadResult = AZ::JsonSerialization::LoadStreaming(
+            loadInstance, AZStd::string_view(buffer.GetString(), buffer.GetSize()), *this->m_deserializationSettings);
+        ASSERT_NE(Processing::Halted, loadResult.GetProcessing());
+        EXPECT_TRUE(loadInstance.Equals(*description.m_instance, this->m_fullyReflected));
+    }
+
     // Load
 
     TEST_F(JsonSerializationTests, Load_PrimitiveAtTheRoot_SucceedsAndObjectMatches)
@@ -566,4 +626,327 @@ namespace JsonSerializationTests
 
         EXPECT_EQ(Outcomes::Catastrophic, result.GetOutcome());
     }
+
+    // Streaming load
+
+    struct StreamingLoadItem
+    {
+        AZ_TYPE_INFO(StreamingLoadItem, "{B1B5E0A4-62E4-4B6B-9D0E-8F3B7B0C2A51}");
+
+        AZStd::string m_name;
+        AZStd::vector<AZStd::string> m_tags;
+        int m_value{ 0 };
+        float m_weight{ 1.0f };
+
+        bool operator==(const StreamingLoadItem& rhs) const
+        {
+            return m_name == rhs.m_name && m_tags == rhs.m_tags && m_value == rhs.m_value && m_weight == rhs.m_weight;
+        }
+
+        static void Reflect(AZ::SerializeContext& context)
+        {
+            context.Class<StreamingLoadItem>()
+                ->Field("Name", &StreamingLoadItem::m_name)
+                ->Field("Tags", &StreamingLoadItem::m_tags)
+                ->Field("Value", &StreamingLoadItem::m_value)
+                ->Field("Weight", &StreamingLoadItem::m_weight);
+        }
+    };
+
+    //! Loosely follows the layout of a prefab, with a large map of objects that in turn contain containers.
+    struct StreamingLoadDocument
+    {
+        AZ_TYPE_INFO(StreamingLoadDocument, "{5E0F4C39-93D8-4E0A-8C7B-6A2F1D3E9B84}");
+
+        AZStd::string m_title;
+        StreamingLoadItem m_root;
+        AZStd::unordered_map<AZStd::string, StreamingLoadItem> m_itemsByName;
+        AZStd::vector<StreamingLoadItem> m_items;
+        AZStd::vector<int> m_values;
+
+        bool operator==(const StreamingLoadDocument& rhs) const
+        {
+            return m_title == rhs.m_title && m_root == rhs.m_root && m_itemsByName == rhs.m_itemsByName && m_items == rhs.m_items &&
+                m_values == rhs.m_values;
+        }
+
+        static void Reflect(AZ::SerializeContext& context)
+        {
+            StreamingLoadItem::Reflect(context);
+            context.Class<StreamingLoadDocument>()
+                ->Field("Title", &StreamingLoadDocument::m_title)
+                ->Field("Root", &StreamingLoadDocument::m_root)
+                ->Field("ItemsByName", &StreamingLoadDocument::m_itemsByName)
+                ->Field("Items", &StreamingLoadDocument::m_items)
+                ->Field("Values", &StreamingLoadDocument::m_values);
+        }
+
+        static StreamingLoadDocument Create(size_t count, AZStd::string_view prefix = "Item")
+        {
+            StreamingLoadDocument result;
+            result.m_title = prefix;
+            result.m_root.m_name = "Root";
+            for (size_t i = 0; i < count; ++i)
+            {
+                StreamingLoadItem item;
+                item.m_name = AZStd::string::format("%.*s_%zu", aznumeric_cast<int>(prefix.size()), prefix.data(), i);
+                item.m_tags = { "Tag", AZStd::string::format("Group_%zu", i % 16) };
+                item.m_value = aznumeric_cast<int>(i);
+                item.m_weight = aznumeric_cast<float>(i) * 0.25f;
+                result.m_itemsByName.emplace(item.m_name, item);
+                result.m_items.push_back(item);
+                result.m_values.push_back(aznumeric_cast<int>(i * 3));
+            }
+            return result;
+        }
+    };
+
+    class JsonStreamingLoadTests
+        : public JsonSerializationTests
+    {
+    public:
+        using JsonSerializationTests::RegisterAdditional;
+
+        void RegisterAdditional(AZStd::unique_ptr<AZ::SerializeContext>& serializeContext) override
+        {
+            StreamingLoadDocument::Reflect(*serializeContext);
+        }
+
+        AZStd::string StoreToString(const StreamingLoadDocument& instance)
+        {
+            m_serializationSettings->m_keepDefaults = true;
+            AZ::JsonSerialization::Store(*m_jsonDocument, m_jsonDocument->GetAllocator(), instance, *m_serializationSettings);
+
+            rapidjson::StringBuffer buffer;
+            rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+            m_jsonDocument->Accept(writer);
+            return AZStd::string(buffer.GetString(), buffer.GetSize());
+        }
+    };
+
+    TEST_F(JsonStreamingLoadTests, LoadStreaming_LargeDocument_MatchesDocumentLoad)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        // Use enough entries to have the map loaded in multiple batches.
+        StreamingLoadDocument source = StreamingLoadDocument::Create(1000);
+        AZStd::string json = StoreToString(source);
+
+        m_jsonDocument->Parse(json.c_str(), json.size());
+        StreamingLoadDocument documentInstance;
+        ResultCode documentResult = AZ::JsonSerialization::Load(documentInstance, *m_jsonDocument, *m_deserializationSettings);
+
+        StreamingLoadDocument streamingInstance;
+        ResultCode streamingResult = AZ::JsonSerialization::LoadStreaming(streamingInstance, json, *m_deserializationSettings);
+
+        EXPECT_EQ(documentResult.GetOutcome(), streamingResult.GetOutcome());
+        EXPECT_EQ(documentResult.GetProcessing(), streamingResult.GetProcessing());
+        EXPECT_TRUE(source == documentInstance);
+        EXPECT_TRUE(source == streamingInstance);
+    }
+
+    TEST_F(JsonStreamingLoadTests, LoadStreaming_ClearContainers_ContainersOnlyHoldLoadedValues)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        StreamingLoadDocument source = StreamingLoadDocument::Create(200);
+        AZStd::string json = StoreToString(source);
+
+        StreamingLoadDocument streamingInstance = StreamingLoadDocument::Create(10, "Existing");
+        m_deserializationSettings->m_clearContainers = true;
+        ResultCode streamingResult = AZ::JsonSerialization::LoadStreaming(streamingInstance, json, *m_deserializationSettings);
+
+        EXPECT_NE(Processing::Halted, streamingResult.GetProcessing());
+        EXPECT_TRUE(source == streamingInstance);
+    }
+
+    TEST_F(JsonStreamingLoadTests, LoadStreaming_KeepContainers_MatchesDocumentLoad)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        StreamingLoadDocument source = StreamingLoadDocument::Create(200);
+        AZStd::string json = StoreToString(source);
+
+        m_jsonDocument->Parse(json.c_str(), json.size());
+        StreamingLoadDocument documentInstance = StreamingLoadDocument::Create(10, "Existing");
+        AZ::JsonSerialization::Load(documentInstance, *m_jsonDocument, *m_deserializationSettings);
+
+        StreamingLoadDocument streamingInstance = StreamingLoadDocument::Create(10, "Existing");
+        ResultCode streamingResult = AZ::JsonSerialization::LoadStreaming(streamingInstance, json, *m_deserializationSettings);
+
+        EXPECT_NE(Processing::Halted, streamingResult.GetProcessing());
+        EXPECT_EQ(210u, streamingInstance.m_itemsByName.size());
+        EXPECT_TRUE(documentInstance == streamingInstance);
+    }
+
+    TEST_F(JsonStreamingLoadTests, LoadStreaming_FromStream_MatchesLoadFromString)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        // Use a document that's larger than the blocks that are read from the stream.
+        StreamingLoadDocument source = StreamingLoadDocument::Create(1000);
+        AZStd::string json = StoreToString(source);
+
+        AZ::IO::MemoryStream stream(json.data(), json.size());
+        StreamingLoadDocument streamingInstance;
+        ResultCode streamingResult = AZ::JsonSerialization::LoadStreaming(
+            &streamingInstance, azrtti_typeid(streamingInstance), stream, *m_deserializationSettings);
+
+        EXPECT_EQ(Outcomes::Success, streamingResult.GetOutcome());
+        EXPECT_TRUE(source == streamingInstance);
+    }
+
+    TEST_F(JsonStreamingLoadTests, LoadStreaming_UnknownFields_ReportedAsSkipped)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        constexpr const char* json = R"({ "Title": "Test", "Unknown": { "Nested": [1, 2, { "Key": "Value" }] }, "Values": [1, 2, 3] })";
+        m_jsonDocument->Parse(json);
+        StreamingLoadDocument documentInstance;
+        ResultCode documentResult = AZ::JsonSerialization::Load(documentInstance, *m_jsonDocument, *m_deserializationSettings);
+
+        AZStd::vector<AZStd::string> skippedPaths;
+        m_deserializationSettings->m_reporting = [&skippedPaths](AZStd::string_view, ResultCode result, AZStd::string_view path)
+        {
+            if (result.GetOutcome() == Outcomes::Skipped)
+            {
+                skippedPaths.emplace_back(path);
+            }
+            return result;
+        };
+        StreamingLoadDocument streamingInstance;
+        ResultCode streamingResult = AZ::JsonSerialization::LoadStreaming(streamingInstance, json, *m_deserializationSettings);
+
+        EXPECT_EQ(documentResult.GetOutcome(), streamingResult.GetOutcome());
+        ASSERT_EQ(1u, skippedPaths.size());
+        EXPECT_STREQ("/Unknown", skippedPaths[0].c_str());
+        EXPECT_TRUE(documentInstance == streamingInstance);
+    }
+
+    TEST_F(JsonStreamingLoadTests, LoadStreaming_InvalidJson_ReturnsCatastrophic)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        StreamingLoadDocument streamingInstance;
+        ResultCode streamingResult = AZ::JsonSerialization::LoadStreaming(
+            streamingInstance, R"({ "Title": "Test", "Values": [1, 2 )", *m_deserializationSettings);
+        EXPECT_EQ(Outcomes::Catastrophic, streamingResult.GetOutcome());
+    }
+
+    TEST_F(JsonStreamingLoadTests, LoadStreaming_LargeDocument_UsesLessMemoryThanDocument)
+    {
+        StreamingLoadDocument source = StreamingLoadDocument::Create(1000);
+        AZStd::string json = StoreToString(source);
+        m_jsonDocument->Parse(json.c_str(), json.size());
+
+        m_deserializationSettings->m_metadata.Add(AZ::JsonStreamingLoadStatistics{});
+        StreamingLoadDocument streamingInstance;
+        AZ::JsonSerialization::LoadStreaming(streamingInstance, json, *m_deserializationSettings);
+
+        const AZ::JsonStreamingLoadStatistics* statistics = m_deserializationSettings->m_metadata.Find<AZ::JsonStreamingLoadStatistics>();
+        ASSERT_NE(nullptr, statistics);
+        EXPECT_LT(0u, statistics->m_bufferedValueCount);
+        EXPECT_LT(0u, statistics->m_peakValueMemory);
+        EXPECT_LT(statistics->m_peakValueMemory, m_jsonDocument->GetAllocator().Capacity());
+    }
 } // namespace JsonSerializationTests
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    class JsonStreamingLoadBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        using UnitTest::AllocatorsBenchmarkFixture::SetUp;
+        using UnitTest::AllocatorsBenchmarkFixture::TearDown;
+
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+
+            m_serializeContext = AZStd::make_unique<AZ::SerializeContext>();
+            m_registrationContext = AZStd::make_unique<AZ::JsonRegistrationContext>();
+            AZ::JsonSystemComponent::Reflect(m_serializeContext.get());
+            AZ::JsonSystemComponent::Reflect(m_registrationContext.get());
+            JsonSerializationTests::StreamingLoadDocument::Reflect(*m_serializeContext);
+
+            m_deserializerSettings.m_serializeContext = m_serializeContext.get();
+            m_deserializerSettings.m_registrationContext = m_registrationContext.get();
+            m_deserializerSettings.m_reporting = [](AZStd::string_view, AZ::JsonSerializationResult::ResultCode result, AZStd::string_view)
+            {
+                return result;
+            };
+
+            AZ::JsonSerializerSettings serializerSettings;
+            serializerSettings.m_serializeContext = m_serializeContext.get();
+            serializerSettings.m_registrationContext = m_registrationContext.get();
+            serializerSettings.m_keepDefaults = true;
+
+            rapidjson::Document document;
+            AZ::JsonSerialization::Store(document, document.GetAllocator(),
+                JsonSerializationTests::StreamingLoadDocument::Create(aznumeric_cast<size_t>(state.range(0))), serializerSettings);
+            rapidjson::StringBuffer buffer;
+            rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+            document.Accept(writer);
+            m_json.assign(buffer.GetString(), buffer.GetSize());
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            m_json = AZStd::string{};
+            m_deserializerSettings = AZ::JsonDeserializerSettings{};
+
+            m_registrationContext->EnableRemoveReflection();
+            AZ::JsonSystemComponent::Reflect(m_registrationContext.get());
+            m_registrationContext->DisableRemoveReflection();
+            m_serializeContext->EnableRemoveReflection();
+            AZ::JsonSystemComponent::Reflect(m_serializeContext.get());
+            JsonSerializationTests::StreamingLoadDocument::Reflect(*m_serializeContext);
+            m_serializeContext->DisableRemoveReflection();
+
+            m_registrationContext.reset();
+            m_serializeContext.reset();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        AZStd::unique_ptr<AZ::SerializeContext> m_serializeContext;
+        AZStd::unique_ptr<AZ::JsonRegistrationContext> m_registrationContext;
+        AZ::JsonDeserializerSettings m_deserializerSettings;
+        AZStd::string m_json;
+    };
+
+    BENCHMARK_DEFINE_F(JsonStreamingLoadBenchmarkFixture, DocumentLoad)(benchmark::State& state)
+    {
+        size_t peakJsonMemory = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            rapidjson::Document document;
+            document.Parse(m_json.c_str(), m_json.size());
+            JsonSerializationTests::StreamingLoadDocument instance;
+            AZ::JsonSerialization::Load(instance, document, m_deserializerSettings);
+            peakJsonMemory = document.GetAllocator().Capacity();
+            benchmark::DoNotOptimize(instance.m_items.data());
+        }
+        state.counters["PeakJsonMemory"] = aznumeric_cast<double>(peakJsonMemory);
+        state.SetBytesProcessed(state.iterations() * m_json.size());
+    }
+    BENCHMARK_REGISTER_F(JsonStreamingLoadBenchmarkFixture, DocumentLoad)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+    BENCHMARK_DEFINE_F(JsonStreamingLoadBenchmarkFixture, StreamingLoad)(benchmark::State& state)
+    {
+        m_deserializerSettings.m_metadata.Add(AZ::JsonStreamingLoadStatistics{});
+        for ([[maybe_unused]] auto _ : state)
+        {
+            JsonSerializationTests::StreamingLoadDocument instance;
+            AZ::JsonSerialization::LoadStreaming(instance, m_json, m_deserializerSettings);
+            benchmark::DoNotOptimize(instance.m_items.data());
+        }
+        const AZ::JsonStreamingLoadStatistics* statistics = m_deserializerSettings.m_metadata.Find<AZ::JsonStreamingLoadStatistics>();
+        state.counters["PeakJsonMemory"] = aznumeric_cast<double>(statistics->m_peakValueMemory);
+        state.SetBytesProcessed(state.iterations() * m_json.size());
+    }
+    BENCHMARK_REGISTER_F(JsonStreamingLoadBenchmarkFixture, StreamingLoad)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
+} // namespace Benchmark
+#endif // HAVE_BENCHMARK
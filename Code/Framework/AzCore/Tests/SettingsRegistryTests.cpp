@@ -20,6 +20,10 @@
 
 #include <AZTestShared/Utils/Utils.h>
 
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+#endif
+
 namespace SettingsRegistryTests
 {
     class TestClass
@@ -1756,4 +1760,200 @@ namespace SettingsRegistryTests
         EXPECT_EQ(AZ::SettingsRegistryInterface::Type::String, m_registry->GetType(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/1/File1"));
         EXPECT_EQ(AZ::SettingsRegistryInterface::Type::String, m_registry->GetType(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/1/File2"));
     }
+
+    //
+    // Snapshots
+    //
+
+    TEST_F(SettingsRegistryTest, LoadSnapshot_SnapshotOfMergedFolder_AllSettingsRestored)
+    {
+        CreateTestFile("Memory.setreg", R"({ "Memory": 0, "Negative": -42, "Large": 18446744073709551615, "Ratio": 0.25 })");
+        CreateTestFile("Memory.editor.setreg", R"({ "Memory": 1, "Name": "Editor", "List": [ true, false, null, { "Nested": 8 } ] })");
+        AZStd::string registryFolder = AZStd::string::format("%s/%s", m_testFolder->c_str(), AZ::SettingsRegistryInterface::RegistryFolder);
+        ASSERT_TRUE(m_registry->MergeSettingsFolder(registryFolder, { "editor" }, {}));
+
+        AZStd::string snapshotPath = AZStd::string::format("%s/Test.setregsnapshot", m_testFolder->c_str());
+        EXPECT_TRUE(m_registry->SaveSnapshot(snapshotPath, 42));
+
+        AZ::SettingsRegistryImpl loadedRegistry;
+        ASSERT_TRUE(loadedRegistry.LoadSnapshot(snapshotPath, 42));
+
+        AZ::s64 signedValue = 0;
+        EXPECT_TRUE(loadedRegistry.Get(signedValue, "/Memory"));
+        EXPECT_EQ(1, signedValue);
+        EXPECT_TRUE(loadedRegistry.Get(signedValue, "/Negative"));
+        EXPECT_EQ(-42, signedValue);
+        AZ::u64 unsignedValue = 0;
+        EXPECT_TRUE(loadedRegistry.Get(unsignedValue, "/Large"));
+        EXPECT_EQ(AZStd::numeric_limits<AZ::u64>::max(), unsignedValue);
+        double doubleValue = 0.0;
+        EXPECT_TRUE(loadedRegistry.Get(doubleValue, "/Ratio"));
+        EXPECT_DOUBLE_EQ(0.25, doubleValue);
+        AZStd::string stringValue;
+        EXPECT_TRUE(loadedRegistry.Get(stringValue, "/Name"));
+        EXPECT_STREQ("Editor", stringValue.c_str());
+        bool boolValue = false;
+        EXPECT_TRUE(loadedRegistry.Get(boolValue, "/List/0"));
+        EXPECT_TRUE(boolValue);
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::Null, loadedRegistry.GetType("/List/2"));
+        EXPECT_TRUE(loadedRegistry.Get(signedValue, "/List/3/Nested"));
+        EXPECT_EQ(8, signedValue);
+
+        EXPECT_EQ(m_registry->CalculateSettingsHash(), loadedRegistry.CalculateSettingsHash());
+    }
+
+    TEST_F(SettingsRegistryTest, LoadSnapshot_NotifiersCalled)
+    {
+        CreateTestFile("Memory.setreg", R"({ "Memory": 0 })");
+        AZStd::string registryFolder = AZStd::string::format("%s/%s", m_testFolder->c_str(), AZ::SettingsRegistryInterface::RegistryFolder);
+        ASSERT_TRUE(m_registry->MergeSettingsFolder(registryFolder, {}, {}));
+        AZStd::string snapshotPath = AZStd::string::format("%s/Test.setregsnapshot", m_testFolder->c_str());
+        ASSERT_TRUE(m_registry->SaveSnapshot(snapshotPath, 0));
+
+        AZ::SettingsRegistryImpl loadedRegistry;
+        size_t counter = 0;
+        auto callback = [&counter](AZStd::string_view path, AZ::SettingsRegistryInterface::Type type)
+        {
+            EXPECT_TRUE(path.empty());
+            EXPECT_EQ(AZ::SettingsRegistryInterface::Type::Object, type);
+            counter++;
+        };
+        auto testNotifier = loadedRegistry.RegisterNotifier(callback);
+        EXPECT_TRUE(loadedRegistry.LoadSnapshot(snapshotPath, 0));
+        EXPECT_EQ(1, counter);
+    }
+
+    TEST_F(SettingsRegistryTest, LoadSnapshot_DifferentKey_ReturnsFalseAndKeepsSettings)
+    {
+        CreateTestFile("Memory.setreg", R"({ "Memory": 0 })");
+        AZStd::string registryFolder = AZStd::string::format("%s/%s", m_testFolder->c_str(), AZ::SettingsRegistryInterface::RegistryFolder);
+        ASSERT_TRUE(m_registry->MergeSettingsFolder(registryFolder, {}, {}));
+        AZStd::string snapshotPath = AZStd::string::format("%s/Test.setregsnapshot", m_testFolder->c_str());
+        ASSERT_TRUE(m_registry->SaveSnapshot(snapshotPath, 1));
+
+        AZ::SettingsRegistryImpl loadedRegistry;
+        ASSERT_TRUE(loadedRegistry.Set("/Existing", true));
+        EXPECT_FALSE(loadedRegistry.LoadSnapshot(snapshotPath, 2));
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::Boolean, loadedRegistry.GetType("/Existing"));
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::NoType, loadedRegistry.GetType("/Memory"));
+    }
+
+    TEST_F(SettingsRegistryTest, LoadSnapshot_MergedFileChanged_ReturnsFalse)
+    {
+        CreateTestFile("Memory.setreg", R"({ "Memory": 0 })");
+        AZStd::string registryFolder = AZStd::string::format("%s/%s", m_testFolder->c_str(), AZ::SettingsRegistryInterface::RegistryFolder);
+        ASSERT_TRUE(m_registry->MergeSettingsFolder(registryFolder, {}, {}));
+        AZStd::string snapshotPath = AZStd::string::format("%s/Test.setregsnapshot", m_testFolder->c_str());
+        ASSERT_TRUE(m_registry->SaveSnapshot(snapshotPath, 0));
+
+        CreateTestFile("Memory.setreg", R"({ "Memory": 1024 })");
+
+        AZ::SettingsRegistryImpl loadedRegistry;
+        EXPECT_FALSE(loadedRegistry.LoadSnapshot(snapshotPath, 0));
+    }
+
+    TEST_F(SettingsRegistryTest, LoadSnapshot_FileAddedToMissingPlatformFolder_ReturnsFalse)
+    {
+        CreateTestFile("Memory.setreg", R"({ "Memory": 0 })");
+        AZStd::string registryFolder = AZStd::string::format("%s/%s", m_testFolder->c_str(), AZ::SettingsRegistryInterface::RegistryFolder);
+        ASSERT_TRUE(m_registry->MergeSettingsFolder(registryFolder, {}, "Special"));
+        AZStd::string snapshotPath = AZStd::string::format("%s/Test.setregsnapshot", m_testFolder->c_str());
+        ASSERT_TRUE(m_registry->SaveSnapshot(snapshotPath, 0));
+
+        CreateTestFile("Platform/Special/Memory.setreg", R"({ "Memory": 1 })");
+
+        AZ::SettingsRegistryImpl loadedRegistry;
+        EXPECT_FALSE(loadedRegistry.LoadSnapshot(snapshotPath, 0));
+    }
+
+    TEST_F(SettingsRegistryTest, LoadSnapshot_MissingSnapshot_ReturnsFalse)
+    {
+        AZStd::string snapshotPath = AZStd::string::format("%s/Missing.setregsnapshot", m_testFolder->c_str());
+        EXPECT_FALSE(m_registry->LoadSnapshot(snapshotPath, 0));
+    }
 } // namespace SettingsRegistryTests
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    class SettingsRegistrySnapshotBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        using UnitTest::AllocatorsBenchmarkFixture::SetUp;
+        using UnitTest::AllocatorsBenchmarkFixture::TearDown;
+
+        void SetUp(::benchmark::State& state) override
+        {
+            using namespace AZ::IO;
+
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+
+            m_testFolder = AZStd::string::format("%sSettingsRegistrySnapshotBenchmark_%s", UnitTest::GetTestFolderPath().c_str(),
+                AZ::Uuid::CreateRandom().ToString<AZStd::string>(false, false).c_str());
+            m_registryFolder = AZStd::string::format("%s/%s", m_testFolder.c_str(), AZ::SettingsRegistryInterface::RegistryFolder);
+            m_snapshotPath = AZStd::string::format("%s/Benchmark.setregsnapshot", m_testFolder.c_str());
+
+            // Roughly resembles the gem and engine registry files that are merged at startup.
+            const int64_t fileCount = state.range(0);
+            for (int64_t i = 0; i < fileCount; ++i)
+            {
+                AZStd::string content = AZStd::string::format(
+                    R"({ "Amazon": { "Gems": { "Gem%lld": { "SourcePaths": [ "/Gems/Gem%lld" ], "Enabled": true,)"
+                    R"( "Settings": { "Budget": %lld, "Scale": 0.5, "Name": "Gem %lld", "Tags": [ "runtime", "tools", "server" ] } } } } })",
+                    static_cast<long long>(i), static_cast<long long>(i), static_cast<long long>(i * 1024), static_cast<long long>(i));
+                AZStd::string path = AZStd::string::format("%s/gem%03lld.setreg", m_registryFolder.c_str(), static_cast<long long>(i));
+
+                SystemFile file;
+                if (file.Open(path.c_str(), SystemFile::SF_OPEN_CREATE | SystemFile::SF_OPEN_CREATE_PATH | SystemFile::SF_OPEN_WRITE_ONLY))
+                {
+                    file.Write(content.data(), content.size());
+                }
+            }
+
+            AZ::SettingsRegistryImpl registry;
+            registry.MergeSettingsFolder(m_registryFolder, {}, {});
+            registry.SaveSnapshot(m_snapshotPath, 0);
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            SettingsRegistryTests::SettingsRegistryTest::DeleteFolderRecursive(m_testFolder);
+            m_testFolder = AZStd::string{};
+            m_registryFolder = AZStd::string{};
+            m_snapshotPath = AZStd::string{};
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        AZStd::string m_testFolder;
+        AZStd::string m_registryFolder;
+        AZStd::string m_snapshotPath;
+    };
+
+    BENCHMARK_DEFINE_F(SettingsRegistrySnapshotBenchmarkFixture, MergeSettingsFolder)(benchmark::State& state)
+    {
+        AZStd::vector<char> scratchBuffer;
+        for (auto _ : state)
+        {
+            AZ::SettingsRegistryImpl registry;
+            registry.MergeSettingsFolder(m_registryFolder, {}, {}, "", &scratchBuffer);
+            benchmark::DoNotOptimize(registry.GetType("/Amazon/Gems"));
+        }
+    }
+
+    BENCHMARK_DEFINE_F(SettingsRegistrySnapshotBenchmarkFixture, LoadSnapshot)(benchmark::State& state)
+    {
+        AZStd::vector<char> scratchBuffer;
+        for (auto _ : state)
+        {
+            AZ::SettingsRegistryImpl registry;
+            registry.LoadSnapshot(m_snapshotPath, 0, &scratchBuffer);
+            benchmark::DoNotOptimize(registry.GetType("/Amazon/Gems"));
+        }
+    }
+
+    BENCHMARK_REGISTER_F(SettingsRegistrySnapshotBenchmarkFixture, MergeSettingsFolder)->Arg(16)->Arg(96)->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(SettingsRegistrySnapshotBenchmarkFixture, LoadSnapshot)->Arg(16)->Arg(96)->Unit(benchmark::kMicrosecond);
+} // namespace Benchmark
+#endif // HAVE_BENCHMARK
@@ -0,0 +1,341 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzTest/AzTest.h>
+#include <AzCore/IO/CompressionBus.h>
+#include <AzCore/IO/Streamer/ChunkedDecompressor.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <Tests/Streamer/StreamStackEntryConformityTests.h>
+#include <Tests/Streamer/StreamStackEntryMock.h>
+
+namespace AZ::IO
+{
+    class ChunkedDecompressorTestDescription :
+        public StreamStackEntryConformityTestsDescriptor<ChunkedDecompressor>
+    {
+    public:
+        static constexpr u32 m_arbitrarilyLargeAlignment = 4096;
+
+        ChunkedDecompressor CreateInstance() override
+        {
+            return ChunkedDecompressor(2, 2, m_arbitrarilyLargeAlignment);
+        }
+
+        void SetUp() override
+        {
+            AllocatorInstance<PoolAllocator>::Create();
+            AllocatorInstance<ThreadPoolAllocator>::Create();
+        }
+
+        void TearDown() override
+        {
+            AllocatorInstance<ThreadPoolAllocator>::Destroy();
+            AllocatorInstance<PoolAllocator>::Destroy();
+        }
+    };
+
+    INSTANTIATE_TYPED_TEST_CASE_P(
+        Streamer_ChunkedDecompressorConformityTests, StreamStackEntryConformityTests, ChunkedDecompressorTestDescription);
+
+    class Streamer_ChunkedDecompressorTest
+        : public UnitTest::AllocatorsFixture
+    {
+    public:
+        enum ReadResult
+        {
+            Success,
+            Failed
+        };
+
+        void SetUp() override
+        {
+            UnitTest::AllocatorsFixture::SetUp();
+
+            AllocatorInstance<PoolAllocator>::Create();
+            AllocatorInstance<ThreadPoolAllocator>::Create();
+        }
+
+        void TearDown() override
+        {
+            m_decompressor.reset();
+            m_mock.reset();
+
+            delete[] m_buffer;
+            m_buffer = nullptr;
+
+            delete m_context;
+            m_context = nullptr;
+
+            AllocatorInstance<ThreadPoolAllocator>::Destroy();
+            AllocatorInstance<PoolAllocator>::Destroy();
+
+            UnitTest::AllocatorsFixture::TearDown();
+        }
+
+        void SetupEnvironment(u32 maxNumReads, u32 maxNumJobs)
+        {
+            m_buffer = new u32[m_fakeFileLength >> 2];
+
+            m_mock = AZStd::make_shared<StreamStackEntryMock>();
+            m_decompressor = AZStd::make_shared<ChunkedDecompressor>(maxNumReads, maxNumJobs,
+                ChunkedDecompressorTestDescription::m_arbitrarilyLargeAlignment);
+
+            m_context = new StreamerContext();
+            m_decompressor->SetContext(*m_context);
+            m_decompressor->SetNext(m_mock);
+
+            // The fake compression only copies data, so the compressed and uncompressed offsets of the chunks are the same.
+            auto seekTable = AZStd::make_shared<CompressionSeekTable>();
+            for (u64 offset = 0; offset <= m_fakeFileLength; offset += m_fakeChunkLength)
+            {
+                seekTable->push_back(CompressionSeekPoint{ offset, offset });
+            }
+            m_seekTable = AZStd::move(seekTable);
+        }
+
+        void SetupEnvironment()
+        {
+            SetupEnvironment(1, 4);
+        }
+
+        void MockReadCalls(ReadResult mockResult, int numReads = 1)
+        {
+            using ::testing::_;
+            using ::testing::AnyNumber;
+            using ::testing::Return;
+
+            EXPECT_CALL(*m_mock, ExecuteRequests())
+                .WillOnce(Return(true))
+                .WillRepeatedly(Return(false));
+            EXPECT_CALL(*m_mock, QueueRequest(_)).Times(numReads);
+            EXPECT_CALL(*m_mock, UpdateStatus(_)).Times(AnyNumber());
+
+            ON_CALL(*m_mock, QueueRequest(_))
+                .WillByDefault(Invoke(this, mockResult == ReadResult::Success
+                    ? &Streamer_ChunkedDecompressorTest::PrepareReadRequest
+                    : &Streamer_ChunkedDecompressorTest::PrepareFailedReadRequest));
+        }
+
+        void PrepareReadRequest(FileRequest* request)
+        {
+            auto data = AZStd::get_if<FileRequest::ReadData>(&request->GetCommand());
+            ASSERT_NE(nullptr, data);
+            m_lastReadOffset = data->m_offset;
+            m_lastReadSize = data->m_size;
+
+            u64 size = data->m_size >> 2;
+            u32* buffer = reinterpret_cast<u32*>(data->m_output);
+            for (u64 i = 0; i < size; ++i)
+            {
+                buffer[i] = aznumeric_caster(data->m_offset + (i << 2));
+            }
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+        }
+
+        void PrepareFailedReadRequest(FileRequest* request)
+        {
+            request->SetStatus(IStreamerTypes::RequestStatus::Failed);
+            m_context->MarkRequestAsCompleted(request);
+        }
+
+        static bool Decompressor(const CompressionInfo&, const void* compressed, size_t compressedSize, void* uncompressed,
+            [[maybe_unused]] size_t uncompressedBufferSize)
+        {
+            AZ_Assert(compressedSize == uncompressedBufferSize, "Fake decompression algorithm only supports copying data.");
+            memcpy(uncompressed, compressed, compressedSize);
+            return true;
+        }
+
+        static bool CorruptedDecompressor(const CompressionInfo&, const void*, size_t, void*, size_t)
+        {
+            return false;
+        }
+
+        CompressionInfo CreateCompressionInfo(bool corrupted = false)
+        {
+            CompressionInfo compressionInfo;
+            compressionInfo.m_compressedSize = m_fakeFileLength;
+            compressionInfo.m_isCompressed = true;
+            compressionInfo.m_offset = 0;
+            compressionInfo.m_uncompressedSize = m_fakeFileLength;
+            compressionInfo.m_seekTable = m_seekTable;
+            compressionInfo.m_decompressor = corrupted
+                ? &Streamer_ChunkedDecompressorTest::CorruptedDecompressor
+                : &Streamer_ChunkedDecompressorTest::Decompressor;
+            return compressionInfo;
+        }
+
+        void RunUntilIdle()
+        {
+            bool hasCompleted = false;
+            while (m_decompressor->ExecuteRequests() || !hasCompleted)
+            {
+                StreamStackEntry::Status status;
+                m_decompressor->UpdateStatus(status);
+                if (status.m_isIdle)
+                {
+                    hasCompleted = true;
+                }
+
+                m_context->FinalizeCompletedRequests();
+            }
+        }
+
+        void ProcessCompressedRead(u64 offset, u64 size, bool corrupted, IStreamerTypes::RequestStatus expectedResult)
+        {
+            FileRequest* request = m_context->GetNewInternalRequest();
+            request->CreateCompressedRead(nullptr, CreateCompressionInfo(corrupted), m_buffer, offset, size);
+            bool result = true;
+            auto completed = [&result, expectedResult](const FileRequest& request)
+            {
+                result = result && request.GetStatus() == expectedResult;
+            };
+            request->SetCompletionCallback(completed);
+
+            m_decompressor->QueueRequest(request);
+            RunUntilIdle();
+
+            EXPECT_TRUE(result);
+        }
+
+        void VerifyReadBuffer(u32* buffer, u64 offset, u64 size)
+        {
+            size = size >> 2;
+            for (u64 i = 0; i < size; ++i)
+            {
+                // Using assert here because in case of a problem EXPECT would
+                // cause a large amount of log noise.
+                ASSERT_EQ(buffer[i], offset + (i << 2));
+            }
+        }
+
+        void VerifyReadBuffer(u64 offset, u64 size)
+        {
+            VerifyReadBuffer(m_buffer, offset, size);
+        }
+
+        u32* m_buffer{ nullptr };
+        StreamerContext* m_context{ nullptr };
+        AZStd::shared_ptr<ChunkedDecompressor> m_decompressor;
+        AZStd::shared_ptr<StreamStackEntryMock> m_mock;
+        AZStd::shared_ptr<const CompressionSeekTable> m_seekTable;
+        u64 m_fakeFileLength{ 1 * 1024 * 1024 };
+        u64 m_fakeChunkLength{ 64 * 1024 };
+        u64 m_lastReadOffset{ 0 };
+        u64 m_lastReadSize{ 0 };
+    };
+
+    TEST_F(Streamer_ChunkedDecompressorTest, DecompressedRead_FullReadAndDecompressData_SuccessfullyReadData)
+    {
+        SetupEnvironment();
+        MockReadCalls(ReadResult::Success);
+        ProcessCompressedRead(0, m_fakeFileLength, false, IStreamerTypes::RequestStatus::Completed);
+        VerifyReadBuffer(0, m_fakeFileLength);
+        EXPECT_EQ(0, m_lastReadOffset);
+        EXPECT_EQ(m_fakeFileLength, m_lastReadSize);
+    }
+
+    TEST_F(Streamer_ChunkedDecompressorTest, DecompressedRead_PartialReadSpanningChunks_OnlyReadsOverlappingChunks)
+    {
+        SetupEnvironment();
+        MockReadCalls(ReadResult::Success);
+        const u64 offset = m_fakeChunkLength + 256;
+        const u64 size = 5 * m_fakeChunkLength;
+        ProcessCompressedRead(offset, size, false, IStreamerTypes::RequestStatus::Completed);
+        VerifyReadBuffer(offset, size);
+        EXPECT_EQ(m_fakeChunkLength, m_lastReadOffset);
+        EXPECT_EQ(6 * m_fakeChunkLength, m_lastReadSize);
+    }
+
+    TEST_F(Streamer_ChunkedDecompressorTest, DecompressedRead_PartialReadInsideSingleChunk_OnlyReadsOneChunk)
+    {
+        SetupEnvironment();
+        MockReadCalls(ReadResult::Success);
+        const u64 offset = 3 * m_fakeChunkLength + 1024;
+        const u64 size = 2048;
+        ProcessCompressedRead(offset, size, false, IStreamerTypes::RequestStatus::Completed);
+        VerifyReadBuffer(offset, size);
+        EXPECT_EQ(3 * m_fakeChunkLength, m_lastReadOffset);
+        EXPECT_EQ(m_fakeChunkLength, m_lastReadSize);
+    }
+
+    TEST_F(Streamer_ChunkedDecompressorTest, DecompressedRead_FailedRead_RequestIsMarkedAsFailed)
+    {
+        SetupEnvironment();
+        MockReadCalls(ReadResult::Failed);
+        ProcessCompressedRead(0, m_fakeFileLength, false, IStreamerTypes::RequestStatus::Failed);
+    }
+
+    TEST_F(Streamer_ChunkedDecompressorTest, DecompressedRead_CorruptedChunk_RequestIsMarkedAsFailed)
+    {
+        SetupEnvironment();
+        MockReadCalls(ReadResult::Success);
+        ProcessCompressedRead(0, m_fakeFileLength, true, IStreamerTypes::RequestStatus::Failed);
+    }
+
+    TEST_F(Streamer_ChunkedDecompressorTest, DecompressedRead_MultipleRequests_AllRequestsCompleteSuccessfully)
+    {
+        static constexpr int count = 16;
+
+        SetupEnvironment(2, 4);
+        MockReadCalls(ReadResult::Success, count);
+
+        bool allCompleted = true;
+        auto completed = [&allCompleted](const FileRequest& request)
+        {
+            allCompleted = allCompleted && request.GetStatus() == IStreamerTypes::RequestStatus::Completed;
+        };
+
+        AZStd::unique_ptr<u32[]> buffers[count];
+        for (int i = 0; i < count; ++i)
+        {
+            buffers[i] = AZStd::unique_ptr<u32[]>(new u32[m_fakeFileLength >> 2]);
+            FileRequest* request = m_context->GetNewInternalRequest();
+            request->CreateCompressedRead(nullptr, CreateCompressionInfo(), buffers[i].get(), 0, m_fakeFileLength);
+            request->SetCompletionCallback(completed);
+            m_decompressor->QueueRequest(request);
+        }
+        RunUntilIdle();
+
+        EXPECT_TRUE(allCompleted);
+        for (int i = 0; i < count; ++i)
+        {
+            VerifyReadBuffer(buffers[i].get(), 0, m_fakeFileLength);
+        }
+    }
+
+    TEST_F(Streamer_ChunkedDecompressorTest, QueueRequest_CompressedReadWithoutSeekTable_ForwardedToNextEntry)
+    {
+        using ::testing::_;
+
+        SetupEnvironment();
+
+        CompressionInfo compressionInfo = CreateCompressionInfo();
+        compressionInfo.m_seekTable.reset();
+        FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateCompressedRead(nullptr, AZStd::move(compressionInfo), m_buffer, 0, m_fakeFileLength);
+
+        EXPECT_CALL(*m_mock, QueueRequest(request)).Times(1);
+        m_decompressor->QueueRequest(request);
+
+        StreamStackEntry::Status status;
+        EXPECT_CALL(*m_mock, UpdateStatus(_)).Times(1);
+        m_decompressor->UpdateStatus(status);
+        EXPECT_TRUE(status.m_isIdle);
+
+        m_context->RecycleRequest(request);
+    }
+} // namespace AZ::IO
@@ -0,0 +1,374 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/IStreamerTypes.h>
+#include <AzCore/IO/Streamer/ReadCoalescer.h>
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <Tests/FileIOBaseTestTypes.h>
+#include <Tests/Streamer/StreamStackEntryConformityTests.h>
+#include <Tests/Streamer/StreamStackEntryMock.h>
+
+namespace AZ::IO
+{
+    class ReadCoalescerTestDescription :
+        public StreamStackEntryConformityTestsDescriptor<ReadCoalescer>
+    {
+    public:
+        ReadCoalescer CreateInstance() override
+        {
+            return ReadCoalescer(64_kib, 4_kib, 16, AZCORE_GLOBAL_NEW_ALIGNMENT, 1_mib);
+        }
+    };
+
+    using ReadCoalescerTestTypes = ::testing::Types<ReadCoalescerTestDescription>;
+    INSTANTIATE_TYPED_TEST_CASE_P(Streamer_ReadCoalescerConformityTests, StreamStackEntryConformityTests, ReadCoalescerTestTypes);
+
+    class Streamer_ReadCoalescerTest
+        : public UnitTest::ScopedAllocatorSetupFixture
+    {
+    public:
+        static constexpr u64 MaxReadSize = 1_kib;
+        static constexpr u64 MaxGap = 64;
+        static constexpr u32 MaxBatchSize = 8;
+
+        Streamer_ReadCoalescerTest()
+            : m_mock(AZStd::make_shared<StreamStackEntryMock>())
+        {
+        }
+
+        void SetUp() override
+        {
+            m_prevFileIO = AZ::IO::FileIOBase::GetInstance();
+            AZ::IO::FileIOBase::SetInstance(&m_fileIO);
+
+            m_path.InitFromRelativePath("TestPath");
+            m_otherPath.InitFromRelativePath("OtherTestPath");
+        }
+
+        void TearDown() override
+        {
+            if (m_readCoalescer)
+            {
+                delete m_readCoalescer;
+                m_readCoalescer = nullptr;
+            }
+            AZ::IO::FileIOBase::SetInstance(m_prevFileIO);
+        }
+
+        void CreateReadCoalescer(size_t bufferSize = 4 * MaxReadSize)
+        {
+            using ::testing::_;
+            using ::testing::Return;
+
+            m_readCoalescer = new ReadCoalescer(MaxReadSize, MaxGap, MaxBatchSize, AZCORE_GLOBAL_NEW_ALIGNMENT, bufferSize);
+
+            m_readCoalescer->SetNext(m_mock);
+            EXPECT_CALL(*m_mock, SetContext(_));
+            m_readCoalescer->SetContext(m_context);
+            ON_CALL(*m_mock, ExecuteRequests()).WillByDefault(Return(false));
+        }
+
+        FileRequest* QueueRead(const RequestPath& path, void* output, u64 offset, u64 size)
+        {
+            FileRequest* readRequest = m_context.GetNewInternalRequest();
+            readRequest->CreateRead(nullptr, output, size, path, offset, size);
+            m_readCoalescer->QueueRequest(readRequest);
+            return readRequest;
+        }
+
+        // Fills the output of a read the mock received with the offsets into the file and completes it.
+        void CompleteRead(FileRequest* request)
+        {
+            FileRequest::ReadData* data = AZStd::get_if<FileRequest::ReadData>(&request->GetCommand());
+            ASSERT_NE(nullptr, data);
+            u8* output = reinterpret_cast<u8*>(data->m_output);
+            for (u64 i = 0; i < data->m_size; ++i)
+            {
+                output[i] = aznumeric_cast<u8>((data->m_offset + i) & 0xff);
+            }
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context.MarkRequestAsCompleted(request);
+        }
+
+        void VerifyOutput(const u8* output, u64 offset, u64 size)
+        {
+            for (u64 i = 0; i < size; ++i)
+            {
+                ASSERT_EQ(aznumeric_cast<u8>((offset + i) & 0xff), output[i]);
+            }
+        }
+
+    protected:
+        UnitTest::TestFileIOBase m_fileIO;
+        FileIOBase* m_prevFileIO{};
+        StreamerContext m_context;
+        RequestPath m_path;
+        RequestPath m_otherPath;
+        ReadCoalescer* m_readCoalescer{ nullptr };
+        AZStd::shared_ptr<StreamStackEntryMock> m_mock;
+    };
+
+    TEST_F(Streamer_ReadCoalescerTest, QueueRequest_SingleRead_ForwardedUnchangedOnExecute)
+    {
+        using ::testing::_;
+
+        CreateReadCoalescer();
+
+        u8 buffer[128];
+        EXPECT_CALL(*m_mock, QueueRequest(_)).Times(0);
+        FileRequest* readRequest = QueueRead(m_path, buffer, 0, sizeof(buffer));
+
+        EXPECT_CALL(*m_mock, QueueRequest(readRequest)).Times(1);
+        m_readCoalescer->ExecuteRequests();
+
+        m_context.RecycleRequest(readRequest);
+    }
+
+    TEST_F(Streamer_ReadCoalescerTest, QueueRequest_ContiguousReads_MergedIntoOneReadAndCopiedBack)
+    {
+        using ::testing::_;
+
+        CreateReadCoalescer();
+
+        u8 first[100];
+        u8 second[200];
+        u8 third[50];
+        QueueRead(m_path, second, 100, sizeof(second));
+        QueueRead(m_path, first, 0, sizeof(first));
+        QueueRead(m_path, third, 300, sizeof(third));
+
+        FileRequest* mergedRead{ nullptr };
+        EXPECT_CALL(*m_mock, QueueRequest(_))
+            .Times(1)
+            .WillOnce([&mergedRead](FileRequest* request) { mergedRead = request; });
+        m_readCoalescer->ExecuteRequests();
+
+        ASSERT_NE(nullptr, mergedRead);
+        FileRequest::ReadData* data = AZStd::get_if<FileRequest::ReadData>(&mergedRead->GetCommand());
+        ASSERT_NE(nullptr, data);
+        EXPECT_EQ(0, data->m_offset);
+        EXPECT_EQ(350, data->m_size);
+        EXPECT_EQ(m_path, data->m_path);
+
+        CompleteRead(mergedRead);
+        m_context.FinalizeCompletedRequests();
+
+        VerifyOutput(first, 0, sizeof(first));
+        VerifyOutput(second, 100, sizeof(second));
+        VerifyOutput(third, 300, sizeof(third));
+    }
+
+    TEST_F(Streamer_ReadCoalescerTest, QueueRequest_ReadsWithSmallGap_MergedAndGapIsSkipped)
+    {
+        using ::testing::_;
+
+        CreateReadCoalescer();
+
+        u8 first[100];
+        u8 second[100];
+        QueueRead(m_path, first, 0, sizeof(first));
+        QueueRead(m_path, second, sizeof(first) + MaxGap, sizeof(second));
+
+        FileRequest* mergedRead{ nullptr };
+        EXPECT_CALL(*m_mock, QueueRequest(_))
+            .Times(1)
+            .WillOnce([&mergedRead](FileRequest* request) { mergedRead = request; });
+        m_readCoalescer->ExecuteRequests();
+
+        ASSERT_NE(nullptr, mergedRead);
+        FileRequest::ReadData* data = AZStd::get_if<FileRequest::ReadData>(&mergedRead->GetCommand());
+        ASSERT_NE(nullptr, data);
+        EXPECT_EQ(sizeof(first) + MaxGap + sizeof(second), data->m_size);
+
+        CompleteRead(mergedRead);
+        m_context.FinalizeCompletedRequests();
+
+        VerifyOutput(first, 0, sizeof(first));
+        VerifyOutput(second, sizeof(first) + MaxGap, sizeof(second));
+    }
+
+    TEST_F(Streamer_ReadCoalescerTest, QueueRequest_ContiguousInFileAndMemory_ReadDirectlyIntoOutput)
+    {
+        using ::testing::_;
+
+        CreateReadCoalescer(0);
+
+        u8 buffer[300];
+        QueueRead(m_path, buffer, 0, 100);
+        QueueRead(m_path, buffer + 100, 100, 200);
+
+        FileRequest* mergedRead{ nullptr };
+        EXPECT_CALL(*m_mock, QueueRequest(_))
+            .Times(1)
+            .WillOnce([&mergedRead](FileRequest* request) { mergedRead = request; });
+        m_readCoalescer->ExecuteRequests();
+
+        ASSERT_NE(nullptr, mergedRead);
+        FileRequest::ReadData* data = AZStd::get_if<FileRequest::ReadData>(&mergedRead->GetCommand());
+        ASSERT_NE(nullptr, data);
+        EXPECT_EQ(buffer, data->m_output);
+        EXPECT_EQ(sizeof(buffer), data->m_size);
+
+        CompleteRead(mergedRead);
+        m_context.FinalizeCompletedRequests();
+
+        VerifyOutput(buffer, 0, sizeof(buffer));
+    }
+
+    TEST_F(Streamer_ReadCoalescerTest, QueueRequest_ReadsThatCanNotBeMerged_ForwardedSeparately)
+    {
+        using ::testing::_;
+
+        CreateReadCoalescer();
+
+        u8 first[100];
+        u8 second[100];
+        u8 third[100];
+        FileRequest* gapTooLarge = QueueRead(m_path, first, 0, sizeof(first));
+        FileRequest* farAway = QueueRead(m_path, second, sizeof(first) + MaxGap + 1, sizeof(second));
+        FileRequest* otherFile = QueueRead(m_otherPath, third, sizeof(first), sizeof(third));
+
+        AZStd::vector<FileRequest*> forwarded;
+        EXPECT_CALL(*m_mock, QueueRequest(_))
+            .Times(3)
+            .WillRepeatedly([&forwarded](FileRequest* request) { forwarded.push_back(request); });
+        m_readCoalescer->ExecuteRequests();
+
+        // Requests are forwarded in the order they were queued.
+        ASSERT_EQ(3, forwarded.size());
+        EXPECT_EQ(gapTooLarge, forwarded[0]);
+        EXPECT_EQ(farAway, forwarded[1]);
+        EXPECT_EQ(otherFile, forwarded[2]);
+
+        for (FileRequest* request : forwarded)
+        {
+            m_context.RecycleRequest(request);
+        }
+    }
+
+    TEST_F(Streamer_ReadCoalescerTest, QueueRequest_MergedReadFails_OriginalRequestsFail)
+    {
+        using ::testing::_;
+
+        CreateReadCoalescer();
+
+        u8 first[100];
+        u8 second[100];
+        FileRequest* firstRequest = QueueRead(m_path, first, 0, sizeof(first));
+        FileRequest* secondRequest = QueueRead(m_path, second, sizeof(first), sizeof(second));
+
+        IStreamerTypes::RequestStatus firstStatus = IStreamerTypes::RequestStatus::Pending;
+        IStreamerTypes::RequestStatus secondStatus = IStreamerTypes::RequestStatus::Pending;
+        firstRequest->SetCompletionCallback([&firstStatus](FileRequest& request) { firstStatus = request.GetStatus(); });
+        secondRequest->SetCompletionCallback([&secondStatus](FileRequest& request) { secondStatus = request.GetStatus(); });
+
+        FileRequest* mergedRead{ nullptr };
+        EXPECT_CALL(*m_mock, QueueRequest(_))
+            .Times(1)
+            .WillOnce([&mergedRead](FileRequest* request) { mergedRead = request; });
+        m_readCoalescer->ExecuteRequests();
+
+        ASSERT_NE(nullptr, mergedRead);
+        mergedRead->SetStatus(IStreamerTypes::RequestStatus::Failed);
+        m_context.MarkRequestAsCompleted(mergedRead);
+        m_context.FinalizeCompletedRequests();
+
+        EXPECT_EQ(IStreamerTypes::RequestStatus::Failed, firstStatus);
+        EXPECT_EQ(IStreamerTypes::RequestStatus::Failed, secondStatus);
+    }
+
+    TEST_F(Streamer_ReadCoalescerTest, QueueRequest_BatchIsFull_ReadsAreIssuedWithoutWaitingForExecute)
+    {
+        using ::testing::_;
+
+        CreateReadCoalescer();
+
+        u8 buffer[MaxBatchSize * 16];
+        FileRequest* mergedRead{ nullptr };
+        EXPECT_CALL(*m_mock, QueueRequest(_))
+            .Times(1)
+            .WillOnce([&mergedRead](FileRequest* request) { mergedRead = request; });
+        for (u32 i = 0; i < MaxBatchSize; ++i)
+        {
+            QueueRead(m_path, buffer + i * 16, i * 16, 16);
+        }
+
+        ASSERT_NE(nullptr, mergedRead);
+        CompleteRead(mergedRead);
+        m_context.FinalizeCompletedRequests();
+        VerifyOutput(buffer, 0, sizeof(buffer));
+    }
+
+    TEST_F(Streamer_ReadCoalescerTest, UpdateStatus_PendingReads_ReducesAvailableSlotsAndIsNotIdle)
+    {
+        using ::testing::_;
+
+        CreateReadCoalescer();
+        EXPECT_CALL(*m_mock, UpdateStatus(_)).WillRepeatedly([](StreamStackEntry::Status& status) { status.m_numAvailableSlots = 4; });
+
+        u8 buffer[32];
+        QueueRead(m_path, buffer, 0, 16);
+
+        StreamStackEntry::Status status;
+        m_readCoalescer->UpdateStatus(status);
+        EXPECT_EQ(3, status.m_numAvailableSlots);
+        EXPECT_FALSE(status.m_isIdle);
+
+        FileRequest* forwarded{ nullptr };
+        EXPECT_CALL(*m_mock, QueueRequest(_))
+            .WillOnce([&forwarded](FileRequest* request) { forwarded = request; });
+        m_readCoalescer->ExecuteRequests();
+        m_context.RecycleRequest(forwarded);
+    }
+
+    TEST_F(Streamer_ReadCoalescerTest, CollectStatistics_AfterMerge_ReportsMergeCounters)
+    {
+        using ::testing::_;
+
+        CreateReadCoalescer();
+
+        u8 first[100];
+        u8 second[100];
+        QueueRead(m_path, first, 0, sizeof(first));
+        QueueRead(m_path, second, sizeof(first), sizeof(second));
+
+        FileRequest* mergedRead{ nullptr };
+        EXPECT_CALL(*m_mock, QueueRequest(_))
+            .WillOnce([&mergedRead](FileRequest* request) { mergedRead = request; });
+        m_readCoalescer->ExecuteRequests();
+        CompleteRead(mergedRead);
+        m_context.FinalizeCompletedRequests();
+
+        EXPECT_CALL(*m_mock, CollectStatistics(_));
+        AZStd::vector<Statistic> statistics;
+        m_readCoalescer->CollectStatistics(statistics);
+
+        auto findStatistic = [&statistics](AZStd::string_view name) -> const Statistic*
+        {
+            for (const Statistic& statistic : statistics)
+            {
+                if (statistic.GetName() == name)
+                {
+                    return &statistic;
+                }
+            }
+            return nullptr;
+        };
+
+        const Statistic* numMerged = findStatistic("Num merged reads");
+        ASSERT_NE(nullptr, numMerged);
+        EXPECT_EQ(1, numMerged->GetIntegerValue());
+        const Statistic* numSaved = findStatistic("Num reads saved");
+        ASSERT_NE(nullptr, numSaved);
+        EXPECT_EQ(1, numSaved->GetIntegerValue());
+        const Statistic* mergedReads = findStatistic("Merged reads");
+        ASSERT_NE(nullptr, mergedReads);
+        EXPECT_DOUBLE_EQ(100.0, mergedReads->GetPercentage());
+    }
+} // namespace AZ::IO
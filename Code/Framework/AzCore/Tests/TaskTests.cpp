@@ -8,6 +8,10 @@
 
 #include <AzCore/Task/TaskGraph.h>
 #include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
 #include <AzCore/Memory/PoolAllocator.h>
 
 #include <AzCore/UnitTest/TestTypes.h>
@@ -543,6 +547,227 @@ namespace UnitTest
 
         EXPECT_EQ(3 | 0b100000, x);
     }
+
+    TEST_F(TaskGraphTestFixture, LargeForkJoin)
+    {
+        constexpr int taskCount = 10000;
+        AZStd::atomic<int> x = 0;
+        AZStd::atomic<int> result = 0;
+
+        TaskGraph graph;
+        auto fork = graph.AddTask(
+            defaultTD,
+            [&]
+            {
+                x = 0;
+            });
+        auto join = graph.AddTask(
+            defaultTD,
+            [&]
+            {
+                result = x.load();
+            });
+
+        for (int i = 0; i != taskCount; ++i)
+        {
+            auto token = graph.AddTask(
+                defaultTD,
+                [&]
+                {
+                    ++x;
+                });
+            fork.Precedes(token);
+            token.Precedes(join);
+        }
+
+        // Resubmit a few times so tasks are spread over (and stolen from) different workers each time
+        for (int i = 0; i != 4; ++i)
+        {
+            result = 0;
+            TaskGraphEvent ev;
+            graph.SubmitOnExecutor(*m_executor, &ev);
+            ev.Wait();
+
+            EXPECT_EQ(taskCount, result);
+        }
+    }
+
+    TEST_F(TaskGraphTestFixture, PrioritiesAndAffinity)
+    {
+        constexpr int tasksPerKind = 64;
+        AZStd::atomic<int> x = 0;
+
+        TaskGraph graph;
+        auto root = graph.AddTask(
+            defaultTD,
+            [&]
+            {
+                x = 0;
+            });
+
+        for (uint8_t priority = 0; priority != static_cast<uint8_t>(TaskPriority::PRIORITY_COUNT); ++priority)
+        {
+            // Unrestricted, restricted to a single worker and restricted to workers that don't exist (ignored)
+            for (uint64_t cpuMask : { 0ull, 0b10ull, 0xf0000000ull, 0xf000000000000000ull })
+            {
+                TaskDescriptor descriptor{ "TaskGraphTestTask", "TaskGraphTests", static_cast<TaskPriority>(priority), cpuMask };
+                for (int i = 0; i != tasksPerKind; ++i)
+                {
+                    auto token = graph.AddTask(
+                        descriptor,
+                        [&]
+                        {
+                            ++x;
+                        });
+                    root.Precedes(token);
+                }
+            }
+        }
+
+        TaskGraphEvent ev;
+        graph.SubmitOnExecutor(*m_executor, &ev);
+        ev.Wait();
+
+        EXPECT_EQ(tasksPerKind * 4 * static_cast<int>(TaskPriority::PRIORITY_COUNT), x);
+    }
+
+    TEST_F(TaskGraphTestFixture, AffinityWithMoreWorkersThanMaskBits)
+    {
+        constexpr int tasksPerKind = 16;
+        AZStd::atomic<int> x = 0;
+
+        TaskExecutor executor(TaskExecutor::MaxMaskableWorkers + 2);
+        TaskGraph graph;
+        auto root = graph.AddTask(
+            defaultTD,
+            [&]
+            {
+                x = 0;
+            });
+
+        // Unrestricted, every maskable worker, and the highest and lowest maskable workers
+        for (uint64_t cpuMask : { 0ull, ~0ull, 1ull << 63, 1ull })
+        {
+            TaskDescriptor descriptor{ "TaskGraphTestTask", "TaskGraphTests", TaskPriority::MEDIUM, cpuMask };
+            for (int i = 0; i != tasksPerKind; ++i)
+            {
+                auto token = graph.AddTask(
+                    descriptor,
+                    [&]
+                    {
+                        ++x;
+                    });
+                root.Precedes(token);
+            }
+        }
+
+        TaskGraphEvent ev;
+        graph.SubmitOnExecutor(executor, &ev);
+        ev.Wait();
+
+        EXPECT_EQ(tasksPerKind * 4, x);
+    }
+
+    TEST_F(TaskGraphTestFixture, CompiledGraphResubmission)
+    {
+        AZStd::atomic<int> x = 0;
+
+        TaskGraph graph;
+        auto a = graph.AddTask(
+            defaultTD,
+            [&]
+            {
+                x = 1;
+            });
+        auto b = graph.AddTask(
+            defaultTD,
+            [&]
+            {
+                x = x * 3;
+            });
+        auto c = graph.AddTask(
+            defaultTD,
+            [&]
+            {
+                x += 2;
+            });
+        a.Precedes(b);
+        b.Precedes(c);
+
+        EXPECT_FALSE(graph.IsCompiled());
+        graph.Compile();
+        EXPECT_TRUE(graph.IsCompiled());
+        EXPECT_TRUE(graph.IsSettled());
+
+        // Dependency counters are rearmed in place, so every submission has to honor the full chain
+        for (int i = 0; i != 100; ++i)
+        {
+            x = 0;
+            TaskGraphEvent ev;
+            graph.SubmitOnExecutor(*m_executor, &ev);
+            ev.Wait();
+
+            EXPECT_EQ(5, x);
+            EXPECT_TRUE(graph.IsSettled());
+        }
+
+        // After a reset the graph can be recorded again
+        graph.Reset();
+        EXPECT_FALSE(graph.IsCompiled());
+        graph.AddTask(
+            defaultTD,
+            [&]
+            {
+                x = 42;
+            });
+        TaskGraphEvent ev;
+        graph.SubmitOnExecutor(*m_executor, &ev);
+        ev.Wait();
+        EXPECT_EQ(42, x);
+    }
+
+    TEST_F(TaskGraphTestFixture, CompiledGraphResubmission_WhenSettled)
+    {
+        AZStd::atomic<int> x = 0;
+
+        TaskGraph graph;
+        auto a = graph.AddTask(
+            defaultTD,
+            [&]
+            {
+                ++x;
+            });
+        auto b = graph.AddTask(
+            defaultTD,
+            [&]
+            {
+                ++x;
+            });
+        a.Precedes(b);
+
+        // A settled graph is done with the previous wait event, which must have been signaled by then
+        for (int i = 0; i != 1000; ++i)
+        {
+            TaskGraphEvent ev;
+            graph.SubmitOnExecutor(*m_executor, &ev);
+            while (!graph.IsSettled())
+            {
+                AZStd::this_thread::yield();
+            }
+            EXPECT_TRUE(ev.IsSignaled());
+        }
+
+        EXPECT_EQ(2000, x);
+    }
+
+    TEST_F(TaskGraphTestFixture, EmptyGraph_SignalsImmediately)
+    {
+        TaskGraph graph;
+        TaskGraphEvent ev;
+        graph.SubmitOnExecutor(*m_executor, &ev);
+        EXPECT_TRUE(ev.IsSignaled());
+        EXPECT_TRUE(graph.IsSettled());
+    }
 } // namespace UnitTest
 
 #if defined(HAVE_BENCHMARK)
@@ -638,5 +863,161 @@ namespace Benchmark
             ev.Wait();
         }
     }
+
+    // Fine-grained fork/join: one task fans out to 10k tiny tasks which all feed into a join task.
+    // The same workload is run through the JobManager below for comparison.
+    BENCHMARK_F(TaskGraphBenchmarkFixture, ForkJoin10k)(benchmark::State& state)
+    {
+        constexpr int taskCount = 10000;
+        AZStd::atomic<int> x = 0;
+
+        auto fork = graph->AddTask(
+            descriptors[2],
+            []
+            {
+            });
+        auto join = graph->AddTask(
+            descriptors[2],
+            []
+            {
+            });
+        for (int i = 0; i != taskCount; ++i)
+        {
+            auto token = graph->AddTask(
+                descriptors[2],
+                [&x]
+                {
+                    x.fetch_add(1, AZStd::memory_order_relaxed);
+                });
+            fork.Precedes(token);
+            token.Precedes(join);
+        }
+
+        for (auto _ : state)
+        {
+            TaskGraphEvent ev;
+            graph->SubmitOnExecutor(*executor, &ev);
+            ev.Wait();
+        }
+        state.SetItemsProcessed(state.iterations() * taskCount);
+    }
+
+    // A small frame-pipeline-shaped graph: a chain of stages, each fanning out to a few tasks
+    static void BuildPipeline(TaskGraph& graph, const TaskDescriptor& descriptor)
+    {
+        constexpr int stageCount = 8;
+        constexpr int tasksPerStage = 4;
+
+        // TaskTokens can't be reassigned, so keep the join task of every stage around
+        AZStd::vector<AZ::TaskToken> joins;
+        joins.reserve(stageCount + 1);
+        joins.push_back(graph.AddTask(
+            descriptor,
+            []
+            {
+            }));
+        for (int stage = 0; stage != stageCount; ++stage)
+        {
+            AZ::TaskToken previous = joins.back();
+            joins.push_back(graph.AddTask(
+                descriptor,
+                []
+                {
+                }));
+            for (int i = 0; i != tasksPerStage; ++i)
+            {
+                auto token = graph.AddTask(
+                    descriptor,
+                    []
+                    {
+                    });
+                previous.Precedes(token);
+                token.Precedes(joins.back());
+            }
+        }
+    }
+
+    // Per-submit overhead of a graph that is compiled once and resubmitted
+    BENCHMARK_F(TaskGraphBenchmarkFixture, PipelineCompiledOnce)(benchmark::State& state)
+    {
+        BuildPipeline(*graph, descriptors[2]);
+        graph->Compile();
+
+        for (auto _ : state)
+        {
+            TaskGraphEvent ev;
+            graph->SubmitOnExecutor(*executor, &ev);
+            ev.Wait();
+        }
+    }
+
+    // Same graph recorded and compiled for every submission
+    BENCHMARK_F(TaskGraphBenchmarkFixture, PipelineRebuiltEverySubmit)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            TaskGraph frameGraph;
+            BuildPipeline(frameGraph, descriptors[2]);
+            frameGraph.Detach();
+
+            TaskGraphEvent ev;
+            frameGraph.SubmitOnExecutor(*executor, &ev);
+            ev.Wait();
+        }
+    }
+
+    class JobManagerForkJoinBenchmarkFixture : public ::benchmark::Fixture
+    {
+    public:
+        void SetUp(benchmark::State&) override
+        {
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+
+            AZ::JobManagerDesc desc;
+            AZ::JobManagerThreadDesc threadDesc;
+            for (uint32_t i = 0; i != AZStd::thread::hardware_concurrency(); ++i)
+            {
+                desc.m_workerThreads.push_back(threadDesc);
+            }
+            jobManager = new AZ::JobManager(desc);
+            jobContext = new AZ::JobContext(*jobManager);
+        }
+
+        void TearDown(benchmark::State&) override
+        {
+            delete jobContext;
+            delete jobManager;
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+        }
+
+        AZ::JobManager* jobManager;
+        AZ::JobContext* jobContext;
+    };
+
+    BENCHMARK_F(JobManagerForkJoinBenchmarkFixture, ForkJoin10k)(benchmark::State& state)
+    {
+        constexpr int taskCount = 10000;
+        AZStd::atomic<int> x = 0;
+
+        for (auto _ : state)
+        {
+            AZ::JobCompletion join(jobContext);
+            for (int i = 0; i != taskCount; ++i)
+            {
+                AZ::Job* job = AZ::CreateJobFunction(
+                    [&x]
+                    {
+                        x.fetch_add(1, AZStd::memory_order_relaxed);
+                    },
+                    true, jobContext);
+                job->SetDependent(&join);
+                job->Start();
+            }
+            join.StartAndWaitForCompletion();
+        }
+        state.SetItemsProcessed(state.iterations() * taskCount);
+    }
 } // namespace Benchmark
 #endif
@@ -71,6 +71,7 @@ set(FILES
     XML.cpp
     Debug/AssetTracking.cpp
     Debug/LocalFileEventLoggerTests.cpp
+    Debug/ProfileTracerTests.cpp
     Debug/Trace.cpp
     Name/NameJsonSerializerTests.cpp
     Name/NameTests.cpp
@@ -81,10 +82,12 @@ set(FILES
     Settings/SettingsRegistryConsoleUtilsTests.cpp
     Settings/SettingsRegistryScriptUtilsTests.cpp
     Streamer/BlockCacheTests.cpp
+    Streamer/ChunkedDecompressorTests.cpp
     Streamer/DedicatedCacheTests.cpp
     Streamer/FullDecompressorTests.cpp
     Streamer/IStreamerMock.h
     Streamer/IStreamerTypesMock.h
+    Streamer/ReadCoalescerTests.cpp
     Streamer/ReadSplitterTests.cpp
     Streamer/SchedulerTests.cpp
     Streamer/StreamStackEntryConformityTests.h
@@ -166,6 +169,7 @@ set(FILES
     Math/Vector4PerformanceTests.cpp
     Math/Vector4Tests.cpp
     Memory/AllocatorManager.cpp
+    Memory/FrameArenaAllocator.cpp
     Memory/HphaSchema.cpp
     Memory/HphaSchemaErrorDetection.cpp
     Memory/LeakDetection.cpp
@@ -16,6 +16,8 @@
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/IO/SystemFile.h>
+#include <AzCore/Jobs/Algorithms.h>
+#include <AzCore/Jobs/JobManagerBus.h>
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/Utils.h>
@@ -56,6 +58,8 @@ namespace AZ::IO
     AZ_CVAR(int32_t, az_archive_verbosity, 0, nullptr, AZ::ConsoleFunctorFlags::Null,
         "Sets the verbosity level for logging Archive operations\n"
         ">=1 - Turns on verbose logging of all operations");
+    AZ_CVAR(bool, az_archive_parallel_mount, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "If set, the archives matching a wildcard are opened on the job system, if there's one");
 }
 
 namespace AZ::IO::ArchiveInternal
@@ -1401,6 +1405,21 @@ namespace AZ::IO
 
     bool Archive::OpenPackCommon(AZStd::string_view szBindRoot, AZStd::string_view szFullPath, uint32_t nArchiveFlags,
         AZStd::intrusive_ptr<AZ::IO::MemoryBlock> pData, bool addLevels)
+    {
+        PackDesc desc;
+        if (!OpenPackArchive(szBindRoot, szFullPath, nArchiveFlags, AZStd::move(pData), desc))
+        {
+            return false;
+        }
+        if (desc.pArchive)
+        {
+            AddOpenedPack(desc, nArchiveFlags, addLevels);
+        }
+        return true;
+    }
+
+    bool Archive::OpenPackArchive(AZStd::string_view szBindRoot, AZStd::string_view szFullPath, uint32_t nArchiveFlags,
+        AZStd::intrusive_ptr<AZ::IO::MemoryBlock> pData, PackDesc& desc)
     {
         // Note this will replace @devassets@ with @assets@ to provide a proper bind root for the archives
         auto conversionResult = ArchiveInternal::ConvertAbsolutePathToAliasedPath(szBindRoot);
@@ -1412,7 +1431,6 @@ namespace AZ::IO
         }
 
         // setup PackDesc before the duplicate test
-        PackDesc desc;
         desc.strFileName = szFullPath;
 
         if (!conversionResult || conversionResult->empty())
@@ -1439,7 +1457,7 @@ namespace AZ::IO
                 const char* pFilePath = it->pZip->GetFilePath();
                 if (pFilePath == desc.strFileName && it->m_pathBindRoot == desc.m_pathBindRoot)
                 {
-                    return true; // already opened
+                    return true; // already opened, the archive of the desc stays empty
                 }
             }
         }
@@ -1487,7 +1505,11 @@ namespace AZ::IO
 
         AZ_TracePrintf("Archive", "Opening archive file %.*s\n", aznumeric_cast<int>(szFullPath.size()), szFullPath.data());
         desc.pZip = static_cast<NestedArchive*>(desc.pArchive.get())->GetCache();
+        return true;
+    }
 
+    void Archive::AddOpenedPack(PackDesc& desc, uint32_t nArchiveFlags, bool addLevels)
+    {
         AZStd::unique_lock lock(m_csZips);
         // Insert the archive lexically but before any override archives
         // This allows us to order the archives allowing the later archives
@@ -1562,8 +1584,6 @@ namespace AZ::IO
         {
             archiveNotifications->BundleOpened(bundleName, bundleManifest, nextBundle, bundleCatalog);
         }, desc.strFileName.c_str(), bundleManifest, nextBundle.data(), bundleCatalog);
-
-        return true;
     }
 
 
@@ -1698,13 +1718,48 @@ namespace AZ::IO
             // Open files in alphabet order.
             AZStd::sort(files.begin(), files.end());
             bool bAllOk = true;
-            for (const AZStd::string& file : files)
+
+            AZ::JobContext* jobContext = nullptr;
+            if (az_archive_parallel_mount && files.size() > 1)
             {
-                bAllOk = OpenPackCommon(szDir, file, nArchiveFlags, nullptr, addLevels) && bAllOk;
+                AZ::JobManagerBus::BroadcastResult(jobContext, &AZ::JobManagerEvents::GetGlobalContext);
+            }
 
-                if (pFullPaths)
+            if (jobContext)
+            {
+                // Reading the central directories of the archives is independent, so that's done in parallel. The archives are
+                // still added in alphabet order afterwards, so the priority of the archives doesn't change.
+                AZStd::vector<PackDesc> descs(files.size());
+                AZStd::vector<uint8_t> opened(files.size());
+                AZ::parallel_for(size_t{ 0 }, files.size(), [this, &szDir, &files, nArchiveFlags, &descs, &opened](size_t index)
+                {
+                    opened[index] = OpenPackArchive(szDir, files[index], nArchiveFlags, nullptr, descs[index]);
+                }, jobContext);
+
+                for (size_t index = 0; index < files.size(); ++index)
+                {
+                    if (opened[index] && descs[index].pArchive)
+                    {
+                        AddOpenedPack(descs[index], nArchiveFlags, addLevels);
+                    }
+                    bAllOk = opened[index] && bAllOk;
+
+                    if (pFullPaths)
+                    {
+                        pFullPaths->emplace_back(files[index].begin(), files[index].end());
+                    }
+                }
+            }
+            else
+            {
+                for (const AZStd::string& file : files)
                 {
-                    pFullPaths->emplace_back(file.begin(), file.end());
+                    bAllOk = OpenPackCommon(szDir, file, nArchiveFlags, nullptr, addLevels) && bAllOk;
+
+                    if (pFullPaths)
+                    {
+                        pFullPaths->emplace_back(file.begin(), file.end());
+                    }
                 }
             }
 
@@ -2546,6 +2601,11 @@ namespace AZ::IO
                     size_t nSizeUncompressed = uncompressedBufferSize;
                     return ZipDir::ZipRawUncompress(uncompressed, &nSizeUncompressed, compressed, compressedSize) == 0;
                 };
+                if (info.m_isCompressed)
+                {
+                    // Files compressed in chunks are decompressed one chunk at a time with the same decompressor.
+                    info.m_seekTable = archive->GetSeekTable(entry);
+                }
             }
         }
     }
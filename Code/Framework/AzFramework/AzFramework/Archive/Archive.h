@@ -311,6 +311,11 @@ namespace AZ::IO
     private:
 
         bool OpenPackCommon(AZStd::string_view szBindRoot, AZStd::string_view pName, uint32_t nArchiveFlags, AZStd::intrusive_ptr<AZ::IO::MemoryBlock> pData = nullptr, bool addLevels = true);
+        // opens the archive of a pack and fills in the pack description, without adding the pack yet. This can be called from
+        // several threads at once. Returns true without opening the archive if the pack is already open.
+        bool OpenPackArchive(AZStd::string_view szBindRoot, AZStd::string_view pName, uint32_t nArchiveFlags, AZStd::intrusive_ptr<AZ::IO::MemoryBlock> pData, PackDesc& desc);
+        // adds a pack opened with OpenPackArchive to the packs that are searched for files
+        void AddOpenedPack(PackDesc& desc, uint32_t nArchiveFlags, bool addLevels);
         bool OpenPacksCommon(AZStd::string_view szDir, AZStd::string_view pWildcardIn, uint32_t nArchiveFlags, AZStd::vector<AZ::IO::FixedMaxPathString>* pFullPaths = nullptr, bool addLevels = true);
 
         ZipDir::FileEntry* FindPakFileEntry(AZStd::string_view szPath) const;
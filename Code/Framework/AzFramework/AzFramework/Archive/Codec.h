@@ -19,10 +19,12 @@ namespace CompressionCodec
         ZLIB = 0,
         ZSTD,
         LZ4,
+        // zstd compressed in independent chunks with a seek table, so the chunks can be decompressed in parallel
+        ZSTD_SEEKABLE,
         NUM_CODECS
     };
 
-    inline constexpr Codec s_AllCodecs[] = { Codec::ZLIB, Codec::ZSTD, Codec::LZ4 };
+    inline constexpr Codec s_AllCodecs[] = { Codec::ZLIB, Codec::ZSTD, Codec::LZ4, Codec::ZSTD_SEEKABLE };
 
     inline bool CheckMagic(const void* pCompressedData, const uint32_t magicNumber, const uint32_t magicSkippable)
     {
@@ -146,6 +146,13 @@ namespace AZ::IO
         //   Deletes all files and directories in the archive.
         virtual int RemoveAll() = 0;
 
+        // Summary:
+        //   Writes the pre-built directory index of the files in the archive, which makes opening the archive faster.
+        // Description:
+        //   The archive is compacted first if needed. Any later change to the archive makes the index stale, in which
+        //   case it's ignored when the archive is opened, until the index is written again.
+        virtual int WriteDirectoryIndex() = 0;
+
         // Summary:
         //   Finds the file; you don't have to close the returned handle.
         // Returns:
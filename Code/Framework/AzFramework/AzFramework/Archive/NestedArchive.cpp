@@ -94,6 +94,15 @@ namespace AZ::IO
         return m_pCache->RemoveAll();
     }
 
+    int NestedArchive::WriteDirectoryIndex()
+    {
+        if (m_nFlags & FLAGS_READ_ONLY)
+        {
+            return ZipDir::ZD_ERROR_INVALID_CALL;
+        }
+        return m_pCache->WriteDirectoryIndex();
+    }
+
     //////////////////////////////////////////////////////////////////////////
     // Adds a new file to the zip or update an existing one
     // adds a directory (creates several nested directories if needed)
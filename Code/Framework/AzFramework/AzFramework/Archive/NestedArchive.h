@@ -68,6 +68,9 @@ namespace AZ::IO
         // deletes all files from the archive
         int RemoveAll();
 
+        // writes the pre-built directory index of the files in the archive
+        int WriteDirectoryIndex() override;
+
         // finds the file; you don't have to close the returned handle
         Handle FindFile(AZStd::string_view szRelativePath);
 
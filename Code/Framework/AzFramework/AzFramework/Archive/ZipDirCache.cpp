@@ -10,6 +10,8 @@
 #include <AzCore/Console/Console.h>
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/sort.h>
 #include <AzCore/std/string/conversions.h>
 
 #include <AzFramework/Archive/ZipFileFormat.h>
@@ -19,6 +21,7 @@
 #include <AzFramework/Archive/ZipDirCache.h>
 #include <AzFramework/Archive/ZipDirCacheFactory.h>
 #include <AzFramework/Archive/ZipDirFind.h>
+#include <AzFramework/Archive/ZipDirIndex.h>
 #include <AzFramework/IO/FileOperations.h>
 
 #include <locale>
@@ -157,6 +160,7 @@ namespace AZ::IO::ZipDir
 
     void Cache::Close()
     {
+        ClearSeekTables();
         if (m_fileHandle != AZ::IO::InvalidHandle)
         {
             if (!(m_nFlags & FLAGS_READ_ONLY))
@@ -248,6 +252,8 @@ namespace AZ::IO::ZipDir
             return ZSTD_compressBound(uncompressedSize);
         case CompressionCodec::Codec::LZ4:
             return LZ4F_compressFrameBound(uncompressedSize, nullptr);
+        case CompressionCodec::Codec::ZSTD_SEEKABLE:
+            return ZSTDSeekableCompressBound(uncompressedSize);
         default:
             AZ_Assert(false, "Unknown codec passed in for size estimate");
             break;
@@ -259,6 +265,7 @@ namespace AZ::IO::ZipDir
     // adds a directory (creates several nested directories if needed)
     ErrorEnum Cache::UpdateFile(AZStd::string_view szRelativePathSrc, const void* pUncompressed, uint64_t nSize, uint32_t nCompressionMethod, int nCompressionLevel, CompressionCodec::Codec codec)
     {
+        ClearSeekTables();
         AZStd::intrusive_ptr<AZ::IO::MemoryBlock> memoryBlock;
 
         // we'll need the compressed data
@@ -292,6 +299,12 @@ namespace AZ::IO::ZipDir
             case CompressionCodec::Codec::LZ4:
                 nError = ZipRawCompressLZ4(pUncompressed, &nSizeCompressed, pCompressed, nSize, nCompressionLevel);
                 break;
+
+            case CompressionCodec::Codec::ZSTD_SEEKABLE:
+                nError = ZipRawCompressZSTDSeekable(pUncompressed, &nSizeCompressed, pCompressed, nSize, nCompressionLevel);
+                // recorded as zstd so readers can tell the entries with a seek table apart without touching the data
+                nCompressionMethod = ZipFile::METHOD_ZSTD;
+                break;
             }
             if (Z_OK != nError)
             {
@@ -404,6 +417,7 @@ namespace AZ::IO::ZipDir
     //   Adds a new file to the zip or update an existing one if it is not compressed - just stored  - start a big file
     ErrorEnum Cache::StartContinuousFileUpdate(AZStd::string_view szRelativePathSrc, uint64_t nSize)
     {
+        ClearSeekTables();
         AZ::IO::MemoryBlock memoryBlock;
 
         // create or find the file entry.. this object will rollback (delete the object
@@ -489,6 +503,7 @@ namespace AZ::IO::ZipDir
     // adds a directory (creates several nested directories if needed)
     ErrorEnum Cache::UpdateFileContinuousSegment(AZStd::string_view szRelativePathSrc, [[maybe_unused]] uint64_t nSize, const void* pUncompressed, uint64_t nSegmentSize, uint64_t nOverwriteSeekPos)
     {
+        ClearSeekTables();
         const bool shouldOverwriteSeekOffset = nOverwriteSeekPos != (std::numeric_limits<uint64_t>::max)();
         AZ::IO::MemoryBlock memoryBlock;
 
@@ -587,6 +602,7 @@ namespace AZ::IO::ZipDir
     // deletes the file from the archive
     ErrorEnum Cache::RemoveFile(AZStd::string_view szRelativePathSrc)
     {
+        ClearSeekTables();
         // Normalize and lower case the relative path
         AZ::IO::PathString szRelativePath{ szRelativePathSrc };
         AZ::StringFunc::Path::Normalize(szRelativePath);
@@ -635,6 +651,7 @@ namespace AZ::IO::ZipDir
     // deletes the directory, with all its descendants (files and subdirs)
     ErrorEnum Cache::RemoveDir(AZStd::string_view szRelativePathSrc)
     {
+        ClearSeekTables();
         // Normalize and lower case the relative path
         AZ::IO::PathString szRelativePath{ szRelativePathSrc };
         AZ::StringFunc::Path::Normalize(szRelativePath);
@@ -682,6 +699,7 @@ namespace AZ::IO::ZipDir
     // deletes all files and directories in this archive
     ErrorEnum Cache::RemoveAll()
     {
+        ClearSeekTables();
         ErrorEnum e = m_treeDir.RemoveAll();
         if (e == ZD_ERROR_SUCCESS)
         {
@@ -765,6 +783,66 @@ namespace AZ::IO::ZipDir
     }
 
 
+    AZStd::shared_ptr<const AZ::IO::CompressionSeekTable> Cache::GetSeekTable(FileEntry* pFileEntry)
+    {
+        // only seekable zstd entries have a seek table, skip reading the footer of everything else
+        if (!pFileEntry || pFileEntry->nMethod != ZipFile::METHOD_ZSTD || pFileEntry->desc.lSizeCompressed <= ZSTDSeekTableFooterSize)
+        {
+            return {};
+        }
+
+        AZStd::scoped_lock lock(m_seekTablesLock);
+        auto seekTableIt = m_seekTables.find(pFileEntry);
+        if (seekTableIt == m_seekTables.end())
+        {
+            seekTableIt = m_seekTables.emplace(pFileEntry, ReadSeekTable(pFileEntry)).first;
+        }
+        return seekTableIt->second;
+    }
+
+    AZStd::shared_ptr<const AZ::IO::CompressionSeekTable> Cache::ReadSeekTable(FileEntry* pFileEntry)
+    {
+        if (Refresh(pFileEntry) != ZD_ERROR_SUCCESS)
+        {
+            return {};
+        }
+
+        AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetDirectInstance();
+        AZStd::scoped_lock lock(pFileEntry->m_readLock);
+
+        // the footer at the end of the compressed data tells if there's a seek table and how large it is
+        const uint64_t dataEnd = uint64_t{ pFileEntry->nFileDataOffset } + pFileEntry->desc.lSizeCompressed;
+        uint8_t footer[ZSTDSeekTableFooterSize];
+        if (!fileIO->Seek(m_fileHandle, dataEnd - ZSTDSeekTableFooterSize, AZ::IO::SeekType::SeekFromStart) ||
+            !fileIO->Read(m_fileHandle, footer, sizeof(footer), true))
+        {
+            return {};
+        }
+
+        const size_t seekTableSize = GetZSTDSeekTableSize(footer);
+        if (seekTableSize == 0 || seekTableSize >= pFileEntry->desc.lSizeCompressed)
+        {
+            return {};
+        }
+
+        AZStd::vector<uint8_t> seekTableData(seekTableSize);
+        auto seekTable = AZStd::make_shared<AZ::IO::CompressionSeekTable>();
+        if (!fileIO->Seek(m_fileHandle, dataEnd - seekTableSize, AZ::IO::SeekType::SeekFromStart) ||
+            !fileIO->Read(m_fileHandle, seekTableData.data(), seekTableSize, true) ||
+            !ParseZSTDSeekTable(seekTableData.data(), seekTableSize, pFileEntry->desc.lSizeCompressed,
+                pFileEntry->desc.lSizeUncompressed, *seekTable))
+        {
+            return {};
+        }
+        return seekTable;
+    }
+
+    void Cache::ClearSeekTables()
+    {
+        AZStd::scoped_lock lock(m_seekTablesLock);
+        m_seekTables.clear();
+    }
+
     //////////////////////////////////////////////////////////////////////////
     // finds the file by exact path
     FileEntry* Cache::FindFile(AZStd::string_view szPathSrc, [[maybe_unused]] bool bFullInfo)
@@ -841,6 +919,103 @@ namespace AZ::IO::ZipDir
         return success;
     }
 
+    ErrorEnum Cache::WriteDirectoryIndex()
+    {
+        if (m_nFlags & FLAGS_READ_ONLY)
+        {
+            return ZD_ERROR_INVALID_CALL;
+        }
+        if (m_encryptedHeaders != ZipFile::HEADERS_NOT_ENCRYPTED)
+        {
+            return ZD_ERROR_UNSUPPORTED;
+        }
+
+        // a previous index describes the old directory, it's replaced
+        RemoveFile(DirectoryIndex::FileName);
+
+        // compact the archive first, compaction moves the files and would make the index stale again
+        if ((m_nFlags & FLAGS_UNCOMPACTED) && !(m_nFlags & FLAGS_DONT_COMPACT))
+        {
+            if (!RelinkZip())
+            {
+                return ZD_ERROR_IO_FAILED;
+            }
+            m_nFlags &= ~FLAGS_UNCOMPACTED;
+        }
+
+        // create the CDR records exactly as they're written for the files in the archive, as the index is only valid
+        // for those records
+        FileRecordList arrFiles(GetRoot());
+        const size_t nSizeCDR = arrFiles.GetStats().nSizeCDR;
+        AZStd::vector<uint8_t> cdrBuffer(nSizeCDR);
+        const size_t nSizeCDRRecords = arrFiles.MakeZipCDR(m_lCDROffset, cdrBuffer.data()) - sizeof(ZipFile::CDREnd);
+
+        struct IndexedFile
+        {
+            AZStd::string m_path;
+            size_t m_dirLength{};
+            FileEntryBase m_fileEntry;
+        };
+        AZStd::vector<IndexedFile> indexedFiles;
+        indexedFiles.reserve(arrFiles.size());
+        size_t nStringPoolSize = 0;
+        const uint8_t* pRecord = cdrBuffer.data();
+        for (const FileRecord& fileRecord : arrFiles)
+        {
+            // the file entries are the ones reading the records creates
+            const auto& header = *reinterpret_cast<const ZipFile::CDRFileHeader*>(pRecord);
+            pRecord += sizeof(ZipFile::CDRFileHeader) + header.nFileNameLength;
+
+            IndexedFile& indexedFile = indexedFiles.emplace_back();
+            indexedFile.m_path = fileRecord.strPath;
+            AZStd::to_lower(indexedFile.m_path.begin(), indexedFile.m_path.end());
+            AZStd::replace(indexedFile.m_path.begin(), indexedFile.m_path.end(), AZ_WRONG_FILESYSTEM_SEPARATOR, AZ_CORRECT_FILESYSTEM_SEPARATOR);
+            indexedFile.m_dirLength = DirectoryIndex::GetDirLength(indexedFile.m_path);
+            indexedFile.m_fileEntry = FileEntryBase(header, SExtraZipFileData{});
+            nStringPoolSize += indexedFile.m_path.size();
+        }
+
+        AZStd::sort(indexedFiles.begin(), indexedFiles.end(), [](const IndexedFile& lhs, const IndexedFile& rhs)
+        {
+            return DirectoryIndex::PathLess(lhs.m_path, lhs.m_dirLength, rhs.m_path, rhs.m_dirLength);
+        });
+
+        DirectoryIndex::Header header{};
+        header.nSignature = DirectoryIndex::Signature;
+        header.nVersion = DirectoryIndex::Version;
+        header.nNumEntries = aznumeric_cast<uint32_t>(indexedFiles.size());
+        header.nStringPoolSize = aznumeric_cast<uint32_t>(nStringPoolSize);
+        header.lCDRCRC32 = aznumeric_cast<uint32_t>(crc32(crc32(0L, Z_NULL, 0), cdrBuffer.data(), aznumeric_cast<uInt>(nSizeCDRRecords)));
+        header.lCDRSize = aznumeric_cast<uint32_t>(nSizeCDRRecords);
+
+        AZStd::vector<uint8_t> indexBuffer(sizeof(header) + indexedFiles.size() * sizeof(DirectoryIndex::Entry) + nStringPoolSize);
+        memcpy(indexBuffer.data(), &header, sizeof(header));
+        auto* pEntries = reinterpret_cast<DirectoryIndex::Entry*>(indexBuffer.data() + sizeof(header));
+        auto* pStringPool = reinterpret_cast<char*>(pEntries + indexedFiles.size());
+        uint32_t nPathOffset = 0;
+        for (const IndexedFile& indexedFile : indexedFiles)
+        {
+            const FileEntryBase& fileEntry = indexedFile.m_fileEntry;
+            DirectoryIndex::Entry& entry = *pEntries++;
+            entry.lCRC32 = fileEntry.desc.lCRC32;
+            entry.lSizeCompressed = fileEntry.desc.lSizeCompressed;
+            entry.lSizeUncompressed = fileEntry.desc.lSizeUncompressed;
+            entry.nFileHeaderOffset = fileEntry.nFileHeaderOffset;
+            entry.nFileDataOffset = fileEntry.nFileDataOffset;
+            entry.nPathOffset = nPathOffset;
+            entry.nNTFS_LastModifyTime = fileEntry.nNTFS_LastModifyTime;
+            entry.nPathLength = aznumeric_cast<uint16_t>(indexedFile.m_path.size());
+            entry.nMethod = fileEntry.nMethod;
+            entry.nLastModTime = fileEntry.nLastModTime;
+            entry.nLastModDate = fileEntry.nLastModDate;
+
+            memcpy(pStringPool + nPathOffset, indexedFile.m_path.data(), indexedFile.m_path.size());
+            nPathOffset += entry.nPathLength;
+        }
+
+        return UpdateFile(DirectoryIndex::FileName, indexBuffer.data(), indexBuffer.size(), ZipFile::METHOD_STORE);
+    }
+
     bool Cache::RelinkZip()
     {
         AZ::IO::FileIOBase* fileSystem = AZ::IO::FileIOBase::GetDirectInstance();
@@ -15,9 +15,13 @@
 //
 #pragma once
 
+#include <AzCore/IO/CompressionBus.h>
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/smart_ptr/intrusive_base.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzFramework/Archive/Codec.h>
 #include <AzFramework/Archive/ZipDirStructures.h>
 #include <AzFramework/Archive/ZipDirTree.h>
@@ -81,6 +85,10 @@ namespace AZ::IO::ZipDir
 
         ErrorEnum ReadFile(FileEntry* pFileEntry, void* pCompressed, void* pUncompressed);
 
+        // returns the seek table of a file compressed with CompressionCodec::Codec::ZSTD_SEEKABLE, or nullptr if the file isn't
+        // compressed in chunks. The seek table is read from the archive the first time it's requested and cached after that.
+        AZStd::shared_ptr<const AZ::IO::CompressionSeekTable> GetSeekTable(FileEntry* pFileEntry);
+
         void Free(void* ptr)
         {
             m_allocator->DeAllocate(ptr);
@@ -115,6 +123,11 @@ namespace AZ::IO::ZipDir
         bool WriteCDR(AZ::IO::HandleType fTarget);
 
         bool RelinkZip();
+
+        // writes the pre-built directory index of the files currently in the archive, replacing a previous one.
+        // The archive is compacted first if needed. Any change to the archive after this makes the index stale, in which
+        // case it's ignored when the archive is opened, until the index is written again.
+        ErrorEnum WriteDirectoryIndex();
     protected:
         bool RelinkZip(AZ::IO::HandleType fTmp);
         // writes out the file data in the queue into the given file. Empties the queue
@@ -129,6 +142,10 @@ namespace AZ::IO::ZipDir
 
         size_t GetCompressedSizeEstimate(size_t uncompressedSize, CompressionCodec::Codec codec);
 
+        AZStd::shared_ptr<const AZ::IO::CompressionSeekTable> ReadSeekTable(FileEntry* pFileEntry);
+        // drops the cached seek tables, needs to be called before the files in the archive are modified
+        void ClearSeekTables();
+
     protected:
         friend class CacheFactory;
         friend class FileEntryTransactionAdd;
@@ -161,6 +178,10 @@ namespace AZ::IO::ZipDir
         // CDR buffer.
         AZStd::vector<uint8_t> m_CDR_buffer;
 
+        // seek tables of the compressed files that were looked up so far, nullptr for files that aren't compressed in chunks
+        AZStd::unordered_map<const FileEntry*, AZStd::shared_ptr<const AZ::IO::CompressionSeekTable>> m_seekTables;
+        AZStd::mutex m_seekTablesLock;
+
         ZipFile::EHeaderEncryptionType m_encryptedHeaders;
         ZipFile::EHeaderSignatureType m_signedHeaders;
 
@@ -10,12 +10,15 @@
 #include <AzCore/Console/Console.h>
 #include <AzCore/IO/SystemFile.h> // for AZ_MAX_PATH_LEN
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/Jobs/Algorithms.h>
+#include <AzCore/Jobs/JobManagerBus.h>
 #include <AzCore/std/sort.h>
 #include <AzFramework/Archive/Archive.h>
 #include <AzFramework/Archive/ZipDirStructures.h>
 #include <AzFramework/Archive/ZipDirTree.h>
 #include <AzFramework/Archive/ZipDirCache.h>
 #include <AzFramework/Archive/ZipDirCacheFactory.h>
+#include <AzFramework/Archive/ZipDirIndex.h>
 #include <AzFramework/Archive/ZipDirList.h>
 #include <AzFramework/Archive/ZipFileFormat.h>
 
@@ -26,6 +29,10 @@
 
 namespace AZ::IO::ZipDir
 {
+    AZ_CVAR(uint32_t, az_archive_zip_directory_parallel_threshold, 2048, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "The number of files in the central directory of an archive from which on the directory is parsed on the job system\n"
+        "0 - Always parse the directory on the calling thread");
+
     // this sets the window size of the blocks of data read from the end of the file to find the Central Directory Record
     // since normally there are no
     static constexpr size_t CDRSearchWindowSize = 0x100;
@@ -470,20 +477,24 @@ namespace AZ::IO::ZipDir
             return false;
         }
 
-        // now we've read the complete CDR - parse it.
+        // now we've read the complete CDR - find the file records in it. The records aren't modified yet,
+        // the directory index needs to see them the way they were written.
+        AZStd::vector<ZipFile::CDRFileHeader*> fileHeaders;
+        fileHeaders.reserve(m_CDREnd.numEntriesTotal);
+        const ZipFile::CDRFileHeader* pIndexHeader = nullptr;
+        bool bValidCDR = true;
+
         ZipFile::CDRFileHeader* pFile = (ZipFile::CDRFileHeader*)(&pBuffer[0]);
         const uint8_t* pEndOfData = &pBuffer[0] + m_CDREnd.lCDRSize;
         uint8_t* pFileName;
 
         while ((pFileName = (uint8_t*)(pFile + 1)) <= pEndOfData)
         {
-            // Hacky way to use CDR memory block as a string pool.
-            pFile->lSignature = 0; // Force signature to always be 0 (First byte of signature maybe a zero termination of the previous file filename).
-
             if ((pFile->nVersionNeeded & 0xFF) > 20)
             {
                 THROW_ZIPDIR_ERROR(ZD_ERROR_UNSUPPORTED, "Cannot read the archive file (nVersionNeeded > 20).");
-                return false;
+                bValidCDR = false;
+                break;
             }
             //if (pFile->lSignature != pFile->SIGNATURE) // Timur, Dont compare signatures as signatue in memory can be overwritten by the code below
             //break;
@@ -493,28 +504,8 @@ namespace AZ::IO::ZipDir
             if (pEndOfRecord > pEndOfData)
             {
                 THROW_ZIPDIR_ERROR(ZD_ERROR_CDR_IS_CORRUPT, "Central Directory record is either corrupt, or truncated, or missing. Cannot read the archive directory");
-                return false;
-            }
-
-            //////////////////////////////////////////////////////////////////////////
-            // Analyze advanced section.
-            //////////////////////////////////////////////////////////////////////////
-            SExtraZipFileData extra;
-            const uint8_t* pExtraField = (pFileName + pFile->nFileNameLength);
-            const uint8_t* pExtraEnd = pExtraField + pFile->nExtraFieldLength;
-            while (pExtraField < pExtraEnd)
-            {
-                const uint8_t* pAttrData = pExtraField + sizeof(ZipFile::ExtraFieldHeader);
-                ZipFile::ExtraFieldHeader& hdr = *(ZipFile::ExtraFieldHeader*)pExtraField;
-                switch (hdr.headerID)
-                {
-                case ZipFile::EXTRA_NTFS:
-                {
-                    memcpy(&extra.nLastModifyTime, pAttrData + sizeof(ZipFile::ExtraNTFSHeader), sizeof(extra.nLastModifyTime));
-                }
+                bValidCDR = false;
                 break;
-                }
-                pExtraField += sizeof(ZipFile::ExtraFieldHeader) + hdr.dataSize;
             }
 
             bool bDirectory = false;
@@ -525,65 +516,299 @@ namespace AZ::IO::ZipDir
 
             if (!bDirectory)
             {
-                // Add this file entry.
+                if (AZStd::string_view(reinterpret_cast<const char*>(pFileName), pFile->nFileNameLength) == DirectoryIndex::FileName)
+                {
+                    pIndexHeader = pFile;
+                }
+                fileHeaders.push_back(pFile);
+            }
+
+            // move to the next file
+            pFile = (ZipFile::CDRFileHeader*)pEndOfRecord;
+        }
+
+        if (pIndexHeader && bValidCDR && ReadDirectoryIndex(fileHeaders, pIndexHeader))
+        {
+            return true;
+        }
+
+        // Files that were found before the CDR turned out to be corrupt are still added.
+        AddFileEntries(fileHeaders);
+
+        // finished reading CDR
+        return bValidCDR;
+    }
+
+    void CacheFactory::AddFileEntries(const AZStd::vector<ZipFile::CDRFileHeader*>& fileHeaders)
+    {
+        // Hacky way to use CDR memory block as a string pool.
+        // Force signature to always be 0 (First byte of signature maybe a zero termination of the previous file filename).
+        // This is done up front, as the termination of a file name can overlap with the signature of the next record.
+        for (ZipFile::CDRFileHeader* pFileHeader : fileHeaders)
+        {
+            pFileHeader->lSignature = 0;
+        }
+
+        struct ParsedFileEntry
+        {
+            AZStd::string_view m_path;
+            size_t m_dirLength{};
+            size_t m_cdrIndex{};
+            FileEntryBase m_fileEntry;
+            bool m_valid{};
+        };
+        AZStd::vector<ParsedFileEntry> parsedEntries(fileHeaders.size());
+
+        auto ParseFileHeaders = [this, &fileHeaders, &parsedEntries](size_t begin, size_t end)
+        {
+            for (size_t index = begin; index < end; ++index)
+            {
+                ZipFile::CDRFileHeader* pFileHeader = fileHeaders[index];
+                uint8_t* pFileName = reinterpret_cast<uint8_t*>(pFileHeader + 1);
+
+                //////////////////////////////////////////////////////////////////////////
+                // Analyze advanced section.
+                //////////////////////////////////////////////////////////////////////////
+                SExtraZipFileData extra;
+                const uint8_t* pExtraField = (pFileName + pFileHeader->nFileNameLength);
+                const uint8_t* pExtraEnd = pExtraField + pFileHeader->nExtraFieldLength;
+                while (pExtraField < pExtraEnd)
+                {
+                    const uint8_t* pAttrData = pExtraField + sizeof(ZipFile::ExtraFieldHeader);
+                    const ZipFile::ExtraFieldHeader& hdr = *(const ZipFile::ExtraFieldHeader*)pExtraField;
+                    switch (hdr.headerID)
+                    {
+                    case ZipFile::EXTRA_NTFS:
+                    {
+                        memcpy(&extra.nLastModifyTime, pAttrData + sizeof(ZipFile::ExtraNTFSHeader), sizeof(extra.nLastModifyTime));
+                    }
+                    break;
+                    }
+                    pExtraField += sizeof(ZipFile::ExtraFieldHeader) + hdr.dataSize;
+                }
+
+                // The CDR only contains ASCII paths, so the lower casing doesn't need the locale.
                 char* str = reinterpret_cast<char*>(pFileName);
-                for (int i = 0; i < pFile->nFileNameLength; i++)
+                for (int i = 0; i < pFileHeader->nFileNameLength; i++)
                 {
-                    str[i] = std::tolower(str[i], std::locale());
-                    if (str[i] == AZ_WRONG_FILESYSTEM_SEPARATOR)
+                    if (str[i] >= 'A' && str[i] <= 'Z')
+                    {
+                        str[i] = str[i] - 'A' + 'a';
+                    }
+                    else if (str[i] == AZ_WRONG_FILESYSTEM_SEPARATOR)
                     {
                         str[i] = AZ_CORRECT_FILESYSTEM_SEPARATOR;
                     }
                 }
-                str[pFile->nFileNameLength] = 0; // Not standard!, may overwrite signature of the next memory record data in zip.
-                AddFileEntry(str, pFile, extra);
+
+                ParsedFileEntry& parsedEntry = parsedEntries[index];
+                parsedEntry.m_path = AZStd::string_view(str, pFileHeader->nFileNameLength);
+                parsedEntry.m_dirLength = DirectoryIndex::GetDirLength(parsedEntry.m_path);
+                parsedEntry.m_cdrIndex = index;
+                parsedEntry.m_valid = CreateFileEntry(pFileHeader, extra, parsedEntry.m_fileEntry);
             }
+        };
 
-            // move to the next file
-            pFile = (ZipFile::CDRFileHeader*)pEndOfRecord;
+        AZ::JobContext* jobContext = nullptr;
+        if (az_archive_zip_directory_parallel_threshold > 0 && fileHeaders.size() >= az_archive_zip_directory_parallel_threshold)
+        {
+            AZ::JobManagerBus::BroadcastResult(jobContext, &AZ::JobManagerEvents::GetGlobalContext);
         }
 
-        // finished reading CDR
-        return true;
+        if (jobContext)
+        {
+            AZ::parallel_for_range(size_t{ 0 }, fileHeaders.size(), ParseFileHeaders, jobContext);
+        }
+        else
+        {
+            ParseFileHeaders(0, fileHeaders.size());
+        }
+
+        // Not standard!, may overwrite signature of the next memory record data in zip.
+        // The names are terminated after all of them are normalized, as the terminator can be the first
+        // character of the extra field of the same record.
+        for (const ParsedFileEntry& parsedEntry : parsedEntries)
+        {
+            const_cast<char*>(parsedEntry.m_path.data())[parsedEntry.m_path.size()] = 0;
+        }
+
+        // when using encrypted headers we should always initialize data offsets from CDR
+        // This reads the local headers, so it's done in the order of the CDR on this thread.
+        if (m_encryptedHeaders != ZipFile::HEADERS_NOT_ENCRYPTED || m_nInitMethod >= ZD_INIT_FULL)
+        {
+            for (ParsedFileEntry& parsedEntry : parsedEntries)
+            {
+                if (parsedEntry.m_valid && fileHeaders[parsedEntry.m_cdrIndex]->desc.lSizeCompressed)
+                {
+                    InitDataOffset(parsedEntry.m_fileEntry, fileHeaders[parsedEntry.m_cdrIndex]);
+                }
+            }
+        }
+
+        if (m_bBuildFileEntryMap)
+        {
+            for (const ParsedFileEntry& parsedEntry : parsedEntries)
+            {
+                if (parsedEntry.m_valid)
+                {
+                    m_mapFileEntries.emplace(parsedEntry.m_path, parsedEntry.m_fileEntry);
+                }
+            }
+        }
+
+        if (m_bBuildFileEntryTree)
+        {
+            // Sort the files so the files of a directory are added together and in order. Files with the same path keep
+            // their order in the CDR, so the first one is added as before.
+            auto ParsedEntryLess = [](const ParsedFileEntry& lhs, const ParsedFileEntry& rhs)
+            {
+                if (DirectoryIndex::PathLess(lhs.m_path, lhs.m_dirLength, rhs.m_path, rhs.m_dirLength))
+                {
+                    return true;
+                }
+                if (DirectoryIndex::PathLess(rhs.m_path, rhs.m_dirLength, lhs.m_path, lhs.m_dirLength))
+                {
+                    return false;
+                }
+                return lhs.m_cdrIndex < rhs.m_cdrIndex;
+            };
+
+            if (jobContext)
+            {
+                AZ::parallel_sort(parsedEntries.begin(), parsedEntries.end(), ParsedEntryLess, jobContext);
+            }
+            else
+            {
+                AZStd::sort(parsedEntries.begin(), parsedEntries.end(), ParsedEntryLess);
+            }
+
+            FileEntryTreeBuilder treeBuilder(m_treeFileEntries);
+            for (const ParsedFileEntry& parsedEntry : parsedEntries)
+            {
+                if (parsedEntry.m_valid)
+                {
+                    treeBuilder.Add(parsedEntry.m_path, parsedEntry.m_fileEntry);
+                }
+            }
+        }
     }
 
 
     //////////////////////////////////////////////////////////////////////////
-    // give the CDR File Header entry, reads the local file header to validate
-    // and determine where the actual file lies
-    void CacheFactory::AddFileEntry(char* strFilePath, const ZipFile::CDRFileHeader* pFileHeader, const SExtraZipFileData& extra)
+    // give the CDR File Header entry, validates it and initializes the file entry from it
+    bool CacheFactory::CreateFileEntry(const ZipFile::CDRFileHeader* pFileHeader, const SExtraZipFileData& extra, FileEntryBase& fileEntry) const
     {
         if (pFileHeader->lLocalHeaderOffset > m_CDREnd.lCDROffset)
         {
             THROW_ZIPDIR_ERROR(ZD_ERROR_CDR_IS_CORRUPT, "Central Directory contains file descriptors pointing outside the archive file boundaries. The archive file is either truncated or damaged. Please try to repair the file"); // the file offset is beyond the CDR: impossible
-            return;
+            return false;
         }
 
         if ((pFileHeader->nMethod == ZipFile::METHOD_STORE || pFileHeader->nMethod == ZipFile::METHOD_STORE_AND_STREAMCIPHER_KEYTABLE) && pFileHeader->desc.lSizeUncompressed != pFileHeader->desc.lSizeCompressed)
         {
             THROW_ZIPDIR_ERROR(ZD_ERROR_VALIDATION_FAILED, "File with STORE compression method declares its compressed size not matching its uncompressed size. File descriptor is inconsistent, archive content may be damaged, please try to repair the archive");
-            return;
+            return false;
         }
 
-        FileEntryBase fileEntry(*pFileHeader, extra);
+        fileEntry = FileEntryBase(*pFileHeader, extra);
+        return true;
+    }
 
-        // when using encrypted headers we should always initialize data offsets from CDR
-        if ((m_encryptedHeaders != ZipFile::HEADERS_NOT_ENCRYPTED || m_nInitMethod >= ZD_INIT_FULL) && pFileHeader->desc.lSizeCompressed)
+    //////////////////////////////////////////////////////////////////////////
+    // builds the file entry tree from the directory index stored in the archive
+    bool CacheFactory::ReadDirectoryIndex(const AZStd::vector<ZipFile::CDRFileHeader*>& fileHeaders, const ZipFile::CDRFileHeader* pIndexHeader)
+    {
+        // The index contains the file entries as a fast initialization creates them. Any other initialization reads
+        // the local headers anyway, and the paths in encrypted headers can't be compared with the index.
+        if (m_nInitMethod != ZD_INIT_FAST || m_encryptedHeaders != ZipFile::HEADERS_NOT_ENCRYPTED || !m_bBuildFileEntryTree || m_bBuildFileEntryMap)
         {
-            InitDataOffset(fileEntry, pFileHeader);
+            return false;
         }
 
-        if (m_bBuildFileEntryMap)
+        const uint32_t nIndexSize = pIndexHeader->desc.lSizeUncompressed;
+        if (pIndexHeader->nMethod != ZipFile::METHOD_STORE || pIndexHeader->desc.lSizeCompressed != nIndexSize
+            || nIndexSize < sizeof(DirectoryIndex::Header) || pIndexHeader->lLocalHeaderOffset > m_CDREnd.lCDROffset)
         {
-            m_mapFileEntries.emplace(strFilePath, fileEntry);
+            return false;
         }
 
-        if (m_bBuildFileEntryTree)
+        // The index is only valid for the records it was written for, which are all records but the one of the index.
+        const uint8_t* pCDRBegin = m_CDR_buffer.data();
+        const uint8_t* pCDREnd = pCDRBegin + m_CDREnd.lCDRSize;
+        const uint8_t* pIndexRecordBegin = reinterpret_cast<const uint8_t*>(pIndexHeader);
+        const uint8_t* pIndexRecordEnd = reinterpret_cast<const uint8_t*>(pIndexHeader + 1) + pIndexHeader->nFileNameLength
+            + pIndexHeader->nExtraFieldLength + pIndexHeader->nFileCommentLength;
+        uLong lCDRCRC32 = crc32(0L, Z_NULL, 0);
+        lCDRCRC32 = crc32(lCDRCRC32, pCDRBegin, aznumeric_cast<uInt>(pIndexRecordBegin - pCDRBegin));
+        lCDRCRC32 = crc32(lCDRCRC32, pIndexRecordEnd, aznumeric_cast<uInt>(pCDREnd - pIndexRecordEnd));
+        const auto lCDRSize = aznumeric_cast<uint32_t>((pIndexRecordBegin - pCDRBegin) + (pCDREnd - pIndexRecordEnd));
+
+        // read the index, it's stored right after its local file header
+        ZipFile::LocalFileHeader localHeader;
+        Seek(pIndexHeader->lLocalHeaderOffset);
+        if (!Read(&localHeader, sizeof(localHeader)) || localHeader.desc != pIndexHeader->desc || localHeader.nMethod != pIndexHeader->nMethod)
         {
-            m_treeFileEntries.Add(strFilePath, fileEntry);
+            return false;
         }
-    }
+        const uint64_t nIndexDataOffset = uint64_t{ pIndexHeader->lLocalHeaderOffset } + sizeof(ZipFile::LocalFileHeader)
+            + localHeader.nFileNameLength + localHeader.nExtraFieldLength;
+        if (nIndexDataOffset + nIndexSize > m_CDREnd.lCDROffset)
+        {
+            return false;
+        }
+
+        AZStd::vector<uint8_t> indexBuffer(nIndexSize);
+        Seek(aznumeric_cast<uint32_t>(nIndexDataOffset));
+        if (!Read(indexBuffer.data(), nIndexSize) || crc32(crc32(0L, Z_NULL, 0), indexBuffer.data(), nIndexSize) != pIndexHeader->desc.lCRC32)
+        {
+            return false;
+        }
+
+        DirectoryIndex::Header header;
+        memcpy(&header, indexBuffer.data(), sizeof(header));
+        if (header.nSignature != DirectoryIndex::Signature || header.nVersion != DirectoryIndex::Version
+            || header.lCDRCRC32 != lCDRCRC32 || header.lCDRSize != lCDRSize || header.nNumEntries != fileHeaders.size() - 1
+            || sizeof(header) + uint64_t{ header.nNumEntries } * sizeof(DirectoryIndex::Entry) + header.nStringPoolSize != nIndexSize)
+        {
+            AZ_TracePrintf("Archive", "The directory index of archive %s is out of date and will be ignored.\n", m_szFilename.c_str());
+            return false;
+        }
+
+        const auto* pEntries = reinterpret_cast<const DirectoryIndex::Entry*>(indexBuffer.data() + sizeof(header));
+        const auto* pStringPool = reinterpret_cast<const char*>(pEntries + header.nNumEntries);
+        FileEntryTreeBuilder treeBuilder(m_treeFileEntries);
+        for (uint32_t index = 0; index < header.nNumEntries; ++index)
+        {
+            const DirectoryIndex::Entry& entry = pEntries[index];
+            if (entry.nPathLength == 0 || uint64_t{ entry.nPathOffset } + entry.nPathLength > header.nStringPoolSize
+                || entry.nFileHeaderOffset > m_CDREnd.lCDROffset)
+            {
+                THROW_ZIPDIR_ERROR(ZD_ERROR_DATA_IS_CORRUPT, "The directory index contains an invalid entry, it will be ignored.");
+                m_treeFileEntries.Clear();
+                return false;
+            }
 
+            FileEntryBase fileEntry;
+            fileEntry.desc.lCRC32 = entry.lCRC32;
+            fileEntry.desc.lSizeCompressed = entry.lSizeCompressed;
+            fileEntry.desc.lSizeUncompressed = entry.lSizeUncompressed;
+            fileEntry.nFileHeaderOffset = entry.nFileHeaderOffset;
+            fileEntry.nFileDataOffset = entry.nFileDataOffset;
+            fileEntry.nMethod = entry.nMethod;
+            fileEntry.nLastModTime = entry.nLastModTime;
+            fileEntry.nLastModDate = entry.nLastModDate;
+            fileEntry.nNTFS_LastModifyTime = entry.nNTFS_LastModifyTime;
+            fileEntry.nEOFOffset = entry.nFileDataOffset + entry.lSizeCompressed;
+            treeBuilder.Add(AZStd::string_view(pStringPool + entry.nPathOffset, entry.nPathLength), fileEntry);
+        }
+
+        // The index itself stays a regular file in the archive.
+        m_treeFileEntries.Add(DirectoryIndex::FileName, FileEntryBase(*pIndexHeader, SExtraZipFileData{}));
+
+        // The string pool of the index replaces the CDR as the string pool of the tree.
+        m_CDR_buffer.swap(indexBuffer);
+        return true;
+    }
 
     //////////////////////////////////////////////////////////////////////////
     // initializes the actual data offset in the file in the fileEntry structure
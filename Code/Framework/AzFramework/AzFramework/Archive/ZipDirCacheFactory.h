@@ -68,10 +68,17 @@ namespace AZ::IO::ZipDir
         // builds up the m_mapFileEntries
         bool BuildFileEntryMap();// throw (ErrorEnum);
 
-        // give the CDR File Header entry, reads the local file header to validate and determine where
-        // the actual file lies
-        // This function can actually modify strFilePath variable, make sure you use a copy of the real path.
-        void AddFileEntry(char* strFilePath, const ZipFile::CDRFileHeader* pFileHeader, const SExtraZipFileData& extra);// throw (ErrorEnum);
+        // normalizes the paths of the given CDR File Header entries and adds them to the file entry tree.
+        // Large directories are processed on the job threads if they're available.
+        // The file names are normalized in place, so the CDR buffer becomes the string pool of the tree.
+        void AddFileEntries(const AZStd::vector<ZipFile::CDRFileHeader*>& fileHeaders);// throw (ErrorEnum);
+
+        // validates the CDR File Header entry and initializes the file entry from it. Safe to call from multiple threads.
+        bool CreateFileEntry(const ZipFile::CDRFileHeader* pFileHeader, const SExtraZipFileData& extra, FileEntryBase& fileEntry) const;// throw (ErrorEnum);
+
+        // builds the file entry tree from the directory index stored in the archive, if there's one and it's still valid
+        // for the given CDR File Header entries. The entries include the one of the index itself.
+        bool ReadDirectoryIndex(const AZStd::vector<ZipFile::CDRFileHeader*>& fileHeaders, const ZipFile::CDRFileHeader* pIndexHeader);
 
         // extracts the file path from the file header with subsequent information
         // may, or may not, put all letters to lower-case (depending on whether the system is to be case-sensitive or not)
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+
+// Layout of the optional pre-built directory index that can be stored inside a zip file.
+//
+// The index is a regular file stored (not compressed) in the root of the archive. It contains the paths of all other
+// files in the archive, already normalized and sorted in the order the file entry tree is built in, together with their
+// file entries. When an archive with a valid index is opened, the central directory doesn't have to be parsed and
+// normalized, and the tree can be built without searching.
+// The index stores the CRC32 of the central directory records of all other files it was written for. Any change to the
+// archive after the index was written, be it through ZipDir::Cache or an external zip tool, changes those records and
+// the stale index is ignored.
+// Values are stored in the byte order of the platform that wrote the index, like the rest of the zip structures.
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/string/string_view.h>
+#include <AzCore/StringFunc/StringFunc.h>
+
+namespace AZ::IO::ZipDir::DirectoryIndex
+{
+    // the name of the index file in the root of the archive
+    inline constexpr AZStd::string_view FileName{ ".pakindex" };
+
+    inline constexpr uint32_t Signature = 0x58444950; // "PIDX" when read as little endian bytes
+    inline constexpr uint32_t Version = 1;
+
+    struct Header
+    {
+        uint32_t nSignature;
+        uint32_t nVersion;
+        uint32_t nNumEntries;
+        uint32_t nStringPoolSize;
+        uint32_t lCDRCRC32; // CRC32 of the central directory records of all files but the index
+        uint32_t lCDRSize; // size of the central directory records of all files but the index
+    };
+
+    // the header is followed by nNumEntries entries, followed by the string pool with the paths
+    struct Entry
+    {
+        uint32_t lCRC32;
+        uint32_t lSizeCompressed;
+        uint32_t lSizeUncompressed;
+        uint32_t nFileHeaderOffset;
+        uint32_t nFileDataOffset;
+        uint32_t nPathOffset; // offset of the path in the string pool, the path is not null terminated
+        uint64_t nNTFS_LastModifyTime;
+        uint16_t nPathLength;
+        uint16_t nMethod;
+        uint16_t nLastModTime;
+        uint16_t nLastModDate;
+    };
+
+    static_assert(sizeof(Header) == 24, "The size of the directory index header is part of the file format");
+    static_assert(sizeof(Entry) == 40, "The size of the directory index entry is part of the file format");
+
+    // returns the length of the directory part of a path, without the trailing separator
+    inline size_t GetDirLength(AZStd::string_view path)
+    {
+        const size_t separatorPos = path.find_last_of(AZ_CORRECT_AND_WRONG_FILESYSTEM_SEPARATOR);
+        return separatorPos == AZStd::string_view::npos ? 0 : separatorPos;
+    }
+
+    // orders normalized paths by their directory first and their file name second. This keeps the files of a directory
+    // together and in the order of their names, which is the cheapest order to add them to a FileEntryTree in.
+    inline bool PathLess(AZStd::string_view lhs, size_t lhsDirLength, AZStd::string_view rhs, size_t rhsDirLength)
+    {
+        if (const int result = lhs.substr(0, lhsDirLength).compare(rhs.substr(0, rhsDirLength)); result != 0)
+        {
+            return result < 0;
+        }
+        return lhs.substr(lhsDirLength) < rhs.substr(rhsDirLength);
+    }
+}
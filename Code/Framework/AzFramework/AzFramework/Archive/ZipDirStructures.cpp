@@ -316,6 +316,35 @@ namespace AZ::IO::ZipDir::ZipDirStructuresInternal
 
         return memoryBlock;
     }
+
+    // Layout of the seek table in the zstd seekable format. All values are stored as little endian.
+    // The table is a skippable frame with the compressed and decompressed size of every frame, followed by a footer.
+    constexpr uint32_t ZSTDSkippableFrameMagic = 0x184D2A5E;
+    constexpr uint32_t ZSTDSeekableMagic = 0x8F92EAB1;
+    constexpr size_t ZSTDSkippableFrameHeaderSize = 8;
+    constexpr size_t ZSTDSeekTableEntrySize = 8;
+    constexpr size_t ZSTDSeekTableEntryWithChecksumSize = 12;
+    constexpr uint8_t ZSTDSeekTableChecksumFlag = 0x80;
+    constexpr uint8_t ZSTDSeekTableReservedBits = 0x7C;
+
+    static void WriteLE32(uint8_t* target, uint32_t value)
+    {
+        target[0] = static_cast<uint8_t>(value);
+        target[1] = static_cast<uint8_t>(value >> 8);
+        target[2] = static_cast<uint8_t>(value >> 16);
+        target[3] = static_cast<uint8_t>(value >> 24);
+    }
+
+    static uint32_t ReadLE32(const uint8_t* source)
+    {
+        return static_cast<uint32_t>(source[0]) | (static_cast<uint32_t>(source[1]) << 8) |
+            (static_cast<uint32_t>(source[2]) << 16) | (static_cast<uint32_t>(source[3]) << 24);
+    }
+
+    static size_t GetZSTDSeekTableSize(size_t numFrames, size_t entrySize)
+    {
+        return ZSTDSkippableFrameHeaderSize + numFrames * entrySize + AZ::IO::ZipDir::ZSTDSeekTableFooterSize;
+    }
 }
 
 namespace AZ::IO::ZipDir
@@ -652,6 +681,112 @@ namespace AZ::IO::ZipDir
         return returnCode;
     }
 
+    size_t ZSTDSeekableCompressBound(size_t nSrcSize)
+    {
+        using namespace ZipDirStructuresInternal;
+        const size_t numChunks = (nSrcSize + ZSTDSeekableChunkSize - 1) / ZSTDSeekableChunkSize;
+        return numChunks * ZSTD_compressBound(ZSTDSeekableChunkSize) + GetZSTDSeekTableSize(numChunks, ZSTDSeekTableEntrySize);
+    }
+
+    int ZipRawCompressZSTDSeekable(const void* pUncompressed, size_t* pDestSize, void* pCompressed, size_t nSrcSize, [[maybe_unused]] int nLevel)
+    {
+        using namespace ZipDirStructuresInternal;
+
+        const size_t numChunks = (nSrcSize + ZSTDSeekableChunkSize - 1) / ZSTDSeekableChunkSize;
+        const size_t seekTableSize = GetZSTDSeekTableSize(numChunks, ZSTDSeekTableEntrySize);
+        if (*pDestSize < seekTableSize)
+        {
+            return Z_BUF_ERROR;
+        }
+
+        // the chunks are written first, the seek table entries are collected in the space reserved at the end of the buffer
+        // and moved in place once the size of the compressed chunks is known.
+        auto source = static_cast<const uint8_t*>(pUncompressed);
+        auto target = static_cast<uint8_t*>(pCompressed);
+        AZStd::vector<uint8_t> seekTable(seekTableSize);
+        uint8_t* entry = seekTable.data() + ZSTDSkippableFrameHeaderSize;
+        size_t compressedSize = 0;
+        const size_t maxChunksSize = *pDestSize - seekTableSize;
+        for (size_t offset = 0; offset < nSrcSize; offset += ZSTDSeekableChunkSize)
+        {
+            const size_t chunkSize = AZStd::min(ZSTDSeekableChunkSize, nSrcSize - offset);
+            size_t result = ZSTD_compress(target + compressedSize, maxChunksSize - compressedSize, source + offset, chunkSize, 1);
+            if (ZSTD_isError(result))
+            {
+                AZ_Error("ZipDirStructures", false, "Error compressing using zstd: %s", ZSTD_getErrorName(result));
+                return Z_BUF_ERROR;
+            }
+            WriteLE32(entry, aznumeric_cast<uint32_t>(result));
+            WriteLE32(entry + 4, aznumeric_cast<uint32_t>(chunkSize));
+            entry += ZSTDSeekTableEntrySize;
+            compressedSize += result;
+        }
+
+        WriteLE32(seekTable.data(), ZSTDSkippableFrameMagic);
+        WriteLE32(seekTable.data() + 4, aznumeric_cast<uint32_t>(seekTableSize - ZSTDSkippableFrameHeaderSize));
+        WriteLE32(entry, aznumeric_cast<uint32_t>(numChunks));
+        entry[4] = 0; // no checksums
+        WriteLE32(entry + 5, ZSTDSeekableMagic);
+
+        memcpy(target + compressedSize, seekTable.data(), seekTableSize);
+        *pDestSize = compressedSize + seekTableSize;
+        return Z_OK;
+    }
+
+    size_t GetZSTDSeekTableSize(const void* pFooter)
+    {
+        using namespace ZipDirStructuresInternal;
+
+        auto footer = static_cast<const uint8_t*>(pFooter);
+        if (ReadLE32(footer + 5) != ZSTDSeekableMagic || (footer[4] & ZSTDSeekTableReservedBits) != 0)
+        {
+            return 0;
+        }
+        const size_t entrySize = (footer[4] & ZSTDSeekTableChecksumFlag) ? ZSTDSeekTableEntryWithChecksumSize : ZSTDSeekTableEntrySize;
+        return GetZSTDSeekTableSize(ReadLE32(footer), entrySize);
+    }
+
+    bool ParseZSTDSeekTable(const void* pSeekTable, size_t nSeekTableSize, uint64_t nSizeCompressed, uint64_t nSizeUncompressed,
+        AZ::IO::CompressionSeekTable& seekTable)
+    {
+        using namespace ZipDirStructuresInternal;
+
+        auto table = static_cast<const uint8_t*>(pSeekTable);
+        if (nSeekTableSize < ZSTDSkippableFrameHeaderSize + ZSTDSeekTableFooterSize || nSeekTableSize >= nSizeCompressed ||
+            GetZSTDSeekTableSize(table + nSeekTableSize - ZSTDSeekTableFooterSize) != nSeekTableSize ||
+            ReadLE32(table) != ZSTDSkippableFrameMagic || ReadLE32(table + 4) != nSeekTableSize - ZSTDSkippableFrameHeaderSize)
+        {
+            return false;
+        }
+
+        const uint8_t* footer = table + nSeekTableSize - ZSTDSeekTableFooterSize;
+        const uint32_t numFrames = ReadLE32(footer);
+        if (numFrames == 0)
+        {
+            return false;
+        }
+        const size_t entrySize = (footer[4] & ZSTDSeekTableChecksumFlag) ? ZSTDSeekTableEntryWithChecksumSize : ZSTDSeekTableEntrySize;
+
+        seekTable.clear();
+        seekTable.reserve(numFrames + 1);
+        AZ::IO::CompressionSeekPoint point;
+        const uint8_t* entry = table + ZSTDSkippableFrameHeaderSize;
+        for (uint32_t i = 0; i < numFrames; ++i, entry += entrySize)
+        {
+            seekTable.push_back(point);
+            const uint32_t frameCompressedSize = ReadLE32(entry);
+            if (frameCompressedSize == 0)
+            {
+                return false;
+            }
+            point.m_compressedOffset += frameCompressedSize;
+            point.m_uncompressedOffset += ReadLE32(entry + 4);
+        }
+        seekTable.push_back(point);
+
+        return point.m_compressedOffset + nSeekTableSize == nSizeCompressed && point.m_uncompressedOffset == nSizeUncompressed;
+    }
+
 
     // finds the subdirectory entry by the name, using the names from the name pool
     // assumes: all directories are sorted in alphabetical order.
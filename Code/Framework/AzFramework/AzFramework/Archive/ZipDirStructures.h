@@ -13,6 +13,7 @@
 #pragma once
 
 #include <AzCore/base.h>
+#include <AzCore/IO/CompressionBus.h>
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/IO/SystemFile.h>
 #include <AzCore/std/smart_ptr/intrusive_ptr.h>
@@ -146,6 +147,23 @@ namespace AZ::IO::ZipDir
     int ZipRawCompressZSTD(const void* pUncompressed, size_t* pDestSize, void* pCompressed, size_t nSrcSize, int nLevel);
     int ZipRawCompressLZ4(const void* pUncompressed, size_t* pDestSize, void* pCompressed, size_t nSrcSize, int nLevel);
 
+    // compresses the data as a series of independent zstd frames of ZSTDSeekableChunkSize bytes, followed by a seek table
+    // in the zstd seekable format. The result is a valid multi-frame zstd stream, so it can be decompressed as a whole with
+    // ZipRawUncompress, but individual chunks can also be decompressed on their own with the help of the seek table.
+    inline constexpr size_t ZSTDSeekableChunkSize = 256 * 1024;
+    int ZipRawCompressZSTDSeekable(const void* pUncompressed, size_t* pDestSize, void* pCompressed, size_t nSrcSize, int nLevel);
+    size_t ZSTDSeekableCompressBound(size_t nSrcSize);
+
+    // size of the footer at the end of the seek table in the zstd seekable format
+    inline constexpr size_t ZSTDSeekTableFooterSize = 9;
+    // returns the size of the seek table at the end of compressed data, given the last ZSTDSeekTableFooterSize bytes of the data.
+    // returns 0 if the data doesn't end with a seek table
+    size_t GetZSTDSeekTableSize(const void* pFooter);
+    // reads the seek table at the end of compressed data written by ZipRawCompressZSTDSeekable and converts it to the seek table
+    // used by the streamer. Returns false if the seek table is damaged or doesn't describe data of the given sizes.
+    bool ParseZSTDSeekTable(const void* pSeekTable, size_t nSeekTableSize, uint64_t nSizeCompressed, uint64_t nSizeUncompressed,
+        AZ::IO::CompressionSeekTable& seekTable);
+
     // fseek wrapper with memory in file support.
     int64_t FSeek(CZipFile* zipFile, int64_t origin, int command);
 
@@ -175,4 +175,51 @@ namespace AZ::IO::ZipDir
         m_mapFiles.erase(itRemove);
         return ZD_ERROR_SUCCESS;
     }
+
+    FileEntryTreeBuilder::FileEntryTreeBuilder(FileEntryTree& tree)
+        : m_tree(tree)
+    {
+    }
+
+    ErrorEnum FileEntryTreeBuilder::Add(AZStd::string_view szPath, const FileEntryBase& file)
+    {
+        const size_t separatorPos = szPath.find_last_of(AZ_CORRECT_AND_WRONG_FILESYSTEM_SEPARATOR);
+        const AZStd::string_view dirPath = separatorPos == AZStd::string_view::npos ? AZStd::string_view{} : szPath.substr(0, separatorPos);
+        const AZStd::string_view fileName = separatorPos == AZStd::string_view::npos ? szPath : szPath.substr(separatorPos + 1);
+        if (fileName.empty())
+        {
+            AZ_Assert(false, "An empty file name cannot be added to the zip file entry tree");
+            return ZD_ERROR_INVALID_PATH;
+        }
+
+        if (m_lastDir == nullptr || dirPath != m_lastDirPath)
+        {
+            // Walk down the directories in the same way as FileEntryTree::Add does
+            FileEntryTree* dir = &m_tree;
+            AZStd::string_view remainingPath = dirPath;
+            while (AZStd::optional<AZStd::string_view> dirName = AZ::StringFunc::TokenizeNext(remainingPath, AZ_CORRECT_AND_WRONG_FILESYSTEM_SEPARATOR))
+            {
+                auto dirEntryIter = dir->m_mapDirs.find(*dirName);
+                if (dirEntryIter == dir->m_mapDirs.end())
+                {
+                    dirEntryIter = dir->m_mapDirs.emplace(*dirName, AZStd::make_unique<FileEntryTree>()).first;
+                }
+                dir = dirEntryIter->second.get();
+            }
+            m_lastDir = dir;
+            m_lastDirPath = dirPath;
+        }
+
+        // The end of the map is the right position for files that are added in order, for any other file the hint
+        // is ignored and the position is searched for.
+        FileEntryTree::FileMap& files = m_lastDir->m_mapFiles;
+        auto fileEntryIter = files.emplace_hint(files.end(), fileName, nullptr);
+        if (fileEntryIter->second)
+        {
+            return ZD_ERROR_FILE_ALREADY_EXISTS;
+        }
+        fileEntryIter->second = AZStd::make_unique<FileEntry>();
+        static_cast<FileEntryBase&>(*fileEntryIter->second) = file;
+        return ZD_ERROR_SUCCESS;
+    }
 }
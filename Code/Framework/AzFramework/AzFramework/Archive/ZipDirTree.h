@@ -18,6 +18,7 @@ namespace AZ::IO::ZipDir
 {
     class FileEntryTree
     {
+        friend class FileEntryTreeBuilder;
     public:
         AZ_CLASS_ALLOCATOR(FileEntryTree, AZ::SystemAllocator, 0);
         ~FileEntryTree () {Clear(); }
@@ -85,4 +86,23 @@ namespace AZ::IO::ZipDir
         SubdirMap m_mapDirs;
         FileMap m_mapFiles;
     };
+
+    // adds files to a tree in bulk. Files in the same directory as the previously added file skip the directory lookup,
+    // and files that are added in the order of their names are appended to their directory without a search.
+    // Adding files sorted by directory first and file name second is therefore considerably cheaper than adding them
+    // one by one with FileEntryTree::Add.
+    class FileEntryTreeBuilder
+    {
+    public:
+        explicit FileEntryTreeBuilder(FileEntryTree& tree);
+
+        // adds a file to the tree. The path is used as the storage of the names in the tree, so it needs to
+        // outlive the tree.
+        ErrorEnum Add(AZStd::string_view szPath, const FileEntryBase& file);
+
+    private:
+        FileEntryTree& m_tree;
+        FileEntryTree* m_lastDir{};
+        AZStd::string_view m_lastDirPath;
+    };
 }
@@ -56,6 +56,7 @@ namespace AZ::IO::ZipFile
         METHOD_DEFLATE_AND_STREAMCIPHER = 12, // Deflate + stream cipher encryption on a per file basis
         METHOD_STORE_AND_STREAMCIPHER_KEYTABLE = 13, // Store + Timur's encryption technique on a per file basis
         METHOD_DEFLATE_AND_STREAMCIPHER_KEYTABLE = 14, // Deflate + Timur's encryption technique on a per file basis
+        METHOD_ZSTD = 93, // The file is compressed with Zstandard, used for files compressed as seekable chunks
     };
 
 
@@ -15,6 +15,7 @@
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/Path/Path.h>
 #include <AzCore/IO/SystemFile.h>
 #include <AzCore/Serialization/ObjectStream.h>
 #include <AzCore/Settings/SettingsRegistryMergeUtils.h>
@@ -27,6 +28,7 @@
 #include <AzFramework/Asset/AssetBundleManifest.h>
 #include <AzFramework/Asset/AssetRegistry.h>
 #include <AzFramework/Asset/AssetSystemBus.h>
+#include <AzFramework/Asset/FlatAssetRegistry.h>
 #include <AzFramework/StringFunc/StringFunc.h>
 
 // uncomment to have the catalog be dumped to stdout:
@@ -35,6 +37,49 @@
 
 namespace AzFramework
 {
+    namespace AssetCatalogInternal
+    {
+        //! Settings registry key that can be set to false to always load the regular catalog instead of the flat catalog.
+        constexpr const char* UseFlatCatalogKey = "/O3DE/AzFramework/AssetCatalog/UseFlatCatalog";
+
+        // Opens the flat version of the catalog if it's enabled and up to date.
+        AZStd::shared_ptr<FlatAssetRegistry> OpenFlatCatalog(const char* catalogRegistryFile)
+        {
+            bool useFlatCatalog = true;
+            if (auto settingsRegistry = AZ::SettingsRegistry::Get(); settingsRegistry != nullptr)
+            {
+                settingsRegistry->Get(useFlatCatalog, UseFlatCatalogKey);
+            }
+
+            AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance();
+            if (!useFlatCatalog || !fileIO || !catalogRegistryFile)
+            {
+                return {};
+            }
+
+            AZ::IO::Path flatCatalogPath(catalogRegistryFile);
+            flatCatalogPath.ReplaceExtension(FlatAssetRegistry::FileExtension);
+            if (!fileIO->Exists(flatCatalogPath.c_str()))
+            {
+                return {};
+            }
+
+            // The Asset Processor writes the flat catalog after the regular catalog, so if the flat catalog is older it's stale.
+            if (fileIO->ModificationTime(flatCatalogPath.c_str()) < fileIO->ModificationTime(catalogRegistryFile))
+            {
+                AZ_TracePrintf("AssetCatalog", "Ignoring flat asset catalog \"%s\" as it's older than the asset catalog.\n", flatCatalogPath.c_str());
+                return {};
+            }
+
+            auto flatRegistry = AZStd::make_shared<FlatAssetRegistry>();
+            if (!flatRegistry->Open(flatCatalogPath.c_str()))
+            {
+                return {};
+            }
+            return flatRegistry;
+        }
+    }
+
     //=========================================================================
     // AssetCatalog ctor
     //=========================================================================
@@ -184,6 +229,13 @@ namespace AzFramework
         {
             return foundIter->second.m_relativePath;
         }
+        if (m_registry->m_baseRegistry && !m_registry->m_hiddenBaseAssets.contains(id))
+        {
+            if (AZStd::string_view basePath = m_registry->m_baseRegistry->FindAssetPath(id); !basePath.empty())
+            {
+                return basePath;
+            }
+        }
 
         // we did not find it - try the backup mapping!
         AZ::Data::AssetId legacyMapping = m_registry->GetAssetIdByLegacyAssetId(id);
@@ -215,10 +267,10 @@ namespace AzFramework
 
         AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
 
-        auto foundIter = m_registry->m_assetIdToInfo.find(id);
-        if (foundIter != m_registry->m_assetIdToInfo.end())
+        AZ::Data::AssetInfo assetInfo;
+        if (m_registry->FindAssetInfo(id, assetInfo))
         {
-            return foundIter->second;
+            return assetInfo;
         }
 
         // we did not find it - try the backup mapping!
@@ -246,10 +298,9 @@ namespace AzFramework
             AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
 
             AZ::Data::AssetId foundId = m_registry->GetAssetIdByPath(m_pathBuffer.c_str());
-            if (foundId.IsValid())
+            AZ::Data::AssetInfo assetInfo;
+            if (foundId.IsValid() && m_registry->FindAssetInfo(foundId, assetInfo))
             {
-                const AZ::Data::AssetInfo& assetInfo = m_registry->m_assetIdToInfo.find(foundId)->second;
-
                 // If the type is already registered, but with no valid type, allow it to be re-registered.
                 // Otherwise, return the Id.
                 if (!autoRegisterIfNotFound || !assetInfo.m_assetType.IsNull())
@@ -298,10 +349,11 @@ namespace AzFramework
         AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
 
         AZStd::vector<AZStd::string> registeredAssetPaths;
-        for (auto assetIdToInfoPair : m_registry->m_assetIdToInfo)
-        {
-            registeredAssetPaths.emplace_back(assetIdToInfoPair.second.m_relativePath);
-        }
+        registeredAssetPaths.reserve(m_registry->GetAssetCount());
+        m_registry->EnumerateAssets([&registeredAssetPaths](const AZ::Data::AssetId&, const AZ::Data::AssetInfo& assetInfo)
+            {
+                registeredAssetPaths.emplace_back(assetInfo.m_relativePath);
+            });
 
         return registeredAssetPaths;
     }
@@ -309,14 +361,13 @@ namespace AzFramework
     AZ::Outcome<AZStd::vector<AZ::Data::ProductDependency>, AZStd::string> AssetCatalog::GetDirectProductDependencies(const AZ::Data::AssetId& id)
     {
         AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
-        auto itr = m_registry->m_assetDependencies.find(id);
-
-        if (itr == m_registry->m_assetDependencies.end())
+        AZStd::vector<AZ::Data::ProductDependency> dependencies;
+        if (!m_registry->FindAssetDependencies(id, dependencies))
         {
             return AZ::Failure<AZStd::string>("Failed to find asset in dependency map");
         }
 
-        return AZ::Success(itr->second);
+        return AZ::Success(AZStd::move(dependencies));
     }
     
     AZ::Outcome<AZStd::vector<AZ::Data::ProductDependency>, AZStd::string> AssetCatalog::GetAllProductDependencies(const AZ::Data::AssetId& id)
@@ -421,11 +472,9 @@ namespace AzFramework
         using namespace AZ::Data;
 
         AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
-        auto itr = m_registry->m_assetDependencies.find(searchAssetId);
-
-        if (itr != m_registry->m_assetDependencies.end())
+        AZStd::vector<ProductDependency> assetDependencyList;
+        if (m_registry->FindAssetDependencies(searchAssetId, assetDependencyList))
         {
-            AZStd::vector<ProductDependency>& assetDependencyList = itr->second;
 
             for (const ProductDependency& dependency : assetDependencyList)
             {
@@ -498,10 +547,10 @@ namespace AzFramework
         {
             AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
 
-            for (auto& it : m_registry->m_assetIdToInfo)
-            {
-                enumerateCB(it.first, it.second);
-            }
+            m_registry->EnumerateAssets([&enumerateCB](const AZ::Data::AssetId& id, const AZ::Data::AssetInfo& assetInfo)
+                {
+                    enumerateCB(id, assetInfo);
+                });
         }
 
         if (endCB)
@@ -538,10 +587,13 @@ namespace AzFramework
 
             AZ_TracePrintf("AssetCatalog", "Initializing asset catalog with root \"%s\"", m_assetRoot.c_str());
 
+            // The flat catalog is queried in place, so it doesn't need to be deserialized into the registry.
+            AZStd::shared_ptr<FlatAssetRegistry> flatRegistry = AssetCatalogInternal::OpenFlatCatalog(catalogRegistryFile);
+
             // even though this could be a chunk of memory to allocate and deallocate, this is many times faster and more efficient
             // in terms of memory AND fragmentation than allowing it to perform thousands of reads on physical media.
             AZStd::vector<char> bytes;
-            if (catalogRegistryFile && AZ::IO::FileIOBase::GetInstance())
+            if (!flatRegistry && catalogRegistryFile && AZ::IO::FileIOBase::GetInstance())
             {
                 AZ::IO::HandleType handle = AZ::IO::InvalidHandle;
                 AZ::u64 size = 0;
@@ -563,7 +615,7 @@ namespace AzFramework
                 }
             }
 
-            if (!bytes.empty())
+            if (flatRegistry || !bytes.empty())
             {
                 AZStd::shared_ptr < AzFramework::AssetRegistry> prevRegistry;
                 if (!m_initialized)
@@ -572,21 +624,30 @@ namespace AzFramework
                     prevRegistry = AZStd::move(m_registry);
                     m_registry.reset(aznew AssetRegistry());
                 }
-                AZ::IO::MemoryStream catalogStream(bytes.data(), bytes.size());
+
+                if (flatRegistry)
+                {
+                    AZ_TracePrintf("AssetCatalog", "Using flat asset catalog for \"%s\".\n", catalogRegistryFile);
+                    m_registry->SetBaseRegistry(AZStd::move(flatRegistry));
+                }
+                else
+                {
+                    AZ::IO::MemoryStream catalogStream(bytes.data(), bytes.size());
 #if (AZ_TRAIT_PUMP_SYSTEM_EVENTS_WHILE_LOADING)
-                ApplicationRequests::Bus::Broadcast(&ApplicationRequests::PumpSystemEventLoopWhileDoingWorkInNewThread,
-                    AZStd::chrono::milliseconds(AZ_TRAIT_PUMP_SYSTEM_EVENTS_WHILE_LOADING_INTERVAL_MS),
-                    [this, &catalogStream, &serializeContext]
-                    {
-                        AZ::Utils::LoadObjectFromStreamInPlace<AzFramework::AssetRegistry>(catalogStream, *m_registry.get(), serializeContext, AZ::ObjectStream::FilterDescriptor(&AZ::Data::AssetFilterNoAssetLoading));
-                    },
-                        "Asset Catalog Loading Thread"
-                        );
+                    ApplicationRequests::Bus::Broadcast(&ApplicationRequests::PumpSystemEventLoopWhileDoingWorkInNewThread,
+                        AZStd::chrono::milliseconds(AZ_TRAIT_PUMP_SYSTEM_EVENTS_WHILE_LOADING_INTERVAL_MS),
+                        [this, &catalogStream, &serializeContext]
+                        {
+                            AZ::Utils::LoadObjectFromStreamInPlace<AzFramework::AssetRegistry>(catalogStream, *m_registry.get(), serializeContext, AZ::ObjectStream::FilterDescriptor(&AZ::Data::AssetFilterNoAssetLoading));
+                        },
+                            "Asset Catalog Loading Thread"
+                            );
 #else
-                AZ::Utils::LoadObjectFromStreamInPlace<AzFramework::AssetRegistry>(catalogStream, *m_registry.get(), serializeContext, AZ::ObjectStream::FilterDescriptor(&AZ::Data::AssetFilterNoAssetLoading));
+                    AZ::Utils::LoadObjectFromStreamInPlace<AzFramework::AssetRegistry>(catalogStream, *m_registry.get(), serializeContext, AZ::ObjectStream::FilterDescriptor(&AZ::Data::AssetFilterNoAssetLoading));
 #endif // (AZ_TRAIT_PUMP_SYSTEM_EVENTS_WHILE_LOADING)
+                }
 
-                AZ_TracePrintf("AssetCatalog", "Loaded registry containing %u assets.\n", m_registry->m_assetIdToInfo.size());
+                AZ_TracePrintf("AssetCatalog", "Loaded registry containing %zu assets.\n", m_registry->GetAssetCount());
 
                 // It's currently possible in tools for us to have received updates from AP which were applied before the catalog was ready to load
                 // due to CryPak and CrySystem coming online later than our components
@@ -799,8 +860,8 @@ namespace AzFramework
                 AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
 
                 // is it an add or a change?
-                auto assetInfoPair = m_registry->m_assetIdToInfo.find(assetId);
-                isNewAsset = (assetInfoPair == m_registry->m_assetIdToInfo.end());
+                AZ::Data::AssetInfo existingAssetInfo;
+                isNewAsset = !m_registry->FindAssetInfo(assetId, existingAssetInfo);
 
     #if defined(AZ_ENABLE_TRACING)
                 if (message.m_assetType == AZ::Data::s_invalidAssetType)
@@ -809,7 +870,7 @@ namespace AzFramework
                 }
     #endif
 
-                const AZ::Data::AssetType& assetType = isNewAsset ? message.m_assetType : assetInfoPair->second.m_assetType;
+                const AZ::Data::AssetType& assetType = isNewAsset ? message.m_assetType : existingAssetInfo.m_assetType;
 
                 AZ::Data::AssetInfo newData;
                 newData.m_assetId = assetId;
@@ -930,10 +991,10 @@ namespace AzFramework
 #if defined(DEBUG_DUMP_CATALOG)
             AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
 
-            for (auto& it : m_registry->m_assetIdToInfo)
-            {
-                AZ_TracePrintf("Asset Registry: AssetID->Info", "%s --> %s %llu bytes\n", it.first.ToString<AZStd::string>().c_str(), it.second.m_relativePath.c_str(), it.second.m_sizeBytes);
-            }
+            m_registry->EnumerateAssets([](const AZ::Data::AssetId& id, const AZ::Data::AssetInfo& assetInfo)
+                {
+                    AZ_TracePrintf("Asset Registry: AssetID->Info", "%s --> %s %llu bytes\n", id.ToString<AZStd::string>().c_str(), assetInfo.m_relativePath.c_str(), assetInfo.m_sizeBytes);
+                });
 
 #endif
             return true;
@@ -1159,6 +1220,15 @@ namespace AzFramework
         AZ::ComponentApplicationBus::BroadcastResult(serializeContext, &AZ::ComponentApplicationRequests::GetSerializeContext);
         AZ_Assert(serializeContext, "Unable to retrieve serialize context.");
 
+        // Only the maps are serialized, so entries that are still in a flat base registry need to be copied into them first.
+        AZStd::unique_ptr<AzFramework::AssetRegistry> mergedRegistry;
+        if (catalogRegistry && catalogRegistry->GetBaseRegistry())
+        {
+            mergedRegistry = AZStd::make_unique<AzFramework::AssetRegistry>(*catalogRegistry);
+            mergedRegistry->MergeBaseRegistry();
+            catalogRegistry = mergedRegistry.get();
+        }
+
         if(!AZ::Utils::SaveObjectToFile(catalogRegistryFile, AZ::DataStream::ST_BINARY, catalogRegistry, serializeContext))
         {
             AZ_Warning("AssetCatalog", false, "Failed to save catalog file %s", catalogRegistryFile);
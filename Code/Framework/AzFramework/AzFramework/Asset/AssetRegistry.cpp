@@ -8,6 +8,7 @@
  */
 
 #include <AzFramework/Asset/AssetRegistry.h>
+#include <AzFramework/Asset/FlatAssetRegistry.h>
 #include <AzCore/Math/Crc.h>
 #include <AzCore/std/string/conversions.h>
 #include <AzCore/IO/SystemFile.h> // for max path
@@ -63,6 +64,11 @@ namespace AzFramework
     {
         m_assetIdToInfo = AssetIdToInfoMap();
         m_assetPathToId = AssetPathToIdMap();
+        m_baseRegistry.reset();
+        m_hiddenBaseAssets.clear();
+        m_hiddenBaseDependencies.clear();
+        m_hiddenBaseLegacyIds.clear();
+        m_hiddenBasePaths.clear();
     }
 
     //=========================================================================
@@ -121,6 +127,7 @@ namespace AzFramework
         
         SetAssetIdByPath(assetInfo.m_relativePath.c_str(), id);
         m_assetIdToInfo.insert_key(id).first->second = assetInfo;
+        HideBaseAsset(id);
     }
 
     //=========================================================================
@@ -132,14 +139,21 @@ namespace AzFramework
         // When you delete an asset (ie, its actual data is gone) it MUST be removed from the [Id] -> [AssetInfo] map
         // and its irrelevant whether it gets removed from the [Path] -> [Id] map because that hash is only used
         // to resolve Ids, and if that resolved Id points at a missing asset, the [Path] -> [Id] map will know that.
-        auto existingAsset = m_assetIdToInfo.find(id);
-        if (existingAsset != m_assetIdToInfo.end())
+        AZ::Data::AssetInfo existingAsset;
+        if (FindAssetInfo(id, existingAsset))
         {
-            m_assetPathToId.erase(CreateUUIDForName(existingAsset->second.m_relativePath.c_str()));
+            AZ::Uuid pathHash = CreateUUIDForName(existingAsset.m_relativePath.c_str());
+            m_assetPathToId.erase(pathHash);
+            if (m_baseRegistry)
+            {
+                m_hiddenBasePaths.insert(pathHash);
+            }
         }
         
         m_assetIdToInfo.erase(id);
         m_assetDependencies.erase(id);
+        HideBaseAsset(id);
+        HideBaseAssetDependencies(id);
     }
 
     void AssetRegistry::RegisterLegacyAssetMapping(const AZ::Data::AssetId& legacyId, const AZ::Data::AssetId& newId)
@@ -150,21 +164,44 @@ namespace AzFramework
     void AssetRegistry::UnregisterLegacyAssetMapping(const AZ::Data::AssetId& legacyId)
     {
         m_legacyAssetIdToRealAssetId.erase(legacyId);
+        if (m_baseRegistry && m_baseRegistry->FindAssetIdByLegacyAssetId(legacyId).IsValid())
+        {
+            m_hiddenBaseLegacyIds.insert(legacyId);
+        }
     }
 
     void AssetRegistry::SetAssetDependencies(const AZ::Data::AssetId& id, const AZStd::vector<AZ::Data::ProductDependency>& dependencies)
     {
         m_assetDependencies[id] = dependencies;
+        HideBaseAssetDependencies(id);
     }
 
     void AssetRegistry::RegisterAssetDependency(const AZ::Data::AssetId& id, const AZ::Data::ProductDependency& dependency)
     {
-        m_assetDependencies[id].push_back(dependency);
+        auto it = m_assetDependencies.find(id);
+        if (it == m_assetDependencies.end())
+        {
+            // Start from the dependencies in the base registry, if any, as this dependency is added to those.
+            it = m_assetDependencies.emplace(id, AZStd::vector<AZ::Data::ProductDependency>()).first;
+            if (m_baseRegistry && !m_hiddenBaseDependencies.contains(id))
+            {
+                m_baseRegistry->FindAssetDependencies(id, it->second);
+            }
+            HideBaseAssetDependencies(id);
+        }
+        it->second.push_back(dependency);
     }
 
     AZStd::vector<AZ::Data::ProductDependency> AssetRegistry::GetAssetDependencies(const AZ::Data::AssetId& id)
     {
-        return m_assetDependencies[id];
+        AZStd::vector<AZ::Data::ProductDependency> dependencies;
+        if (!FindAssetDependencies(id, dependencies))
+        {
+            // Matches the original behavior of registering an empty list of dependencies for the asset.
+            m_assetDependencies[id];
+            HideBaseAssetDependencies(id);
+        }
+        return dependencies;
     }
 
     AZ::Data::AssetId AssetRegistry::GetAssetIdByLegacyAssetId(const AZ::Data::AssetId& legacyAssetId) const
@@ -174,6 +211,10 @@ namespace AzFramework
         {
             return found->second;
         }
+        if (m_baseRegistry && !m_hiddenBaseLegacyIds.contains(legacyAssetId))
+        {
+            return m_baseRegistry->FindAssetIdByLegacyAssetId(legacyAssetId);
+        }
         return AZ::Data::AssetId();
     }
 
@@ -189,6 +230,18 @@ namespace AzFramework
                 subset.insert(legacyToRealPair);
             }
         }
+        if (m_baseRegistry)
+        {
+            m_baseRegistry->EnumerateLegacyMappings(
+                [this, &subset, realIdsBeginItr, realIdsEndItr](const AZ::Data::AssetId& legacyId, const AZ::Data::AssetId& realId)
+                {
+                    if (!m_hiddenBaseLegacyIds.contains(legacyId) && !m_legacyAssetIdToRealAssetId.contains(legacyId) &&
+                        AZStd::find(realIdsBeginItr, realIdsEndItr, realId) != realIdsEndItr)
+                    {
+                        subset.emplace(legacyId, realId);
+                    }
+                });
+        }
         return subset;
     }
 
@@ -200,11 +253,16 @@ namespace AzFramework
             return AZ::Data::AssetId(); 
         }
 
-        auto entry = m_assetPathToId.find(CreateUUIDForName(assetPath));
+        AZ::Uuid pathHash = CreateUUIDForName(assetPath);
+        auto entry = m_assetPathToId.find(pathHash);
         if (entry != m_assetPathToId.end())
         {
             return entry->second;
         }
+        if (m_baseRegistry && !m_hiddenBasePaths.contains(pathHash))
+        {
+            return m_baseRegistry->FindAssetIdByPathHash(pathHash);
+        }
         return AZ::Data::AssetId();
     }
 
@@ -225,12 +283,15 @@ namespace AzFramework
         for (const auto& element : assetRegistry->m_assetIdToInfo)
         {
             m_assetIdToInfo[element.first] = element.second;
+            HideBaseAsset(element.first);
             // remove dependency info that exists for this asset, as the change could have removed any dependenices this asset had.
             m_assetDependencies.erase(element.first);   
+            HideBaseAssetDependencies(element.first);
         }
         for (const auto& element : assetRegistry->m_assetDependencies)
         {
             m_assetDependencies[element.first] = element.second;
+            HideBaseAssetDependencies(element.first);
         }
         for (const auto& element : assetRegistry->m_assetPathToId)
         {
@@ -242,4 +303,123 @@ namespace AzFramework
         }
     }
 
+    void AssetRegistry::SetBaseRegistry(AZStd::shared_ptr<const FlatAssetRegistry> baseRegistry)
+    {
+        Clear();
+        m_assetDependencies = {};
+        m_legacyAssetIdToRealAssetId = {};
+        m_baseRegistry = AZStd::move(baseRegistry);
+    }
+
+    const AZStd::shared_ptr<const FlatAssetRegistry>& AssetRegistry::GetBaseRegistry() const
+    {
+        return m_baseRegistry;
+    }
+
+    void AssetRegistry::MergeBaseRegistry()
+    {
+        if (!m_baseRegistry)
+        {
+            return;
+        }
+
+        // Entries that are in the maps override the base registry, so only add entries that aren't in the maps yet.
+        m_baseRegistry->EnumerateAssets([this](const AZ::Data::AssetId& id, const AZ::Data::AssetInfo& assetInfo)
+            {
+                if (!m_hiddenBaseAssets.contains(id))
+                {
+                    m_assetIdToInfo.emplace(id, assetInfo);
+                }
+            });
+        m_baseRegistry->EnumeratePaths([this](const AZ::Uuid& pathHash, const AZ::Data::AssetId& id)
+            {
+                if (!m_hiddenBasePaths.contains(pathHash))
+                {
+                    m_assetPathToId.emplace(pathHash, id);
+                }
+            });
+        m_baseRegistry->EnumerateLegacyMappings([this](const AZ::Data::AssetId& legacyId, const AZ::Data::AssetId& realId)
+            {
+                if (!m_hiddenBaseLegacyIds.contains(legacyId))
+                {
+                    m_legacyAssetIdToRealAssetId.emplace(legacyId, realId);
+                }
+            });
+        m_baseRegistry->EnumerateAssetDependencies(
+            [this](const AZ::Data::AssetId& id, const AZStd::vector<AZ::Data::ProductDependency>& dependencies)
+            {
+                if (!m_hiddenBaseDependencies.contains(id))
+                {
+                    m_assetDependencies.emplace(id, dependencies);
+                }
+            });
+
+        m_baseRegistry.reset();
+        m_hiddenBaseAssets.clear();
+        m_hiddenBaseDependencies.clear();
+        m_hiddenBaseLegacyIds.clear();
+        m_hiddenBasePaths.clear();
+    }
+
+    bool AssetRegistry::FindAssetInfo(const AZ::Data::AssetId& id, AZ::Data::AssetInfo& assetInfo) const
+    {
+        if (auto it = m_assetIdToInfo.find(id); it != m_assetIdToInfo.end())
+        {
+            assetInfo = it->second;
+            return true;
+        }
+        return m_baseRegistry && !m_hiddenBaseAssets.contains(id) && m_baseRegistry->FindAssetInfo(id, assetInfo);
+    }
+
+    bool AssetRegistry::FindAssetDependencies(const AZ::Data::AssetId& id, AZStd::vector<AZ::Data::ProductDependency>& dependencies) const
+    {
+        if (auto it = m_assetDependencies.find(id); it != m_assetDependencies.end())
+        {
+            dependencies = it->second;
+            return true;
+        }
+        return m_baseRegistry && !m_hiddenBaseDependencies.contains(id) && m_baseRegistry->FindAssetDependencies(id, dependencies);
+    }
+
+    size_t AssetRegistry::GetAssetCount() const
+    {
+        // Hidden assets are always in the base registry, so they don't need to be looked up.
+        size_t baseCount = m_baseRegistry ? m_baseRegistry->GetAssetCount() - m_hiddenBaseAssets.size() : 0;
+        return m_assetIdToInfo.size() + baseCount;
+    }
+
+    void AssetRegistry::EnumerateAssets(const AssetInfoCallback& callback) const
+    {
+        for (const auto& [id, assetInfo] : m_assetIdToInfo)
+        {
+            callback(id, assetInfo);
+        }
+        if (m_baseRegistry)
+        {
+            m_baseRegistry->EnumerateAssets([this, &callback](const AZ::Data::AssetId& id, const AZ::Data::AssetInfo& assetInfo)
+                {
+                    if (!m_hiddenBaseAssets.contains(id))
+                    {
+                        callback(id, assetInfo);
+                    }
+                });
+        }
+    }
+
+    void AssetRegistry::HideBaseAsset(const AZ::Data::AssetId& id)
+    {
+        if (m_baseRegistry && m_baseRegistry->ContainsAsset(id))
+        {
+            m_hiddenBaseAssets.insert(id);
+        }
+    }
+
+    void AssetRegistry::HideBaseAssetDependencies(const AZ::Data::AssetId& id)
+    {
+        if (m_baseRegistry && m_baseRegistry->ContainsAssetDependencies(id))
+        {
+            m_hiddenBaseDependencies.insert(id);
+        }
+    }
+
 } // namespace AzFramework
@@ -13,10 +13,14 @@
 #include <AzCore/Asset/AssetManagerBus.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/functional.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
 
 namespace AzFramework
 {
+    class FlatAssetRegistry;
+
     /**
     * Data storage for asset registry.
     * Maintained separate to facilitate easy serialization to/from disk.
@@ -24,6 +28,7 @@ namespace AzFramework
     class AssetRegistry
     {
         friend class AssetCatalog;
+        friend class FlatAssetRegistry;
     public:
         AZ_TYPE_INFO(AssetRegistry, "{5DBC20D9-7143-48B3-ADEE-CCBD2FA6D443}");
         AZ_CLASS_ALLOCATOR(AssetRegistry, AZ::SystemAllocator, 0);
@@ -59,6 +64,21 @@ namespace AzFramework
 
         static void ReflectSerialize(AZ::SerializeContext* serializeContext);
 
+        //! Uses a flat asset catalog as the base layer of this registry. The flat catalog is queried in place instead of being
+        //! loaded into the maps above. Assets, dependencies and mappings that are registered or unregistered afterwards are
+        //! tracked in the maps and take precedence over the base registry. Anything that was already in this registry is removed.
+        //! A registry with a base registry has to be queried through the functions below instead of through the public maps.
+        void SetBaseRegistry(AZStd::shared_ptr<const FlatAssetRegistry> baseRegistry);
+        const AZStd::shared_ptr<const FlatAssetRegistry>& GetBaseRegistry() const;
+        //! Copies the remaining entries of the base registry into the maps and releases the base registry.
+        void MergeBaseRegistry();
+
+        bool FindAssetInfo(const AZ::Data::AssetId& id, AZ::Data::AssetInfo& assetInfo) const;
+        bool FindAssetDependencies(const AZ::Data::AssetId& id, AZStd::vector<AZ::Data::ProductDependency>& dependencies) const;
+        size_t GetAssetCount() const;
+        using AssetInfoCallback = AZStd::function<void(const AZ::Data::AssetId&, const AZ::Data::AssetInfo&)>;
+        void EnumerateAssets(const AssetInfoCallback& callback) const;
+
     private:
         // Add another registry to our existing registry data.  Intended to be called by AssetCatalog::AddDeltaCatalog
         void AddRegistry(AZStd::shared_ptr<AssetRegistry> assetRegistry);
@@ -74,6 +94,15 @@ namespace AzFramework
         //! Called automatically by RegisterAsset.
         void SetAssetIdByPath(const char* assetPath, const AZ::Data::AssetId& id);
 
+        // Entries in the base registry that have been overridden or removed.
+        void HideBaseAsset(const AZ::Data::AssetId& id);
+        void HideBaseAssetDependencies(const AZ::Data::AssetId& id);
+
+        AZStd::shared_ptr<const FlatAssetRegistry> m_baseRegistry;
+        AZStd::unordered_set<AZ::Data::AssetId> m_hiddenBaseAssets;
+        AZStd::unordered_set<AZ::Data::AssetId> m_hiddenBaseDependencies;
+        AZStd::unordered_set<AZ::Data::AssetId> m_hiddenBaseLegacyIds;
+        AZStd::unordered_set<AZ::Uuid> m_hiddenBasePaths;
     };
 
 } // namespace AzFramework
@@ -0,0 +1,738 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/sort.h>
+#include <AzFramework/Asset/AssetRegistry.h>
+#include <AzFramework/Asset/FlatAssetRegistry.h>
+
+namespace AzFramework
+{
+    namespace Platform
+    {
+        //! Maps a file into memory for reading. Returns null if the file can't be mapped.
+        const char* MapFlatAssetRegistry(const char* filePath, size_t& size);
+        void UnmapFlatAssetRegistry(const char* data, size_t size);
+    }
+
+    namespace FlatAssetRegistryInternal
+    {
+        // Every table entry starts with a 20 byte key, which is the 16 byte guid of an asset id followed by the sub id.
+        // Ids are stored as bytes so the records don't require padding.
+        constexpr size_t KeySize = 20;
+
+        struct Table
+        {
+            AZ::u64 m_offset;
+            AZ::u64 m_bucketsOffset;
+            AZ::u32 m_count;
+            AZ::u32 m_bucketBits;
+        };
+
+        struct Header
+        {
+            AZ::u32 m_signature;
+            AZ::u32 m_version;
+            AZ::u64 m_fileSize;
+            Table m_assets;
+            Table m_paths;
+            Table m_legacyIds;
+            Table m_dependencyLists;
+            AZ::u64 m_dependenciesOffset;
+            AZ::u64 m_dependencyCount;
+            AZ::u64 m_stringsOffset;
+            AZ::u64 m_stringsSize;
+        };
+
+        struct AssetEntry
+        {
+            AZ::u8 m_key[KeySize];
+            AZ::u8 m_infoId[KeySize];
+            AZ::u8 m_assetType[16];
+            AZ::u32 m_pathOffset;
+            AZ::u32 m_pathLength;
+            AZ::u64 m_sizeBytes;
+        };
+
+        // The path hash is stored as an asset id with a sub id of zero so all tables can use the same lookup.
+        struct PathEntry
+        {
+            AZ::u8 m_key[KeySize];
+            AZ::u8 m_assetId[KeySize];
+        };
+
+        struct LegacyEntry
+        {
+            AZ::u8 m_key[KeySize];
+            AZ::u8 m_assetId[KeySize];
+        };
+
+        struct DependencyListEntry
+        {
+            AZ::u8 m_key[KeySize];
+            AZ::u32 m_first;
+            AZ::u32 m_count;
+        };
+
+        struct DependencyEntry
+        {
+            AZ::u8 m_assetId[KeySize];
+            AZ::u32 m_padding;
+            AZ::u64 m_flags;
+        };
+
+        static_assert(sizeof(Header) == 144, "The layout of the flat asset catalog header changed, update the version.");
+        static_assert(sizeof(AssetEntry) == 72, "The layout of the flat asset catalog entries changed, update the version.");
+        static_assert(sizeof(PathEntry) == 40, "The layout of the flat asset catalog entries changed, update the version.");
+        static_assert(sizeof(LegacyEntry) == 40, "The layout of the flat asset catalog entries changed, update the version.");
+        static_assert(sizeof(DependencyListEntry) == 28, "The layout of the flat asset catalog entries changed, update the version.");
+        static_assert(sizeof(DependencyEntry) == 32, "The layout of the flat asset catalog entries changed, update the version.");
+
+        // Tables and the data in them are aligned to this so records can be accessed in place.
+        constexpr size_t Alignment = 8;
+        // Upper limit for the size of the radix index, which is 4 bytes per bucket.
+        constexpr AZ::u32 MaxBucketBits = 20;
+
+        AZ::u32 GetKeyPrefix(const AZ::u8* guid)
+        {
+            return (AZ::u32(guid[0]) << 24) | (AZ::u32(guid[1]) << 16) | (AZ::u32(guid[2]) << 8) | AZ::u32(guid[3]);
+        }
+
+        AZ::u32 GetBucket(const AZ::u8* guid, AZ::u32 bucketBits)
+        {
+            return bucketBits == 0 ? 0 : GetKeyPrefix(guid) >> (32 - bucketBits);
+        }
+
+        AZ::u32 CalculateBucketBits(size_t count)
+        {
+            // Aim for two entries per bucket on average.
+            AZ::u32 bits = 0;
+            while (bits < MaxBucketBits && (size_t(2) << bits) <= count)
+            {
+                ++bits;
+            }
+            return bits;
+        }
+
+        void StoreAssetId(AZ::u8* target, const AZ::Data::AssetId& assetId)
+        {
+            memcpy(target, assetId.m_guid.begin(), 16);
+            memcpy(target + 16, &assetId.m_subId, sizeof(AZ::u32));
+        }
+
+        void StoreAssetId(AZ::u8* target, const AZ::Uuid& guid)
+        {
+            StoreAssetId(target, AZ::Data::AssetId(guid, 0));
+        }
+
+        AZ::Data::AssetId LoadAssetId(const AZ::u8* source)
+        {
+            AZ::Data::AssetId result;
+            memcpy(result.m_guid.begin(), source, 16);
+            memcpy(&result.m_subId, source + 16, sizeof(AZ::u32));
+            return result;
+        }
+
+        // Keys are ordered by the bytes of the guid followed by the sub id, which is consistent with the key prefix
+        // that's used for the radix index.
+        int CompareKeys(const AZ::u8* lhs, const AZ::u8* rhs)
+        {
+            if (int result = memcmp(lhs, rhs, 16); result != 0)
+            {
+                return result;
+            }
+            AZ::u32 lhsSubId;
+            AZ::u32 rhsSubId;
+            memcpy(&lhsSubId, lhs + 16, sizeof(AZ::u32));
+            memcpy(&rhsSubId, rhs + 16, sizeof(AZ::u32));
+            return lhsSubId < rhsSubId ? -1 : (lhsSubId > rhsSubId ? 1 : 0);
+        }
+
+        class Writer
+        {
+        public:
+            explicit Writer(AZStd::vector<char>& output)
+                : m_output(output)
+            {
+            }
+
+            size_t Reserve(size_t size)
+            {
+                size_t offset = AZ_SIZE_ALIGN_UP(m_output.size(), Alignment);
+                m_output.resize(offset + size, 0);
+                return offset;
+            }
+
+            template<typename T>
+            T* Get(size_t offset)
+            {
+                return reinterpret_cast<T*>(m_output.data() + offset);
+            }
+
+            // Adds the sorted entries and the radix index for them. Every entry starts with the 20 byte key.
+            template<typename Entry>
+            void AddTable(const AZStd::vector<Entry>& entries, size_t tableOffset)
+            {
+                AZ::u32 bucketBits = CalculateBucketBits(entries.size());
+                size_t entriesOffset = Reserve(entries.size() * sizeof(Entry));
+                if (!entries.empty())
+                {
+                    memcpy(m_output.data() + entriesOffset, entries.data(), entries.size() * sizeof(Entry));
+                }
+
+                // Every bucket stores the index of the first entry with a key prefix in or after the bucket. The extra bucket at
+                // the end marks the end of the last bucket.
+                size_t bucketCount = (size_t(1) << bucketBits) + 1;
+                size_t bucketsOffset = Reserve(bucketCount * sizeof(AZ::u32));
+                AZ::u32* buckets = Get<AZ::u32>(bucketsOffset);
+                size_t entryIndex = 0;
+                for (size_t bucket = 0; bucket < bucketCount; ++bucket)
+                {
+                    while (entryIndex < entries.size() &&
+                        GetBucket(reinterpret_cast<const AZ::u8*>(&entries[entryIndex]), bucketBits) < bucket)
+                    {
+                        ++entryIndex;
+                    }
+                    buckets[bucket] = aznumeric_cast<AZ::u32>(entryIndex);
+                }
+
+                Table* table = Get<Table>(tableOffset);
+                table->m_offset = entriesOffset;
+                table->m_bucketsOffset = bucketsOffset;
+                table->m_count = aznumeric_cast<AZ::u32>(entries.size());
+                table->m_bucketBits = bucketBits;
+            }
+
+        private:
+            AZStd::vector<char>& m_output;
+        };
+
+        template<typename Entry>
+        void SortEntries(AZStd::vector<Entry>& entries)
+        {
+            AZStd::sort(entries.begin(), entries.end(), [](const Entry& lhs, const Entry& rhs)
+                {
+                    return CompareKeys(reinterpret_cast<const AZ::u8*>(&lhs), reinterpret_cast<const AZ::u8*>(&rhs)) < 0;
+                });
+        }
+    } // namespace FlatAssetRegistryInternal
+
+    FlatAssetRegistry::~FlatAssetRegistry()
+    {
+        Close();
+    }
+
+    bool FlatAssetRegistry::Write(const AssetRegistry& registry, AZStd::vector<char>& output)
+    {
+        using namespace FlatAssetRegistryInternal;
+
+        if (registry.GetBaseRegistry())
+        {
+            AssetRegistry mergedRegistry(registry);
+            mergedRegistry.MergeBaseRegistry();
+            return Write(mergedRegistry, output);
+        }
+
+        // Intern the relative paths. Different ids can point to the same file, for instance through legacy ids.
+        AZStd::vector<char> strings;
+        AZStd::unordered_map<AZStd::string_view, AZ::u32> stringOffsets;
+        auto internString = [&strings, &stringOffsets](AZStd::string_view value) -> AZ::u32
+        {
+            auto [it, inserted] = stringOffsets.emplace(value, aznumeric_cast<AZ::u32>(strings.size()));
+            if (inserted)
+            {
+                strings.insert(strings.end(), value.begin(), value.end());
+                // Terminate the strings to make the file easier to inspect. The length is stored separately.
+                strings.push_back(0);
+            }
+            return it->second;
+        };
+
+        AZStd::vector<AssetEntry> assets;
+        assets.reserve(registry.m_assetIdToInfo.size());
+        stringOffsets.reserve(registry.m_assetIdToInfo.size());
+        for (const auto& [assetId, assetInfo] : registry.m_assetIdToInfo)
+        {
+            AssetEntry& entry = assets.emplace_back();
+            StoreAssetId(entry.m_key, assetId);
+            StoreAssetId(entry.m_infoId, assetInfo.m_assetId);
+            memcpy(entry.m_assetType, assetInfo.m_assetType.begin(), sizeof(entry.m_assetType));
+            entry.m_pathOffset = internString(assetInfo.m_relativePath);
+            entry.m_pathLength = aznumeric_cast<AZ::u32>(assetInfo.m_relativePath.size());
+            entry.m_sizeBytes = assetInfo.m_sizeBytes;
+        }
+        SortEntries(assets);
+
+        AZStd::vector<PathEntry> paths;
+        paths.reserve(registry.m_assetPathToId.size());
+        for (const auto& [pathHash, assetId] : registry.m_assetPathToId)
+        {
+            PathEntry& entry = paths.emplace_back();
+            StoreAssetId(entry.m_key, pathHash);
+            StoreAssetId(entry.m_assetId, assetId);
+        }
+        SortEntries(paths);
+
+        AZStd::vector<LegacyEntry> legacyIds;
+        legacyIds.reserve(registry.m_legacyAssetIdToRealAssetId.size());
+        for (const auto& [legacyId, realId] : registry.m_legacyAssetIdToRealAssetId)
+        {
+            LegacyEntry& entry = legacyIds.emplace_back();
+            StoreAssetId(entry.m_key, legacyId);
+            StoreAssetId(entry.m_assetId, realId);
+        }
+        SortEntries(legacyIds);
+
+        // The dependency lists are sorted first so the dependencies of neighboring assets are also neighbors in the file.
+        AZStd::vector<DependencyListEntry> dependencyLists;
+        dependencyLists.reserve(registry.m_assetDependencies.size());
+        for (const auto& [assetId, dependencies] : registry.m_assetDependencies)
+        {
+            DependencyListEntry& entry = dependencyLists.emplace_back();
+            StoreAssetId(entry.m_key, assetId);
+            entry.m_first = 0;
+            entry.m_count = aznumeric_cast<AZ::u32>(dependencies.size());
+        }
+        SortEntries(dependencyLists);
+
+        AZStd::vector<DependencyEntry> dependencies;
+        for (DependencyListEntry& entry : dependencyLists)
+        {
+            entry.m_first = aznumeric_cast<AZ::u32>(dependencies.size());
+            auto it = registry.m_assetDependencies.find(LoadAssetId(entry.m_key));
+            for (const AZ::Data::ProductDependency& dependency : it->second)
+            {
+                DependencyEntry& dependencyEntry = dependencies.emplace_back();
+                StoreAssetId(dependencyEntry.m_assetId, dependency.m_assetId);
+                dependencyEntry.m_padding = 0;
+                dependencyEntry.m_flags = dependency.m_flags.to_ullong();
+            }
+        }
+
+        output.clear();
+        Writer writer(output);
+        size_t headerOffset = writer.Reserve(sizeof(Header));
+        writer.AddTable(assets, headerOffset + offsetof(Header, m_assets));
+        writer.AddTable(paths, headerOffset + offsetof(Header, m_paths));
+        writer.AddTable(legacyIds, headerOffset + offsetof(Header, m_legacyIds));
+        writer.AddTable(dependencyLists, headerOffset + offsetof(Header, m_dependencyLists));
+
+        size_t dependenciesOffset = writer.Reserve(dependencies.size() * sizeof(DependencyEntry));
+        if (!dependencies.empty())
+        {
+            memcpy(output.data() + dependenciesOffset, dependencies.data(), dependencies.size() * sizeof(DependencyEntry));
+        }
+        size_t stringsOffset = writer.Reserve(strings.size());
+        if (!strings.empty())
+        {
+            memcpy(output.data() + stringsOffset, strings.data(), strings.size());
+        }
+        writer.Reserve(0);
+
+        Header* header = writer.Get<Header>(headerOffset);
+        header->m_signature = Signature;
+        header->m_version = Version;
+        header->m_fileSize = output.size();
+        header->m_dependenciesOffset = dependenciesOffset;
+        header->m_dependencyCount = dependencies.size();
+        header->m_stringsOffset = stringsOffset;
+        header->m_stringsSize = strings.size();
+        return true;
+    }
+
+    bool FlatAssetRegistry::Open(const char* filePath)
+    {
+        Close();
+
+        AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance();
+        if (!filePath || !fileIO)
+        {
+            return false;
+        }
+
+        // Map the file if it's directly available on disk. Files that are for instance stored in an archive or an Android apk
+        // fail to map and are read through the FileIO instead.
+        AZ::IO::FixedMaxPath resolvedPath;
+        if (fileIO->ResolvePath(resolvedPath, filePath))
+        {
+            size_t mappedSize = 0;
+            if (const char* mappedData = Platform::MapFlatAssetRegistry(resolvedPath.c_str(), mappedSize); mappedData != nullptr)
+            {
+                m_mappedData = mappedData;
+                m_mappedSize = mappedSize;
+                m_data = mappedData;
+                m_size = mappedSize;
+                if (!Validate())
+                {
+                    AZ_Warning("FlatAssetRegistry", false, "Flat asset catalog '%s' is not valid and will be ignored.", filePath);
+                    Close();
+                    return false;
+                }
+                return true;
+            }
+        }
+
+        AZ::u64 fileSize = 0;
+        if (!fileIO->Size(filePath, fileSize) || fileSize == 0)
+        {
+            return false;
+        }
+
+        AZ::IO::HandleType handle = AZ::IO::InvalidHandle;
+        if (!fileIO->Open(filePath, AZ::IO::OpenMode::ModeRead | AZ::IO::OpenMode::ModeBinary, handle))
+        {
+            return false;
+        }
+        m_buffer.resize_no_construct(AZ_SIZE_ALIGN_UP(fileSize, sizeof(AZ::u64)) / sizeof(AZ::u64));
+        bool readResult = fileIO->Read(handle, m_buffer.data(), fileSize, true);
+        fileIO->Close(handle);
+        if (!readResult)
+        {
+            AZ_Warning("FlatAssetRegistry", false, "Failed to read flat asset catalog '%s'.", filePath);
+            Close();
+            return false;
+        }
+
+        m_data = reinterpret_cast<const char*>(m_buffer.data());
+        m_size = aznumeric_cast<size_t>(fileSize);
+        if (!Validate())
+        {
+            AZ_Warning("FlatAssetRegistry", false, "Flat asset catalog '%s' is not valid and will be ignored.", filePath);
+            Close();
+            return false;
+        }
+        return true;
+    }
+
+    bool FlatAssetRegistry::Open(const void* data, size_t size)
+    {
+        Close();
+        if (!data || size == 0)
+        {
+            return false;
+        }
+
+        m_buffer.resize_no_construct(AZ_SIZE_ALIGN_UP(size, sizeof(AZ::u64)) / sizeof(AZ::u64));
+        memcpy(m_buffer.data(), data, size);
+        m_data = reinterpret_cast<const char*>(m_buffer.data());
+        m_size = size;
+        if (!Validate())
+        {
+            Close();
+            return false;
+        }
+        return true;
+    }
+
+    void FlatAssetRegistry::Close()
+    {
+        if (m_mappedData)
+        {
+            Platform::UnmapFlatAssetRegistry(m_mappedData, m_mappedSize);
+            m_mappedData = nullptr;
+            m_mappedSize = 0;
+        }
+        m_buffer = {};
+        m_data = nullptr;
+        m_size = 0;
+    }
+
+    bool FlatAssetRegistry::IsOpen() const
+    {
+        return m_data != nullptr;
+    }
+
+    bool FlatAssetRegistry::IsMemoryMapped() const
+    {
+        return m_mappedData != nullptr;
+    }
+
+    bool FlatAssetRegistry::Validate()
+    {
+        using namespace FlatAssetRegistryInternal;
+
+        if (m_size < sizeof(Header))
+        {
+            return false;
+        }
+
+        const Header& header = GetHeader();
+        if (header.m_signature != Signature || header.m_version != Version || header.m_fileSize != m_size)
+        {
+            return false;
+        }
+
+        auto isInRange = [this](AZ::u64 offset, AZ::u64 count, AZ::u64 elementSize) -> bool
+        {
+            return offset % Alignment == 0 && offset <= m_size && count <= (m_size - offset) / elementSize;
+        };
+
+        auto validateTable = [this, &isInRange](const Table& table, size_t entrySize) -> bool
+        {
+            if (table.m_bucketBits > MaxBucketBits || !isInRange(table.m_offset, table.m_count, entrySize))
+            {
+                return false;
+            }
+            AZ::u64 bucketCount = (AZ::u64(1) << table.m_bucketBits) + 1;
+            if (!isInRange(table.m_bucketsOffset, bucketCount, sizeof(AZ::u32)))
+            {
+                return false;
+            }
+
+            // Make sure that the index never points outside the table so lookups don't need to check this.
+            const AZ::u32* buckets = reinterpret_cast<const AZ::u32*>(m_data + table.m_bucketsOffset);
+            AZ::u32 previous = 0;
+            for (AZ::u64 i = 0; i < bucketCount; ++i)
+            {
+                if (buckets[i] < previous || buckets[i] > table.m_count)
+                {
+                    return false;
+                }
+                previous = buckets[i];
+            }
+            return buckets[bucketCount - 1] == table.m_count;
+        };
+
+        return
+            validateTable(header.m_assets, sizeof(AssetEntry)) &&
+            validateTable(header.m_paths, sizeof(PathEntry)) &&
+            validateTable(header.m_legacyIds, sizeof(LegacyEntry)) &&
+            validateTable(header.m_dependencyLists, sizeof(DependencyListEntry)) &&
+            isInRange(header.m_dependenciesOffset, header.m_dependencyCount, sizeof(DependencyEntry)) &&
+            header.m_stringsOffset <= m_size && header.m_stringsSize <= m_size - header.m_stringsOffset;
+    }
+
+    auto FlatAssetRegistry::GetHeader() const -> const Header&
+    {
+        return *reinterpret_cast<const Header*>(m_data);
+    }
+
+    template<typename Entry>
+    const Entry* FlatAssetRegistry::GetEntries(const Table& table) const
+    {
+        return reinterpret_cast<const Entry*>(m_data + table.m_offset);
+    }
+
+    template<typename Entry>
+    const Entry* FlatAssetRegistry::FindEntry(const Table& table, const AZ::Data::AssetId& key) const
+    {
+        using namespace FlatAssetRegistryInternal;
+
+        if (!m_data || table.m_count == 0)
+        {
+            return nullptr;
+        }
+
+        AZ::u8 flatKey[KeySize];
+        StoreAssetId(flatKey, key);
+
+        const AZ::u32* buckets = reinterpret_cast<const AZ::u32*>(m_data + table.m_bucketsOffset);
+        AZ::u32 bucket = GetBucket(flatKey, table.m_bucketBits);
+        const Entry* entries = GetEntries<Entry>(table);
+        const Entry* first = entries + buckets[bucket];
+        const Entry* last = entries + buckets[bucket + 1];
+        const Entry* found = AZStd::lower_bound(first, last, flatKey, [](const Entry& entry, const AZ::u8* value)
+            {
+                return CompareKeys(reinterpret_cast<const AZ::u8*>(&entry), value) < 0;
+            });
+        return (found != last && CompareKeys(reinterpret_cast<const AZ::u8*>(found), flatKey) == 0) ? found : nullptr;
+    }
+
+    AZStd::string_view FlatAssetRegistry::GetString(AZ::u32 offset, AZ::u32 length) const
+    {
+        const Header& header = GetHeader();
+        if (offset > header.m_stringsSize || length > header.m_stringsSize - offset)
+        {
+            AZ_Error("FlatAssetRegistry", false, "String in flat asset catalog is out of bounds.");
+            return {};
+        }
+        return AZStd::string_view(m_data + header.m_stringsOffset + offset, length);
+    }
+
+    void FlatAssetRegistry::ToAssetInfo(const AssetEntry& entry, AZ::Data::AssetInfo& assetInfo) const
+    {
+        using namespace FlatAssetRegistryInternal;
+
+        assetInfo.m_assetId = LoadAssetId(entry.m_infoId);
+        memcpy(assetInfo.m_assetType.begin(), entry.m_assetType, sizeof(entry.m_assetType));
+        assetInfo.m_relativePath = GetString(entry.m_pathOffset, entry.m_pathLength);
+        assetInfo.m_sizeBytes = entry.m_sizeBytes;
+    }
+
+    void FlatAssetRegistry::ToDependencies(
+        const DependencyListEntry& entry, AZStd::vector<AZ::Data::ProductDependency>& dependencies) const
+    {
+        using namespace FlatAssetRegistryInternal;
+
+        dependencies.clear();
+        const Header& header = GetHeader();
+        if (entry.m_first > header.m_dependencyCount || entry.m_count > header.m_dependencyCount - entry.m_first)
+        {
+            AZ_Error("FlatAssetRegistry", false, "Dependency list in flat asset catalog is out of bounds.");
+            return;
+        }
+
+        const DependencyEntry* first = reinterpret_cast<const DependencyEntry*>(m_data + header.m_dependenciesOffset) + entry.m_first;
+        dependencies.reserve(entry.m_count);
+        for (const DependencyEntry* it = first; it != first + entry.m_count; ++it)
+        {
+            dependencies.emplace_back(LoadAssetId(it->m_assetId), AZ::Data::ProductDependencyInfo::ProductDependencyFlags(it->m_flags));
+        }
+    }
+
+    size_t FlatAssetRegistry::GetAssetCount() const
+    {
+        return m_data ? GetHeader().m_assets.m_count : 0;
+    }
+
+    bool FlatAssetRegistry::ContainsAsset(const AZ::Data::AssetId& assetId) const
+    {
+        return m_data && FindEntry<AssetEntry>(GetHeader().m_assets, assetId) != nullptr;
+    }
+
+    bool FlatAssetRegistry::FindAssetInfo(const AZ::Data::AssetId& assetId, AZ::Data::AssetInfo& assetInfo) const
+    {
+        if (!m_data)
+        {
+            return false;
+        }
+        if (const AssetEntry* entry = FindEntry<AssetEntry>(GetHeader().m_assets, assetId); entry != nullptr)
+        {
+            ToAssetInfo(*entry, assetInfo);
+            return true;
+        }
+        return false;
+    }
+
+    AZStd::string_view FlatAssetRegistry::FindAssetPath(const AZ::Data::AssetId& assetId) const
+    {
+        if (!m_data)
+        {
+            return {};
+        }
+        const AssetEntry* entry = FindEntry<AssetEntry>(GetHeader().m_assets, assetId);
+        return entry ? GetString(entry->m_pathOffset, entry->m_pathLength) : AZStd::string_view{};
+    }
+
+    AZ::Data::AssetId FlatAssetRegistry::FindAssetIdByPathHash(const AZ::Uuid& pathHash) const
+    {
+        using namespace FlatAssetRegistryInternal;
+
+        if (!m_data)
+        {
+            return {};
+        }
+        const PathEntry* entry = FindEntry<PathEntry>(GetHeader().m_paths, AZ::Data::AssetId(pathHash, 0));
+        return entry ? LoadAssetId(entry->m_assetId) : AZ::Data::AssetId();
+    }
+
+    AZ::Data::AssetId FlatAssetRegistry::FindAssetIdByLegacyAssetId(const AZ::Data::AssetId& legacyAssetId) const
+    {
+        using namespace FlatAssetRegistryInternal;
+
+        if (!m_data)
+        {
+            return {};
+        }
+        const LegacyEntry* entry = FindEntry<LegacyEntry>(GetHeader().m_legacyIds, legacyAssetId);
+        return entry ? LoadAssetId(entry->m_assetId) : AZ::Data::AssetId();
+    }
+
+    bool FlatAssetRegistry::ContainsAssetDependencies(const AZ::Data::AssetId& assetId) const
+    {
+        return m_data && FindEntry<DependencyListEntry>(GetHeader().m_dependencyLists, assetId) != nullptr;
+    }
+
+    bool FlatAssetRegistry::FindAssetDependencies(
+        const AZ::Data::AssetId& assetId, AZStd::vector<AZ::Data::ProductDependency>& dependencies) const
+    {
+        if (!m_data)
+        {
+            return false;
+        }
+        if (const DependencyListEntry* entry = FindEntry<DependencyListEntry>(GetHeader().m_dependencyLists, assetId);
+            entry != nullptr)
+        {
+            ToDependencies(*entry, dependencies);
+            return true;
+        }
+        return false;
+    }
+
+    void FlatAssetRegistry::EnumerateAssets(const AssetInfoCallback& callback) const
+    {
+        using namespace FlatAssetRegistryInternal;
+
+        if (!m_data)
+        {
+            return;
+        }
+        const Table& table = GetHeader().m_assets;
+        const AssetEntry* entries = GetEntries<AssetEntry>(table);
+        AZ::Data::AssetInfo assetInfo;
+        for (AZ::u32 i = 0; i < table.m_count; ++i)
+        {
+            ToAssetInfo(entries[i], assetInfo);
+            callback(LoadAssetId(entries[i].m_key), assetInfo);
+        }
+    }
+
+    void FlatAssetRegistry::EnumeratePaths(const PathCallback& callback) const
+    {
+        using namespace FlatAssetRegistryInternal;
+
+        if (!m_data)
+        {
+            return;
+        }
+        const Table& table = GetHeader().m_paths;
+        const PathEntry* entries = GetEntries<PathEntry>(table);
+        for (AZ::u32 i = 0; i < table.m_count; ++i)
+        {
+            callback(LoadAssetId(entries[i].m_key).m_guid, LoadAssetId(entries[i].m_assetId));
+        }
+    }
+
+    void FlatAssetRegistry::EnumerateLegacyMappings(const LegacyMappingCallback& callback) const
+    {
+        using namespace FlatAssetRegistryInternal;
+
+        if (!m_data)
+        {
+            return;
+        }
+        const Table& table = GetHeader().m_legacyIds;
+        const LegacyEntry* entries = GetEntries<LegacyEntry>(table);
+        for (AZ::u32 i = 0; i < table.m_count; ++i)
+        {
+            callback(LoadAssetId(entries[i].m_key), LoadAssetId(entries[i].m_assetId));
+        }
+    }
+
+    void FlatAssetRegistry::EnumerateAssetDependencies(const DependenciesCallback& callback) const
+    {
+        using namespace FlatAssetRegistryInternal;
+
+        if (!m_data)
+        {
+            return;
+        }
+        const Table& table = GetHeader().m_dependencyLists;
+        const DependencyListEntry* entries = GetEntries<DependencyListEntry>(table);
+        AZStd::vector<AZ::Data::ProductDependency> dependencies;
+        for (AZ::u32 i = 0; i < table.m_count; ++i)
+        {
+            ToDependencies(entries[i], dependencies);
+            callback(LoadAssetId(entries[i].m_key), dependencies);
+        }
+    }
+} // namespace AzFramework
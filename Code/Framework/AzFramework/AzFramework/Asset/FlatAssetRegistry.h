@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/string/string_view.h>
+
+namespace AzFramework
+{
+    class AssetRegistry;
+
+    namespace FlatAssetRegistryInternal
+    {
+        struct Header;
+        struct Table;
+        struct AssetEntry;
+        struct DependencyListEntry;
+    }
+
+    /**
+    * Read-only asset registry that's queried directly from the bytes of a flat catalog file.
+    * Loading the regular asset catalog deserializes every entry into the hash maps of the AssetRegistry, which for large projects
+    * takes seconds and hundreds of megabytes. The flat catalog is written by the Asset Processor next to the regular catalog and
+    * stores the same data as sorted tables of fixed size records with an interned string pool for the relative paths and
+    * adjacency arrays for the product dependencies. The file is memory mapped where the platform supports it, so opening a
+    * catalog only costs a validation of the header and lookups only touch the pages they need.
+    * Lookups use a small radix index over the first bytes of the (uniformly distributed) asset id guids to find a narrow range
+    * in a table, followed by a binary search within that range.
+    * Values are stored in the native byte order of the platform that wrote the file. Files with a different signature, version
+    * or byte order are rejected when opened.
+    */
+    class FlatAssetRegistry final
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(FlatAssetRegistry, AZ::SystemAllocator, 0);
+
+        static constexpr AZ::u32 Signature = 0x43544146; // "FATC" when read as little endian bytes.
+        static constexpr AZ::u32 Version = 1;
+        //! The extension the flat catalog uses. The flat catalog is stored next to the regular catalog with the same name.
+        static constexpr const char* FileExtension = "flat";
+
+        using AssetInfoCallback = AZStd::function<void(const AZ::Data::AssetId& assetId, const AZ::Data::AssetInfo& assetInfo)>;
+        using PathCallback = AZStd::function<void(const AZ::Uuid& pathHash, const AZ::Data::AssetId& assetId)>;
+        using LegacyMappingCallback = AZStd::function<void(const AZ::Data::AssetId& legacyId, const AZ::Data::AssetId& realId)>;
+        using DependenciesCallback = AZStd::function<void(
+            const AZ::Data::AssetId& assetId, const AZStd::vector<AZ::Data::ProductDependency>& dependencies)>;
+
+        FlatAssetRegistry() = default;
+        ~FlatAssetRegistry();
+
+        FlatAssetRegistry(const FlatAssetRegistry&) = delete;
+        FlatAssetRegistry& operator=(const FlatAssetRegistry&) = delete;
+
+        //! Converts the registry to the flat format and stores the result in the output buffer.
+        static bool Write(const AssetRegistry& registry, AZStd::vector<char>& output);
+
+        //! Opens a flat catalog file. The file is memory mapped if possible, otherwise it's read through the FileIO.
+        bool Open(const char* filePath);
+        //! Opens a flat catalog from a copy of the provided data.
+        bool Open(const void* data, size_t size);
+        void Close();
+        bool IsOpen() const;
+        //! Returns true if the data of the catalog is memory mapped instead of read into memory.
+        bool IsMemoryMapped() const;
+
+        size_t GetAssetCount() const;
+        bool ContainsAsset(const AZ::Data::AssetId& assetId) const;
+        bool FindAssetInfo(const AZ::Data::AssetId& assetId, AZ::Data::AssetInfo& assetInfo) const;
+        //! Returns the relative path of an asset without making a copy. The view stays valid until the catalog is closed.
+        AZStd::string_view FindAssetPath(const AZ::Data::AssetId& assetId) const;
+        //! Finds the asset id for a path hash created in the same way as the path hashes in AssetRegistry.
+        AZ::Data::AssetId FindAssetIdByPathHash(const AZ::Uuid& pathHash) const;
+        AZ::Data::AssetId FindAssetIdByLegacyAssetId(const AZ::Data::AssetId& legacyAssetId) const;
+        bool ContainsAssetDependencies(const AZ::Data::AssetId& assetId) const;
+        bool FindAssetDependencies(const AZ::Data::AssetId& assetId, AZStd::vector<AZ::Data::ProductDependency>& dependencies) const;
+
+        //! Enumeration functions visit the entries in the order they're stored, which is sorted by asset id.
+        void EnumerateAssets(const AssetInfoCallback& callback) const;
+        void EnumeratePaths(const PathCallback& callback) const;
+        void EnumerateLegacyMappings(const LegacyMappingCallback& callback) const;
+        void EnumerateAssetDependencies(const DependenciesCallback& callback) const;
+
+    private:
+        using Header = FlatAssetRegistryInternal::Header;
+        using Table = FlatAssetRegistryInternal::Table;
+        using AssetEntry = FlatAssetRegistryInternal::AssetEntry;
+        using DependencyListEntry = FlatAssetRegistryInternal::DependencyListEntry;
+
+        bool Validate();
+        const Header& GetHeader() const;
+        template<typename Entry>
+        const Entry* GetEntries(const Table& table) const;
+        template<typename Entry>
+        const Entry* FindEntry(const Table& table, const AZ::Data::AssetId& key) const;
+        AZStd::string_view GetString(AZ::u32 offset, AZ::u32 length) const;
+        void ToAssetInfo(const AssetEntry& entry, AZ::Data::AssetInfo& assetInfo) const;
+        void ToDependencies(const DependencyListEntry& entry, AZStd::vector<AZ::Data::ProductDependency>& dependencies) const;
+
+        //! Storage for catalogs that are read into memory. Stored as 64-bit values so the records in it are correctly aligned.
+        AZStd::vector<AZ::u64> m_buffer;
+        const char* m_data{ nullptr };
+        size_t m_size{ 0 };
+        const char* m_mappedData{ nullptr };
+        size_t m_mappedSize{ 0 };
+    };
+} // namespace AzFramework
@@ -8,6 +8,8 @@
 
 #include <AzCore/RTTI/ReflectContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzFramework/Spawnable/Spawnable.h>
 
 namespace AzFramework
@@ -24,6 +26,7 @@ namespace AzFramework
 
     Spawnable::EntityList& Spawnable::GetEntities()
     {
+        MarkEntitiesModified();
         return m_entities;
     }
 
@@ -32,6 +35,26 @@ namespace AzFramework
         return m_entities.empty();
     }
 
+    void Spawnable::MarkEntitiesModified()
+    {
+        AZStd::scoped_lock lock(m_clonePlanMutex);
+        ++m_entitiesGeneration;
+    }
+
+    AZStd::shared_ptr<const SpawnableClonePlan> Spawnable::GetClonePlan(AZ::SerializeContext& serializeContext) const
+    {
+        AZStd::scoped_lock lock(m_clonePlanMutex);
+        if (!m_clonePlan || m_clonePlanGeneration != m_entitiesGeneration || &m_clonePlan->GetSerializeContext() != &serializeContext)
+        {
+            // Callers may still be cloning with the previous plan, it's released once the last of them is done with it.
+            m_clonePlan = AZStd::make_shared<const SpawnableClonePlan>(m_entities, serializeContext);
+            m_clonePlanGeneration = m_entitiesGeneration;
+        }
+        AZ_Assert(m_clonePlan->GetEntityCount() == m_entities.size(),
+            "Entities in spawnable '%s' were modified without calling MarkEntitiesModified.", GetId().ToString<AZStd::string>().c_str());
+        return m_clonePlan;
+    }
+
     SpawnableMetaData& Spawnable::GetMetaData()
     {
         return m_metaData;
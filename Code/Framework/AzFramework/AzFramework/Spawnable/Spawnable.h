@@ -12,12 +12,16 @@
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzFramework/Spawnable/SpawnableClonePlan.h>
 #include <AzFramework/Spawnable/SpawnableMetaData.h>
 
 namespace AZ
 {
     class ReflectContext;
+    class SerializeContext;
 }
 
 namespace AzFramework
@@ -44,9 +48,19 @@ namespace AzFramework
         Spawnable& operator=(Spawnable&& other) = delete;
 
         const EntityList& GetEntities() const;
+        //! Returns the entities for modification, which marks them as modified. Call MarkEntitiesModified when changing the
+        //! entities or their components through a reference that was obtained before the last clone plan was created.
         EntityList& GetEntities();
         bool IsEmpty() const;
 
+        //! Signals that the entities have been modified so the next request for a clone plan creates a new one. Clone plans
+        //! that have already been handed out stay valid for the entities as they were when the plan was created.
+        void MarkEntitiesModified();
+
+        //! Returns the plan for cloning the entities in this spawnable. The plan is created the first time it's requested
+        //! and reused afterwards, unless the entities have been marked as modified or a different serialize context is used.
+        AZStd::shared_ptr<const SpawnableClonePlan> GetClonePlan(AZ::SerializeContext& serializeContext) const;
+
         SpawnableMetaData& GetMetaData();
         const SpawnableMetaData& GetMetaData() const;
 
@@ -58,6 +72,13 @@ namespace AzFramework
         // Container for keeping all entities of the prefab the Spawnable was created from.
         // Includes both direct and nested entities of the prefab.
         EntityList m_entities;
+
+        // Cached instructions for cloning the entities. This is created on demand and replaced once the entities have been
+        // modified, which is tracked by comparing the generation the plan was created for with the entities' generation.
+        mutable AZStd::shared_ptr<const SpawnableClonePlan> m_clonePlan;
+        mutable AZ::u64 m_clonePlanGeneration = 0;
+        AZ::u64 m_entitiesGeneration = 0;
+        mutable AZStd::mutex m_clonePlanMutex;
     };
 
     using SpawnableList = AZStd::vector<Spawnable>;
@@ -7,6 +7,7 @@
  */
 
 #include <AzCore/Casting/lossy_cast.h>
+#include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzCore/Serialization/Utils.h>
 #include <AzCore/std/string/string.h>
 #include <AzFramework/Spawnable/Spawnable.h>
@@ -52,6 +53,13 @@ namespace AzFramework
         AZ::ObjectStream::FilterDescriptor filter(assetLoadFilterCB);
         if (AZ::Utils::LoadObjectFromStreamInPlace(*stream, *spawnable, nullptr /*SerializeContext*/, filter))
         {
+            // Build the clone plan while still on the loading thread so the first spawn doesn't have to pay for it.
+            AZ::SerializeContext* serializeContext = nullptr;
+            AZ::ComponentApplicationBus::BroadcastResult(serializeContext, &AZ::ComponentApplicationBus::Events::GetSerializeContext);
+            if (serializeContext)
+            {
+                spawnable->GetClonePlan(*serializeContext);
+            }
             return AZ::Data::AssetHandler::LoadResult::LoadComplete;
         }
         else
@@ -0,0 +1,353 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Serialization/EditContextConstants.inl>
+#include <AzCore/Serialization/IdUtils.h>
+#include <AzFramework/Spawnable/SpawnableClonePlan.h>
+
+namespace AzFramework
+{
+    SpawnableClonePlan::SpawnableClonePlan(const EntityList& entities, AZ::SerializeContext& serializeContext)
+        : m_serializeContext(&serializeContext)
+    {
+        m_entities.reserve(entities.size());
+        for (const AZStd::unique_ptr<AZ::Entity>& entity : entities)
+        {
+            RecordEntity(*entity);
+        }
+    }
+
+    AZ::Entity* SpawnableClonePlan::CloneEntity(
+        size_t entityIndex, const AZ::Entity& entityTemplate, EntityIdMap& templateToCloneMap) const
+    {
+        AZ::Entity* clone = m_serializeContext->CloneObject(&entityTemplate);
+        if (!clone)
+        {
+            return nullptr;
+        }
+
+        if (entityIndex >= m_entities.size() || m_entities[entityIndex].m_useFallback ||
+            !MatchesRecordedComponents(m_entities[entityIndex], entityTemplate))
+        {
+            // If the same ID gets remapped more than once, preserve the original remapping instead of overwriting it.
+            constexpr bool allowDuplicateIds = false;
+            AZ::IdUtils::Remapper<AZ::EntityId, allowDuplicateIds>::GenerateNewIdsAndFixRefs(
+                clone, templateToCloneMap, m_serializeContext);
+            return clone;
+        }
+
+        const EntityPlan& plan = m_entities[entityIndex];
+        const IdSlot* slot = m_slots.data() + plan.m_firstSlot;
+        const IdSlot* generatedEnd = slot + plan.m_generatedSlotCount;
+        const IdSlot* end = slot + plan.m_slotCount;
+
+        // First assign new ids to all the ids that have a generator, then fix up all references using the updated map. This is
+        // the same order in which the ids are remapped by a full reflection walk.
+        for (; slot != generatedEnd; ++slot)
+        {
+            if (AZ::EntityId* id = ResolveSlot(*slot, clone); id != nullptr)
+            {
+                auto it = templateToCloneMap.find(*id);
+                if (it == templateToCloneMap.end())
+                {
+                    it = templateToCloneMap.emplace(*id, slot->m_generator->Invoke(nullptr)).first;
+                }
+                *id = it->second;
+            }
+        }
+
+        for (; slot != end; ++slot)
+        {
+            if (AZ::EntityId* id = ResolveSlot(*slot, clone); id != nullptr)
+            {
+                if (auto it = templateToCloneMap.find(*id); it != templateToCloneMap.end())
+                {
+                    *id = it->second;
+                }
+            }
+        }
+
+        return clone;
+    }
+
+    AZ::SerializeContext& SpawnableClonePlan::GetSerializeContext() const
+    {
+        return *m_serializeContext;
+    }
+
+    size_t SpawnableClonePlan::GetEntityCount() const
+    {
+        return m_entities.size();
+    }
+
+    size_t SpawnableClonePlan::GetFallbackEntityCount() const
+    {
+        return m_fallbackEntityCount;
+    }
+
+    void SpawnableClonePlan::RecordEntity(const AZ::Entity& entity)
+    {
+        using ClassData = AZ::SerializeContext::ClassData;
+        using ClassElement = AZ::SerializeContext::ClassElement;
+
+        struct Frame
+        {
+            const ClassData* m_classData;
+            const void* m_object;
+            size_t m_pathLength;
+            size_t m_childCount;
+            bool m_blocked;
+        };
+
+        struct RecordedSlot
+        {
+            IdGenerator* m_generator;
+            AZ::u32 m_firstStep;
+            AZ::u32 m_stepCount;
+        };
+
+        const AZ::Uuid& entityIdType = azrtti_typeid<AZ::EntityId>();
+        const size_t firstStep = m_steps.size();
+
+        AZStd::vector<Frame> frames;
+        frames.reserve(32);
+        AZStd::vector<Step> path;
+        path.reserve(32);
+        AZStd::vector<RecordedSlot> generatedSlots;
+        AZStd::vector<RecordedSlot> referenceSlots;
+        bool useFallback = false;
+
+        auto beginCB = [&](void* ptr, const ClassData* classData, const ClassElement* classElement) -> bool
+        {
+            Frame frame{ classData, ptr, 0, 0, false };
+            if (useFallback)
+            {
+                // There's no point in recording any further paths as the full reflection walk will be used anyway.
+                frames.push_back(frame);
+                return false;
+            }
+
+            if (!frames.empty())
+            {
+                Frame& parent = frames.back();
+                size_t childIndex = parent.m_childCount++;
+                frame.m_blocked = parent.m_blocked;
+                path.resize(parent.m_pathLength);
+
+                if (!frame.m_blocked)
+                {
+                    if (AZ::SerializeContext::IDataContainer* container = parent.m_classData->m_container; container != nullptr)
+                    {
+                        frame.m_blocked = true;
+                        if (container->CanAccessElementsByIndex() && !container->IsSmartPointer() &&
+                            container->GetAssociativeContainerInterface() == nullptr)
+                        {
+                            // Null pointers are skipped during enumeration so the number of visited children isn't guaranteed
+                            // to match the index of the element. Look for the element if that's the case.
+                            void* parentObject = const_cast<void*>(parent.m_object);
+                            size_t index = childIndex;
+                            if (container->GetElementByIndex(parentObject, classElement, index) != ptr)
+                            {
+                                size_t size = container->Size(parentObject);
+                                for (index = 0; index < size; ++index)
+                                {
+                                    if (container->GetElementByIndex(parentObject, classElement, index) == ptr)
+                                    {
+                                        break;
+                                    }
+                                }
+                            }
+
+                            if (index < container->Size(parentObject))
+                            {
+                                Step step;
+                                step.m_type = Step::Type::ContainerElement;
+                                step.m_container = container;
+                                step.m_element = classElement;
+                                step.m_index = index;
+                                path.push_back(step);
+                                frame.m_blocked = false;
+                            }
+                        }
+                    }
+                    else
+                    {
+                        Step step;
+                        step.m_type = Step::Type::Offset;
+                        step.m_offset = reinterpret_cast<const char*>(ptr) - reinterpret_cast<const char*>(parent.m_object);
+                        path.push_back(step);
+                    }
+                }
+            }
+
+            if (classElement && (classElement->m_flags & ClassElement::FLG_POINTER))
+            {
+                // The enumeration only visits pointers that aren't null.
+                void* rawObject = *reinterpret_cast<void* const*>(ptr);
+                void* object = rawObject;
+                if (classElement->m_azRtti && classData->m_azRtti && classData->m_typeId != classElement->m_typeId)
+                {
+                    object = classElement->m_azRtti->Cast(rawObject, classData->m_azRtti->GetTypeId());
+                }
+
+                if (object && (classElement->m_flags & ClassElement::FLG_DYNAMIC_FIELD) == 0)
+                {
+                    Step step;
+                    step.m_type = Step::Type::Dereference;
+                    step.m_offset = reinterpret_cast<const char*>(object) - reinterpret_cast<const char*>(rawObject);
+                    path.push_back(step);
+                    frame.m_object = object;
+                }
+                else
+                {
+                    frame.m_blocked = true;
+                    frame.m_object = rawObject;
+                }
+            }
+
+            // Event handlers can react to fields being written to, which wouldn't happen when the id is directly patched.
+            frame.m_blocked = frame.m_blocked || classData->m_eventHandler != nullptr;
+            frame.m_pathLength = path.size();
+            frames.push_back(frame);
+
+            if (classData->m_typeId != entityIdType)
+            {
+                return true;
+            }
+
+            if (frame.m_blocked)
+            {
+                useFallback = true;
+                return false;
+            }
+
+            RecordedSlot slot{ nullptr, aznumeric_cast<AZ::u32>(m_steps.size()), 0 };
+            for (const Step& step : path)
+            {
+                if (step.m_type == Step::Type::Offset)
+                {
+                    if (step.m_offset == 0)
+                    {
+                        continue;
+                    }
+                    if (slot.m_stepCount > 0 && m_steps.back().m_type == Step::Type::Offset)
+                    {
+                        m_steps.back().m_offset += step.m_offset;
+                        continue;
+                    }
+                }
+                m_steps.push_back(step);
+                slot.m_stepCount++;
+            }
+
+            if (classElement)
+            {
+                AZ::Attribute* attribute = AZ::FindAttribute(AZ::Edit::Attributes::IdGeneratorFunction, classElement->m_attributes);
+                slot.m_generator = attribute ? azrtti_cast<IdGenerator*>(attribute) : nullptr;
+            }
+            (slot.m_generator ? generatedSlots : referenceSlots).push_back(slot);
+
+            // There's no need to visit the members of the entity id.
+            return false;
+        };
+
+        auto endCB = [&frames]() -> bool
+        {
+            frames.pop_back();
+            return true;
+        };
+
+        m_serializeContext->EnumerateInstanceConst(&entity, AZ::SerializeTypeInfo<AZ::Entity>::GetUuid(&entity), beginCB, endCB,
+            AZ::SerializeContext::ENUM_ACCESS_FOR_READ, nullptr, nullptr);
+
+        EntityPlan& plan = m_entities.emplace_back();
+        if (useFallback)
+        {
+            m_steps.resize(firstStep);
+            plan.m_useFallback = true;
+            m_fallbackEntityCount++;
+            return;
+        }
+
+        const AZ::Entity::ComponentArrayType& components = entity.GetComponents();
+        plan.m_firstComponentType = aznumeric_cast<AZ::u32>(m_componentTypes.size());
+        plan.m_componentCount = aznumeric_cast<AZ::u32>(components.size());
+        for (const AZ::Component* component : components)
+        {
+            m_componentTypes.push_back(component->RTTI_GetType());
+        }
+
+        plan.m_firstSlot = aznumeric_cast<AZ::u32>(m_slots.size());
+        plan.m_generatedSlotCount = aznumeric_cast<AZ::u32>(generatedSlots.size());
+        plan.m_slotCount = aznumeric_cast<AZ::u32>(generatedSlots.size() + referenceSlots.size());
+        for (const RecordedSlot& slot : generatedSlots)
+        {
+            m_slots.push_back(IdSlot{ slot.m_generator, slot.m_firstStep, slot.m_stepCount });
+        }
+        for (const RecordedSlot& slot : referenceSlots)
+        {
+            m_slots.push_back(IdSlot{ nullptr, slot.m_firstStep, slot.m_stepCount });
+        }
+    }
+
+    bool SpawnableClonePlan::MatchesRecordedComponents(const EntityPlan& plan, const AZ::Entity& entity) const
+    {
+        const AZ::Entity::ComponentArrayType& components = entity.GetComponents();
+        if (components.size() != plan.m_componentCount)
+        {
+            return false;
+        }
+
+        const AZ::TypeId* componentType = m_componentTypes.data() + plan.m_firstComponentType;
+        for (const AZ::Component* component : components)
+        {
+            if (component->RTTI_GetType() != *componentType++)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    AZ::EntityId* SpawnableClonePlan::ResolveSlot(const IdSlot& slot, void* root) const
+    {
+        char* address = reinterpret_cast<char*>(root);
+        const Step* step = m_steps.data() + slot.m_firstStep;
+        const Step* end = step + slot.m_stepCount;
+        for (; step != end; ++step)
+        {
+            switch (step->m_type)
+            {
+            case Step::Type::Offset:
+                address += step->m_offset;
+                break;
+            case Step::Type::Dereference:
+                address = *reinterpret_cast<char**>(address);
+                if (!address)
+                {
+                    return nullptr;
+                }
+                address += step->m_offset;
+                break;
+            case Step::Type::ContainerElement:
+                address = reinterpret_cast<char*>(step->m_container->GetElementByIndex(address, step->m_element, step->m_index));
+                if (!address)
+                {
+                    return nullptr;
+                }
+                break;
+            default:
+                AZ_Assert(false, "Unsupported step type %i in spawnable clone plan.", aznumeric_cast<int>(step->m_type));
+                return nullptr;
+            }
+        }
+        return reinterpret_cast<AZ::EntityId*>(address);
+    }
+} // namespace AzFramework
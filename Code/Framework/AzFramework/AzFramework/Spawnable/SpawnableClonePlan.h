@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace AZ
+{
+    class Entity;
+}
+
+namespace AzFramework
+{
+    //! Precompiled instructions for cloning the entities in a spawnable and giving the clones their own entity ids.
+    //! Spawning an entity normally requires a clone of the template entity followed by two full reflection walks over the
+    //! clone, one to generate new ids and one to fix up references to other entities. Most of the work in those walks goes
+    //! into visiting fields that don't contain any entity ids. The clone plan does the reflection walk once per template
+    //! entity and records a flattened path, made of member offsets, pointer dereferences and container lookups, to every
+    //! entity id in the entity. Cloning an entity then only needs to follow the recorded paths to patch the ids.
+    //! Entities with entity ids in places that can't be reached with a fixed path, such as inside associative containers,
+    //! dynamic fields or types with serialization event handlers, fall back to the full reflection walk.
+    class SpawnableClonePlan final
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(SpawnableClonePlan, AZ::SystemAllocator, 0);
+
+        using EntityList = AZStd::vector<AZStd::unique_ptr<AZ::Entity>>;
+        using EntityIdMap = AZStd::unordered_map<AZ::EntityId, AZ::EntityId>;
+
+        SpawnableClonePlan(const EntityList& entities, AZ::SerializeContext& serializeContext);
+
+        //! Clones the template entity and updates the entity ids in the clone using the provided map. Ids that are generated,
+        //! such as the id of the entity itself, are added to the map if they're not in it yet. Ids that refer to other entities
+        //! are only replaced if the map contains an entry for them. This matches the behavior of
+        //! AZ::IdUtils::Remapper::CloneObjectAndGenerateNewIdsAndFixRefs with duplicate ids disabled.
+        //! @param entityIndex The index of the template entity in the entity list the plan was created from.
+        //! @param entityTemplate The entity to clone. This should be the entity at entityIndex in the list the plan was created from.
+        //!        If its components no longer match the ones the plan was created for, the full reflection walk is used instead.
+        //! @param templateToCloneMap The map with the template to clone entity id mapping.
+        //! @return The cloned entity or null if the entity couldn't be cloned.
+        AZ::Entity* CloneEntity(size_t entityIndex, const AZ::Entity& entityTemplate, EntityIdMap& templateToCloneMap) const;
+
+        //! Returns the serialize context that was used to create the plan.
+        AZ::SerializeContext& GetSerializeContext() const;
+        //! Returns the number of entities the plan was created for.
+        size_t GetEntityCount() const;
+        //! Returns the number of entities that can't use the recorded paths and use the full reflection walk instead.
+        size_t GetFallbackEntityCount() const;
+
+    private:
+        using IdGenerator = AZ::AttributeFunction<AZ::EntityId()>;
+
+        struct Step
+        {
+            enum class Type : AZ::u8
+            {
+                //! Move the address by a fixed number of bytes.
+                Offset,
+                //! Load the pointer stored at the address and apply a fixed adjustment for casting to the stored type.
+                Dereference,
+                //! Get the address of an element in a container that can be accessed by index.
+                ContainerElement
+            };
+
+            AZ::SerializeContext::IDataContainer* m_container{ nullptr };
+            const AZ::SerializeContext::ClassElement* m_element{ nullptr };
+            ptrdiff_t m_offset{ 0 };
+            size_t m_index{ 0 };
+            Type m_type{ Type::Offset };
+        };
+
+        struct IdSlot
+        {
+            IdGenerator* m_generator{ nullptr };
+            AZ::u32 m_firstStep{ 0 };
+            AZ::u32 m_stepCount{ 0 };
+        };
+
+        struct EntityPlan
+        {
+            AZ::u32 m_firstSlot{ 0 };
+            AZ::u32 m_generatedSlotCount{ 0 };
+            AZ::u32 m_slotCount{ 0 };
+            AZ::u32 m_firstComponentType{ 0 };
+            AZ::u32 m_componentCount{ 0 };
+            bool m_useFallback{ false };
+        };
+
+        void RecordEntity(const AZ::Entity& entity);
+        //! Checks if the entity still has the components the plan was recorded for, so the recorded paths lead to the same members.
+        bool MatchesRecordedComponents(const EntityPlan& plan, const AZ::Entity& entity) const;
+        AZ::EntityId* ResolveSlot(const IdSlot& slot, void* root) const;
+
+        AZStd::vector<Step> m_steps;
+        AZStd::vector<IdSlot> m_slots;
+        AZStd::vector<AZ::TypeId> m_componentTypes;
+        AZStd::vector<EntityPlan> m_entities;
+        AZ::SerializeContext* m_serializeContext;
+        size_t m_fallbackEntityCount{ 0 };
+    };
+} // namespace AzFramework
@@ -8,7 +8,6 @@
 
 #include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
-#include <AzCore/Serialization/IdUtils.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Settings/SettingsRegistry.h>
 #include <AzCore/std/parallel/scoped_lock.h>
@@ -243,14 +242,12 @@ namespace AzFramework
         }
     }
 
-    AZ::Entity* SpawnableEntitiesManager::CloneSingleEntity(const AZ::Entity& entityTemplate,
-        EntityIdMap& templateToCloneMap, AZ::SerializeContext& serializeContext)
+    AZ::Entity* SpawnableEntitiesManager::CloneSingleEntity(
+        const SpawnableClonePlan& clonePlan, size_t entityIndex, const AZ::Entity& entityTemplate, EntityIdMap& templateToCloneMap)
     {
-        // If the same ID gets remapped more than once, preserve the original remapping instead of overwriting it.
-        constexpr bool allowDuplicateIds = false;
-
-        return AZ::IdUtils::Remapper<AZ::EntityId, allowDuplicateIds>::CloneObjectAndGenerateNewIdsAndFixRefs(
-                &entityTemplate, templateToCloneMap, &serializeContext);
+        // The clone plan follows precompiled paths to the entity ids in the entity instead of walking the entire clone. If the same
+        // ID gets remapped more than once, the original remapping is preserved instead of overwritten.
+        return clonePlan.CloneEntity(entityIndex, entityTemplate, templateToCloneMap);
     }
 
     void SpawnableEntitiesManager::InitializeEntityIdMappings(
@@ -299,7 +296,11 @@ namespace AzFramework
             size_t spawnedEntitiesInitialCount = spawnedEntities.size();
 
             // These are 'template' entities we'll be cloning from
-            const Spawnable::EntityList& entitiesToSpawn = ticket.m_spawnable->GetEntities();
+            const Spawnable& spawnable = *ticket.m_spawnable.Get();
+            const Spawnable::EntityList& entitiesToSpawn = spawnable.GetEntities();
+            // Holding on to the plan keeps it alive even if the spawnable is marked as modified while cloning.
+            const AZStd::shared_ptr<const SpawnableClonePlan> clonePlanPtr = spawnable.GetClonePlan(*request.m_serializeContext);
+            const SpawnableClonePlan& clonePlan = *clonePlanPtr;
             size_t entitiesToSpawnSize = entitiesToSpawn.size();
 
             // Reserve buffers
@@ -319,7 +320,7 @@ namespace AzFramework
                 // If this entity has previously been spawned, give it a new id in the reference map
                 RefreshEntityIdMapping(entitiesToSpawn[i].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
 
-                AZ::Entity* clone = CloneSingleEntity(*entitiesToSpawn[i], ticket.m_entityIdReferenceMap, *request.m_serializeContext);
+                AZ::Entity* clone = CloneSingleEntity(clonePlan, i, *entitiesToSpawn[i], ticket.m_entityIdReferenceMap);
                 AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
 
                 spawnedEntities.emplace_back(clone);
@@ -373,7 +374,10 @@ namespace AzFramework
             size_t spawnedEntitiesInitialCount = spawnedEntities.size();
 
             // These are 'template' entities we'll be cloning from
-            const Spawnable::EntityList& entitiesToSpawn = ticket.m_spawnable->GetEntities();
+            const Spawnable& spawnable = *ticket.m_spawnable.Get();
+            const Spawnable::EntityList& entitiesToSpawn = spawnable.GetEntities();
+            const AZStd::shared_ptr<const SpawnableClonePlan> clonePlanPtr = spawnable.GetClonePlan(*request.m_serializeContext);
+            const SpawnableClonePlan& clonePlan = *clonePlanPtr;
             size_t entitiesToSpawnSize = request.m_entityIndices.size();
 
             if (ticket.m_entityIdReferenceMap.empty() || !request.m_referencePreviouslySpawnedEntities)
@@ -400,8 +404,7 @@ namespace AzFramework
                     RefreshEntityIdMapping(
                         entitiesToSpawn[index].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
 
-                    AZ::Entity* clone =
-                        CloneSingleEntity(*entitiesToSpawn[index], ticket.m_entityIdReferenceMap, *request.m_serializeContext);
+                    AZ::Entity* clone = CloneSingleEntity(clonePlan, index, *entitiesToSpawn[index], ticket.m_entityIdReferenceMap);
                     AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
 
                     spawnedEntities.push_back(clone);
@@ -489,7 +492,10 @@ namespace AzFramework
 
             // Rebuild the list of entities.
             ticket.m_spawnedEntities.clear();
-            const Spawnable::EntityList& entities = request.m_spawnable->GetEntities();
+            const Spawnable& spawnable = *request.m_spawnable.Get();
+            const Spawnable::EntityList& entities = spawnable.GetEntities();
+            const AZStd::shared_ptr<const SpawnableClonePlan> clonePlanPtr = spawnable.GetClonePlan(*request.m_serializeContext);
+            const SpawnableClonePlan& clonePlan = *clonePlanPtr;
 
             // Pre-generate the full set of entity id to new entity id mappings, so that during the clone operation below,
             // any entity references that point to a not-yet-cloned entity will still get their ids remapped correctly.
@@ -509,7 +515,7 @@ namespace AzFramework
                     // If this entity has previously been spawned, give it a new id in the reference map
                     RefreshEntityIdMapping(entities[i].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
 
-                    AZ::Entity* clone = CloneSingleEntity(*entities[i], ticket.m_entityIdReferenceMap, *request.m_serializeContext);
+                    AZ::Entity* clone = CloneSingleEntity(clonePlan, i, *entities[i], ticket.m_entityIdReferenceMap);
                     AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
 
                     ticket.m_spawnedEntities.push_back(clone);
@@ -530,7 +536,7 @@ namespace AzFramework
                         // If this entity has previously been spawned, give it a new id in the reference map
                         RefreshEntityIdMapping(entities[index].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
 
-                        AZ::Entity* clone = CloneSingleEntity(*entities[index], ticket.m_entityIdReferenceMap, *request.m_serializeContext);
+                        AZ::Entity* clone = CloneSingleEntity(clonePlan, index, *entities[index], ticket.m_entityIdReferenceMap);
                         AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
                         ticket.m_spawnedEntities.push_back(clone);
                     }
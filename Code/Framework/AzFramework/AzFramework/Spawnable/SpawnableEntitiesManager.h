@@ -194,7 +194,7 @@ namespace AzFramework
         CommandQueueStatus ProcessQueue(Queue& queue);
 
         AZ::Entity* CloneSingleEntity(
-            const AZ::Entity& entityTemplate, EntityIdMap& templateToCloneMap, AZ::SerializeContext& serializeContext);
+            const SpawnableClonePlan& clonePlan, size_t entityIndex, const AZ::Entity& entityTemplate, EntityIdMap& templateToCloneMap);
         
         bool ProcessRequest(SpawnAllEntitiesCommand& request);
         bool ProcessRequest(SpawnEntitiesCommand& request);
@@ -76,6 +76,16 @@ namespace AzFramework
         //! @param visibilityEntry data for the object being removed
         virtual void RemoveEntry(VisibilityEntry& visibilityEntry) = 0;
 
+        //! Insert or update a batch of entries within the visibility system.
+        //! This has the same result as calling InsertOrUpdateEntry for each entry, but allows the visibility system to
+        //! synchronize once for the whole batch, which is preferable when many entries move every frame.
+        //! @param visibilityEntries data for the objects being added/updated
+        virtual void InsertOrUpdateEntries(const AZStd::vector<VisibilityEntry*>& visibilityEntries) = 0;
+
+        //! Removes a batch of entries from the visibility system.
+        //! @param visibilityEntries data for the objects being removed
+        virtual void RemoveEntries(const AZStd::vector<VisibilityEntry*>& visibilityEntries) = 0;
+
         //! Intersects an axis aligned bounding box against the visibility system.
         //! @param aabb the axis aligned bounding box to test against
         //! @param callback the callback to invoke when a node is visible
@@ -94,6 +104,13 @@ namespace AzFramework
         //! @return the intersection result of the frustum against the visibility system
         virtual void Enumerate(const AZ::Frustum& frustum, const EnumerateCallback& callback) const = 0;
 
+        //! Intersects a frustum against the visibility system, splitting the work across the job system.
+        //! The callback is invoked concurrently from multiple threads and in no particular order, so it has to be thread safe.
+        //! This function doesn't return until all callbacks have completed.
+        //! @param frustum the frustum to test against
+        //! @param callback the callback to invoke when a node is visible
+        virtual void EnumerateParallel(const AZ::Frustum& frustum, const EnumerateCallback& callback) const = 0;
+
         //! Enumerate *all* OctreeNodes that have any entries in them (without any culling).
         //! @param callback the callback to invoke when a node is visible
         virtual void EnumerateNoCull(const EnumerateCallback& callback) const = 0;
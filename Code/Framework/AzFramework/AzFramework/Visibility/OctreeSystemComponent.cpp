@@ -7,8 +7,16 @@
  */
 
 #include <AzFramework/Visibility/OctreeSystemComponent.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Math/MathIntrinsics.h>
 #include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/Math/SimdMath.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/sort.h>
 
 namespace AzFramework
 {
@@ -16,6 +24,7 @@ namespace AzFramework
     AZ_CVAR(float,    bg_octreeMaxWorldExtents, 16384.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum supported world size by the world octreeSystemComponent");
     AZ_CVAR(uint32_t, bg_octreeNodeMaxEntries,       64, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum number of entries to allow in any node before forcing a split");
     AZ_CVAR(uint32_t, bg_octreeNodeMinEntries,       32, nullptr, AZ::ConsoleFunctorFlags::Null, "Minimum number of entries to allow in a node resulting from a merge operation");
+    AZ_CVAR(uint32_t, bg_octreeParallelSubtreesPerWorker, 4, nullptr, AZ::ConsoleFunctorFlags::Null, "Number of subtrees to create per worker thread when enumerating an octree in parallel");
 
 
     static uint32_t GetChildNodeCount()
@@ -26,6 +35,144 @@ namespace AzFramework
     }
 
 
+    // Returns a mask with a bit set for every lane of the comparison result that is true.
+    static uint32_t GetLaneMask(AZ::Simd::Vec4::FloatArgType comparison)
+    {
+        int32_t lanes[AZ::Simd::Vec4::ElementCount];
+        AZ::Simd::Vec4::StoreUnaligned(lanes, AZ::Simd::Vec4::CastToInt(comparison));
+        return (lanes[0] ? 0x1 : 0) | (lanes[1] ? 0x2 : 0) | (lanes[2] ? 0x4 : 0) | (lanes[3] ? 0x8 : 0);
+    }
+
+
+    // The query types below test a bounding volume against four child nodes at a time, starting at the provided child index.
+    // They match the results of the corresponding AZ::ShapeIntersection::Overlaps functions for a single Aabb.
+    class AabbQuery
+    {
+    public:
+        explicit AabbQuery(const AZ::Aabb& aabb)
+            : m_minX(AZ::Simd::Vec4::Splat(aabb.GetMin().GetX()))
+            , m_minY(AZ::Simd::Vec4::Splat(aabb.GetMin().GetY()))
+            , m_minZ(AZ::Simd::Vec4::Splat(aabb.GetMin().GetZ()))
+            , m_maxX(AZ::Simd::Vec4::Splat(aabb.GetMax().GetX()))
+            , m_maxY(AZ::Simd::Vec4::Splat(aabb.GetMax().GetY()))
+            , m_maxZ(AZ::Simd::Vec4::Splat(aabb.GetMax().GetZ()))
+        {
+        }
+
+        AZ::Simd::Vec4::FloatType Overlaps(const OctreeChildBounds& bounds, uint32_t firstChild) const
+        {
+            using Vec4 = AZ::Simd::Vec4;
+            const Vec4::FloatType overlapsX = Vec4::And(
+                Vec4::CmpLtEq(m_minX, Vec4::LoadUnaligned(bounds.m_maxX + firstChild)),
+                Vec4::CmpGtEq(m_maxX, Vec4::LoadUnaligned(bounds.m_minX + firstChild)));
+            const Vec4::FloatType overlapsY = Vec4::And(
+                Vec4::CmpLtEq(m_minY, Vec4::LoadUnaligned(bounds.m_maxY + firstChild)),
+                Vec4::CmpGtEq(m_maxY, Vec4::LoadUnaligned(bounds.m_minY + firstChild)));
+            const Vec4::FloatType overlapsZ = Vec4::And(
+                Vec4::CmpLtEq(m_minZ, Vec4::LoadUnaligned(bounds.m_maxZ + firstChild)),
+                Vec4::CmpGtEq(m_maxZ, Vec4::LoadUnaligned(bounds.m_minZ + firstChild)));
+            return Vec4::And(Vec4::And(overlapsX, overlapsY), overlapsZ);
+        }
+
+    private:
+        AZ::Simd::Vec4::FloatType m_minX, m_minY, m_minZ;
+        AZ::Simd::Vec4::FloatType m_maxX, m_maxY, m_maxZ;
+    };
+
+
+    class SphereQuery
+    {
+    public:
+        explicit SphereQuery(const AZ::Sphere& sphere)
+            : m_centerX(AZ::Simd::Vec4::Splat(sphere.GetCenter().GetX()))
+            , m_centerY(AZ::Simd::Vec4::Splat(sphere.GetCenter().GetY()))
+            , m_centerZ(AZ::Simd::Vec4::Splat(sphere.GetCenter().GetZ()))
+            , m_radiusSq(AZ::Simd::Vec4::Splat(sphere.GetRadius() * sphere.GetRadius()))
+        {
+        }
+
+        AZ::Simd::Vec4::FloatType Overlaps(const OctreeChildBounds& bounds, uint32_t firstChild) const
+        {
+            using Vec4 = AZ::Simd::Vec4;
+            // Distance from the center of the sphere to the closest point within each of the child bounds
+            const Vec4::FloatType deltaX = Vec4::Sub(m_centerX, Vec4::Clamp(m_centerX,
+                Vec4::LoadUnaligned(bounds.m_minX + firstChild), Vec4::LoadUnaligned(bounds.m_maxX + firstChild)));
+            const Vec4::FloatType deltaY = Vec4::Sub(m_centerY, Vec4::Clamp(m_centerY,
+                Vec4::LoadUnaligned(bounds.m_minY + firstChild), Vec4::LoadUnaligned(bounds.m_maxY + firstChild)));
+            const Vec4::FloatType deltaZ = Vec4::Sub(m_centerZ, Vec4::Clamp(m_centerZ,
+                Vec4::LoadUnaligned(bounds.m_minZ + firstChild), Vec4::LoadUnaligned(bounds.m_maxZ + firstChild)));
+            const Vec4::FloatType distSq = Vec4::Add(Vec4::Add(Vec4::Mul(deltaX, deltaX), Vec4::Mul(deltaY, deltaY)), Vec4::Mul(deltaZ, deltaZ));
+            return Vec4::CmpLtEq(distSq, m_radiusSq);
+        }
+
+    private:
+        AZ::Simd::Vec4::FloatType m_centerX, m_centerY, m_centerZ;
+        AZ::Simd::Vec4::FloatType m_radiusSq;
+    };
+
+
+    class FrustumQuery
+    {
+    public:
+        explicit FrustumQuery(const AZ::Frustum& frustum)
+        {
+            for (AZ::Frustum::PlaneId planeId = AZ::Frustum::PlaneId::Near; planeId < AZ::Frustum::PlaneId::MAX; ++planeId)
+            {
+                const AZ::Vector4 coefficients = frustum.GetPlane(planeId).GetPlaneEquationCoefficients();
+                Plane& plane = m_planes[static_cast<uint32_t>(planeId)];
+                plane.m_normalX = AZ::Simd::Vec4::Splat(coefficients.GetX());
+                plane.m_normalY = AZ::Simd::Vec4::Splat(coefficients.GetY());
+                plane.m_normalZ = AZ::Simd::Vec4::Splat(coefficients.GetZ());
+                plane.m_absNormalX = AZ::Simd::Vec4::Splat(AZ::GetAbs(coefficients.GetX()));
+                plane.m_absNormalY = AZ::Simd::Vec4::Splat(AZ::GetAbs(coefficients.GetY()));
+                plane.m_absNormalZ = AZ::Simd::Vec4::Splat(AZ::GetAbs(coefficients.GetZ()));
+                plane.m_distance = AZ::Simd::Vec4::Splat(coefficients.GetW());
+            }
+        }
+
+        AZ::Simd::Vec4::FloatType Overlaps(const OctreeChildBounds& bounds, uint32_t firstChild) const
+        {
+            using Vec4 = AZ::Simd::Vec4;
+            const Vec4::FloatType half = Vec4::Splat(0.5f);
+            const Vec4::FloatType minX = Vec4::LoadUnaligned(bounds.m_minX + firstChild);
+            const Vec4::FloatType minY = Vec4::LoadUnaligned(bounds.m_minY + firstChild);
+            const Vec4::FloatType minZ = Vec4::LoadUnaligned(bounds.m_minZ + firstChild);
+            const Vec4::FloatType maxX = Vec4::LoadUnaligned(bounds.m_maxX + firstChild);
+            const Vec4::FloatType maxY = Vec4::LoadUnaligned(bounds.m_maxY + firstChild);
+            const Vec4::FloatType maxZ = Vec4::LoadUnaligned(bounds.m_maxZ + firstChild);
+
+            // Same as the scalar test, the extents are halved separately to avoid overflowing on bounds that contain FLT_MAX
+            const Vec4::FloatType centerX = Vec4::Mul(Vec4::Add(minX, maxX), half);
+            const Vec4::FloatType centerY = Vec4::Mul(Vec4::Add(minY, maxY), half);
+            const Vec4::FloatType centerZ = Vec4::Mul(Vec4::Add(minZ, maxZ), half);
+            const Vec4::FloatType extentsX = Vec4::Sub(Vec4::Mul(maxX, half), Vec4::Mul(minX, half));
+            const Vec4::FloatType extentsY = Vec4::Sub(Vec4::Mul(maxY, half), Vec4::Mul(minY, half));
+            const Vec4::FloatType extentsZ = Vec4::Sub(Vec4::Mul(maxZ, half), Vec4::Mul(minZ, half));
+
+            // A child is outside the frustum if it's fully behind any of the planes
+            Vec4::FloatType result = Vec4::CastToFloat(Vec4::Splat(-1));
+            for (const Plane& plane : m_planes)
+            {
+                const Vec4::FloatType distance = Vec4::Add(Vec4::Add(Vec4::Add(
+                    Vec4::Mul(plane.m_normalX, centerX), Vec4::Mul(plane.m_normalY, centerY)), Vec4::Mul(plane.m_normalZ, centerZ)), plane.m_distance);
+                const Vec4::FloatType radius = Vec4::Add(Vec4::Add(
+                    Vec4::Mul(plane.m_absNormalX, extentsX), Vec4::Mul(plane.m_absNormalY, extentsY)), Vec4::Mul(plane.m_absNormalZ, extentsZ));
+                result = Vec4::And(result, Vec4::CmpGt(Vec4::Add(distance, radius), Vec4::ZeroFloat()));
+            }
+            return result;
+        }
+
+    private:
+        struct Plane
+        {
+            AZ::Simd::Vec4::FloatType m_normalX, m_normalY, m_normalZ;
+            AZ::Simd::Vec4::FloatType m_absNormalX, m_absNormalY, m_absNormalZ;
+            AZ::Simd::Vec4::FloatType m_distance;
+        };
+        Plane m_planes[static_cast<uint32_t>(AZ::Frustum::PlaneId::MAX)];
+    };
+
+
     OctreeNode::OctreeNode(const AZ::Aabb& bounds)
         : m_bounds(bounds)
     {
@@ -37,6 +184,7 @@ namespace AzFramework
         : m_bounds(rhs.m_bounds)
         , m_parent(rhs.m_parent)
         , m_children(rhs.m_children)
+        , m_childBounds(rhs.m_childBounds)
         , m_entries(AZStd::move(rhs.m_entries))
     {
         // Correct internal node pointers
@@ -52,6 +200,7 @@ namespace AzFramework
         m_bounds = rhs.m_bounds;
         m_parent = rhs.m_parent;
         m_children = rhs.m_children;
+        m_childBounds = rhs.m_childBounds;
         m_entries = AZStd::move(rhs.m_entries);
 
         // Correct internal node pointers
@@ -71,14 +220,10 @@ namespace AzFramework
         // If this is not a leaf node, try to insert into the child nodes
         if (m_children != nullptr)
         {
-            const AZ::Aabb boundingVolume = entry->m_boundingVolume;
-            const uint32_t childCount = GetChildNodeCount();
-            for (uint32_t child = 0; child < childCount; ++child)
+            const uint32_t child = FindContainingChild(entry->m_boundingVolume);
+            if (child < GetChildNodeCount())
             {
-                if (AZ::ShapeIntersection::Contains(m_children[child].m_bounds, boundingVolume))
-                {
-                    return m_children[child].Insert(octreeScene, entry);
-                }
+                return m_children[child].Insert(octreeScene, entry);
             }
         }
 
@@ -148,26 +293,26 @@ namespace AzFramework
 
         if (m_parent != nullptr)
         {
-            m_parent->TryMerge(octreeScene);
+            octreeScene.RequestMerge(*m_parent);
         }
     }
 
 
     void OctreeNode::Enumerate(const AZ::Aabb& aabb, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        EnumerateHelper(aabb, callback);
+        EnumerateHelper(AabbQuery(aabb), callback);
     }
 
 
     void OctreeNode::Enumerate(const AZ::Sphere& sphere, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        EnumerateHelper(sphere, callback);
+        EnumerateHelper(SphereQuery(sphere), callback);
     }
 
 
     void OctreeNode::Enumerate(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        EnumerateHelper(frustum, callback);
+        EnumerateHelper(FrustumQuery(frustum), callback);
     }
 
 
@@ -237,11 +382,53 @@ namespace AzFramework
     }
 
 
-    template <typename T>
-    void OctreeNode::EnumerateHelper(const T& boundingVolume, const IVisibilityScene::EnumerateCallback& callback) const
+    uint32_t OctreeNode::FindContainingChild(const AZ::Aabb& boundingVolume) const
+    {
+        using Vec4 = AZ::Simd::Vec4;
+        const Vec4::FloatType minX = Vec4::Splat(boundingVolume.GetMin().GetX());
+        const Vec4::FloatType minY = Vec4::Splat(boundingVolume.GetMin().GetY());
+        const Vec4::FloatType minZ = Vec4::Splat(boundingVolume.GetMin().GetZ());
+        const Vec4::FloatType maxX = Vec4::Splat(boundingVolume.GetMax().GetX());
+        const Vec4::FloatType maxY = Vec4::Splat(boundingVolume.GetMax().GetY());
+        const Vec4::FloatType maxZ = Vec4::Splat(boundingVolume.GetMax().GetZ());
+
+        const uint32_t childCount = GetChildNodeCount();
+        for (uint32_t firstChild = 0; firstChild < childCount; firstChild += Vec4::ElementCount)
+        {
+            const Vec4::FloatType containsMin = Vec4::And(Vec4::And(
+                Vec4::CmpLtEq(Vec4::LoadUnaligned(m_childBounds->m_minX + firstChild), minX),
+                Vec4::CmpLtEq(Vec4::LoadUnaligned(m_childBounds->m_minY + firstChild), minY)),
+                Vec4::CmpLtEq(Vec4::LoadUnaligned(m_childBounds->m_minZ + firstChild), minZ));
+            const Vec4::FloatType containsMax = Vec4::And(Vec4::And(
+                Vec4::CmpGtEq(Vec4::LoadUnaligned(m_childBounds->m_maxX + firstChild), maxX),
+                Vec4::CmpGtEq(Vec4::LoadUnaligned(m_childBounds->m_maxY + firstChild), maxY)),
+                Vec4::CmpGtEq(Vec4::LoadUnaligned(m_childBounds->m_maxZ + firstChild), maxZ));
+            const uint32_t mask = GetLaneMask(Vec4::And(containsMin, containsMax));
+            if (mask != 0)
+            {
+                return firstChild + az_ctz_u32(mask);
+            }
+        }
+        return childCount;
+    }
+
+
+    template <typename Query>
+    uint32_t OctreeNode::GetOverlappingChildren(const Query& query) const
     {
-        AZ_Assert(AZ::ShapeIntersection::Overlaps(boundingVolume, m_bounds), "EnumerateHelper invoked on an octreeSystemComponent node that is not within the bounding volume");
+        uint32_t mask = 0;
+        const uint32_t childCount = GetChildNodeCount();
+        for (uint32_t firstChild = 0; firstChild < childCount; firstChild += AZ::Simd::Vec4::ElementCount)
+        {
+            mask |= GetLaneMask(query.Overlaps(*m_childBounds, firstChild)) << firstChild;
+        }
+        return mask;
+    }
+
 
+    template <typename Query>
+    void OctreeNode::EnumerateHelper(const Query& query, const IVisibilityScene::EnumerateCallback& callback) const
+    {
         // Invoke the callback for the current node
         if (!m_entries.empty())
         {
@@ -250,14 +437,10 @@ namespace AzFramework
 
         if (m_children != nullptr)
         {
-            // If this is not a leaf node, recurse into the children
-            const uint32_t childCount = GetChildNodeCount();
-            for (uint32_t child = 0; child < childCount; ++child)
+            // If this is not a leaf node, recurse into the children that overlap the query
+            for (uint32_t mask = GetOverlappingChildren(query); mask != 0; mask &= mask - 1)
             {
-                if (AZ::ShapeIntersection::Overlaps(boundingVolume, m_children[child].m_bounds))
-                {
-                    m_children[child].EnumerateHelper(boundingVolume, callback);
-                }
+                m_children[az_ctz_u32(mask)].EnumerateHelper(query, callback);
             }
         }
     }
@@ -268,6 +451,7 @@ namespace AzFramework
         AZ_Assert(m_children == nullptr, "Split invoked on an octreeScene node that has already been split");
         m_childNodeIndex = octreeScene.AllocateChildNodes();
         m_children = octreeScene.GetChildNodesAtIndex(m_childNodeIndex);
+        m_childBounds = octreeScene.GetChildBoundsAtIndex(m_childNodeIndex);
 
         // Set child split planes and bounding volumes
         {
@@ -297,8 +481,16 @@ namespace AzFramework
                     childOffset.SetZ(childExtent.GetZ());
                 }
 
-                m_children[child].m_bounds = childBound.GetTranslated(childOffset);
+                const AZ::Aabb bounds = childBound.GetTranslated(childOffset);
+                m_children[child].m_bounds = bounds;
                 m_children[child].m_parent = this;
+
+                m_childBounds->m_minX[child] = bounds.GetMin().GetX();
+                m_childBounds->m_minY[child] = bounds.GetMin().GetY();
+                m_childBounds->m_minZ[child] = bounds.GetMin().GetZ();
+                m_childBounds->m_maxX[child] = bounds.GetMax().GetX();
+                m_childBounds->m_maxY[child] = bounds.GetMax().GetY();
+                m_childBounds->m_maxZ[child] = bounds.GetMax().GetZ();
             }
         }
 
@@ -333,6 +525,7 @@ namespace AzFramework
         octreeScene.ReleaseChildNodes(m_childNodeIndex);
         m_childNodeIndex = InvalidChildNodeIndex;
         m_children = nullptr;
+        m_childBounds = nullptr;
     }
 
     OctreeScene::OctreeScene(const AZ::Name& sceneName)
@@ -350,6 +543,13 @@ namespace AzFramework
         }
         m_nodeCache.reserve(0);
         m_nodeCache.shrink_to_fit();
+
+        for (auto page : m_childBoundsCache)
+        {
+            delete page;
+        }
+        m_childBoundsCache.reserve(0);
+        m_childBoundsCache.shrink_to_fit();
     }
 
     const AZ::Name& OctreeScene::GetName() const
@@ -360,6 +560,45 @@ namespace AzFramework
     void OctreeScene::InsertOrUpdateEntry(VisibilityEntry& entry)
     {
         AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
+        InsertOrUpdateEntryInternal(entry);
+    }
+
+
+    void OctreeScene::RemoveEntry(VisibilityEntry& entry)
+    {
+        AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
+        RemoveEntryInternal(entry);
+    }
+
+
+    void OctreeScene::InsertOrUpdateEntries(const AZStd::vector<VisibilityEntry*>& entries)
+    {
+        AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
+        m_deferMerges = true;
+        for (VisibilityEntry* entry : entries)
+        {
+            InsertOrUpdateEntryInternal(*entry);
+        }
+        m_deferMerges = false;
+        ProcessPendingMerges();
+    }
+
+
+    void OctreeScene::RemoveEntries(const AZStd::vector<VisibilityEntry*>& entries)
+    {
+        AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
+        m_deferMerges = true;
+        for (VisibilityEntry* entry : entries)
+        {
+            RemoveEntryInternal(*entry);
+        }
+        m_deferMerges = false;
+        ProcessPendingMerges();
+    }
+
+
+    void OctreeScene::InsertOrUpdateEntryInternal(VisibilityEntry& entry)
+    {
         if (entry.m_internalNode != nullptr)
         {
             static_cast<OctreeNode*>(entry.m_internalNode)->Update(*this, &entry);
@@ -372,9 +611,8 @@ namespace AzFramework
     }
 
 
-    void OctreeScene::RemoveEntry(VisibilityEntry& entry)
+    void OctreeScene::RemoveEntryInternal(VisibilityEntry& entry)
     {
-        AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
         if (entry.m_internalNode)
         {
             static_cast<OctreeNode*>(entry.m_internalNode)->Remove(*this, &entry);
@@ -383,6 +621,33 @@ namespace AzFramework
     }
 
 
+    void OctreeScene::RequestMerge(OctreeNode& node)
+    {
+        if (m_deferMerges)
+        {
+            m_pendingMerges.push_back(&node);
+        }
+        else
+        {
+            node.TryMerge(*this);
+        }
+    }
+
+
+    void OctreeScene::ProcessPendingMerges()
+    {
+        // Nodes are never freed while the scene exists, so a pending node that was merged into its own parent in the meantime
+        // is a leaf, or has been reused elsewhere in the tree. TryMerge is safe to call in both cases.
+        AZStd::sort(m_pendingMerges.begin(), m_pendingMerges.end());
+        m_pendingMerges.erase(AZStd::unique(m_pendingMerges.begin(), m_pendingMerges.end()), m_pendingMerges.end());
+        for (OctreeNode* node : m_pendingMerges)
+        {
+            node->TryMerge(*this);
+        }
+        m_pendingMerges.clear();
+    }
+
+
     void OctreeScene::Enumerate(const AZ::Aabb& aabb, const IVisibilityScene::EnumerateCallback& callback) const
     {
         AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
@@ -404,6 +669,73 @@ namespace AzFramework
     }
 
 
+    void OctreeScene::EnumerateParallel(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+
+        AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+        const uint32_t workerCount = jobContext ? jobContext->GetJobManager().GetNumWorkerThreads() : 0;
+        if (workerCount <= 1)
+        {
+            m_root.Enumerate(frustum, callback);
+            return;
+        }
+
+        // Expand the top of the tree breadth first on the calling thread until there are enough subtrees to keep the workers
+        // busy. The entries of the expanded nodes are reported from here, the subtrees are each enumerated in a separate job.
+        const FrustumQuery query(frustum);
+        const size_t targetSubtreeCount = AZStd::max<size_t>(static_cast<size_t>(workerCount) * bg_octreeParallelSubtreesPerWorker, 2);
+        AZStd::vector<const OctreeNode*> subtrees;
+        AZStd::vector<const OctreeNode*> frontier{ &m_root };
+        AZStd::vector<const OctreeNode*> nextFrontier;
+        while (!frontier.empty() && subtrees.size() + frontier.size() < targetSubtreeCount)
+        {
+            for (const OctreeNode* node : frontier)
+            {
+                if (node->IsLeaf())
+                {
+                    subtrees.push_back(node);
+                    continue;
+                }
+
+                if (!node->m_entries.empty())
+                {
+                    callback({node->m_bounds, node->m_entries});
+                }
+
+                for (uint32_t mask = node->GetOverlappingChildren(query); mask != 0; mask &= mask - 1)
+                {
+                    nextFrontier.push_back(&node->m_children[az_ctz_u32(mask)]);
+                }
+            }
+            frontier.swap(nextFrontier);
+            nextFrontier.clear();
+        }
+        subtrees.insert(subtrees.end(), frontier.begin(), frontier.end());
+
+        if (subtrees.size() <= 1)
+        {
+            for (const OctreeNode* subtree : subtrees)
+            {
+                subtree->EnumerateHelper(query, callback);
+            }
+            return;
+        }
+
+        AZ::JobCompletion jobCompletion(jobContext);
+        for (const OctreeNode* subtree : subtrees)
+        {
+            AZ::Job* job = AZ::CreateJobFunction([subtree, &query, &callback]()
+            {
+                subtree->EnumerateHelper(query, callback);
+            }, true, jobContext);
+            job->SetDependent(&jobCompletion);
+            job->Start();
+        }
+        jobCompletion.StartAndWaitForCompletion();
+    }
+
+
     void OctreeScene::EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const
     {
         AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
@@ -473,6 +805,7 @@ namespace AzFramework
         if (m_nodeCache.empty())
         {
             m_nodeCache.push_back(new OctreeNodePage);
+            m_childBoundsCache.push_back(new OctreeChildBoundsPage(BlockSize / childCount));
         }
 
         uint32_t nextChildPage = aznumeric_cast<uint32_t>(m_nodeCache.size() - 1);
@@ -490,6 +823,7 @@ namespace AzFramework
             {
                 // Our last page is already full, so we need to allocate a new page
                 m_nodeCache.push_back(new OctreeNodePage);
+                m_childBoundsCache.push_back(new OctreeChildBoundsPage(BlockSize / childCount));
                 ++nextChildPage;
                 nextChildOffset = 0;
             }
@@ -525,6 +859,16 @@ namespace AzFramework
     }
 
 
+    OctreeChildBounds* OctreeScene::GetChildBoundsAtIndex(uint32_t nodeIndex) const
+    {
+        // Blocks of child nodes are always allocated at multiples of the child count within a page
+        uint32_t childPage;
+        uint32_t childOffset;
+        ExtractPageAndOffsetFromIndex(nodeIndex, childPage, childOffset);
+        return &(*m_childBoundsCache[childPage])[childOffset / GetChildNodeCount()];
+    }
+
+
     void OctreeSystemComponent::Reflect(AZ::ReflectContext* context)
     {
         if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
@@ -21,6 +21,20 @@ namespace AzFramework
     class OctreeSystemComponent;
     class OctreeScene;
 
+    //! The bounds of a block of sibling OctreeNodes, stored as a structure of arrays.
+    //! This allows queries to be tested against four child nodes at once using SIMD instructions.
+    struct OctreeChildBounds
+    {
+        static constexpr uint32_t MaxChildCount = 8;
+
+        float m_minX[MaxChildCount];
+        float m_minY[MaxChildCount];
+        float m_minZ[MaxChildCount];
+        float m_maxX[MaxChildCount];
+        float m_maxY[MaxChildCount];
+        float m_maxZ[MaxChildCount];
+    };
+
     //! An internal node within the tree.
     //! It contains all objects that are *fully contained* by the node, if an object spans multiple child nodes that object will be stored in the parent.
     class OctreeNode
@@ -70,8 +84,15 @@ namespace AzFramework
 
         void TryMerge(OctreeScene& octreeScene);
 
-        template <typename T>
-        void EnumerateHelper(const T& boundingVolume, const IVisibilityScene::EnumerateCallback& callback) const;
+        //! Returns the index of the first child node that fully contains the bounding volume, or the child count if there is none.
+        uint32_t FindContainingChild(const AZ::Aabb& boundingVolume) const;
+
+        //! Returns a mask with a bit set for every child node that overlaps the query.
+        template <typename Query>
+        uint32_t GetOverlappingChildren(const Query& query) const;
+
+        template <typename Query>
+        void EnumerateHelper(const Query& query, const IVisibilityScene::EnumerateCallback& callback) const;
 
         void Split(OctreeScene& octreeScene);
         void Merge(OctreeScene& octreeScene);
@@ -83,7 +104,10 @@ namespace AzFramework
         AZ::Aabb m_bounds;
         OctreeNode* m_parent = nullptr; //< This is a pointer to an array of GetChildNodeCount() nodes, or nullptr if this is a leaf node
         OctreeNode* m_children = nullptr;
+        OctreeChildBounds* m_childBounds = nullptr; //< The bounds of the child nodes, or nullptr if this is a leaf node
         AZStd::vector<VisibilityEntry*> m_entries;
+
+        friend class OctreeScene; // For access to the query helpers during parallel enumeration
     };
 
     //! Implementation of the visibility system interface.
@@ -104,9 +128,12 @@ namespace AzFramework
         const AZ::Name& GetName() const override;
         void InsertOrUpdateEntry(VisibilityEntry& entry) override;
         void RemoveEntry(VisibilityEntry& entry) override;
+        void InsertOrUpdateEntries(const AZStd::vector<VisibilityEntry*>& entries) override;
+        void RemoveEntries(const AZStd::vector<VisibilityEntry*>& entries) override;
         void Enumerate(const AZ::Aabb& aabb, const IVisibilityScene::EnumerateCallback& callback) const override;
         void Enumerate(const AZ::Sphere& sphere, const IVisibilityScene::EnumerateCallback& callback) const override;
         void Enumerate(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const override;
+        void EnumerateParallel(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const override;
         void EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const override;
         uint32_t GetEntryCount() const override;
         //! @}
@@ -121,9 +148,19 @@ namespace AzFramework
         //! @}
 
     private:
+        void InsertOrUpdateEntryInternal(VisibilityEntry& entry);
+        void RemoveEntryInternal(VisibilityEntry& entry);
+
+        //! Requests a merge check for a node after an entry was removed from one of its children.
+        //! During batched updates the checks are deferred until the end of the batch, so entries that move back and forth
+        //! across node boundaries don't repeatedly merge and split the same nodes.
+        void RequestMerge(OctreeNode& node);
+        void ProcessPendingMerges();
+
         uint32_t AllocateChildNodes();
         void ReleaseChildNodes(uint32_t nodeIndex);
         OctreeNode* GetChildNodesAtIndex(uint32_t nodeIndex) const;
+        OctreeChildBounds* GetChildBoundsAtIndex(uint32_t nodeIndex) const;
 
         mutable AZStd::shared_mutex m_sharedMutex;
 
@@ -140,6 +177,12 @@ namespace AzFramework
         AZStd::vector<OctreeNodePage*> m_nodeCache; //< Array of contiguous memory blocks for all allocated nodes within the tree.
         AZStd::stack<uint32_t> m_freeOctreeNodes; //< Indices of free nodes, each entry represents a contiguous block of free OctreeNodeChildCount nodes.
 
+        using OctreeChildBoundsPage = AZStd::vector<OctreeChildBounds>;
+        AZStd::vector<OctreeChildBoundsPage*> m_childBoundsCache; //< Child bounds for each block of nodes, stored in pages that parallel the node pages.
+
+        bool m_deferMerges = false; //< True while a batch of entries is updated, merge checks are collected in m_pendingMerges.
+        AZStd::vector<OctreeNode*> m_pendingMerges;
+
         friend class OctreeNode; // For access to the node allocator methods
     };
 
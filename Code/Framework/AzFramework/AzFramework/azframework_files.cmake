@@ -37,6 +37,7 @@ set(FILES
     Archive/ZipDirCache.h
     Archive/ZipDirCacheFactory.h
     Archive/ZipDirFind.h
+    Archive/ZipDirIndex.h
     Archive/ZipDirList.h
     Archive/ZipDirStructures.h
     Archive/ZipDirTree.h
@@ -54,6 +55,8 @@ set(FILES
     Asset/AssetProcessorMessages.h
     Asset/AssetRegistry.h
     Asset/AssetRegistry.cpp
+    Asset/FlatAssetRegistry.h
+    Asset/FlatAssetRegistry.cpp
     Asset/AssetSeedList.cpp
     Asset/AssetSeedList.h
     Asset/AssetSystemComponent.cpp
@@ -287,6 +290,8 @@ set(FILES
     Spawnable/Spawnable.h
     Spawnable/SpawnableAssetHandler.h
     Spawnable/SpawnableAssetHandler.cpp
+    Spawnable/SpawnableClonePlan.h
+    Spawnable/SpawnableClonePlan.cpp
     Spawnable/SpawnableEntitiesContainer.h
     Spawnable/SpawnableEntitiesContainer.cpp
     Spawnable/SpawnableEntitiesInterface.h
@@ -13,6 +13,7 @@ set(FILES
     AzFramework/API/ApplicationAPI_Android.h
     AzFramework/Application/Application_Android.cpp
     ../Common/Unimplemented/AzFramework/Asset/AssetSystemComponentHelper_Unimplemented.cpp
+    ../Common/Unimplemented/AzFramework/Asset/FlatAssetRegistry_Unimplemented.cpp
     AzFramework/IO/LocalFileIO_Android.cpp
     ../Common/Unimplemented/AzFramework/StreamingInstall/StreamingInstall_Unimplemented.cpp
     ../Common/Default/AzFramework/TargetManagement/TargetManagementComponent_Default.cpp
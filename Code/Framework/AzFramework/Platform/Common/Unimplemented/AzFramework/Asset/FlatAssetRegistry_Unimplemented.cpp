@@ -0,0 +1,22 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/base.h>
+
+namespace AzFramework::Platform
+{
+    // Files aren't memory mapped on this platform, so flat asset catalogs are read through the FileIO instead.
+    const char* MapFlatAssetRegistry([[maybe_unused]] const char* filePath, [[maybe_unused]] size_t& size)
+    {
+        return nullptr;
+    }
+
+    void UnmapFlatAssetRegistry([[maybe_unused]] const char* data, [[maybe_unused]] size_t size)
+    {
+    }
+} // namespace AzFramework::Platform
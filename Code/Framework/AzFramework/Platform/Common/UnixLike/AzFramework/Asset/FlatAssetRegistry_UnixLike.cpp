@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <AzCore/base.h>
+
+namespace AzFramework::Platform
+{
+    const char* MapFlatAssetRegistry(const char* filePath, size_t& size)
+    {
+        int fileDescriptor = open(filePath, O_RDONLY | O_CLOEXEC);
+        if (fileDescriptor < 0)
+        {
+            return nullptr;
+        }
+
+        void* data = MAP_FAILED;
+        struct stat fileStats;
+        if (fstat(fileDescriptor, &fileStats) == 0 && S_ISREG(fileStats.st_mode) && fileStats.st_size > 0)
+        {
+            size = static_cast<size_t>(fileStats.st_size);
+            data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+        }
+        // The mapping keeps its own reference to the file.
+        close(fileDescriptor);
+        return data != MAP_FAILED ? reinterpret_cast<const char*>(data) : nullptr;
+    }
+
+    void UnmapFlatAssetRegistry(const char* data, size_t size)
+    {
+        munmap(const_cast<char*>(data), size);
+    }
+} // namespace AzFramework::Platform
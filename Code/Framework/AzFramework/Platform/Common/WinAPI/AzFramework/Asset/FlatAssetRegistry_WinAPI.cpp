@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/PlatformIncl.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/string/conversions.h>
+
+namespace AzFramework::Platform
+{
+    const char* MapFlatAssetRegistry(const char* filePath, size_t& size)
+    {
+        wchar_t filePathW[AZ_MAX_PATH_LEN];
+        AZStd::to_wstring(filePathW, AZ_MAX_PATH_LEN, filePath);
+        HANDLE file = CreateFileW(filePathW, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING,
+            FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            return nullptr;
+        }
+
+        void* data = nullptr;
+        LARGE_INTEGER fileSize;
+        if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0)
+        {
+            HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (mapping)
+            {
+                data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+                // The view keeps its own reference to the mapping and the file.
+                CloseHandle(mapping);
+                size = static_cast<size_t>(fileSize.QuadPart);
+            }
+        }
+        CloseHandle(file);
+        return reinterpret_cast<const char*>(data);
+    }
+
+    void UnmapFlatAssetRegistry(const char* data, [[maybe_unused]] size_t size)
+    {
+        UnmapViewOfFile(data);
+    }
+} // namespace AzFramework::Platform
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Settings/SettingsRegistryMergeUtils.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/UserSettings/UserSettingsComponent.h>
+#include <AzFramework/Application/Application.h>
+#include <AzFramework/Archive/IArchive.h>
+#include <AzFramework/Archive/INestedArchive.h>
+
+#if defined(HAVE_BENCHMARK)
+
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    class BM_Archive
+        : public benchmark::Fixture
+    {
+    public:
+        static constexpr const char* ArchiveFolder = "@usercache@/archivebenchmark";
+        static constexpr const char* IndexedArchiveFolder = "@usercache@/archivebenchmarkindexed";
+        static constexpr int ArchiveCount = 16;
+        static constexpr int FilesPerArchive = 4096;
+
+        void SetUp([[maybe_unused]] const ::benchmark::State& state) override
+        {
+            if (!AZ::AllocatorInstance<AZ::SystemAllocator>::IsReady())
+            {
+                AZ::AllocatorInstance<AZ::SystemAllocator>::Create();
+                m_ownsSystemAllocator = true;
+            }
+
+            m_application = AZStd::make_unique<AzFramework::Application>();
+            AZ::SettingsRegistryInterface* registry = AZ::SettingsRegistry::Get();
+            auto projectPathKey =
+                AZ::SettingsRegistryInterface::FixedValueString(AZ::SettingsRegistryMergeUtils::BootstrapSettingsRootKey) + "/project_path";
+            registry->Set(projectPathKey, "AutomatedTesting");
+            AZ::SettingsRegistryMergeUtils::MergeSettingsToRegistry_AddRuntimeFilePaths(*registry);
+
+            m_application->Start(AZ::ComponentApplication::Descriptor{});
+            AZ::UserSettingsComponentRequestBus::Broadcast(&AZ::UserSettingsComponentRequests::DisableSaveOnFinalize);
+
+            m_archive = AZ::Interface<AZ::IO::IArchive>::Get();
+            m_console = AZ::Interface<AZ::IConsole>::Get();
+            CreateArchives(ArchiveFolder, false);
+            CreateArchives(IndexedArchiveFolder, true);
+        }
+
+        void TearDown([[maybe_unused]] const ::benchmark::State& state) override
+        {
+            AZ::IO::FileIOBase::GetInstance()->DestroyPath(ArchiveFolder);
+            AZ::IO::FileIOBase::GetInstance()->DestroyPath(IndexedArchiveFolder);
+            m_console->PerformCommand("az_archive_parallel_mount", { "true" });
+            m_console->PerformCommand("az_archive_zip_directory_parallel_threshold", { "2048" });
+
+            m_application->Stop();
+            m_application.reset();
+
+            if (m_ownsSystemAllocator)
+            {
+                AZ::AllocatorInstance<AZ::SystemAllocator>::Destroy();
+                m_ownsSystemAllocator = false;
+            }
+        }
+
+        void SetParallelMount(bool enabled)
+        {
+            m_console->PerformCommand("az_archive_parallel_mount", { enabled ? "true" : "false" });
+            m_console->PerformCommand("az_archive_zip_directory_parallel_threshold", { enabled ? "2048" : "0" });
+        }
+
+        void OpenAndCloseArchives(::benchmark::State& state, const char* folder)
+        {
+            const auto wildcard = AZStd::string::format("%s/*.pak", folder);
+            AZStd::vector<AZ::IO::FixedMaxPathString> fullPaths;
+            for ([[maybe_unused]] auto _ : state)
+            {
+                m_archive->OpenPacks(wildcard, AZ::IO::IArchive::EPathResolutionRules::FLAGS_PATH_REAL, &fullPaths);
+
+                state.PauseTiming();
+                for (const AZ::IO::FixedMaxPathString& fullPath : fullPaths)
+                {
+                    m_archive->ClosePack(fullPath);
+                }
+                fullPaths.clear();
+                state.ResumeTiming();
+            }
+            state.SetItemsProcessed(state.iterations() * ArchiveCount * FilesPerArchive);
+        }
+
+    private:
+        void CreateArchives(const char* folder, bool writeDirectoryIndex)
+        {
+            AZ::IO::FileIOBase::GetInstance()->CreatePath(folder);
+            for (int archiveIndex = 0; archiveIndex < ArchiveCount; ++archiveIndex)
+            {
+                const auto archivePath = AZStd::string::format("%s/archive%02d.pak", folder, archiveIndex);
+                auto archive = m_archive->OpenArchive(archivePath, {}, AZ::IO::INestedArchive::FLAGS_CREATE_NEW);
+                for (int fileIndex = 0; fileIndex < FilesPerArchive; ++fileIndex)
+                {
+                    const auto filePath = AZStd::string::format("Textures/Folder%02d/SubFolder%02d/Texture%04d.dds",
+                        fileIndex % 16, (fileIndex / 16) % 16, fileIndex);
+                    archive->UpdateFile(filePath, filePath.data(), filePath.size());
+                }
+                if (writeDirectoryIndex)
+                {
+                    archive->WriteDirectoryIndex();
+                }
+            }
+        }
+
+        AZStd::unique_ptr<AzFramework::Application> m_application;
+        AZ::IO::IArchive* m_archive{};
+        AZ::IConsole* m_console{};
+        bool m_ownsSystemAllocator{};
+    };
+
+    BENCHMARK_F(BM_Archive, OpenPacks_Serial)(benchmark::State& state)
+    {
+        SetParallelMount(false);
+        OpenAndCloseArchives(state, ArchiveFolder);
+    }
+
+    BENCHMARK_F(BM_Archive, OpenPacks_Parallel)(benchmark::State& state)
+    {
+        SetParallelMount(true);
+        OpenAndCloseArchives(state, ArchiveFolder);
+    }
+
+    BENCHMARK_F(BM_Archive, OpenPacks_SerialWithDirectoryIndex)(benchmark::State& state)
+    {
+        SetParallelMount(false);
+        OpenAndCloseArchives(state, IndexedArchiveFolder);
+    }
+
+    BENCHMARK_F(BM_Archive, OpenPacks_ParallelWithDirectoryIndex)(benchmark::State& state)
+    {
+        SetParallelMount(true);
+        OpenAndCloseArchives(state, IndexedArchiveFolder);
+    }
+} // namespace Benchmark
+
+#endif
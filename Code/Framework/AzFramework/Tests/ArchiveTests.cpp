@@ -8,6 +8,7 @@
 
 #include <AzTest/AzTest.h>
 #include <AzCore/Console/IConsole.h>
+#include <AzCore/IO/CompressionBus.h>
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/UnitTest/UnitTest.h>
 
@@ -23,6 +24,7 @@
 #include <AzFramework/Archive/Archive.h>
 #include <AzFramework/Archive/ArchiveVars.h>
 #include <AzFramework/Archive/INestedArchive.h>
+#include <AzFramework/Archive/ZipDirStructures.h>
 
 namespace UnitTest
 {
@@ -310,6 +312,226 @@ namespace UnitTest
         EXPECT_TRUE(AZStd::any_of(fullPaths.cbegin(), fullPaths.cend(), [](auto& path) { return path.ends_with("two.pak"); }));
     }
 
+    TEST_F(ArchiveTestFixture, TestArchiveDirectoryIndex_ReopenedArchive_FindsAllFiles)
+    {
+        AZ::IO::IArchive* archive = AZ::Interface<AZ::IO::IArchive>::Get();
+        ASSERT_NE(nullptr, archive);
+
+        AZ::IO::FileIOBase* fileIo = AZ::IO::FileIOBase::GetInstance();
+        ASSERT_NE(nullptr, fileIo);
+
+        constexpr const char* testArchivePath = "@usercache@/directoryindex.pak";
+        constexpr AZStd::string_view testFiles[] = { "root.txt", "Levels\\MyLevel\\LevelInfo.xml", "levels/mylevel/level.pak",
+            "levels/otherlevel/level.pak", "textures/a.dds", "textures/b.dds", "textures/sub/c.dds" };
+
+        archive->ClosePack(testArchivePath);
+        fileIo->Remove(testArchivePath);
+
+        {
+            auto pArchive = archive->OpenArchive(testArchivePath, {}, AZ::IO::INestedArchive::FLAGS_CREATE_NEW);
+            ASSERT_NE(nullptr, pArchive);
+            for (AZStd::string_view testFile : testFiles)
+            {
+                EXPECT_EQ(0, pArchive->UpdateFile(testFile, testFile.data(), testFile.size(), AZ::IO::INestedArchive::METHOD_COMPRESS,
+                    AZ::IO::INestedArchive::LEVEL_FASTEST));
+            }
+            EXPECT_EQ(0, pArchive->WriteDirectoryIndex());
+        }
+
+        // the archive is read through the index now
+        auto pArchive = archive->OpenArchive(testArchivePath, {}, AZ::IO::INestedArchive::FLAGS_READ_ONLY);
+        ASSERT_NE(nullptr, pArchive);
+        for (AZStd::string_view testFile : testFiles)
+        {
+            AZ::IO::INestedArchive::Handle fileHandle = pArchive->FindFile(testFile);
+            ASSERT_NE(nullptr, fileHandle) << "File " << testFile.data() << " wasn't found in the archive";
+            AZStd::string content(pArchive->GetFileSize(fileHandle), '\0');
+            EXPECT_EQ(0, pArchive->ReadFile(fileHandle, content.data()));
+            EXPECT_EQ(testFile, content);
+        }
+        EXPECT_EQ(nullptr, pArchive->FindFile("textures/d.dds"));
+        pArchive.reset();
+
+        fileIo->Remove(testArchivePath);
+    }
+
+    TEST_F(ArchiveTestFixture, TestArchiveDirectoryIndex_ArchiveChangedAfterWritingIndex_IndexIsIgnored)
+    {
+        AZ::IO::IArchive* archive = AZ::Interface<AZ::IO::IArchive>::Get();
+        ASSERT_NE(nullptr, archive);
+
+        AZ::IO::FileIOBase* fileIo = AZ::IO::FileIOBase::GetInstance();
+        ASSERT_NE(nullptr, fileIo);
+
+        constexpr const char* testArchivePath = "@usercache@/staledirectoryindex.pak";
+        constexpr AZStd::string_view indexedFile = "levels/indexed.txt";
+        constexpr AZStd::string_view addedFile = "levels/added.txt";
+
+        archive->ClosePack(testArchivePath);
+        fileIo->Remove(testArchivePath);
+
+        {
+            auto pArchive = archive->OpenArchive(testArchivePath, {}, AZ::IO::INestedArchive::FLAGS_CREATE_NEW);
+            ASSERT_NE(nullptr, pArchive);
+            EXPECT_EQ(0, pArchive->UpdateFile(indexedFile, indexedFile.data(), indexedFile.size()));
+            EXPECT_EQ(0, pArchive->WriteDirectoryIndex());
+        }
+        {
+            auto pArchive = archive->OpenArchive(testArchivePath);
+            ASSERT_NE(nullptr, pArchive);
+            EXPECT_EQ(0, pArchive->UpdateFile(addedFile, addedFile.data(), addedFile.size()));
+        }
+
+        auto pArchive = archive->OpenArchive(testArchivePath, {}, AZ::IO::INestedArchive::FLAGS_READ_ONLY);
+        ASSERT_NE(nullptr, pArchive);
+        EXPECT_NE(nullptr, pArchive->FindFile(indexedFile));
+        EXPECT_NE(nullptr, pArchive->FindFile(addedFile));
+        pArchive.reset();
+
+        fileIo->Remove(testArchivePath);
+    }
+
+    TEST_F(ArchiveTestFixture, TestArchiveOpenPacks_ParallelMount_KeepsArchivePriority)
+    {
+        AZ::IO::IArchive* archive = AZ::Interface<AZ::IO::IArchive>::Get();
+        ASSERT_NE(nullptr, archive);
+
+        AZ::IO::FileIOBase* fileIo = AZ::IO::FileIOBase::GetInstance();
+        ASSERT_NE(nullptr, fileIo);
+
+        auto console = AZ::Interface<AZ::IConsole>::Get();
+        ASSERT_NE(nullptr, console);
+
+        constexpr const char* testArchiveFolder = "@usercache@/parallelmount";
+        constexpr const char* testArchiveWildcard = "@usercache@/parallelmount/*.pak";
+        constexpr const char* sharedFilePath = "@usercache@/parallelmount/shared.txt";
+        constexpr AZStd::string_view archiveNames[] = { "d", "b", "e", "a", "c" };
+        constexpr size_t archiveCount = AZStd::size(archiveNames);
+
+        fileIo->CreatePath(testArchiveFolder);
+        for (AZStd::string_view archiveName : archiveNames)
+        {
+            const auto archivePath = AZStd::string::format("%s/%.*s.pak", testArchiveFolder, AZ_STRING_ARG(archiveName));
+            archive->ClosePack(archivePath);
+            fileIo->Remove(archivePath.c_str());
+
+            auto pArchive = archive->OpenArchive(archivePath, {}, AZ::IO::INestedArchive::FLAGS_CREATE_NEW);
+            ASSERT_NE(nullptr, pArchive);
+            EXPECT_EQ(0, pArchive->UpdateFile("shared.txt", archiveName.data(), archiveName.size()));
+        }
+
+        auto ReadSharedFile = [archive, testArchiveWildcard, sharedFilePath, archiveCount]()
+        {
+            AZStd::vector<AZ::IO::FixedMaxPathString> fullPaths;
+            EXPECT_TRUE(archive->OpenPacks(testArchiveWildcard, AZ::IO::IArchive::EPathResolutionRules::FLAGS_PATH_REAL, &fullPaths));
+            EXPECT_EQ(archiveCount, fullPaths.size());
+
+            AZStd::string content;
+            AZ::IO::HandleType fileHandle = archive->FOpen(sharedFilePath, "rb");
+            EXPECT_NE(AZ::IO::InvalidHandle, fileHandle);
+            if (fileHandle != AZ::IO::InvalidHandle)
+            {
+                size_t fileSize = 0;
+                auto fileData = reinterpret_cast<const char*>(archive->FGetCachedFileData(fileHandle, fileSize));
+                content.assign(fileData, fileData + fileSize);
+                archive->FClose(fileHandle);
+            }
+
+            for (const AZ::IO::FixedMaxPathString& fullPath : fullPaths)
+            {
+                EXPECT_TRUE(archive->ClosePack(fullPath));
+            }
+            return content;
+        };
+
+        console->PerformCommand("az_archive_parallel_mount", { "false" });
+        const AZStd::string serialContent = ReadSharedFile();
+        console->PerformCommand("az_archive_parallel_mount", { "true" });
+        const AZStd::string parallelContent = ReadSharedFile();
+
+        EXPECT_FALSE(serialContent.empty());
+        EXPECT_EQ(serialContent, parallelContent);
+
+        fileIo->DestroyPath(testArchiveFolder);
+    }
+
+    TEST_F(ArchiveTestFixture, TestArchiveZstdSeekable_CompressedInChunks_ReadsAsWholeAndPerChunk)
+    {
+        AZ::IO::IArchive* archive = AZ::Interface<AZ::IO::IArchive>::Get();
+        ASSERT_NE(nullptr, archive);
+
+        AZ::IO::FileIOBase* fileIo = AZ::IO::FileIOBase::GetInstance();
+        ASSERT_NE(nullptr, fileIo);
+
+        constexpr const char* testArchiveFolder = "@usercache@/seekable";
+        constexpr const char* testArchivePath = "@usercache@/seekable/seekable.pak";
+        constexpr const char* testFilePath = "@usercache@/seekable/chunked.bin";
+        // two and a half chunks of data
+        constexpr size_t fileSize = 5 * AZ::IO::ZipDir::ZSTDSeekableChunkSize / 2;
+
+        AZStd::vector<uint8_t> fileData(fileSize);
+        for (size_t i = 0; i < fileSize; ++i)
+        {
+            fileData[i] = static_cast<uint8_t>((i * 7) ^ (i >> 11));
+        }
+
+        fileIo->CreatePath(testArchiveFolder);
+        archive->ClosePack(testArchivePath);
+        fileIo->Remove(testArchivePath);
+        {
+            auto pArchive = archive->OpenArchive(testArchivePath, {}, AZ::IO::INestedArchive::FLAGS_CREATE_NEW);
+            ASSERT_NE(nullptr, pArchive);
+            EXPECT_EQ(0, pArchive->UpdateFile("chunked.bin", fileData.data(), fileData.size(), AZ::IO::INestedArchive::METHOD_COMPRESS,
+                AZ::IO::INestedArchive::LEVEL_FASTEST, CompressionCodec::Codec::ZSTD_SEEKABLE));
+
+            // the chunks together with the seek table form a regular zstd stream, so the file can still be read as a whole
+            AZ::IO::INestedArchive::Handle fileHandle = pArchive->FindFile("chunked.bin");
+            ASSERT_NE(nullptr, fileHandle);
+            AZStd::vector<uint8_t> content(pArchive->GetFileSize(fileHandle));
+            EXPECT_EQ(0, pArchive->ReadFile(fileHandle, content.data()));
+            EXPECT_EQ(fileData, content);
+
+            EXPECT_EQ(0, pArchive->UpdateFile("plain.bin", fileData.data(), fileData.size(), AZ::IO::INestedArchive::METHOD_COMPRESS,
+                AZ::IO::INestedArchive::LEVEL_FASTEST, CompressionCodec::Codec::ZLIB));
+        }
+
+        ASSERT_TRUE(archive->OpenPack(testArchivePath));
+        AZ::IO::CompressionInfo plainInfo;
+        ASSERT_TRUE(AZ::IO::CompressionUtils::FindCompressionInfo(plainInfo, "@usercache@/seekable/plain.bin"));
+        EXPECT_TRUE(plainInfo.m_isCompressed);
+        EXPECT_EQ(nullptr, plainInfo.m_seekTable);
+
+        AZ::IO::CompressionInfo info;
+        ASSERT_TRUE(AZ::IO::CompressionUtils::FindCompressionInfo(info, testFilePath));
+        EXPECT_TRUE(info.m_isCompressed);
+        ASSERT_NE(nullptr, info.m_seekTable);
+        const AZ::IO::CompressionSeekTable& seekTable = *info.m_seekTable;
+        ASSERT_EQ(4, seekTable.size());
+        EXPECT_EQ(0, seekTable.front().m_compressedOffset);
+        EXPECT_EQ(0, seekTable.front().m_uncompressedOffset);
+        EXPECT_EQ(fileSize, seekTable.back().m_uncompressedOffset);
+        EXPECT_LT(seekTable.back().m_compressedOffset, info.m_compressedSize);
+
+        // decompress the middle chunk on its own
+        AZStd::vector<uint8_t> compressed(info.m_compressedSize);
+        AZ::IO::HandleType archiveHandle = AZ::IO::InvalidHandle;
+        ASSERT_TRUE(fileIo->Open(testArchivePath, AZ::IO::OpenMode::ModeRead | AZ::IO::OpenMode::ModeBinary, archiveHandle));
+        EXPECT_TRUE(fileIo->Seek(archiveHandle, info.m_offset, AZ::IO::SeekType::SeekFromStart));
+        EXPECT_TRUE(fileIo->Read(archiveHandle, compressed.data(), compressed.size(), true));
+        fileIo->Close(archiveHandle);
+
+        const size_t chunkCompressedSize = seekTable[2].m_compressedOffset - seekTable[1].m_compressedOffset;
+        const size_t chunkSize = seekTable[2].m_uncompressedOffset - seekTable[1].m_uncompressedOffset;
+        EXPECT_EQ(AZ::IO::ZipDir::ZSTDSeekableChunkSize, chunkSize);
+        AZStd::vector<uint8_t> chunk(chunkSize);
+        EXPECT_TRUE(info.m_decompressor(info, compressed.data() + seekTable[1].m_compressedOffset, chunkCompressedSize,
+            chunk.data(), chunk.size()));
+        EXPECT_EQ(0, memcmp(chunk.data(), fileData.data() + seekTable[1].m_uncompressedOffset, chunkSize));
+
+        EXPECT_TRUE(archive->ClosePack(testArchivePath));
+        fileIo->DestroyPath(testArchiveFolder);
+    }
+
     TEST_F(ArchiveTestFixture, TestArchiveFGetCachedFileData_LooseFile)
     {
         // ------setup loose file FGetCachedFileData tests -------------------------
@@ -21,10 +21,13 @@
 #include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/Settings/SettingsRegistryMergeUtils.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/UserSettings/UserSettingsComponent.h>
 #include <AzFramework/Asset/AssetCatalog.h>
 #include <AzFramework/Asset/AssetProcessorMessages.h>
+#include <AzFramework/Asset/AssetRegistry.h>
+#include <AzFramework/Asset/FlatAssetRegistry.h>
 #include <AzFramework/Asset/GenericAssetHandler.h>
 #include <AzFramework/Asset/NetworkAssetNotification_private.h>
 #include <AzFramework/Application/Application.h>
@@ -927,6 +930,165 @@ namespace UnitTest
         EXPECT_FALSE(m_assetCatalog->DoesAssetIdMatchWildcardPattern(m_firstAssetId, ""));
     }
 
+    class FlatAssetRegistryTest
+        : public AllocatorsFixture
+    {
+    public:
+        void SetUp() override
+        {
+            AllocatorsFixture::SetUp();
+            m_registry = AZStd::make_unique<AzFramework::AssetRegistry>();
+
+            // Enough assets to spread them over multiple buckets in the lookup index.
+            for (int i = 0; i < 100; ++i)
+            {
+                AssetInfo assetInfo;
+                assetInfo.m_assetId = AssetId(AZ::Uuid::CreateRandom(), i % 3);
+                assetInfo.m_assetType = AZ::Uuid::CreateRandom();
+                assetInfo.m_relativePath = AZStd::string::format("Folder/Asset%i.txt", i);
+                assetInfo.m_sizeBytes = i * 1000;
+                m_registry->RegisterAsset(assetInfo.m_assetId, assetInfo);
+                m_assetIds.push_back(assetInfo.m_assetId);
+            }
+            for (int i = 1; i < 100; i += 2)
+            {
+                m_registry->RegisterAssetDependency(m_assetIds[i], ProductDependency(m_assetIds[i - 1], 1));
+                m_registry->RegisterAssetDependency(m_assetIds[i], ProductDependency(m_assetIds[0], 2));
+            }
+            m_legacyId = AssetId(AZ::Uuid::CreateRandom(), 0);
+            m_registry->RegisterLegacyAssetMapping(m_legacyId, m_assetIds[5]);
+        }
+
+        void TearDown() override
+        {
+            m_registry.reset();
+            m_assetIds.set_capacity(0);
+            AllocatorsFixture::TearDown();
+        }
+
+        AZStd::shared_ptr<AzFramework::FlatAssetRegistry> CreateFlatRegistry()
+        {
+            AZStd::vector<char> buffer;
+            EXPECT_TRUE(AzFramework::FlatAssetRegistry::Write(*m_registry, buffer));
+            auto flatRegistry = AZStd::make_shared<AzFramework::FlatAssetRegistry>();
+            EXPECT_TRUE(flatRegistry->Open(buffer.data(), buffer.size()));
+            return flatRegistry;
+        }
+
+        AZStd::unique_ptr<AzFramework::AssetRegistry> m_registry;
+        AZStd::vector<AssetId> m_assetIds;
+        AssetId m_legacyId;
+    };
+
+    TEST_F(FlatAssetRegistryTest, Write_RegistryWithAssets_AllEntriesFound)
+    {
+        AZStd::shared_ptr<AzFramework::FlatAssetRegistry> flatRegistry = CreateFlatRegistry();
+        ASSERT_TRUE(flatRegistry->IsOpen());
+        EXPECT_EQ(m_assetIds.size(), flatRegistry->GetAssetCount());
+
+        for (const AssetId& assetId : m_assetIds)
+        {
+            const AssetInfo& expected = m_registry->m_assetIdToInfo[assetId];
+            AssetInfo actual;
+            ASSERT_TRUE(flatRegistry->FindAssetInfo(assetId, actual));
+            EXPECT_EQ(expected.m_assetId, actual.m_assetId);
+            EXPECT_EQ(expected.m_assetType, actual.m_assetType);
+            EXPECT_EQ(expected.m_relativePath, actual.m_relativePath);
+            EXPECT_EQ(expected.m_sizeBytes, actual.m_sizeBytes);
+            EXPECT_EQ(expected.m_relativePath, flatRegistry->FindAssetPath(assetId));
+
+            AZStd::vector<ProductDependency> dependencies;
+            auto expectedDependencies = m_registry->m_assetDependencies.find(assetId);
+            if (expectedDependencies == m_registry->m_assetDependencies.end())
+            {
+                EXPECT_FALSE(flatRegistry->FindAssetDependencies(assetId, dependencies));
+                continue;
+            }
+            ASSERT_TRUE(flatRegistry->FindAssetDependencies(assetId, dependencies));
+            ASSERT_EQ(expectedDependencies->second.size(), dependencies.size());
+            for (size_t i = 0; i < dependencies.size(); ++i)
+            {
+                EXPECT_EQ(expectedDependencies->second[i].m_assetId, dependencies[i].m_assetId);
+                EXPECT_EQ(expectedDependencies->second[i].m_flags, dependencies[i].m_flags);
+            }
+        }
+
+        EXPECT_EQ(m_assetIds[5], flatRegistry->FindAssetIdByLegacyAssetId(m_legacyId));
+        EXPECT_FALSE(flatRegistry->ContainsAsset(AssetId(AZ::Uuid::CreateRandom(), 0)));
+        EXPECT_FALSE(flatRegistry->FindAssetIdByLegacyAssetId(m_assetIds[5]).IsValid());
+    }
+
+    TEST_F(FlatAssetRegistryTest, Open_CorruptedData_Fails)
+    {
+        AZStd::vector<char> buffer;
+        ASSERT_TRUE(AzFramework::FlatAssetRegistry::Write(*m_registry, buffer));
+
+        AzFramework::FlatAssetRegistry flatRegistry;
+        EXPECT_FALSE(flatRegistry.Open(buffer.data(), buffer.size() / 2));
+        EXPECT_FALSE(flatRegistry.IsOpen());
+
+        buffer[0] = ~buffer[0];
+        EXPECT_FALSE(flatRegistry.Open(buffer.data(), buffer.size()));
+        EXPECT_FALSE(flatRegistry.IsOpen());
+    }
+
+    TEST_F(FlatAssetRegistryTest, SetBaseRegistry_ChangesAfterSetting_OverrideBaseRegistry)
+    {
+        AzFramework::AssetRegistry layeredRegistry;
+        layeredRegistry.SetBaseRegistry(CreateFlatRegistry());
+
+        EXPECT_EQ(m_assetIds.size(), layeredRegistry.GetAssetCount());
+        EXPECT_EQ(m_assetIds[3], layeredRegistry.GetAssetIdByPath("folder\\asset3.txt"));
+        EXPECT_EQ(m_assetIds[5], layeredRegistry.GetAssetIdByLegacyAssetId(m_legacyId));
+
+        // Remove an asset from the base registry.
+        layeredRegistry.UnregisterAsset(m_assetIds[3]);
+        AssetInfo assetInfo;
+        EXPECT_FALSE(layeredRegistry.FindAssetInfo(m_assetIds[3], assetInfo));
+        EXPECT_FALSE(layeredRegistry.GetAssetIdByPath("Folder/Asset3.txt").IsValid());
+        AZStd::vector<ProductDependency> dependencies;
+        EXPECT_FALSE(layeredRegistry.FindAssetDependencies(m_assetIds[3], dependencies));
+
+        // Override an asset in the base registry.
+        ASSERT_TRUE(layeredRegistry.FindAssetInfo(m_assetIds[7], assetInfo));
+        assetInfo.m_sizeBytes = 42;
+        layeredRegistry.RegisterAsset(m_assetIds[7], assetInfo);
+        layeredRegistry.RegisterAssetDependency(m_assetIds[7], ProductDependency(m_assetIds[3], 0));
+        ASSERT_TRUE(layeredRegistry.FindAssetInfo(m_assetIds[7], assetInfo));
+        EXPECT_EQ(42, assetInfo.m_sizeBytes);
+        ASSERT_TRUE(layeredRegistry.FindAssetDependencies(m_assetIds[7], dependencies));
+        ASSERT_EQ(3, dependencies.size());
+        EXPECT_EQ(m_assetIds[3], dependencies[2].m_assetId);
+
+        // Add a new asset.
+        AssetId newAssetId(AZ::Uuid::CreateRandom(), 0);
+        assetInfo.m_assetId = newAssetId;
+        assetInfo.m_relativePath = "NewAsset.txt";
+        layeredRegistry.RegisterAsset(newAssetId, assetInfo);
+        EXPECT_EQ(newAssetId, layeredRegistry.GetAssetIdByPath("NewAsset.txt"));
+
+        layeredRegistry.UnregisterLegacyAssetMapping(m_legacyId);
+        EXPECT_FALSE(layeredRegistry.GetAssetIdByLegacyAssetId(m_legacyId).IsValid());
+
+        EXPECT_EQ(m_assetIds.size(), layeredRegistry.GetAssetCount());
+        size_t enumeratedCount = 0;
+        layeredRegistry.EnumerateAssets([&enumeratedCount](const AssetId&, const AssetInfo&)
+            {
+                ++enumeratedCount;
+            });
+        EXPECT_EQ(m_assetIds.size(), enumeratedCount);
+
+        // Merging the base registry has to result in the same registry.
+        layeredRegistry.MergeBaseRegistry();
+        EXPECT_EQ(nullptr, layeredRegistry.GetBaseRegistry());
+        EXPECT_EQ(m_assetIds.size(), layeredRegistry.m_assetIdToInfo.size());
+        EXPECT_FALSE(layeredRegistry.m_assetIdToInfo.contains(m_assetIds[3]));
+        EXPECT_EQ(42, layeredRegistry.m_assetIdToInfo[m_assetIds[7]].m_sizeBytes);
+        EXPECT_EQ(3, layeredRegistry.m_assetDependencies[m_assetIds[7]].size());
+        EXPECT_EQ(m_assetIds[9], layeredRegistry.GetAssetIdByPath("Folder/Asset9.txt"));
+        EXPECT_FALSE(layeredRegistry.GetAssetIdByPath("Folder/Asset3.txt").IsValid());
+    }
+
     class AssetType1
         : public AssetData
     {
@@ -7,7 +7,10 @@
  */
 
 #include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
 #include <AzCore/Name/NameDictionary.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzFramework/Visibility/OctreeSystemComponent.h>
 
 #if defined(HAVE_BENCHMARK)
@@ -107,6 +110,27 @@ namespace Benchmark
             }
         }
 
+        void GetEntryPointers(uint32_t entryCount, AZStd::vector<AzFramework::VisibilityEntry*>& entries)
+        {
+            entries.clear();
+            entries.reserve(entryCount);
+            for (uint32_t i = 0; i < entryCount; ++i)
+            {
+                entries.push_back(&m_dataArray[i]);
+            }
+        }
+
+        //! Moves the first entryCount entries back and forth along the x-axis, which is what typically happens to entries
+        //! that are updated every frame.
+        void MoveEntries(uint32_t entryCount, float distance)
+        {
+            const AZ::Vector3 offset(distance, 0.0f, 0.0f);
+            for (uint32_t i = 0; i < entryCount; ++i)
+            {
+                m_dataArray[i].m_boundingVolume.Translate((i % 2 == 0) ? offset : -offset);
+            }
+        }
+
         struct QueryData
         {
             AZ::Aabb aabb;
@@ -328,6 +352,133 @@ namespace Benchmark
         }
         RemoveEntries(EntryCount);
     }
+
+    BENCHMARK_F(BM_Octree, UpdateMovingEntries100000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 100000;
+        InsertEntries(EntryCount);
+        float distance = 10.0f;
+        for (auto _ : state)
+        {
+            MoveEntries(EntryCount, distance);
+            for (uint32_t i = 0; i < EntryCount; ++i)
+            {
+                m_visScene->InsertOrUpdateEntry(m_dataArray[i]);
+            }
+            distance = -distance;
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    BENCHMARK_F(BM_Octree, UpdateMovingEntriesBatched100000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 100000;
+        AZStd::vector<AzFramework::VisibilityEntry*> entries;
+        GetEntryPointers(EntryCount, entries);
+        m_visScene->InsertOrUpdateEntries(entries);
+        float distance = 10.0f;
+        for (auto _ : state)
+        {
+            MoveEntries(EntryCount, distance);
+            m_visScene->InsertOrUpdateEntries(entries);
+            distance = -distance;
+        }
+        m_visScene->RemoveEntries(entries);
+    }
+
+    BENCHMARK_F(BM_Octree, InsertDeleteBatched1000000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 1000000;
+        AZStd::vector<AzFramework::VisibilityEntry*> entries;
+        GetEntryPointers(EntryCount, entries);
+        for (auto _ : state)
+        {
+            m_visScene->InsertOrUpdateEntries(entries);
+            m_visScene->RemoveEntries(entries);
+        }
+    }
+
+    class BM_OctreeParallel
+        : public BM_Octree
+    {
+    public:
+        void SetUp(const ::benchmark::State& state) override
+        {
+            BM_Octree::SetUp(state);
+
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+
+            AZ::JobManagerDesc desc;
+            AZ::JobManagerThreadDesc threadDesc;
+            const AZ::u32 numWorkerThreads = AZStd::thread::hardware_concurrency();
+            for (AZ::u32 i = 0; i < numWorkerThreads; ++i)
+            {
+                desc.m_workerThreads.push_back(threadDesc);
+            }
+            m_jobManager = aznew AZ::JobManager(desc);
+            m_jobContext = aznew AZ::JobContext(*m_jobManager);
+            AZ::JobContext::SetGlobalContext(m_jobContext);
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            AZ::JobContext::SetGlobalContext(nullptr);
+            delete m_jobContext;
+            delete m_jobManager;
+
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+
+            BM_Octree::TearDown(state);
+        }
+
+        //! Large frustums that see a big part of the scene, so there is enough work to split across the workers.
+        AZ::Frustum CreateLargeFrustum(uint32_t index) const
+        {
+            const AZ::Vector3 origin = AZ::Vector3(4000.0f, -2000.0f, 4000.0f);
+            const AZ::Quaternion rotation = AZ::Quaternion::CreateRotationZ(static_cast<float>(index % 8) * 0.1f - 0.4f);
+            return AZ::Frustum(AZ::ViewFrustumAttributes(
+                AZ::Transform::CreateFromQuaternionAndTranslation(rotation, origin), 1.0f, 2.0f * atanf(0.5f), 1.0f, 10000.0f));
+        }
+
+        AZ::JobManager* m_jobManager = nullptr;
+        AZ::JobContext* m_jobContext = nullptr;
+    };
+
+    BENCHMARK_F(BM_OctreeParallel, EnumerateLargeFrustum1000000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 1000000;
+        InsertEntries(EntryCount);
+        uint32_t frame = 0;
+        for (auto _ : state)
+        {
+            AZStd::atomic<size_t> visibleCount{ 0 };
+            m_visScene->Enumerate(CreateLargeFrustum(frame++), [&visibleCount](const AzFramework::IVisibilityScene::NodeData& nodeData)
+            {
+                visibleCount.fetch_add(nodeData.m_entries.size(), AZStd::memory_order_relaxed);
+            });
+            benchmark::DoNotOptimize(visibleCount.load());
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    BENCHMARK_F(BM_OctreeParallel, EnumerateParallelLargeFrustum1000000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 1000000;
+        InsertEntries(EntryCount);
+        uint32_t frame = 0;
+        for (auto _ : state)
+        {
+            AZStd::atomic<size_t> visibleCount{ 0 };
+            m_visScene->EnumerateParallel(CreateLargeFrustum(frame++), [&visibleCount](const AzFramework::IVisibilityScene::NodeData& nodeData)
+            {
+                visibleCount.fetch_add(nodeData.m_entries.size(), AZStd::memory_order_relaxed);
+            });
+            benchmark::DoNotOptimize(visibleCount.load());
+        }
+        RemoveEntries(EntryCount);
+    }
 }
 
 #endif
@@ -11,6 +11,10 @@
 #include <AzCore/Console/Console.h>
 #include <AzCore/Name/NameDictionary.h>
 #include <AzCore/Console/IConsole.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/sort.h>
 #include <AzFramework/Visibility/OctreeSystemComponent.h>
 #include <random>
 
@@ -420,4 +424,192 @@ namespace UnitTest
         // Expect all the entries to be in the scene
         ValidateEntryCountEqualsExpectedCount(m_octreeScene, static_cast<uint32_t>(visEntries.size()));
     }
+
+    // Creates entries with random bounds within the -1,-1,-1 to 1,1,1 world volume of the test fixture.
+    // The index of each entry is stored in its user data, so results from different scenes can be compared.
+    void CreateRandomEntries(AZStd::vector<AzFramework::VisibilityEntry>& entries, size_t entryCount, unsigned int seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> position(-1.0f, 0.9f);
+        std::uniform_real_distribution<float> size(0.001f, 0.1f);
+
+        entries.resize(entryCount);
+        for (size_t i = 0; i < entryCount; ++i)
+        {
+            const AZ::Vector3 min(position(rng), position(rng), position(rng));
+            entries[i].m_boundingVolume = AZ::Aabb::CreateFromMinMax(min, min + AZ::Vector3(size(rng), size(rng), size(rng)));
+            entries[i].m_userData = reinterpret_cast<void*>(i);
+        }
+    }
+
+    template <typename BoundType>
+    AZStd::vector<size_t> GatherEntryIndices(const IVisibilityScene* visScene, const BoundType& bounds)
+    {
+        AZStd::vector<size_t> indices;
+        visScene->Enumerate(bounds, [&indices](const AzFramework::IVisibilityScene::NodeData& nodeData)
+        {
+            for (const VisibilityEntry* entry : nodeData.m_entries)
+            {
+                indices.push_back(reinterpret_cast<size_t>(entry->m_userData));
+            }
+        });
+        AZStd::sort(indices.begin(), indices.end());
+        return indices;
+    }
+
+    TEST_F(OctreeTests, InsertOrUpdateEntries_RandomMovingEntries_MatchesSingleEntryUpdates)
+    {
+        constexpr uint32_t EntryCount = 500;
+        IVisibilityScene* batchScene = m_octreeSystemComponent->CreateVisibilityScene(AZ::Name("OctreeUnitTestBatchScene"));
+
+        AZStd::vector<AzFramework::VisibilityEntry> singleEntries;
+        AZStd::vector<AzFramework::VisibilityEntry> batchEntries;
+        CreateRandomEntries(singleEntries, EntryCount, 1);
+        CreateRandomEntries(batchEntries, EntryCount, 1);
+
+        AZStd::vector<VisibilityEntry*> batch;
+        for (AzFramework::VisibilityEntry& entry : batchEntries)
+        {
+            batch.push_back(&entry);
+        }
+
+        for (AzFramework::VisibilityEntry& entry : singleEntries)
+        {
+            m_octreeScene->InsertOrUpdateEntry(entry);
+        }
+        batchScene->InsertOrUpdateEntries(batch);
+        ValidateEntryCountEqualsExpectedCount(batchScene, EntryCount);
+
+        const AZ::Aabb queries[] = {
+            AZ::Aabb::CreateFromMinMax(AZ::Vector3(-1.0f), AZ::Vector3(1.0f)),
+            AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.5f), AZ::Vector3(0.25f)),
+            AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.3f, -0.8f, -0.2f), AZ::Vector3(0.6f, 0.1f, 0.9f))
+        };
+
+        // Move the entries a few times, each time in a different random direction
+        for (unsigned int frame = 0; frame < 4; ++frame)
+        {
+            AZStd::vector<AzFramework::VisibilityEntry> movedEntries;
+            CreateRandomEntries(movedEntries, EntryCount, 100 + frame);
+            for (size_t i = 0; i < EntryCount; ++i)
+            {
+                singleEntries[i].m_boundingVolume = movedEntries[i].m_boundingVolume;
+                batchEntries[i].m_boundingVolume = movedEntries[i].m_boundingVolume;
+                m_octreeScene->InsertOrUpdateEntry(singleEntries[i]);
+            }
+            batchScene->InsertOrUpdateEntries(batch);
+            ValidateEntryCountEqualsExpectedCount(batchScene, EntryCount);
+
+            for (const AZ::Aabb& query : queries)
+            {
+                EXPECT_EQ(GatherEntryIndices(m_octreeScene, query), GatherEntryIndices(batchScene, query));
+            }
+        }
+
+        // Remove every other entry, then the rest
+        AZStd::vector<VisibilityEntry*> evenEntries;
+        AZStd::vector<VisibilityEntry*> oddEntries;
+        for (size_t i = 0; i < EntryCount; ++i)
+        {
+            ((i % 2 == 0) ? evenEntries : oddEntries).push_back(batch[i]);
+        }
+
+        batchScene->RemoveEntries(evenEntries);
+        ValidateEntryCountEqualsExpectedCount(batchScene, EntryCount / 2);
+        for (const VisibilityEntry* entry : evenEntries)
+        {
+            EXPECT_TRUE(entry->m_internalNode == nullptr);
+        }
+
+        batchScene->RemoveEntries(oddEntries);
+        ValidateEntryCountEqualsExpectedCount(batchScene, 0);
+
+        for (AzFramework::VisibilityEntry& entry : singleEntries)
+        {
+            m_octreeScene->RemoveEntry(entry);
+        }
+        m_octreeSystemComponent->DestroyVisibilityScene(batchScene);
+    }
+
+    class OctreeParallelTests
+        : public OctreeTests
+    {
+    public:
+        void SetUp() override
+        {
+            OctreeTests::SetUp();
+
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+
+            // Always use multiple workers so the parallel path is taken regardless of the machine
+            AZ::JobManagerDesc desc;
+            AZ::JobManagerThreadDesc threadDesc;
+            for (unsigned int i = 0; i < 4; ++i)
+            {
+                desc.m_workerThreads.push_back(threadDesc);
+            }
+            m_jobManager = aznew AZ::JobManager(desc);
+            m_jobContext = aznew AZ::JobContext(*m_jobManager);
+            AZ::JobContext::SetGlobalContext(m_jobContext);
+        }
+
+        void TearDown() override
+        {
+            AZ::JobContext::SetGlobalContext(nullptr);
+            delete m_jobContext;
+            delete m_jobManager;
+
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+
+            OctreeTests::TearDown();
+        }
+
+        AZ::JobManager* m_jobManager = nullptr;
+        AZ::JobContext* m_jobContext = nullptr;
+    };
+
+    TEST_F(OctreeParallelTests, EnumerateParallel_RandomEntries_MatchesEnumerate)
+    {
+        constexpr uint32_t EntryCount = 2000;
+        AZStd::vector<AzFramework::VisibilityEntry> entries;
+        CreateRandomEntries(entries, EntryCount, 2);
+        for (AzFramework::VisibilityEntry& entry : entries)
+        {
+            m_octreeScene->InsertOrUpdateEntry(entry);
+        }
+
+        const AZ::Transform frustumTransforms[] = {
+            AZ::Transform::CreateFromQuaternionAndTranslation(AZ::Quaternion::CreateIdentity(), AZ::Vector3(0.0f, -2.0f, 0.0f)),
+            AZ::Transform::CreateFromQuaternionAndTranslation(AZ::Quaternion::CreateRotationZ(0.5f), AZ::Vector3(0.5f, -1.5f, 0.2f)),
+            AZ::Transform::CreateFromQuaternionAndTranslation(AZ::Quaternion::CreateRotationX(-0.3f), AZ::Vector3(-0.2f, -1.2f, 0.5f))
+        };
+
+        for (const AZ::Transform& frustumTransform : frustumTransforms)
+        {
+            const AZ::Frustum frustum(AZ::ViewFrustumAttributes(frustumTransform, 1.0f, 2.0f * atanf(0.5f), 0.5f, 3.0f));
+
+            AZStd::mutex mutex;
+            AZStd::vector<size_t> parallelIndices;
+            m_octreeScene->EnumerateParallel(frustum, [&mutex, &parallelIndices](const AzFramework::IVisibilityScene::NodeData& nodeData)
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(mutex);
+                for (const VisibilityEntry* entry : nodeData.m_entries)
+                {
+                    parallelIndices.push_back(reinterpret_cast<size_t>(entry->m_userData));
+                }
+            });
+            AZStd::sort(parallelIndices.begin(), parallelIndices.end());
+
+            const AZStd::vector<size_t> serialIndices = GatherEntryIndices(m_octreeScene, frustum);
+            EXPECT_FALSE(serialIndices.empty());
+            EXPECT_EQ(serialIndices, parallelIndices);
+        }
+
+        for (AzFramework::VisibilityEntry& entry : entries)
+        {
+            m_octreeScene->RemoveEntry(entry);
+        }
+    }
 }
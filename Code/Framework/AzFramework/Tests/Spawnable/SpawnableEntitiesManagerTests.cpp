@@ -55,6 +55,35 @@ namespace UnitTest
         AZ::EntityId m_entityReference;
     };
 
+    // Test component that keeps entity references in containers for use in validating the paths recorded by the clone plan.
+    class ComponentWithEntityReferenceContainers : public AZ::Component
+    {
+    public:
+        AZ_COMPONENT(ComponentWithEntityReferenceContainers, "{6B1E0C4A-93D2-4F57-8A1E-2C5D7F3B9E60}");
+
+        void Activate() override
+        {
+        }
+
+        void Deactivate() override
+        {
+        }
+
+        static void Reflect(AZ::ReflectContext* reflection)
+        {
+            if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(reflection))
+            {
+                serializeContext->Class<ComponentWithEntityReferenceContainers, AZ::Component>()
+                    ->Field("EntityReferenceList", &ComponentWithEntityReferenceContainers::m_entityReferenceList)
+                    ->Field("EntityReferenceSet", &ComponentWithEntityReferenceContainers::m_entityReferenceSet)
+                    ;
+            }
+        }
+
+        AZStd::vector<AZ::EntityId> m_entityReferenceList;
+        AZStd::unordered_set<AZ::EntityId> m_entityReferenceSet;
+    };
+
     class SpawnableEntitiesManagerTest : public AllocatorsFixture
     {
     public:
@@ -66,6 +95,7 @@ namespace UnitTest
             AZ::ComponentApplication::Descriptor descriptor;
             m_application->Start(descriptor);
             m_application->RegisterComponentDescriptor(ComponentWithEntityReference::CreateDescriptor());
+            m_application->RegisterComponentDescriptor(ComponentWithEntityReferenceContainers::CreateDescriptor());
 
             // Without this, the user settings component would attempt to save on finalize/shutdown. Since the file is
             // shared across the whole engine, if multiple tests are run in parallel, the saving could cause a crash
@@ -892,6 +922,138 @@ namespace UnitTest
     }
 
 
+    //
+    // Clone plan
+    //
+
+    TEST_F(SpawnableEntitiesManagerTest, ClonePlan_ReplacedAfterEntitiesAreAccessedForModification)
+    {
+        static constexpr size_t NumEntities = 4;
+        FillSpawnable(NumEntities);
+        AZ::SerializeContext& serializeContext = *m_application->GetSerializeContext();
+
+        AZStd::shared_ptr<const AzFramework::SpawnableClonePlan> clonePlan = m_spawnable->GetClonePlan(serializeContext);
+        static_cast<const AzFramework::Spawnable*>(m_spawnable)->GetEntities();
+        EXPECT_EQ(clonePlan, m_spawnable->GetClonePlan(serializeContext));
+
+        // A plan that's still in use stays valid after it has been replaced.
+        FillSpawnable(NumEntities * 2);
+        AZStd::shared_ptr<const AzFramework::SpawnableClonePlan> newClonePlan = m_spawnable->GetClonePlan(serializeContext);
+        EXPECT_NE(clonePlan, newClonePlan);
+        EXPECT_EQ(NumEntities, clonePlan->GetEntityCount());
+        EXPECT_EQ(NumEntities * 2, newClonePlan->GetEntityCount());
+    }
+
+    TEST_F(SpawnableEntitiesManagerTest, ClonePlan_ComponentsChangedAfterPlanCreation_FallsBackAndReferencesAreMapped)
+    {
+        static constexpr size_t NumEntities = 4;
+        FillSpawnable(NumEntities);
+        CreateEntityReferences(EntityReferenceScheme::AllReferenceThemselves);
+        AzFramework::Spawnable::EntityList& entities = m_spawnable->GetEntities();
+        AZStd::shared_ptr<const AzFramework::SpawnableClonePlan> clonePlan = m_spawnable->GetClonePlan(*m_application->GetSerializeContext());
+        EXPECT_EQ(0, clonePlan->GetFallbackEntityCount());
+
+        // Changes through a reference that was obtained before the plan was created leave the plan out of date.
+        for (size_t i = 0; i < NumEntities; ++i)
+        {
+            auto component = entities[i]->CreateComponent<ComponentWithEntityReferenceContainers>();
+            component->m_entityReferenceList.push_back(entities[i]->GetId());
+        }
+
+        for (size_t i = 0; i < NumEntities; ++i)
+        {
+            AzFramework::SpawnableClonePlan::EntityIdMap idMap;
+            AZStd::unique_ptr<AZ::Entity> clone(clonePlan->CloneEntity(i, *entities[i], idMap));
+            ASSERT_NE(nullptr, clone);
+            EXPECT_NE(entities[i]->GetId(), clone->GetId());
+
+            auto component = clone->FindComponent<ComponentWithEntityReferenceContainers>();
+            ASSERT_NE(nullptr, component);
+            ASSERT_EQ(1, component->m_entityReferenceList.size());
+            EXPECT_EQ(clone->GetId(), component->m_entityReferenceList[0]);
+        }
+    }
+
+    TEST_F(SpawnableEntitiesManagerTest, ClonePlan_EntityReferencesInList_NoFallbackAndReferencesAreMapped)
+    {
+        static constexpr size_t NumEntities = 4;
+        FillSpawnable(NumEntities);
+        CreateEntityReferences(EntityReferenceScheme::AllReferenceNextCircular);
+        AzFramework::Spawnable::EntityList& entities = m_spawnable->GetEntities();
+        for (size_t i = 0; i < NumEntities; ++i)
+        {
+            auto component = entities[i]->CreateComponent<ComponentWithEntityReferenceContainers>();
+            component->m_entityReferenceList.push_back(entities[0]->GetId());
+            component->m_entityReferenceList.push_back(entities[i]->GetId());
+        }
+
+        AZStd::shared_ptr<const AzFramework::SpawnableClonePlan> clonePlan = m_spawnable->GetClonePlan(*m_application->GetSerializeContext());
+        EXPECT_EQ(NumEntities, clonePlan->GetEntityCount());
+        EXPECT_EQ(0, clonePlan->GetFallbackEntityCount());
+
+        auto callback = [this](AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstEntityContainerView entities)
+        {
+            ValidateEntityReferences(EntityReferenceScheme::AllReferenceNextCircular, NumEntities, entities);
+
+            const AZ::Entity* firstEntity = *entities.begin();
+            for (const AZ::Entity* entity : entities)
+            {
+                auto component = entity->FindComponent<ComponentWithEntityReferenceContainers>();
+                ASSERT_NE(nullptr, component);
+                ASSERT_EQ(2, component->m_entityReferenceList.size());
+                EXPECT_EQ(firstEntity->GetId(), component->m_entityReferenceList[0]);
+                EXPECT_EQ(entity->GetId(), component->m_entityReferenceList[1]);
+            }
+        };
+        AzFramework::SpawnAllEntitiesOptionalArgs optionalArgs;
+        optionalArgs.m_completionCallback = AZStd::move(callback);
+        m_manager->SpawnAllEntities(*m_ticket, AZStd::move(optionalArgs));
+        m_manager->ProcessQueue(AzFramework::SpawnableEntitiesManager::CommandQueuePriority::Regular);
+    }
+
+    TEST_F(SpawnableEntitiesManagerTest, ClonePlan_EntityReferencesInSet_FallsBackAndReferencesAreMapped)
+    {
+        static constexpr size_t NumEntities = 4;
+        FillSpawnable(NumEntities);
+        AzFramework::Spawnable::EntityList& entities = m_spawnable->GetEntities();
+        for (size_t i = 0; i < NumEntities; ++i)
+        {
+            auto component = entities[i]->CreateComponent<ComponentWithEntityReferenceContainers>();
+            if (i % 2 == 0)
+            {
+                component->m_entityReferenceSet.insert(entities[i]->GetId());
+            }
+        }
+
+        AZStd::shared_ptr<const AzFramework::SpawnableClonePlan> clonePlan = m_spawnable->GetClonePlan(*m_application->GetSerializeContext());
+        EXPECT_EQ(NumEntities, clonePlan->GetEntityCount());
+        EXPECT_EQ(NumEntities / 2, clonePlan->GetFallbackEntityCount());
+
+        auto callback = [](AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstEntityContainerView entities)
+        {
+            size_t index = 0;
+            for (const AZ::Entity* entity : entities)
+            {
+                auto component = entity->FindComponent<ComponentWithEntityReferenceContainers>();
+                ASSERT_NE(nullptr, component);
+                if (index % 2 == 0)
+                {
+                    ASSERT_EQ(1, component->m_entityReferenceSet.size());
+                    EXPECT_EQ(entity->GetId(), *component->m_entityReferenceSet.begin());
+                }
+                else
+                {
+                    EXPECT_TRUE(component->m_entityReferenceSet.empty());
+                }
+                ++index;
+            }
+        };
+        AzFramework::SpawnAllEntitiesOptionalArgs optionalArgs;
+        optionalArgs.m_completionCallback = AZStd::move(callback);
+        m_manager->SpawnAllEntities(*m_ticket, AZStd::move(optionalArgs));
+        m_manager->ProcessQueue(AzFramework::SpawnableEntitiesManager::CommandQueuePriority::Regular);
+    }
+
     //
     // Misc. - Priority tests
     //
@@ -36,6 +36,10 @@ namespace AzNetworking
         uint64_t m_sendBytesEncryptionInflation = 0;
         //! Returns the total number of packets that had to be resent on this network interface due to packet loss.
         uint64_t m_resentPackets = 0;
+        //! Returns the total number of system calls made to send packets on this socket.
+        uint64_t m_sendSystemCalls = 0;
+        //! Returns the total number of packets sent on this socket as segments of a UDP segmentation offload send.
+        uint64_t m_sendSegmentedPackets = 0;
         //! Returns the total number of milliseconds spent processing received data on this network interface.
         AZ::TimeMs m_recvTimeMs = AZ::TimeMs{ 0 };
         //! Returns the total number of packets received on this socket.
@@ -44,6 +48,8 @@ namespace AzNetworking
         uint64_t m_recvBytes = 0;
         //! Returns the total number of bytes received on this socket before compression.
         uint64_t m_recvBytesUncompressed = 0;
+        //! Returns the total number of system calls made to receive packets on this socket.
+        uint64_t m_recvSystemCalls = 0;
         //! Returns the total number of packets that were discarded due to timeslice budgets.
         uint64_t m_discardedPackets = 0;
     };
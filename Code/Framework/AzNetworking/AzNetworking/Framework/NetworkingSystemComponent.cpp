@@ -194,10 +194,13 @@ namespace AzNetworking
             AZLOG_INFO(" - Total sent compressed packets without benefit: %llu", aznumeric_cast<AZ::u64>(metrics.m_sendCompressedPacketsNoGain));
             AZLOG_INFO(" - Total gain from packet compression: %lld", aznumeric_cast<AZ::s64>(metrics.m_sendBytesCompressedDelta));
             AZLOG_INFO(" - Total packets resent: %llu", aznumeric_cast<AZ::u64>(metrics.m_resentPackets));
+            AZLOG_INFO(" - Total send system calls: %llu", aznumeric_cast<AZ::u64>(metrics.m_sendSystemCalls));
+            AZLOG_INFO(" - Total packets sent with segmentation offload: %llu", aznumeric_cast<AZ::u64>(metrics.m_sendSegmentedPackets));
             AZLOG_INFO(" - Total receive time in milliseconds: %lld", aznumeric_cast<AZ::s64>(metrics.m_recvTimeMs));
             AZLOG_INFO(" - Total received packets: %llu", aznumeric_cast<AZ::u64>(metrics.m_recvPackets));
             AZLOG_INFO(" - Total received bytes after compression: %llu", aznumeric_cast<AZ::u64>(metrics.m_recvBytes));
             AZLOG_INFO(" - Total received bytes before compression: %llu", aznumeric_cast<AZ::u64>(metrics.m_recvBytesUncompressed));
+            AZLOG_INFO(" - Total receive system calls: %llu", aznumeric_cast<AZ::u64>(metrics.m_recvSystemCalls));
             AZLOG_INFO(" - Total packets discarded due to load: %llu", aznumeric_cast<AZ::u64>(metrics.m_discardedPackets));
         }
     }
@@ -49,6 +49,12 @@ namespace AzNetworking
         //! @param serializer ISerializer instance to use for serialization
         //! @return boolean true for success, false for serialization failure
         virtual bool Serialize(ISerializer& serializer) = 0;
+
+        //! Returns true if the payload should be written with NetworkBitInputSerializer rather than NetworkInputSerializer.
+        //! Bit packed payloads write integral values using only the bits needed for their declared ranges, at some extra cost
+        //! to serialize. The choice is recorded in the PacketFlag::BitPacked header flag, so receivers need no configuration.
+        //! @return boolean true if the payload should be bit packed
+        virtual bool IsBitPacked() const { return false; }
     };
 }
 
@@ -21,6 +21,14 @@ namespace AzNetworking
         WriteToObject
     };
 
+    //! Identifies the concrete serializers that generated code can call through non-virtual interfaces.
+    enum class SerializerType
+    {
+        Other,
+        NetworkInput,
+        NetworkOutput
+    };
+
     //! @class ISerializer
     //! @brief Interface class for all serializers to derive from.
     //!
@@ -54,6 +62,10 @@ namespace AzNetworking
         //! @return boolean true if the serializer is writing to objects that it visits
         virtual SerializerMode GetSerializerMode() const = 0;
 
+        //! Returns the concrete type of the serializer, allowing generated code to select a statically dispatched path once per object.
+        //! @return the concrete type of the serializer, SerializerType::Other for anything but the network serializers
+        virtual SerializerType GetSerializerType() const;
+
         //! Serialize a boolean.
         //! @param value    boolean input value to serialize
         //! @param name     string name of the value being serialized
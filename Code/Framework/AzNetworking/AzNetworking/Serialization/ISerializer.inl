@@ -97,6 +97,11 @@ namespace AzNetworking
         return m_serializerValid;
     }
 
+    inline SerializerType ISerializer::GetSerializerType() const
+    {
+        return SerializerType::Other;
+    }
+
     inline void ISerializer::Invalidate()
     {
         m_serializerValid = false;
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/Serialization/NetworkBitInputSerializer.h>
+#include <string.h>
+
+namespace AzNetworking
+{
+    NetworkBitInputSerializer::NetworkBitInputSerializer(uint8_t* buffer, uint32_t bufferCapacity)
+        : m_bitPosition(0)
+        , m_bufferCapacity(bufferCapacity)
+        , m_buffer(buffer)
+    {
+        ;
+    }
+
+    SerializerMode NetworkBitInputSerializer::GetSerializerMode() const
+    {
+        return SerializerMode::ReadFromObject;
+    }
+
+    bool NetworkBitInputSerializer::Serialize(bool& value, [[maybe_unused]] const char* name)
+    {
+        return WriteBits(value ? 1 : 0, 1);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(char& value, [[maybe_unused]] const char* name, char minValue, char maxValue)
+    {
+        return SerializeBoundedValue<char>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(int8_t& value, [[maybe_unused]] const char* name, int8_t minValue, int8_t maxValue)
+    {
+        return SerializeBoundedValue<int8_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(int16_t& value, [[maybe_unused]] const char* name, int16_t minValue, int16_t maxValue)
+    {
+        return SerializeBoundedValue<int16_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(int32_t& value, [[maybe_unused]] const char* name, int32_t minValue, int32_t maxValue)
+    {
+        return SerializeBoundedValue<int32_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(int64_t& value, [[maybe_unused]] const char* name, int64_t minValue, int64_t maxValue)
+    {
+        return SerializeBoundedValue<int64_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(uint8_t& value, [[maybe_unused]] const char* name, uint8_t minValue, uint8_t maxValue)
+    {
+        return SerializeBoundedValue<uint8_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(uint16_t& value, [[maybe_unused]] const char* name, uint16_t minValue, uint16_t maxValue)
+    {
+        return SerializeBoundedValue<uint16_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(uint32_t& value, [[maybe_unused]] const char* name, uint32_t minValue, uint32_t maxValue)
+    {
+        return SerializeBoundedValue<uint32_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(uint64_t& value, [[maybe_unused]] const char* name, uint64_t minValue, uint64_t maxValue)
+    {
+        return SerializeBoundedValue<uint64_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(float& value, [[maybe_unused]] const char* name, [[maybe_unused]] float minValue, [[maybe_unused]] float maxValue)
+    {
+        uint32_t bits = 0;
+        memcpy(&bits, &value, sizeof(float));
+        return WriteBits(bits, 32);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(double& value, [[maybe_unused]] const char* name, [[maybe_unused]] double minValue, [[maybe_unused]] double maxValue)
+    {
+        uint64_t bits = 0;
+        memcpy(&bits, &value, sizeof(double));
+        return WriteBits(bits, 64);
+    }
+
+    bool NetworkBitInputSerializer::SerializeBytes(uint8_t* buffer, uint32_t bufferCapacity, [[maybe_unused]] bool isString, uint32_t& outSize, [[maybe_unused]] const char* name)
+    {
+        return SerializeBoundedValue<uint32_t>(0, bufferCapacity, outSize) && SerializeBytes(reinterpret_cast<uint8_t*>(buffer), outSize);
+    }
+
+    bool NetworkBitInputSerializer::BeginObject([[maybe_unused]] const char* name, [[maybe_unused]] const char* typeName)
+    {
+        return true;
+    }
+
+    bool NetworkBitInputSerializer::EndObject([[maybe_unused]] const char* name, [[maybe_unused]] const char* typeName)
+    {
+        return true;
+    }
+
+    const uint8_t* NetworkBitInputSerializer::GetBuffer() const
+    {
+        return m_buffer;
+    }
+
+    uint32_t NetworkBitInputSerializer::GetCapacity() const
+    {
+        return m_bufferCapacity;
+    }
+
+    uint32_t NetworkBitInputSerializer::GetSize() const
+    {
+        return static_cast<uint32_t>((m_bitPosition + 7) >> 3);
+    }
+
+    template <typename ORIGINAL_TYPE>
+    bool NetworkBitInputSerializer::SerializeBoundedValue(ORIGINAL_TYPE minValue, ORIGINAL_TYPE maxValue, ORIGINAL_TYPE inputValue)
+    {
+        m_serializerValid &= (inputValue >= minValue);
+        m_serializerValid &= (inputValue <= maxValue);
+        const uint32_t bitCount = GetBoundedValueBitCount(GetBoundedValueOffset(maxValue, minValue));
+        return WriteBits(GetBoundedValueOffset(inputValue, minValue), bitCount);
+    }
+
+    bool NetworkBitInputSerializer::SerializeBytes(const uint8_t* data, uint32_t count)
+    {
+        if ((m_bitPosition & 7) == 0)
+        {
+            // Byte aligned, the bytes can be copied directly once we know they fit
+            if (!m_serializerValid || (m_bitPosition + static_cast<uint64_t>(count) * 8 > static_cast<uint64_t>(m_bufferCapacity) * 8))
+            {
+                m_serializerValid = false;
+                return false;
+            }
+            memcpy(m_buffer + (m_bitPosition >> 3), data, count);
+            m_bitPosition += static_cast<uint64_t>(count) * 8;
+            return true;
+        }
+
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            if (!WriteBits(data[i], 8))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+}
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzNetworking/Serialization/ISerializer.h>
+#include <AzNetworking/Serialization/NetworkSerializerTraits.h>
+
+namespace AzNetworking
+{
+    //! @class NetworkBitInputSerializer
+    //! @brief Input serializer for writing an object model into a bit packed bytestream.
+    //!
+    //! Unlike NetworkInputSerializer, which rounds every value up to a whole number of bytes, this writes integral values with
+    //! the minimum number of bits needed for the range declared by the caller, booleans as a single bit, and nothing is
+    //! aligned to a byte boundary. Floating point values are written with their full 32 or 64 bits, use QuantizedValues to
+    //! trade precision for bandwidth. The output can only be read by NetworkBitOutputSerializer.
+    class NetworkBitInputSerializer final
+        : public ISerializer
+    {
+    public:
+
+        //! Constructor.
+        //! @param buffer         input buffer to write to
+        //! @param bufferCapacity capacity of the buffer in bytes
+        NetworkBitInputSerializer(uint8_t* buffer, uint32_t bufferCapacity);
+
+        //! Returns the number of bits written, GetSize returns this rounded up to whole bytes.
+        //! @return number of bits written
+        uint64_t GetBitSize() const;
+
+        // ISerializer interfaces
+        SerializerMode GetSerializerMode() const override;
+        bool Serialize(    bool& value, const char* name) override;
+        bool Serialize(    char& value, const char* name,     char minValue,     char maxValue) override;
+        bool Serialize(  int8_t& value, const char* name,   int8_t minValue,   int8_t maxValue) override;
+        bool Serialize( int16_t& value, const char* name,  int16_t minValue,  int16_t maxValue) override;
+        bool Serialize( int32_t& value, const char* name,  int32_t minValue,  int32_t maxValue) override;
+        bool Serialize( int64_t& value, const char* name,  int64_t minValue,  int64_t maxValue) override;
+        bool Serialize( uint8_t& value, const char* name,  uint8_t minValue,  uint8_t maxValue) override;
+        bool Serialize(uint16_t& value, const char* name, uint16_t minValue, uint16_t maxValue) override;
+        bool Serialize(uint32_t& value, const char* name, uint32_t minValue, uint32_t maxValue) override;
+        bool Serialize(uint64_t& value, const char* name, uint64_t minValue, uint64_t maxValue) override;
+        bool Serialize(   float& value, const char* name,    float minValue,    float maxValue) override;
+        bool Serialize(  double& value, const char* name,   double minValue,   double maxValue) override;
+        bool SerializeBytes(uint8_t* buffer, uint32_t bufferCapacity, bool isString, uint32_t& outSize, const char* name) override;
+        bool BeginObject(const char *name, const char* typeName) override;
+        bool EndObject(const char *name, const char* typeName) override;
+
+        const uint8_t* GetBuffer() const override;
+        uint32_t GetCapacity() const override;
+        uint32_t GetSize() const override;
+        void ClearTrackedChangesFlag() override {}
+        bool GetTrackedChangesFlag() const override { return false; }
+        // ISerializer interfaces
+
+    private:
+
+        //! Private copy operator, do not allow copying instances
+        NetworkBitInputSerializer& operator=(const NetworkBitInputSerializer&) = delete;
+
+        template <typename ORIGINAL_TYPE>
+        bool SerializeBoundedValue(ORIGINAL_TYPE minValue, ORIGINAL_TYPE maxValue, ORIGINAL_TYPE inputValue);
+
+        bool SerializeBytes(const uint8_t* data, uint32_t count);
+
+        //! Appends the low bitCount bits of value to the stream, most significant bit first.
+        //! @param value    the value to write
+        //! @param bitCount number of bits to write, at most 64
+        //! @return boolean true on success, false if there was insufficient space
+        bool WriteBits(uint64_t value, uint32_t bitCount);
+
+        uint64_t       m_bitPosition = 0;
+        const uint32_t m_bufferCapacity;
+        uint8_t*       m_buffer;
+    };
+}
+
+#include <AzNetworking/Serialization/NetworkBitInputSerializer.inl>
@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/algorithm.h>
+
+namespace AzNetworking
+{
+    inline uint64_t NetworkBitInputSerializer::GetBitSize() const
+    {
+        return m_bitPosition;
+    }
+
+    inline bool NetworkBitInputSerializer::WriteBits(uint64_t value, uint32_t bitCount)
+    {
+        if (!m_serializerValid || (m_bitPosition + bitCount > static_cast<uint64_t>(m_bufferCapacity) * 8))
+        {
+            // Keep the failed boolean so we can verify serialization success
+            m_serializerValid = false;
+            return false;
+        }
+
+        while (bitCount > 0)
+        {
+            const uint64_t byteIndex = m_bitPosition >> 3;
+            const uint32_t freeBits = 8 - static_cast<uint32_t>(m_bitPosition & 7);
+            const uint32_t writeBits = AZStd::min(freeBits, bitCount);
+            const uint32_t chunk = static_cast<uint32_t>(value >> (bitCount - writeBits)) & ((1u << writeBits) - 1);
+
+            // Bytes are cleared as the stream reaches them, so the caller never needs to zero the buffer
+            const uint8_t previous = (freeBits == 8) ? 0 : m_buffer[byteIndex];
+            m_buffer[byteIndex] = static_cast<uint8_t>(previous | (chunk << (freeBits - writeBits)));
+
+            m_bitPosition += writeBits;
+            bitCount -= writeBits;
+        }
+        return true;
+    }
+}
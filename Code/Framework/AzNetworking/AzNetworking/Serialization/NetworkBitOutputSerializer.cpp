@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/Serialization/NetworkBitOutputSerializer.h>
+#include <string.h>
+
+namespace AzNetworking
+{
+    NetworkBitOutputSerializer::NetworkBitOutputSerializer(const uint8_t* buffer, uint32_t bufferCapacity)
+        : m_bitPosition(0)
+        , m_bufferCapacity(bufferCapacity)
+        , m_buffer(buffer)
+    {
+        ;
+    }
+
+    SerializerMode NetworkBitOutputSerializer::GetSerializerMode() const
+    {
+        return SerializerMode::WriteToObject;
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(bool& value, [[maybe_unused]] const char* name)
+    {
+        uint64_t bits = 0;
+        if (ReadBits(bits, 1))
+        {
+            value = (bits != 0);
+        }
+        return m_serializerValid;
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(char& value, [[maybe_unused]] const char* name, char minValue, char maxValue)
+    {
+        return SerializeBoundedValue<char>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(int8_t& value, [[maybe_unused]] const char* name, int8_t minValue, int8_t maxValue)
+    {
+        return SerializeBoundedValue<int8_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(int16_t& value, [[maybe_unused]] const char* name, int16_t minValue, int16_t maxValue)
+    {
+        return SerializeBoundedValue<int16_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(int32_t& value, [[maybe_unused]] const char* name, int32_t minValue, int32_t maxValue)
+    {
+        return SerializeBoundedValue<int32_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(int64_t& value, [[maybe_unused]] const char* name, int64_t minValue, int64_t maxValue)
+    {
+        return SerializeBoundedValue<int64_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(uint8_t& value, [[maybe_unused]] const char* name, uint8_t minValue, uint8_t maxValue)
+    {
+        return SerializeBoundedValue<uint8_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(uint16_t& value, [[maybe_unused]] const char* name, uint16_t minValue, uint16_t maxValue)
+    {
+        return SerializeBoundedValue<uint16_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(uint32_t& value, [[maybe_unused]] const char* name, uint32_t minValue, uint32_t maxValue)
+    {
+        return SerializeBoundedValue<uint32_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(uint64_t& value, [[maybe_unused]] const char* name, uint64_t minValue, uint64_t maxValue)
+    {
+        return SerializeBoundedValue<uint64_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(float& value, [[maybe_unused]] const char* name, [[maybe_unused]] float minValue, [[maybe_unused]] float maxValue)
+    {
+        uint64_t bits = 0;
+        if (ReadBits(bits, 32))
+        {
+            const uint32_t floatBits = static_cast<uint32_t>(bits);
+            memcpy(&value, &floatBits, sizeof(float));
+        }
+        return m_serializerValid;
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(double& value, [[maybe_unused]] const char* name, [[maybe_unused]] double minValue, [[maybe_unused]] double maxValue)
+    {
+        uint64_t bits = 0;
+        if (ReadBits(bits, 64))
+        {
+            memcpy(&value, &bits, sizeof(double));
+        }
+        return m_serializerValid;
+    }
+
+    bool NetworkBitOutputSerializer::SerializeBytes(uint8_t* buffer, uint32_t bufferCapacity, [[maybe_unused]] bool isString, uint32_t& outSize, [[maybe_unused]] const char* name)
+    {
+        return SerializeBoundedValue<uint32_t>(0, bufferCapacity, outSize) && SerializeBytes(reinterpret_cast<uint8_t*>(buffer), outSize);
+    }
+
+    bool NetworkBitOutputSerializer::BeginObject([[maybe_unused]] const char* name, [[maybe_unused]] const char* typeName)
+    {
+        return true;
+    }
+
+    bool NetworkBitOutputSerializer::EndObject([[maybe_unused]] const char* name, [[maybe_unused]] const char* typeName)
+    {
+        return true;
+    }
+
+    const uint8_t* NetworkBitOutputSerializer::GetBuffer() const
+    {
+        return m_buffer;
+    }
+
+    uint32_t NetworkBitOutputSerializer::GetCapacity() const
+    {
+        return m_bufferCapacity;
+    }
+
+    uint32_t NetworkBitOutputSerializer::GetSize() const
+    {
+        return static_cast<uint32_t>((m_bitPosition + 7) >> 3);
+    }
+
+    template <typename ORIGINAL_TYPE>
+    bool NetworkBitOutputSerializer::SerializeBoundedValue(ORIGINAL_TYPE minValue, ORIGINAL_TYPE maxValue, ORIGINAL_TYPE& outValue)
+    {
+        const uint64_t range = GetBoundedValueOffset(maxValue, minValue);
+        uint64_t offset = 0;
+        if (ReadBits(offset, GetBoundedValueBitCount(range)))
+        {
+            m_serializerValid &= (offset <= range);
+            outValue = m_serializerValid ? ApplyBoundedValueOffset(offset, minValue) : outValue;
+        }
+        return m_serializerValid;
+    }
+
+    bool NetworkBitOutputSerializer::SerializeBytes(uint8_t* data, uint32_t count)
+    {
+        if ((m_bitPosition & 7) == 0)
+        {
+            // Byte aligned, the bytes can be copied directly once we know they are available
+            if (!m_serializerValid || (m_bitPosition + static_cast<uint64_t>(count) * 8 > static_cast<uint64_t>(m_bufferCapacity) * 8))
+            {
+                m_serializerValid = false;
+                return false;
+            }
+            memcpy(data, m_buffer + (m_bitPosition >> 3), count);
+            m_bitPosition += static_cast<uint64_t>(count) * 8;
+            return true;
+        }
+
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            uint64_t bits = 0;
+            if (!ReadBits(bits, 8))
+            {
+                return false;
+            }
+            data[i] = static_cast<uint8_t>(bits);
+        }
+        return true;
+    }
+}
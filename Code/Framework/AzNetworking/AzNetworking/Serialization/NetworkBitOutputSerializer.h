@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzNetworking/Serialization/ISerializer.h>
+#include <AzNetworking/Serialization/NetworkSerializerTraits.h>
+
+namespace AzNetworking
+{
+    //! @class NetworkBitOutputSerializer
+    //! @brief Output serializer for inflating and writing out a bit packed bytestream into an object model.
+    //!
+    //! Reads the format written by NetworkBitInputSerializer. Every value must be serialized with the same bounds that were used
+    //! to write it, since the bounds determine how many bits the value occupies.
+    class NetworkBitOutputSerializer final
+        : public ISerializer
+    {
+    public:
+
+        //! Constructor.
+        //! @param buffer         output buffer to read from
+        //! @param bufferCapacity capacity of the buffer in bytes
+        NetworkBitOutputSerializer(const uint8_t* buffer, uint32_t bufferCapacity);
+
+        //! Returns the number of bits consumed by serialization, GetSize returns this rounded up to whole bytes.
+        //! @return number of bits consumed by serialization
+        uint64_t GetBitSize() const;
+
+        // ISerializer interfaces
+        SerializerMode GetSerializerMode() const override;
+        bool Serialize(    bool& value, const char* name) override;
+        bool Serialize(    char& value, const char* name,     char minValue,     char maxValue) override;
+        bool Serialize(  int8_t& value, const char* name,   int8_t minValue,   int8_t maxValue) override;
+        bool Serialize( int16_t& value, const char* name,  int16_t minValue,  int16_t maxValue) override;
+        bool Serialize( int32_t& value, const char* name,  int32_t minValue,  int32_t maxValue) override;
+        bool Serialize( int64_t& value, const char* name,  int64_t minValue,  int64_t maxValue) override;
+        bool Serialize( uint8_t& value, const char* name,  uint8_t minValue,  uint8_t maxValue) override;
+        bool Serialize(uint16_t& value, const char* name, uint16_t minValue, uint16_t maxValue) override;
+        bool Serialize(uint32_t& value, const char* name, uint32_t minValue, uint32_t maxValue) override;
+        bool Serialize(uint64_t& value, const char* name, uint64_t minValue, uint64_t maxValue) override;
+        bool Serialize(   float& value, const char* name,    float minValue,    float maxValue) override;
+        bool Serialize(  double& value, const char* name,   double minValue,   double maxValue) override;
+        bool SerializeBytes(uint8_t* buffer, uint32_t bufferCapacity, bool isString, uint32_t& outSize, const char* name) override;
+        bool BeginObject(const char *name, const char* typeName) override;
+        bool EndObject(const char *name, const char* typeName) override;
+
+        const uint8_t* GetBuffer() const override;
+        uint32_t GetCapacity() const override;
+        uint32_t GetSize() const override;
+        void ClearTrackedChangesFlag() override {}
+        bool GetTrackedChangesFlag() const override { return false; }
+        // ISerializer interfaces
+
+    private:
+
+        //! Private copy operator, do not allow copying instances.
+        NetworkBitOutputSerializer& operator=(const NetworkBitOutputSerializer&) = delete;
+
+        template <typename ORIGINAL_TYPE>
+        bool SerializeBoundedValue(ORIGINAL_TYPE minValue, ORIGINAL_TYPE maxValue, ORIGINAL_TYPE& outValue);
+
+        bool SerializeBytes(uint8_t* data, uint32_t count);
+
+        //! Reads the next bitCount bits from the stream, most significant bit first.
+        //! @param outValue receives the bits read, zero extended
+        //! @param bitCount number of bits to read, at most 64
+        //! @return boolean true on success, false if there was insufficient data
+        bool ReadBits(uint64_t& outValue, uint32_t bitCount);
+
+        uint64_t       m_bitPosition = 0;
+        const uint32_t m_bufferCapacity;
+        const uint8_t* m_buffer;
+    };
+}
+
+#include <AzNetworking/Serialization/NetworkBitOutputSerializer.inl>
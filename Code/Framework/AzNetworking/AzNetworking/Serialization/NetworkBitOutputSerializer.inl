@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/algorithm.h>
+
+namespace AzNetworking
+{
+    inline uint64_t NetworkBitOutputSerializer::GetBitSize() const
+    {
+        return m_bitPosition;
+    }
+
+    inline bool NetworkBitOutputSerializer::ReadBits(uint64_t& outValue, uint32_t bitCount)
+    {
+        if (!m_serializerValid || (m_bitPosition + bitCount > static_cast<uint64_t>(m_bufferCapacity) * 8))
+        {
+            // Keep the failed boolean so we can verify serialization success
+            m_serializerValid = false;
+            return false;
+        }
+
+        uint64_t result = 0;
+        while (bitCount > 0)
+        {
+            const uint64_t byteIndex = m_bitPosition >> 3;
+            const uint32_t availableBits = 8 - static_cast<uint32_t>(m_bitPosition & 7);
+            const uint32_t readBits = AZStd::min(availableBits, bitCount);
+            const uint32_t chunk = (static_cast<uint32_t>(m_buffer[byteIndex]) >> (availableBits - readBits)) & ((1u << readBits) - 1);
+
+            result = (result << readBits) | chunk;
+
+            m_bitPosition += readBits;
+            bitCount -= readBits;
+        }
+        outValue = result;
+        return true;
+    }
+}
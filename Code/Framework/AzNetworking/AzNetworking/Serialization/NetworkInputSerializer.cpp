@@ -29,8 +29,7 @@ namespace AzNetworking
 
     bool NetworkInputSerializer::Serialize(bool& value, [[maybe_unused]] const char* name)
     {
-        uint8_t serializeValue = (value) ? 1 : 0;
-        return SerializeBytes((const uint8_t*)&serializeValue, sizeof(uint8_t));
+        return SerializeValue(value);
     }
 
     bool NetworkInputSerializer::Serialize(char& value, [[maybe_unused]] const char* name, char minValue, char maxValue)
@@ -80,16 +79,12 @@ namespace AzNetworking
 
     bool NetworkInputSerializer::Serialize(float& value, [[maybe_unused]] const char* name, [[maybe_unused]] float minValue, [[maybe_unused]] float maxValue)
     {
-        uint32_t hostOrder = *reinterpret_cast<uint32_t*>(&value);
-        uint32_t networkOrder = ntohl(hostOrder);
-        return SerializeBytes((const uint8_t*)&networkOrder, sizeof(float));
+        return SerializeValue(value);
     }
 
     bool NetworkInputSerializer::Serialize(double& value, [[maybe_unused]] const char* name, [[maybe_unused]] double minValue, [[maybe_unused]] double maxValue)
     {
-        uint64_t hostOrder = *reinterpret_cast<uint64_t*>(&value);
-        uint64_t networkOrder = ntohll(hostOrder);
-        return SerializeBytes((const uint8_t*)&networkOrder, sizeof(double));
+        return SerializeValue(value);
     }
 
     bool NetworkInputSerializer::SerializeBytes(uint8_t* buffer, uint32_t bufferCapacity, [[maybe_unused]] bool isString, uint32_t& outSize, [[maybe_unused]] const char* name)
@@ -172,19 +167,13 @@ namespace AzNetworking
 
     bool NetworkInputSerializer::SerializeBytes(const uint8_t* data, uint32_t count)
     {
-        const uint32_t currSize = m_bufferSize;
-        const uint32_t nextSize = m_bufferSize + count;
-
-        if (!m_serializerValid || (nextSize > m_bufferCapacity))
+        uint8_t* writeBuffer = ReserveBytes(count);
+        if (writeBuffer == nullptr)
         {
-            // Keep the failed boolean so we can verify serialization success
-            m_serializerValid = false;
             return false;
         }
 
-        uint8_t* writeBuffer = (uint8_t*)(m_buffer + currSize);
         memcpy(writeBuffer, data, count);
-        m_bufferSize += count;
         return true;
     }
 }
@@ -8,10 +8,108 @@
 
 #pragma once
 
+#include <AzCore/std/limits.h>
+#include <string.h>
+
 namespace AzNetworking
 {
     inline bool NetworkInputSerializer::CopyToBuffer(const uint8_t* data, uint32_t dataSize)
     {
         return SerializeBytes(data, dataSize);
     }
+
+    inline bool NetworkInputSerializer::SerializeValue(bool& value)
+    {
+        const uint8_t serializeValue = (value) ? 1 : 0;
+        return SerializeNetworkOrder(serializeValue);
+    }
+
+    inline bool NetworkInputSerializer::SerializeValue(float& value)
+    {
+        uint32_t hostOrder = 0;
+        memcpy(&hostOrder, &value, sizeof(float));
+        return SerializeNetworkOrder(hostOrder);
+    }
+
+    inline bool NetworkInputSerializer::SerializeValue(double& value)
+    {
+        uint64_t hostOrder = 0;
+        memcpy(&hostOrder, &value, sizeof(double));
+        return SerializeNetworkOrder(hostOrder);
+    }
+
+    template <typename TYPE, TYPE MinValue, TYPE MaxValue>
+    inline bool NetworkInputSerializer::SerializeBounded(TYPE& value)
+    {
+        using Traits = BoundedValueTraits<TYPE, MinValue, MaxValue>;
+        if constexpr (MinValue != AZStd::numeric_limits<TYPE>::min())
+        {
+            m_serializerValid &= (value >= MinValue);
+        }
+        if constexpr (MaxValue != AZStd::numeric_limits<TYPE>::max())
+        {
+            m_serializerValid &= (value <= MaxValue);
+        }
+        return SerializeNetworkOrder(Traits::Encode(value));
+    }
+
+    template <typename TYPE>
+    inline bool NetworkInputSerializer::SerializeBulk(TYPE* values, uint32_t count)
+    {
+        static_assert(IsBulkSerializable<TYPE>, "Only unsigned integers and floating point values can be bulk serialized");
+        if (count > m_bufferCapacity / sizeof(TYPE))
+        {
+            m_serializerValid = false;
+            return false;
+        }
+
+        uint8_t* writeBuffer = ReserveBytes(count * sizeof(TYPE));
+        if (writeBuffer == nullptr)
+        {
+            return false;
+        }
+
+        if constexpr (sizeof(TYPE) == 1)
+        {
+            memcpy(writeBuffer, values, count);
+        }
+        else
+        {
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                NetworkBitsType<TYPE> hostOrder;
+                memcpy(&hostOrder, &values[i], sizeof(TYPE));
+                StoreNetworkOrder(writeBuffer + i * sizeof(TYPE), hostOrder);
+            }
+        }
+        return true;
+    }
+
+    template <typename SERIALIZE_TYPE>
+    inline bool NetworkInputSerializer::SerializeNetworkOrder(SERIALIZE_TYPE value)
+    {
+        uint8_t* writeBuffer = ReserveBytes(sizeof(SERIALIZE_TYPE));
+        if (writeBuffer == nullptr)
+        {
+            return false;
+        }
+        StoreNetworkOrder(writeBuffer, value);
+        return true;
+    }
+
+    inline uint8_t* NetworkInputSerializer::ReserveBytes(uint32_t count)
+    {
+        const uint32_t currSize = m_bufferSize;
+        const uint32_t nextSize = m_bufferSize + count;
+
+        if (!m_serializerValid || (nextSize > m_bufferCapacity))
+        {
+            // Keep the failed boolean so we can verify serialization success
+            m_serializerValid = false;
+            return nullptr;
+        }
+
+        m_bufferSize = nextSize;
+        return const_cast<uint8_t*>(m_buffer + currSize);
+    }
 }
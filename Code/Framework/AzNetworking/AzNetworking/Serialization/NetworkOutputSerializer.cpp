@@ -28,10 +28,7 @@ namespace AzNetworking
 
     bool NetworkOutputSerializer::Serialize(bool& value, [[maybe_unused]] const char* name)
     {
-        uint8_t byteValue = 0;
-        SerializeBytes((uint8_t*)&byteValue, sizeof(byteValue));
-        value = (byteValue > 0);
-        return m_serializerValid;
+        return SerializeValue(value);
     }
 
     bool NetworkOutputSerializer::Serialize(char& value, [[maybe_unused]] const char* name, char minValue, char maxValue)
@@ -81,20 +78,12 @@ namespace AzNetworking
 
     bool NetworkOutputSerializer::Serialize(float& value, [[maybe_unused]] const char* name, [[maybe_unused]] float minValue, [[maybe_unused]] float maxValue)
     {
-        uint32_t networkOrder = 0;
-        m_serializerValid &= SerializeBytes((uint8_t*)&networkOrder, sizeof(float));
-        networkOrder = ntohl(networkOrder);
-        value = m_serializerValid ? *reinterpret_cast<float*>(&networkOrder) : value;
-        return m_serializerValid;
+        return SerializeValue(value);
     }
 
     bool NetworkOutputSerializer::Serialize(double& value, [[maybe_unused]] const char* name, [[maybe_unused]] double minValue, [[maybe_unused]] double maxValue)
     {
-        uint64_t networkOrder = 0;
-        m_serializerValid &= SerializeBytes((uint8_t *)&networkOrder, sizeof(double));
-        networkOrder = ntohll(networkOrder);
-        value = m_serializerValid ? *reinterpret_cast<double*>(&networkOrder) : value;
-        return m_serializerValid;
+        return SerializeValue(value);
     }
 
     bool NetworkOutputSerializer::SerializeBytes(uint8_t* buffer, uint32_t bufferCapacity, [[maybe_unused]] bool isString, uint32_t& outSize, [[maybe_unused]] const char* name)
@@ -182,19 +171,13 @@ namespace AzNetworking
 
     bool NetworkOutputSerializer::SerializeBytes(uint8_t* data, uint32_t count)
     {
-        const uint32_t currSize = m_bufferPosition;
-        const uint32_t nextSize = m_bufferPosition + count;
-
-        if (!m_serializerValid || (nextSize > m_bufferCapacity))
+        const uint8_t* readBuffer = ConsumeBytes(count);
+        if (readBuffer == nullptr)
         {
-            // Keep the failed boolean so we can verify serialization success
-            m_serializerValid = false;
             return false;
         }
 
-        const uint8_t* readBuffer = (const uint8_t*)(m_buffer + currSize);
         memcpy(data, readBuffer, count);
-        m_bufferPosition += count;
         return true;
     }
 }
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <AzNetworking/Serialization/ISerializer.h>
+#include <AzNetworking/Serialization/NetworkSerializerTraits.h>
 
 namespace AzNetworking
 {
@@ -36,8 +37,30 @@ namespace AzNetworking
         //! @return number of bytes consumed by serialization
         uint32_t GetReadSize() const;
 
+        //! Non-virtual serialization interfaces, these can be inlined by callers holding a NetworkOutputSerializer, see TypedSerializer.h.
+        //! They read exactly the same bytes as the matching ISerializer interfaces.
+        //! @{
+        bool SerializeValue(bool& value);
+        bool SerializeValue(float& value);
+        bool SerializeValue(double& value);
+
+        //! Serializes an integral value with bounds known at compile time, so the serialized width is selected at compile time.
+        //! @param value the value to serialize
+        //! @return boolean true for success, false for failure
+        template <typename TYPE, TYPE MinValue, TYPE MaxValue>
+        bool SerializeBounded(TYPE& value);
+
+        //! Serializes an array of unsigned integers or floating point values with a single bounds check.
+        //! @param values pointer to the values to serialize
+        //! @param count  number of values to serialize
+        //! @return boolean true for success, false for failure
+        template <typename TYPE>
+        bool SerializeBulk(TYPE* values, uint32_t count);
+        //! @}
+
         // ISerializer interfaces
         SerializerMode GetSerializerMode() const override;
+        SerializerType GetSerializerType() const override { return SerializerType::NetworkOutput; }
         bool Serialize(    bool& value, const char* name) override;
         bool Serialize(    char& value, const char* name,     char minValue,     char maxValue) override;
         bool Serialize(  int8_t& value, const char* name,   int8_t minValue,   int8_t maxValue) override;
@@ -74,6 +97,13 @@ namespace AzNetworking
 
         bool SerializeBytes(uint8_t* data, uint32_t count);
 
+        template <typename SERIALIZE_TYPE>
+        bool SerializeNetworkOrder(SERIALIZE_TYPE& value);
+
+        //! Consumes count bytes from the buffer, invalidating the serializer if there is insufficient data.
+        //! @return pointer to the consumed bytes, or nullptr on failure
+        const uint8_t* ConsumeBytes(uint32_t count);
+
         uint32_t       m_bufferPosition = 0;
         const uint32_t m_bufferCapacity;
         const uint8_t* m_buffer;
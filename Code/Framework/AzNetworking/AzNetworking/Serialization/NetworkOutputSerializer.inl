@@ -8,6 +8,9 @@
 
 #pragma once
 
+#include <AzCore/std/limits.h>
+#include <string.h>
+
 namespace AzNetworking
 {
     inline const uint8_t* NetworkOutputSerializer::GetUnreadData() const
@@ -24,4 +27,110 @@ namespace AzNetworking
     {
         return m_bufferPosition;
     }
+
+    inline bool NetworkOutputSerializer::SerializeValue(bool& value)
+    {
+        uint8_t byteValue = 0;
+        SerializeNetworkOrder(byteValue);
+        value = (byteValue > 0);
+        return m_serializerValid;
+    }
+
+    inline bool NetworkOutputSerializer::SerializeValue(float& value)
+    {
+        uint32_t hostOrder = 0;
+        if (SerializeNetworkOrder(hostOrder))
+        {
+            memcpy(&value, &hostOrder, sizeof(float));
+        }
+        return m_serializerValid;
+    }
+
+    inline bool NetworkOutputSerializer::SerializeValue(double& value)
+    {
+        uint64_t hostOrder = 0;
+        if (SerializeNetworkOrder(hostOrder))
+        {
+            memcpy(&value, &hostOrder, sizeof(double));
+        }
+        return m_serializerValid;
+    }
+
+    template <typename TYPE, TYPE MinValue, TYPE MaxValue>
+    inline bool NetworkOutputSerializer::SerializeBounded(TYPE& value)
+    {
+        using Traits = BoundedValueTraits<TYPE, MinValue, MaxValue>;
+        using WireType = typename Traits::WireType;
+
+        WireType result = 0;
+        if (!SerializeNetworkOrder(result))
+        {
+            return false;
+        }
+        if constexpr (Traits::Range < AZStd::numeric_limits<WireType>::max())
+        {
+            m_serializerValid &= (result <= static_cast<WireType>(Traits::Range));
+        }
+        value = m_serializerValid ? Traits::Decode(result) : value;
+        return m_serializerValid;
+    }
+
+    template <typename TYPE>
+    inline bool NetworkOutputSerializer::SerializeBulk(TYPE* values, uint32_t count)
+    {
+        static_assert(IsBulkSerializable<TYPE>, "Only unsigned integers and floating point values can be bulk serialized");
+        if (count > m_bufferCapacity / sizeof(TYPE))
+        {
+            m_serializerValid = false;
+            return false;
+        }
+
+        const uint8_t* readBuffer = ConsumeBytes(count * sizeof(TYPE));
+        if (readBuffer == nullptr)
+        {
+            return false;
+        }
+
+        if constexpr (sizeof(TYPE) == 1)
+        {
+            memcpy(values, readBuffer, count);
+        }
+        else
+        {
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                const NetworkBitsType<TYPE> hostOrder = LoadNetworkOrder<NetworkBitsType<TYPE>>(readBuffer + i * sizeof(TYPE));
+                memcpy(&values[i], &hostOrder, sizeof(TYPE));
+            }
+        }
+        return true;
+    }
+
+    template <typename SERIALIZE_TYPE>
+    inline bool NetworkOutputSerializer::SerializeNetworkOrder(SERIALIZE_TYPE& value)
+    {
+        const uint8_t* readBuffer = ConsumeBytes(sizeof(SERIALIZE_TYPE));
+        if (readBuffer == nullptr)
+        {
+            return false;
+        }
+        value = LoadNetworkOrder<SERIALIZE_TYPE>(readBuffer);
+        return true;
+    }
+
+    inline const uint8_t* NetworkOutputSerializer::ConsumeBytes(uint32_t count)
+    {
+        const uint32_t currSize = m_bufferPosition;
+        const uint32_t nextSize = m_bufferPosition + count;
+
+        if (!m_serializerValid || (nextSize > m_bufferCapacity))
+        {
+            // Keep the failed boolean so we can verify serialization success
+            m_serializerValid = false;
+            return nullptr;
+        }
+
+        m_bufferPosition = nextSize;
+        return m_buffer + currSize;
+    }
 }
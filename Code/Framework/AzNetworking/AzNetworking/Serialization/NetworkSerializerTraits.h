@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+#include <AzNetworking/Utilities/Endian.h>
+#include <AzCore/std/typetraits/conditional.h>
+#include <AzCore/std/typetraits/is_floating_point.h>
+#include <AzCore/std/typetraits/is_integral.h>
+#include <AzCore/std/typetraits/is_same.h>
+#include <AzCore/std/typetraits/is_unsigned.h>
+
+namespace AzNetworking
+{
+    //! Computes lhs - rhs in the promoted type of the operands, wrapping on overflow.
+    //! This matches what the network serializers have always put on the wire for bounded values, but is safe to evaluate at compile time.
+    //! @param lhs the value to subtract from
+    //! @param rhs the value to subtract
+    //! @return the wrapped difference in the promoted type of lhs - rhs
+    template <typename TYPE>
+    constexpr auto WrappingSubtract(TYPE lhs, TYPE rhs) -> decltype(lhs - rhs)
+    {
+        using PromotedType = decltype(lhs - rhs);
+        using UnsignedType = AZStd::make_unsigned_t<PromotedType>;
+        return static_cast<PromotedType>(static_cast<UnsignedType>(lhs) - static_cast<UnsignedType>(rhs));
+    }
+
+    //! Computes lhs + rhs in the promoted type of the operands, wrapping on overflow.
+    //! @param lhs the first value to add
+    //! @param rhs the second value to add
+    //! @return the wrapped sum in the promoted type of lhs + rhs
+    template <typename TYPE>
+    constexpr auto WrappingAdd(TYPE lhs, TYPE rhs) -> decltype(lhs + rhs)
+    {
+        using PromotedType = decltype(lhs + rhs);
+        using UnsignedType = AZStd::make_unsigned_t<PromotedType>;
+        return static_cast<PromotedType>(static_cast<UnsignedType>(lhs) + static_cast<UnsignedType>(rhs));
+    }
+
+    //! Returns the range of a bounded value, used to select how many bytes the value occupies on the wire.
+    //! @param minValue the minimum value expected during serialization
+    //! @param maxValue the maximum value expected during serialization
+    //! @return the range of the bounded value
+    template <typename TYPE>
+    constexpr uint64_t GetBoundedValueRange(TYPE minValue, TYPE maxValue)
+    {
+        return static_cast<uint64_t>(WrappingSubtract(maxValue, minValue));
+    }
+
+    //! Returns the number of bits required to represent every value in [0, range], used by the bit packed serializers.
+    //! @param range the range of the bounded value
+    //! @return the number of bits required to represent the range, 0 if the range only holds a single value
+    constexpr uint32_t GetBoundedValueBitCount(uint64_t range)
+    {
+        uint32_t bitCount = 0;
+        for (; range != 0; range >>= 1)
+        {
+            ++bitCount;
+        }
+        return bitCount;
+    }
+
+    //! Returns the offset of a bounded value from its minimum as an unsigned value of the same width.
+    //! Unlike WrappingSubtract this never widens to the promoted type, so the full range of a signed type never needs more bits than the type holds.
+    //! @param value    the value to encode
+    //! @param minValue the minimum value expected during serialization
+    //! @return the offset of value from minValue
+    template <typename TYPE>
+    constexpr uint64_t GetBoundedValueOffset(TYPE value, TYPE minValue)
+    {
+        using UnsignedType = AZStd::make_unsigned_t<TYPE>;
+        return static_cast<UnsignedType>(static_cast<UnsignedType>(value) - static_cast<UnsignedType>(minValue));
+    }
+
+    //! Inverse of GetBoundedValueOffset.
+    //! @param offset   the offset of the value from minValue
+    //! @param minValue the minimum value expected during serialization
+    //! @return the decoded value
+    template <typename TYPE>
+    constexpr TYPE ApplyBoundedValueOffset(uint64_t offset, TYPE minValue)
+    {
+        using UnsignedType = AZStd::make_unsigned_t<TYPE>;
+        return static_cast<TYPE>(static_cast<UnsignedType>(static_cast<UnsignedType>(offset) + static_cast<UnsignedType>(minValue)));
+    }
+
+    //! @struct BoundedValueTraits
+    //! @brief Compile-time wire encoding of an integral value with known bounds.
+    template <typename TYPE, TYPE MinValue, TYPE MaxValue>
+    struct BoundedValueTraits
+    {
+        static_assert(AZStd::is_integral_v<TYPE> && !AZStd::is_same_v<TYPE, bool>, "Only non-boolean integral types can be serialized as bounded values");
+        static_assert(MinValue <= MaxValue, "MinValue must not be greater than MaxValue");
+
+        static constexpr uint64_t Range = GetBoundedValueRange(MinValue, MaxValue);
+
+        using WireType = AZStd::conditional_t<(Range <= 0xFF), uint8_t,
+                         AZStd::conditional_t<(Range <= 0xFFFF), uint16_t,
+                         AZStd::conditional_t<(Range <= 0xFFFFFFFF), uint32_t, uint64_t>>>;
+
+        //! Encodes a value for the wire, relative to MinValue.
+        static constexpr WireType Encode(TYPE value)
+        {
+            return static_cast<WireType>(WrappingSubtract(value, MinValue));
+        }
+
+        //! Decodes a wire value back into the original type.
+        static constexpr TYPE Decode(WireType value)
+        {
+            return static_cast<TYPE>(WrappingAdd(static_cast<TYPE>(value), MinValue));
+        }
+    };
+
+    //! Unsigned integer type with the same size as TYPE, used to move the bits of a value to and from the wire.
+    template <typename TYPE>
+    using NetworkBitsType = AZStd::conditional_t<(sizeof(TYPE) == 8), uint64_t,
+                            AZStd::conditional_t<(sizeof(TYPE) == 4), uint32_t,
+                            AZStd::conditional_t<(sizeof(TYPE) == 2), uint16_t, uint8_t>>>;
+
+    //! True for types whose full range serialized representation is their raw bits in network byte order,
+    //! so arrays of them can be serialized with a single bounds check and a bulk copy.
+    template <typename TYPE>
+    constexpr bool IsBulkSerializable = AZStd::is_floating_point_v<TYPE> || (AZStd::is_unsigned_v<TYPE> && !AZStd::is_same_v<TYPE, bool>);
+
+    //! Stores a value to an unaligned buffer in network byte order.
+    //! Values up to 32 bits are written as shifts, which compile to a single byte swapped store on little endian targets.
+    //! 64-bit values go through htonll to match the virtual serialization path, whose byte order is platform specific.
+    //! @param buffer the buffer to store to, must have room for sizeof(TYPE) bytes
+    //! @param value  the value to store
+    template <typename TYPE>
+    inline void StoreNetworkOrder(uint8_t* buffer, TYPE value)
+    {
+        static_assert(AZStd::is_unsigned_v<TYPE>, "Only unsigned integers can be stored in network order");
+        if constexpr (sizeof(TYPE) == sizeof(uint64_t))
+        {
+            const uint64_t networkOrder = htonll(value);
+            memcpy(buffer, &networkOrder, sizeof(uint64_t));
+        }
+        else
+        {
+            for (uint32_t i = 0; i < sizeof(TYPE); ++i)
+            {
+                buffer[i] = static_cast<uint8_t>(value >> (8 * (sizeof(TYPE) - 1 - i)));
+            }
+        }
+    }
+
+    //! Loads a value stored in network byte order from an unaligned buffer, see StoreNetworkOrder.
+    //! @param buffer the buffer to load from, must hold at least sizeof(TYPE) bytes
+    //! @return the loaded value in host byte order
+    template <typename TYPE>
+    inline TYPE LoadNetworkOrder(const uint8_t* buffer)
+    {
+        static_assert(AZStd::is_unsigned_v<TYPE>, "Only unsigned integers can be loaded in network order");
+        if constexpr (sizeof(TYPE) == sizeof(uint64_t))
+        {
+            uint64_t networkOrder = 0;
+            memcpy(&networkOrder, buffer, sizeof(uint64_t));
+            return ntohll(networkOrder);
+        }
+        else
+        {
+            TYPE value = 0;
+            for (uint32_t i = 0; i < sizeof(TYPE); ++i)
+            {
+                value = static_cast<TYPE>((value << 8) | buffer[i]);
+            }
+            return value;
+        }
+    }
+}
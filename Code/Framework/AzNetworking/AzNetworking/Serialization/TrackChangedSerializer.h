@@ -28,6 +28,7 @@ namespace AzNetworking
 
         // ISerializer interfaces
         SerializerMode GetSerializerMode() const override;
+        SerializerType GetSerializerType() const override;
         bool Serialize(    bool& value, const char* name) override;
         bool Serialize(    char& value, const char* name,     char minValue,     char maxValue) override;
         bool Serialize(  int8_t& value, const char* name,   int8_t minValue,   int8_t maxValue) override;
@@ -24,6 +24,13 @@ namespace AzNetworking
         return BASE_TYPE::GetSerializerMode();
     }
 
+    template <typename BASE_TYPE>
+    SerializerType TrackChangedSerializer<BASE_TYPE>::GetSerializerType() const
+    {
+        // Changes are tracked by the virtual interfaces, so typed serialization must not resolve to the base serializer
+        return SerializerType::Other;
+    }
+
     template <typename BASE_TYPE>
     bool TrackChangedSerializer<BASE_TYPE>::Serialize(bool& value, const char* name)
     {
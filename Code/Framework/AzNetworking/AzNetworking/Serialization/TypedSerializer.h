@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzNetworking/Serialization/ISerializer.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <AzNetworking/Serialization/NetworkOutputSerializer.h>
+#include <AzCore/std/typetraits/is_same.h>
+
+namespace AzNetworking
+{
+    //! True if SERIALIZER is one of the concrete network serializers that provide non-virtual serialization interfaces.
+    template <typename SERIALIZER>
+    constexpr bool IsNetworkSerializer = AZStd::is_same_v<SERIALIZER, NetworkInputSerializer> || AZStd::is_same_v<SERIALIZER, NetworkOutputSerializer>;
+
+    //! Serializes a value through a serializer whose concrete type is known at compile time.
+    //!
+    //! Every call through ISerializer is virtual, which keeps the byte packing of the network serializers from being inlined
+    //! into generated packet and component code. When SERIALIZER is NetworkInputSerializer or NetworkOutputSerializer, this resolves
+    //! primitives, enums, type-safe integrals, vectors and quaternions to the serializer's inline interfaces, with the serialized
+    //! width of integral values selected at compile time from their range, and serializes fixed size arrays of unsigned integers
+    //! and floating point values with a single bounds check. Any other serializer or type goes through the virtual ISerializer
+    //! interfaces, so tools keep working unmodified. Both paths produce identical bytes.
+    //! @param serializer the serializer to use
+    //! @param value      the value to serialize
+    //! @param name       string name of the value being serialized
+    //! @return boolean true for success, false for serialization failure
+    template <typename SERIALIZER, typename TYPE>
+    bool SerializeTyped(SERIALIZER& serializer, TYPE& value, const char* name);
+
+    //! Serializes an object through its SerializeMembers<SERIALIZER>() template, instantiated for the concrete type of serializer.
+    //! Generated packets and rpc parameter structs forward their virtual Serialize() here, so the type of the serializer is
+    //! resolved once per object rather than once per member.
+    //! @param serializer the serializer to use
+    //! @param object     the object to serialize, must provide a public SerializeMembers<SERIALIZER>() template
+    //! @return boolean true for success, false for serialization failure
+    template <typename TYPE>
+    bool SerializeMembersTyped(ISerializer& serializer, TYPE& object);
+}
+
+#include <AzNetworking/Serialization/TypedSerializer.inl>
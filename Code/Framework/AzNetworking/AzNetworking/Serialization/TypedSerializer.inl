@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Math/Vector4.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/typetraits/is_enum.h>
+#include <AzCore/std/typetraits/underlying_type.h>
+
+namespace AzNetworking
+{
+    // Base template, anything without a statically dispatched path goes through the virtual interfaces
+    template <typename SERIALIZER, typename TYPE, typename = void>
+    struct TypedSerializeHelper
+    {
+        static bool Serialize(SERIALIZER& serializer, TYPE& value, const char* name)
+        {
+            return static_cast<ISerializer&>(serializer).Serialize(value, name);
+        }
+    };
+
+    // Booleans and floating point values
+    template <typename SERIALIZER, typename TYPE>
+    struct TypedSerializeHelper<SERIALIZER, TYPE,
+        AZStd::enable_if_t<IsNetworkSerializer<SERIALIZER> && (AZStd::is_same_v<TYPE, bool> || AZStd::is_floating_point_v<TYPE>)>>
+    {
+        static bool Serialize(SERIALIZER& serializer, TYPE& value, [[maybe_unused]] const char* name)
+        {
+            return serializer.SerializeValue(value);
+        }
+    };
+
+    // Integral values, the virtual interfaces default to the full range of the type
+    template <typename SERIALIZER, typename TYPE>
+    struct TypedSerializeHelper<SERIALIZER, TYPE,
+        AZStd::enable_if_t<IsNetworkSerializer<SERIALIZER> && AZStd::is_integral_v<TYPE> && !AZStd::is_same_v<TYPE, bool>>>
+    {
+        static bool Serialize(SERIALIZER& serializer, TYPE& value, [[maybe_unused]] const char* name)
+        {
+            return serializer.template SerializeBounded<TYPE, AZStd::numeric_limits<TYPE>::min(), AZStd::numeric_limits<TYPE>::max()>(value);
+        }
+    };
+
+    // Enums and type-safe integrals serialize their underlying type
+    template <typename SERIALIZER, typename TYPE>
+    struct TypedSerializeHelper<SERIALIZER, TYPE, AZStd::enable_if_t<IsNetworkSerializer<SERIALIZER> && AZStd::is_enum_v<TYPE>>>
+    {
+        static bool Serialize(SERIALIZER& serializer, TYPE& value, const char* name)
+        {
+            using UnderlyingType = AZStd::underlying_type_t<TYPE>;
+            return TypedSerializeHelper<SERIALIZER, UnderlyingType>::Serialize(serializer, reinterpret_cast<UnderlyingType&>(value), name);
+        }
+    };
+
+    template <typename SERIALIZER>
+    struct TypedSerializeHelper<SERIALIZER, AZ::Vector3, AZStd::enable_if_t<IsNetworkSerializer<SERIALIZER>>>
+    {
+        static bool Serialize(SERIALIZER& serializer, AZ::Vector3& value, [[maybe_unused]] const char* name)
+        {
+            float values[4];
+            value.StoreToFloat3(values);
+            serializer.SerializeBulk(values, 3);
+            value = AZ::Vector3::CreateFromFloat3(values);
+            return serializer.IsValid();
+        }
+    };
+
+    template <typename SERIALIZER>
+    struct TypedSerializeHelper<SERIALIZER, AZ::Vector4, AZStd::enable_if_t<IsNetworkSerializer<SERIALIZER>>>
+    {
+        static bool Serialize(SERIALIZER& serializer, AZ::Vector4& value, [[maybe_unused]] const char* name)
+        {
+            float values[4];
+            value.StoreToFloat4(values);
+            serializer.SerializeBulk(values, 4);
+            value = AZ::Vector4::CreateFromFloat4(values);
+            return serializer.IsValid();
+        }
+    };
+
+    template <typename SERIALIZER>
+    struct TypedSerializeHelper<SERIALIZER, AZ::Quaternion, AZStd::enable_if_t<IsNetworkSerializer<SERIALIZER>>>
+    {
+        static bool Serialize(SERIALIZER& serializer, AZ::Quaternion& value, [[maybe_unused]] const char* name)
+        {
+            float values[4];
+            value.StoreToFloat4(values);
+            serializer.SerializeBulk(values, 4);
+            value = AZ::Quaternion::CreateFromFloat4(values);
+            return serializer.IsValid();
+        }
+    };
+
+    // Fixed size arrays, arrays of unsigned integers and floating point values are copied in bulk
+    template <typename SERIALIZER, typename TYPE, AZStd::size_t Size>
+    struct TypedSerializeHelper<SERIALIZER, AZStd::array<TYPE, Size>, AZStd::enable_if_t<IsNetworkSerializer<SERIALIZER>>>
+    {
+        static bool Serialize(SERIALIZER& serializer, AZStd::array<TYPE, Size>& value, const char* name)
+        {
+            if constexpr (IsBulkSerializable<TYPE>)
+            {
+                return serializer.SerializeBulk(value.data(), static_cast<uint32_t>(Size));
+            }
+            else
+            {
+                for (TYPE& element : value)
+                {
+                    TypedSerializeHelper<SERIALIZER, TYPE>::Serialize(serializer, element, name);
+                }
+                return serializer.IsValid();
+            }
+        }
+    };
+
+    template <typename SERIALIZER, typename TYPE>
+    inline bool SerializeTyped(SERIALIZER& serializer, TYPE& value, const char* name)
+    {
+        return TypedSerializeHelper<SERIALIZER, TYPE>::Serialize(serializer, value, name);
+    }
+
+    template <typename TYPE>
+    inline bool SerializeMembersTyped(ISerializer& serializer, TYPE& object)
+    {
+        switch (serializer.GetSerializerType())
+        {
+        case SerializerType::NetworkInput:
+            return object.SerializeMembers(static_cast<NetworkInputSerializer&>(serializer));
+        case SerializerType::NetworkOutput:
+            return object.SerializeMembers(static_cast<NetworkOutputSerializer&>(serializer));
+        default:
+            return object.SerializeMembers(serializer);
+        }
+    }
+}
@@ -10,6 +10,8 @@
 #include <AzNetworking/TcpTransport/TcpConnection.h>
 #include <AzNetworking/TcpTransport/TcpPacketHeader.h>
 #include <AzNetworking/TcpTransport/TcpNetworkInterface.h>
+#include <AzNetworking/Serialization/NetworkBitInputSerializer.h>
+#include <AzNetworking/Serialization/NetworkBitOutputSerializer.h>
 #include <AzNetworking/Serialization/NetworkInputSerializer.h>
 #include <AzNetworking/Serialization/NetworkOutputSerializer.h>
 #include <AzNetworking/ConnectionLayer/IConnectionSet.h>
@@ -170,7 +172,9 @@ namespace AzNetworking
             }
             timeoutItem->UpdateTimeoutTime(startTimeMs);
 
-            NetworkOutputSerializer serializer(buffer.GetBuffer(), static_cast<uint32_t>(buffer.GetSize()));
+            NetworkOutputSerializer networkSerializer(buffer.GetBuffer(), static_cast<uint32_t>(buffer.GetSize()));
+            NetworkBitOutputSerializer bitSerializer(buffer.GetBuffer(), static_cast<uint32_t>(buffer.GetSize()));
+            ISerializer& serializer = header.IsPacketFlagSet(PacketFlag::BitPacked) ? static_cast<ISerializer&>(bitSerializer) : networkSerializer;
             if (m_state == ConnectionState::Connecting)
             {
                 const ConnectResult connectResult = m_networkInterface.GetConnectionListener().ValidateConnect(GetRemoteAddress(), header, serializer);
@@ -198,7 +202,9 @@ namespace AzNetworking
     {
         TcpPacketEncodingBuffer buffer;
         {
-            NetworkInputSerializer serializer(buffer.GetBuffer(), static_cast<uint32_t>(buffer.GetCapacity()));
+            NetworkInputSerializer networkSerializer(buffer.GetBuffer(), static_cast<uint32_t>(buffer.GetCapacity()));
+            NetworkBitInputSerializer bitSerializer(buffer.GetBuffer(), static_cast<uint32_t>(buffer.GetCapacity()));
+            ISerializer& serializer = packet.IsBitPacked() ? static_cast<ISerializer&>(bitSerializer) : networkSerializer;
             if (!const_cast<IPacket&>(packet).Serialize(serializer))
             {
                 AZ_Assert(false, "SendReliablePacket: Unable to serialize packet [Type: %d]", packet.GetPacketType());
@@ -209,7 +215,7 @@ namespace AzNetworking
 
         const AZ::TimeMs currentTimeMs = AZ::GetElapsedTimeMs();
         ++m_lastSentPacketId;
-        return SendPacketInternal(packet.GetPacketType(), buffer, currentTimeMs);
+        return SendPacketInternal(packet.GetPacketType(), packet.IsBitPacked(), buffer, currentTimeMs);
     }
 
     PacketId TcpConnection::SendUnreliablePacket(const IPacket& packet)
@@ -261,38 +267,16 @@ namespace AzNetworking
         return 0; // do nothing, unsupported on TCP connections
     }
 
-    bool TcpConnection::SendPacketInternal(PacketType packetType, TcpPacketEncodingBuffer& payloadBuffer, AZ::TimeMs currentTimeMs)
+    bool TcpConnection::SendPacketInternal(PacketType packetType, bool bitPacked, TcpPacketEncodingBuffer& payloadBuffer, AZ::TimeMs currentTimeMs)
     {
         AZ_Assert(payloadBuffer.GetCapacity() < AZStd::numeric_limits<uint16_t>::max(), "Buffer capacity should be representable using 2 bytes or less");
         int32_t payloadSize = aznumeric_cast<int32_t>(payloadBuffer.GetSize());
         bool shouldCompress = m_compressor && packetType != aznumeric_cast<PacketType>(CorePackets::PacketType::InitiateConnectionPacket);
-
-        // Create and serialize header...
-        TcpPacketEncodingBuffer headerBuffer;
-        {
-            TcpPacketHeader header(packetType, aznumeric_cast<uint16_t>(payloadBuffer.GetSize()));
-            header.SetPacketFlag(PacketFlag::Compressed, shouldCompress);
-            NetworkInputSerializer serializer(headerBuffer.GetBuffer(), static_cast<uint32_t>(headerBuffer.GetCapacity()));
-            if (!header.Serialize(serializer))
-            {
-                return false;
-            }
-            headerBuffer.Resize(serializer.GetSize());
-        }
-
-        const uint16_t headerSize = aznumeric_cast<uint16_t>(headerBuffer.GetSize());
         const uint8_t* srcData = reinterpret_cast<const uint8_t*>(payloadBuffer.GetBuffer());
-        uint8_t* dstData = reinterpret_cast<uint8_t*>(m_sendRingbuffer.ReserveBlockForWrite(headerSize + payloadSize));
 
-        if (dstData == nullptr)
-        {
-            AZLOG_ERROR("Send ringbuffer full, dropped packet");
-            return false;
-        }
-
-        // Compress send data
+        // Compress send data first, the header has to carry the size of the data actually written
         TcpPacketEncodingBuffer writeBuffer;
-        if (m_compressor && packetType != aznumeric_cast<PacketType>(CorePackets::PacketType::InitiateConnectionPacket))
+        if (shouldCompress)
         {
             const AZStd::size_t maxSizeNeeded = m_compressor->GetMaxCompressedBufferSize(payloadBuffer.GetSize());
             AZStd::size_t compressionMemBytesUsed = 0;
@@ -317,6 +301,29 @@ namespace AzNetworking
             srcData = writeBuffer.GetBuffer();
         }
 
+        // Create and serialize header...
+        TcpPacketEncodingBuffer headerBuffer;
+        {
+            TcpPacketHeader header(packetType, aznumeric_cast<uint16_t>(payloadSize));
+            header.SetPacketFlag(PacketFlag::Compressed, shouldCompress);
+            header.SetPacketFlag(PacketFlag::BitPacked, bitPacked);
+            NetworkInputSerializer serializer(headerBuffer.GetBuffer(), static_cast<uint32_t>(headerBuffer.GetCapacity()));
+            if (!header.Serialize(serializer))
+            {
+                return false;
+            }
+            headerBuffer.Resize(serializer.GetSize());
+        }
+
+        const uint16_t headerSize = aznumeric_cast<uint16_t>(headerBuffer.GetSize());
+        uint8_t* dstData = reinterpret_cast<uint8_t*>(m_sendRingbuffer.ReserveBlockForWrite(headerSize + payloadSize));
+
+        if (dstData == nullptr)
+        {
+            AZLOG_ERROR("Send ringbuffer full, dropped packet");
+            return false;
+        }
+
         // Copy the header data to the ring buffer
         {
             memcpy(dstData, headerBuffer.GetBuffer(), headerSize);
@@ -365,13 +372,14 @@ namespace AzNetworking
                 AZLOG_WARN("Failed to decompress packet!");
                 return false;
             }
-            srcData = outBuffer.GetBuffer();
-            packetSize = aznumeric_cast<uint16_t>(outBuffer.GetSize());
+        }
+        else
+        {
+            uint8_t* dstData = outBuffer.GetBuffer();
+            memcpy(dstData, srcData, packetSize);
         }
 
-        uint8_t* dstData = outBuffer.GetBuffer();
-        memcpy(dstData, srcData, packetSize);
-
+        // The ring buffer holds the packet as it was sent, the size of a compressed packet differs from its payload
         m_recvRingbuffer.AdvanceReadBuffer(serializer.GetReadSize() + packetSize);
         GetMetrics().LogPacketRecv(packetSize, currentTimeMs);
         m_networkInterface.GetMetrics().m_recvPackets++;
@@ -116,10 +116,11 @@ namespace AzNetworking
 
         //! Transmits a packet to the connected connection.
         //! @param packetType     packet type of the buffer being transmitted
+        //! @param bitPacked      true if the buffer was written with a NetworkBitInputSerializer
         //! @param payloadBuffer  packet buffer to transmit
         //! @param currentTimeMs current process time in milliseconds
         //! @return boolean true if the packet was transmitted (NOT AN INDICATION OF DELIVERY)
-        bool SendPacketInternal(PacketType packetType, TcpPacketEncodingBuffer& payloadBuffer, AZ::TimeMs currentTimeMs);
+        bool SendPacketInternal(PacketType packetType, bool bitPacked, TcpPacketEncodingBuffer& payloadBuffer, AZ::TimeMs currentTimeMs);
 
         //! Receives a packet from the connected connection.
         //! @param outHeader      header of the received packet
@@ -9,6 +9,7 @@
 #include <AzNetworking/UdpTransport/UdpFragmentQueue.h>
 #include <AzNetworking/UdpTransport/UdpConnection.h>
 #include <AzNetworking/UdpTransport/UdpPacketHeader.h>
+#include <AzNetworking/Serialization/NetworkBitOutputSerializer.h>
 #include <AzNetworking/Serialization/NetworkOutputSerializer.h>
 #include <AzNetworking/Utilities/NetworkCommon.h>
 #include <AzCore/Console/IConsole.h>
@@ -38,13 +39,62 @@ namespace AzNetworking
     }
 
     bool UdpFragmentQueue::ProcessReceivedChunk(UdpConnection* connection, IConnectionListener& connectionListener, UdpPacketHeader& header, ISerializer& serializer)
+    {
+        UdpPacketEncodingBuffer buffer;
+        switch (ReassembleChunk(header, serializer, buffer))
+        {
+        case ReassembleResult::Error:
+            return false;
+        case ReassembleResult::Pending:
+            return true;
+        case ReassembleResult::Complete:
+            break;
+        }
+
+        NetworkOutputSerializer networkSerializer(buffer.GetBuffer(), static_cast<uint32_t>(buffer.GetSize()));
+        {
+            ISerializer& networkISerializer = networkSerializer; // To get the default typeinfo parameters in ISerializer
+
+            // First, serialize out the header
+            if (!header.SerializePacketFlags(networkSerializer))
+            {
+                AZLOG(NET_FragmentQueue, "Reconstructed fragmented packet failed packet flags serialization");
+                return false;
+            }
+
+            if (!networkISerializer.Serialize(header, "Header"))
+            {
+                AZLOG(NET_FragmentQueue, "Reconstructed fragmented packet failed header serialization");
+                return false;
+            }
+        }
+        connection->GetPacketTracker().ProcessReceived(connection, header);
+
+        // Bit packed payloads start on the byte following the header
+        NetworkBitOutputSerializer bitSerializer(networkSerializer.GetUnreadData(), networkSerializer.GetUnreadSize());
+        ISerializer& payloadSerializer = header.IsPacketFlagSet(PacketFlag::BitPacked) ? static_cast<ISerializer&>(bitSerializer) : networkSerializer;
+
+        bool handledPacket = false;
+        if (header.GetPacketType() < aznumeric_cast<PacketType>(CorePackets::PacketType::MAX))
+        {
+            handledPacket = connection->HandleCorePacket(connectionListener, header, payloadSerializer);
+        }
+        else
+        {
+            handledPacket = connectionListener.OnPacketReceived(connection, header, payloadSerializer);
+        }
+
+        return handledPacket;
+    }
+
+    ReassembleResult UdpFragmentQueue::ReassembleChunk(const UdpPacketHeader& header, ISerializer& serializer, UdpPacketEncodingBuffer& outPacket)
     {
         AZStd::unique_ptr<CorePackets::FragmentedPacket> packet = AZStd::make_unique<CorePackets::FragmentedPacket>();
 
         if (!serializer.Serialize(*packet, "Packet"))
         {
             AZLOG(NET_FragmentQueue, "Fragment failed serialization");
-            return false;
+            return ReassembleResult::Error;
         }
 
         const bool isReliable = header.GetIsReliable();
@@ -63,14 +113,14 @@ namespace AzNetworking
         {
             // Too old to process
             AZLOG(NET_FragmentQueue, "Fragment sequence ID is outside our tracked window");
-            return false;
+            return ReassembleResult::Error;
         }
 
         if (m_deliveredFragments.GetBit(static_cast<uint32_t>(sequenceDelta)))
         {
             // Received packet is a duplicate of one already forwarded to gameplay
             AZLOG(NET_FragmentQueue, "Received duplicate of fragmented packet %u, discarding", static_cast<uint32_t>(fragmentSequence));
-            return true;
+            return ReassembleResult::Pending;
         }
 
         const uint32_t chunkCount = packet->GetChunkCount();
@@ -89,7 +139,7 @@ namespace AzNetworking
         {
             // Either we disagree on the number of chunks, or chunkIndex is bigger than the expected size, bail and disconnect
             AZLOG(NET_FragmentQueue, "Malformed chunk metadata in fragmented packet, chunkIndex %u, chunkCount %u, reservedSize %u", chunkIndex, chunkCount, static_cast<uint32_t>(packetFragments.size()));
-            return false;
+            return ReassembleResult::Error;
         }
 
         packetFragments[chunkIndex] = AZStd::move(packet);
@@ -105,7 +155,7 @@ namespace AzNetworking
                 }
 
                 // We haven't received all chunks required to complete this packet yet
-                return true;
+                return ReassembleResult::Pending;
             }
 
             totalPacketSize += static_cast<uint32_t>(packetFragments[index]->GetChunkBuffer().GetSize());
@@ -114,15 +164,14 @@ namespace AzNetworking
         // We now mark this sequence as delivered, so if by some chance all the individual chunks get redelivered again we don't double deliver the reconstructed packet
         m_deliveredFragments.SetBit(static_cast<uint32_t>(sequenceDelta), true);
 
-        // All chunks have been received, reconstruct the original packet and deliver to the connection listener
-        UdpPacketEncodingBuffer buffer;
-        if (!buffer.Resize(totalPacketSize))
+        // All chunks have been received, reconstruct the original packet
+        if (!outPacket.Resize(totalPacketSize))
         {
             AZLOG_ERROR("Fragmented packet is too large to fit in UdpPacketEncodingBuffer");
-            return false;
+            return ReassembleResult::Error;
         }
 
-        uint8_t* bufferPointer = buffer.GetBuffer();
+        uint8_t* bufferPointer = outPacket.GetBuffer();
         for (uint32_t index = 0; index < packetFragments.size(); ++index)
         {
             const uint32_t chunkSize = static_cast<uint32_t>(packetFragments[index]->GetChunkBuffer().GetSize());
@@ -132,36 +181,7 @@ namespace AzNetworking
 
         // We can erase all the chunks now, packet is completed
         m_packetFragments.erase(fragmentSequence);
-
-        NetworkOutputSerializer networkSerializer(buffer.GetBuffer(), static_cast<uint32_t>(buffer.GetSize()));
-        {
-            ISerializer& networkISerializer = networkSerializer; // To get the default typeinfo parameters in ISerializer
-
-            // First, serialize out the header
-            if (!header.SerializePacketFlags(networkSerializer))
-            {
-                AZLOG(NET_FragmentQueue, "Reconstructed fragmented packet failed packet flags serialization");
-                return false;
-            }
-
-            if (!networkISerializer.Serialize(header, "Header"))
-            {
-                AZLOG(NET_FragmentQueue, "Reconstructed fragmented packet failed header serialization");
-                return false;
-            }
-        }
-        connection->GetPacketTracker().ProcessReceived(connection, header);
-        bool handledPacket = false;
-        if (header.GetPacketType() < aznumeric_cast<PacketType>(CorePackets::PacketType::MAX))
-        {
-            handledPacket = connection->HandleCorePacket(connectionListener, header, networkSerializer);
-        }
-        else
-        {
-            handledPacket = connectionListener.OnPacketReceived(connection, header, networkSerializer);
-        }
-
-        return handledPacket;
+        return ReassembleResult::Complete;
     }
 
     TimeoutResult UdpFragmentQueue::HandleTimeout(TimeoutQueue::TimeoutItem& item)
@@ -22,6 +22,14 @@ namespace AzNetworking
     class UdpConnection;
     class UdpPacketHeader;
 
+    //! Result of adding a received chunk to a UdpFragmentQueue.
+    enum class ReassembleResult
+    {
+        Error,    //!< The chunk was malformed or is outside the tracked window
+        Pending,  //!< The chunk was stored or discarded as a duplicate, the packet is not complete yet
+        Complete  //!< The chunk completed its packet, which has been written to the output buffer
+    };
+
     //! @class UdpFragmentQueue
     //! @brief Class for reconstructing packet chunks into the original unsegmented packet.
     class UdpFragmentQueue
@@ -47,6 +55,14 @@ namespace AzNetworking
         //! @return boolean true if the chunk was processed, false if an error was encountered
         bool ProcessReceivedChunk(UdpConnection* connection, IConnectionListener& connectionListener, UdpPacketHeader& header, ISerializer& serializer);
 
+        //! Stores a received chunk and reconstructs the original packet once all of its chunks have arrived.
+        //! This does not touch any connection state, so it can run on a different thread than the owning connection.
+        //! @param header     the chunk packet header
+        //! @param serializer the serializer containing the chunk body
+        //! @param outPacket  on completion, the reconstructed packet including its flags and header
+        //! @return the result of adding the chunk
+        ReassembleResult ReassembleChunk(const UdpPacketHeader& header, ISerializer& serializer, UdpPacketEncodingBuffer& outPacket);
+
     private:
 
         //! Handler callback for timed out items.
@@ -11,6 +11,8 @@
 #include <AzNetworking/UdpTransport/UdpConnection.h>
 #include <AzNetworking/UdpTransport/DtlsSocket.h>
 #include <AzNetworking/UdpTransport/UdpSocket.h>
+#include <AzNetworking/Serialization/NetworkBitInputSerializer.h>
+#include <AzNetworking/Serialization/NetworkBitOutputSerializer.h>
 #include <AzNetworking/Serialization/NetworkInputSerializer.h>
 #include <AzNetworking/Serialization/NetworkOutputSerializer.h>
 #include <AzNetworking/Framework/ICompressor.h>
@@ -37,6 +39,8 @@ namespace AzNetworking
     AZ_CVAR(int32_t, net_MaxTimeoutsPerFrame, 1000, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Maximum number of packet timeouts to allow to process in a single frame");
     AZ_CVAR(float, net_RttFudgeScalar, 2.0f, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Scalar value to multiply computed Rtt by to determine an optimal packet timeout threshold");
     AZ_CVAR(uint32_t, net_FragmentedHeaderOverhead, 32, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "A fudge overhead value to take out of fragmented packet payloads");
+    AZ_CVAR(uint32_t, net_UdpReceiveShards, 0, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "If non-zero, unencrypted Udp interfaces listening on a fixed port open this many sockets with SO_REUSEPORT, each read and decoded by its own thread");
     AZ_CVAR(AZ::CVarFixedString, net_UdpCompressor, "MultiplayerCompressor", nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "UDP compressor to use."); // WARN: similar to encryption this needs to be set once and only once before creating the network interface
 
     static uint64_t ConstructTimeoutId(ConnectionId connectionId, PacketId packetId, ReliabilityType reliability)
@@ -69,6 +73,7 @@ namespace AzNetworking
 
     UdpNetworkInterface::~UdpNetworkInterface()
     {
+        CloseReceiveShards();
         m_readerThread.UnregisterSocket(m_socket.get());
     }
 
@@ -112,15 +117,33 @@ namespace AzNetworking
 
         m_port = port;
         m_allowIncomingConnections = true;
-        if (m_socket->Open(m_port, UdpSocket::CanAcceptConnections::True, m_trustZone))
+
+        uint32_t shardCount = net_UdpReceiveShards;
+        if (shardCount > 0 && (m_port == 0 || m_socket->IsEncrypted()))
         {
-            m_readerThread.RegisterSocket(m_socket.get());
-            return true;
+            AZLOG_WARN("Udp receive shards require a fixed port and an unencrypted socket, using the shared reader thread instead");
+            shardCount = 0;
         }
-        else
+
+        m_socket->SetReusePortEnabled(shardCount > 1);
+        if (shardCount > 1 && !m_socket->IsReusePortEnabled())
+        {
+            AZLOG_WARN("Port reuse is not supported on this platform, using a single Udp receive shard");
+            shardCount = 1;
+        }
+
+        if (!m_socket->Open(m_port, UdpSocket::CanAcceptConnections::True, m_trustZone))
         {
             return false;
         }
+
+        if (shardCount > 0)
+        {
+            return OpenReceiveShards(shardCount);
+        }
+
+        m_readerThread.RegisterSocket(m_socket.get());
+        return true;
     }
 
     ConnectionId UdpNetworkInterface::Connect(const IpAddress& remoteAddress)
@@ -154,6 +177,7 @@ namespace AzNetworking
         connectPacket.SetHandshakeBuffer(dtlsData);
         connection->SendReliablePacket(connectPacket);
 
+        UpdateReceiveShards(remoteAddress, true);
         m_connectionListener.OnConnect(connection.get());
         m_connectionSet.AddConnection(AZStd::move(connection));
         return connectionId;
@@ -167,23 +191,83 @@ namespace AzNetworking
         }
 
         const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
-        const UdpReaderThread::ReceivedPackets* packets = m_readerThread.GetReceivedPackets(m_socket.get());
-        if (packets == nullptr)
+
+        // With batched I/O enabled, anything sent since the last update is still queued on the socket
+        m_socket->FlushSends();
+
+        if (!m_receiveShards.empty())
         {
-            // Socket is not yet registered with the reader thread and is likely still pending, try again later
-            return;
+            ProcessShardPackets(startTimeMs);
+        }
+        else
+        {
+            const UdpReaderThread::ReceivedPackets* packets = m_readerThread.GetReceivedPackets(m_socket.get());
+            if (packets == nullptr)
+            {
+                // Socket is not yet registered with the reader thread and is likely still pending, try again later
+                return;
+            }
+            ProcessReceivedPackets(*packets, startTimeMs);
+        }
+        const AZ::TimeMs receiveTimeMs = AZ::GetElapsedTimeMs() - startTimeMs;
+
+        // Time out any stale client connections
+        {
+            ConnectionTimeoutFunctor functor(*this);
+            m_connectionTimeoutQueue.UpdateTimeouts(functor);
+        }
+
+        // Time out any packets that haven't been acked within our timeout window
+        {
+            PacketTimeoutFunctor functor(*this);
+            m_packetTimeoutQueue.UpdateTimeouts(functor, static_cast<int32_t>(net_MaxTimeoutsPerFrame));
+        }
+
+        // Delete any connections we've disconnected
+        for (RemovedConnection& removedConnection : m_removedConnections)
+        {
+            UpdateReceiveShards(removedConnection.m_connection->GetRemoteAddress(), false);
+            m_connectionListener.OnDisconnect(removedConnection.m_connection, removedConnection.m_reason, removedConnection.m_endpoint);
+            m_connectionSet.DeleteConnection(removedConnection.m_connection->GetConnectionId()); // Will delete the connection
+        }
+        m_removedConnections.clear();
+
+        // Flush acks, heartbeats and resends queued while processing this update
+        m_socket->FlushSends();
+
+        // Update metrics
+        GetMetrics().m_sendPackets = m_socket->GetSentPackets();
+        GetMetrics().m_sendBytes = m_socket->GetSentBytes();
+        GetMetrics().m_sendPacketsEncrypted = m_socket->GetSentPacketsEncrypted();
+        GetMetrics().m_sendBytesEncryptionInflation = m_socket->GetSentBytesEncryptionInflation();
+        GetMetrics().m_sendSystemCalls = m_socket->GetSendCalls();
+        GetMetrics().m_sendSegmentedPackets = m_socket->GetSentSegmentedPackets();
+        GetMetrics().m_recvTimeMs += receiveTimeMs;
+        GetMetrics().m_recvPackets = m_socket->GetRecvPackets();
+        GetMetrics().m_recvBytes = m_socket->GetRecvBytes();
+        GetMetrics().m_recvSystemCalls = m_socket->GetRecvCalls();
+        for (const AZStd::unique_ptr<UdpSocket>& shardSocket : m_shardSockets)
+        {
+            GetMetrics().m_recvPackets += shardSocket->GetRecvPackets();
+            GetMetrics().m_recvBytes += shardSocket->GetRecvBytes();
+            GetMetrics().m_recvSystemCalls += shardSocket->GetRecvCalls();
         }
+        GetMetrics().m_connectionCount = m_connectionSet.GetConnectionCount();
+        GetMetrics().m_updateTimeMs += AZ::GetElapsedTimeMs() - startTimeMs;
+    }
 
-        for (uint32_t i = 0; i < packets->size(); ++i)
+    void UdpNetworkInterface::ProcessReceivedPackets(const UdpReaderThread::ReceivedPackets& packets, AZ::TimeMs startTimeMs)
+    {
+        for (uint32_t i = 0; i < packets.size(); ++i)
         {
-            const UdpReaderThread::ReceivedPacket& packet = (*packets)[i];
+            const UdpReaderThread::ReceivedPacket& packet = packets[i];
             const AZ::TimeMs currentTimeMs = AZ::GetElapsedTimeMs();
 
             // Don't exceed our timeslice, even if unprocessed data remains
             if ((currentTimeMs - startTimeMs) > net_UdpPacketTimeSliceMs)
             {
-                AZLOG_WARN("Processing time exceeded, discarding %d/%d received packets", aznumeric_cast<int32_t>(packets->size() - i), aznumeric_cast<int32_t>(packets->size()));
-                GetMetrics().m_discardedPackets += packets->size() - i;
+                AZLOG_WARN("Processing time exceeded, discarding %d/%d received packets", aznumeric_cast<int32_t>(packets.size() - i), aznumeric_cast<int32_t>(packets.size()));
+                GetMetrics().m_discardedPackets += packets.size() - i;
                 break;
             }
 
@@ -277,70 +361,145 @@ namespace AzNetworking
 
                 timeoutItem->UpdateTimeoutTime(startTimeMs);
 
-                bool handledPacket = false;
-                if (header.GetPacketType() < aznumeric_cast<PacketType>(CorePackets::PacketType::MAX))
-                {
-                    handledPacket = connection->HandleCorePacket(m_connectionListener, header, packetSerializer);
-                }
-                else
-                {
-                    handledPacket = m_connectionListener.OnPacketReceived(connection, header, packetSerializer);
-                }
+                const bool handledPacket = DispatchPacket(*connection, header, packetSerializer);
+                OnPacketDispatched(*connection, header, handledPacket, currentTimeMs);
+            }
+        }
+    }
 
-                if (handledPacket)
-                {
-                    connection->UpdateHeartbeat(currentTimeMs);
-                    if (connection->GetConnectionState() == ConnectionState::Connecting && !connection->GetDtlsEndpoint().IsConnecting())
-                    {
-                        // Connection is realized once a packet is received and socket handshake is verified complete
-                        connection->m_state = ConnectionState::Connected;
-                    }
-                }
-                else if (m_socket->IsEncrypted() && connection->GetDtlsEndpoint().IsConnecting() &&
-                    !IsHandshakePacket(connection->GetDtlsEndpoint(), header.GetPacketType()))
+    void UdpNetworkInterface::ProcessShardPackets(AZ::TimeMs startTimeMs)
+    {
+        uint32_t discardedPackets = 0;
+        uint32_t receivedPackets = 0;
+        for (AZStd::unique_ptr<UdpReceiveShard>& shard : m_receiveShards)
+        {
+            shard->SwapBuffers();
+            const UdpReceiveShard::DecodedPackets& packets = shard->GetDecodedPackets();
+            receivedPackets += aznumeric_cast<uint32_t>(packets.size());
+            for (const UdpReceiveShard::DecodedPacket& packet : packets)
+            {
+                const AZ::TimeMs currentTimeMs = AZ::GetElapsedTimeMs();
+
+                // Don't exceed our timeslice, even if unprocessed data remains
+                // Reassembled packets are always processed, the shard won't produce them a second time if the last chunk is resent
+                if (((currentTimeMs - startTimeMs) > net_UdpPacketTimeSliceMs) && (packet.m_result != UdpReceiveShard::DecodeResult::FragmentComplete))
                 {
-                    // It's possible for one side to finish its half of the handshake and start sending encrypted data
-                    // If it's not an expected unencrypted type then skip it for now
+                    UntrackRejectedConnection(packet);
+                    ++discardedPackets;
                     continue;
                 }
-                else if (connection->GetConnectionState() != ConnectionState::Disconnecting)
-                {
-                    connection->Disconnect(DisconnectReason::StreamError, TerminationEndpoint::Local);
-                }
+
+                ProcessDecodedPacket(packet, startTimeMs, currentTimeMs);
             }
         }
-        const AZ::TimeMs receiveTimeMs = AZ::GetElapsedTimeMs() - startTimeMs;
 
-        // Time out any stale client connections
+        if (discardedPackets > 0)
         {
-            ConnectionTimeoutFunctor functor(*this);
-            m_connectionTimeoutQueue.UpdateTimeouts(functor);
+            AZLOG_WARN("Processing time exceeded, discarding %u/%u received packets", discardedPackets, receivedPackets);
+            GetMetrics().m_discardedPackets += discardedPackets;
         }
+    }
 
-        // Time out any packets that haven't been acked within our timeout window
+    void UdpNetworkInterface::ProcessDecodedPacket(const UdpReceiveShard::DecodedPacket& packet, AZ::TimeMs startTimeMs, AZ::TimeMs currentTimeMs)
+    {
+        UdpConnection* connection = m_connectionSet.GetConnection(packet.m_address);
+        if (connection == nullptr)
         {
-            PacketTimeoutFunctor functor(*this);
-            m_packetTimeoutQueue.UpdateTimeouts(functor, static_cast<int32_t>(net_MaxTimeoutsPerFrame));
+            AcceptConnection(UdpReaderThread::ReceivedPacket(packet.m_address, packet.m_datagram, packet.m_receivedBytes));
+            UntrackRejectedConnection(packet);
+            return;
         }
 
-        // Delete any connections we've disconnected
-        for (RemovedConnection& removedConnection : m_removedConnections)
+        const ConnectionState connectionState = connection->GetConnectionState();
+        if (connectionState == ConnectionState::Disconnecting || connectionState == ConnectionState::Disconnected)
         {
-            m_connectionListener.OnDisconnect(removedConnection.m_connection, removedConnection.m_reason, removedConnection.m_endpoint);
-            m_connectionSet.DeleteConnection(removedConnection.m_connection->GetConnectionId()); // Will delete the connection
+            // Skip packets from disconnected connections
+            return;
         }
-        m_removedConnections.clear();
 
-        // Update metrics
-        GetMetrics().m_sendPackets = m_socket->GetSentPackets();
-        GetMetrics().m_sendBytes = m_socket->GetSentBytes();
-        GetMetrics().m_sendPacketsEncrypted = m_socket->GetSentPacketsEncrypted();
-        GetMetrics().m_sendBytesEncryptionInflation = m_socket->GetSentBytesEncryptionInflation();
-        GetMetrics().m_recvTimeMs += receiveTimeMs;
-        GetMetrics().m_recvPackets = m_socket->GetRecvPackets();
-        GetMetrics().m_recvBytes = m_socket->GetRecvBytes();
-        GetMetrics().m_connectionCount = m_connectionSet.GetConnectionCount();
-        GetMetrics().m_updateTimeMs += AZ::GetElapsedTimeMs() - startTimeMs;
+        connection->GetMetrics().LogPacketRecv(packet.m_receivedBytes + UdpPacketHeaderSize, currentTimeMs);
+        if (packet.m_result == UdpReceiveShard::DecodeResult::Undecoded)
+        {
+            return;
+        }
+        GetMetrics().m_recvBytesUncompressed += packet.m_uncompressedBytes;
+
+        TimeoutQueue::TimeoutItem* timeoutItem = m_connectionTimeoutQueue.RetrieveItem(connection->GetTimeoutId());
+        if (timeoutItem == nullptr)
+        {
+            connection->Disconnect(DisconnectReason::Unknown, TerminationEndpoint::Local);
+            return;
+        }
+
+        // Acks and reliable sequences are applied here, the shard only decoded them
+        UdpPacketHeader header = packet.m_header;
+        NetworkOutputSerializer packetSerializer(packet.m_payload, packet.m_payloadSize);
+        if (!connection->ProcessReceived(header, packetSerializer, packet.m_receivedBytes + UdpPacketHeaderSize, currentTimeMs))
+        {
+            return;
+        }
+
+        timeoutItem->UpdateTimeoutTime(startTimeMs);
+
+        bool handledPacket = false;
+        switch (packet.m_result)
+        {
+        case UdpReceiveShard::DecodeResult::FragmentPending:
+            handledPacket = true;
+            break;
+        case UdpReceiveShard::DecodeResult::FragmentError:
+            handledPacket = false;
+            break;
+        case UdpReceiveShard::DecodeResult::FragmentComplete:
+            {
+                header = packet.m_fragmentHeader;
+                NetworkOutputSerializer fragmentSerializer(packet.m_fragmentPayload, packet.m_fragmentPayloadSize);
+                connection->GetPacketTracker().ProcessReceived(connection, header);
+                handledPacket = DispatchPacket(*connection, header, fragmentSerializer);
+            }
+            break;
+        default:
+            handledPacket = DispatchPacket(*connection, header, packetSerializer);
+            break;
+        }
+        OnPacketDispatched(*connection, header, handledPacket, currentTimeMs);
+    }
+
+    bool UdpNetworkInterface::DispatchPacket(UdpConnection& connection, UdpPacketHeader& header, NetworkOutputSerializer& serializer)
+    {
+        // Bit packed payloads start on the byte following the header
+        NetworkBitOutputSerializer bitSerializer(serializer.GetUnreadData(), serializer.GetUnreadSize());
+        ISerializer& payloadSerializer = header.IsPacketFlagSet(PacketFlag::BitPacked) ? static_cast<ISerializer&>(bitSerializer) : serializer;
+
+        if (header.GetPacketType() < aznumeric_cast<PacketType>(CorePackets::PacketType::MAX))
+        {
+            return connection.HandleCorePacket(m_connectionListener, header, payloadSerializer);
+        }
+        return m_connectionListener.OnPacketReceived(&connection, header, payloadSerializer);
+    }
+
+    void UdpNetworkInterface::OnPacketDispatched(UdpConnection& connection, const UdpPacketHeader& header, bool handledPacket, AZ::TimeMs currentTimeMs)
+    {
+        if (handledPacket)
+        {
+            connection.UpdateHeartbeat(currentTimeMs);
+            if (connection.GetConnectionState() == ConnectionState::Connecting && !connection.GetDtlsEndpoint().IsConnecting())
+            {
+                // Connection is realized once a packet is received and socket handshake is verified complete
+                connection.m_state = ConnectionState::Connected;
+            }
+        }
+        else if (m_socket->IsEncrypted() && connection.GetDtlsEndpoint().IsConnecting() &&
+            !IsHandshakePacket(connection.GetDtlsEndpoint(), header.GetPacketType()))
+        {
+            // It's possible for one side to finish its half of the handshake and start sending encrypted data
+            // If it's not an expected unencrypted type then skip it for now
+            return;
+        }
+        else if (connection.GetConnectionState() != ConnectionState::Disconnecting)
+        {
+            connection.Disconnect(DisconnectReason::StreamError, TerminationEndpoint::Local);
+        }
     }
 
     bool UdpNetworkInterface::SendReliablePacket(ConnectionId connectionId, const IPacket& packet)
@@ -381,6 +540,7 @@ namespace AzNetworking
         }
 
         m_port = 0;
+        CloseReceiveShards();
         m_readerThread.UnregisterSocket(m_socket.get());
         m_allowIncomingConnections = false;
         m_socket->Close();
@@ -503,6 +663,7 @@ namespace AzNetworking
         UdpPacketEncodingBuffer buffer;
         {
             buffer.Resize(buffer.GetCapacity());
+            header.SetPacketFlag(PacketFlag::BitPacked, packet.IsBitPacked());
 
             NetworkInputSerializer networkSerializer(buffer.GetBuffer(), static_cast<uint32_t>(buffer.GetCapacity()));
             ISerializer& serializer = networkSerializer; // To get the default typeinfo parameters in ISerializer
@@ -519,13 +680,18 @@ namespace AzNetworking
                 return InvalidPacketId;
             }
 
-            if (!serializer.Serialize(const_cast<IPacket&>(packet), "Payload"))
+            // The flags and header are always byte aligned, bit packed payloads start on the following byte
+            const uint32_t headerSize = serializer.GetSize();
+            NetworkBitInputSerializer bitSerializer(buffer.GetBuffer() + headerSize, static_cast<uint32_t>(buffer.GetCapacity()) - headerSize);
+            ISerializer& payloadSerializer = header.IsPacketFlagSet(PacketFlag::BitPacked) ? static_cast<ISerializer&>(bitSerializer) : serializer;
+
+            if (!payloadSerializer.Serialize(const_cast<IPacket&>(packet), "Payload"))
             {
                 AZLOG_ERROR("PacketId %u failed payload serialization and will not be sent", aznumeric_cast<uint32_t>(localPacketId));
                 return InvalidPacketId;
             }
 
-            buffer.Resize(serializer.GetSize());
+            buffer.Resize((&payloadSerializer == &serializer) ? serializer.GetSize() : headerSize + bitSerializer.GetSize());
         }
         uint32_t packetSize = static_cast<uint32_t>(buffer.GetSize());
         uint8_t* packetData = buffer.GetBuffer();
@@ -621,6 +787,76 @@ namespace AzNetworking
         return InvalidPacketId;
     }
 
+    bool UdpNetworkInterface::OpenReceiveShards(uint32_t shardCount)
+    {
+        const AZ::CVarFixedString compressor = static_cast<AZ::CVarFixedString>(net_UdpCompressor);
+        const AZ::Name compressorName = AZ::Name(compressor);
+        for (uint32_t i = 0; i < shardCount; ++i)
+        {
+            // The first shard reads our own socket, the rest open additional sockets the kernel spreads incoming packets across
+            UdpSocket* shardSocket = m_socket.get();
+            if (i > 0)
+            {
+                AZStd::unique_ptr<UdpSocket> socket = AZStd::make_unique<UdpSocket>();
+                socket->SetReusePortEnabled(true);
+                if (!socket->Open(m_port, UdpSocket::CanAcceptConnections::True, m_trustZone))
+                {
+                    AZLOG_ERROR("Failed to open Udp receive shard %u on port %u", i, aznumeric_cast<uint32_t>(m_port));
+                    CloseReceiveShards();
+                    m_socket->Close();
+                    return false;
+                }
+                shardSocket = socket.get();
+                m_shardSockets.emplace_back(AZStd::move(socket));
+            }
+
+            m_receiveShards.emplace_back(AZStd::make_unique<UdpReceiveShard>(*shardSocket, AZ::Interface<INetworking>::Get()->CreateCompressor(compressorName)));
+        }
+
+        for (AZStd::unique_ptr<UdpReceiveShard>& shard : m_receiveShards)
+        {
+            shard->Start();
+        }
+        return true;
+    }
+
+    void UdpNetworkInterface::CloseReceiveShards()
+    {
+        // Shards have to be stopped before the sockets they read from are closed
+        m_receiveShards.clear();
+        for (AZStd::unique_ptr<UdpSocket>& shardSocket : m_shardSockets)
+        {
+            shardSocket->Close();
+        }
+        m_shardSockets.clear();
+    }
+
+    void UdpNetworkInterface::UpdateReceiveShards(const IpAddress& address, bool connected)
+    {
+        for (AZStd::unique_ptr<UdpReceiveShard>& shard : m_receiveShards)
+        {
+            if (connected)
+            {
+                shard->AddConnection(address);
+            }
+            else
+            {
+                shard->RemoveConnection(address);
+            }
+        }
+    }
+
+    void UdpNetworkInterface::UntrackRejectedConnection(const UdpReceiveShard::DecodedPacket& packet)
+    {
+        if ((packet.m_result == UdpReceiveShard::DecodeResult::Decoded) &&
+            (packet.m_header.GetPacketType() == aznumeric_cast<PacketType>(CorePackets::PacketType::InitiateConnectionPacket)) &&
+            (m_connectionSet.GetConnection(packet.m_address) == nullptr))
+        {
+            // The shard started tracking this address when it decoded the connection request, but no connection was created
+            UpdateReceiveShards(packet.m_address, false);
+        }
+    }
+
     void UdpNetworkInterface::AcceptConnection(const UdpReaderThread::ReceivedPacket& connectPacket)
     {
         if (!m_allowIncomingConnections)
@@ -684,6 +920,7 @@ namespace AzNetworking
         // Transition state based on our how our socket resolved
         connection->m_state = result == DtlsEndpoint::ConnectResult::Complete ? ConnectionState::Connected : ConnectionState::Connecting;
         connection->SetTimeoutId(timeoutId);
+        UpdateReceiveShards(connectPacket.m_address, true);
         m_connectionListener.OnConnect(connection.get());
         m_connectionSet.AddConnection(AZStd::move(connection));
     }
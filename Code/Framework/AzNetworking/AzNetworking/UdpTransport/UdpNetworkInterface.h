@@ -11,6 +11,7 @@
 #include <AzNetworking/UdpTransport/UdpPacketHeader.h>
 #include <AzNetworking/UdpTransport/UdpConnectionSet.h>
 #include <AzNetworking/UdpTransport/UdpReaderThread.h>
+#include <AzNetworking/UdpTransport/UdpReceiveShard.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzNetworking/ConnectionLayer/ConnectionEnums.h>
 #include <AzNetworking/Framework/INetworkInterface.h>
@@ -22,6 +23,7 @@ namespace AzNetworking
 {
     class IConnectionListener;
     class ICompressor;
+    class NetworkOutputSerializer;
 
     static const uint32_t UdpPacketHeaderSize = 20 + 8; //!< 20 byte IPv4 header + 8 byte UDP header
     static const uint32_t DtlsPacketHeaderSize = 13; //!< DTLS1_RT_HEADER_LENGTH
@@ -51,7 +53,13 @@ namespace AzNetworking
     //! UDP packets can be sent reliably or unreliably. Reliably sent packets are registered for tracking first. This causes the
     //! reliable packet to be resent if a timeout on the packet is reached. Once the packet is acknowledged, the packet is
     //! unregistered.
-    //! 
+    //!
+    //! ### Bit packing
+    //!
+    //! Packets that return true from IPacket::IsBitPacked have their payload written with a NetworkBitInputSerializer, which uses
+    //! only the bits needed for the declared range of each value. The Flags and Header remain byte aligned, and the Sender sets a
+    //! bit in the packet's Flags so the Receiver knows to read the payload with a NetworkBitOutputSerializer.
+    //!
     //! ### Fragmentation
     //! 
     //! If the raw packet size exceeds the configured maximum transmission unit (MTU) then the packet is broken into
@@ -75,6 +83,13 @@ namespace AzNetworking
     //! AzNetworking uses the [OpenSSL](https://www.openssl.org/) library to implement Datagram Layer Transport Security (DTLS) encryption
     //! on UDP traffic. Encryption operates as described in [O3DE Networking Encryption](http://o3de.org/docs/user-guide/networking/encryption)
     //! on the documentation website. Once both endpoints have completed their handshake, all traffic is expected to be fully encrypted.
+    //! 
+    //! ### Receive shards
+    //! 
+    //! By default all UDP network interfaces share a single reader thread and decode every packet on the game thread. When
+    //! net_UdpReceiveShards is set, an unencrypted interface listening on a fixed port instead opens that many sockets on its port
+    //! with SO_REUSEPORT, each serviced by its own UdpReceiveShard thread. Shards decompress packets, deserialize their headers and
+    //! reassemble fragmented packets, leaving only the connection state updates and packet dispatch to the game thread.
     class UdpNetworkInterface final
         : public INetworkInterface
     {
@@ -139,6 +154,54 @@ namespace AzNetworking
         //! @return packet id for the transmitted packet
         PacketId SendPacket(UdpConnection& connection, const IPacket& packet, SequenceId reliableSequence);
 
+        //! Opens the additional sockets and starts the receive shards for a listening interface.
+        //! @param shardCount the number of receive shards to start
+        //! @return boolean true on success, false on failure
+        bool OpenReceiveShards(uint32_t shardCount);
+
+        //! Stops the receive shards and closes their sockets.
+        void CloseReceiveShards();
+
+        //! Notifies all receive shards that a connection was added or removed.
+        //! @param address   the remote address of the connection
+        //! @param connected true if the connection was added, false if it was removed
+        void UpdateReceiveShards(const IpAddress& address, bool connected);
+
+        //! Stops the receive shards tracking the sender of a decoded connection request that did not create a connection.
+        //! Requests that are rejected or discarded unprocessed would otherwise stay tracked by every shard.
+        //! @param packet the decoded packet, ignored unless it is a connection request from an unconnected address
+        void UntrackRejectedConnection(const UdpReceiveShard::DecodedPacket& packet);
+
+        //! Processes the packets the reader thread received on our socket.
+        //! @param packets     the received packets
+        //! @param startTimeMs the time the current update started
+        void ProcessReceivedPackets(const UdpReaderThread::ReceivedPackets& packets, AZ::TimeMs startTimeMs);
+
+        //! Processes the packets decoded by the receive shards.
+        //! @param startTimeMs the time the current update started
+        void ProcessShardPackets(AZ::TimeMs startTimeMs);
+
+        //! Applies a packet decoded by a receive shard to its connection and dispatches it.
+        //! @param packet        the decoded packet
+        //! @param startTimeMs   the time the current update started
+        //! @param currentTimeMs the current time
+        void ProcessDecodedPacket(const UdpReceiveShard::DecodedPacket& packet, AZ::TimeMs startTimeMs, AZ::TimeMs currentTimeMs);
+
+        //! Hands a received packet to the connection for core packets, or to the connection listener.
+        //! Payloads flagged with PacketFlag::BitPacked are read with a NetworkBitOutputSerializer.
+        //! @param connection the connection the packet was received on
+        //! @param header     the packet header
+        //! @param serializer the serializer positioned at the start of the packet payload
+        //! @return boolean true if the packet was handled
+        bool DispatchPacket(UdpConnection& connection, UdpPacketHeader& header, NetworkOutputSerializer& serializer);
+
+        //! Updates the connection state after a received packet was dispatched.
+        //! @param connection    the connection the packet was received on
+        //! @param header        the packet header
+        //! @param handledPacket the result of dispatching the packet
+        //! @param currentTimeMs the current time
+        void OnPacketDispatched(UdpConnection& connection, const UdpPacketHeader& header, bool handledPacket, AZ::TimeMs currentTimeMs);
+
         //! Accepts an incoming udp connection.
         //! @param connectPacket the initial connectPacket
         void AcceptConnection(const UdpReaderThread::ReceivedPacket& connectPacket);
@@ -189,6 +252,8 @@ namespace AzNetworking
         AZStd::unique_ptr<UdpSocket> m_socket;
         AZStd::unique_ptr<ICompressor> m_compressor;
         UdpReaderThread& m_readerThread;
+        AZStd::vector<AZStd::unique_ptr<UdpSocket>> m_shardSockets; //!< Sockets of all receive shards but the first, which reads m_socket.
+        AZStd::vector<AZStd::unique_ptr<UdpReceiveShard>> m_receiveShards;
 
         struct RemovedConnection
         {
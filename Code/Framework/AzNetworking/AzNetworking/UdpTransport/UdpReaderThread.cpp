@@ -185,6 +185,15 @@ namespace AzNetworking
                     break;
                 }
 
+                if (socket->IsBatchedIoEnabled())
+                {
+                    if (!ReceiveBatch(*socket, receiveBuffer, receivedPackets))
+                    {
+                        break;
+                    }
+                    continue;
+                }
+
                 uint8_t* dstData = receiveBuffer.GetBufferEnd();
                 receiveBuffer.Resize(bufferHead + MaxUdpTransmissionUnit);
 
@@ -204,6 +213,49 @@ namespace AzNetworking
         m_updateTimeMs += AZ::GetElapsedTimeMs() - startTimeMs;
     }
 
+    bool UdpReaderThread::ReceiveBatch(UdpSocket& socket, ByteBuffer<MaxUdpReceiveBufferSize>& receiveBuffer, ReceivedPackets& receivedPackets)
+    {
+        // Receive as many packets as both the receive buffer and the packet list have room for, leaving the rest on the socket
+        const uint32_t bufferHead = static_cast<uint32_t>(receiveBuffer.GetSize());
+        const uint32_t freeSlots = static_cast<uint32_t>(receiveBuffer.GetCapacity() - bufferHead) / MaxUdpTransmissionUnit;
+        const uint32_t freePackets = static_cast<uint32_t>(receivedPackets.capacity() - receivedPackets.size());
+        const uint32_t batchCount = AZStd::min(AZStd::min(freeSlots, freePackets), UdpSocket::MaxReceiveBatchCount);
+        if (batchCount == 0)
+        {
+            AZLOG_INFO("Received packet list full, leaving data on the socket");
+            return false;
+        }
+
+        IpAddress addresses[UdpSocket::MaxReceiveBatchCount];
+        int32_t receivedBytes[UdpSocket::MaxReceiveBatchCount];
+        uint8_t* dstData = receiveBuffer.GetBufferEnd();
+        receiveBuffer.Resize(bufferHead + batchCount * MaxUdpTransmissionUnit);
+
+        const int32_t receivedCount = socket.ReceiveBatch(addresses, receivedBytes, dstData, MaxUdpTransmissionUnit, batchCount);
+
+        // Each packet was received into its own MTU sized slot, compact them so the unused tail of each slot can be reused
+        uint32_t bufferTail = bufferHead;
+        for (int32_t i = 0; i < receivedCount; ++i)
+        {
+            if (receivedBytes[i] <= 0)
+            {
+                continue;
+            }
+            uint8_t* packetData = receiveBuffer.GetBuffer() + bufferTail;
+            const uint8_t* slotData = dstData + i * MaxUdpTransmissionUnit;
+            if (packetData != slotData)
+            {
+                memmove(packetData, slotData, receivedBytes[i]);
+            }
+            receivedPackets.push_back(ReceivedPacket(addresses[i], packetData, receivedBytes[i]));
+            bufferTail += receivedBytes[i];
+        }
+        receiveBuffer.Resize(bufferTail);
+
+        // A partial batch means the socket has been drained
+        return receivedCount == static_cast<int32_t>(batchCount);
+    }
+
     UdpReaderThread::ReceivedPacket::ReceivedPacket(const IpAddress& address, const uint8_t* buffer, int32_t receivedBytes)
         : m_address(address)
         , m_buffer(buffer)
@@ -76,6 +76,10 @@ namespace AzNetworking
         void OnStop() override;
         void OnUpdate(AZ::TimeMs updateRateMs) override;
 
+        //! Reads a batch of packets off a socket with batched I/O enabled into the receive buffer.
+        //! @return boolean true if the batch was filled and more data may be waiting on the socket
+        static bool ReceiveBatch(UdpSocket& socket, ByteBuffer<MaxUdpReceiveBufferSize>& receiveBuffer, ReceivedPackets& receivedPackets);
+
         AZ_DISABLE_COPY_MOVE(UdpReaderThread);
 
         struct SocketEntry
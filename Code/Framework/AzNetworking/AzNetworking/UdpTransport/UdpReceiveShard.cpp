@@ -0,0 +1,292 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/UdpTransport/UdpReceiveShard.h>
+#include <AzNetworking/UdpTransport/UdpFragmentQueue.h>
+#include <AzNetworking/UdpTransport/UdpSocket.h>
+#include <AzNetworking/Serialization/NetworkOutputSerializer.h>
+#include <AzNetworking/Framework/ICompressor.h>
+#include <AzNetworking/Utilities/NetworkCommon.h>
+#include <AzCore/Console/ILogger.h>
+
+namespace AzNetworking
+{
+    static constexpr AZ::TimeMs ReceiveShardUpdateRateMs{ 10 };
+
+    UdpReceiveShard::UdpReceiveShard(UdpSocket& socket, AZStd::unique_ptr<ICompressor> compressor)
+        : TimedThread("UdpReceiveShard", ReceiveShardUpdateRateMs)
+        , m_socket(socket)
+        , m_compressor(AZStd::move(compressor))
+    {
+        ;
+    }
+
+    UdpReceiveShard::~UdpReceiveShard()
+    {
+        Stop();
+        Join();
+    }
+
+    void UdpReceiveShard::AddConnection(const IpAddress& address)
+    {
+        AZStd::scoped_lock<AZStd::mutex> lock(m_connectionMutex);
+        m_pendingConnectionChanges.push_back(ConnectionChange{ address, true });
+    }
+
+    void UdpReceiveShard::RemoveConnection(const IpAddress& address)
+    {
+        AZStd::scoped_lock<AZStd::mutex> lock(m_connectionMutex);
+        m_pendingConnectionChanges.push_back(ConnectionChange{ address, false });
+    }
+
+    void UdpReceiveShard::SwapBuffers()
+    {
+        {
+            // This scope is sync-safe between the game and shard threads
+            AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+            m_backIndex = 1 - m_backIndex;
+
+            // Clear all the packets we've already processed on the game thread
+            ShardBuffer& back = m_shardBuffers[m_backIndex];
+            back.m_packets.clear();
+            back.m_decodeBuffer.clear();
+            back.m_usedSlots = 0;
+        }
+
+        // The shard no longer appends to the front decode buffer, so pointers into it are stable until the next swap
+        ShardBuffer& front = m_shardBuffers[1 - m_backIndex];
+        for (DecodedPacket& packet : front.m_packets)
+        {
+            if (packet.m_payloadOffset != DecodedPacket::InvalidOffset)
+            {
+                packet.m_payload = front.m_decodeBuffer.data() + packet.m_payloadOffset;
+            }
+            if (packet.m_fragmentPayloadOffset != DecodedPacket::InvalidOffset)
+            {
+                packet.m_fragmentPayload = front.m_decodeBuffer.data() + packet.m_fragmentPayloadOffset;
+            }
+        }
+    }
+
+    const UdpReceiveShard::DecodedPackets& UdpReceiveShard::GetDecodedPackets() const
+    {
+        return m_shardBuffers[1 - m_backIndex].m_packets;
+    }
+
+    AZ::TimeMs UdpReceiveShard::GetUpdateTimeMs() const
+    {
+        return m_updateTimeMs;
+    }
+
+    void UdpReceiveShard::OnStart()
+    {
+        ;
+    }
+
+    void UdpReceiveShard::OnStop()
+    {
+        ;
+    }
+
+    void UdpReceiveShard::OnUpdate(AZ::TimeMs updateRateMs)
+    {
+        const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
+
+        UpdateConnections();
+        for (auto& fragmentQueue : m_fragmentQueues)
+        {
+            fragmentQueue.second->Update();
+        }
+
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+        ShardBuffer& back = m_shardBuffers[m_backIndex];
+        for (;;)
+        {
+            const AZ::TimeMs elapsedTimeMs = AZ::GetElapsedTimeMs() - startTimeMs;
+            if (elapsedTimeMs > updateRateMs)
+            {
+                AZLOG_INFO("UdpReceiveShard bled %d ms", aznumeric_cast<int32_t>(elapsedTimeMs - updateRateMs));
+                break;
+            }
+
+            const uint32_t freeSlots = MaxUdpReceivePacketCount - back.m_usedSlots;
+            const uint32_t batchCount = AZStd::min(freeSlots, UdpSocket::MaxReceiveBatchCount);
+            if (batchCount == 0)
+            {
+                AZLOG_INFO("Decoded packet list full, leaving data on the socket");
+                break;
+            }
+
+            IpAddress addresses[UdpSocket::MaxReceiveBatchCount];
+            int32_t receivedBytes[UdpSocket::MaxReceiveBatchCount];
+            uint8_t* dstData = back.m_receiveBuffer.GetBuffer() + back.m_usedSlots * MaxUdpTransmissionUnit;
+            const int32_t receivedCount = m_socket.ReceiveBatch(addresses, receivedBytes, dstData, MaxUdpTransmissionUnit, batchCount);
+
+            for (int32_t i = 0; i < receivedCount; ++i)
+            {
+                if (receivedBytes[i] <= 0)
+                {
+                    continue;
+                }
+                DecodedPacket& packet = back.m_packets.emplace_back();
+                packet.m_address = addresses[i];
+                packet.m_datagram = dstData + i * MaxUdpTransmissionUnit;
+                packet.m_receivedBytes = receivedBytes[i];
+                DecodePacket(back, packet);
+            }
+            back.m_usedSlots += AZStd::max(receivedCount, 0);
+
+            // A partial batch means the socket has been drained
+            if (receivedCount < static_cast<int32_t>(batchCount))
+            {
+                break;
+            }
+        }
+        m_updateTimeMs += AZ::GetElapsedTimeMs() - startTimeMs;
+    }
+
+    void UdpReceiveShard::UpdateConnections()
+    {
+        {
+            AZStd::scoped_lock<AZStd::mutex> lock(m_connectionMutex);
+            m_connectionChanges.swap(m_pendingConnectionChanges);
+        }
+
+        for (const ConnectionChange& change : m_connectionChanges)
+        {
+            if (!change.m_connected)
+            {
+                m_fragmentQueues.erase(change.m_address);
+            }
+            else if (m_fragmentQueues.find(change.m_address) == m_fragmentQueues.end())
+            {
+                m_fragmentQueues.emplace(change.m_address, AZStd::make_unique<UdpFragmentQueue>());
+            }
+        }
+        m_connectionChanges.clear();
+    }
+
+    void UdpReceiveShard::DecodePacket(ShardBuffer& buffer, DecodedPacket& packet)
+    {
+        const uint8_t* packetData = packet.m_datagram;
+        uint32_t packetSize = static_cast<uint32_t>(packet.m_receivedBytes);
+
+        // Decode the packet flag bitset first since it's always uncompressed
+        {
+            NetworkOutputSerializer flagSerializer(packetData, packetSize);
+            if (!packet.m_header.SerializePacketFlags(flagSerializer))
+            {
+                return;
+            }
+            packetData = flagSerializer.GetUnreadData();
+            packetSize = flagSerializer.GetUnreadSize();
+            packet.m_uncompressedBytes = flagSerializer.GetReadSize();
+        }
+
+        const bool decompressed = m_compressor && packet.m_header.IsPacketFlagSet(PacketFlag::Compressed);
+        if (decompressed)
+        {
+            // Only the payload is compressed
+            if (!DecompressPacket(packetData, packetSize, m_decompressBuffer))
+            {
+                AZLOG_WARN("Failed to decompress packet!");
+                return;
+            }
+            packetData = m_decompressBuffer.GetBuffer();
+            packetSize = static_cast<uint32_t>(m_decompressBuffer.GetSize());
+        }
+        packet.m_uncompressedBytes += packetSize;
+
+        NetworkOutputSerializer packetSerializer(packetData, packetSize);
+        if (!static_cast<ISerializer&>(packetSerializer).Serialize(packet.m_header, "Header"))
+        {
+            return;
+        }
+
+        // Payloads still in the datagram can be referenced directly, decompressed ones are copied out before the next packet reuses the buffer
+        packet.m_payloadSize = packetSerializer.GetUnreadSize();
+        if (decompressed)
+        {
+            packet.m_payloadOffset = static_cast<uint32_t>(buffer.m_decodeBuffer.size());
+            buffer.m_decodeBuffer.insert(buffer.m_decodeBuffer.end(), packetSerializer.GetUnreadData(), packetSerializer.GetUnreadData() + packet.m_payloadSize);
+        }
+        else
+        {
+            packet.m_payload = packetSerializer.GetUnreadData();
+        }
+        packet.m_result = DecodeResult::Decoded;
+
+        const PacketType packetType = packet.m_header.GetPacketType();
+        auto fragmentQueue = m_fragmentQueues.find(packet.m_address);
+        if (packetType == aznumeric_cast<PacketType>(CorePackets::PacketType::InitiateConnectionPacket))
+        {
+            // Start tracking the address right away, so chunks sent right after the connection request aren't split between
+            // this shard and the connection's own fragment queue. The game thread removes the address again if it rejects or discards the request.
+            if (fragmentQueue == m_fragmentQueues.end())
+            {
+                m_fragmentQueues.emplace(packet.m_address, AZStd::make_unique<UdpFragmentQueue>());
+            }
+            return;
+        }
+
+        if (packetType != aznumeric_cast<PacketType>(CorePackets::PacketType::FragmentedPacket) || fragmentQueue == m_fragmentQueues.end())
+        {
+            // Chunks from untracked addresses are reassembled by the connection on the game thread
+            return;
+        }
+
+        switch (fragmentQueue->second->ReassembleChunk(packet.m_header, packetSerializer, m_reassembleBuffer))
+        {
+        case ReassembleResult::Error:
+            packet.m_result = DecodeResult::FragmentError;
+            return;
+        case ReassembleResult::Pending:
+            packet.m_result = DecodeResult::FragmentPending;
+            return;
+        case ReassembleResult::Complete:
+            break;
+        }
+
+        NetworkOutputSerializer fragmentSerializer(m_reassembleBuffer.GetBuffer(), static_cast<uint32_t>(m_reassembleBuffer.GetSize()));
+        if (!packet.m_fragmentHeader.SerializePacketFlags(fragmentSerializer) ||
+            !static_cast<ISerializer&>(fragmentSerializer).Serialize(packet.m_fragmentHeader, "Header"))
+        {
+            AZLOG(NET_FragmentQueue, "Reconstructed fragmented packet failed header serialization");
+            packet.m_result = DecodeResult::FragmentError;
+            return;
+        }
+
+        packet.m_fragmentPayloadSize = fragmentSerializer.GetUnreadSize();
+        packet.m_fragmentPayloadOffset = static_cast<uint32_t>(buffer.m_decodeBuffer.size());
+        buffer.m_decodeBuffer.insert(buffer.m_decodeBuffer.end(), fragmentSerializer.GetUnreadData(), fragmentSerializer.GetUnreadData() + packet.m_fragmentPayloadSize);
+        packet.m_result = DecodeResult::FragmentComplete;
+    }
+
+    bool UdpReceiveShard::DecompressPacket(const uint8_t* packetBuffer, size_t packetSize, UdpPacketEncodingBuffer& packetBufferOut) const
+    {
+        AZStd::size_t uncompSize = 0;
+        AZStd::size_t bytesConsumed = 0;
+
+        packetBufferOut.Resize(packetBufferOut.GetCapacity());
+        const CompressorError compErr = m_compressor->Decompress(packetBuffer, packetSize, packetBufferOut.GetBuffer(), packetBufferOut.GetCapacity(), bytesConsumed, uncompSize);
+        packetBufferOut.Resize(aznumeric_cast<uint32_t>(uncompSize)); // Decompress will fail if larger than buffer size, so this cast is safe
+
+        if (compErr != CompressorError::Ok)
+        {
+            AZLOG_ERROR("Decompress failed with error %d this will lead to data read errors!", compErr);
+            return false;
+        }
+
+        if (packetSize != bytesConsumed)
+        {
+            AZLOG_ERROR("Decompress must consume entire buffer [%zu != %zu]!", bytesConsumed, packetSize);
+            return false;
+        }
+        return true;
+    }
+}
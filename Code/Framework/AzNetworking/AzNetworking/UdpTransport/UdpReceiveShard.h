@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzNetworking/UdpTransport/UdpPacketHeader.h>
+#include <AzNetworking/UdpTransport/UdpReaderThread.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace AzNetworking
+{
+    // Forwards
+    class ICompressor;
+    class UdpFragmentQueue;
+    class UdpSocket;
+
+    //! @class UdpReceiveShard
+    //! @brief Reads and decodes the packets received on one unencrypted UDP socket on a dedicated thread.
+    //!
+    //! A listening UdpNetworkInterface can open several sockets on the same port with SO_REUSEPORT, so the kernel spreads incoming
+    //! datagrams across them by sender address, and service each with its own shard. Besides reading the socket, a shard decompresses
+    //! each packet, deserializes its flags and header (including the ack bitfield) and reassembles fragmented packets, so the game
+    //! thread only applies the already decoded headers to the connections and dispatches the payloads.
+    class UdpReceiveShard final
+        : public TimedThread
+    {
+    public:
+
+        static constexpr uint32_t MaxUdpReceivePacketCount = UdpReaderThread::MaxUdpReceivePacketCount;
+        static constexpr uint32_t MaxUdpReceiveBufferSize = UdpReaderThread::MaxUdpReceiveBufferSize;
+
+        enum class DecodeResult
+        {
+            Undecoded,        //!< Flags or header failed to decode, only the raw datagram is valid
+            Decoded,          //!< m_header, m_payload and m_payloadSize describe the packet
+            FragmentPending,  //!< The packet was a chunk of a fragmented packet that isn't complete yet
+            FragmentComplete, //!< The packet was the last missing chunk, m_fragmentHeader and m_fragmentPayload describe the reassembled packet
+            FragmentError     //!< The packet was a malformed chunk of a fragmented packet
+        };
+
+        struct DecodedPacket
+        {
+            IpAddress m_address;
+            const uint8_t* m_datagram = nullptr;
+            int32_t m_receivedBytes = 0;
+            DecodeResult m_result = DecodeResult::Undecoded;
+            uint32_t m_uncompressedBytes = 0; //!< Size of the flags and the decompressed header and payload.
+            UdpPacketHeader m_header;
+            const uint8_t* m_payload = nullptr; //!< Packet data following the header.
+            uint32_t m_payloadSize = 0;
+            UdpPacketHeader m_fragmentHeader;
+            const uint8_t* m_fragmentPayload = nullptr; //!< Reassembled packet data following the reassembled header.
+            uint32_t m_fragmentPayloadSize = 0;
+
+        private:
+            friend class UdpReceiveShard;
+            static constexpr uint32_t InvalidOffset = 0xFFFFFFFF;
+            uint32_t m_payloadOffset = InvalidOffset; //!< Offset of m_payload in the decode buffer while it may still grow.
+            uint32_t m_fragmentPayloadOffset = InvalidOffset; //!< Offset of m_fragmentPayload in the decode buffer while it may still grow.
+        };
+
+        using DecodedPackets = AZStd::fixed_vector<DecodedPacket, MaxUdpReceivePacketCount>;
+
+        //! Constructor.
+        //! @param socket     the open socket to read from, must outlive the shard
+        //! @param compressor the compressor used to decompress packets, this must be a separate instance per shard
+        UdpReceiveShard(UdpSocket& socket, AZStd::unique_ptr<ICompressor> compressor);
+        ~UdpReceiveShard() override;
+
+        //! Notifies the shard that a connection to the given address was established, chunks of fragmented packets from it are
+        //! reassembled by the shard from now on. Shards also start tracking addresses they see connection requests from.
+        //! @param address the remote address of the connection
+        void AddConnection(const IpAddress& address);
+
+        //! Notifies the shard that the connection to the given address was removed or rejected.
+        //! @param address the remote address of the connection
+        void RemoveConnection(const IpAddress& address);
+
+        //! Should be called on the game thread immediately before processing the decoded packets.
+        void SwapBuffers();
+
+        //! Returns the packets decoded by the shard before the last call to SwapBuffers().
+        //! @return the packets decoded by the shard before the last call to SwapBuffers()
+        const DecodedPackets& GetDecodedPackets() const;
+
+        //! Gets the total elapsed time spent updating the shard thread in milliseconds
+        //! @return the total elapsed time spent updating the shard thread in milliseconds
+        AZ::TimeMs GetUpdateTimeMs() const;
+
+    private:
+
+        struct ShardBuffer
+        {
+            ByteBuffer<MaxUdpReceiveBufferSize> m_receiveBuffer; //!< One MTU sized slot per received datagram.
+            uint32_t m_usedSlots = 0;
+            AZStd::vector<uint8_t> m_decodeBuffer; //!< Decompressed and reassembled payloads.
+            DecodedPackets m_packets;
+        };
+
+        void OnStart() override;
+        void OnStop() override;
+        void OnUpdate(AZ::TimeMs updateRateMs) override;
+
+        //! Applies connection changes requested by the game thread.
+        void UpdateConnections();
+
+        //! Decodes a received datagram, appending any decompressed or reassembled data to the buffer's decode buffer.
+        void DecodePacket(ShardBuffer& buffer, DecodedPacket& packet);
+
+        //! Decompresses a packet payload.
+        bool DecompressPacket(const uint8_t* packetBuffer, size_t packetSize, UdpPacketEncodingBuffer& packetBufferOut) const;
+
+        AZ_DISABLE_COPY_MOVE(UdpReceiveShard);
+
+        UdpSocket& m_socket;
+        AZStd::unique_ptr<ICompressor> m_compressor;
+
+        AZStd::mutex m_mutex;
+        int32_t m_backIndex = 0;
+        AZStd::array<ShardBuffer, 2> m_shardBuffers;
+        AZ::TimeMs m_updateTimeMs = AZ::TimeMs{ 0 };
+
+        struct ConnectionChange
+        {
+            IpAddress m_address;
+            bool m_connected;
+        };
+
+        AZStd::mutex m_connectionMutex;
+        AZStd::vector<ConnectionChange> m_pendingConnectionChanges; //!< Protected by m_connectionMutex.
+
+        // Only accessed by the shard thread
+        AZStd::unordered_map<IpAddress, AZStd::unique_ptr<UdpFragmentQueue>> m_fragmentQueues;
+        AZStd::vector<ConnectionChange> m_connectionChanges;
+        UdpPacketEncodingBuffer m_decompressBuffer;
+        UdpPacketEncodingBuffer m_reassembleBuffer;
+    };
+}
@@ -23,6 +23,46 @@ namespace AzNetworking
     AZ_CVAR(int32_t, net_UdpSendBufferSize, 1 * 1024 * 1024, nullptr, AZ::ConsoleFunctorFlags::Null, "Default UDP socket send buffer size");
     AZ_CVAR(int32_t, net_UdpRecvBufferSize, 1 * 1024 * 1024, nullptr, AZ::ConsoleFunctorFlags::Null, "Default UDP socket receive buffer size");
     AZ_CVAR(bool, net_UdpIgnoreWin10054, true, nullptr, AZ::ConsoleFunctorFlags::Null, "If true, will ignore 10054 socket errors on windows");
+    AZ_CVAR(bool, net_UdpBatchedIo, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "If true, UDP sockets send and receive datagrams in batches where supported to reduce system calls, sends are deferred until the network interface updates");
+    AZ_CVAR(bool, net_UdpSegmentationOffload, true, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "If true, batched UDP sends coalesce equally sized datagrams to the same address into a single segmentation offload send where supported");
+
+#if AZ_TRAIT_USE_SOCKET_BATCHED_IO
+    // Maximum number of messages handed to a single sendmmsg call
+    static constexpr uint32_t MaxSendBatchCount = 64;
+    // Older kernels reject segmented sends with more than 64 segments (UDP_MAX_SEGMENTS)
+    static constexpr uint32_t MaxSegmentsPerSend = 64;
+    // Segmented sends are a single UDP datagram to the kernel and have to stay below the 64KiB datagram limit
+    static constexpr uint32_t MaxSegmentedSendBytes = 60 * 1024;
+#endif
+
+    // Returns the value to report for a failed receive, logging any unexpected errors
+    static int32_t HandleReceiveError()
+    {
+        const int32_t error = GetLastNetworkError();
+
+        if (ErrorIsWouldBlock(error)) // Filter would block messages
+        {
+            return 0;
+        }
+
+        bool ignoreForciblyClosedError = false;
+        if (ErrorIsForciblyClosed(error, ignoreForciblyClosedError))
+        {
+            if (ignoreForciblyClosedError)
+            {
+                return 0;
+            }
+            else
+            {
+                return SocketOpResultError;
+            }
+        }
+
+        AZLOG_ERROR("Failed to read from socket (%d:%s)", error, GetNetworkErrorDesc(error));
+        return 0;
+    }
 
     UdpSocket::~UdpSocket()
     {
@@ -68,6 +108,19 @@ namespace AzNetworking
             }
         }
 
+#if AZ_TRAIT_USE_SOCKET_REUSE_PORT
+        if (m_reusePort)
+        {
+            const int32_t enable = 1;
+            if (::setsockopt(static_cast<int32_t>(m_socketFd), SOL_SOCKET, SO_REUSEPORT, &enable, sizeof(enable)) != 0)
+            {
+                const int32_t error = GetLastNetworkError();
+                AZLOG_ERROR("Failed to enable port reuse on UDP socket (%d:%s)", error, GetNetworkErrorDesc(error));
+                return false;
+            }
+        }
+#endif
+
         // Handle binding
         {
             sockaddr_in hints;
@@ -93,11 +146,13 @@ namespace AzNetworking
             return false;
         }
 
+        SetBatchedIoEnabled(net_UdpBatchedIo);
         return true;
     }
 
     void UdpSocket::Close()
     {
+        FlushSends();
         CloseSocket(m_socketFd);
         m_socketFd = InvalidSocketFd;
     }
@@ -188,48 +243,257 @@ namespace AzNetworking
         sockaddr_in from;
         socklen_t   fromLen = sizeof(from);
 
+        ++m_recvCalls;
         const int32_t receivedBytes = recvfrom(static_cast<int32_t>(m_socketFd), reinterpret_cast<char*>(outData), static_cast<int32_t>(size), 0, (sockaddr*)&from, &fromLen);
 
         outAddress = IpAddress(ByteOrder::Network, from.sin_addr.s_addr, from.sin_port);
 
         if (receivedBytes < 0)
         {
-            const int32_t error = GetLastNetworkError();
+            return HandleReceiveError();
+        }
 
-            if (ErrorIsWouldBlock(error)) // Filter would block messages
+        if (receivedBytes == 0)
+        {
+            return 0;
+        }
+
+        m_recvPackets++;
+        m_recvBytes += receivedBytes;
+        return receivedBytes;
+    }
+
+    int32_t UdpSocket::ReceiveBatch(IpAddress* outAddresses, int32_t* outSizes, uint8_t* outData, uint32_t stride, uint32_t count) const
+    {
+        AZ_Assert(stride > 0, "Invalid data size for receive");
+        AZ_Assert(outData != nullptr, "NULL data pointer passed to receive");
+
+        if (!IsOpen())
+        {
+            return 0;
+        }
+
+        count = AZStd::min(count, MaxReceiveBatchCount);
+
+#if AZ_TRAIT_USE_SOCKET_BATCHED_IO
+        if (m_batchedIo)
+        {
+            mmsghdr messages[MaxReceiveBatchCount];
+            iovec buffers[MaxReceiveBatchCount];
+            sockaddr_in from[MaxReceiveBatchCount];
+            memset(messages, 0, sizeof(mmsghdr) * count);
+            for (uint32_t i = 0; i < count; ++i)
             {
-                return 0;
+                buffers[i].iov_base = outData + i * stride;
+                buffers[i].iov_len = stride;
+                messages[i].msg_hdr.msg_name = &from[i];
+                messages[i].msg_hdr.msg_namelen = sizeof(from[i]);
+                messages[i].msg_hdr.msg_iov = &buffers[i];
+                messages[i].msg_hdr.msg_iovlen = 1;
             }
 
-            bool ignoreForciblyClosedError = false;
-            if (ErrorIsForciblyClosed(error, ignoreForciblyClosedError))
+            ++m_recvCalls;
+            const int32_t receivedCount = recvmmsg(static_cast<int32_t>(m_socketFd), messages, count, 0, nullptr);
+            if (receivedCount < 0)
             {
-                if (ignoreForciblyClosedError)
-                {
-                    return 0;
-                }
-                else
+                return HandleReceiveError();
+            }
+
+            for (int32_t i = 0; i < receivedCount; ++i)
+            {
+                outAddresses[i] = IpAddress(ByteOrder::Network, from[i].sin_addr.s_addr, from[i].sin_port);
+                outSizes[i] = static_cast<int32_t>(messages[i].msg_len);
+                if (outSizes[i] > 0)
                 {
-                    return SocketOpResultError;
+                    m_recvPackets++;
+                    m_recvBytes += outSizes[i];
                 }
             }
+            return receivedCount;
+        }
+#endif
 
-            AZLOG_ERROR("Failed to read from socket (%d:%s)", error, GetNetworkErrorDesc(error));
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            outSizes[i] = Receive(outAddresses[i], outData + i * stride, stride);
+            if (outSizes[i] <= 0)
+            {
+                return (i == 0) ? outSizes[i] : static_cast<int32_t>(i);
+            }
+        }
+        return static_cast<int32_t>(count);
+    }
+
+    void UdpSocket::SetBatchedIoEnabled([[maybe_unused]] bool enabled)
+    {
+#if AZ_TRAIT_USE_SOCKET_BATCHED_IO
+        if (!enabled)
+        {
+            FlushSends();
         }
+        else
+        {
+            m_queuedSends.reserve(MaxQueuedSendCount);
+            m_queuedSendBuffer.reserve(MaxQueuedSendCount * MaxUdpTransmissionUnit);
+        }
+        m_batchedIo = enabled;
+        m_segmentationOffload = enabled && net_UdpSegmentationOffload;
+#endif
+    }
+
+    void UdpSocket::SetReusePortEnabled([[maybe_unused]] bool enabled)
+    {
+        AZ_Assert(!IsOpen(), "Port reuse must be configured before the socket is opened");
+#if AZ_TRAIT_USE_SOCKET_REUSE_PORT
+        m_reusePort = enabled;
+#endif
+    }
 
-        if (receivedBytes <= 0)
+    uint32_t UdpSocket::FlushSends() const
+    {
+        if (m_queuedSends.empty())
         {
             return 0;
         }
 
-        m_recvPackets++;
-        m_recvBytes += receivedBytes;
-        return receivedBytes;
+        uint32_t sentPackets = 0;
+#if AZ_TRAIT_USE_SOCKET_BATCHED_IO
+        mmsghdr messages[MaxSendBatchCount];
+        iovec buffers[MaxSendBatchCount];
+        sockaddr_in destAddrs[MaxSendBatchCount];
+        uint32_t messagePackets[MaxSendBatchCount];
+        union
+        {
+            char m_buffer[CMSG_SPACE(sizeof(uint16_t))];
+            cmsghdr m_align;
+        } segmentControls[MaxSendBatchCount];
+
+        size_t queueIndex = 0;
+        while (IsOpen() && (queueIndex < m_queuedSends.size()))
+        {
+            // Build a batch of messages, coalescing runs of payloads to the same address into a single segmented send when possible.
+            // All segments but the last one have to be the same size, the last one may be shorter
+            uint32_t messageCount = 0;
+            const size_t batchStartIndex = queueIndex;
+            while ((messageCount < MaxSendBatchCount) && (queueIndex < m_queuedSends.size()))
+            {
+                const QueuedSend& first = m_queuedSends[queueIndex];
+                uint32_t segmentCount = 1;
+                uint32_t messageSize = first.m_size;
+                while (m_segmentationOffload && (segmentCount < MaxSegmentsPerSend) && (queueIndex + segmentCount < m_queuedSends.size()))
+                {
+                    const QueuedSend& next = m_queuedSends[queueIndex + segmentCount];
+                    if ((next.m_address != first.m_address) || (next.m_size > first.m_size) || (messageSize + next.m_size > MaxSegmentedSendBytes))
+                    {
+                        break;
+                    }
+                    ++segmentCount;
+                    messageSize += next.m_size;
+                    if (next.m_size < first.m_size)
+                    {
+                        break;
+                    }
+                }
+
+                mmsghdr& message = messages[messageCount];
+                memset(&message, 0, sizeof(message));
+                sockaddr_in& destAddr = destAddrs[messageCount];
+                memset(&destAddr, 0, sizeof(destAddr));
+                destAddr.sin_family = AF_INET;
+                destAddr.sin_addr.s_addr = first.m_address.GetAddress(ByteOrder::Network);
+                destAddr.sin_port = first.m_address.GetPort(ByteOrder::Network);
+                // Queued payloads are stored back to back, so a run of them is already a contiguous block
+                buffers[messageCount].iov_base = m_queuedSendBuffer.data() + first.m_offset;
+                buffers[messageCount].iov_len = messageSize;
+                message.msg_hdr.msg_name = &destAddr;
+                message.msg_hdr.msg_namelen = sizeof(destAddr);
+                message.msg_hdr.msg_iov = &buffers[messageCount];
+                message.msg_hdr.msg_iovlen = 1;
+
+                if (segmentCount > 1)
+                {
+                    message.msg_hdr.msg_control = segmentControls[messageCount].m_buffer;
+                    message.msg_hdr.msg_controllen = sizeof(segmentControls[messageCount].m_buffer);
+                    cmsghdr* control = CMSG_FIRSTHDR(&message.msg_hdr);
+                    control->cmsg_level = IPPROTO_UDP;
+                    control->cmsg_type = UDP_SEGMENT;
+                    control->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+                    const uint16_t segmentSize = static_cast<uint16_t>(first.m_size);
+                    memcpy(CMSG_DATA(control), &segmentSize, sizeof(segmentSize));
+                }
+
+                messagePackets[messageCount] = segmentCount;
+                queueIndex += segmentCount;
+                ++messageCount;
+            }
+
+            uint32_t sentMessages = 0;
+            while (sentMessages < messageCount)
+            {
+                ++m_sendCalls;
+                const int32_t result = sendmmsg(static_cast<int32_t>(m_socketFd), messages + sentMessages, messageCount - sentMessages, 0);
+                if (result > 0)
+                {
+                    for (uint32_t i = sentMessages; i < sentMessages + static_cast<uint32_t>(result); ++i)
+                    {
+                        sentPackets += messagePackets[i];
+                        m_sentSegmentedPackets += (messagePackets[i] > 1) ? messagePackets[i] : 0;
+                    }
+                    sentMessages += static_cast<uint32_t>(result);
+                    continue;
+                }
+
+                const int32_t error = GetLastNetworkError();
+                const bool segmentationRejected = (messagePackets[sentMessages] > 1)
+                    && ((error == EINVAL) || (error == EIO) || (error == ENOPROTOOPT) || (error == EMSGSIZE));
+                if (segmentationRejected)
+                {
+                    // The kernel or the network device doesn't support segmentation offload, resend the rest of the batch one datagram per payload
+                    AZLOG_INFO("UDP segmentation offload is unavailable (%d:%s), falling back to unsegmented sends", error, GetNetworkErrorDesc(error));
+                    m_segmentationOffload = false;
+                    queueIndex = batchStartIndex;
+                    for (uint32_t i = 0; i < sentMessages; ++i)
+                    {
+                        queueIndex += messagePackets[i];
+                    }
+                    break;
+                }
+
+                if (!ErrorIsWouldBlock(error)) // Filter would block messages
+                {
+                    AZLOG_ERROR("Failed to write to socket (%d:%s)", error, GetNetworkErrorDesc(error));
+                }
+
+                // Drop the message that failed to send, just like an unbatched send would
+                ++sentMessages;
+            }
+        }
+#endif
+
+        m_queuedSends.clear();
+        m_queuedSendBuffer.clear();
+        return sentPackets;
     }
 
     int32_t UdpSocket::SendInternal(const IpAddress& address, const uint8_t* data, uint32_t size,
         [[maybe_unused]] bool encrypt, [[maybe_unused]] DtlsEndpoint& dtlsEndpoint) const
     {
+        if (m_batchedIo)
+        {
+            if (m_queuedSends.size() >= MaxQueuedSendCount)
+            {
+                FlushSends();
+            }
+
+            // Queue the payload for the next FlushSends, the payload has already been encrypted if required
+            const size_t offset = m_queuedSendBuffer.size();
+            m_queuedSendBuffer.resize_no_construct(offset + size);
+            memcpy(m_queuedSendBuffer.data() + offset, data, size);
+            m_queuedSends.push_back(QueuedSend{ address, static_cast<uint32_t>(offset), size });
+            return static_cast<int32_t>(size);
+        }
+
+        ++m_sendCalls;
         sockaddr_in destAddr;
         memset(&destAddr, 0, sizeof(destAddr));
         destAddr.sin_family = AF_INET;
@@ -14,6 +14,7 @@
 #include <AzNetworking/UdpTransport/DtlsEndpoint.h>
 #include <AzCore/Math/Random.h>
 #include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/containers/vector.h>
 
 #ifndef _RELEASE
 #   define ENABLE_LATENCY_DEBUG 1
@@ -42,6 +43,12 @@ namespace AzNetworking
             True   // Socket can accept incoming connections and may require a valid certificate and private key file
         };
 
+        //! The maximum number of payloads a single call to ReceiveBatch can return.
+        static constexpr uint32_t MaxReceiveBatchCount = 64;
+
+        //! The maximum number of payloads Send can queue while batched I/O is enabled, the queue is flushed when it fills up.
+        static constexpr uint32_t MaxQueuedSendCount = 256;
+
         UdpSocket() = default;
         virtual ~UdpSocket();
 
@@ -93,6 +100,40 @@ namespace AzNetworking
         //! @return number of bytes received, <= 0 on error
         int32_t Receive(IpAddress& outAddress, uint8_t* outData, uint32_t size) const;
 
+        //! Receives up to count payloads from the UDP socket, using a single system call if batched I/O is enabled.
+        //! Payload i is written to outData + i * stride.
+        //! @param outAddresses on success, the addresses of the endpoints that sent each payload
+        //! @param outSizes     on success, the number of bytes received for each payload
+        //! @param outData      address of the first output buffer
+        //! @param stride       distance in bytes between consecutive output buffers, also the maximum size of each payload
+        //! @param count        maximum number of payloads to receive, clamped to MaxReceiveBatchCount
+        //! @return number of payloads received, < 0 on error
+        int32_t ReceiveBatch(IpAddress* outAddresses, int32_t* outSizes, uint8_t* outData, uint32_t stride, uint32_t count) const;
+
+        //! Enables or disables batched I/O, this is only supported on some platforms and is a no-op elsewhere.
+        //! While enabled, payloads passed to Send are queued on the socket and written with as few system calls as possible by
+        //! FlushSends, and ReceiveBatch reads many payloads with a single system call. Opening the socket resets this to net_UdpBatchedIo.
+        //! @param enabled true to enable batched I/O
+        void SetBatchedIoEnabled(bool enabled);
+
+        //! Returns true if batched I/O is enabled on this socket.
+        //! @return boolean true if batched I/O is enabled on this socket
+        bool IsBatchedIoEnabled() const;
+
+        //! Enables or disables SO_REUSEPORT, this is only supported on some platforms and is a no-op elsewhere.
+        //! Must be called before Open. Several sockets opened on the same port with port reuse enabled each receive a share of the
+        //! incoming datagrams, hashed by the sender's address so all datagrams from one endpoint land on the same socket.
+        //! @param enabled true to enable port reuse
+        void SetReusePortEnabled(bool enabled);
+
+        //! Returns true if port reuse is enabled on this socket.
+        //! @return boolean true if port reuse is enabled on this socket
+        bool IsReusePortEnabled() const;
+
+        //! Writes all payloads queued by Send while batched I/O is enabled to the socket.
+        //! @return number of payloads written to the socket
+        uint32_t FlushSends() const;
+
         //! Returns the underlying socket file descriptor.
         //! @return the underlying socket file descriptor
         SocketFd GetSocketFd() const;
@@ -121,6 +162,18 @@ namespace AzNetworking
         //! @return the total number of bytes received on this socket
         uint32_t GetRecvBytes() const;
 
+        //! Returns the total number of system calls made to send packets on this socket.
+        //! @return the total number of system calls made to send packets on this socket
+        uint32_t GetSendCalls() const;
+
+        //! Returns the total number of packets sent on this socket as segments of a UDP segmentation offload send.
+        //! @return the total number of packets sent on this socket as segments of a UDP segmentation offload send
+        uint32_t GetSentSegmentedPackets() const;
+
+        //! Returns the total number of system calls made to receive packets on this socket.
+        //! @return the total number of system calls made to receive packets on this socket
+        uint32_t GetRecvCalls() const;
+
     protected:
 
         mutable uint32_t m_sentPacketsEncrypted = 0;
@@ -135,6 +188,22 @@ namespace AzNetworking
         mutable uint32_t m_sentBytes = 0;
         mutable uint32_t m_recvPackets = 0;
         mutable uint32_t m_recvBytes = 0;
+        mutable uint32_t m_sendCalls = 0;
+        mutable uint32_t m_sentSegmentedPackets = 0;
+        mutable uint32_t m_recvCalls = 0;
+
+        struct QueuedSend
+        {
+            IpAddress m_address;
+            uint32_t m_offset = 0; //!< Offset of the payload in m_queuedSendBuffer.
+            uint32_t m_size = 0;
+        };
+
+        bool m_batchedIo = false;
+        bool m_reusePort = false;
+        mutable bool m_segmentationOffload = false; //!< Cleared if the kernel or network device rejects segmented sends.
+        mutable AZStd::vector<QueuedSend> m_queuedSends;
+        mutable AZStd::vector<uint8_t> m_queuedSendBuffer;
 
 #ifdef ENABLE_LATENCY_DEBUG
         struct DeferredData
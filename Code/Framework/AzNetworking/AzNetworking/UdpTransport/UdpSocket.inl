@@ -49,4 +49,29 @@ namespace AzNetworking
     {
         return m_recvBytes;
     }
+
+    inline bool UdpSocket::IsBatchedIoEnabled() const
+    {
+        return m_batchedIo;
+    }
+
+    inline bool UdpSocket::IsReusePortEnabled() const
+    {
+        return m_reusePort;
+    }
+
+    inline uint32_t UdpSocket::GetSendCalls() const
+    {
+        return m_sendCalls;
+    }
+
+    inline uint32_t UdpSocket::GetSentSegmentedPackets() const
+    {
+        return m_sentSegmentedPackets;
+    }
+
+    inline uint32_t UdpSocket::GetRecvCalls() const
+    {
+        return m_recvCalls;
+    }
 }
@@ -56,16 +56,25 @@ set(FILES
     Serialization/HashSerializer.h
     Serialization/ISerializer.h
     Serialization/ISerializer.inl
+    Serialization/NetworkBitInputSerializer.cpp
+    Serialization/NetworkBitInputSerializer.h
+    Serialization/NetworkBitInputSerializer.inl
+    Serialization/NetworkBitOutputSerializer.cpp
+    Serialization/NetworkBitOutputSerializer.h
+    Serialization/NetworkBitOutputSerializer.inl
     Serialization/NetworkInputSerializer.cpp
     Serialization/NetworkInputSerializer.h
     Serialization/NetworkInputSerializer.inl
     Serialization/NetworkOutputSerializer.cpp
     Serialization/NetworkOutputSerializer.h
     Serialization/NetworkOutputSerializer.inl
+    Serialization/NetworkSerializerTraits.h
     Serialization/StringifySerializer.cpp
     Serialization/StringifySerializer.h
     Serialization/TrackChangedSerializer.h
     Serialization/TrackChangedSerializer.inl
+    Serialization/TypedSerializer.h
+    Serialization/TypedSerializer.inl
     TcpTransport/TcpConnection.cpp
     TcpTransport/TcpConnection.h
     TcpTransport/TcpConnection.inl
@@ -116,6 +125,8 @@ set(FILES
     UdpTransport/UdpPacketTracker.inl
     UdpTransport/UdpReaderThread.cpp
     UdpTransport/UdpReaderThread.h
+    UdpTransport/UdpReceiveShard.cpp
+    UdpTransport/UdpReceiveShard.h
     UdpTransport/UdpReliableQueue.cpp
     UdpTransport/UdpReliableQueue.h
     UdpTransport/UdpSocket.cpp
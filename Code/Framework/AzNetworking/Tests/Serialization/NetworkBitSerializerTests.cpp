@@ -0,0 +1,460 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/Serialization/NetworkBitInputSerializer.h>
+#include <AzNetworking/Serialization/NetworkBitOutputSerializer.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <AzNetworking/Serialization/NetworkOutputSerializer.h>
+#include <AzNetworking/Utilities/QuantizedValues.h>
+#include <AzCore/RTTI/TypeSafeIntegral.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+#endif
+
+namespace UnitTest
+{
+    using namespace AzNetworking;
+
+    AZ_TYPE_SAFE_INTEGRAL(BitTestNetEntityId, uint32_t);
+
+    struct BitTestObject
+    {
+        bool m_bool = true;
+        char m_char = 'x';
+        int8_t m_int8 = -100;
+        int16_t m_int16 = -30000;
+        int32_t m_int32 = -2000000000;
+        int64_t m_int64 = -9000000000000000000ll;
+        uint8_t m_uint8 = 200;
+        uint16_t m_uint16 = 60000;
+        uint32_t m_uint32 = 4000000000u;
+        uint64_t m_uint64 = 18000000000000000000ull;
+        float m_float = 1.5f;
+        double m_double = -2.25;
+        int16_t m_boundedInt16 = -3;
+        uint32_t m_boundedUint32 = 1000;
+        AZ::Vector3 m_vector = AZ::Vector3(1.0f, -2.0f, 3.0f);
+        AZStd::string m_string = "written at an odd bit offset";
+
+        bool Serialize(ISerializer& serializer)
+        {
+            serializer.Serialize(m_bool, "bool");
+            serializer.Serialize(m_char, "char");
+            serializer.Serialize(m_int8, "int8");
+            serializer.Serialize(m_int16, "int16");
+            serializer.Serialize(m_int32, "int32");
+            serializer.Serialize(m_int64, "int64");
+            serializer.Serialize(m_uint8, "uint8");
+            serializer.Serialize(m_uint16, "uint16");
+            serializer.Serialize(m_uint32, "uint32");
+            serializer.Serialize(m_uint64, "uint64");
+            serializer.Serialize(m_float, "float");
+            serializer.Serialize(m_double, "double");
+            serializer.Serialize(m_boundedInt16, "boundedInt16", int16_t(-5), int16_t(10));
+            serializer.Serialize(m_boundedUint32, "boundedUint32", 0u, 1023u);
+            serializer.Serialize(m_vector, "vector");
+            serializer.Serialize(m_string, "string");
+            return serializer.IsValid();
+        }
+
+        bool operator==(const BitTestObject& rhs) const
+        {
+            return m_bool == rhs.m_bool && m_char == rhs.m_char && m_int8 == rhs.m_int8 && m_int16 == rhs.m_int16
+                && m_int32 == rhs.m_int32 && m_int64 == rhs.m_int64 && m_uint8 == rhs.m_uint8 && m_uint16 == rhs.m_uint16
+                && m_uint32 == rhs.m_uint32 && m_uint64 == rhs.m_uint64 && m_float == rhs.m_float && m_double == rhs.m_double
+                && m_boundedInt16 == rhs.m_boundedInt16 && m_boundedUint32 == rhs.m_boundedUint32 && m_vector == rhs.m_vector
+                && m_string == rhs.m_string;
+        }
+    };
+
+    // The network properties of a NetworkTransformComponent
+    struct BitTestTransformProperties
+    {
+        AZ::Quaternion m_rotation = AZ::Quaternion::CreateFromAxisAngle(AZ::Vector3::CreateAxisZ(), 0.5f);
+        AZ::Vector3 m_translation = AZ::Vector3(128.0f, -64.0f, 32.0f);
+        float m_scale = 1.0f;
+        uint8_t m_resetCount = 0;
+        BitTestNetEntityId m_parentEntityId = BitTestNetEntityId{ 1024 };
+        int32_t m_parentAttachmentBoneId = -1;
+
+        bool Serialize(ISerializer& serializer)
+        {
+            serializer.Serialize(m_rotation, "rotation");
+            serializer.Serialize(m_translation, "translation");
+            serializer.Serialize(m_scale, "scale");
+            serializer.Serialize(m_resetCount, "resetCount");
+            serializer.Serialize(m_parentEntityId, "parentEntityId");
+            serializer.Serialize(m_parentAttachmentBoneId, "parentAttachmentBoneId");
+            return serializer.IsValid();
+        }
+    };
+
+    // A NetworkTransformComponent replicated through QuantizedValues, with the attachment bone bounded by the skeleton size
+    struct BitTestQuantizedTransformProperties
+    {
+        QuantizedValues<4, 2, -1, 1> m_rotation = QuantizedValues<4, 2, -1, 1>(AZ::Quaternion::CreateFromAxisAngle(AZ::Vector3::CreateAxisZ(), 0.5f));
+        QuantizedValues<3, 3, -4096, 4096> m_translation = QuantizedValues<3, 3, -4096, 4096>(AZ::Vector3(128.0f, -64.0f, 32.0f));
+        float m_scale = 1.0f;
+        uint8_t m_resetCount = 0;
+        BitTestNetEntityId m_parentEntityId = BitTestNetEntityId{ 1024 };
+        int32_t m_parentAttachmentBoneId = -1;
+
+        bool Serialize(ISerializer& serializer)
+        {
+            serializer.Serialize(m_rotation, "rotation");
+            serializer.Serialize(m_translation, "translation");
+            serializer.Serialize(m_scale, "scale");
+            serializer.Serialize(m_resetCount, "resetCount");
+            serializer.Serialize(m_parentEntityId, "parentEntityId");
+            serializer.Serialize(m_parentAttachmentBoneId, "parentAttachmentBoneId", -1, 255);
+            return serializer.IsValid();
+        }
+    };
+
+    // A typical player input, mostly flags and small ranges
+    struct BitTestPlayerInput
+    {
+        int8_t m_forwardAxis = 1;
+        int8_t m_strafeAxis = -1;
+        bool m_jump = true;
+        bool m_crouch = false;
+        uint16_t m_yaw = 270;
+        uint8_t m_weaponSlot = 3;
+        uint32_t m_clientInputId = 123456;
+
+        bool Serialize(ISerializer& serializer)
+        {
+            serializer.Serialize(m_forwardAxis, "forwardAxis", int8_t(-1), int8_t(1));
+            serializer.Serialize(m_strafeAxis, "strafeAxis", int8_t(-1), int8_t(1));
+            serializer.Serialize(m_jump, "jump");
+            serializer.Serialize(m_crouch, "crouch");
+            serializer.Serialize(m_yaw, "yaw", uint16_t(0), uint16_t(1023));
+            serializer.Serialize(m_weaponSlot, "weaponSlot", uint8_t(0), uint8_t(7));
+            serializer.Serialize(m_clientInputId, "clientInputId");
+            return serializer.IsValid();
+        }
+    };
+
+    template <typename TYPE>
+    uint32_t GetByteSerializedSize(TYPE& value)
+    {
+        AZStd::array<uint8_t, 256> buffer;
+        NetworkInputSerializer serializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+        EXPECT_TRUE(value.Serialize(serializer));
+        return serializer.GetSize();
+    }
+
+    template <typename TYPE>
+    uint64_t GetBitSerializedSize(TYPE& value)
+    {
+        AZStd::array<uint8_t, 256> buffer;
+        NetworkBitInputSerializer serializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+        EXPECT_TRUE(value.Serialize(serializer));
+        return serializer.GetBitSize();
+    }
+
+    class NetworkBitSerializerTests
+        : public AllocatorsFixture
+    {
+    };
+
+    TEST_F(NetworkBitSerializerTests, RoundTrip_AllTypes_ValuesMatch)
+    {
+        BitTestObject inObject;
+        inObject.m_bool = false;
+        inObject.m_uint64 = 42;
+        inObject.m_boundedInt16 = 10;
+
+        AZStd::array<uint8_t, 256> buffer;
+        NetworkBitInputSerializer inputSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+        EXPECT_TRUE(inObject.Serialize(inputSerializer));
+
+        BitTestObject outObject;
+        NetworkBitOutputSerializer outputSerializer(buffer.data(), inputSerializer.GetSize());
+        EXPECT_TRUE(outObject.Serialize(outputSerializer));
+        EXPECT_EQ(inObject, outObject);
+        EXPECT_EQ(inputSerializer.GetBitSize(), outputSerializer.GetBitSize());
+    }
+
+    TEST_F(NetworkBitSerializerTests, RoundTrip_MatchesByteAlignedSerializers)
+    {
+        BitTestObject bitObject;
+        BitTestObject byteObject;
+        bitObject.m_string = byteObject.m_string = "";
+
+        AZStd::array<uint8_t, 256> bitBuffer;
+        AZStd::array<uint8_t, 256> byteBuffer;
+        {
+            BitTestObject source;
+            NetworkBitInputSerializer bitSerializer(bitBuffer.data(), static_cast<uint32_t>(bitBuffer.size()));
+            NetworkInputSerializer byteSerializer(byteBuffer.data(), static_cast<uint32_t>(byteBuffer.size()));
+            EXPECT_TRUE(source.Serialize(bitSerializer));
+            EXPECT_TRUE(source.Serialize(byteSerializer));
+            EXPECT_LT(bitSerializer.GetSize(), byteSerializer.GetSize());
+        }
+
+        NetworkBitOutputSerializer bitSerializer(bitBuffer.data(), static_cast<uint32_t>(bitBuffer.size()));
+        NetworkOutputSerializer byteSerializer(byteBuffer.data(), static_cast<uint32_t>(byteBuffer.size()));
+        EXPECT_TRUE(bitObject.Serialize(bitSerializer));
+        EXPECT_TRUE(byteObject.Serialize(byteSerializer));
+        EXPECT_EQ(bitObject, byteObject);
+        EXPECT_EQ(bitObject, BitTestObject());
+    }
+
+    TEST_F(NetworkBitSerializerTests, BoundedValues_UseMinimumBits)
+    {
+        AZStd::array<uint8_t, 64> buffer;
+        NetworkBitInputSerializer serializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+
+        bool flag = true;
+        serializer.Serialize(flag, "flag");
+        EXPECT_EQ(1, serializer.GetBitSize());
+
+        uint8_t slot = 7;
+        serializer.Serialize(slot, "slot", uint8_t(0), uint8_t(7));
+        EXPECT_EQ(4, serializer.GetBitSize());
+
+        int16_t axis = -1;
+        serializer.Serialize(axis, "axis", int16_t(-1), int16_t(1));
+        EXPECT_EQ(6, serializer.GetBitSize());
+
+        uint32_t constant = 5;
+        serializer.Serialize(constant, "constant", 5u, 5u);
+        EXPECT_EQ(6, serializer.GetBitSize());
+
+        int32_t fullRange = AZStd::numeric_limits<int32_t>::min();
+        serializer.Serialize(fullRange, "fullRange", AZStd::numeric_limits<int32_t>::min(), AZStd::numeric_limits<int32_t>::max());
+        EXPECT_EQ(38, serializer.GetBitSize());
+
+        float value = 0.25f;
+        serializer.Serialize(value, "value", 0.0f, 1.0f);
+        EXPECT_EQ(70, serializer.GetBitSize());
+        EXPECT_EQ(9, serializer.GetSize());
+        EXPECT_TRUE(serializer.IsValid());
+
+        NetworkBitOutputSerializer outputSerializer(buffer.data(), serializer.GetSize());
+        bool outFlag = false;
+        uint8_t outSlot = 0;
+        int16_t outAxis = 0;
+        uint32_t outConstant = 0;
+        int32_t outFullRange = 0;
+        float outValue = 0.0f;
+        outputSerializer.Serialize(outFlag, "flag");
+        outputSerializer.Serialize(outSlot, "slot", uint8_t(0), uint8_t(7));
+        outputSerializer.Serialize(outAxis, "axis", int16_t(-1), int16_t(1));
+        outputSerializer.Serialize(outConstant, "constant", 5u, 5u);
+        outputSerializer.Serialize(outFullRange, "fullRange", AZStd::numeric_limits<int32_t>::min(), AZStd::numeric_limits<int32_t>::max());
+        outputSerializer.Serialize(outValue, "value", 0.0f, 1.0f);
+        EXPECT_TRUE(outputSerializer.IsValid());
+        EXPECT_EQ(flag, outFlag);
+        EXPECT_EQ(slot, outSlot);
+        EXPECT_EQ(axis, outAxis);
+        EXPECT_EQ(constant, outConstant);
+        EXPECT_EQ(fullRange, outFullRange);
+        EXPECT_EQ(value, outValue);
+    }
+
+    TEST_F(NetworkBitSerializerTests, Serialize_OutOfRange_InvalidatesSerializer)
+    {
+        AZStd::array<uint8_t, 16> buffer;
+        NetworkBitInputSerializer inputSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+        uint8_t value = 8;
+        EXPECT_FALSE(inputSerializer.Serialize(value, "value", uint8_t(0), uint8_t(7)));
+        EXPECT_FALSE(inputSerializer.IsValid());
+
+        // Values that fit in the bit count but exceed the declared range are rejected on read
+        NetworkBitInputSerializer wideSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+        uint8_t wideValue = 6;
+        EXPECT_TRUE(wideSerializer.Serialize(wideValue, "value", uint8_t(0), uint8_t(7)));
+
+        NetworkBitOutputSerializer outputSerializer(buffer.data(), wideSerializer.GetSize());
+        uint8_t outValue = 0;
+        EXPECT_FALSE(outputSerializer.Serialize(outValue, "value", uint8_t(0), uint8_t(4)));
+        EXPECT_EQ(0, outValue);
+    }
+
+    TEST_F(NetworkBitSerializerTests, Serialize_InsufficientSpace_InvalidatesSerializer)
+    {
+        AZStd::array<uint8_t, 1> buffer;
+        NetworkBitInputSerializer inputSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+        uint8_t nibble = 15;
+        EXPECT_TRUE(inputSerializer.Serialize(nibble, "nibble", uint8_t(0), uint8_t(15)));
+        EXPECT_TRUE(inputSerializer.Serialize(nibble, "nibble", uint8_t(0), uint8_t(15)));
+        EXPECT_FALSE(inputSerializer.Serialize(nibble, "nibble", uint8_t(0), uint8_t(15)));
+        EXPECT_EQ(8, inputSerializer.GetBitSize());
+
+        NetworkBitOutputSerializer outputSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+        uint16_t value = 0;
+        EXPECT_FALSE(outputSerializer.Serialize(value, "value", uint16_t(0), uint16_t(1000)));
+    }
+
+    TEST_F(NetworkBitSerializerTests, QuantizedValues_RoundTrip)
+    {
+        BitTestQuantizedTransformProperties inProperties;
+        BitTestQuantizedTransformProperties outProperties;
+        outProperties.m_rotation = AZ::Quaternion::CreateIdentity();
+        outProperties.m_translation = AZ::Vector3::CreateZero();
+
+        AZStd::array<uint8_t, 64> buffer;
+        NetworkBitInputSerializer inputSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+        EXPECT_TRUE(inProperties.Serialize(inputSerializer));
+
+        NetworkBitOutputSerializer outputSerializer(buffer.data(), inputSerializer.GetSize());
+        EXPECT_TRUE(outProperties.Serialize(outputSerializer));
+        EXPECT_EQ(inProperties.m_rotation, outProperties.m_rotation);
+        EXPECT_EQ(inProperties.m_translation, outProperties.m_translation);
+        EXPECT_EQ(inProperties.m_parentAttachmentBoneId, outProperties.m_parentAttachmentBoneId);
+    }
+
+    // Records the bandwidth of multiplayer component state in both modes, update these if the wire format changes
+    TEST_F(NetworkBitSerializerTests, Bandwidth_ComponentProperties)
+    {
+        // Full range properties only save the padding of the byte aligned format, a full range int32 takes 8 bytes there
+        BitTestTransformProperties transform;
+        EXPECT_EQ(45, GetByteSerializedSize(transform));
+        EXPECT_EQ(328, GetBitSerializedSize(transform));
+
+        // Quantized floats are already byte minimal, only the bounded bone id gains
+        BitTestQuantizedTransformProperties quantizedTransform;
+        EXPECT_EQ(28, GetByteSerializedSize(quantizedTransform));
+        EXPECT_EQ(217, GetBitSerializedSize(quantizedTransform));
+
+        // Flags and small ranges gain the most
+        BitTestPlayerInput input;
+        EXPECT_EQ(11, GetByteSerializedSize(input));
+        EXPECT_EQ(51, GetBitSerializedSize(input));
+    }
+}
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    using namespace AzNetworking;
+
+    // The network properties of a NetworkTransformComponent and a player input, as sent for a controlled entity
+    struct BitBenchmarkEntityState
+    {
+        AZ::Quaternion m_rotation = AZ::Quaternion::CreateFromAxisAngle(AZ::Vector3::CreateAxisZ(), 0.5f);
+        AZ::Vector3 m_translation = AZ::Vector3(128.0f, -64.0f, 32.0f);
+        float m_scale = 1.0f;
+        uint8_t m_resetCount = 0;
+        uint32_t m_parentEntityId = 1024;
+        int32_t m_parentAttachmentBoneId = -1;
+        int8_t m_forwardAxis = 1;
+        int8_t m_strafeAxis = -1;
+        bool m_jump = true;
+        bool m_crouch = false;
+        uint16_t m_yaw = 270;
+
+        bool Serialize(ISerializer& serializer)
+        {
+            serializer.Serialize(m_rotation, "rotation");
+            serializer.Serialize(m_translation, "translation");
+            serializer.Serialize(m_scale, "scale");
+            serializer.Serialize(m_resetCount, "resetCount");
+            serializer.Serialize(m_parentEntityId, "parentEntityId");
+            serializer.Serialize(m_parentAttachmentBoneId, "parentAttachmentBoneId", -1, 255);
+            serializer.Serialize(m_forwardAxis, "forwardAxis", int8_t(-1), int8_t(1));
+            serializer.Serialize(m_strafeAxis, "strafeAxis", int8_t(-1), int8_t(1));
+            serializer.Serialize(m_jump, "jump");
+            serializer.Serialize(m_crouch, "crouch");
+            serializer.Serialize(m_yaw, "yaw", uint16_t(0), uint16_t(1023));
+            return serializer.IsValid();
+        }
+    };
+
+    // Enough entities to fill a few packets worth of entity updates
+    static constexpr uint32_t EntityStateCount = 256;
+    static constexpr uint32_t EntityStateBufferSize = EntityStateCount * 64;
+
+    class NetworkBitSerializerBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        using UnitTest::AllocatorsBenchmarkFixture::SetUp;
+        using UnitTest::AllocatorsBenchmarkFixture::TearDown;
+
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            m_states.resize(EntityStateCount);
+            m_buffer.resize(EntityStateBufferSize);
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            m_states.set_capacity(0);
+            m_buffer.set_capacity(0);
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        template <typename SERIALIZER>
+        uint32_t WriteStates()
+        {
+            SERIALIZER serializer(m_buffer.data(), EntityStateBufferSize);
+            for (BitBenchmarkEntityState& entityState : m_states)
+            {
+                entityState.Serialize(serializer);
+            }
+            return serializer.GetSize();
+        }
+
+        template <typename SERIALIZER>
+        void ReadStates(uint32_t size)
+        {
+            SERIALIZER serializer(m_buffer.data(), size);
+            for (BitBenchmarkEntityState& entityState : m_states)
+            {
+                entityState.Serialize(serializer);
+            }
+        }
+
+        AZStd::vector<BitBenchmarkEntityState> m_states;
+        AZStd::vector<uint8_t> m_buffer;
+    };
+
+    // Arg 0 writes with NetworkInputSerializer, arg 1 with NetworkBitInputSerializer.
+    BENCHMARK_DEFINE_F(NetworkBitSerializerBenchmarkFixture, WriteEntityStates)(benchmark::State& state)
+    {
+        const bool bitPacked = state.range(0) != 0;
+        uint32_t size = 0;
+        for (auto _ : state)
+        {
+            size = bitPacked ? WriteStates<NetworkBitInputSerializer>() : WriteStates<NetworkInputSerializer>();
+            benchmark::DoNotOptimize(size);
+        }
+        state.SetItemsProcessed(state.iterations() * EntityStateCount);
+        state.counters["BytesPerEntity"] = static_cast<double>(size) / EntityStateCount;
+    }
+    BENCHMARK_REGISTER_F(NetworkBitSerializerBenchmarkFixture, WriteEntityStates)->Arg(0)->Arg(1);
+
+    // Arg 0 reads with NetworkOutputSerializer, arg 1 with NetworkBitOutputSerializer.
+    BENCHMARK_DEFINE_F(NetworkBitSerializerBenchmarkFixture, ReadEntityStates)(benchmark::State& state)
+    {
+        const bool bitPacked = state.range(0) != 0;
+        const uint32_t size = bitPacked ? WriteStates<NetworkBitInputSerializer>() : WriteStates<NetworkInputSerializer>();
+        for (auto _ : state)
+        {
+            if (bitPacked)
+            {
+                ReadStates<NetworkBitOutputSerializer>(size);
+            }
+            else
+            {
+                ReadStates<NetworkOutputSerializer>(size);
+            }
+            benchmark::DoNotOptimize(m_states.data());
+        }
+        state.SetItemsProcessed(state.iterations() * EntityStateCount);
+        state.counters["BytesPerEntity"] = static_cast<double>(size) / EntityStateCount;
+    }
+    BENCHMARK_REGISTER_F(NetworkBitSerializerBenchmarkFixture, ReadEntityStates)->Arg(0)->Arg(1);
+}
+#endif
@@ -0,0 +1,443 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/Serialization/HashSerializer.h>
+#include <AzNetworking/Serialization/TrackChangedSerializer.h>
+#include <AzNetworking/Serialization/TypedSerializer.h>
+#include <AzNetworking/Utilities/Endian.h>
+#include <AzCore/RTTI/TypeSafeIntegral.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+#endif
+
+namespace UnitTest
+{
+    using namespace AzNetworking;
+
+    enum class TypedTestEnum : int16_t
+    {
+        First = -3,
+        Second = 1200
+    };
+
+    AZ_TYPE_SAFE_INTEGRAL(TypedTestId, uint32_t);
+
+    // Mirrors the member serialization generated for AutoPackets
+    struct TypedTestObject
+    {
+        bool m_bool = true;
+        char m_char = 'x';
+        int8_t m_int8 = -100;
+        int16_t m_int16 = -30000;
+        int32_t m_int32 = -2000000000;
+        int64_t m_int64 = -9000000000000000000ll;
+        uint8_t m_uint8 = 200;
+        uint16_t m_uint16 = 60000;
+        uint32_t m_uint32 = 4000000000u;
+        uint64_t m_uint64 = 18000000000000000000ull;
+        float m_float = 1.5f;
+        double m_double = -2.25;
+        TypedTestEnum m_enum = TypedTestEnum::First;
+        TypedTestId m_id = TypedTestId{ 77 };
+        AZ::Vector3 m_vector = AZ::Vector3(1.0f, -2.0f, 3.0f);
+        AZ::Quaternion m_quaternion = AZ::Quaternion(0.5f, -0.5f, 0.5f, -0.5f);
+        AZStd::array<uint16_t, 4> m_bulkArray = { { 1, 2, 3, 65535 } };
+        AZStd::array<int32_t, 3> m_signedArray = { { -1, 0, 1 } };
+        AZStd::string m_string = "not statically dispatched";
+
+        template <typename SERIALIZER>
+        bool SerializeMembers(SERIALIZER& serializer)
+        {
+            SerializeTyped(serializer, m_bool, "bool");
+            SerializeTyped(serializer, m_char, "char");
+            SerializeTyped(serializer, m_int8, "int8");
+            SerializeTyped(serializer, m_int16, "int16");
+            SerializeTyped(serializer, m_int32, "int32");
+            SerializeTyped(serializer, m_int64, "int64");
+            SerializeTyped(serializer, m_uint8, "uint8");
+            SerializeTyped(serializer, m_uint16, "uint16");
+            SerializeTyped(serializer, m_uint32, "uint32");
+            SerializeTyped(serializer, m_uint64, "uint64");
+            SerializeTyped(serializer, m_float, "float");
+            SerializeTyped(serializer, m_double, "double");
+            SerializeTyped(serializer, m_enum, "enum");
+            SerializeTyped(serializer, m_id, "id");
+            SerializeTyped(serializer, m_vector, "vector");
+            SerializeTyped(serializer, m_quaternion, "quaternion");
+            SerializeTyped(serializer, m_bulkArray, "bulkArray");
+            SerializeTyped(serializer, m_signedArray, "signedArray");
+            SerializeTyped(serializer, m_string, "string");
+            return serializer.IsValid();
+        }
+
+        bool operator==(const TypedTestObject& rhs) const
+        {
+            return m_bool == rhs.m_bool && m_char == rhs.m_char && m_int8 == rhs.m_int8 && m_int16 == rhs.m_int16
+                && m_int32 == rhs.m_int32 && m_int64 == rhs.m_int64 && m_uint8 == rhs.m_uint8 && m_uint16 == rhs.m_uint16
+                && m_uint32 == rhs.m_uint32 && m_uint64 == rhs.m_uint64 && m_float == rhs.m_float && m_double == rhs.m_double
+                && m_enum == rhs.m_enum && m_id == rhs.m_id && m_vector == rhs.m_vector && m_quaternion == rhs.m_quaternion
+                && m_bulkArray == rhs.m_bulkArray && m_signedArray == rhs.m_signedArray && m_string == rhs.m_string;
+        }
+    };
+
+    // Records which SerializeMembers instantiation SerializeMembersTyped selected
+    struct DispatchTestObject
+    {
+        SerializerType m_dispatchedType = SerializerType::Other;
+        uint32_t m_value = 5;
+
+        template <typename SERIALIZER>
+        bool SerializeMembers(SERIALIZER& serializer)
+        {
+            if constexpr (AZStd::is_same_v<SERIALIZER, NetworkInputSerializer>)
+            {
+                m_dispatchedType = SerializerType::NetworkInput;
+            }
+            else if constexpr (AZStd::is_same_v<SERIALIZER, NetworkOutputSerializer>)
+            {
+                m_dispatchedType = SerializerType::NetworkOutput;
+            }
+            else
+            {
+                m_dispatchedType = SerializerType::Other;
+            }
+            SerializeTyped(serializer, m_value, "value");
+            return serializer.IsValid();
+        }
+    };
+
+    class TypedSerializerTests
+        : public AllocatorsFixture
+    {
+    public:
+        static constexpr uint32_t BufferSize = 512;
+
+        // Serializes through ISerializer, the way tools and type-erased callers do
+        static bool SerializeVirtual(ISerializer& serializer, TypedTestObject& object)
+        {
+            return object.SerializeMembers(serializer);
+        }
+
+        static TypedTestObject CreateModifiedObject()
+        {
+            TypedTestObject object;
+            object.m_bool = false;
+            object.m_char = 'q';
+            object.m_int8 = 5;
+            object.m_int16 = 12345;
+            object.m_int32 = 5;
+            object.m_int64 = 42;
+            object.m_uint8 = 1;
+            object.m_uint16 = 2;
+            object.m_uint32 = 3;
+            object.m_uint64 = 4;
+            object.m_float = -8.0f;
+            object.m_double = 16.0;
+            object.m_enum = TypedTestEnum::Second;
+            object.m_id = TypedTestId{ 99 };
+            object.m_vector = AZ::Vector3(-7.0f, 8.0f, -9.0f);
+            object.m_quaternion = AZ::Quaternion::CreateIdentity();
+            object.m_bulkArray = { { 10, 20, 30, 40 } };
+            object.m_signedArray = { { 2147483647, -2147483647 - 1, 7 } };
+            object.m_string = "modified";
+            return object;
+        }
+    };
+
+    TEST_F(TypedSerializerTests, NetworkInputSerializer_TypedAndVirtualPaths_WriteIdenticalBytes)
+    {
+        TypedTestObject object = CreateModifiedObject();
+
+        uint8_t typedBuffer[BufferSize];
+        NetworkInputSerializer typedSerializer(typedBuffer, BufferSize);
+        EXPECT_TRUE(object.SerializeMembers(typedSerializer));
+
+        uint8_t virtualBuffer[BufferSize];
+        NetworkInputSerializer virtualSerializer(virtualBuffer, BufferSize);
+        EXPECT_TRUE(SerializeVirtual(virtualSerializer, object));
+
+        ASSERT_EQ(virtualSerializer.GetSize(), typedSerializer.GetSize());
+        EXPECT_EQ(0, memcmp(virtualBuffer, typedBuffer, typedSerializer.GetSize()));
+    }
+
+    TEST_F(TypedSerializerTests, NetworkOutputSerializer_TypedAndVirtualPaths_ReadEachOthersBytes)
+    {
+        const TypedTestObject expected = CreateModifiedObject();
+
+        uint8_t buffer[BufferSize];
+        TypedTestObject source = expected;
+        NetworkInputSerializer inputSerializer(buffer, BufferSize);
+        EXPECT_TRUE(SerializeVirtual(inputSerializer, source));
+
+        TypedTestObject typedResult;
+        NetworkOutputSerializer typedSerializer(buffer, inputSerializer.GetSize());
+        EXPECT_TRUE(typedResult.SerializeMembers(typedSerializer));
+        EXPECT_EQ(0, typedSerializer.GetUnreadSize());
+        EXPECT_TRUE(typedResult == expected);
+
+        source = expected;
+        NetworkInputSerializer typedInputSerializer(buffer, BufferSize);
+        EXPECT_TRUE(source.SerializeMembers(typedInputSerializer));
+
+        TypedTestObject virtualResult;
+        NetworkOutputSerializer virtualSerializer(buffer, typedInputSerializer.GetSize());
+        EXPECT_TRUE(SerializeVirtual(virtualSerializer, virtualResult));
+        EXPECT_TRUE(virtualResult == expected);
+    }
+
+    TEST_F(TypedSerializerTests, Serialize64BitValues_TypedAndVirtualPaths_MatchLegacyByteOrder)
+    {
+        // 64-bit values have always been written as the raw bits passed through htonll
+        double doubleValue = -2.25;
+        uint64_t doubleBits = 0;
+        memcpy(&doubleBits, &doubleValue, sizeof(double));
+        uint64_t uint64Value = 0x0102030405060708ull;
+        const uint64_t expected[] = { htonll(doubleBits), htonll(uint64Value) };
+
+        uint8_t typedBuffer[BufferSize];
+        NetworkInputSerializer typedSerializer(typedBuffer, BufferSize);
+        EXPECT_TRUE(SerializeTyped(typedSerializer, doubleValue, "double"));
+        EXPECT_TRUE(SerializeTyped(typedSerializer, uint64Value, "uint64"));
+        ASSERT_EQ(sizeof(expected), typedSerializer.GetSize());
+        EXPECT_EQ(0, memcmp(expected, typedBuffer, sizeof(expected)));
+
+        uint8_t virtualBuffer[BufferSize];
+        NetworkInputSerializer virtualSerializer(virtualBuffer, BufferSize);
+        EXPECT_TRUE(static_cast<ISerializer&>(virtualSerializer).Serialize(doubleValue, "double"));
+        EXPECT_TRUE(static_cast<ISerializer&>(virtualSerializer).Serialize(uint64Value, "uint64"));
+        ASSERT_EQ(sizeof(expected), virtualSerializer.GetSize());
+        EXPECT_EQ(0, memcmp(expected, virtualBuffer, sizeof(expected)));
+
+        // Bulk serialized arrays share the encoding
+        AZStd::array<uint64_t, 2> values = { { doubleBits, uint64Value } };
+        NetworkInputSerializer bulkSerializer(typedBuffer, BufferSize);
+        EXPECT_TRUE(SerializeTyped(bulkSerializer, values, "values"));
+        ASSERT_EQ(sizeof(expected), bulkSerializer.GetSize());
+        EXPECT_EQ(0, memcmp(expected, typedBuffer, sizeof(expected)));
+
+        double doubleResult = 0.0;
+        uint64_t uint64Result = 0;
+        NetworkOutputSerializer outputSerializer(virtualBuffer, virtualSerializer.GetSize());
+        EXPECT_TRUE(SerializeTyped(outputSerializer, doubleResult, "double"));
+        EXPECT_TRUE(SerializeTyped(outputSerializer, uint64Result, "uint64"));
+        EXPECT_EQ(doubleValue, doubleResult);
+        EXPECT_EQ(uint64Value, uint64Result);
+    }
+
+    TEST_F(TypedSerializerTests, SerializeMembersTyped_ThroughISerializer_DispatchesOnConcreteType)
+    {
+        uint8_t buffer[BufferSize];
+        DispatchTestObject object;
+
+        NetworkInputSerializer inputSerializer(buffer, BufferSize);
+        EXPECT_TRUE(SerializeMembersTyped(static_cast<ISerializer&>(inputSerializer), object));
+        EXPECT_EQ(SerializerType::NetworkInput, object.m_dispatchedType);
+
+        NetworkOutputSerializer outputSerializer(buffer, inputSerializer.GetSize());
+        EXPECT_TRUE(SerializeMembersTyped(static_cast<ISerializer&>(outputSerializer), object));
+        EXPECT_EQ(SerializerType::NetworkOutput, object.m_dispatchedType);
+        EXPECT_EQ(5, object.m_value);
+
+        HashSerializer hashSerializer;
+        EXPECT_TRUE(SerializeMembersTyped(static_cast<ISerializer&>(hashSerializer), object));
+        EXPECT_EQ(SerializerType::Other, object.m_dispatchedType);
+    }
+
+    TEST_F(TypedSerializerTests, SerializeMembersTyped_TrackChangedSerializer_TracksChanges)
+    {
+        uint8_t buffer[BufferSize];
+        DispatchTestObject object;
+        NetworkInputSerializer inputSerializer(buffer, BufferSize);
+        EXPECT_TRUE(SerializeMembersTyped(static_cast<ISerializer&>(inputSerializer), object));
+
+        // Typed dispatch would bypass the change tracking overrides, so a TrackChangedSerializer must take the virtual path
+        object.m_value = 7;
+        TrackChangedSerializer<NetworkOutputSerializer> trackChangedSerializer(buffer, inputSerializer.GetSize());
+        EXPECT_TRUE(SerializeMembersTyped(static_cast<ISerializer&>(trackChangedSerializer), object));
+        EXPECT_EQ(SerializerType::Other, object.m_dispatchedType);
+        EXPECT_EQ(5, object.m_value);
+        EXPECT_TRUE(trackChangedSerializer.GetTrackedChangesFlag());
+    }
+
+    TEST_F(TypedSerializerTests, SerializeBounded_NarrowRange_SelectsWidthAtCompileTime)
+    {
+        static_assert(sizeof(BoundedValueTraits<int32_t, -100, 100>::WireType) == 1);
+        static_assert(sizeof(BoundedValueTraits<uint32_t, 1000, 60000>::WireType) == 2);
+        static_assert(sizeof(BoundedValueTraits<uint64_t, 0, 0xFFFFFFFF>::WireType) == 4);
+
+        uint8_t buffer[BufferSize];
+        NetworkInputSerializer inputSerializer(buffer, BufferSize);
+        int32_t value = -50;
+        EXPECT_TRUE((inputSerializer.SerializeBounded<int32_t, -100, 100>(value)));
+        EXPECT_EQ(1, inputSerializer.GetSize());
+
+        // The typed and virtual paths share the same encoding
+        NetworkOutputSerializer outputSerializer(buffer, inputSerializer.GetSize());
+        int32_t result = 0;
+        EXPECT_TRUE(static_cast<ISerializer&>(outputSerializer).Serialize(result, "value", -100, 100));
+        EXPECT_EQ(value, result);
+    }
+
+    TEST_F(TypedSerializerTests, SerializeBounded_OutOfRange_InvalidatesSerializer)
+    {
+        uint8_t buffer[BufferSize];
+        NetworkInputSerializer inputSerializer(buffer, BufferSize);
+        int32_t value = 101;
+        EXPECT_FALSE((inputSerializer.SerializeBounded<int32_t, -100, 100>(value)));
+        EXPECT_FALSE(inputSerializer.IsValid());
+
+        // 201 encodes a value above the maximum
+        const uint8_t outOfRange = 201;
+        NetworkOutputSerializer outputSerializer(&outOfRange, sizeof(outOfRange));
+        EXPECT_FALSE((outputSerializer.SerializeBounded<int32_t, -100, 100>(value)));
+        EXPECT_FALSE(outputSerializer.IsValid());
+        EXPECT_EQ(101, value);
+    }
+
+    TEST_F(TypedSerializerTests, SerializeBulk_InsufficientSpace_InvalidatesSerializer)
+    {
+        AZStd::array<float, 8> values = { { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f } };
+        uint8_t buffer[sizeof(values) - 1];
+
+        NetworkInputSerializer inputSerializer(buffer, sizeof(buffer));
+        EXPECT_FALSE(SerializeTyped(inputSerializer, values, "values"));
+        EXPECT_EQ(0, inputSerializer.GetSize());
+
+        NetworkOutputSerializer outputSerializer(buffer, sizeof(buffer));
+        EXPECT_FALSE(SerializeTyped(outputSerializer, values, "values"));
+        EXPECT_EQ(0, outputSerializer.GetReadSize());
+        EXPECT_EQ(1.0f, values[0]);
+    }
+}
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    using namespace AzNetworking;
+
+    AZ_TYPE_SAFE_INTEGRAL(BenchmarkNetEntityId, uint32_t);
+
+    // The network properties of a NetworkTransformComponent
+    struct TransformSnapshot
+    {
+        AZ::Quaternion m_rotation = AZ::Quaternion::CreateFromAxisAngle(AZ::Vector3::CreateAxisZ(), 0.5f);
+        AZ::Vector3 m_translation = AZ::Vector3(128.0f, -64.0f, 32.0f);
+        float m_scale = 1.0f;
+        uint8_t m_resetCount = 0;
+        BenchmarkNetEntityId m_parentEntityId = BenchmarkNetEntityId{ 1024 };
+        int32_t m_parentAttachmentBoneId = -1;
+
+        template <typename SERIALIZER>
+        bool SerializeMembers(SERIALIZER& serializer)
+        {
+            SerializeTyped(serializer, m_rotation, "rotation");
+            SerializeTyped(serializer, m_translation, "translation");
+            SerializeTyped(serializer, m_scale, "scale");
+            SerializeTyped(serializer, m_resetCount, "resetCount");
+            SerializeTyped(serializer, m_parentEntityId, "parentEntityId");
+            SerializeTyped(serializer, m_parentAttachmentBoneId, "parentAttachmentBoneId");
+            return serializer.IsValid();
+        }
+    };
+
+    // Enough transforms to fill a few packets worth of entity updates
+    static constexpr uint32_t SnapshotCount = 256;
+    static constexpr uint32_t SnapshotBufferSize = SnapshotCount * 64;
+
+    class TypedSerializerBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        using UnitTest::AllocatorsBenchmarkFixture::SetUp;
+        using UnitTest::AllocatorsBenchmarkFixture::TearDown;
+
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            m_snapshots.resize(SnapshotCount);
+            m_buffer.resize(SnapshotBufferSize);
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            m_snapshots.set_capacity(0);
+            m_buffer.set_capacity(0);
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        static bool SerializeVirtual(ISerializer& serializer, TransformSnapshot& snapshot)
+        {
+            return snapshot.SerializeMembers(serializer);
+        }
+
+        uint32_t WriteSnapshots()
+        {
+            NetworkInputSerializer serializer(m_buffer.data(), SnapshotBufferSize);
+            for (TransformSnapshot& snapshot : m_snapshots)
+            {
+                snapshot.SerializeMembers(serializer);
+            }
+            return serializer.GetSize();
+        }
+
+        AZStd::vector<TransformSnapshot> m_snapshots;
+        AZStd::vector<uint8_t> m_buffer;
+    };
+
+    // Arg 0 serializes through the virtual ISerializer interfaces, arg 1 through the concrete NetworkInputSerializer.
+    BENCHMARK_DEFINE_F(TypedSerializerBenchmarkFixture, WriteTransformSnapshots)(benchmark::State& state)
+    {
+        const bool typed = state.range(0) != 0;
+        for (auto _ : state)
+        {
+            NetworkInputSerializer serializer(m_buffer.data(), SnapshotBufferSize);
+            for (TransformSnapshot& snapshot : m_snapshots)
+            {
+                if (typed)
+                {
+                    snapshot.SerializeMembers(serializer);
+                }
+                else
+                {
+                    SerializeVirtual(serializer, snapshot);
+                }
+            }
+            benchmark::DoNotOptimize(serializer.GetSize());
+        }
+        state.SetItemsProcessed(state.iterations() * SnapshotCount);
+    }
+    BENCHMARK_REGISTER_F(TypedSerializerBenchmarkFixture, WriteTransformSnapshots)->Arg(0)->Arg(1);
+
+    // Arg 0 deserializes through the virtual ISerializer interfaces, arg 1 through the concrete NetworkOutputSerializer.
+    BENCHMARK_DEFINE_F(TypedSerializerBenchmarkFixture, ReadTransformSnapshots)(benchmark::State& state)
+    {
+        const bool typed = state.range(0) != 0;
+        const uint32_t size = WriteSnapshots();
+        for (auto _ : state)
+        {
+            NetworkOutputSerializer serializer(m_buffer.data(), size);
+            for (TransformSnapshot& snapshot : m_snapshots)
+            {
+                if (typed)
+                {
+                    snapshot.SerializeMembers(serializer);
+                }
+                else
+                {
+                    SerializeVirtual(serializer, snapshot);
+                }
+            }
+            benchmark::DoNotOptimize(m_snapshots.data());
+        }
+        state.SetItemsProcessed(state.iterations() * SnapshotCount);
+    }
+    BENCHMARK_REGISTER_F(TypedSerializerBenchmarkFixture, ReadTransformSnapshots)->Arg(0)->Arg(1);
+}
+#endif
@@ -10,10 +10,12 @@
 #include <AzNetworking/Framework/NetworkingSystemComponent.h>
 #include <AzNetworking/AutoGen/CorePackets.AutoPackets.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/Console/Console.h>
 #include <AzCore/Console/LoggerSystemComponent.h>
 #include <AzCore/Time/TimeSystemComponent.h>
 #include <AzCore/Name/NameDictionary.h>
 #include <AzCore/UnitTest/TestTypes.h>
+#include <Tests/TransportTestTypes.h>
 
 namespace UnitTest
 {
@@ -35,6 +37,14 @@ namespace UnitTest
 
         bool OnPacketReceived([[maybe_unused]] IConnection* connection, const IPacketHeader& packetHeader, [[maybe_unused]] ISerializer& serializer)
         {
+            if (packetHeader.GetPacketType() == TestPayloadPacket::Type)
+            {
+                TestPayloadPacket packet;
+                EXPECT_TRUE(serializer.Serialize(packet, "Packet"));
+                packet.m_bitPacked = packetHeader.IsPacketFlagSet(PacketFlag::BitPacked);
+                m_receivedPackets.push_back(packet);
+                return true;
+            }
             EXPECT_TRUE((packetHeader.GetPacketType() == static_cast<PacketType>(CorePackets::PacketType::InitiateConnectionPacket))
                      || (packetHeader.GetPacketType() == static_cast<PacketType>(CorePackets::PacketType::HeartbeatPacket)));
             return false;
@@ -49,6 +59,8 @@ namespace UnitTest
         {
 
         }
+
+        AZStd::vector<TestPayloadPacket> m_receivedPackets;
     };
 
     class TestTcpClient
@@ -59,7 +71,7 @@ namespace UnitTest
             AZStd::string name = AZStd::string::format("TcpClient%d", ++s_numClients);
             m_name = name;
             m_clientNetworkInterface = AZ::Interface<INetworking>::Get()->CreateNetworkInterface(m_name, ProtocolType::Tcp, TrustZone::ExternalClientToServer, m_connectionListener);
-            m_clientNetworkInterface->Connect(IpAddress(127, 0, 0, 1, 12345));
+            m_connectionId = m_clientNetworkInterface->Connect(IpAddress(127, 0, 0, 1, 12345));
         }
 
         ~TestTcpClient()
@@ -70,6 +82,7 @@ namespace UnitTest
         AZ::Name m_name;
         TestTcpConnectionListener m_connectionListener;
         INetworkInterface* m_clientNetworkInterface;
+        ConnectionId m_connectionId = InvalidConnectionId;
         static inline int32_t s_numClients = 0;
     };
 
@@ -185,4 +198,72 @@ namespace UnitTest
             EXPECT_EQ(testClient[i].m_clientNetworkInterface->GetConnectionSet().GetConnectionCount(), 1);
         }
     }
+
+    #if AZ_TRAIT_DISABLE_FAILED_NETWORKING_TESTS
+    TEST_F(TcpTransportTests, DISABLED_TestBitPackedPackets)
+    #else
+    TEST_F(TcpTransportTests, SUITE_sandbox_TestBitPackedPackets)
+    #endif // AZ_TRAIT_DISABLE_FAILED_NETWORKING_TESTS
+    {
+        // Small and large payloads, each with and without runs the test compressor can shrink
+        const TestPayloadPacket testPackets[] =
+        {
+            TestPayloadPacket(256, 1, true),
+            TestPayloadPacket(256, 64, true),
+            TestPayloadPacket(3000, 1, true),
+            TestPayloadPacket(3000, 64, true)
+        };
+        constexpr uint32_t NumTestPackets = AZ_ARRAY_SIZE(testPackets);
+
+        AZStd::unique_ptr<AZ::Console> console = AZStd::make_unique<AZ::Console>();
+        AZ::Interface<AZ::IConsole>::Register(console.get());
+        console->LinkDeferredFunctors(AZ::ConsoleFunctorBase::GetDeferredHead());
+        console->PerformCommand("net_TcpCompressor TestCompressor");
+        AZ::Interface<INetworking>::Get()->RegisterCompressorFactory(new TestCompressorFactory());
+        TestCompressor::s_decompressedCount = 0;
+
+        {
+            TestTcpServer testServer;
+            TestTcpClient testClient;
+
+            bool sentPackets = false;
+            constexpr AZ::TimeMs TotalIterationTimeMs = AZ::TimeMs{ 5000 };
+            const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
+            for (;;)
+            {
+                AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(25));
+                m_networkingSystemComponent->OnTick(0.0f, AZ::ScriptTimePoint());
+                bool timeExpired = (AZ::GetElapsedTimeMs() - startTimeMs > TotalIterationTimeMs);
+                bool connected = (testServer.m_serverNetworkInterface->GetConnectionSet().GetConnectionCount() == 1)
+                              && (testClient.m_clientNetworkInterface->GetConnectionSet().GetConnectionCount() == 1);
+                if (connected && !sentPackets)
+                {
+                    for (const TestPayloadPacket& testPacket : testPackets)
+                    {
+                        EXPECT_TRUE(testClient.m_clientNetworkInterface->SendReliablePacket(testClient.m_connectionId, testPacket));
+                    }
+                    sentPackets = true;
+                }
+                bool canTerminate = testServer.m_connectionListener.m_receivedPackets.size() == NumTestPackets;
+                if (canTerminate || timeExpired)
+                {
+                    break;
+                }
+            }
+
+            // TCP delivers in order
+            const AZStd::vector<TestPayloadPacket>& receivedPackets = testServer.m_connectionListener.m_receivedPackets;
+            ASSERT_EQ(receivedPackets.size(), NumTestPackets);
+            for (uint32_t i = 0; i < NumTestPackets; ++i)
+            {
+                EXPECT_TRUE(receivedPackets[i] == testPackets[i]);
+                EXPECT_TRUE(receivedPackets[i].m_bitPacked);
+            }
+            EXPECT_GE(TestCompressor::s_decompressedCount.load(), NumTestPackets);
+        }
+
+        AZ::Interface<INetworking>::Get()->UnregisterCompressorFactory(TestCompressorFactory().GetFactoryName());
+        console->PerformCommand("net_TcpCompressor MultiplayerCompressor");
+        AZ::Interface<AZ::IConsole>::Unregister(console.get());
+    }
 }
@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzNetworking/AutoGen/CorePackets.AutoPackets.h>
+#include <AzNetworking/Framework/ICompressor.h>
+#include <AzNetworking/PacketLayer/IPacket.h>
+#include <AzNetworking/Serialization/ISerializer.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <string.h>
+
+namespace UnitTest
+{
+    //! A packet carrying a list of small values, used to push payloads of a chosen size and shape through the transports.
+    class TestPayloadPacket
+        : public AzNetworking::IPacket
+    {
+    public:
+        static constexpr AzNetworking::PacketType Type = AzNetworking::PacketType{ static_cast<uint16_t>(CorePackets::PacketType::MAX) + 1 };
+
+        // Values are serialized within [0, MaxValue], so a bit packed payload needs four bits per value
+        static constexpr uint8_t MaxValue = 15;
+        static constexpr uint32_t MaxValueCount = 4096;
+
+        TestPayloadPacket() = default;
+
+        //! Constructs a packet with valueCount values.
+        //! @param valueCount the number of values to carry
+        //! @param runLength  the number of consecutive values that are equal, longer runs compress better
+        //! @param bitPacked  true if the payload should be bit packed
+        TestPayloadPacket(uint32_t valueCount, uint32_t runLength, bool bitPacked)
+            : m_bitPacked(bitPacked)
+        {
+            m_values.resize(valueCount);
+            for (uint32_t index = 0; index < valueCount; ++index)
+            {
+                m_values[index] = static_cast<uint8_t>((index / runLength) % (MaxValue + 1));
+            }
+        }
+
+        AzNetworking::PacketType GetPacketType() const override
+        {
+            return Type;
+        }
+
+        AZStd::unique_ptr<AzNetworking::IPacket> Clone() const override
+        {
+            return AZStd::make_unique<TestPayloadPacket>(*this);
+        }
+
+        bool Serialize(AzNetworking::ISerializer& serializer) override
+        {
+            uint32_t valueCount = static_cast<uint32_t>(m_values.size());
+            if (!serializer.Serialize(valueCount, "ValueCount", 0, MaxValueCount))
+            {
+                return false;
+            }
+            m_values.resize(valueCount);
+            for (uint8_t& value : m_values)
+            {
+                serializer.Serialize(value, "Value", 0, MaxValue);
+            }
+            return serializer.IsValid();
+        }
+
+        bool IsBitPacked() const override
+        {
+            return m_bitPacked;
+        }
+
+        bool operator==(const TestPayloadPacket& rhs) const
+        {
+            return m_values == rhs.m_values;
+        }
+
+        AZStd::vector<uint8_t> m_values;
+        bool m_bitPacked = false;
+    };
+
+    //! A run length compressor, so the transport tests do not depend on a compression gem being loaded.
+    //! Compressed data starts with a mode byte, followed by either the stored bytes or (run length, value) pairs.
+    class TestCompressor
+        : public AzNetworking::ICompressor
+    {
+    public:
+        static constexpr uint8_t StoredMode = 0;
+        static constexpr uint8_t RunLengthMode = 1;
+
+        bool Init() override
+        {
+            return true;
+        }
+
+        AzNetworking::CompressorType GetType() const override
+        {
+            return AzNetworking::CompressorType{ 0x54455354 };
+        }
+
+        AZStd::size_t GetMaxChunkSize(AZStd::size_t maxCompSize) const override
+        {
+            return (maxCompSize > 0) ? maxCompSize - 1 : 0;
+        }
+
+        AZStd::size_t GetMaxCompressedBufferSize(AZStd::size_t uncompSize) const override
+        {
+            return uncompSize + 1;
+        }
+
+        AzNetworking::CompressorError Compress(const void* uncompData, AZStd::size_t uncompSize, void* compData, AZStd::size_t compDataSize, AZStd::size_t& compSize) override
+        {
+            if ((uncompData == nullptr) || (compData == nullptr))
+            {
+                return AzNetworking::CompressorError::Uninitialized;
+            }
+            if (compDataSize < GetMaxCompressedBufferSize(uncompSize))
+            {
+                return AzNetworking::CompressorError::InsufficientBuffer;
+            }
+
+            const uint8_t* input = static_cast<const uint8_t*>(uncompData);
+            uint8_t* output = static_cast<uint8_t*>(compData);
+            output[0] = RunLengthMode;
+            compSize = 1;
+            for (AZStd::size_t index = 0; index < uncompSize;)
+            {
+                if (compSize + 2 > uncompSize)
+                {
+                    // Run length encoding doesn't pay off for this data, store it instead
+                    output[0] = StoredMode;
+                    memcpy(output + 1, input, uncompSize);
+                    compSize = uncompSize + 1;
+                    return AzNetworking::CompressorError::Ok;
+                }
+
+                AZStd::size_t runLength = 1;
+                while ((index + runLength < uncompSize) && (runLength < 255) && (input[index + runLength] == input[index]))
+                {
+                    ++runLength;
+                }
+                output[compSize++] = static_cast<uint8_t>(runLength);
+                output[compSize++] = input[index];
+                index += runLength;
+            }
+            return AzNetworking::CompressorError::Ok;
+        }
+
+        AzNetworking::CompressorError Decompress(const void* compData, AZStd::size_t compDataSize, void* uncompData, AZStd::size_t uncompDataSize, AZStd::size_t& consumedSize, AZStd::size_t& uncompSize) override
+        {
+            if ((compData == nullptr) || (uncompData == nullptr))
+            {
+                return AzNetworking::CompressorError::Uninitialized;
+            }
+            if (compDataSize == 0)
+            {
+                return AzNetworking::CompressorError::CorruptData;
+            }
+
+            const uint8_t* input = static_cast<const uint8_t*>(compData);
+            uint8_t* output = static_cast<uint8_t*>(uncompData);
+            uncompSize = 0;
+            if (input[0] == StoredMode)
+            {
+                if (compDataSize - 1 > uncompDataSize)
+                {
+                    return AzNetworking::CompressorError::InsufficientBuffer;
+                }
+                memcpy(output, input + 1, compDataSize - 1);
+                uncompSize = compDataSize - 1;
+            }
+            else if ((input[0] == RunLengthMode) && ((compDataSize % 2) == 1))
+            {
+                for (AZStd::size_t index = 1; index < compDataSize; index += 2)
+                {
+                    const AZStd::size_t runLength = input[index];
+                    if (uncompSize + runLength > uncompDataSize)
+                    {
+                        return AzNetworking::CompressorError::InsufficientBuffer;
+                    }
+                    memset(output + uncompSize, input[index + 1], runLength);
+                    uncompSize += runLength;
+                }
+            }
+            else
+            {
+                return AzNetworking::CompressorError::CorruptData;
+            }
+
+            consumedSize = compDataSize;
+            ++s_decompressedCount;
+            return AzNetworking::CompressorError::Ok;
+        }
+
+        //! The number of buffers decompressed by any TestCompressor, receive shards decompress on their own threads.
+        static inline AZStd::atomic<uint32_t> s_decompressedCount{ 0 };
+    };
+
+    class TestCompressorFactory
+        : public AzNetworking::ICompressorFactory
+    {
+    public:
+        AZStd::unique_ptr<AzNetworking::ICompressor> Create() override
+        {
+            return AZStd::make_unique<TestCompressor>();
+        }
+
+        AZ::Name GetFactoryName() const override
+        {
+            return AZ::Name(AZStd::string_view("TestCompressor"));
+        }
+    };
+}
@@ -0,0 +1,469 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/UdpTransport/UdpSocket.h>
+#include <AzNetworking/UdpTransport/UdpReaderThread.h>
+#include <AzNetworking/UdpTransport/UdpReceiveShard.h>
+#include <AzNetworking/ConnectionLayer/IConnection.h>
+#include <AzNetworking/Framework/ICompressor.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <AzNetworking/AutoGen/CorePackets.AutoPackets.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/Time/TimeSystemComponent.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+#endif
+
+namespace UnitTest
+{
+    using namespace AzNetworking;
+
+    static constexpr uint16_t TestReceivePort = 12350;
+    static constexpr uint16_t TestSendPort = 12351;
+    static constexpr uint16_t TestReusePort = 12352;
+
+    // Fills a payload with a pattern derived from its index so payloads can be told apart on the receiving end
+    static void FillPayload(uint8_t* payload, uint32_t size, uint32_t index)
+    {
+        for (uint32_t i = 0; i < size; ++i)
+        {
+            payload[i] = static_cast<uint8_t>(index * 31 + i);
+        }
+    }
+
+    static bool CheckPayload(const uint8_t* payload, uint32_t size, uint32_t index)
+    {
+        for (uint32_t i = 0; i < size; ++i)
+        {
+            if (payload[i] != static_cast<uint8_t>(index * 31 + i))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    class UdpSocketTests
+        : public AllocatorsFixture
+    {
+    public:
+        void SetUp() override
+        {
+            AllocatorsFixture::SetUp();
+            m_timeComponent = AZStd::make_unique<AZ::TimeSystemComponent>();
+            m_receiver = AZStd::make_unique<UdpSocket>();
+            m_sender = AZStd::make_unique<UdpSocket>();
+            m_dtlsEndpoint = AZStd::make_unique<DtlsEndpoint>();
+            ASSERT_TRUE(m_receiver->Open(TestReceivePort, UdpSocket::CanAcceptConnections::True, TrustZone::ExternalClientToServer));
+            ASSERT_TRUE(m_sender->Open(TestSendPort, UdpSocket::CanAcceptConnections::False, TrustZone::ExternalClientToServer));
+        }
+
+        void TearDown() override
+        {
+            m_dtlsEndpoint.reset();
+            m_sender.reset();
+            m_receiver.reset();
+            m_timeComponent.reset();
+            AllocatorsFixture::TearDown();
+        }
+
+        // Sends payloads of the given sizes to the receiver, the payload at index i is filled with FillPayload(i)
+        void SendPayloads(const AZStd::vector<uint32_t>& sizes)
+        {
+            uint8_t payload[MaxUdpTransmissionUnit];
+            for (uint32_t i = 0; i < sizes.size(); ++i)
+            {
+                FillPayload(payload, sizes[i], i);
+                EXPECT_EQ(static_cast<int32_t>(sizes[i]), m_sender->Send(m_receiverAddress, payload, sizes[i], false, *m_dtlsEndpoint, m_connectionQuality));
+            }
+        }
+
+        // Receives payloads with ReceiveBatch until the expected number has arrived or a second has passed
+        uint32_t ReceivePayloads(const AZStd::vector<uint32_t>& expectedSizes)
+        {
+            uint8_t buffer[UdpSocket::MaxReceiveBatchCount * MaxUdpTransmissionUnit];
+            IpAddress addresses[UdpSocket::MaxReceiveBatchCount];
+            int32_t sizes[UdpSocket::MaxReceiveBatchCount];
+
+            uint32_t receivedCount = 0;
+            for (uint32_t attempt = 0; (attempt < 100) && (receivedCount < expectedSizes.size()); ++attempt)
+            {
+                const int32_t batchCount = m_receiver->ReceiveBatch(addresses, sizes, buffer, MaxUdpTransmissionUnit, UdpSocket::MaxReceiveBatchCount);
+                EXPECT_GE(batchCount, 0);
+                for (int32_t i = 0; (i < batchCount) && (receivedCount < expectedSizes.size()); ++i, ++receivedCount)
+                {
+                    EXPECT_EQ(static_cast<int32_t>(expectedSizes[receivedCount]), sizes[i]);
+                    EXPECT_TRUE(CheckPayload(buffer + i * MaxUdpTransmissionUnit, sizes[i], receivedCount));
+                    EXPECT_EQ(m_receiverAddress.GetAddress(ByteOrder::Host), addresses[i].GetAddress(ByteOrder::Host));
+                }
+                if (batchCount <= 0)
+                {
+                    AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(10));
+                }
+            }
+            return receivedCount;
+        }
+
+        // Serializes the packet flags, header and packet into a datagram and sends it to the receiver
+        void SendPacket(UdpPacketHeader& header, IPacket& packet)
+        {
+            uint8_t datagram[MaxUdpTransmissionUnit];
+            NetworkInputSerializer networkSerializer(datagram, sizeof(datagram));
+            ISerializer& serializer = networkSerializer;
+            ASSERT_TRUE(header.SerializePacketFlags(serializer));
+            ASSERT_TRUE(serializer.Serialize(header, "Header"));
+            ASSERT_TRUE(serializer.Serialize(packet, "Payload"));
+            EXPECT_EQ(static_cast<int32_t>(networkSerializer.GetSize()), m_sender->Send(m_receiverAddress, datagram, networkSerializer.GetSize(), false, *m_dtlsEndpoint, m_connectionQuality));
+        }
+
+        struct ShardPacket
+        {
+            UdpReceiveShard::DecodeResult m_result;
+            UdpPacketHeader m_header;
+            UdpPacketHeader m_fragmentHeader;
+            AZStd::vector<uint8_t> m_fragmentPayload;
+        };
+
+        // Swaps the shard buffers until the expected number of packets has been decoded or a second has passed
+        AZStd::vector<ShardPacket> ReceiveShardPackets(UdpReceiveShard& shard, uint32_t expectedCount)
+        {
+            AZStd::vector<ShardPacket> packets;
+            for (uint32_t attempt = 0; (attempt < 50) && (packets.size() < expectedCount); ++attempt)
+            {
+                AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(20));
+                shard.SwapBuffers();
+                for (const UdpReceiveShard::DecodedPacket& packet : shard.GetDecodedPackets())
+                {
+                    EXPECT_EQ(TestSendPort, packet.m_address.GetPort(ByteOrder::Host));
+                    packets.push_back(ShardPacket{ packet.m_result, packet.m_header, packet.m_fragmentHeader,
+                        AZStd::vector<uint8_t>(packet.m_fragmentPayload, packet.m_fragmentPayload + packet.m_fragmentPayloadSize) });
+                }
+            }
+            return packets;
+        }
+
+        AZStd::unique_ptr<AZ::TimeSystemComponent> m_timeComponent;
+        AZStd::unique_ptr<UdpSocket> m_receiver;
+        AZStd::unique_ptr<UdpSocket> m_sender;
+        AZStd::unique_ptr<DtlsEndpoint> m_dtlsEndpoint;
+        IpAddress m_receiverAddress = IpAddress(127, 0, 0, 1, TestReceivePort);
+        IpAddress m_senderAddress = IpAddress(127, 0, 0, 1, TestSendPort);
+        ConnectionQuality m_connectionQuality;
+    };
+
+    TEST_F(UdpSocketTests, ReceiveBatch_NoData_ReturnsZero)
+    {
+        m_receiver->SetBatchedIoEnabled(true);
+
+        uint8_t buffer[4 * MaxUdpTransmissionUnit];
+        IpAddress addresses[4];
+        int32_t sizes[4];
+        EXPECT_EQ(0, m_receiver->ReceiveBatch(addresses, sizes, buffer, MaxUdpTransmissionUnit, 4));
+    }
+
+    TEST_F(UdpSocketTests, Unbatched_SendAndReceiveBatch_DeliversAllPayloadsInOrder)
+    {
+        m_sender->SetBatchedIoEnabled(false);
+        m_receiver->SetBatchedIoEnabled(false);
+
+        const AZStd::vector<uint32_t> sizes = { 100, 1000, 1, MaxUdpTransmissionUnit };
+        SendPayloads(sizes);
+        EXPECT_EQ(0u, m_sender->FlushSends());
+        EXPECT_EQ(sizes.size(), m_sender->GetSendCalls());
+        EXPECT_EQ(sizes.size(), ReceivePayloads(sizes));
+        EXPECT_EQ(sizes.size(), m_receiver->GetRecvPackets());
+    }
+
+    TEST_F(UdpSocketTests, Batched_SendIsDeferredUntilFlush)
+    {
+        m_sender->SetBatchedIoEnabled(true);
+        if (!m_sender->IsBatchedIoEnabled())
+        {
+            GTEST_SKIP() << "Batched I/O is not supported on this platform";
+        }
+
+        const AZStd::vector<uint32_t> sizes = { 500, 500 };
+        SendPayloads(sizes);
+        EXPECT_EQ(0u, m_sender->GetSendCalls());
+        EXPECT_EQ(sizes.size(), m_sender->GetSentPackets());
+
+        AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(10));
+        IpAddress address;
+        uint8_t buffer[MaxUdpTransmissionUnit];
+        EXPECT_EQ(0, m_receiver->Receive(address, buffer, sizeof(buffer)));
+
+        EXPECT_EQ(sizes.size(), m_sender->FlushSends());
+        EXPECT_EQ(sizes.size(), ReceivePayloads(sizes));
+    }
+
+    TEST_F(UdpSocketTests, Batched_SendAndReceiveBatch_DeliversAllPayloadsInOrder)
+    {
+        m_sender->SetBatchedIoEnabled(true);
+        m_receiver->SetBatchedIoEnabled(true);
+        if (!m_sender->IsBatchedIoEnabled())
+        {
+            GTEST_SKIP() << "Batched I/O is not supported on this platform";
+        }
+
+        // A run of equally sized payloads ending in a shorter one can be sent as a single segmented send, the rest can't
+        const AZStd::vector<uint32_t> sizes = { 1000, 1000, 1000, 400, 1000, 20, MaxUdpTransmissionUnit, 1 };
+        SendPayloads(sizes);
+        EXPECT_EQ(sizes.size(), m_sender->FlushSends());
+        EXPECT_LT(m_sender->GetSendCalls(), sizes.size());
+        EXPECT_EQ(sizes.size(), ReceivePayloads(sizes));
+        EXPECT_EQ(sizes.size(), m_receiver->GetRecvPackets());
+        EXPECT_LT(m_receiver->GetRecvCalls(), sizes.size());
+    }
+
+    TEST_F(UdpSocketTests, Batched_MoreThanQueueCapacity_FlushesWhenFull)
+    {
+        m_sender->SetBatchedIoEnabled(true);
+        m_receiver->SetBatchedIoEnabled(true);
+        if (!m_sender->IsBatchedIoEnabled())
+        {
+            GTEST_SKIP() << "Batched I/O is not supported on this platform";
+        }
+
+        const AZStd::vector<uint32_t> sizes(UdpSocket::MaxQueuedSendCount + 10, 200);
+        SendPayloads(sizes);
+        EXPECT_GT(m_sender->GetSendCalls(), 0u);
+        EXPECT_EQ(10u, m_sender->FlushSends());
+        EXPECT_EQ(sizes.size(), ReceivePayloads(sizes));
+    }
+
+    TEST_F(UdpSocketTests, Batched_Close_FlushesQueuedSends)
+    {
+        m_sender->SetBatchedIoEnabled(true);
+        if (!m_sender->IsBatchedIoEnabled())
+        {
+            GTEST_SKIP() << "Batched I/O is not supported on this platform";
+        }
+
+        const AZStd::vector<uint32_t> sizes = { 300, 300, 300 };
+        SendPayloads(sizes);
+        m_sender->Close();
+        EXPECT_EQ(sizes.size(), ReceivePayloads(sizes));
+    }
+
+    TEST_F(UdpSocketTests, Batched_ReaderThread_ReceivesAllPayloads)
+    {
+        m_sender->SetBatchedIoEnabled(true);
+        m_receiver->SetBatchedIoEnabled(true);
+
+        UdpReaderThread readerThread;
+        readerThread.RegisterSocket(m_receiver.get());
+        readerThread.SwapBuffers();
+
+        const AZStd::vector<uint32_t> sizes = { 1000, 1000, 700, 64, 900 };
+        SendPayloads(sizes);
+        m_sender->FlushSends();
+
+        uint32_t receivedCount = 0;
+        for (uint32_t attempt = 0; (attempt < 100) && (receivedCount < sizes.size()); ++attempt)
+        {
+            AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(20));
+            readerThread.SwapBuffers();
+            const UdpReaderThread::ReceivedPackets* packets = readerThread.GetReceivedPackets(m_receiver.get());
+            ASSERT_NE(nullptr, packets);
+            for (const UdpReaderThread::ReceivedPacket& packet : *packets)
+            {
+                ASSERT_LT(receivedCount, sizes.size());
+                EXPECT_EQ(static_cast<int32_t>(sizes[receivedCount]), packet.m_receivedBytes);
+                EXPECT_TRUE(CheckPayload(packet.m_buffer, packet.m_receivedBytes, receivedCount));
+                ++receivedCount;
+            }
+        }
+        EXPECT_EQ(sizes.size(), receivedCount);
+        readerThread.UnregisterSocket(m_receiver.get());
+    }
+
+    TEST_F(UdpSocketTests, ReusePort_SocketsOnSamePort_OnlyBindWithPortReuse)
+    {
+        UdpSocket first;
+        first.SetReusePortEnabled(true);
+        if (!first.IsReusePortEnabled())
+        {
+            GTEST_SKIP() << "Port reuse is not supported on this platform";
+        }
+
+        UdpSocket second;
+        second.SetReusePortEnabled(true);
+        EXPECT_TRUE(first.Open(TestReusePort, UdpSocket::CanAcceptConnections::True, TrustZone::ExternalClientToServer));
+        EXPECT_TRUE(second.Open(TestReusePort, UdpSocket::CanAcceptConnections::True, TrustZone::ExternalClientToServer));
+
+        UdpSocket third;
+        EXPECT_FALSE(third.Open(TestReusePort, UdpSocket::CanAcceptConnections::True, TrustZone::ExternalClientToServer));
+    }
+
+    TEST_F(UdpSocketTests, ReceiveShard_DecodesHeadersAndLeavesUntrackedFragments)
+    {
+        AZStd::unique_ptr<UdpReceiveShard> shard = AZStd::make_unique<UdpReceiveShard>(*m_receiver, nullptr);
+        shard->Start();
+
+        UdpPacketHeader heartbeatHeader(aznumeric_cast<PacketType>(CorePackets::PacketType::HeartbeatPacket), SequenceId{ 7 }, SequenceId{ 3 }, InvalidSequenceId, 0x5, SequenceRolloverCount{ 0 });
+        CorePackets::HeartbeatPacket heartbeat;
+        SendPacket(heartbeatHeader, heartbeat);
+
+        UdpPacketHeader fragmentHeader(aznumeric_cast<PacketType>(CorePackets::PacketType::FragmentedPacket), SequenceId{ 8 }, SequenceId{ 3 }, InvalidSequenceId, 0x5, SequenceRolloverCount{ 0 });
+        CorePackets::FragmentedPacket fragment(SequenceId{ 1 }, SequenceId{ 1 }, 0, 2, ChunkBuffer());
+        SendPacket(fragmentHeader, fragment);
+
+        const uint8_t garbage = 0xFF;
+        EXPECT_EQ(1, m_sender->Send(m_receiverAddress, &garbage, 1, false, *m_dtlsEndpoint, m_connectionQuality));
+
+        const AZStd::vector<ShardPacket> packets = ReceiveShardPackets(*shard, 3);
+        ASSERT_EQ(3u, packets.size());
+        EXPECT_EQ(UdpReceiveShard::DecodeResult::Decoded, packets[0].m_result);
+        EXPECT_EQ(heartbeatHeader.GetPacketType(), packets[0].m_header.GetPacketType());
+        EXPECT_EQ(heartbeatHeader.GetLocalSequenceId(), packets[0].m_header.GetLocalSequenceId());
+        EXPECT_EQ(heartbeatHeader.GetRemoteSequenceId(), packets[0].m_header.GetRemoteSequenceId());
+        EXPECT_EQ(heartbeatHeader.GetSequenceWindow(), packets[0].m_header.GetSequenceWindow());
+
+        // Chunks from addresses without a connection are left to the connection's own fragment queue
+        EXPECT_EQ(UdpReceiveShard::DecodeResult::Decoded, packets[1].m_result);
+        EXPECT_EQ(fragmentHeader.GetPacketType(), packets[1].m_header.GetPacketType());
+
+        EXPECT_EQ(UdpReceiveShard::DecodeResult::Undecoded, packets[2].m_result);
+    }
+
+    TEST_F(UdpSocketTests, ReceiveShard_TrackedAddress_ReassemblesFragments)
+    {
+        AZStd::unique_ptr<UdpReceiveShard> shard = AZStd::make_unique<UdpReceiveShard>(*m_receiver, nullptr);
+        shard->AddConnection(m_senderAddress);
+        shard->Start();
+
+        // Build the packet to fragment, a header followed by a payload that's too large for a single datagram
+        constexpr uint32_t PayloadSize = 2000;
+        UdpPacketHeader innerHeader(aznumeric_cast<PacketType>(CorePackets::PacketType::HeartbeatPacket), SequenceId{ 20 }, SequenceId{ 4 }, InvalidSequenceId, 0x1, SequenceRolloverCount{ 0 });
+        uint8_t innerPacket[PayloadSize + 64];
+        uint32_t innerPacketSize = 0;
+        {
+            NetworkInputSerializer networkSerializer(innerPacket, sizeof(innerPacket));
+            ASSERT_TRUE(innerHeader.SerializePacketFlags(networkSerializer));
+            ASSERT_TRUE(static_cast<ISerializer&>(networkSerializer).Serialize(innerHeader, "Header"));
+            innerPacketSize = networkSerializer.GetSize();
+            FillPayload(innerPacket + innerPacketSize, PayloadSize, 0);
+            innerPacketSize += PayloadSize;
+        }
+
+        // Send the chunks out of order
+        constexpr uint32_t ChunkSize = 800;
+        constexpr uint8_t ChunkCount = 3;
+        const uint8_t chunkOrder[ChunkCount] = { 2, 0, 1 };
+        for (uint8_t i = 0; i < ChunkCount; ++i)
+        {
+            const uint8_t chunkIndex = chunkOrder[i];
+            const uint32_t chunkStart = chunkIndex * ChunkSize;
+            ChunkBuffer chunkBuffer;
+            chunkBuffer.CopyValues(innerPacket + chunkStart, AZStd::min(ChunkSize, innerPacketSize - chunkStart));
+            UdpPacketHeader header(aznumeric_cast<PacketType>(CorePackets::PacketType::FragmentedPacket), SequenceId{ static_cast<uint16_t>(30 + i) }, SequenceId{ 4 }, InvalidSequenceId, 0x1, SequenceRolloverCount{ 0 });
+            CorePackets::FragmentedPacket fragment(SequenceId{ 20 }, SequenceId{ 1 }, chunkIndex, ChunkCount, chunkBuffer);
+            SendPacket(header, fragment);
+        }
+
+        const AZStd::vector<ShardPacket> packets = ReceiveShardPackets(*shard, ChunkCount);
+        ASSERT_EQ(static_cast<size_t>(ChunkCount), packets.size());
+        EXPECT_EQ(UdpReceiveShard::DecodeResult::FragmentPending, packets[0].m_result);
+        EXPECT_EQ(UdpReceiveShard::DecodeResult::FragmentPending, packets[1].m_result);
+        ASSERT_EQ(UdpReceiveShard::DecodeResult::FragmentComplete, packets[2].m_result);
+
+        // The outer header is kept for acking the last chunk, the reassembled header and payload are decoded separately
+        EXPECT_EQ(SequenceId{ 32 }, packets[2].m_header.GetLocalSequenceId());
+        EXPECT_EQ(innerHeader.GetPacketType(), packets[2].m_fragmentHeader.GetPacketType());
+        EXPECT_EQ(innerHeader.GetLocalSequenceId(), packets[2].m_fragmentHeader.GetLocalSequenceId());
+        ASSERT_EQ(PayloadSize, packets[2].m_fragmentPayload.size());
+        EXPECT_TRUE(CheckPayload(packets[2].m_fragmentPayload.data(), PayloadSize, 0));
+    }
+}
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    using namespace AzNetworking;
+
+    class UdpSocketBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        using UnitTest::AllocatorsBenchmarkFixture::SetUp;
+        using UnitTest::AllocatorsBenchmarkFixture::TearDown;
+
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            m_receiver = new UdpSocket();
+            m_sender = new UdpSocket();
+            m_receiver->Open(UnitTest::TestReceivePort, UdpSocket::CanAcceptConnections::True, TrustZone::ExternalClientToServer);
+            m_sender->Open(0, UdpSocket::CanAcceptConnections::False, TrustZone::ExternalClientToServer);
+            m_receiver->SetBatchedIoEnabled(state.range(0) != 0);
+            m_sender->SetBatchedIoEnabled(state.range(0) != 0);
+            m_dtlsEndpoint = new DtlsEndpoint();
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            delete m_dtlsEndpoint;
+            delete m_sender;
+            delete m_receiver;
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        UdpSocket* m_receiver = nullptr;
+        UdpSocket* m_sender = nullptr;
+        DtlsEndpoint* m_dtlsEndpoint = nullptr;
+    };
+
+    // Sends a tick's worth of packets over loopback and reads them all back. Arg 0 is unbatched, arg 1 uses batched I/O where supported.
+    BENCHMARK_DEFINE_F(UdpSocketBenchmarkFixture, LoopbackThroughput)(benchmark::State& state)
+    {
+        constexpr uint32_t PacketsPerTick = 128;
+        constexpr uint32_t PacketSize = 1000;
+
+        const IpAddress receiverAddress(127, 0, 0, 1, UnitTest::TestReceivePort);
+        const ConnectionQuality connectionQuality;
+        uint8_t payload[PacketSize];
+        UnitTest::FillPayload(payload, PacketSize, 0);
+
+        uint8_t buffer[UdpSocket::MaxReceiveBatchCount * MaxUdpTransmissionUnit];
+        IpAddress addresses[UdpSocket::MaxReceiveBatchCount];
+        int32_t sizes[UdpSocket::MaxReceiveBatchCount];
+
+        for (auto _ : state)
+        {
+            for (uint32_t i = 0; i < PacketsPerTick; ++i)
+            {
+                m_sender->Send(receiverAddress, payload, PacketSize, false, *m_dtlsEndpoint, connectionQuality);
+            }
+            m_sender->FlushSends();
+
+            uint32_t receivedCount = 0;
+            while (receivedCount < PacketsPerTick)
+            {
+                const int32_t batchCount = m_receiver->ReceiveBatch(addresses, sizes, buffer, MaxUdpTransmissionUnit, UdpSocket::MaxReceiveBatchCount);
+                if (batchCount <= 0)
+                {
+                    // Anything not delivered by now was dropped by the kernel
+                    break;
+                }
+                receivedCount += batchCount;
+            }
+            benchmark::DoNotOptimize(receivedCount);
+        }
+
+        state.SetItemsProcessed(state.iterations() * PacketsPerTick);
+        state.SetBytesProcessed(state.iterations() * PacketsPerTick * PacketSize);
+        state.counters["SendCalls"] = benchmark::Counter(m_sender->GetSendCalls(), benchmark::Counter::kAvgIterations);
+        state.counters["RecvCalls"] = benchmark::Counter(m_receiver->GetRecvCalls(), benchmark::Counter::kAvgIterations);
+    }
+    BENCHMARK_REGISTER_F(UdpSocketBenchmarkFixture, LoopbackThroughput)->Arg(0)->Arg(1);
+}
+#endif
@@ -13,10 +13,12 @@
 #include <AzNetworking/Framework/NetworkingSystemComponent.h>
 #include <AzNetworking/AutoGen/CorePackets.AutoPackets.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/Console/Console.h>
 #include <AzCore/Console/LoggerSystemComponent.h>
 #include <AzCore/Time/TimeSystemComponent.h>
 #include <AzCore/Name/NameDictionary.h>
 #include <AzCore/UnitTest/TestTypes.h>
+#include <Tests/TransportTestTypes.h>
 
 namespace UnitTest
 {
@@ -38,6 +40,14 @@ namespace UnitTest
 
         bool OnPacketReceived([[maybe_unused]] IConnection* connection, const IPacketHeader& packetHeader, [[maybe_unused]] ISerializer& serializer)
         {
+            if (packetHeader.GetPacketType() == TestPayloadPacket::Type)
+            {
+                TestPayloadPacket packet;
+                EXPECT_TRUE(serializer.Serialize(packet, "Packet"));
+                packet.m_bitPacked = packetHeader.IsPacketFlagSet(PacketFlag::BitPacked);
+                m_receivedPackets.push_back(packet);
+                return true;
+            }
             EXPECT_TRUE((packetHeader.GetPacketType() == static_cast<PacketType>(CorePackets::PacketType::InitiateConnectionPacket))
                      || (packetHeader.GetPacketType() == static_cast<PacketType>(CorePackets::PacketType::HeartbeatPacket)));
             return false;
@@ -52,6 +62,8 @@ namespace UnitTest
         {
 
         }
+
+        AZStd::vector<TestPayloadPacket> m_receivedPackets;
     };
 
     class TestUdpClient
@@ -62,7 +74,7 @@ namespace UnitTest
             AZStd::string name = AZStd::string::format("UdpClient%d", ++s_numClients);
             m_name = name;
             m_clientNetworkInterface = AZ::Interface<INetworking>::Get()->CreateNetworkInterface(m_name, ProtocolType::Udp, TrustZone::ExternalClientToServer, m_connectionListener);
-            m_clientNetworkInterface->Connect(IpAddress(127, 0, 0, 1, 12345));
+            m_connectionId = m_clientNetworkInterface->Connect(IpAddress(127, 0, 0, 1, 12345));
         }
 
         ~TestUdpClient()
@@ -73,6 +85,7 @@ namespace UnitTest
         AZ::Name m_name;
         TestUdpConnectionListener m_connectionListener;
         INetworkInterface* m_clientNetworkInterface;
+        ConnectionId m_connectionId = InvalidConnectionId;
         static inline int32_t s_numClients = 0;
     };
 
@@ -299,4 +312,185 @@ namespace UnitTest
             EXPECT_EQ(testClient[i].m_clientNetworkInterface->GetConnectionSet().GetConnectionCount(), 1);
         }
     }
+
+    TEST_F(UdpTransportTests, TestMultipleClientsWithReceiveShards)
+    {
+        constexpr uint32_t NumTestClients = 20;
+
+        AZStd::unique_ptr<AZ::Console> console = AZStd::make_unique<AZ::Console>();
+        AZ::Interface<AZ::IConsole>::Register(console.get());
+        console->LinkDeferredFunctors(AZ::ConsoleFunctorBase::GetDeferredHead());
+        console->PerformCommand("net_UdpReceiveShards 4");
+
+        {
+            TestUdpServer testServer;
+            TestUdpClient testClient[NumTestClients];
+
+            constexpr AZ::TimeMs TotalIterationTimeMs = AZ::TimeMs{ 5000 };
+            const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
+            for (;;)
+            {
+                AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(25));
+                m_networkingSystemComponent->OnTick(0.0f, AZ::ScriptTimePoint());
+                bool timeExpired = (AZ::GetElapsedTimeMs() - startTimeMs > TotalIterationTimeMs);
+                bool canTerminate = testServer.m_serverNetworkInterface->GetConnectionSet().GetConnectionCount() == NumTestClients;
+                for (uint32_t i = 0; i < NumTestClients; ++i)
+                {
+                    canTerminate &= testClient[i].m_clientNetworkInterface->GetConnectionSet().GetConnectionCount() == 1;
+                }
+                if (canTerminate || timeExpired)
+                {
+                    break;
+                }
+            }
+
+            EXPECT_EQ(testServer.m_serverNetworkInterface->GetConnectionSet().GetConnectionCount(), NumTestClients);
+            for (uint32_t i = 0; i < NumTestClients; ++i)
+            {
+                EXPECT_EQ(testClient[i].m_clientNetworkInterface->GetConnectionSet().GetConnectionCount(), 1);
+            }
+        }
+
+        console->PerformCommand("net_UdpReceiveShards 0");
+        AZ::Interface<AZ::IConsole>::Unregister(console.get());
+    }
+
+    TEST_F(UdpTransportTests, TestFragmentedAndCompressedPacketsWithReceiveShards)
+    {
+        constexpr uint32_t NumTestClients = 4;
+
+        // Small enough to be sent whole and compressed, too large for one datagram, and too large but compressed chunk by chunk
+        const TestPayloadPacket testPackets[] =
+        {
+            TestPayloadPacket(256, 64, false),
+            TestPayloadPacket(3000, 1, false),
+            TestPayloadPacket(3000, 64, false)
+        };
+        constexpr uint32_t NumTestPackets = AZ_ARRAY_SIZE(testPackets);
+
+        AZStd::unique_ptr<AZ::Console> console = AZStd::make_unique<AZ::Console>();
+        AZ::Interface<AZ::IConsole>::Register(console.get());
+        console->LinkDeferredFunctors(AZ::ConsoleFunctorBase::GetDeferredHead());
+        console->PerformCommand("net_UdpReceiveShards 4");
+        console->PerformCommand("net_UdpCompressor TestCompressor");
+        AZ::Interface<INetworking>::Get()->RegisterCompressorFactory(new TestCompressorFactory());
+        TestCompressor::s_decompressedCount = 0;
+
+        {
+            TestUdpServer testServer;
+            TestUdpClient testClient[NumTestClients];
+
+            bool sentPackets = false;
+            constexpr AZ::TimeMs TotalIterationTimeMs = AZ::TimeMs{ 5000 };
+            const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
+            for (;;)
+            {
+                AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(25));
+                m_networkingSystemComponent->OnTick(0.0f, AZ::ScriptTimePoint());
+                bool timeExpired = (AZ::GetElapsedTimeMs() - startTimeMs > TotalIterationTimeMs);
+                bool connected = testServer.m_serverNetworkInterface->GetConnectionSet().GetConnectionCount() == NumTestClients;
+                for (uint32_t i = 0; i < NumTestClients; ++i)
+                {
+                    connected &= testClient[i].m_clientNetworkInterface->GetConnectionSet().GetConnectionCount() == 1;
+                }
+                if (connected && !sentPackets)
+                {
+                    for (uint32_t i = 0; i < NumTestClients; ++i)
+                    {
+                        for (const TestPayloadPacket& testPacket : testPackets)
+                        {
+                            EXPECT_TRUE(testClient[i].m_clientNetworkInterface->SendReliablePacket(testClient[i].m_connectionId, testPacket));
+                        }
+                    }
+                    sentPackets = true;
+                }
+                bool canTerminate = testServer.m_connectionListener.m_receivedPackets.size() == NumTestClients * NumTestPackets;
+                if (canTerminate || timeExpired)
+                {
+                    break;
+                }
+            }
+
+            // Every client's packets must arrive intact, in whatever order the shards handed them over
+            const AZStd::vector<TestPayloadPacket>& receivedPackets = testServer.m_connectionListener.m_receivedPackets;
+            EXPECT_EQ(receivedPackets.size(), NumTestClients * NumTestPackets);
+            for (const TestPayloadPacket& testPacket : testPackets)
+            {
+                const auto matchesTestPacket = [&testPacket](const TestPayloadPacket& receivedPacket) { return receivedPacket == testPacket; };
+                EXPECT_EQ(static_cast<uint32_t>(AZStd::count_if(receivedPackets.begin(), receivedPackets.end(), matchesTestPacket)), NumTestClients);
+            }
+            EXPECT_GT(TestCompressor::s_decompressedCount.load(), 0u);
+        }
+
+        AZ::Interface<INetworking>::Get()->UnregisterCompressorFactory(TestCompressorFactory().GetFactoryName());
+        console->PerformCommand("net_UdpCompressor MultiplayerCompressor");
+        console->PerformCommand("net_UdpReceiveShards 0");
+        AZ::Interface<AZ::IConsole>::Unregister(console.get());
+    }
+
+    TEST_F(UdpTransportTests, TestBitPackedPackets)
+    {
+        // Sent whole, sent whole and compressed, fragmented, and fragmented with every chunk compressed
+        const TestPayloadPacket testPackets[] =
+        {
+            TestPayloadPacket(256, 1, true),
+            TestPayloadPacket(256, 64, true),
+            TestPayloadPacket(3000, 1, true),
+            TestPayloadPacket(3000, 64, true)
+        };
+        constexpr uint32_t NumTestPackets = AZ_ARRAY_SIZE(testPackets);
+
+        AZStd::unique_ptr<AZ::Console> console = AZStd::make_unique<AZ::Console>();
+        AZ::Interface<AZ::IConsole>::Register(console.get());
+        console->LinkDeferredFunctors(AZ::ConsoleFunctorBase::GetDeferredHead());
+        console->PerformCommand("net_UdpCompressor TestCompressor");
+        AZ::Interface<INetworking>::Get()->RegisterCompressorFactory(new TestCompressorFactory());
+        TestCompressor::s_decompressedCount = 0;
+
+        {
+            TestUdpServer testServer;
+            TestUdpClient testClient;
+
+            bool sentPackets = false;
+            constexpr AZ::TimeMs TotalIterationTimeMs = AZ::TimeMs{ 5000 };
+            const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
+            for (;;)
+            {
+                AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(25));
+                m_networkingSystemComponent->OnTick(0.0f, AZ::ScriptTimePoint());
+                bool timeExpired = (AZ::GetElapsedTimeMs() - startTimeMs > TotalIterationTimeMs);
+                bool connected = (testServer.m_serverNetworkInterface->GetConnectionSet().GetConnectionCount() == 1)
+                              && (testClient.m_clientNetworkInterface->GetConnectionSet().GetConnectionCount() == 1);
+                if (connected && !sentPackets)
+                {
+                    for (const TestPayloadPacket& testPacket : testPackets)
+                    {
+                        EXPECT_TRUE(testClient.m_clientNetworkInterface->SendReliablePacket(testClient.m_connectionId, testPacket));
+                    }
+                    sentPackets = true;
+                }
+                bool canTerminate = testServer.m_connectionListener.m_receivedPackets.size() == NumTestPackets;
+                if (canTerminate || timeExpired)
+                {
+                    break;
+                }
+            }
+
+            const AZStd::vector<TestPayloadPacket>& receivedPackets = testServer.m_connectionListener.m_receivedPackets;
+            ASSERT_EQ(receivedPackets.size(), NumTestPackets);
+            for (const TestPayloadPacket& testPacket : testPackets)
+            {
+                EXPECT_NE(AZStd::find(receivedPackets.begin(), receivedPackets.end(), testPacket), receivedPackets.end());
+            }
+            for (const TestPayloadPacket& receivedPacket : receivedPackets)
+            {
+                EXPECT_TRUE(receivedPacket.m_bitPacked);
+            }
+            EXPECT_GT(TestCompressor::s_decompressedCount.load(), 0u);
+        }
+
+        AZ::Interface<INetworking>::Get()->UnregisterCompressorFactory(TestCompressorFactory().GetFactoryName());
+        console->PerformCommand("net_UdpCompressor MultiplayerCompressor");
+        AZ::Interface<AZ::IConsole>::Unregister(console.get());
+    }
 }
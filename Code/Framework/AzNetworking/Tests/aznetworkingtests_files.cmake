@@ -17,10 +17,14 @@ set(FILES
     DataStructures/TimeoutQueueTests.cpp
     Serialization/DeltaSerializerTests.cpp
     Serialization/HashSerializerTests.cpp
+    Serialization/NetworkBitSerializerTests.cpp
     Serialization/NetworkInputSerializerTests.cpp
     Serialization/NetworkOutputSerializerTests.cpp
     Serialization/TrackChangedSerializerTests.cpp
+    Serialization/TypedSerializerTests.cpp
     TcpTransport/TcpTransportTests.cpp
+    TransportTestTypes.h
+    UdpTransport/UdpSocketTests.cpp
     UdpTransport/UdpTransportTests.cpp
     Utilities/CidrAddressTests.cpp
     Utilities/IpAddressTests.cpp
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#if defined(HAVE_BENCHMARK)
+
+#include <Prefab/Benchmark/PrefabBenchmarkFixture.h>
+
+#include <AzCore/Serialization/IdUtils.h>
+#include <AzFramework/Spawnable/Spawnable.h>
+#include <AzToolsFramework/Prefab/Spawnable/SpawnableUtils.h>
+
+namespace Benchmark
+{
+    using namespace AzToolsFramework::Prefab;
+
+    class BM_SpawnableInstantiate
+        : public BM_Prefab
+    {
+    protected:
+        using EntityIdMap = AzFramework::SpawnableClonePlan::EntityIdMap;
+
+        // Creates a spawnable with a chain of entities where every entity is parented to the previous entity, so every clone has
+        // both an entity id to generate and a reference to fix up.
+        void CreateSpawnable(unsigned int numEntities)
+        {
+            AZStd::vector<AZ::Entity*> entities;
+            CreateEntities(numEntities, entities);
+            for (unsigned int i = 1; i < numEntities; ++i)
+            {
+                SetEntityParent(entities[i]->GetId(), entities[i - 1]->GetId());
+            }
+
+            m_instance = m_prefabSystemComponent->CreatePrefab(entities, {}, m_pathString);
+            auto& prefabDom = m_prefabSystemComponent->FindTemplateDom(m_instance->GetTemplateId());
+            m_spawnable = AZStd::make_unique<AzFramework::Spawnable>();
+            AzToolsFramework::Prefab::SpawnableUtils::CreateSpawnable(*m_spawnable, prefabDom);
+        }
+
+        void DestroySpawnable()
+        {
+            m_spawnable.reset();
+            m_instance.reset();
+        }
+
+        static void DeleteClones(AZStd::vector<AZ::Entity*>& clones)
+        {
+            for (AZ::Entity* clone : clones)
+            {
+                delete clone;
+            }
+            clones.clear();
+        }
+
+        AZStd::unique_ptr<Instance> m_instance;
+        AZStd::unique_ptr<AzFramework::Spawnable> m_spawnable;
+    };
+
+    BENCHMARK_DEFINE_F(BM_SpawnableInstantiate, CloneEntities_ReflectionRemap)(::benchmark::State& state)
+    {
+        const unsigned int numEntities = static_cast<unsigned int>(state.range());
+        CreateSpawnable(numEntities);
+
+        const AzFramework::Spawnable& spawnable = *m_spawnable;
+        const AzFramework::Spawnable::EntityList& entities = spawnable.GetEntities();
+        AZ::SerializeContext* serializeContext = m_app->GetSerializeContext();
+
+        EntityIdMap idMap;
+        AZStd::vector<AZ::Entity*> clones;
+        clones.reserve(entities.size());
+        for (auto _ : state)
+        {
+            for (const AZStd::unique_ptr<AZ::Entity>& entity : entities)
+            {
+                clones.push_back(AZ::IdUtils::Remapper<AZ::EntityId, false>::CloneObjectAndGenerateNewIdsAndFixRefs(
+                    entity.get(), idMap, serializeContext));
+            }
+
+            state.PauseTiming();
+            DeleteClones(clones);
+            idMap.clear();
+            state.ResumeTiming();
+        }
+
+        DestroySpawnable();
+        state.SetComplexityN(numEntities);
+    }
+    BENCHMARK_REGISTER_F(BM_SpawnableInstantiate, CloneEntities_ReflectionRemap)
+        ->RangeMultiplier(10)
+        ->Range(100, 10000)
+        ->Unit(benchmark::kMillisecond)
+        ->Complexity();
+
+    BENCHMARK_DEFINE_F(BM_SpawnableInstantiate, CloneEntities_ClonePlan)(::benchmark::State& state)
+    {
+        const unsigned int numEntities = static_cast<unsigned int>(state.range());
+        CreateSpawnable(numEntities);
+
+        const AzFramework::Spawnable& spawnable = *m_spawnable;
+        const AzFramework::Spawnable::EntityList& entities = spawnable.GetEntities();
+        // The plan is normally created when the spawnable is loaded, so keep it out of the measurements.
+        const AZStd::shared_ptr<const AzFramework::SpawnableClonePlan> clonePlan = spawnable.GetClonePlan(*m_app->GetSerializeContext());
+
+        EntityIdMap idMap;
+        AZStd::vector<AZ::Entity*> clones;
+        clones.reserve(entities.size());
+        for (auto _ : state)
+        {
+            for (size_t i = 0; i < entities.size(); ++i)
+            {
+                clones.push_back(clonePlan->CloneEntity(i, *entities[i], idMap));
+            }
+
+            state.PauseTiming();
+            DeleteClones(clones);
+            idMap.clear();
+            state.ResumeTiming();
+        }
+
+        DestroySpawnable();
+        state.SetComplexityN(numEntities);
+    }
+    BENCHMARK_REGISTER_F(BM_SpawnableInstantiate, CloneEntities_ClonePlan)
+        ->RangeMultiplier(10)
+        ->Range(100, 10000)
+        ->Unit(benchmark::kMillisecond)
+        ->Complexity();
+
+    BENCHMARK_DEFINE_F(BM_SpawnableInstantiate, CreateClonePlan)(::benchmark::State& state)
+    {
+        const unsigned int numEntities = static_cast<unsigned int>(state.range());
+        CreateSpawnable(numEntities);
+
+        const AzFramework::Spawnable::EntityList& entities = static_cast<const AzFramework::Spawnable&>(*m_spawnable).GetEntities();
+        AZ::SerializeContext* serializeContext = m_app->GetSerializeContext();
+        for (auto _ : state)
+        {
+            AzFramework::SpawnableClonePlan clonePlan(entities, *serializeContext);
+            benchmark::DoNotOptimize(clonePlan.GetEntityCount());
+        }
+
+        DestroySpawnable();
+        state.SetComplexityN(numEntities);
+    }
+    BENCHMARK_REGISTER_F(BM_SpawnableInstantiate, CreateClonePlan)
+        ->RangeMultiplier(10)
+        ->Range(100, 10000)
+        ->Unit(benchmark::kMillisecond)
+        ->Complexity();
+}
+
+#endif
@@ -11,6 +11,7 @@
 #include <AzCore/Settings/SettingsRegistryMergeUtils.h>
 #include <AzCore/std/string/wildcard.h>
 #include <AzFramework/API/ApplicationAPI.h>
+#include <AzFramework/Asset/FlatAssetRegistry.h>
 #include <AzFramework/FileTag/FileTagBus.h>
 #include <AzFramework/FileTag/FileTag.h>
 #include <AzToolsFramework/API/AssetDatabaseBus.h>
@@ -290,6 +291,24 @@ namespace AssetProcessor
         m_currentlyValidatingPreloadDependency = false;
     }
 
+    void AssetCatalog::SaveFlatRegistry(const QString& workSpace, const QString& platformCacheDir)
+    {
+        QString tempRegistryFile = QString("%1/%2").arg(workSpace).arg("assetcatalog.flat.tmp");
+        QString actualRegistryFile = QString("%1/%2").arg(platformCacheDir).arg("assetcatalog.flat");
+
+        AZ::IO::HandleType fileHandle = AZ::IO::InvalidHandle;
+        if (!AZ::IO::FileIOBase::GetInstance()->Open(tempRegistryFile.toUtf8().data(), AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeBinary, fileHandle))
+        {
+            AZ_Warning(AssetProcessor::ConsoleChannel, false, "Failed to create flat catalog file %s", tempRegistryFile.toUtf8().constData());
+            return;
+        }
+        AZ::IO::FileIOBase::GetInstance()->Write(fileHandle, m_flatSaveBuffer.data(), m_flatSaveBuffer.size());
+        AZ::IO::FileIOBase::GetInstance()->Close(fileHandle);
+
+        [[maybe_unused]] bool moved = AssetUtilities::MoveFileWithTimeout(tempRegistryFile, actualRegistryFile, 3);
+        AZ_Warning(AssetProcessor::ConsoleChannel, moved, "Failed to move %s to %s", tempRegistryFile.toUtf8().constData(), actualRegistryFile.toUtf8().constData());
+    }
+
     void AssetCatalog::SaveRegistry_Impl()
     {
         bool allCatalogsSaved = true;
@@ -321,9 +340,11 @@ namespace AssetProcessor
 
                 // these 3 lines are what writes the entire registry to the memory stream
                 AZ::ObjectStream* objStream = AZ::ObjectStream::Create(&catalogFileStream, *serializeContext, AZ::ObjectStream::ST_BINARY);
+                bool flatRegistryCreated = false;
                 {
                     QMutexLocker locker(&m_registriesMutex);
                     objStream->WriteClass(&m_registries[platform]);
+                    flatRegistryCreated = AzFramework::FlatAssetRegistry::Write(m_registries[platform], m_flatSaveBuffer);
                 }
                 objStream->Finalize();
 
@@ -369,6 +390,13 @@ namespace AssetProcessor
                         if (moved)
                         {
                             AZ_TracePrintf(AssetProcessor::ConsoleChannel, "Saved %s catalog containing %u assets in %fs\n", platform.toUtf8().constData(), m_registries[platform].m_assetIdToInfo.size(), timer.elapsed() / 1000.0f);
+
+                            // The flat catalog is saved after the regular catalog, as the runtime ignores a flat catalog that's older.
+                            // Failing to save it isn't an error, the runtime will load the regular catalog instead.
+                            if (flatRegistryCreated)
+                            {
+                                SaveFlatRegistry(workSpace, platformCacheDir);
+                            }
                         }
                     }
                     else
@@ -86,6 +86,9 @@ namespace AssetProcessor
 
         void RegistrySaveComplete(int assetCatalogVersion, bool allCatalogsSaved);
 
+        //! Writes the flat version of the catalog from m_flatSaveBuffer to the platform cache folder.
+        void SaveFlatRegistry(const QString& workSpace, const QString& platformCacheDir);
+
         //////////////////////////////////////////////////////////////////////////
         // AzToolsFramework::AssetSystem::AssetSystemRequestBus::Handler overrides
         const char* GetAbsoluteDevGameFolderPath() override;
@@ -214,6 +217,7 @@ namespace AssetProcessor
         AZStd::unordered_multimap<AZ::Data::AssetId, QString> m_cachedNoPreloadDependenyAssetList;
 
         AZStd::vector<char> m_saveBuffer; // so that we don't realloc all the time
+        AZStd::vector<char> m_flatSaveBuffer; // the flat version of the catalog, see AzFramework::FlatAssetRegistry
 
         char m_absoluteDevFolderPath[AZ_MAX_PATH_LEN];
         char m_absoluteDevGameFolderPath[AZ_MAX_PATH_LEN];
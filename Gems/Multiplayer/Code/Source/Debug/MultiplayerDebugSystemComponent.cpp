@@ -300,6 +300,14 @@ namespace Multiplayer
                     ImGui::TableNextColumn();
                     ImGui::Text("%llu", aznumeric_cast<AZ::u64>(metrics.m_resentPackets));
                     ImGui::TableNextRow(); ImGui::TableNextColumn();
+                    ImGui::Text("Total send system calls");
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%llu", aznumeric_cast<AZ::u64>(metrics.m_sendSystemCalls));
+                    ImGui::TableNextRow(); ImGui::TableNextColumn();
+                    ImGui::Text("Total packets sent with segmentation offload");
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%llu", aznumeric_cast<AZ::u64>(metrics.m_sendSegmentedPackets));
+                    ImGui::TableNextRow(); ImGui::TableNextColumn();
                     ImGui::Text("Total receive time (ms)");
                     ImGui::TableNextColumn();
                     ImGui::Text("%lld", aznumeric_cast<AZ::s64>(metrics.m_recvTimeMs));
@@ -316,6 +324,10 @@ namespace Multiplayer
                     ImGui::TableNextColumn();
                     ImGui::Text("%llu", aznumeric_cast<AZ::u64>(metrics.m_recvBytesUncompressed));
                     ImGui::TableNextRow(); ImGui::TableNextColumn();
+                    ImGui::Text("Total receive system calls");
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%llu", aznumeric_cast<AZ::u64>(metrics.m_recvSystemCalls));
+                    ImGui::TableNextRow(); ImGui::TableNextColumn();
                     ImGui::Text("Total packets discarded due to load");
                     ImGui::TableNextColumn();
                     ImGui::Text("%llu", aznumeric_cast<AZ::u64>(metrics.m_discardedPackets));
@@ -347,6 +347,22 @@ namespace Multiplayer
 
         // Send out the game state update to all connections
         {
+            // Encoded entity updates are only worth sharing when several client connections will send them
+            uint32_t clientConnectionCount = 0;
+            auto countClientConnections = [&clientConnectionCount](IConnection& connection)
+            {
+                if (connection.GetUserData() != nullptr)
+                {
+                    IConnectionData* connectionData = reinterpret_cast<IConnectionData*>(connection.GetUserData());
+                    if (connectionData->GetConnectionDataType() == ConnectionDataType::ServerToClient)
+                    {
+                        ++clientConnectionCount;
+                    }
+                }
+            };
+            m_networkInterface->GetConnectionSet().VisitConnections(countClientConnections);
+            m_entityUpdateCache.SetConnectionCount(clientConnectionCount);
+
             auto sendNetworkUpdates = [hostTimeMs, &stats](IConnection& connection)
             {
                 if (connection.GetUserData() != nullptr)
@@ -365,6 +381,9 @@ namespace Multiplayer
             };
 
             m_networkInterface->GetConnectionSet().VisitConnections(sendNetworkUpdates);
+
+            // Encoded entity updates are only valid for the entity state they were encoded from
+            m_entityUpdateCache.Clear();
         }
 
         MultiplayerPackets::SyncConsole packet;
@@ -652,6 +671,7 @@ namespace Multiplayer
 
             AZStd::unique_ptr<IReplicationWindow> window = AZStd::make_unique<ServerToClientReplicationWindow>(controlledEntity, connection);
             reinterpret_cast<ServerToClientConnectionData*>(connection->GetUserData())->GetReplicationManager().SetReplicationWindow(AZStd::move(window));
+            reinterpret_cast<ServerToClientConnectionData*>(connection->GetUserData())->GetReplicationManager().SetEntityUpdateCache(&m_entityUpdateCache);
         }
         else
         {
@@ -12,6 +12,7 @@
 #include <Editor/MultiplayerEditorConnection.h>
 #include <NetworkTime/NetworkTime.h>
 #include <NetworkEntity/NetworkEntityManager.h>
+#include <NetworkEntity/EntityReplication/EntityUpdateCache.h>
 #include <Source/AutoGen/Multiplayer.AutoPacketDispatcher.h>
 
 #include <AzCore/Component/Component.h>
@@ -141,6 +142,7 @@ namespace Multiplayer
 
         NetworkEntityManager m_networkEntityManager;
         NetworkTime m_networkTime;
+        EntityUpdateCache m_entityUpdateCache;
         MultiplayerAgentType m_agentType = MultiplayerAgentType::Uninitialized;
         
         IFilterEntityManager* m_filterEntityManager = nullptr; // non-owning pointer
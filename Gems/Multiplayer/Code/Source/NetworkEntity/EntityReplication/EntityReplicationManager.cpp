@@ -8,6 +8,7 @@
 
 #include <Source/NetworkEntity/EntityReplication/EntityReplicationManager.h>
 #include <Source/NetworkEntity/EntityReplication/EntityReplicator.h>
+#include <Source/NetworkEntity/EntityReplication/EntityUpdateCache.h>
 #include <Source/NetworkEntity/EntityReplication/PropertyPublisher.h>
 #include <Source/NetworkEntity/EntityReplication/PropertySubscriber.h>
 #include <Source/AutoGen/Multiplayer.AutoPackets.h>
@@ -36,6 +37,7 @@ namespace Multiplayer
     // Take out a few extra bytes for special headers, we currently only use 1 byte for the count of entity updates
     constexpr uint32_t ReplicationManagerPacketOverhead = 16;
 
+    AZ_CVAR(bool, sv_shareEntityUpdates, true, nullptr, AZ::ConsoleFunctorFlags::Null, "Encode each entity update once per tick and reuse it for every client connection that needs the same update.");
     AZ_CVAR(bool, bg_replicationWindowImmediateAddRemove, true, nullptr, AZ::ConsoleFunctorFlags::Null, "Update replication windows immediately on visibility Add/Removes.");
 
     EntityReplicationManager::EntityReplicationManager(AzNetworking::IConnection& connection, AzNetworking::IConnectionListener& connectionListener, Mode updateMode)
@@ -1069,6 +1071,18 @@ namespace Multiplayer
         return m_replicationWindow.get();
     }
 
+    void EntityReplicationManager::SetEntityUpdateCache(EntityUpdateCache* entityUpdateCache)
+    {
+        m_entityUpdateCache = entityUpdateCache;
+    }
+
+    EntityUpdateCache* EntityReplicationManager::GetEntityUpdateCache() const
+    {
+        // With a single client connection nothing could reuse a stored payload, so skip the cache entirely
+        const bool shareUpdates = sv_shareEntityUpdates && (m_entityUpdateCache != nullptr) && m_entityUpdateCache->IsSharingUpdates();
+        return shareUpdates ? m_entityUpdateCache : nullptr;
+    }
+
     void EntityReplicationManager::MigrateEntityInternal(NetEntityId netEntityId)
     {
         ConstNetworkEntityHandle entityHandle = GetNetworkEntityManager()->GetEntity(netEntityId);
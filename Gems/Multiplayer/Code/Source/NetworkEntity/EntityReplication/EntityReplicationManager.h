@@ -35,6 +35,7 @@ namespace Multiplayer
 {
     class IEntityDomain;
     class EntityReplicator;
+    class EntityUpdateCache;
     
     //! @class EntityReplicationManager
     //! @brief Handles replication of relevant entities for one connection.
@@ -74,6 +75,14 @@ namespace Multiplayer
         void SetReplicationWindow(AZStd::unique_ptr<IReplicationWindow> replicationWindow);
         IReplicationWindow* GetReplicationWindow();
 
+        //! Sets a cache of encoded entity updates shared with other connections, nullptr disables sharing.
+        //! @param entityUpdateCache non-owning pointer to the shared cache, cleared by the owner after each tick's updates are sent
+        void SetEntityUpdateCache(EntityUpdateCache* entityUpdateCache);
+
+        //! Returns the shared cache of encoded entity updates, nullptr if sharing is disabled or no other connection could reuse a payload.
+        //! @return the shared cache, or nullptr if updates should be encoded for this connection alone
+        EntityUpdateCache* GetEntityUpdateCache() const;
+
         void GetEntityReplicatorIdList(AZStd::list<NetEntityId>& outList);
         uint32_t GetEntityReplicatorCount(NetEntityRole localNetworkRole);
 
@@ -199,6 +208,7 @@ namespace Multiplayer
         AzNetworking::IConnection& m_connection;
         AZStd::unique_ptr<IReplicationWindow> m_replicationWindow;
         AZStd::unique_ptr<IEntityDomain> m_remoteEntityDomain;
+        EntityUpdateCache* m_entityUpdateCache = nullptr; // non-owning pointer
 
         AZ::TimeMs m_entityActivationTimeSliceMs = AZ::TimeMs{ 0 };
         AZ::TimeMs m_entityPendingRemovalMs = AZ::TimeMs{ 0 };
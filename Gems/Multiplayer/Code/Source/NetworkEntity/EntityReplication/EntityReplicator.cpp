@@ -8,6 +8,7 @@
 
 #include <Source/NetworkEntity/EntityReplication/EntityReplicator.h>
 #include <Source/NetworkEntity/EntityReplication/EntityReplicationManager.h>
+#include <Source/NetworkEntity/EntityReplication/EntityUpdateCache.h>
 #include <Source/NetworkEntity/EntityReplication/PropertyPublisher.h>
 #include <Source/NetworkEntity/EntityReplication/PropertySubscriber.h>
 #include <Source/NetworkEntity/NetworkEntityAuthorityTracker.h>
@@ -430,9 +431,37 @@ namespace Multiplayer
             updateMessage.SetPrefabEntityId(netBindComponent->GetPrefabEntityId());
         }
 
-        AzNetworking::NetworkInputSerializer inputSerializer(updateMessage.ModifyData().GetBuffer(), static_cast<uint32_t>(updateMessage.ModifyData().GetCapacity()));
+        AzNetworking::PacketEncodingBuffer& updateData = updateMessage.ModifyData();
+
+        // Autonomous updates only ever go to a single connection, so only proxy updates are worth sharing
+        EntityUpdateCache* updateCache = m_replicationManager.GetEntityUpdateCache();
+        if ((updateCache != nullptr) && (GetRemoteNetworkRole() != NetEntityRole::Autonomous))
+        {
+            AzNetworking::NetworkInputSerializer recordSerializer(updateData.GetBuffer(), static_cast<uint32_t>(updateData.GetCapacity()));
+            if (m_propertyPublisher->SerializePendingRecord(recordSerializer))
+            {
+                const NetEntityId netEntityId = GetEntityHandle().GetNetEntityId();
+                const uint32_t recordSize = recordSerializer.GetSize();
+                if (const AZStd::vector<uint8_t>* payload = updateCache->FindPayload(netEntityId, GetRemoteNetworkRole(), updateData.GetBuffer(), recordSize))
+                {
+                    // Another connection already encoded this record this tick, the payload is identical
+                    updateData.CopyValues(payload->data(), payload->size());
+                    return updateMessage;
+                }
+
+                AzNetworking::NetworkInputSerializer inputSerializer(updateData.GetBuffer(), static_cast<uint32_t>(updateData.GetCapacity()));
+                if (m_propertyPublisher->UpdateSerialization(inputSerializer))
+                {
+                    updateCache->StorePayload(netEntityId, GetRemoteNetworkRole(), recordSize, updateData.GetBuffer(), inputSerializer.GetSize());
+                }
+                updateData.Resize(inputSerializer.GetSize());
+                return updateMessage;
+            }
+        }
+
+        AzNetworking::NetworkInputSerializer inputSerializer(updateData.GetBuffer(), static_cast<uint32_t>(updateData.GetCapacity()));
         m_propertyPublisher->UpdateSerialization(inputSerializer);
-        updateMessage.ModifyData().Resize(inputSerializer.GetSize());
+        updateData.Resize(inputSerializer.GetSize());
 
         return updateMessage;
     }
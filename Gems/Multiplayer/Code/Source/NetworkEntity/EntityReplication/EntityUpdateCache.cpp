@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/NetworkEntity/EntityReplication/EntityUpdateCache.h>
+#include <string.h>
+
+namespace Multiplayer
+{
+    const AZStd::vector<uint8_t>* EntityUpdateCache::FindPayload(NetEntityId netEntityId, NetEntityRole remoteRole, const uint8_t* record, uint32_t recordSize)
+    {
+        auto entityIter = m_encodedPayloads.find(netEntityId);
+        if (entityIter == m_encodedPayloads.end())
+        {
+            return nullptr;
+        }
+
+        for (const EncodedPayload& encodedPayload : entityIter->second)
+        {
+            if ((encodedPayload.m_remoteRole == remoteRole)
+             && (encodedPayload.m_recordSize == recordSize)
+             && (memcmp(encodedPayload.m_payload.data(), record, recordSize) == 0))
+            {
+                ++m_reuseCount;
+                return &encodedPayload.m_payload;
+            }
+        }
+        return nullptr;
+    }
+
+    void EntityUpdateCache::StorePayload(NetEntityId netEntityId, NetEntityRole remoteRole, uint32_t recordSize, const uint8_t* payload, uint32_t payloadSize)
+    {
+        AZ_Assert(recordSize <= payloadSize, "Encoded record must be a prefix of the payload");
+        EncodedPayload& encodedPayload = m_encodedPayloads[netEntityId].emplace_back();
+        encodedPayload.m_remoteRole = remoteRole;
+        encodedPayload.m_recordSize = recordSize;
+        encodedPayload.m_payload.assign(payload, payload + payloadSize);
+        ++m_storeCount;
+    }
+
+    void EntityUpdateCache::SetConnectionCount(uint32_t connectionCount)
+    {
+        m_connectionCount = connectionCount;
+    }
+
+    bool EntityUpdateCache::IsSharingUpdates() const
+    {
+        return m_connectionCount > 1;
+    }
+
+    void EntityUpdateCache::Clear()
+    {
+        m_encodedPayloads.clear();
+        m_reuseCount = 0;
+        m_storeCount = 0;
+    }
+
+    uint32_t EntityUpdateCache::GetReuseCount() const
+    {
+        return m_reuseCount;
+    }
+
+    uint32_t EntityUpdateCache::GetStoreCount() const
+    {
+        return m_storeCount;
+    }
+}
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/MultiplayerTypes.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace Multiplayer
+{
+    //! @class EntityUpdateCache
+    //! @brief Encoded entity update payloads shared by every connection replicating an entity during one tick.
+    //!
+    //! An update payload is the encoded replication record followed by the properties that record marks as dirty. Within a
+    //! single tick the property values are the same for every connection, so two connections that prepared the same record
+    //! for the same entity and remote role produce identical payloads. The first connection to encode a payload stores it
+    //! here and later connections copy it instead of serializing the entity again.
+    //!
+    //! The owner must call Clear() once the tick's updates have been sent, before any entity state can change. A payload is only
+    //! worth storing when another connection can reuse it, so the owner also reports how many connections will send this tick.
+    class EntityUpdateCache
+    {
+    public:
+
+        EntityUpdateCache() = default;
+        ~EntityUpdateCache() = default;
+
+        //! Returns a payload stored this tick for the given entity, remote role and encoded record.
+        //! @param netEntityId the network entity id of the entity being encoded
+        //! @param remoteRole  the remote role the record was prepared for
+        //! @param record      the encoded replication record, which prefixes the payload
+        //! @param recordSize  the size of the encoded replication record in bytes
+        //! @return pointer to the stored payload if one matches, nullptr otherwise
+        const AZStd::vector<uint8_t>* FindPayload(NetEntityId netEntityId, NetEntityRole remoteRole, const uint8_t* record, uint32_t recordSize);
+
+        //! Stores an encoded payload so later connections this tick can reuse it.
+        //! @param netEntityId the network entity id of the encoded entity
+        //! @param remoteRole  the remote role the record was prepared for
+        //! @param recordSize  the size of the encoded replication record at the start of the payload
+        //! @param payload     the encoded payload
+        //! @param payloadSize the size of the encoded payload in bytes
+        void StorePayload(NetEntityId netEntityId, NetEntityRole remoteRole, uint32_t recordSize, const uint8_t* payload, uint32_t payloadSize);
+
+        //! Sets the number of connections that will encode entity updates before the next call to Clear().
+        //! @param connectionCount the number of client connections sending updates this tick
+        void SetConnectionCount(uint32_t connectionCount);
+
+        //! Returns true if more than one connection will encode entity updates, so stored payloads can be reused.
+        //! @return true if payloads should be looked up and stored this tick
+        bool IsSharingUpdates() const;
+
+        //! Discards every stored payload, must be called whenever entity state may have changed.
+        void Clear();
+
+        //! Returns the number of payloads reused since the last call to Clear().
+        //! @return the number of payloads reused since the last call to Clear()
+        uint32_t GetReuseCount() const;
+
+        //! Returns the number of payloads stored since the last call to Clear().
+        //! @return the number of payloads stored since the last call to Clear()
+        uint32_t GetStoreCount() const;
+
+    private:
+
+        AZ_DISABLE_COPY_MOVE(EntityUpdateCache);
+
+        struct EncodedPayload
+        {
+            NetEntityRole m_remoteRole = NetEntityRole::InvalidRole;
+            uint32_t m_recordSize = 0;
+            AZStd::vector<uint8_t> m_payload;
+        };
+
+        // Connections that have acknowledged different updates prepare different records, so an entity may have several payloads
+        using EncodedPayloadList = AZStd::vector<EncodedPayload>;
+        AZStd::unordered_map<NetEntityId, EncodedPayloadList> m_encodedPayloads;
+        uint32_t m_connectionCount = 0;
+        uint32_t m_reuseCount = 0;
+        uint32_t m_storeCount = 0;
+    };
+}
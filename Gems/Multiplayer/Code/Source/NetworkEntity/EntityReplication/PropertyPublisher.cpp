@@ -318,6 +318,19 @@ namespace Multiplayer
         return success;
     }
 
+    bool PropertyPublisher::SerializePendingRecord(AzNetworking::ISerializer& serializer)
+    {
+        // Deletes and unprepared publishers don't write a state delta payload
+        if ((m_serializationPhase != PropertyPublisher::EntityReplicatorSerializationPhase::Prepared)
+         || ((m_replicatorState != PropertyPublisher::EntityReplicatorState::Creating)
+          && (m_replicatorState != PropertyPublisher::EntityReplicatorState::Updating)))
+        {
+            return false;
+        }
+        m_pendingRecord.ResetConsumedBits();
+        return m_pendingRecord.Serialize(serializer);
+    }
+
     void PropertyPublisher::FinalizeSerialization(AzNetworking::PacketId sentId)
     {
         switch (m_replicatorState)
@@ -47,6 +47,12 @@ namespace Multiplayer
         void FinalizeSerialization(AzNetworking::PacketId sentId);
         //! @}
 
+        //! Serializes only the pending record, which prefixes the payload written by UpdateSerialization.
+        //! The payload depends only on this record and the entity state, so it is used to share payloads between connections.
+        //! @param serializer ISerializer instance to use for serialization
+        //! @return boolean true if a state delta update is prepared and the record was serialized, false otherwise
+        bool SerializePendingRecord(AzNetworking::ISerializer& serializer);
+
     private:
         enum class EntityReplicatorState
         {
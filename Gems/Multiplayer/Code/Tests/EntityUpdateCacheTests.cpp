@@ -0,0 +1,422 @@
+#include <AzCore/Console/Console.h>
+#include <AzCore/Name/NameDictionary.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/map.h>
+#include <AzCore/std/limits.h>
+#include <AzNetworking/DataStructures/ByteBuffer.h>
+#include <AzNetworking/Framework/NetworkingSystemComponent.h>
+#include <AzTest/AzTest.h>
+#include <Multiplayer/Components/NetBindComponent.h>
+#include <Multiplayer/Components/NetworkTransformComponent.h>
+#include <Multiplayer/NetworkEntity/NetworkEntityUpdateMessage.h>
+#include <Multiplayer/NetworkEntity/EntityReplication/ReplicationRecord.h>
+#include <Multiplayer/ReplicationWindows/IReplicationWindow.h>
+#include <MultiplayerSystemComponent.h>
+#include <NetworkEntity/EntityReplication/EntityReplicationManager.h>
+#include <NetworkEntity/EntityReplication/EntityUpdateCache.h>
+#include <NetworkEntity/NetworkEntityTracker.h>
+#include <Source/AutoGen/Multiplayer.AutoPackets.h>
+#include <IMultiplayerConnectionMock.h>
+
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+#endif
+
+namespace UnitTest
+{
+    using namespace Multiplayer;
+
+    class EntityUpdateCacheTests
+        : public AllocatorsFixture
+    {
+    public:
+        // Two byte record followed by two bytes of property data
+        const AZStd::array<uint8_t, 4> m_payload = { 0x01, 0x02, 0xA0, 0xB0 };
+        const AZStd::array<uint8_t, 4> m_otherPayload = { 0x01, 0x03, 0xC0, 0xD0 };
+        static constexpr uint32_t RecordSize = 2;
+    };
+
+    TEST_F(EntityUpdateCacheTests, FindPayload_NothingStored_ReturnsNull)
+    {
+        EntityUpdateCache cache;
+        EXPECT_EQ(cache.FindPayload(NetEntityId{ 1 }, NetEntityRole::Client, m_payload.data(), RecordSize), nullptr);
+        EXPECT_EQ(cache.GetReuseCount(), 0u);
+    }
+
+    TEST_F(EntityUpdateCacheTests, FindPayload_SameRecord_ReturnsStoredPayload)
+    {
+        EntityUpdateCache cache;
+        cache.StorePayload(NetEntityId{ 1 }, NetEntityRole::Client, RecordSize, m_payload.data(), static_cast<uint32_t>(m_payload.size()));
+
+        const AZStd::vector<uint8_t>* payload = cache.FindPayload(NetEntityId{ 1 }, NetEntityRole::Client, m_payload.data(), RecordSize);
+        ASSERT_NE(payload, nullptr);
+        EXPECT_EQ(payload->size(), m_payload.size());
+        EXPECT_EQ(memcmp(payload->data(), m_payload.data(), m_payload.size()), 0);
+        EXPECT_EQ(cache.GetStoreCount(), 1u);
+        EXPECT_EQ(cache.GetReuseCount(), 1u);
+    }
+
+    TEST_F(EntityUpdateCacheTests, FindPayload_DifferentEntityRoleOrRecord_ReturnsNull)
+    {
+        EntityUpdateCache cache;
+        cache.StorePayload(NetEntityId{ 1 }, NetEntityRole::Client, RecordSize, m_payload.data(), static_cast<uint32_t>(m_payload.size()));
+
+        EXPECT_EQ(cache.FindPayload(NetEntityId{ 2 }, NetEntityRole::Client, m_payload.data(), RecordSize), nullptr);
+        EXPECT_EQ(cache.FindPayload(NetEntityId{ 1 }, NetEntityRole::Server, m_payload.data(), RecordSize), nullptr);
+        EXPECT_EQ(cache.FindPayload(NetEntityId{ 1 }, NetEntityRole::Client, m_otherPayload.data(), RecordSize), nullptr);
+        EXPECT_EQ(cache.FindPayload(NetEntityId{ 1 }, NetEntityRole::Client, m_payload.data(), RecordSize + 1), nullptr);
+        EXPECT_EQ(cache.GetReuseCount(), 0u);
+    }
+
+    TEST_F(EntityUpdateCacheTests, FindPayload_MultipleRecordsForEntity_ReturnsMatchingPayload)
+    {
+        EntityUpdateCache cache;
+        cache.StorePayload(NetEntityId{ 1 }, NetEntityRole::Client, RecordSize, m_payload.data(), static_cast<uint32_t>(m_payload.size()));
+        cache.StorePayload(NetEntityId{ 1 }, NetEntityRole::Client, RecordSize, m_otherPayload.data(), static_cast<uint32_t>(m_otherPayload.size()));
+
+        const AZStd::vector<uint8_t>* payload = cache.FindPayload(NetEntityId{ 1 }, NetEntityRole::Client, m_otherPayload.data(), RecordSize);
+        ASSERT_NE(payload, nullptr);
+        EXPECT_EQ(memcmp(payload->data(), m_otherPayload.data(), m_otherPayload.size()), 0);
+    }
+
+    TEST_F(EntityUpdateCacheTests, Clear_DiscardsStoredPayloads)
+    {
+        EntityUpdateCache cache;
+        cache.StorePayload(NetEntityId{ 1 }, NetEntityRole::Client, RecordSize, m_payload.data(), static_cast<uint32_t>(m_payload.size()));
+        cache.Clear();
+
+        EXPECT_EQ(cache.FindPayload(NetEntityId{ 1 }, NetEntityRole::Client, m_payload.data(), RecordSize), nullptr);
+        EXPECT_EQ(cache.GetStoreCount(), 0u);
+    }
+
+    TEST_F(EntityUpdateCacheTests, IsSharingUpdates_RequiresMoreThanOneConnection)
+    {
+        EntityUpdateCache cache;
+        EXPECT_FALSE(cache.IsSharingUpdates());
+        cache.SetConnectionCount(1);
+        EXPECT_FALSE(cache.IsSharingUpdates());
+        cache.SetConnectionCount(2);
+        EXPECT_TRUE(cache.IsSharingUpdates());
+    }
+
+    //! A replication window that always holds the same entities, each replicated to the client as a proxy.
+    class FixedReplicationWindow
+        : public IReplicationWindow
+    {
+    public:
+        explicit FixedReplicationWindow(const ReplicationSet& replicationSet)
+            : m_replicationSet(replicationSet)
+        {
+            ;
+        }
+
+        bool ReplicationSetUpdateReady() override
+        {
+            return true;
+        }
+
+        const ReplicationSet& GetReplicationSet() const override
+        {
+            return m_replicationSet;
+        }
+
+        uint32_t GetMaxProxyEntityReplicatorSendCount() const override
+        {
+            return AZStd::numeric_limits<uint32_t>::max();
+        }
+
+        bool IsInWindow(const ConstNetworkEntityHandle& entityHandle, NetEntityRole& outNetworkRole) const override
+        {
+            auto iter = m_replicationSet.find(entityHandle);
+            if (iter == m_replicationSet.end())
+            {
+                return false;
+            }
+            outNetworkRole = iter->second.m_netEntityRole;
+            return true;
+        }
+
+        void UpdateWindow() override
+        {
+            ;
+        }
+
+        void DebugDraw() const override
+        {
+            ;
+        }
+
+    private:
+        ReplicationSet m_replicationSet;
+    };
+
+    //! A dedicated server replicating networked entities to client connections through EntityReplicationManager.
+    //! No client ever acknowledges an update, so each tick every replicator resends the full state of its entity.
+    class EntityReplicationServer
+    {
+    public:
+        //! The update payload last sent to a client for each entity.
+        using EntityPayloads = AZStd::map<NetEntityId, AZStd::vector<uint8_t>>;
+
+        //! Creates the server, its entities and one replication manager per client connection.
+        //! @param entityCount        the number of networked entities to replicate
+        //! @param clientCount        the number of client connections to replicate to
+        //! @param shareEntityUpdates the value of sv_shareEntityUpdates
+        //! @param recordPayloads     true if the update payloads sent to each client should be recorded
+        EntityReplicationServer(uint32_t entityCount, uint32_t clientCount, bool shareEntityUpdates, bool recordPayloads)
+        {
+            AZ::NameDictionary::Create();
+            m_console = AZStd::make_unique<AZ::Console>();
+            AZ::Interface<AZ::IConsole>::Register(m_console.get());
+            m_console->LinkDeferredFunctors(AZ::ConsoleFunctorBase::GetDeferredHead());
+            m_console->PerformCommand(shareEntityUpdates ? "sv_shareEntityUpdates true" : "sv_shareEntityUpdates false");
+
+            m_netComponent = AZStd::make_unique<AzNetworking::NetworkingSystemComponent>();
+            m_mpComponent = AZStd::make_unique<MultiplayerSystemComponent>();
+            m_mpComponent->Activate();
+            m_mpComponent->InitializeMultiplayer(MultiplayerAgentType::DedicatedServer);
+
+            ReplicationSet replicationSet;
+            for (uint32_t entityIndex = 0; entityIndex < entityCount; ++entityIndex)
+            {
+                AZ::Entity* entity = m_entities.emplace_back(AZStd::make_unique<AZ::Entity>()).get();
+                entity->CreateComponent<NetBindComponent>();
+                entity->CreateComponent<NetworkTransformComponent>();
+                GetNetworkEntityManager()->SetupNetEntity(entity, PrefabEntityId(AZ::Name("EntityReplicationServer"), entityIndex), NetEntityRole::Authority);
+
+                const NetEntityId netEntityId = entity->FindComponent<NetBindComponent>()->GetNetEntityId();
+                m_netEntityIds.push_back(netEntityId);
+                replicationSet[GetNetworkEntityManager()->GetEntity(netEntityId)].m_netEntityRole = NetEntityRole::Client;
+            }
+
+            for (uint32_t clientIndex = 0; clientIndex < clientCount; ++clientIndex)
+            {
+                Client& client = *m_clients.emplace_back(AZStd::make_unique<Client>());
+                client.m_recordPayloads = recordPayloads;
+                client.m_connection = AZStd::make_unique<::testing::NiceMock<IMultiplayerConnectionMock>>
+                (
+                    aznumeric_cast<AzNetworking::ConnectionId>(clientIndex + 1), AzNetworking::IpAddress(), AzNetworking::ConnectionRole::Acceptor
+                );
+                ON_CALL(*client.m_connection, GetConnectionMtu()).WillByDefault(::testing::Return(1200u));
+                ON_CALL(*client.m_connection, SendUnreliablePacket(::testing::_)).WillByDefault(::testing::Invoke(&client, &Client::OnSendUnreliablePacket));
+
+                client.m_replicationManager = AZStd::make_unique<EntityReplicationManager>
+                (
+                    *client.m_connection, *m_mpComponent, EntityReplicationManager::Mode::LocalServerToRemoteClient
+                );
+                client.m_replicationManager->SetEntityUpdateCache(&m_entityUpdateCache);
+                client.m_replicationManager->SetReplicationWindow(AZStd::make_unique<FixedReplicationWindow>(replicationSet));
+            }
+        }
+
+        ~EntityReplicationServer()
+        {
+            // Replicators are bound to the entities' NetBindComponents, so they must go first
+            m_clients.clear();
+            for (NetEntityId netEntityId : m_netEntityIds)
+            {
+                GetNetworkEntityManager()->GetNetworkEntityTracker()->erase(netEntityId);
+            }
+            m_entities.clear();
+
+            m_mpComponent->Deactivate();
+            m_mpComponent.reset();
+            m_netComponent.reset();
+
+            m_console->PerformCommand("sv_shareEntityUpdates true");
+            AZ::Interface<AZ::IConsole>::Unregister(m_console.get());
+            m_console.reset();
+            AZ::NameDictionary::Destroy();
+        }
+
+        //! Sends one tick of entity updates to every client, the way MultiplayerSystemComponent does.
+        void SendUpdates()
+        {
+            m_entityUpdateCache.SetConnectionCount(static_cast<uint32_t>(m_clients.size()));
+            for (AZStd::unique_ptr<Client>& client : m_clients)
+            {
+                client->m_replicationManager->SendUpdates(AZ::TimeMs{ 0 });
+            }
+            m_storeCount += m_entityUpdateCache.GetStoreCount();
+            m_reuseCount += m_entityUpdateCache.GetReuseCount();
+            m_entityUpdateCache.Clear();
+        }
+
+        //! Returns the update payloads recorded for a client, then forgets them.
+        //! @param clientIndex the index of the client connection
+        //! @return the update payload last sent to the client for each entity
+        EntityPayloads TakePayloads(uint32_t clientIndex)
+        {
+            return AZStd::move(m_clients[clientIndex]->m_payloads);
+        }
+
+        uint32_t GetStoreCount() const
+        {
+            return m_storeCount;
+        }
+
+        uint32_t GetReuseCount() const
+        {
+            return m_reuseCount;
+        }
+
+    private:
+
+        struct Client
+        {
+            AzNetworking::PacketId OnSendUnreliablePacket(const AzNetworking::IPacket& packet)
+            {
+                if (m_recordPayloads && (packet.GetPacketType() == MultiplayerPackets::EntityUpdates::Type))
+                {
+                    const MultiplayerPackets::EntityUpdates& updatePacket = static_cast<const MultiplayerPackets::EntityUpdates&>(packet);
+                    for (const NetworkEntityUpdateMessage& updateMessage : updatePacket.GetEntityMessages())
+                    {
+                        if (const AzNetworking::PacketEncodingBuffer* updateData = updateMessage.GetData())
+                        {
+                            m_payloads[updateMessage.GetEntityId()].assign(updateData->GetBuffer(), updateData->GetBuffer() + updateData->GetSize());
+                        }
+                    }
+                }
+                return aznumeric_cast<AzNetworking::PacketId>(++m_sentPacketCount);
+            }
+
+            AZStd::unique_ptr<::testing::NiceMock<IMultiplayerConnectionMock>> m_connection;
+            AZStd::unique_ptr<EntityReplicationManager> m_replicationManager;
+            EntityPayloads m_payloads;
+            uint32_t m_sentPacketCount = 0;
+            bool m_recordPayloads = false;
+        };
+
+        AZStd::unique_ptr<AZ::Console> m_console;
+        AZStd::unique_ptr<AzNetworking::NetworkingSystemComponent> m_netComponent;
+        AZStd::unique_ptr<MultiplayerSystemComponent> m_mpComponent;
+        AZStd::vector<AZStd::unique_ptr<AZ::Entity>> m_entities;
+        AZStd::vector<NetEntityId> m_netEntityIds;
+        AZStd::vector<AZStd::unique_ptr<Client>> m_clients;
+        EntityUpdateCache m_entityUpdateCache;
+        uint32_t m_storeCount = 0;
+        uint32_t m_reuseCount = 0;
+    };
+
+    class EntityUpdateSharingTests
+        : public AllocatorsFixture
+    {
+    public:
+        static constexpr uint32_t EntityCount = 8;
+        static constexpr uint32_t ClientCount = 2;
+        static constexpr uint32_t TickCount = 3;
+
+        // Returns the payloads sent to each client on each tick, indexed by tick * ClientCount + client
+        AZStd::vector<EntityReplicationServer::EntityPayloads> SendTicks(bool shareEntityUpdates, uint32_t& outStoreCount, uint32_t& outReuseCount)
+        {
+            AZStd::vector<EntityReplicationServer::EntityPayloads> payloads;
+            EntityReplicationServer server(EntityCount, ClientCount, shareEntityUpdates, true);
+            for (uint32_t tick = 0; tick < TickCount; ++tick)
+            {
+                server.SendUpdates();
+                for (uint32_t clientIndex = 0; clientIndex < ClientCount; ++clientIndex)
+                {
+                    payloads.push_back(server.TakePayloads(clientIndex));
+                }
+            }
+            outStoreCount = server.GetStoreCount();
+            outReuseCount = server.GetReuseCount();
+            return payloads;
+        }
+    };
+
+    TEST_F(EntityUpdateSharingTests, SendUpdates_TwoClients_SharedAndUnsharedPayloadsAreIdentical)
+    {
+        uint32_t sharedStoreCount = 0;
+        uint32_t sharedReuseCount = 0;
+        const AZStd::vector<EntityReplicationServer::EntityPayloads> sharedPayloads = SendTicks(true, sharedStoreCount, sharedReuseCount);
+
+        uint32_t unsharedStoreCount = 0;
+        uint32_t unsharedReuseCount = 0;
+        const AZStd::vector<EntityReplicationServer::EntityPayloads> unsharedPayloads = SendTicks(false, unsharedStoreCount, unsharedReuseCount);
+
+        // The first client encodes each update and the second reuses it
+        EXPECT_EQ(sharedStoreCount, EntityCount * TickCount);
+        EXPECT_EQ(sharedReuseCount, EntityCount * TickCount);
+        EXPECT_EQ(unsharedStoreCount, 0u);
+        EXPECT_EQ(unsharedReuseCount, 0u);
+
+        ASSERT_EQ(sharedPayloads.size(), unsharedPayloads.size());
+        for (AZStd::size_t index = 0; index < sharedPayloads.size(); ++index)
+        {
+            ASSERT_EQ(sharedPayloads[index].size(), EntityCount);
+            ASSERT_EQ(unsharedPayloads[index].size(), EntityCount);
+            auto sharedIter = sharedPayloads[index].begin();
+            auto unsharedIter = unsharedPayloads[index].begin();
+            for (; sharedIter != sharedPayloads[index].end(); ++sharedIter, ++unsharedIter)
+            {
+                EXPECT_EQ(sharedIter->first, unsharedIter->first);
+                EXPECT_FALSE(sharedIter->second.empty());
+                EXPECT_EQ(sharedIter->second, unsharedIter->second);
+            }
+        }
+    }
+
+    TEST_F(EntityUpdateSharingTests, SendUpdates_SingleClient_SkipsCache)
+    {
+        EntityReplicationServer server(EntityCount, 1, true, true);
+        server.SendUpdates();
+
+        EXPECT_EQ(server.TakePayloads(0).size(), EntityCount);
+        EXPECT_EQ(server.GetStoreCount(), 0u);
+        EXPECT_EQ(server.GetReuseCount(), 0u);
+    }
+}
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    using namespace Multiplayer;
+
+    // A server with this many proxy entities visible to every client connection
+    static constexpr uint32_t EntityCount = 128;
+
+    class EntityUpdateCacheBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        using UnitTest::AllocatorsBenchmarkFixture::SetUp;
+        using UnitTest::AllocatorsBenchmarkFixture::TearDown;
+
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            m_server = AZStd::make_unique<UnitTest::EntityReplicationServer>
+            (
+                EntityCount, static_cast<uint32_t>(state.range(0)), state.range(1) != 0, false
+            );
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            m_server.reset();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        AZStd::unique_ptr<UnitTest::EntityReplicationServer> m_server;
+    };
+
+    // Each iteration is one server tick, every client connection's EntityReplicationManager sending an update for every entity.
+    // Arg 0 is the client count, arg 1 is the value of sv_shareEntityUpdates.
+    BENCHMARK_DEFINE_F(EntityUpdateCacheBenchmarkFixture, SendEntityUpdatesPerTick)(benchmark::State& state)
+    {
+        const uint32_t clientCount = static_cast<uint32_t>(state.range(0));
+        for (auto _ : state)
+        {
+            m_server->SendUpdates();
+        }
+        state.SetItemsProcessed(state.iterations() * clientCount * EntityCount);
+        state.counters["Clients"] = static_cast<double>(clientCount);
+    }
+    BENCHMARK_REGISTER_F(EntityUpdateCacheBenchmarkFixture, SendEntityUpdatesPerTick)
+        ->Args({ 1, 0 })->Args({ 1, 1 })
+        ->Args({ 10, 0 })->Args({ 10, 1 })
+        ->Args({ 100, 0 })->Args({ 100, 1 });
+}
+#endif
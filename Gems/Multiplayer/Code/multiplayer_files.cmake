@@ -73,6 +73,8 @@ set(FILES
     Source/NetworkEntity/EntityReplication/EntityReplicator.cpp
     Source/NetworkEntity/EntityReplication/EntityReplicator.h
     Source/NetworkEntity/EntityReplication/EntityReplicator.inl
+    Source/NetworkEntity/EntityReplication/EntityUpdateCache.cpp
+    Source/NetworkEntity/EntityReplication/EntityUpdateCache.h
     Source/NetworkEntity/EntityReplication/PropertyPublisher.cpp
     Source/NetworkEntity/EntityReplication/PropertyPublisher.h
     Source/NetworkEntity/EntityReplication/PropertySubscriber.cpp
@@ -8,6 +8,7 @@
 
 set(FILES
     Tests/Main.cpp
+    Tests/EntityUpdateCacheTests.cpp
     Tests/IMultiplayerConnectionMock.h
     Tests/MultiplayerSystemTests.cpp
     Tests/RewindableContainerTests.cpp